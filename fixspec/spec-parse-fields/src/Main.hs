@@ -13,6 +13,7 @@
 module Main where
 
 import Data.Maybe
+import Data.Char (isAlphaNum, isAscii)
 import Data.Monoid
 import Data.List
 import Data.Function
@@ -22,13 +23,15 @@ import Data.Map.Strict (Map)
 import qualified Data.Map.Strict as Map
 import qualified Data.Text as T.Strict
 import qualified Data.Text.Lazy.IO as T
-import Data.Text.Lazy.Builder (toLazyText, fromText)
+import Data.Text.Lazy.Builder (Builder, toLazyText, fromText, singleton)
 import Data.Text.Lazy.Builder.Int (decimal)
 import Data.Text.Format as T (right)
 import qualified Data.Text.Read as T.Read
 import qualified Text.XML as XML
 import Text.XML.Cursor as XML
 import Control.Monad.Writer.Lazy
+import System.Environment (getArgs)
+import System.Exit (exitSuccess)
 
 -- Data Structures
 -- ===============
@@ -50,8 +53,42 @@ data MsgType = MsgType
         { mname    :: T.Strict.Text -- MessageType name
         , mvalue   :: T.Strict.Text -- MessageType field value
         , mversion :: T.Strict.Text -- FIX version introduced
+        , mcompid  :: Int           -- ComponentID of the message contents
         }
 
+-- One enumerated value of a FIX field
+data FieldEnum = FieldEnum
+        { evalue   :: T.Strict.Text -- Field value
+        , ename    :: T.Strict.Text -- Symbolic name of the value
+        , eversion :: T.Strict.Text -- FIX version introduced, or empty
+        }
+
+-- Map of FIX tag to the enumerated values of the field, in FIX Repository order
+type FieldEnums = Map Int [FieldEnum]
+
+-- One component block or repeating group of the FIX spec
+data Component = Component
+        { compid        :: Int           -- ComponentID
+        , compname      :: T.Strict.Text -- Component name
+        , comprepeating :: Bool          -- Is a repeating group
+        }
+
+-- One field or component in the contents of a message or component
+data MsgContent = MsgContent
+        { mctag      :: T.Strict.Text -- Field tag, or component name
+        , mcposition :: Double        -- Position in the message or component
+        , mcrequired :: Bool          -- Required
+        }
+
+-- Map of ComponentID to the contents of the message or component, in
+-- Position order
+type MsgContents = Map Int [MsgContent]
+
+-- One entry of a layout: field tag, or NumInGroup tag of a repeating group,
+-- or 0 for a component; index of the component layout, or -1 for a field;
+-- required.
+type LayoutEntry = (Int, Int, Bool)
+
 main :: IO ()
 main = do
 
@@ -59,6 +96,9 @@ main = do
 
     fixrepoFields <- XML.readFile def "../FIXRepository/Basic/Fields.xml"
     fixrepoMsgs   <- XML.readFile def "../FIXRepository/Basic/Messages.xml"
+    fixrepoEnums  <- XML.readFile def "../FIXRepository/Basic/Enums.xml"
+    fixrepoComps  <- XML.readFile def "../FIXRepository/Basic/Components.xml"
+    fixrepoConts  <- XML.readFile def "../FIXRepository/Basic/MsgContents.xml"
 
     -- Extra FIX fields omitted by the spec
     let extraflds = Map.fromList [
@@ -109,10 +149,87 @@ main = do
                 mname    <- listToMaybe $ curs $/ element "Name" &// content
                 mvalue   <- listToMaybe $ curs $/ element "MsgType" &// content
                 mversion <- listToMaybe $ attribute "added" curs
+                mcompidText <- listToMaybe $ curs $/ element "ComponentID" &// content
+                (mcompid,_) <- either (const Nothing) Just $ T.Read.decimal mcompidText
                 return $ MsgType {..}
 
+    -- All the FIX MessageTypes, sorted by MsgType value. This is the order
+    -- of msg_type_index.
+    let msgsSorted = sortBy (compare `on` mvalue) msgTypes
+
+    -- All the enumerated values of the fields from the spec
+    let fieldEnums :: FieldEnums
+        fieldEnums = Map.filterWithKey (\k _ -> Map.member k fields) $
+            Map.fromListWith (flip (++)) $ mapMaybe mkEnum $
+            XML.fromDocument fixrepoEnums
+            $| element "Enums" &/ element "Enum"
+          where
+            -- Make a FieldEnum from an element of the FIX Repository
+            -- Enums.xml file. Some values have trailing spaces in Enums.xml.
+            mkEnum :: Cursor -> Maybe (Int, [FieldEnum])
+            mkEnum curs = do
+                etagText <- listToMaybe $ curs $/ element "Tag" &// content
+                (etag,_) <- either (const Nothing) Just $ T.Read.decimal etagText
+                evalue   <- fmap T.Strict.strip $
+                    listToMaybe $ curs $/ element "Value" &// content
+                ename    <- listToMaybe $ curs $/ element "SymbolicName" &// content
+                let eversion = fromMaybe "" $ listToMaybe $ attribute "added" curs
+                return (etag, [FieldEnum {..}])
+
+    -- All the components from the spec, in FIX Repository order. This is the
+    -- order of the component layouts.
+    let components :: [Component]
+        components = mapMaybe mkComp $ XML.fromDocument fixrepoComps
+            $| element "Components" &/ element "Component"
+          where
+            -- Make a Component from an element of the FIX Repository
+            -- Components.xml file.
+            mkComp :: Cursor -> Maybe Component
+            mkComp curs = do
+                compidText <- listToMaybe $ curs $/ element "ComponentID" &// content
+                (compid,_) <- either (const Nothing) Just $ T.Read.decimal compidText
+                compname   <- listToMaybe $ curs $/ element "Name" &// content
+                comptype   <- listToMaybe $ curs $/ element "ComponentType" &// content
+                let comprepeating = "Repeating" `T.Strict.isSuffixOf` comptype
+                return Component {..}
+
+    -- The contents of all the messages and components from the spec
+    let msgContents :: MsgContents
+        msgContents = Map.map (sortBy (compare `on` mcposition)) $
+            Map.fromListWith (flip (++)) $ mapMaybe mkCont $
+            XML.fromDocument fixrepoConts
+            $| element "MsgContents" &/ element "MsgContent"
+          where
+            -- Make a MsgContent from an element of the FIX Repository
+            -- MsgContents.xml file.
+            mkCont :: Cursor -> Maybe (Int, [MsgContent])
+            mkCont curs = do
+                idText     <- listToMaybe $ curs $/ element "ComponentID" &// content
+                (cid,_)    <- either (const Nothing) Just $ T.Read.decimal idText
+                mctag      <- fmap T.Strict.strip $
+                    listToMaybe $ curs $/ element "TagText" &// content
+                posText    <- listToMaybe $ curs $/ element "Position" &// content
+                (mcposition,_) <- either (const Nothing) Just $ T.Read.double posText
+                reqdText   <- listToMaybe $ curs $/ element "Reqd" &// content
+                let mcrequired = reqdText == "1"
+                return (cid, [MsgContent {..}])
+
 
-    -- Step 2. Write hffix_fields.hpp to stdout.
+    -- Step 2. Write hffix_enums.hpp to stdout if the argument is "enums".
+
+    args <- getArgs
+    when (args == ["enums"]) $ do
+        T.putStr $ toLazyText $ execWriter $ writeEnums fields fieldEnums
+        exitSuccess
+
+    -- Write hffix_layouts.hpp to stdout if the argument is "layouts".
+
+    when (args == ["layouts"]) $ do
+        T.putStr $ toLazyText $ execWriter $
+            writeLayouts fields msgsSorted components msgContents
+        exitSuccess
+
+    -- Step 3. Write hffix_fields.hpp to stdout.
 
     T.putStr $ toLazyText $ execWriter $ do
 
@@ -245,10 +362,651 @@ main = do
             " //" <> " (" <> fromText mversion <> ")\n"
 
         tll "}"
+
+
+        -- Write C++ static dictionaries for run-time field and message
+        -- name lookup without initialization or allocation.
+        let denseLimit = 5000 :: Int
+            (denseFields, sparseFields) =
+                Map.partitionWithKey (\k _ -> k < denseLimit) fields
+            denseSize = fst (Map.findMax denseFields) + 1
+            fieldEntry Field{..} isLast =
+                "{" <> T.right 55 ' ' ("tag::" <> fromText fname <> ",") <>
+                " " <> T.right 55 ' ' ("\"" <> fromText fname <> "\",") <>
+                " " <> T.right 24 ' ' ("\"" <> fromText ftype <> "\",") <>
+                " field_type::" <> fromText (capitalize ftype) <> "}" <>
+                (if isLast then "" else ",") <> "\n"
+
+        tll ""
+        tll "#if __cplusplus >= 201103L"
+        tll "#define HFFIX_CONSTEXPR constexpr"
+        tll "#else"
+        tll "#define HFFIX_CONSTEXPR const"
+        tll "#endif"
+        tll ""
+        tll "/*!"
+        tll " * \\brief Namespace for the field_type::type enum of FIX data types."
+        tll " */"
+        tll "namespace field_type {"
+        tll "/*!"
+        tll " * \\brief FIX data type of a field."
+        tll " *"
+        tll " * The enumerator names are the FIX data type names, capitalized."
+        tll " */"
+        tll "enum type {"
+        tll "    Unknown = 0, /*!< Field is not in the dictionary. */"
+        tell $ flip foldMap
+            (markbounds $ nub $ sort $ map (capitalize . ftype) $ Map.elems fields)
+            $ \(t, _, isLast) ->
+                "    " <> fromText t <> (if isLast then "" else ",") <> "\n"
+        tll "};"
+        tll "} // namespace field_type"
+        tll ""
+        tll "/*!"
+        tll " * \\brief Name and FIX data type of one field in the static field dictionary."
+        tll " */"
+        tll "struct field_dictionary_entry {"
+        tll "    int tag;               //!< Field tag, or 0 for an unused tag in the dense part of the dictionary."
+        tll "    char const* name;      //!< Field name, for example \"Price\"."
+        tll "    char const* type;      //!< FIX data type of the field, for example \"Price\"."
+        tll "    field_type::type kind; //!< FIX data type of the field as a field_type::type."
+        tll "};"
+        tll ""
+        tll "/*!"
+        tll " * \\brief Name of one message type in the static message dictionary."
+        tll " */"
+        tll "struct message_dictionary_entry {"
+        tll "    char const* value; //!< MsgType field value, for example \"D\"."
+        tll "    char const* name;  //!< Message name, for example \"NewOrderSingle\"."
+        tll "};"
+        tll ""
+        tll "/*!"
+        tll " * \\brief Namespace for the msg_type_index::type enum of dense message type indices."
+        tll " */"
+        tll "namespace msg_type_index {"
+        tll "/*!"
+        tll " * \\brief Dense index of a message type, in order of MsgType value."
+        tll " *"
+        tll " * Use msg_type_to_index() to get the index of a MsgType field value. An array"
+        tll " * of size `msg_type_index::unknown + 1` can be indexed by every msg_type_index::type."
+        tll " */"
+        tll "enum type {"
+        tell $ flip foldMap msgsSorted $ \MsgType{..} ->
+            "    " <> T.right 45 ' ' (fromText mname <> ",") <>
+            " /*!< " <> fromText mvalue <> " */\n"
+        tll $ "    " <> T.right 45 ' ' ("unknown" :: T.Strict.Text) <>
+            " /*!< Not a MsgType in the dictionary. */"
+        tll "};"
+        tll "} // namespace msg_type_index"
+        tll ""
+        tll "/*!"
+        tll " * \\brief An empty type for each message type, for overloading on message type in a visitor for visit_msg_type()."
+        tll " */"
+        tll "template <msg_type_index::type Index> struct msg_type_constant {"
+        tll "    static const msg_type_index::type index = Index; //!< The message type index."
+        tll "};"
+        tll ""
+        tll "/* @cond EXCLUDE */"
+        tll "namespace details {"
+        tll ""
+        tll "//! Size of field_dictionary_dense. The entry at index i is for the field with tag i."
+        tll $ "enum { field_dictionary_dense_size = " <> decimal denseSize <> " };"
+        tll ""
+        tll "//! Static field dictionary for all tags less than field_dictionary_dense_size, indexed by tag."
+        tll "static HFFIX_CONSTEXPR field_dictionary_entry field_dictionary_dense[] = {"
+        tell $ flip foldMap (markbounds [0 .. denseSize - 1])
+            $ \(ftag, _, isLast) -> case Map.lookup ftag denseFields of
+                Just f -> fieldEntry f isLast
+                Nothing ->
+                    "{" <> T.right 55 ' ' ("0," :: T.Strict.Text) <>
+                    " " <> T.right 55 ' ' ("0," :: T.Strict.Text) <>
+                    " " <> T.right 24 ' ' ("0," :: T.Strict.Text) <>
+                    " field_type::Unknown}" <> (if isLast then "" else ",") <> "\n"
+        tll "};"
+        tll ""
+        tll "//! Static field dictionary for all tags not in field_dictionary_dense, sorted by tag."
+        tll "static HFFIX_CONSTEXPR field_dictionary_entry field_dictionary_sparse[] = {"
+        tell $ flip foldMap (markbounds $ Map.toAscList sparseFields)
+            $ \((_, f), _, isLast) -> fieldEntry f isLast
+        tll "};"
+        tll ""
+        tll "//! Static message dictionary, sorted by MsgType value."
+        tll "static HFFIX_CONSTEXPR message_dictionary_entry message_dictionary[] = {"
+        tell $ flip foldMap (markbounds msgsSorted)
+            $ \(MsgType{..}, _, isLast) ->
+                "{" <> T.right 6 ' ' ("\"" <> fromText mvalue <> "\",") <>
+                " \"" <> fromText mname <> "\"}" <>
+                (if isLast then "" else ",") <> "\n"
+        tll "};"
+        tll ""
+        tll "inline field_dictionary_entry const* field_dictionary_find(int tag) {"
+        tll "    if (tag >= 0 && tag < field_dictionary_dense_size)"
+        tll "        return field_dictionary_dense[tag].name ? &field_dictionary_dense[tag] : 0;"
+        tll "    int const size = sizeof(field_dictionary_sparse) / sizeof(field_dictionary_sparse[0]);"
+        tll "    int lo = 0;"
+        tll "    int hi = size;"
+        tll "    while (lo < hi) {"
+        tll "        int const mid = (lo + hi) / 2;"
+        tll "        if (field_dictionary_sparse[mid].tag < tag) lo = mid + 1;"
+        tll "        else hi = mid;"
+        tll "    }"
+        tll "    return (lo < size && field_dictionary_sparse[lo].tag == tag) ? &field_dictionary_sparse[lo] : 0;"
+        tll "}"
+        tll ""
+        tll "//! Code of each byte in a MsgType value: 1 to 62 for [0-9A-Za-z], else 0."
+        tll "static HFFIX_CONSTEXPR unsigned char msg_type_char_code[256] = {"
+        tell $ flip foldMap (markbounds $ chunksOf 16 $ map (msgCharCode . toEnum) [0 .. 255])
+            $ \(row, _, isLast) ->
+                mconcat (intersperse ", " $ map (T.left 2 ' ' . decimal) row) <>
+                (if isLast then "" else ",") <> "\n"
+        tll "};"
+        tll ""
+        tll "//! Perfect hash of MsgType values of 1 or 2 bytes to msg_type_index::type,"
+        tll "//! indexed by msg_type_char_code[first byte] + 63 * msg_type_char_code[second byte]."
+        tll "//! Each row is one second byte, so 1-byte MsgType values are all in the first row."
+        tll "static HFFIX_CONSTEXPR unsigned char msg_type_hash[63 * 63] = {"
+        let msgHashes = Map.fromList $ zip (map (msgTypeHash . mvalue) msgsSorted) [0 :: Int ..]
+            unknownIndex = length msgsSorted
+        tell $ flip foldMap (markbounds $ chunksOf 63
+                [ fromMaybe unknownIndex (Map.lookup h msgHashes) | h <- [0 .. 63 * 63 - 1] ])
+            $ \(row, _, isLast) ->
+                mconcat (intersperse "," $ map decimal row) <>
+                (if isLast then "" else ",") <> "\n"
+        tll "};"
+        tll ""
+        tll "} // namespace details"
+        tll "/* @endcond */"
+        tll ""
+        tll "/*!"
+        tll " * \\brief Look up the name of a field in the static field dictionary."
+        tll " *"
+        tll " * Unlike dictionary_init_field(), the static field dictionary needs no"
+        tll $ " * initialization and does no allocation. Tags less than " <> decimal denseLimit <> " are looked up"
+        tll " * by indexing a dense array, other tags by binary search."
+        tll " *"
+        tll " * \\param tag The field tag."
+        tll " * \\return The field name, or a null pointer if the tag is not in the dictionary."
+        tll " */"
+        tll "inline char const* dictionary_field_name(int tag) {"
+        tll "    field_dictionary_entry const* e = details::field_dictionary_find(tag);"
+        tll "    return e ? e->name : 0;"
+        tll "}"
+        tll ""
+        tll "/*!"
+        tll " * \\brief Look up the FIX data type of a field in the static field dictionary."
+        tll " *"
+        tll " * \\param tag The field tag."
+        tll " * \\return The FIX data type name, for example \"Price\", or a null pointer if the tag is not in the dictionary."
+        tll " */"
+        tll "inline char const* dictionary_field_type(int tag) {"
+        tll "    field_dictionary_entry const* e = details::field_dictionary_find(tag);"
+        tll "    return e ? e->type : 0;"
+        tll "}"
+        tll ""
+        tll "/*!"
+        tll " * \\brief Look up the FIX data type of a field in the static field dictionary as a field_type::type."
+        tll " *"
+        tll " * \\param tag The field tag."
+        tll " * \\return The FIX data type, or field_type::Unknown if the tag is not in the dictionary."
+        tll " */"
+        tll "inline field_type::type field_type_of(int tag) {"
+        tll "    field_dictionary_entry const* e = details::field_dictionary_find(tag);"
+        tll "    return e ? e->kind : field_type::Unknown;"
+        tll "}"
+        tll ""
+        tll "/*!"
+        tll " * \\brief Map a MsgType field value to a dense msg_type_index::type."
+        tll " *"
+        tll " * A perfect hash of the 1 or 2 bytes of the value, with two or three table loads and no"
+        tll " * string compares."
+        tll " *"
+        tll " * \\param begin Pointer to the beginning of the MsgType field value."
+        tll " * \\param end Pointer to past-the-end of the MsgType field value."
+        tll " * \\return The message type index, or msg_type_index::unknown if the MsgType is not in the dictionary."
+        tll " */"
+        tll "inline msg_type_index::type msg_type_to_index(char const* begin, char const* end) {"
+        tll "    unsigned char const* b = reinterpret_cast<unsigned char const*>(begin);"
+        tll "    int h;"
+        tll "    switch (end - begin) {"
+        tll "    case 1:"
+        tll "        h = details::msg_type_char_code[b[0]];"
+        tll "        break;"
+        tll "    case 2:"
+        tll "        if (!details::msg_type_char_code[b[1]]) return msg_type_index::unknown;"
+        tll "        h = details::msg_type_char_code[b[0]] + 63 * details::msg_type_char_code[b[1]];"
+        tll "        break;"
+        tll "    default:"
+        tll "        return msg_type_index::unknown;"
+        tll "    }"
+        tll "    return msg_type_index::type(details::msg_type_hash[h]);"
+        tll "}"
+        tll ""
+        tll "/*!"
+        tll " * \\brief Look up the name of a message type in the static message dictionary."
+        tll " *"
+        tll " * Unlike dictionary_init_message(), the static message dictionary needs no"
+        tll " * initialization and does no allocation. Lookup is by msg_type_to_index()."
+        tll " *"
+        tll " * \\param begin Pointer to the beginning of the MsgType field value."
+        tll " * \\param end Pointer to past-the-end of the MsgType field value."
+        tll " * \\return The message name, or a null pointer if the MsgType is not in the dictionary."
+        tll " */"
+        tll "inline char const* dictionary_message_name(char const* begin, char const* end) {"
+        tll "    msg_type_index::type const i = msg_type_to_index(begin, end);"
+        tll "    return i == msg_type_index::unknown ? 0 : details::message_dictionary[i].name;"
+        tll "}"
+        tll ""
+        tll "/*!"
+        tll " * \\brief Call a visitor with the msg_type_constant for a message type index."
+        tll " *"
+        tll " * The visitor is called as `visitor(msg_type_constant<I>(), arg)`, where `I` is"
+        tll " * the `index` argument, from a `switch` with a direct call for every message type,"
+        tll " * so the visitor can overload `operator()` for the message types it handles and have"
+        tll " * a template `operator()` for all other message types."
+        tll " *"
+        tll " * \\param index The message type index."
+        tll " * \\param visitor The visitor."
+        tll " * \\param arg Second argument for the visitor."
+        tll " */"
+        tll "template <typename Visitor, typename Arg> void visit_msg_type(msg_type_index::type index, Visitor& visitor, Arg& arg) {"
+        tll "    switch (index) {"
+        tell $ flip foldMap msgsSorted $ \MsgType{..} ->
+            "    case msg_type_index::" <> T.right 45 ' ' (fromText mname <> ":") <>
+            " visitor(msg_type_constant<msg_type_index::" <> fromText mname <>
+            ">(), arg); return;\n"
+        tll "    default: visitor(msg_type_constant<msg_type_index::unknown>(), arg); return;"
+        tll "    }"
+        tll "}"
         tll "} // namespace hffix"
         tll "#endif // HFFIX_FIELDS_HEADER"
 
 
+-- | Code of a byte in a MsgType value: 1 to 62 for [0-9A-Za-z], else 0.
+msgCharCode :: Char -> Int
+msgCharCode c
+    | c >= '0' && c <= '9' = fromEnum c - fromEnum '0' + 1
+    | c >= 'A' && c <= 'Z' = fromEnum c - fromEnum 'A' + 11
+    | c >= 'a' && c <= 'z' = fromEnum c - fromEnum 'a' + 37
+    | otherwise = 0
+
+-- | Perfect hash of a MsgType value of 1 or 2 bytes, in [0, 63 * 63).
+msgTypeHash :: T.Strict.Text -> Int
+msgTypeHash v = case T.Strict.unpack v of
+    [c0]     -> msgCharCode c0
+    [c0, c1] -> msgCharCode c0 + 63 * msgCharCode c1
+    _        -> error $ "MsgType value too long: " <> T.Strict.unpack v
+
+-- | Split a list into chunks of length n.
+chunksOf :: Int -> [a] -> [[a]]
+chunksOf _ [] = []
+chunksOf n xs = let (a, b) = splitAt n xs in a : chunksOf n b
+
+-- | Capitalize a FIX data type name to make a C++ enumerator name which is
+-- not a keyword, for example "int" -> "Int".
+capitalize :: T.Strict.Text -> T.Strict.Text
+capitalize t = T.Strict.toUpper (T.Strict.take 1 t) <> T.Strict.drop 1 t
+
+-- | Write hffix_enums.hpp, with a namespace of enumerated values for each
+-- field which has enumerated values of at most 4 bytes.
+writeEnums :: Fields -> FieldEnums -> Writer Builder ()
+writeEnums fields fieldEnums = do
+
+    let tll x = tell $ x <> "\n" -- tell line
+
+    tll "/*!"
+    tll "\\file"
+    tll "\\brief The hffix_enums.hpp file is generated by the fixspec/spec-parse-fields Haskell program from the FIX Protocol specification documents in the fixspec/ directory."
+    tll ""
+    tll "Do not edit this file, instead modify the fixspec/spec-parse-fields program and run it from the fixspec/spec-parse-fields directory as shown here."
+    tll "Requires Nix."
+    tll ""
+    tll "    cd fixspec/spec-parse-fields"
+    tll "    nix develop"
+    tll "    cabal v2-build"
+    tll "    cabal v2-run -- enums > hffix_enums.hpp"
+    tll "    mv hffix_enums.hpp ../../include/hffix_enums.hpp"
+    tll ""
+    tll "For each field which has enumerated values of at most 4 bytes in the FIX Repository Enums.xml, there is a namespace in hffix::enums named after the field."
+    tll "*/"
+    tll ""
+    tll "#ifndef HFFIX_ENUMS_HEADER"
+    tll "#define HFFIX_ENUMS_HEADER"
+    tll "#include \"hffix_fields.hpp\" // for HFFIX_CONSTEXPR"
+    tll "namespace hffix {"
+    tll ""
+    tll "/*!"
+    tll " * \\brief One enumerated value of a field, in the table of values for the field."
+    tll " */"
+    tll "struct enum_dictionary_entry {"
+    tll "    int key;           //!< The enumerator, which is the bytes of the field value packed into an int."
+    tll "    char const* value; //!< Field value, for example \"1\"."
+    tll "    char const* name;  //!< Symbolic name of the value, for example \"Buy\"."
+    tll "};"
+    tll ""
+    tll "/* @cond EXCLUDE */"
+    tll "namespace details {"
+    tll ""
+    tll "// Pack a field value of 1 to 4 bytes into an int, first byte least significant."
+    tll "// Returns 0 for any other length, which is never a valid enumerator."
+    tll "inline int enum_key(char const* begin, char const* end) {"
+    tll "    unsigned char const* b = reinterpret_cast<unsigned char const*>(begin);"
+    tll "    switch (end - begin) {"
+    tll "    case 1: return b[0];"
+    tll "    case 2: return b[0] | b[1] << 8;"
+    tll "    case 3: return b[0] | b[1] << 8 | b[2] << 16;"
+    tll "    case 4: return int(b[0] | b[1] << 8 | b[2] << 16 | unsigned(b[3]) << 24);"
+    tll "    default: return 0;"
+    tll "    }"
+    tll "}"
+    tll ""
+    tll "} // namespace details"
+    tll "/* @endcond */"
+    tll ""
+    tll "/*!"
+    tll "\\brief Namespace for the enumerated values of fields."
+    tll ""
+    tll "Each field with enumerated values has a namespace here named after the field, containing:"
+    tll ""
+    tll "- `enum type`, with one enumerator for each value, named by the symbolic name of the value in the FIX Repository."
+    tll "  The enumerator is the bytes of the field value packed into an int, first byte least significant, so"
+    tll "  comparing enumerators is an integer compare and hffix::message_writer::push_back_enum() needs no lookup."
+    tll "  The `invalid` enumerator is 0, which is never a valid value."
+    tll "- `values[]`, a static table of hffix::enum_dictionary_entry for every value, in FIX Repository order."
+    tll "- `decode(begin, end)`, which returns the enumerator for a field value, or `invalid` if the field value is"
+    tll "  not one of the enumerated values. Decoding is one `switch` on the packed value."
+    tll ""
+    tll "Symbolic names which are C++ keywords have a `_` suffix, for example hffix::enums::EntitlementAttribDatatype::char_."
+    tll "Symbolic names which are repeated within a field have the value as a suffix."
+    tll "For MultipleCharValue and MultipleStringValue fields, decode one space-separated value at a time."
+    tll "*/"
+    tll "namespace enums {"
+
+    let smallEnums = Map.filter (all (smallValue . evalue)) fieldEnums
+        smallValue v = T.Strict.length v >= 1 && T.Strict.length v <= 4
+
+    forM_ (Map.toAscList smallEnums) $ \(ftag, es) -> do
+        let Field {..} = fields Map.! ftag
+            ident = enumIdent es
+        tll ""
+        tll $ "/*! \\brief Enumerated values of field " <> fromText fname <>
+            " (" <> decimal ftag <> ", " <> fromText ftype <> "). */"
+        tll $ "namespace " <> fromText fname <> " {"
+        tll "enum type {"
+        tll $ "    " <> T.right 50 ' ' ("invalid = 0," :: T.Strict.Text) <>
+            " /*!< Not a valid value. */"
+        tell $ flip foldMap (markbounds es) $ \(e@FieldEnum {..}, _, isLast) ->
+            "    " <>
+            T.right 50 ' ' (fromText (ident e) <> " = " <> enumKey evalue <>
+                            (if isLast then "" else ",")) <>
+            " /*!< " <> fromText evalue <>
+            (if T.Strict.null eversion then "" else " (" <> fromText eversion <> ")") <>
+            " */\n"
+        tll "};"
+        tll "static HFFIX_CONSTEXPR enum_dictionary_entry values[] = {"
+        tell $ flip foldMap (markbounds es) $ \(e@FieldEnum {..}, _, isLast) ->
+            "    {" <> T.right 50 ' ' (fromText (ident e) <> ",") <>
+            " " <> T.right 8 ' ' ("\"" <> fromText evalue <> "\",") <>
+            " \"" <> fromText ename <> "\"}" <>
+            (if isLast then "" else ",") <> "\n"
+        tll "};"
+        tll "inline type decode(char const* begin, char const* end) {"
+        tll "    int const k = details::enum_key(begin, end);"
+        tll "    switch (k) {"
+        tell $ flip foldMap es $ \e -> "    case " <> fromText (ident e) <> ":\n"
+        tll "        return type(k);"
+        tll "    default:"
+        tll "        return invalid;"
+        tll "    }"
+        tll "}"
+        tll $ "} // namespace " <> fromText fname
+
+    tll ""
+    tll "} // namespace enums"
+    tll ""
+    tll "/* @cond EXCLUDE */"
+    tll "namespace details {"
+    tll ""
+    tll "// The values[] table of one namespace in hffix::enums."
+    tll "struct enum_field_entry {"
+    tll "    int tag;"
+    tll "    enum_dictionary_entry const* begin;"
+    tll "    enum_dictionary_entry const* end;"
+    tll "};"
+    tll ""
+    tll "// The values[] tables of hffix::enums, sorted by field tag."
+    tll "static HFFIX_CONSTEXPR enum_field_entry enum_fields[] = {"
+    tell $ flip foldMap (markbounds $ Map.toAscList smallEnums) $ \((ftag, es), _, isLast) ->
+        let Field {..} = fields Map.! ftag
+            values = "enums::" <> fromText fname <> "::values"
+        in
+        "    {" <> T.right 50 ' ' ("tag::" <> fromText fname <> ",") <>
+        " " <> values <> ", " <> values <> " + " <> decimal (length es) <> "}" <>
+        (if isLast then "" else ",") <> "\n"
+    tll "};"
+    tll ""
+    tll "} // namespace details"
+    tll "/* @endcond */"
+    tll ""
+    tll "/*!"
+    tll " * \\brief Find the table of enumerated values of a field, by tag."
+    tll " *"
+    tll " * \\param tag Field tag."
+    tll " * \\param begin Set to the first hffix::enum_dictionary_entry of the field, if found."
+    tll " * \\param end Set to past-the-last hffix::enum_dictionary_entry of the field, if found."
+    tll " * \\return True if the field has a namespace of enumerated values in hffix::enums."
+    tll " */"
+    tll "inline bool enum_values(int tag, enum_dictionary_entry const*& begin, enum_dictionary_entry const*& end) {"
+    tll "    int const count = int(sizeof(details::enum_fields) / sizeof(details::enum_fields[0]));"
+    tll "    int lo = 0;"
+    tll "    int hi = count;"
+    tll "    while (lo < hi) {"
+    tll "        int const mid = (lo + hi) / 2;"
+    tll "        if (details::enum_fields[mid].tag < tag) lo = mid + 1;"
+    tll "        else hi = mid;"
+    tll "    }"
+    tll "    if (lo == count || details::enum_fields[lo].tag != tag) return false;"
+    tll "    begin = details::enum_fields[lo].begin;"
+    tll "    end = details::enum_fields[lo].end;"
+    tll "    return true;"
+    tll "}"
+    tll ""
+    tll "} // namespace hffix"
+    tll "#endif // HFFIX_ENUMS_HEADER"
+
+-- | Write hffix_layouts.hpp, with the fields, components and repeating groups
+-- of the body of each message type and of each component.
+writeLayouts :: Fields -> [MsgType] -> [Component] -> MsgContents -> Writer Builder ()
+writeLayouts fields msgsSorted components msgContents = do
+
+    let tll x = tell $ x <> "\n" -- tell line
+
+    tll "/*!"
+    tll "\\file"
+    tll "\\brief The hffix_layouts.hpp file is generated by the fixspec/spec-parse-fields Haskell program from the FIX Protocol specification documents in the fixspec/ directory."
+    tll ""
+    tll "Do not edit this file, instead modify the fixspec/spec-parse-fields program and run it from the fixspec/spec-parse-fields directory as shown here."
+    tll "Requires Nix."
+    tll ""
+    tll "    cd fixspec/spec-parse-fields"
+    tll "    nix develop"
+    tll "    cabal v2-build"
+    tll "    cabal v2-run -- layouts > hffix_layouts.hpp"
+    tll "    mv hffix_layouts.hpp ../../include/hffix_layouts.hpp"
+    tll ""
+    tll "The layouts are the fields, components and repeating groups of the body of each message type, and of each component, from the FIX Repository MsgContents.xml and Components.xml, in order. The StandardHeader and StandardTrailer are not included."
+    tll "*/"
+    tll ""
+    tll "#ifndef HFFIX_LAYOUTS_HEADER"
+    tll "#define HFFIX_LAYOUTS_HEADER"
+    tll "#include \"hffix_fields.hpp\" // for msg_type_index, HFFIX_CONSTEXPR"
+    tll "namespace hffix {"
+    tll ""
+
+    tll "/*!"
+    tll " * \\brief One field, component or repeating group in a hffix::layout."
+    tll " *"
+    tll " * - A field has `component` -1 and the `tag` of the field."
+    tll " * - A component has `tag` 0 and the `component` index of the component layout, whose entries belong in place of this entry."
+    tll " * - A repeating group has the `tag` of its NumInGroup field and the `component` index of the layout of one group instance."
+    tll " *   The first entry of that layout is the delimiter field of the group."
+    tll " */"
+    tll "struct layout_entry {"
+    tll "    int tag;         //!< Field tag, or NumInGroup field tag of a repeating group, or 0 for a component."
+    tll "    short component; //!< Index of the layout of a component or repeating group for component_layout(), or -1 for a field."
+    tll "    bool required;   //!< Required by the FIX Repository, when the enclosing component or group instance is present."
+    tll "};"
+    tll ""
+    tll "/*!"
+    tll " * \\brief The entries of the body of a message type, of a component, or of one instance of a repeating group."
+    tll " *"
+    tll " * Iterate over the entries from layout_begin() to layout_end()."
+    tll " */"
+    tll "struct layout {"
+    tll "    char const* name;     //!< Message or component name."
+    tll "    unsigned short begin; //!< Index of the first entry."
+    tll "    unsigned short end;   //!< Index of past-the-last entry."
+    tll "};"
+    tll ""
+    tll "/* @cond EXCLUDE */"
+    tll "namespace details {"
+    tll ""
+    tll "//! The entries of all the layouts."
+    tll "static HFFIX_CONSTEXPR layout_entry layout_entries[] = {"
+
+    let compIndex = Map.fromList $ zip (map compname components) [0 :: Int ..]
+
+        -- The entries of the contents of a message or component. The first
+        -- row of a repeating group is its NumInGroup field, which is not
+        -- part of one group instance.
+        entries :: Bool -> Int -> [LayoutEntry]
+        entries repeating cid = mapMaybe entry $
+            (if repeating then drop 1 else id) $
+            Map.findWithDefault [] cid msgContents
+
+        entry :: MsgContent -> Maybe LayoutEntry
+        entry (MsgContent tagText _ required)
+            | tagText `elem` ["StandardHeader", "StandardTrailer"] = Nothing
+            | Right (t, rest) <- T.Read.decimal tagText, T.Strict.null rest =
+                if Map.member t fields then Just (t, -1, required) else Nothing
+            | Just i <- Map.lookup tagText compIndex =
+                let Component {..} = components !! i
+                in if comprepeating
+                    then do
+                        count <- listToMaybe $ Map.findWithDefault [] compid msgContents
+                        (t,_) <- either (const Nothing) Just $ T.Read.decimal $ mctag count
+                        return (t, i, required)
+                    else Just (0, i, required)
+            | otherwise = Nothing
+
+        compEntries = map (\Component {..} -> entries comprepeating compid) components
+        msgEntries  = map (entries False . mcompid) msgsSorted
+        offsets     = scanl (+) 0 $ map length $ compEntries ++ msgEntries
+        spans       = zip3 (map compname components ++ map mname msgsSorted)
+                           offsets (drop 1 offsets)
+        (compSpans, msgSpans) = splitAt (length components) spans
+
+        entryTag t
+            | t == 0 = "0"
+            | Just Field {..} <- Map.lookup t fields = "tag::" <> fromText fname
+            | otherwise = decimal t
+
+        spanLine (name, b, e) =
+            "{" <> T.right 45 ' ' ("\"" <> fromText name <> "\",") <>
+            " " <> T.right 6 ' ' (decimal b <> ",") <> " " <> decimal e <> "}"
+
+    tell $ flip foldMap (markbounds $ concat $ compEntries ++ msgEntries)
+        $ \((t, c, r), _, isLast) ->
+            "{" <> T.right 45 ' ' (entryTag t <> ",") <>
+            " " <> T.right 5 ' ' (decimal c <> ",") <>
+            " " <> (if r then "true" else "false") <> "}" <>
+            (if isLast then "" else ",") <>
+            (if c < 0 then "" else " // " <> fromText (compname (components !! c))) <>
+            "\n"
+    tll "};"
+    tll ""
+    tll "//! Component layouts, in FIX Repository Components.xml order."
+    tll "static HFFIX_CONSTEXPR layout component_layouts[] = {"
+    tell $ flip foldMap (markbounds compSpans) $ \(s, _, isLast) ->
+        spanLine s <> (if isLast then "" else ",") <> "\n"
+    tll "};"
+    tll ""
+    tll "//! Message body layouts, indexed by msg_type_index::type."
+    tll "static HFFIX_CONSTEXPR layout message_layouts[] = {"
+    tell $ flip foldMap msgSpans $ \s -> spanLine s <> ",\n"
+    tll $ spanLine ("", 0, 0)
+    tll "};"
+    tll ""
+    tll "} // namespace details"
+    tll "/* @endcond */"
+    tll ""
+    tll "//! Number of component layouts."
+    tll $ "enum { component_layout_count = " <> decimal (length components) <> " };"
+    tll ""
+    tll "/*!"
+    tll " * \\brief The layout of the body of a message type."
+    tll " * \\param index The message type index. For msg_type_index::unknown, the layout is empty."
+    tll " */"
+    tll "inline layout const& message_layout(msg_type_index::type index) {"
+    tll "    return details::message_layouts[index];"
+    tll "}"
+    tll ""
+    tll "/*!"
+    tll " * \\brief The layout of a component, or of one instance of a repeating group."
+    tll " * \\param component The layout_entry::component index, less than component_layout_count."
+    tll " */"
+    tll "inline layout const& component_layout(int component) {"
+    tll "    return details::component_layouts[component];"
+    tll "}"
+    tll ""
+    tll "//! Pointer to the first entry of a layout."
+    tll "inline layout_entry const* layout_begin(layout const& l) {"
+    tll "    return details::layout_entries + l.begin;"
+    tll "}"
+    tll ""
+    tll "//! Pointer to past-the-last entry of a layout."
+    tll "inline layout_entry const* layout_end(layout const& l) {"
+    tll "    return details::layout_entries + l.end;"
+    tll "}"
+    tll ""
+    tll "} // namespace hffix"
+    tll "#endif // HFFIX_LAYOUTS_HEADER"
+
+-- | C++ identifier for an enumerated value of a field. Symbolic names which
+-- are repeated within the field get the value as a suffix, and symbolic
+-- names which are C++ keywords get a "_" suffix.
+enumIdent :: [FieldEnum] -> FieldEnum -> T.Strict.Text
+enumIdent es e
+    | length (filter ((== ename e) . ename) es) > 1 =
+        ename e <> "_" <> T.Strict.map underscore (evalue e)
+    | ename e `elem` cppKeywords = ename e <> "_"
+    | otherwise = ename e
+  where
+    underscore c = if isAscii c && isAlphaNum c then c else '_'
+
+-- | C++ constant expression for an enumerated value of at most 4 bytes
+-- packed into an int, first byte least significant. For example "12" is
+-- ('1' | '2' << 8).
+enumKey :: T.Strict.Text -> Builder
+enumKey v = case T.Strict.unpack v of
+    [c] -> charLit c
+    cs  -> "(" <> mconcat (intersperse " | " $ zipWith byte [0 :: Int ..] cs) <> ")"
+  where
+    charLit c = "'" <> singleton c <> "'"
+    byte 0 c = charLit c
+    byte i c = charLit c <> " << " <> decimal (8 * i)
+
+cppKeywords :: [T.Strict.Text]
+cppKeywords = T.Strict.words
+    "alignas alignof and and_eq asm auto bitand bitor bool break case catch \
+    \char char16_t char32_t class compl const constexpr const_cast continue \
+    \decltype default delete do double dynamic_cast else enum explicit export \
+    \extern false float for friend goto if inline int long mutable namespace \
+    \new noexcept not not_eq nullptr operator or or_eq private protected public \
+    \register reinterpret_cast return short signed sizeof static static_assert \
+    \static_cast struct switch template this thread_local throw true try \
+    \typedef typeid typename union unsigned using virtual void volatile \
+    \wchar_t while xor xor_eq"
+
 -- | Annotate elements of a list with Bools, the first of which is True if
 -- the element is the head of the list, the second of which is True if the
 -- element is the last of the list. Both are True for singleton.
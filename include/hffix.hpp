@@ -43,6 +43,8 @@ or implied, of T3 IP, LLC.
 #include <iostream>         // for operator<<()
 #include <limits>           // for numeric_limits<>::is_signed
 #include <stdexcept>        // for exceptions
+#include <new>              // for std::nothrow_t
+#include <cstdlib>          // for abort
 #if __cplusplus >= 201703L
 #include <string_view>      // for push_back_string()
 #endif
@@ -51,6 +53,28 @@ or implied, of T3 IP, LLC.
 #include <chrono>
 #endif
 
+#ifdef HFFIX_INSTRUMENT
+#include "hffix_instrument.hpp" // for HFFIX_INSTRUMENT_SCOPE
+#else
+#define HFFIX_INSTRUMENT_SCOPE(s)
+#define HFFIX_INSTRUMENT_SCOPE_MSG(s, index)
+#endif
+
+#ifndef HFFIX_NO_SWAR
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define HFFIX_SWAR // Word-at-a-time parsing for hffix::message_reader on padded buffers.
+#include <stdint.h>         // for uint64_t
+#endif
+#endif
+
+#ifndef HFFIX_THROW
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#define HFFIX_THROW(exception) throw exception
+#else
+#define HFFIX_THROW(exception) (static_cast<void>(sizeof(exception)), std::abort()) // Built with -fno-exceptions, see hffix::message_writer.
+#endif
+#endif
+
 #ifndef HFFIX_NO_BOOST_DATETIME
 #ifdef DATE_TIME_TIME_HPP___ // The header include guard from boost/date_time/time.hpp
 #ifdef DATE_TIME_DATE_HPP___ // The header include guard from boost/date_time/date.hpp
@@ -69,7 +93,7 @@ namespace hffix {
 namespace details {
 
 inline void throw_range_error() {
-    throw std::out_of_range("hffix message_writer buffer full");
+    HFFIX_THROW(std::out_of_range("hffix message_writer buffer full"));
 }
 
 template <std::size_t N>
@@ -126,6 +150,72 @@ template<typename Uint_type> Uint_type atou(char const* begin, char const* end)
     return val;
 }
 
+#ifdef HFFIX_SWAR
+/*
+Word-at-a-time helpers for parsing padded buffers, which may be read 8 bytes
+at a time past the end of the data. Bytes are in little-endian order, so the
+first char is the least significant byte of a word.
+
+The constants are built by swar_bytes() rather than written as 64-bit literals,
+which are not C++98.
+*/
+typedef uint64_t swar_word;
+
+// Word with the value b in every byte.
+inline swar_word swar_bytes(unsigned b)
+{
+    return ~swar_word(0) / 0xFF * b;
+}
+
+inline swar_word swar_load(char const* p)
+{
+    swar_word w;
+    std::memcpy(&w, p, sizeof(w));
+    return w;
+}
+
+// Index of the first byte of a mask which has its high bit set, or 8 if none.
+inline unsigned swar_first(swar_word mask)
+{
+    return mask ? unsigned(__builtin_ctzll(mask)) >> 3 : 8u;
+}
+
+// Mask with the high bit set in each byte of w which is '\x01', exact up to
+// the first such byte.
+inline swar_word swar_soh(swar_word w)
+{
+    swar_word const x = w ^ swar_bytes(0x01);
+    return (x - swar_bytes(0x01)) & ~x & swar_bytes(0x80);
+}
+
+// Mask with the high bit set in each byte of w which is not an ascii digit.
+inline swar_word swar_nondigit(swar_word w)
+{
+    swar_word const x = ((w & swar_bytes(0xF0)) ^ swar_bytes(0x30))  // high nibble is not 3
+        | (((w & swar_bytes(0x0F)) + swar_bytes(0x06)) & swar_bytes(0xF0)); // low nibble is over 9
+    return (((x & swar_bytes(0x7F)) + swar_bytes(0x7F)) | x) & swar_bytes(0x80);
+}
+
+// Value of the first n ascii digits of w, for 1 <= n <= 8.
+inline unsigned swar_digits(swar_word w, unsigned n)
+{
+    swar_word v = (w - swar_bytes(0x30)) << (64 - 8 * n); // leading zeros in the low bytes
+    v = (v * 10 + (v >> 8)) & (~swar_word(0) / 0xFFFF * 0xFF);        // 0x00FF00FF00FF00FF
+    v = (v * 100 + (v >> 16)) & (~swar_word(0) / 0xFFFFFFFF * 0xFFFF); // 0x0000FFFF0000FFFF
+    return unsigned((v * 10000 + (v >> 32)) & 0xFFFFFFFFu);
+}
+
+// First '\x01' at or after p. There must be one.
+inline char const* swar_find_soh(char const* p)
+{
+    while (true) {
+        unsigned const i = swar_first(swar_soh(swar_load(p)));
+        if (i < 8) return p + i;
+        p += 8;
+    }
+}
+#endif // HFFIX_SWAR
+
 
 /*
 \brief Internal integer-to-ascii conversion.
@@ -136,7 +226,7 @@ Writes an integer out as ascii.
 \param number Value of the integer to be converted.
 \param buffer Pointer to location for the ascii to be written.
 \param end Past-the-end of the buffer, to check for overflow.
-\return Pointer to past-the-end of the ascii that was written.
+\return Pointer to past-the-end of the ascii that was written, or _end_ if the buffer is too small.
 */
 template<typename Int_type> char* itoa(Int_type number, char* buffer, char* end)
 {
@@ -149,13 +239,13 @@ template<typename Int_type> char* itoa(Int_type number, char* buffer, char* end)
 
     char*b = buffer;
     do {
-        if (b >= end) details::throw_range_error();
+        if (b >= end) return end;
         *b++ = '0' + (number % 10);
         number /= 10;
     } while(number);
 
     if (isnegative) {
-        if (b >= end) details::throw_range_error();
+        if (b >= end) return end;
         *b++ = '-';
     }
 
@@ -175,14 +265,14 @@ Writes an unsigned integer out as ascii.
 \param number Value of the integer to be converted.
 \param buffer Pointer to location for the ascii to be written.
 \param end Past-the-end of the buffer, to check for overflow.
-\return Pointer to past-the-end of the ascii that was written.
+\return Pointer to past-the-end of the ascii that was written, or _end_ if the buffer is too small.
 */
 template<typename Uint_type> char* utoa(Uint_type number, char* buffer, char* end)
 {
     // Write out the digits in reverse order.
     char*b = buffer;
     do {
-        if (b >= end) details::throw_range_error();
+        if (b >= end) return end;
         *b++ = '0' + (number % 10);
         number /= 10;
     } while(number);
@@ -246,7 +336,7 @@ Non-normalized. The exponent parameter must be less than or equal to zero.
 \param exponent The exponent of the decimal float. Must be less than or equal to zero.
 \param buffer Pointer to location for the ascii to be written.
 \param end Past-the-end of the buffer, to check for overflow.
-\return Pointer to past-the-end of the ascii that was written.
+\return Pointer to past-the-end of the ascii that was written, or _end_ if the buffer is too small.
 */
 template<typename Int_type> char* dtoa(Int_type mantissa, Int_type exponent, char* buffer, char* end)
 {
@@ -259,17 +349,17 @@ template<typename Int_type> char* dtoa(Int_type mantissa, Int_type exponent, cha
 
     char*b = buffer;
     do {
-        if (b >= end) details::throw_range_error();
+        if (b >= end) return end;
         *b++ = '0' + (mantissa % 10);
         mantissa /= 10;
         if (++exponent == 0) {
-            if (b >= end) details::throw_range_error();
+            if (b >= end) return end;
             *b++ = '.';
         }
     } while(mantissa > 0 || exponent < 1);
 
     if (isnegative) {
-        if (b >= end) details::throw_range_error();
+        if (b >= end) return end;
         *b++ = '-';
     }
 
@@ -583,6 +673,63 @@ timepointtoparts_nano(TimePoint tp, int& year, int& month, int& day,
 
 /* @endcond*/
 
+/*!
+ * \brief Worst-case sizes of encoded fields, for hffix::message_writer::reserve().
+ *
+ * Each size includes the tag, the _=_ and the SOH delimiter, for any tag.
+ *
+ * \code
+ * size_t const size =
+ *     hffix::field_size::string(1) +                  // MsgType
+ *     hffix::field_size::integer<int>::value +        // MsgSeqNum
+ *     hffix::field_size::timestamp_milli +            // SendingTime
+ *     hffix::field_size::string(8) +                  // Symbol
+ *     hffix::field_size::decimal<long>::value +       // Price
+ *     hffix::field_size::trailer;
+ * \endcode
+ */
+namespace field_size {
+
+enum {
+    tag = 12,                   //!< A field with an empty value. Tag of up to 10 digits, _=_ and SOH.
+    character = tag + 1,        //!< hffix::message_writer::push_back_char()
+    enumerated = tag + 4,       //!< hffix::message_writer::push_back_enum()
+    date = tag + 8,             //!< LocalMktDate or UTCDate, YYYYMMDD
+    monthyear = tag + 6,        //!< YYYYMM
+    timeonly = tag + 8,         //!< HH:MM:SS
+    timeonly_milli = tag + 12,  //!< HH:MM:SS.sss
+    timeonly_nano = tag + 18,   //!< HH:MM:SS.sssssssss
+    timestamp = tag + 17,       //!< YYYYMMDD-HH:MM:SS
+    timestamp_milli = tag + 21, //!< YYYYMMDD-HH:MM:SS.sss
+    timestamp_nano = tag + 27,  //!< YYYYMMDD-HH:MM:SS.sssssssss
+    trailer = 7                 //!< The CheckSum field written by hffix::message_writer::push_back_trailer().
+};
+
+/*!
+ * \brief Worst-case size of an integer field of type _Int_type_.
+ */
+template <typename Int_type> struct integer {
+    enum { value = tag + std::numeric_limits<Int_type>::digits10 + 2 };
+};
+
+/*!
+ * \brief Worst-case size of a decimal float field with mantissa of type _Int_type_.
+ *
+ * Assumes that the exponent is not less than `-(std::numeric_limits<Int_type>::digits10 + 1)`.
+ */
+template <typename Int_type> struct decimal {
+    enum { value = tag + std::numeric_limits<Int_type>::digits10 + 4 };
+};
+
+/*!
+ * \brief Worst-case size of a string field with a value of up to _max_length_ bytes.
+ */
+inline size_t string(size_t max_length) {
+    return tag + max_length;
+}
+
+} // namespace field_size
+
 /*!
  * \brief One FIX message for writing.
  *
@@ -618,6 +765,28 @@ timepointtoparts_nano(TimePoint tp, int& year, int& month, int& day,
  * \code
  * w.push_back_string(hffix::tag::SendingTime, "20180309-13:46:01.0123456789123456");
  * \endcode
+ *
+ * <h3>Errors Without Exceptions</h3>
+ *
+ * A message_writer constructed with `std::nothrow` never throws. When a `push_back`
+ * method doesn't fit in the buffer, the writer records the overflow in a sticky
+ * flag, and every `push_back` method after that writes nothing. Check the flag once
+ * at the end of the message, with the result of push_back_trailer() or with overflowed().
+ *
+ * \code
+ * hffix::message_writer w(std::nothrow, buffer, buffer + sizeof(buffer));
+ * w.push_back_header("FIX.4.4");
+ * w.push_back_string(hffix::tag::MsgType, "D");
+ * // ...
+ * if (!w.push_back_trailer()) {
+ *     // The buffer was too small. Discard the message.
+ * }
+ * \endcode
+ *
+ * The bounds checks cost the same for both kinds of writer, the difference is only
+ * in what happens after a check fails. If the library is compiled with `-fno-exceptions`,
+ * then the errors which would have thrown will call `std::abort()` instead, so
+ * use the `std::nothrow` writer in that case.
  */
 class message_writer {
 public:
@@ -631,7 +800,9 @@ public:
         buffer_(buffer),
         buffer_end_(buffer + size),
         next_(buffer),
-        body_length_(NULL) {
+        body_length_(NULL),
+        nothrow_(false),
+        overflow_(false) {
     }
 
     /*!
@@ -643,7 +814,9 @@ public:
         buffer_(begin),
         buffer_end_(end),
         next_(begin),
-        body_length_(NULL) {
+        body_length_(NULL),
+        nothrow_(false),
+        overflow_(false) {
     }
 
     /*!
@@ -656,9 +829,46 @@ public:
         buffer_(buffer),
         buffer_end_(&(buffer[N])),
         next_(buffer),
-        body_length_(NULL) {
+        body_length_(NULL),
+        nothrow_(false),
+        overflow_(false) {
+    }
+
+
+    /*!
+    \brief Construct a writer which doesn't throw, by buffer begin and end.
+
+    Errors are recorded in the overflowed() flag instead.
+
+    \param begin Pointer to the buffer to be written to.
+    \param end Pointer to past-the-end of the buffer to be written to.
+    */
+    message_writer(std::nothrow_t, char* begin, char* end) :
+        buffer_(begin),
+        buffer_end_(end),
+        next_(begin),
+        body_length_(NULL),
+        nothrow_(true),
+        overflow_(false) {
     }
 
+    /*!
+    \brief Construct a writer which doesn't throw, on an array reference to a buffer.
+
+    Errors are recorded in the overflowed() flag instead.
+
+    \tparam N The size of the array.
+    \param buffer An array reference. The writer will write into the entire array of length _N_.
+    */
+    template<size_t N>
+    message_writer(std::nothrow_t, char(&buffer)[N]) :
+        buffer_(buffer),
+        buffer_end_(&(buffer[N])),
+        next_(buffer),
+        body_length_(NULL),
+        nothrow_(true),
+        overflow_(false) {
+    }
 
     /*!
      * \brief Owns no resources, so destruction is no-op.
@@ -708,6 +918,37 @@ public:
         return buffer_end_ - next_;
     }
 
+    /*!
+     * \brief True if this writer was constructed with `std::nothrow` and a `push_back` method failed.
+     *
+     * A `push_back` method fails when the remaining buffer is too small, or when
+     * push_back_header() and push_back_trailer() are called out of order. Once set,
+     * the flag stays set, every later `push_back` method writes nothing, and the
+     * message in the buffer is incomplete.
+     */
+    bool overflowed() const {
+        return overflow_;
+    }
+
+    /*!
+     * \brief Check once that the remaining buffer can hold _size_ more bytes.
+     *
+     * After a successful reservation, fields which fit in _size_ may be
+     * appended by an hffix::unchecked_writer, which doesn't check the buffer
+     * for each field. Compute _size_ from the worst-case sizes in hffix::field_size.
+     *
+     * \param size Number of bytes to reserve.
+     * \return True if the remaining buffer is big enough. False if this writer was
+     * constructed with `std::nothrow` and the remaining buffer is too small, see overflowed().
+     *
+     * \throw std::out_of_range When the remaining buffer size is too small.
+     */
+    bool reserve(size_t size) {
+        if (buffer_size_remaining() >= size && !overflow_) return true;
+        range_error();
+        return false;
+    }
+
     //@}
 
     /*! \name Transport Fields */
@@ -725,9 +966,13 @@ public:
      * \throw std::logic_error When called more than once for a single message.
      */
     void push_back_header(char const* begin_string_version) {
-        if (body_length_) throw std::logic_error("hffix message_writer.push_back_header called twice");
+        if (body_length_) {
+            logic_error("hffix message_writer.push_back_header called twice");
+            return;
+        }
         if (buffer_end_ - next_ < 2 + std::ptrdiff_t(strlen(begin_string_version)) + 3 + 7) {
-            details::throw_range_error();
+            range_error();
+            return;
         }
         memcpy(next_, "8=", 2);
         next_ += 2;
@@ -754,9 +999,13 @@ public:
      * \throw std::logic_error When called more than once for a single message.
      */
     void push_back_header(std::string_view begin_string_version) {
-        if (body_length_) throw std::logic_error("hffix message_writer.push_back_header called twice");
+        if (body_length_) {
+            logic_error("hffix message_writer.push_back_header called twice");
+            return;
+        }
         if (buffer_end_ - next_ < 2 + std::ptrdiff_t(begin_string_version.size()) + 3 + 7) {
-            details::throw_range_error();
+            range_error();
+            return;
         }
         memcpy(next_, "8=", 2);
         next_ += 2;
@@ -784,15 +1033,22 @@ public:
      * calculating the CheckSum, the standard trailer will simply write CheckSum=000. This is fine if you're sending
      * the message to a FIX parser that, like High Frequency FIX Parser, doesn't care about the CheckSum.
      *
+     * \return True if the message is complete. False if this writer was constructed with
+     * `std::nothrow` and this or any earlier `push_back` method failed, see overflowed().
+     *
      * \throw std::out_of_range When the remaining buffer size is too small.
      * \throw std::logic_error When called before message_writer::push_back_header()
      */
-    void push_back_trailer(bool calculate_checksum = true) {
+    bool push_back_trailer(bool calculate_checksum = true) {
+        HFFIX_INSTRUMENT_SCOPE(trailer);
+        if (overflow_) return false;
+
         // Calculate and write out the BodyLength.
         // BodyLength does not include the SOH character after the BodyLength field.
         // BodyLength does not include the SOH character before the CheckSum field.
         if (!body_length_) {
-            throw std::logic_error("hffix message_writer.push_back_trailer called before message_writer.push_back_header");
+            logic_error("hffix message_writer.push_back_trailer called before message_writer.push_back_header");
+            return false;
         }
 
         size_t const len = next_ - (body_length_ + 7);
@@ -804,7 +1060,8 @@ public:
         body_length_[5] = '0' + len % 10;
 
         if (buffer_end_ - next_ < 7) {
-            details::throw_range_error();
+            range_error();
+            return false;
         }
 
         // write out the CheckSum after optionally calculating it
@@ -828,7 +1085,7 @@ public:
             memcpy(next_, "10=000\x01", 7);
             next_ += 7;
         }
-
+        return true;
     }
 
     //@}
@@ -848,7 +1105,8 @@ public:
     void push_back_string(int tag, char const* begin, char const* end) {
         next_ = details::itoa(tag, next_, buffer_end_);
         if (buffer_end_ - next_ < (end - begin) + 2) {
-            details::throw_range_error();
+            range_error();
+            return;
         }
         *next_++ = '=';
         memcpy(next_, begin, end - begin);
@@ -869,7 +1127,7 @@ public:
         // is longer than the remaining buffer.
         char const* cstring_end = (char const*)memchr(cstring, 0, buffer_end_ - next_);
         if (cstring_end) push_back_string(tag, cstring, cstring_end);
-        else details::throw_range_error();
+        else range_error();
     }
 
     /*!
@@ -915,12 +1173,41 @@ public:
     void push_back_char(int tag, char character) {
         next_ = details::itoa(tag, next_, buffer_end_);
         if (buffer_end_ - next_ < 3) {
-            details::throw_range_error();
+            range_error();
+            return;
         }
         *next_++ = '=';
         *next_++ = character;
         *next_++ = '\x01';
     }
+
+    /*!
+    \brief Append an enumerated value field to the message.
+
+    The field value is unpacked from the bytes of the enumerator, so no lookup is needed.
+
+    \param tag FIX tag.
+    \param value An enumerator from hffix_enums.hpp, for example hffix::enums::Side::Buy.
+
+    \throw std::out_of_range When the remaining buffer size is too small.
+    \throw std::logic_error When value is 0, the `invalid` enumerator, which has no field value.
+    */
+    void push_back_enum(int tag, unsigned int value) {
+        if (!value) {
+            logic_error("hffix message_writer.push_back_enum called with an invalid enumerator");
+            return;
+        }
+        next_ = details::itoa(tag, next_, buffer_end_);
+        int len = 1;
+        for (unsigned int v = value >> 8; v; v >>= 8) ++len;
+        if (buffer_end_ - next_ < len + 2) {
+            range_error();
+            return;
+        }
+        *next_++ = '=';
+        for (; value; value >>= 8) *next_++ = char(value & 0xff);
+        *next_++ = '\x01';
+    }
 //@}
 
     /*! \name Integer Fields */
@@ -936,10 +1223,16 @@ public:
     */
     template<typename Int_type> void push_back_int(int tag, Int_type number) {
         next_ = details::itoa(tag, next_, buffer_end_);
-        if (next_ >= buffer_end_) details::throw_range_error();
+        if (next_ >= buffer_end_) {
+            range_error();
+            return;
+        }
         *next_++ = '=';
         next_ = details::itoa(number, next_, buffer_end_);
-        if (next_ >= buffer_end_) details::throw_range_error();
+        if (next_ >= buffer_end_) {
+            range_error();
+            return;
+        }
         *next_++ = '\x01';
     }
 
@@ -965,10 +1258,16 @@ public:
     */
     template<typename Int_type> void push_back_decimal(int tag, Int_type mantissa, Int_type exponent) {
         next_ = details::itoa(tag, next_, buffer_end_);
-        if (next_ >= buffer_end_) details::throw_range_error();
+        if (next_ >= buffer_end_) {
+            range_error();
+            return;
+        }
         *next_++ = '=';
         next_ = details::dtoa(mantissa, exponent, next_, buffer_end_);
-        if (next_ >= buffer_end_) details::throw_range_error();
+        if (next_ >= buffer_end_) {
+            range_error();
+            return;
+        }
         *next_++ = '\x01';
     }
 //@}
@@ -990,15 +1289,11 @@ public:
     void push_back_date(int tag, int year, int month, int day) {
         next_ = details::itoa(tag, next_, buffer_end_);
         if (buffer_end_ - next_ < details::len("=YYYYMMDD|")) {
-            details::throw_range_error();
+            range_error();
+            return;
         }
         *next_++ = '=';
-        itoa_padded(year, next_, next_ + 4);
-        next_ += 4;
-        itoa_padded(month, next_, next_ + 2);
-        next_ += 2;
-        itoa_padded(day, next_, next_ + 2);
-        next_ += 2;
+        next_ = put_date(next_, year, month, day);
         *next_++ = '\x01';
     }
     /*!
@@ -1013,7 +1308,8 @@ public:
     void push_back_monthyear(int tag, int year, int month) {
         next_ = details::itoa(tag, next_, buffer_end_);
         if (buffer_end_ - next_ < details::len("=YYYYMM|")) {
-            details::throw_range_error();
+            range_error();
+            return;
         }
         *next_++ = '=';
         itoa_padded(year, next_, next_ + 4);
@@ -1040,17 +1336,11 @@ public:
     void push_back_timeonly(int tag, int hour, int minute, int second) {
         next_ = details::itoa(tag, next_, buffer_end_);
         if (buffer_end_ - next_ < details::len("=HH:MM:SS|")) {
-            details::throw_range_error();
+            range_error();
+            return;
         }
         *next_++ = '=';
-        itoa_padded(hour, next_, next_ + 2);
-        next_ += 2;
-        *next_++ = ':';
-        itoa_padded(minute, next_, next_ + 2);
-        next_ += 2;
-        *next_++ = ':';
-        itoa_padded(second, next_, next_ + 2);
-        next_ += 2;
+        next_ = put_time(next_, hour, minute, second);
         *next_++ = '\x01';
     }
 
@@ -1070,20 +1360,12 @@ public:
     void push_back_timeonly(int tag, int hour, int minute, int second, int millisecond) {
         next_ = details::itoa(tag, next_, buffer_end_);
         if (buffer_end_ - next_ < details::len("=HH:MM:SS.sss|")) {
-            details::throw_range_error();
+            range_error();
+            return;
         }
         *next_++ = '=';
-        itoa_padded(hour, next_, next_ + 2);
-        next_ += 2;
-        *next_++ = ':';
-        itoa_padded(minute, next_, next_ + 2);
-        next_ += 2;
-        *next_++ = ':';
-        itoa_padded(second, next_, next_ + 2);
-        next_ += 2;
-        *next_++ = '.';
-        itoa_padded(millisecond, next_, next_ + 3);
-        next_ += 3;
+        next_ = put_time(next_, hour, minute, second);
+        next_ = put_fraction(next_, millisecond, 3);
         *next_++ = '\x01';
     }
 
@@ -1103,20 +1385,12 @@ public:
     void push_back_timeonly_nano(int tag, int hour, int minute, int second, int nanosecond) {
         next_ = details::itoa(tag, next_, buffer_end_);
         if (buffer_end_ - next_ < details::len("=HH:MM:SS.sssssssss|")) {
-            details::throw_range_error();
+            range_error();
+            return;
         }
         *next_++ = '=';
-        itoa_padded(hour, next_, next_ + 2);
-        next_ += 2;
-        *next_++ = ':';
-        itoa_padded(minute, next_, next_ + 2);
-        next_ += 2;
-        *next_++ = ':';
-        itoa_padded(second, next_, next_ + 2);
-        next_ += 2;
-        *next_++ = '.';
-        itoa_padded(nanosecond, next_, next_ + 9);
-        next_ += 9;
+        next_ = put_time(next_, hour, minute, second);
+        next_ = put_fraction(next_, nanosecond, 9);
         *next_++ = '\x01';
     }
 
@@ -1141,24 +1415,13 @@ public:
         next_ = details::itoa(tag, next_, buffer_end_);
 
         if (buffer_end_ - next_ < details::len("=YYYYMMDD-HH:MM:SS|")) {
-            details::throw_range_error();
+            range_error();
+            return;
         }
         *next_++ = '=';
-        itoa_padded(year, next_, next_ + 4);
-        next_ += 4;
-        itoa_padded(month, next_, next_ + 2);
-        next_ += 2;
-        itoa_padded(day, next_, next_ + 2);
-        next_ += 2;
+        next_ = put_date(next_, year, month, day);
         *next_++ = '-';
-        itoa_padded(hour, next_, next_ + 2);
-        next_ += 2;
-        *next_++ = ':';
-        itoa_padded(minute, next_, next_ + 2);
-        next_ += 2;
-        *next_++ = ':';
-        itoa_padded(second, next_, next_ + 2);
-        next_ += 2;
+        next_ = put_time(next_, hour, minute, second);
         *next_++ = '\x01';
     }
 
@@ -1181,27 +1444,14 @@ public:
     void push_back_timestamp(int tag, int year, int month, int day, int hour, int minute, int second, int millisecond) {
         next_ = details::itoa(tag, next_, buffer_end_);
         if (buffer_end_ - next_ < details::len("=YYYYMMDD-HH:MM:SS.sss|")) {
-            details::throw_range_error();
+            range_error();
+            return;
         }
         *next_++ = '=';
-        itoa_padded(year, next_, next_ + 4);
-        next_ += 4;
-        itoa_padded(month, next_, next_ + 2);
-        next_ += 2;
-        itoa_padded(day, next_, next_ + 2);
-        next_ += 2;
+        next_ = put_date(next_, year, month, day);
         *next_++ = '-';
-        itoa_padded(hour, next_, next_ + 2);
-        next_ += 2;
-        *next_++ = ':';
-        itoa_padded(minute, next_, next_ + 2);
-        next_ += 2;
-        *next_++ = ':';
-        itoa_padded(second, next_, next_ + 2);
-        next_ += 2;
-        *next_++ = '.';
-        itoa_padded(millisecond, next_, next_ + 3);
-        next_ += 3;
+        next_ = put_time(next_, hour, minute, second);
+        next_ = put_fraction(next_, millisecond, 3);
         *next_++ = '\x01';
     }
 
@@ -1224,27 +1474,14 @@ public:
     void push_back_timestamp_nano(int tag, int year, int month, int day, int hour, int minute, int second, int nanosecond) {
         next_ = details::itoa(tag, next_, buffer_end_);
         if (buffer_end_ - next_ < details::len("=YYYYMMDD-HH:MM:SS.sssssssss|")) {
-            details::throw_range_error();
+            range_error();
+            return;
         }
         *next_++ = '=';
-        itoa_padded(year, next_, next_ + 4);
-        next_ += 4;
-        itoa_padded(month, next_, next_ + 2);
-        next_ += 2;
-        itoa_padded(day, next_, next_ + 2);
-        next_ += 2;
+        next_ = put_date(next_, year, month, day);
         *next_++ = '-';
-        itoa_padded(hour, next_, next_ + 2);
-        next_ += 2;
-        *next_++ = ':';
-        itoa_padded(minute, next_, next_ + 2);
-        next_ += 2;
-        *next_++ = ':';
-        itoa_padded(second, next_, next_ + 2);
-        next_ += 2;
-        *next_++ = '.';
-        itoa_padded(nanosecond, next_, next_ + 9);
-        next_ += 9;
+        next_ = put_time(next_, hour, minute, second);
+        next_ = put_fraction(next_, nanosecond, 9);
         *next_++ = '\x01';
     }
 //@}
@@ -1346,7 +1583,7 @@ public:
                 static_cast<int>(timestamp.time_of_day().fractional_seconds() * 1000 / boost::posix_time::time_duration::ticks_per_second())
             );
         else
-            throw std::logic_error("push_back_timestamp called with not_a_date_time.");
+            logic_error("push_back_timestamp called with not_a_date_time.");
     }
 
     /*!
@@ -1376,7 +1613,7 @@ public:
                 static_cast<int>(timestamp.time_of_day().fractional_seconds() * 1000000000L / boost::posix_time::time_duration::ticks_per_second())
             );
         else
-            throw std::logic_error("push_back_timestamp_nano called with not_a_date_time.");
+            logic_error("push_back_timestamp_nano called with not_a_date_time.");
     }
 //@}
 #endif // HFFIX_BOOST_DATETIME
@@ -1478,74 +1715,454 @@ public:
             duration_cast<nanoseconds>(timeonly % seconds(1)).count()
             );
     }
-//@}
-#endif
+//@}
+#endif
+
+
+    /*! \name Data Fields */
+//@{
+
+    /*!
+    \brief Append a data length field and a data field to the message.
+
+    Note that this method will append two fields to the message. The first field is an integer equal to
+    the content length of the second field. FIX does this so that the content of the second field may contain
+    Ascii NULL or SOH or other control characters.
+
+    High Frequency FIX Parser calculates the content length for you
+    and writes out both fields, you just have to provide both tags and pointers to the data.
+    For most of the data fields in FIX, it is true that tag_data = tag_data_length + 1, but we daren't assume that.
+
+    Example:
+    \code
+    hffix::message_writer r;
+    std::string data("Some data.");
+    r.push_back_data(hffix::tag::RawDataLength, hffix::tag::RawData, data.begin(), data.end());
+    \endcode
+
+    \param tag_data_length FIX tag for the data length field.
+    \param tag_data FIX tag for the data field.
+    \param begin Pointer to the beginning of the data.
+    \param end Pointer to after-the-end of the data.
+
+    \throw std::out_of_range When the remaining buffer size is too small.
+    */
+    void push_back_data(int tag_data_length, int tag_data, char const* begin, char const* end) {
+        next_ = details::itoa(tag_data_length, next_, buffer_end_);
+        if (next_ == buffer_end_) {
+            range_error();
+            return;
+        }
+        *next_++ = '=';
+        next_ = details::itoa(end - begin, next_, buffer_end_);
+        if (next_ == buffer_end_) {
+            range_error();
+            return;
+        }
+        *next_++ = '\x01';
+        next_ = details::itoa(tag_data, next_, buffer_end_);
+
+        if (buffer_end_ - next_ < (end - begin) + 2) {
+            range_error();
+            return;
+        }
+        *next_++ = '=';
+        memcpy(next_, begin, end - begin);
+        next_ += end - begin;
+        *next_++ = '\x01';
+    }
+
+
+//@}
+
+    /*! \name Serialized Fields */
+//@{
+
+    /*!
+    \brief Append fields which are already serialized.
+
+    Copies the range `begin,end` to the message as it is. The range must be zero or more
+    complete fields, each `tag=value` followed by SOH, for example a range of fields
+    from another message read by a hffix::message_reader.
+
+    \param begin Pointer to the beginning of the first field.
+    \param end Pointer to past-the-end of the SOH delimiter of the last field.
+
+    \throw std::out_of_range When the remaining buffer size is too small.
+    */
+    void push_back_fields(char const* begin, char const* end) {
+        if (buffer_end_ - next_ < end - begin) {
+            range_error();
+            return;
+        }
+        memcpy(next_, begin, end - begin);
+        next_ += end - begin;
+    }
+
+//@}
+private:
+    // Called when the remaining buffer is too small. After an overflow the
+    // remaining buffer is empty, so every later push_back fails its own bounds
+    // check and writes nothing.
+    void range_error() {
+        if (!nothrow_) details::throw_range_error();
+        overflow_ = true;
+        buffer_end_ = next_;
+    }
+
+    void logic_error(char const* what) {
+        if (!nothrow_) HFFIX_THROW(std::logic_error(what));
+        overflow_ = true;
+        buffer_end_ = next_;
+    }
+
+    friend class unchecked_writer;
+
+    static void itoa_padded(int x, char* b, char* e) {
+        while (e > b) {
+            *--e = '0' + (x % 10);
+            x /= 10;
+        }
+    }
+
+    // YYYYMMDD
+    static char* put_date(char* b, int year, int month, int day) {
+        itoa_padded(year, b, b + 4);
+        itoa_padded(month, b + 4, b + 6);
+        itoa_padded(day, b + 6, b + 8);
+        return b + 8;
+    }
+
+    // HH:MM:SS
+    static char* put_time(char* b, int hour, int minute, int second) {
+        itoa_padded(hour, b, b + 2);
+        b[2] = ':';
+        itoa_padded(minute, b + 3, b + 5);
+        b[5] = ':';
+        itoa_padded(second, b + 6, b + 8);
+        return b + 8;
+    }
+
+    // .sss or .sssssssss
+    static char* put_fraction(char* b, int fraction, int digits) {
+        *b++ = '.';
+        itoa_padded(fraction, b, b + digits);
+        return b + digits;
+    }
+
+    char* buffer_;
+    char* buffer_end_;
+    char* next_;
+    char* body_length_; // Pointer to the location at which the BodyLength should be written, once the length of the message is known. 6 chars, which allows for messagelength up to 999,999.
+    bool nothrow_;
+    bool overflow_;
+};
+
+/*!
+ * \brief Appends fields to a hffix::message_writer without checking the buffer for each field.
+ *
+ * When the largest size of a run of fields is known, check the buffer once with
+ * message_writer::reserve() and then write the fields with an unchecked_writer.
+ * The worst-case sizes of fields are in hffix::field_size.
+ *
+ * \code
+ * hffix::message_writer w(buffer, buffer + sizeof(buffer));
+ * w.push_back_header("FIX.4.4");
+ * if (w.reserve(size)) {
+ *     hffix::unchecked_writer u(w);
+ *     u.push_back_string(hffix::tag::MsgType, "D");
+ *     u.push_back_int(hffix::tag::MsgSeqNum, seqnum);
+ *     // ...
+ * }
+ * w.push_back_trailer();
+ * \endcode
+ *
+ * The fields are written at the end of the message_writer as if by the
+ * message_writer method of the same name, so calls to both may be mixed.
+ *
+ * \pre The fields written fit in the size given to the last successful
+ * message_writer::reserve(). Otherwise the unchecked_writer will write past the
+ * end of the buffer.
+ */
+class unchecked_writer {
+public:
+    /*!
+     * \brief Construct on a message_writer.
+     * \param writer The message_writer to append fields to. Must outlive this unchecked_writer.
+     */
+    explicit unchecked_writer(message_writer& writer) : w_(writer) {}
+
+    /*!
+    \brief Append a string field to the message.
+
+    \param tag FIX tag.
+    \param begin Pointer to the beginning of the string.
+    \param end Pointer to past-the-end of the string.
+    */
+    void push_back_string(int tag, char const* begin, char const* end) {
+        char* n = details::itoa(tag, w_.next_, w_.buffer_end_);
+        *n++ = '=';
+        memcpy(n, begin, end - begin);
+        n += end - begin;
+        *n++ = '\x01';
+        w_.next_ = n;
+    }
+
+    /*!
+    \brief Append a string field to the message.
+
+    \param tag FIX tag.
+    \param cstring Pointer to the beginning of a C-style null-terminated string.
+    */
+    void push_back_string(int tag, char const* cstring) {
+        push_back_string(tag, cstring, cstring + std::strlen(cstring));
+    }
+
+    /*!
+    \brief Append a string field to the message.
+
+    \param tag FIX tag.
+    \param s String.
+    */
+    void push_back_string(int tag, std::string const& s) {
+        push_back_string(tag, s.data(), s.data() + s.size());
+    }
+
+#if __cplusplus >= 201703L
+    /*!
+    \brief Append a string field to the message.
+
+    \param tag FIX tag.
+    \param s String.
+    */
+    void push_back_string(int tag, std::string_view s) {
+        push_back_string(tag, s.data(), s.data() + s.size());
+    }
+#endif
+
+    /*!
+    \brief Append a char field to the message.
+
+    \param tag FIX tag.
+    \param character An ascii character.
+    */
+    void push_back_char(int tag, char character) {
+        char* n = details::itoa(tag, w_.next_, w_.buffer_end_);
+        n[0] = '=';
+        n[1] = character;
+        n[2] = '\x01';
+        w_.next_ = n + 3;
+    }
+
+    /*!
+    \brief Append an enumerated value field to the message.
+
+    \param tag FIX tag.
+    \param value An enumerator from hffix_enums.hpp, for example hffix::enums::Side::Buy.
+
+    \throw std::logic_error When value is 0, the `invalid` enumerator, which has no field value.
+    */
+    void push_back_enum(int tag, unsigned int value) {
+        if (!value) {
+            w_.logic_error("hffix unchecked_writer.push_back_enum called with an invalid enumerator");
+            return;
+        }
+        char* n = details::itoa(tag, w_.next_, w_.buffer_end_);
+        *n++ = '=';
+        for (; value; value >>= 8) *n++ = char(value & 0xff);
+        *n++ = '\x01';
+        w_.next_ = n;
+    }
+
+    /*!
+    \brief Append an integer field to the message.
+
+    \tparam Int_type Type of integer.
+    \param tag FIX tag.
+    \param number Integer value.
+    */
+    template<typename Int_type> void push_back_int(int tag, Int_type number) {
+        char* n = details::itoa(tag, w_.next_, w_.buffer_end_);
+        *n++ = '=';
+        n = details::itoa(number, n, w_.buffer_end_);
+        *n++ = '\x01';
+        w_.next_ = n;
+    }
+
+    /*!
+    \brief Append a decimal float field to the message.
+
+    \tparam Int_type Integer type for the mantissa and exponent.
+    \param tag FIX tag.
+    \param mantissa The mantissa of the decimal float.
+    \param exponent The exponent of the decimal float. Must be less than or equal to zero.
+    */
+    template<typename Int_type> void push_back_decimal(int tag, Int_type mantissa, Int_type exponent) {
+        char* n = details::itoa(tag, w_.next_, w_.buffer_end_);
+        *n++ = '=';
+        n = details::dtoa(mantissa, exponent, n, w_.buffer_end_);
+        *n++ = '\x01';
+        w_.next_ = n;
+    }
+
+    /*!
+    \brief Append a LocalMktDate or UTCDate field to the message.
+
+    \param tag FIX tag.
+    \param year Year.
+    \param month Month.
+    \param day Day.
+    */
+    void push_back_date(int tag, int year, int month, int day) {
+        char* n = details::itoa(tag, w_.next_, w_.buffer_end_);
+        *n++ = '=';
+        n = message_writer::put_date(n, year, month, day);
+        *n++ = '\x01';
+        w_.next_ = n;
+    }
+
+    /*!
+    \brief Append a month-year field to the message.
+
+    \param tag FIX tag.
+    \param year Year.
+    \param month Month.
+    */
+    void push_back_monthyear(int tag, int year, int month) {
+        char* n = details::itoa(tag, w_.next_, w_.buffer_end_);
+        *n++ = '=';
+        message_writer::itoa_padded(year, n, n + 4);
+        message_writer::itoa_padded(month, n + 4, n + 6);
+        n[6] = '\x01';
+        w_.next_ = n + 7;
+    }
+
+    /*!
+    \brief Append a UTCTimeOnly field to the message.
+
+    \param tag FIX tag.
+    \param hour Hour.
+    \param minute Minute.
+    \param second Second.
+    */
+    void push_back_timeonly(int tag, int hour, int minute, int second) {
+        char* n = details::itoa(tag, w_.next_, w_.buffer_end_);
+        *n++ = '=';
+        n = message_writer::put_time(n, hour, minute, second);
+        *n++ = '\x01';
+        w_.next_ = n;
+    }
 
+    /*!
+    \brief Append a UTCTimeOnly field to the message with millisecond precision.
 
-    /*! \name Data Fields */
-//@{
+    \param tag FIX tag.
+    \param hour Hour.
+    \param minute Minute.
+    \param second Second.
+    \param millisecond Millisecond.
+    */
+    void push_back_timeonly(int tag, int hour, int minute, int second, int millisecond) {
+        char* n = details::itoa(tag, w_.next_, w_.buffer_end_);
+        *n++ = '=';
+        n = message_writer::put_time(n, hour, minute, second);
+        n = message_writer::put_fraction(n, millisecond, 3);
+        *n++ = '\x01';
+        w_.next_ = n;
+    }
 
     /*!
-    \brief Append a data length field and a data field to the message.
+    \brief Append a UTCTimeOnly field to the message with nanosecond precision.
 
-    Note that this method will append two fields to the message. The first field is an integer equal to
-    the content length of the second field. FIX does this so that the content of the second field may contain
-    Ascii NULL or SOH or other control characters.
+    \param tag FIX tag.
+    \param hour Hour.
+    \param minute Minute.
+    \param second Second.
+    \param nanosecond Nanosecond.
+    */
+    void push_back_timeonly_nano(int tag, int hour, int minute, int second, int nanosecond) {
+        char* n = details::itoa(tag, w_.next_, w_.buffer_end_);
+        *n++ = '=';
+        n = message_writer::put_time(n, hour, minute, second);
+        n = message_writer::put_fraction(n, nanosecond, 9);
+        *n++ = '\x01';
+        w_.next_ = n;
+    }
 
-    High Frequency FIX Parser calculates the content length for you
-    and writes out both fields, you just have to provide both tags and pointers to the data.
-    For most of the data fields in FIX, it is true that tag_data = tag_data_length + 1, but we daren't assume that.
+    /*!
+    \brief Append a UTCTimestamp field to the message.
 
-    Example:
-    \code
-    hffix::message_writer r;
-    std::string data("Some data.");
-    r.push_back_data(hffix::tag::RawDataLength, hffix::tag::RawData, data.begin(), data.end());
-    \endcode
+    \param tag FIX tag.
+    \param year Year.
+    \param month Month.
+    \param day Day.
+    \param hour Hour.
+    \param minute Minute.
+    \param second Second.
+    */
+    void push_back_timestamp(int tag, int year, int month, int day, int hour, int minute, int second) {
+        char* n = details::itoa(tag, w_.next_, w_.buffer_end_);
+        *n++ = '=';
+        n = message_writer::put_date(n, year, month, day);
+        *n++ = '-';
+        n = message_writer::put_time(n, hour, minute, second);
+        *n++ = '\x01';
+        w_.next_ = n;
+    }
 
-    \param tag_data_length FIX tag for the data length field.
-    \param tag_data FIX tag for the data field.
-    \param begin Pointer to the beginning of the data.
-    \param end Pointer to after-the-end of the data.
+    /*!
+    \brief Append a UTCTimestamp field to the message with millisecond precision.
 
-    \throw std::out_of_range When the remaining buffer size is too small.
+    \param tag FIX tag.
+    \param year Year.
+    \param month Month.
+    \param day Day.
+    \param hour Hour.
+    \param minute Minute.
+    \param second Second.
+    \param millisecond Millisecond.
     */
-    void push_back_data(int tag_data_length, int tag_data, char const* begin, char const* end) {
-        next_ = details::itoa(tag_data_length, next_, buffer_end_);
-        if (next_ == buffer_end_) details::throw_range_error();
-        *next_++ = '=';
-        next_ = details::itoa(end - begin, next_, buffer_end_);
-        if (next_ == buffer_end_) details::throw_range_error();
-        *next_++ = '\x01';
-        next_ = details::itoa(tag_data, next_, buffer_end_);
-
-        if (buffer_end_ - next_ < (end - begin) + 2) {
-            details::throw_range_error();
-        }
-        *next_++ = '=';
-        memcpy(next_, begin, end - begin);
-        next_ += end - begin;
-        *next_++ = '\x01';
+    void push_back_timestamp(int tag, int year, int month, int day, int hour, int minute, int second, int millisecond) {
+        char* n = details::itoa(tag, w_.next_, w_.buffer_end_);
+        *n++ = '=';
+        n = message_writer::put_date(n, year, month, day);
+        *n++ = '-';
+        n = message_writer::put_time(n, hour, minute, second);
+        n = message_writer::put_fraction(n, millisecond, 3);
+        *n++ = '\x01';
+        w_.next_ = n;
     }
 
+    /*!
+    \brief Append a UTCTimestamp field to the message with nanosecond precision.
 
-//@}
-private:
-    static void itoa_padded(int x, char* b, char* e) {
-        while (e > b) {
-            *--e = '0' + (x % 10);
-            x /= 10;
-        }
+    \param tag FIX tag.
+    \param year Year.
+    \param month Month.
+    \param day Day.
+    \param hour Hour.
+    \param minute Minute.
+    \param second Second.
+    \param nanosecond Nanosecond.
+    */
+    void push_back_timestamp_nano(int tag, int year, int month, int day, int hour, int minute, int second, int nanosecond) {
+        char* n = details::itoa(tag, w_.next_, w_.buffer_end_);
+        *n++ = '=';
+        n = message_writer::put_date(n, year, month, day);
+        *n++ = '-';
+        n = message_writer::put_time(n, hour, minute, second);
+        n = message_writer::put_fraction(n, nanosecond, 9);
+        *n++ = '\x01';
+        w_.next_ = n;
     }
 
-    char* buffer_;
-    char* buffer_end_;
-    char* next_;
-    char* body_length_; // Pointer to the location at which the BodyLength should be written, once the length of the message is known. 6 chars, which allows for messagelength up to 999,999.
+private:
+    message_writer& w_;
 };
 
 class message_reader;
 class message_reader_const_iterator;
+class message_snapshot;
 
 /*!
  * \brief FIX field value for hffix::message_reader.
@@ -2138,6 +2755,8 @@ private:
     friend class field;
     friend class message_reader_const_iterator;
     friend class message_reader;
+    friend class message_snapshot;
+    friend class segmented_reader_const_iterator;
     char const* begin_;
     char const* end_;
 };
@@ -2169,6 +2788,7 @@ public:
 private:
     friend class message_reader_const_iterator;
     friend class message_reader;
+    friend class segmented_reader_const_iterator;
     int tag_;
     field_value value_;
 };
@@ -2276,7 +2896,7 @@ public:
      * \pre *addend >= 0*
      */
     friend message_reader_const_iterator operator+(message_reader_const_iterator a, int addend) {
-        if (addend < 0) throw std::logic_error("message_reader::const_iterator is a Forward Iterator, so only positive addends are allowed.");
+        if (addend < 0) HFFIX_THROW(std::logic_error("message_reader::const_iterator is a Forward Iterator, so only positive addends are allowed."));
         for (int i = 0; i < addend; ++i)
             ++a;
 
@@ -2296,6 +2916,9 @@ private:
     field current_;
 
     void increment();
+#ifdef HFFIX_SWAR
+    bool increment_padded();
+#endif
 };
 
 
@@ -2364,6 +2987,43 @@ inline bool find_with_hint(ForwardIterator begin, ForwardIterator end, UnaryPred
 }
 
 
+/*!
+ * \brief Constructor tag for a hffix::message_reader on a padded buffer.
+ *
+ * Pass hffix::padded_buffer as the first argument of the message_reader
+ * constructor to promise that at least `padded_buffer_t::padding` bytes past
+ * the end of the buffer are readable. The contents of the padding don't
+ * matter.
+ *
+ * The message_reader, the message_reader::next_message_reader() and their
+ * iterators may then read past the end of the data without checking. Framing
+ * skips the bounds check before each byte of the header, and the iterators
+ * parse the tag and find the end of the value of each field eight bytes at a
+ * time, with no handling of the tail of the buffer.
+ *
+ * The results are the same as for a message_reader constructed without the
+ * tag, including for incomplete and invalid messages.
+ *
+ * \code
+ * char buffer[(1 << 16) + hffix::padded_buffer_t::padding];
+ * size_t n = read(fd, buffer, 1 << 16);
+ * hffix::message_reader reader(hffix::padded_buffer, buffer, buffer + n);
+ * \endcode
+ *
+ * Word-at-a-time parsing of fields needs GCC or Clang on a little-endian
+ * machine. Elsewhere, or if `HFFIX_NO_SWAR` is defined, only the framing
+ * takes advantage of the padding.
+ */
+struct padded_buffer_t {
+    enum {
+        padding = 64 //!< Number of readable bytes needed past the end of the buffer.
+    };
+};
+
+//! \brief The hffix::padded_buffer_t constructor tag.
+static padded_buffer_t const padded_buffer = padded_buffer_t();
+
+
 /*!
  * \brief One FIX message for reading.
  *
@@ -2414,7 +3074,8 @@ public:
         begin_(*this, 0),
         end_(*this, 0),
         is_complete_(false),
-        is_valid_(true) {
+        is_valid_(true),
+        padded_(false) {
         init();
     }
 
@@ -2429,7 +3090,24 @@ public:
         begin_(*this, 0),
         end_(*this, 0),
         is_complete_(false),
-        is_valid_(true) {
+        is_valid_(true),
+        padded_(false) {
+        init();
+    }
+
+    /*!
+    \brief Construct by buffer begin and end, on a padded buffer.
+    \param begin Pointer to the buffer to be read.
+    \param end Pointer to past-the-end of the buffer to be read. At least hffix::padded_buffer_t::padding bytes from `end` must be readable.
+    */
+    message_reader(padded_buffer_t, char const* begin, char const* end) :
+        buffer_(begin),
+        buffer_end_(end),
+        begin_(*this, 0),
+        end_(*this, 0),
+        is_complete_(false),
+        is_valid_(true),
+        padded_(true) {
         init();
     }
 
@@ -2442,7 +3120,8 @@ public:
         begin_(*this, 0),
         end_(*this, 0),
         is_complete_(that.is_complete_),
-        is_valid_(that.is_valid_) {
+        is_valid_(that.is_valid_),
+        padded_(that.padded_) {
         init();
     }
 
@@ -2459,6 +3138,7 @@ public:
         end_ = const_iterator(*this, 0);
         is_complete_ = that.is_complete_;
         is_valid_ = that.is_valid_;
+        padded_ = that.padded_;
         init();
         return *this;
     }
@@ -2476,7 +3156,8 @@ public:
         begin_(*this, 0),
         end_(*this, 0),
         is_complete_(false),
-        is_valid_(true) {
+        is_valid_(true),
+        padded_(false) {
         init();
     }
 
@@ -2492,7 +3173,8 @@ public:
         begin_(*this, 0),
         end_(*this, 0),
         is_complete_(false),
-        is_valid_(true) {
+        is_valid_(true),
+        padded_(false) {
         init();
     }
 
@@ -2542,7 +3224,7 @@ public:
      */
     message_reader next_message_reader() const {
         if (!is_complete_) {
-            throw std::logic_error("Can't call next_message_reader on an incomplete message.");
+            HFFIX_THROW(std::logic_error("Can't call next_message_reader on an incomplete message."));
         }
 
         if (!is_valid_) { // this message isn't valid, so we have to try to search for the beginning of the next message.
@@ -2552,10 +3234,11 @@ public:
                     break;
                 ++b;
             }
-            return message_reader(b, buffer_end_);
+            return padded_ ? message_reader(padded_buffer, b, buffer_end_) : message_reader(b, buffer_end_);
         }
 
-        return message_reader(end_.current_.value_.end_ + 1, buffer_end_);
+        char const* const next = end_.current_.value_.end_ + 1;
+        return padded_ ? message_reader(padded_buffer, next, buffer_end_) : message_reader(next, buffer_end_);
     }
 
    /*!
@@ -2580,7 +3263,8 @@ public:
     */
     unsigned char calculate_check_sum() {
         // return iterator for beginning of nonmutable sequence
-        if (!is_valid_) throw std::logic_error("hffix Cannot calculate checksum for an invalid message.");
+        if (!is_valid_) HFFIX_THROW(std::logic_error("hffix Cannot calculate checksum for an invalid message."));
+        HFFIX_INSTRUMENT_SCOPE(checksum);
         return std::accumulate(buffer_, end_.buffer_, (unsigned char)(0));
     }
 
@@ -2592,7 +3276,7 @@ public:
     */
     const_iterator begin() const {
         // return iterator for beginning of nonmutable sequence
-        if (!is_valid_) throw std::logic_error("hffix Cannot return iterator for an invalid message.");
+        if (!is_valid_) HFFIX_THROW(std::logic_error("hffix Cannot return iterator for an invalid message."));
         return begin_;
     }
 
@@ -2602,7 +3286,7 @@ public:
     */
     const_iterator end() const {
         // return iterator for end of nonmutable sequence
-        if (!is_valid_) throw std::logic_error("hffix Cannot return iterator for an invalid message.");
+        if (!is_valid_) HFFIX_THROW(std::logic_error("hffix Cannot return iterator for an invalid message."));
         return end_;
     }
 
@@ -2612,7 +3296,7 @@ public:
     */
     const_iterator message_type() const {
         // return iterator for beginning of nonmutable sequence
-        if (!is_valid_) throw std::logic_error("hffix Cannot return iterator for an invalid message.");
+        if (!is_valid_) HFFIX_THROW(std::logic_error("hffix Cannot return iterator for an invalid message."));
         return begin_;
     }
 
@@ -2622,7 +3306,7 @@ public:
     */
     const_iterator check_sum() const {
         // return iterator for end of nonmutable sequence
-        if (!is_valid_) throw std::logic_error("hffix Cannot return iterator for an invalid message.");
+        if (!is_valid_) HFFIX_THROW(std::logic_error("hffix Cannot return iterator for an invalid message."));
         return end_;
     }
 
@@ -2713,7 +3397,7 @@ public:
     \throw std::logic_error if called on an invalid message. This exception is preventable by program logic. You should always check if a message is_valid() before reading.
     */
     char const* message_end() const {
-        if (!is_valid_) throw std::logic_error("hffix Cannot determine size of an invalid message.");
+        if (!is_valid_) HFFIX_THROW(std::logic_error("hffix Cannot determine size of an invalid message."));
         return end_.current_.value_.end_ + 1;
     }
 
@@ -2722,7 +3406,7 @@ public:
     \throw std::logic_error if called on an invalid message. This exception is preventable by program logic. You should always check if a message is_valid() before reading.
     */
     size_t message_size() const {
-        if (!is_valid_) throw std::logic_error("hffix Cannot determine size of an invalid message.");
+        if (!is_valid_) HFFIX_THROW(std::logic_error("hffix Cannot determine size of an invalid message."));
         return end_.current_.value_.end_ - buffer_ + 1;
     }
 
@@ -2732,6 +3416,9 @@ private:
     friend class message_reader_const_iterator;
 
     void init() {
+        HFFIX_INSTRUMENT_SCOPE(framing);
+
+        if (padded_ && init_padded()) return;
 
         // Skip the version prefix string "8=FIX.4.2" or "8=FIXT.1.1", et cetera.
         char const* b = buffer_ + 9; // look for the first '\x01'
@@ -2832,12 +3519,73 @@ private:
         is_complete_ = true;
     }
 
+    // Frame the message without checking the end of the buffer before each
+    // read, because the reads stay within the padding. Return false if the
+    // message is unusual in some way, and init() should decide instead.
+    //
+    // Word-at-a-time reads would be possible here too, but they turn the
+    // predictable branches into a chain of dependent instructions, which is
+    // slower for the short header fields.
+    bool init_padded() {
+        // The SOH after "8=FIX.4.2" or "8=FIXT.1.1" must be one of the 4 bytes at offset 9.
+        unsigned p = 0;
+        while (buffer_[9 + p] != '\x01') if (++p > 3) return false;
+        char const* b = buffer_ + 9 + p;
+        if (b + 3 >= buffer_end_ || b[1] != '9' || b[2] != '=') return false;
+        b += 3;
+
+        // The BodyLength digits may run up to 8 bytes into the padding before we give up.
+        size_t bodylength = 0;
+        char const* const digits = b;
+        for (; unsigned(*b - '0') < 10u; ++b) {
+            if (b - digits == 8) return false;
+            bodylength = bodylength * 10 + (*b - '0');
+        }
+        if (b == digits || *b != '\x01') return false;
+        ++b;
+
+        if (b + 3 >= buffer_end_ || b[0] != '3' || b[1] != '5') return false;
+        prefix_end_ = buffer_ + 9 + p;
+
+        char const* const checksum = b + bodylength;
+        if (checksum + 7 > buffer_end_) {
+            is_complete_ = false;
+            return true;
+        }
+        if (checksum[-1] != '\x01' || checksum[6] != '\x01') {
+            invalid();
+            return true;
+        }
+
+        // The SOH before the CheckSum stops the search.
+        char const* e = b + 4;
+        while (*e != '\x01') ++e;
+        if (e > checksum) {
+            invalid();
+            return true;
+        }
+
+        begin_.buffer_ = b;
+        begin_.current_.tag_ = 35; // MsgType
+        begin_.current_.value_.begin_ = b + 3;
+        begin_.current_.value_.end_ = e;
+
+        end_.buffer_ = checksum;
+        end_.current_.tag_ = 10; //CheckSum
+        end_.current_.value_.begin_ = checksum + 3;
+        end_.current_.value_.end_ = checksum + 6;
+
+        is_complete_ = true;
+        return true;
+    }
+
     char const* buffer_;
     char const* buffer_end_;
     const_iterator begin_;
     const_iterator end_;
     bool is_complete_;
     bool is_valid_;
+    bool padded_; // Constructed with hffix::padded_buffer.
     char const* prefix_end_; // Points after the 8=FIX... Prefix field.
 
     void invalid() {
@@ -2856,6 +3604,10 @@ bool is_tag_a_data_length(int tag);
 
 inline void message_reader_const_iterator::increment()
 {
+#ifdef HFFIX_SWAR
+    if (message_reader_->padded_ && increment_padded()) return;
+#endif
+
     buffer_ = current_.value_.end_ + 1;
     current_.value_.begin_ = buffer_;
     current_.tag_ = 0;
@@ -2897,6 +3649,32 @@ inline void message_reader_const_iterator::increment()
     }
 }
 
+#ifdef HFFIX_SWAR
+// The usual case of increment(), for a padded buffer. Return false, having
+// changed nothing, if the next field is unusual in some way, and increment()
+// should parse it instead.
+inline bool message_reader_const_iterator::increment_padded()
+{
+    char const* const b = current_.value_.end_ + 1;
+    if (b >= message_reader_->end_.current_.value_.end_ + 1) return false; // past the end of a bad message
+
+    // One word holds the tag, the '=' and often the whole value.
+    details::swar_word const w = details::swar_load(b);
+    unsigned const n = details::swar_first(details::swar_nondigit(w));
+    if (n == 0 || n > 6 || b[n] != '=') return false;
+    int const tag = int(details::swar_digits(w, n));
+    if (details::is_tag_a_data_length(tag)) return false;
+
+    // The bytes up to the '=' aren't SOH, and the SOH after the CheckSum stops the search.
+    unsigned const i = details::swar_first(details::swar_soh(w));
+    buffer_ = b;
+    current_.tag_ = tag;
+    current_.value_.begin_ = b + n + 1;
+    current_.value_.end_ = i < 8 ? b + i : details::swar_find_soh(b + 8);
+    return true;
+}
+#endif
+
 /* @cond EXCLUDE */
 
 namespace details {
@@ -2976,6 +3754,244 @@ template <typename AssociativeContainer> details::field_name_streamer<Associativ
     return details::field_name_streamer<AssociativeContainer>(tag, field_dictionary, or_number);
 }
 
+/*!
+ * \brief The msg_type_index::type of a message.
+ *
+ * \param reader A valid message.
+ * \return The index of the message MsgType, or msg_type_index::unknown if the MsgType is not in the dictionary.
+ * \throw std::logic_error if the message is not valid.
+ */
+inline msg_type_index::type message_type_index(message_reader const& reader)
+{
+    message_reader::const_iterator const i = reader.message_type();
+    return msg_type_to_index(i->value().begin(), i->value().end());
+}
+
+/*!
+ * \brief A table of message handler functions indexed by msg_type_index::type.
+ *
+ * Routing a message costs one perfect hash of the MsgType, one table load, and
+ * one indirect call, instead of comparing the MsgType to each hffix::msg_type
+ * constant in turn. See also visit_msg_type() for routing with direct calls.
+ *
+ * \tparam Context Type of the second argument passed to the handlers, for example an application session object.
+ *
+ * Example usage:
+ * \code
+ * void on_new_order(hffix::message_reader const& r, my_session& s);
+ * void on_other(hffix::message_reader const& r, my_session& s);
+ *
+ * hffix::message_dispatcher<my_session> dispatcher(on_other);
+ * dispatcher.set(hffix::msg_type_index::NewOrderSingle, on_new_order);
+ * dispatcher(reader, session);
+ * \endcode
+ */
+template <typename Context> class message_dispatcher {
+public:
+    /*! \brief Type of a message handler function. */
+    typedef void (*handler)(message_reader const&, Context&);
+
+    /*!
+     * \brief Construct with every message type routed to one handler.
+     * \param default_handler Handler for all message types which have no other handler, including msg_type_index::unknown.
+     */
+    explicit message_dispatcher(handler default_handler) {
+        std::fill(handlers_, handlers_ + msg_type_index::unknown + 1, default_handler);
+    }
+
+    /*!
+     * \brief Set the handler for a message type.
+     * \param index The message type index, for example msg_type_index::NewOrderSingle.
+     * \param h The handler.
+     */
+    void set(msg_type_index::type index, handler h) {
+        handlers_[index] = h;
+    }
+
+    /*!
+     * \brief Set the handler for a message type.
+     * \param msg_type The MsgType value, for example hffix::msg_type::NewOrderSingle.
+     * \param h The handler.
+     */
+    void set(char const* msg_type, handler h) {
+        handlers_[msg_type_to_index(msg_type, msg_type + std::strlen(msg_type))] = h;
+    }
+
+    /*!
+     * \brief Call the handler for the message type of a message.
+     * \param reader A valid message.
+     * \param context Second argument passed to the handler.
+     * \throw std::logic_error if the message is not valid.
+     */
+    void operator()(message_reader const& reader, Context& context) const {
+        msg_type_index::type const index = message_type_index(reader);
+        HFFIX_INSTRUMENT_SCOPE_MSG(dispatch, index);
+        handlers_[index](reader, context);
+    }
+
+private:
+    handler handlers_[msg_type_index::unknown + 1];
+};
+
+/*!
+ * \brief Call a visitor for the message type of a message with a direct call.
+ *
+ * Calls `visitor(msg_type_constant<I>(), reader)`, where `I` is the message_type_index() of the reader.
+ * See visit_msg_type().
+ *
+ * Example usage:
+ * \code
+ * struct router {
+ *     void operator()(hffix::msg_type_constant<hffix::msg_type_index::NewOrderSingle>, hffix::message_reader const& r) { ... }
+ *     void operator()(hffix::msg_type_constant<hffix::msg_type_index::OrderCancelRequest>, hffix::message_reader const& r) { ... }
+ *     template <typename T> void operator()(T, hffix::message_reader const& r) { ... } // All other message types.
+ * };
+ * router rt;
+ * hffix::dispatch_message(reader, rt);
+ * \endcode
+ *
+ * \param reader A valid message.
+ * \param visitor The visitor.
+ * \throw std::logic_error if the message is not valid.
+ */
+template <typename Visitor> void dispatch_message(message_reader const& reader, Visitor& visitor)
+{
+    msg_type_index::type const index = message_type_index(reader);
+    HFFIX_INSTRUMENT_SCOPE_MSG(dispatch, index);
+    visit_msg_type(index, visitor, reader);
+}
+
+#if __cplusplus >= 201103L
+/* @cond EXCLUDE */
+namespace details {
+
+// True if [b, e) is an integer or a decimal which converts to std::int64_t:
+// an optional '-' if is_signed, then 1 to 18 digits, with one '.' if is_decimal.
+inline bool is_number(char const* b, char const* e, bool is_signed, bool is_decimal)
+{
+    if (is_signed && b < e && *b == '-') ++b;
+    int digits = 0;
+    bool point = false;
+    for (; b < e; ++b) {
+        if (*b >= '0' && *b <= '9') ++digits;
+        else if (*b == '.' && is_decimal && !point) point = true;
+        else return false;
+    }
+    return digits > 0 && digits <= 18;
+}
+
+} // namespace details
+/* @endcond */
+
+/*!
+ * \brief Decode a field according to its FIX data type and pass the decoded value to a visitor.
+ *
+ * The FIX data type of the field is looked up with hffix::field_type_of(), and
+ * the field is decoded with the hffix::field_value conversion method for that
+ * type. Dispatch is a single `switch` on the hffix::field_type::type, with no virtual calls.
+ *
+ * The Visitor must have all of these member functions. The first argument is always the field being visited.
+ *
+ * Visitor member function                                            | FIX data types
+ * ------------------------------------------------------------------ | --------------
+ * `on_int(field const&, std::int64_t)`                               | int, Length, NumInGroup, SeqNum, TagNum
+ * `on_decimal(field const&, std::int64_t mantissa, std::int64_t exponent)` | float, Qty, Price, PriceOffset, Amt, Percentage
+ * `on_char(field const&, char)`                                      | char
+ * `on_bool(field const&, bool)`                                      | Boolean
+ * `on_date(field const&, int year, int month, int day)`              | LocalMktDate, UTCDateOnly
+ * `on_monthyear(field const&, int year, int month)`                  | MonthYear
+ * `on_timeonly(field const&, int hour, int minute, int second, int nanosecond)` | UTCTimeOnly, LocalMktTime
+ * `on_timestamp(field const&, int year, int month, int day, int hour, int minute, int second, int nanosecond)` | UTCTimestamp
+ * `on_string(field const&)`                                          | All other types
+ *
+ * `on_string` is also called for fields which are not in the dictionary, for
+ * fields with an empty value, and for fields whose value could not be converted
+ * to the field's data type, for example a MonthYear with a week code, or an
+ * int which is not digits, or has more than 18 digits.
+ *
+ * \param f The field to decode.
+ * \param visitor The visitor.
+ *
+ * Example usage:
+ * \code
+ * struct printer {
+ *     void on_int(hffix::field const& f, std::int64_t i) { std::cout << f.tag() << " int " << i << '\n'; }
+ *     // ... and all the other member functions
+ * };
+ * printer p;
+ * for (hffix::message_reader::const_iterator i = reader.begin(); i != reader.end(); ++i)
+ *     hffix::visit(*i, p);
+ * \endcode
+ */
+template <typename Visitor> void visit(field const& f, Visitor& visitor)
+{
+    field_value const& v = f.value();
+    if (v.size() == 0) {
+        visitor.on_string(f);
+        return;
+    }
+    switch (field_type_of(f.tag())) {
+    case field_type::Int:
+    case field_type::Length:
+    case field_type::NumInGroup:
+    case field_type::SeqNum:
+    case field_type::TagNum:
+        if (!details::is_number(v.begin(), v.end(), true, false)) break;
+        visitor.on_int(f, v.as_int<std::int64_t>());
+        return;
+    case field_type::Float:
+    case field_type::Qty:
+    case field_type::Price:
+    case field_type::PriceOffset:
+    case field_type::Amt:
+    case field_type::Percentage: {
+        if (!details::is_number(v.begin(), v.end(), true, true)) break;
+        std::int64_t mantissa, exponent;
+        v.as_decimal(mantissa, exponent);
+        visitor.on_decimal(f, mantissa, exponent);
+        return;
+    }
+    case field_type::Char:
+        if (v.size() != 1) break;
+        visitor.on_char(f, v.as_char());
+        return;
+    case field_type::Boolean:
+        if (v.size() != 1 || (v.as_char() != 'Y' && v.as_char() != 'N')) break;
+        visitor.on_bool(f, v.as_char() == 'Y');
+        return;
+    case field_type::LocalMktDate:
+    case field_type::UTCDateOnly: {
+        int year, month, day;
+        if (!v.as_date(year, month, day)) break;
+        visitor.on_date(f, year, month, day);
+        return;
+    }
+    case field_type::MonthYear: {
+        int year, month;
+        if (!v.as_monthyear(year, month)) break;
+        visitor.on_monthyear(f, year, month);
+        return;
+    }
+    case field_type::UTCTimeOnly:
+    case field_type::LocalMktTime: {
+        int hour, minute, second, nanosecond;
+        if (!v.as_timeonly_nano(hour, minute, second, nanosecond)) break;
+        visitor.on_timeonly(f, hour, minute, second, nanosecond);
+        return;
+    }
+    case field_type::UTCTimestamp: {
+        int year, month, day, hour, minute, second, nanosecond;
+        if (!v.as_timestamp_nano(year, month, day, hour, minute, second, nanosecond)) break;
+        visitor.on_timestamp(f, year, month, day, hour, minute, second, nanosecond);
+        return;
+    }
+    default:
+        break;
+    }
+    visitor.on_string(f);
+}
+#endif
+
 } // namespace hffix
 
 #endif
@@ -0,0 +1,332 @@
+/*******************************************************************************************
+Copyright 2011, T3 IP, LLC. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are
+permitted provided that the following conditions are met:
+
+   1. Redistributions of source code must retain the above copyright notice, this list of
+      conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright notice, this list
+      of conditions and the following disclaimer in the documentation and/or other materials
+      provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY T3 IP, LLC ``AS IS'' AND ANY EXPRESS OR IMPLIED
+WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL T3 IP, LLC OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those of the
+authors and should not be interpreted as representing official policies, either expressed
+or implied, of T3 IP, LLC.
+*******************************************************************************************/
+
+/*!
+ * \file
+ * \brief Fixed-capacity arena for copies of FIX messages which outlive the I/O buffer.
+ *
+ * Requires hffix.hpp.
+ */
+
+#ifndef HFFIX_ARENA_HPP
+#define HFFIX_ARENA_HPP
+
+#include "hffix.hpp"
+#include <cstddef>   // for size_t
+#include <cstring>   // for memcpy
+#include <new>       // for placement new
+#include <stdexcept> // for exceptions
+
+namespace hffix {
+
+class message_arena;
+
+/*!
+ * \brief One entry in the field index of a hffix::message_snapshot.
+ */
+struct snapshot_field {
+    int tag;             //!< Field tag.
+    unsigned int offset; //!< Offset of the field value from the beginning of the message.
+    unsigned int length; //!< Length of the field value.
+};
+
+/*!
+ * \brief A copy of one FIX message in a block of a hffix::message_arena.
+ *
+ * A snapshot is stable until it is released with message_arena::release(), no
+ * matter what happens to the I/O buffer from which it was copied. The copy of the
+ * message and, optionally, an index of its fields are contiguous in one block.
+ *
+ * Snapshots are created by message_arena::snapshot() and cannot be copied.
+ */
+class message_snapshot {
+public:
+
+    /*! \brief Pointer to the beginning of the copy of the message. */
+    char const* message_begin() const {
+        return reinterpret_cast<char const*>(this) + header_size;
+    }
+
+    /*! \brief Pointer to past-the-end of the copy of the message. */
+    char const* message_end() const {
+        return message_begin() + message_size_;
+    }
+
+    /*! \brief Size of the copy of the message, in bytes. */
+    size_t message_size() const {
+        return message_size_;
+    }
+
+    /*! \brief A hffix::message_reader for the copy of the message. */
+    message_reader reader() const {
+        return message_reader(message_begin(), message_end());
+    }
+
+    /*! \brief True if the snapshot has a field index. */
+    bool indexed() const {
+        return indexed_;
+    }
+
+    /*! \brief Number of fields in the field index, which are the fields of a hffix::message_reader iteration. 0 if the snapshot has no field index. */
+    size_t field_count() const {
+        return field_count_;
+    }
+
+    /*!
+     * \brief The field index entry at position i.
+     * \pre i < field_count()
+     */
+    snapshot_field const& field_at(size_t i) const {
+        return fields()[i];
+    }
+
+    /*!
+     * \brief The value of the field at position i in the field index.
+     * \pre i < field_count()
+     */
+    field_value value_at(size_t i) const {
+        field_value v;
+        v.begin_ = message_begin() + fields()[i].offset;
+        v.end_ = v.begin_ + fields()[i].length;
+        return v;
+    }
+
+    /*!
+     * \brief Search the field index for a field, starting at a hint position.
+     *
+     * Like hffix::message_reader::find_with_hint(), the search starts at position
+     * `i` and wraps around, so that fields looked up in message order are each
+     * found after one comparison. The search is over contiguous index entries
+     * and does not touch the message bytes.
+     *
+     * \param tag The field tag to search for.
+     * \param[in,out] i The position to start searching from. If the field is found, set to its position.
+     * \return True if the field was found.
+     * \pre indexed()
+     */
+    bool find_with_hint(int tag, size_t& i) const {
+        snapshot_field const* f = fields();
+        for (size_t j = i; j < field_count_; ++j) {
+            if (f[j].tag == tag) { i = j; return true; }
+        }
+        for (size_t j = 0; j < i && j < field_count_; ++j) {
+            if (f[j].tag == tag) { i = j; return true; }
+        }
+        return false;
+    }
+
+private:
+    friend class message_arena;
+
+    message_snapshot() {}
+    message_snapshot(message_snapshot const&);
+    message_snapshot& operator=(message_snapshot const&);
+
+    // Size of the snapshot header at the beginning of each block, rounded up so
+    // that the message copy is 16-byte aligned.
+    enum { header_size = 48 };
+
+    snapshot_field const* fields() const {
+        return reinterpret_cast<snapshot_field const*>(message_begin() + fields_offset_);
+    }
+
+    message_snapshot* next_free_;
+    size_t message_size_;
+    size_t fields_offset_;
+    size_t field_count_;
+    bool indexed_;
+};
+
+/*!
+ * \brief Fixed-capacity arena of equal-size blocks for hffix::message_snapshot.
+ *
+ * The arena carves caller-provided storage into blocks of `block_size` bytes and
+ * keeps the free blocks on an intrusive free list, so taking and releasing a
+ * snapshot is a few pointer operations, with no allocation. Released blocks are
+ * reused most-recently-released first, which keeps them warm in cache.
+ *
+ * Each snapshot occupies exactly one block, so `block_size` must be large enough
+ * for the largest message, plus its field index if field indices are wanted.
+ * Block sizes which are a multiple of 64 keep blocks on separate cache lines.
+ *
+ * The arena is not thread-safe. If snapshots are handed to another thread, they
+ * must be released on the thread which owns the arena, or the caller must
+ * synchronize.
+ *
+ * Example usage:
+ * \code
+ * static char storage[1 << 20];
+ * hffix::message_arena arena(storage, 1024);
+ *
+ * // In the read loop:
+ * hffix::message_snapshot* s = arena.snapshot(reader, true);
+ * if (s) consumer.push(s); // The I/O buffer can now be reused.
+ *
+ * // Later, in the consumer:
+ * size_t i = 0;
+ * if (s->find_with_hint(hffix::tag::ClOrdID, i)) use(s->value_at(i));
+ * arena.release(s);
+ * \endcode
+ */
+class message_arena {
+public:
+
+    /*!
+     * \brief Construct on caller-provided storage.
+     *
+     * \param storage Pointer to the storage. Must outlive the arena.
+     * \param storage_size Size of the storage in bytes.
+     * \param block_size Size of each block in bytes. Rounded up to a multiple of 16.
+     * \throw std::logic_error If block_size is too small for the snapshot header.
+     */
+    message_arena(void* storage, size_t storage_size, size_t block_size) {
+        init(static_cast<char*>(storage), storage_size, block_size);
+    }
+
+    /*!
+     * \brief Construct on an array reference to caller-provided storage.
+     *
+     * \tparam N The size of the array.
+     * \param storage An array reference. Must outlive the arena.
+     * \param block_size Size of each block in bytes. Rounded up to a multiple of 16.
+     * \throw std::logic_error If block_size is too small for the snapshot header.
+     */
+    template <size_t N>
+    message_arena(char (&storage)[N], size_t block_size) {
+        init(storage, N, block_size);
+    }
+
+    /*! \brief Size of each block in bytes. */
+    size_t block_size() const {
+        return block_size_;
+    }
+
+    /*! \brief Total number of blocks. */
+    size_t capacity() const {
+        return capacity_;
+    }
+
+    /*! \brief Number of free blocks. */
+    size_t available() const {
+        return available_;
+    }
+
+    /*!
+     * \brief Copy a complete, valid message into a free block.
+     *
+     * \param reader The message to copy. The copy begins at reader.message_begin().
+     * \param index_fields If true, also build an index of the fields of the message in the block.
+     * \return The snapshot, or a null pointer if there are no free blocks.
+     * \throw std::logic_error If the reader is not a valid message.
+     * \throw std::out_of_range If the message, or the message and its field index, do not fit in one block.
+     */
+    message_snapshot* snapshot(message_reader const& reader, bool index_fields = false) {
+        if (!reader.is_valid()) throw std::logic_error("hffix message_arena.snapshot called on an invalid message");
+
+        size_t const message_size = reader.message_end() - reader.message_begin();
+        if (message_size > block_size_ - message_snapshot::header_size) details::throw_range_error();
+
+        message_snapshot* s = free_;
+        if (!s) return 0;
+
+        char* copy = reinterpret_cast<char*>(s) + message_snapshot::header_size;
+        std::memcpy(copy, reader.message_begin(), message_size);
+
+        size_t const fields_offset = (message_size + 3) & ~size_t(3);
+        size_t field_count = 0;
+        if (index_fields) {
+            HFFIX_INSTRUMENT_SCOPE(index_build);
+            size_t const fields_capacity = fields_offset + message_snapshot::header_size >= block_size_ ? 0 :
+                (block_size_ - message_snapshot::header_size - fields_offset) / sizeof(snapshot_field);
+            snapshot_field* f = reinterpret_cast<snapshot_field*>(copy + fields_offset);
+            message_reader copy_reader(copy, copy + message_size);
+            for (message_reader::const_iterator i = copy_reader.begin(); i != copy_reader.end(); ++i) {
+                if (field_count == fields_capacity) details::throw_range_error();
+                f[field_count].tag = i->tag();
+                f[field_count].offset = static_cast<unsigned int>(i->value().begin() - copy);
+                f[field_count].length = static_cast<unsigned int>(i->value().size());
+                ++field_count;
+            }
+        }
+
+        free_ = s->next_free_;
+        --available_;
+        s->next_free_ = 0;
+        s->message_size_ = message_size;
+        s->fields_offset_ = fields_offset;
+        s->field_count_ = field_count;
+        s->indexed_ = index_fields;
+        return s;
+    }
+
+    /*!
+     * \brief Return the block of a snapshot to the arena.
+     *
+     * \param s A snapshot from this arena. After release, it must not be used.
+     */
+    void release(message_snapshot* s) {
+        s->next_free_ = free_;
+        free_ = s;
+        ++available_;
+    }
+
+private:
+    message_arena(message_arena const&);
+    message_arena& operator=(message_arena const&);
+
+    // Compile-time check that the snapshot header fits before the message copy.
+    typedef char header_size_check[sizeof(message_snapshot) <= size_t(message_snapshot::header_size) ? 1 : -1];
+
+    void init(char* storage, size_t storage_size, size_t block_size) {
+        block_size_ = (block_size + 15) & ~size_t(15);
+        if (block_size_ <= size_t(message_snapshot::header_size))
+            throw std::logic_error("hffix message_arena block_size too small");
+
+        // Align the first block to 16 bytes.
+        size_t const skew = (16 - (reinterpret_cast<size_t>(storage) & 15)) & 15;
+        capacity_ = storage_size > skew ? (storage_size - skew) / block_size_ : 0;
+        available_ = capacity_;
+
+        // Thread the free list through the blocks in address order.
+        free_ = 0;
+        for (size_t i = capacity_; i > 0; --i) {
+            message_snapshot* s = new (storage + skew + (i - 1) * block_size_) message_snapshot();
+            s->next_free_ = free_;
+            free_ = s;
+        }
+    }
+
+    message_snapshot* free_;
+    size_t block_size_;
+    size_t capacity_;
+    size_t available_;
+};
+
+} // namespace hffix
+
+#endif // HFFIX_ARENA_HPP
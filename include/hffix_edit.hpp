@@ -0,0 +1,322 @@
+/*******************************************************************************************
+Copyright 2011, T3 IP, LLC. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are
+permitted provided that the following conditions are met:
+
+   1. Redistributions of source code must retain the above copyright notice, this list of
+      conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright notice, this list
+      of conditions and the following disclaimer in the documentation and/or other materials
+      provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY T3 IP, LLC ``AS IS'' AND ANY EXPRESS OR IMPLIED
+WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL T3 IP, LLC OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those of the
+authors and should not be interpreted as representing official policies, either expressed
+or implied, of T3 IP, LLC.
+*******************************************************************************************/
+
+/*!
+ * \file
+ * \brief Rewriting some fields of a FIX message by copying the unchanged runs, for routing gateways.
+ *
+ * Requires hffix.hpp.
+ */
+
+#ifndef HFFIX_EDIT_HPP
+#define HFFIX_EDIT_HPP
+
+#include "hffix.hpp"
+#include <cstddef>   // for size_t
+#include <cstring>   // for memcpy, strlen
+#include <stdexcept> // for exceptions
+
+namespace hffix {
+
+/*!
+ * \brief A list of edits to the fields of FIX messages, and a function to apply them.
+ *
+ * <h3>Usage</h3>
+ *
+ * A FIX router which forwards a message usually changes only a few header
+ * fields. The message_editor copies a message from a hffix::message_reader to a new buffer
+ * with the edits applied, with one `memcpy` for each run of unchanged fields.
+ * The _BodyLength_ and _CheckSum_ of the copy are computed from the _BodyLength_
+ * and _CheckSum_ of the original and the bytes which changed, so the unchanged
+ * runs are not read.
+ *
+ * \code
+ * hffix::message_editor<> edit;
+ * edit.set(hffix::tag::SenderCompID, "ROUTER");
+ * edit.set(hffix::tag::TargetCompID, "VENUE");
+ * edit.erase(hffix::tag::OnBehalfOfCompID);
+ * for (; reader.is_complete(); reader = reader.next_message_reader()) {
+ *     if (reader.is_valid()) {
+ *         edit.set_int(hffix::tag::MsgSeqNum, ++seqnum);
+ *         edit.set(hffix::tag::SendingTime, now, now + 21);
+ *         out = edit.apply(reader, out, out_end);
+ *     }
+ * }
+ * \endcode
+ *
+ * The edits stay in the list for every message, and calling set() again for the same tag
+ * changes the value of the edit. An edit changes the first field with its tag. Edits
+ * should not be made to data fields, or to fields in repeating groups.
+ *
+ * \tparam MaxEdits Capacity of the list of edits.
+ */
+template <size_t MaxEdits = 16>
+class message_editor {
+public:
+
+    message_editor() : count_(0) {}
+
+    /*!
+     * \brief Set the value of a field.
+     *
+     * If the message has a field with this tag, its value is replaced. If not, the field is
+     * inserted after the _MsgType_ field.
+     *
+     * \param tag FIX tag.
+     * \param begin Pointer to the beginning of the value. The value is not copied, and must be unchanged until after apply().
+     * \param end Pointer to past-the-end of the value.
+     *
+     * \throw std::length_error If there are already _MaxEdits_ edits.
+     */
+    void set(int tag, char const* begin, char const* end) {
+        edit& e = find_or_add(tag);
+        e.erase = false;
+        e.begin = begin;
+        e.end = end;
+    }
+
+    /*!
+     * \brief Set the value of a field to a C-style null-terminated string.
+     *
+     * \param tag FIX tag.
+     * \param cstring The value. It is not copied, and must be unchanged until after apply().
+     *
+     * \throw std::length_error If there are already _MaxEdits_ edits.
+     */
+    void set(int tag, char const* cstring) {
+        set(tag, cstring, cstring + std::strlen(cstring));
+    }
+
+    /*!
+     * \brief Set the value of a field to an integer.
+     *
+     * \param tag FIX tag.
+     * \param number The value, which is copied.
+     *
+     * \throw std::length_error If there are already _MaxEdits_ edits.
+     */
+    template <typename Int_type> void set_int(int tag, Int_type number) {
+        edit& e = find_or_add(tag);
+        e.erase = false;
+        e.begin = 0;
+        e.end = 0;
+        e.digits_size = details::itoa(number, e.digits, e.digits + sizeof(e.digits)) - e.digits;
+    }
+
+    /*!
+     * \brief Remove the field with this tag, if the message has one.
+     *
+     * \throw std::length_error If there are already _MaxEdits_ edits.
+     */
+    void erase(int tag) {
+        find_or_add(tag).erase = true;
+    }
+
+    /*!
+     * \brief Remove all edits.
+     */
+    void clear() {
+        count_ = 0;
+    }
+
+    /*!
+     * \brief Copy a message with the edits applied.
+     *
+     * The copy has the same _BeginString_ as the original. Its _CheckSum_ is correct if the
+     * _CheckSum_ of the original is correct, or if `calculate_checksum` is true.
+     *
+     * \param reader A valid message.
+     * \param begin Pointer to the buffer for the copy.
+     * \param end Pointer to past-the-end of the buffer for the copy.
+     * \param calculate_checksum If true, calculate the _CheckSum_ of the copy from all of its bytes instead.
+     * \return Pointer to past-the-end of the copy.
+     *
+     * \throw std::logic_error If the message is not valid.
+     * \throw std::out_of_range When the buffer is too small.
+     */
+    char* apply(message_reader const& reader, char* begin, char* end, bool calculate_checksum = false) const {
+        message_reader::const_iterator const first = reader.begin();
+        message_reader::const_iterator const last = reader.end();
+        char const* const body = first->value().begin() - 3;  // "35="
+        char const* const trailer = last->value().begin() - 3; // "10="
+
+        // Find the fields to change, in message order, and the change in size and checksum.
+        cut cuts[MaxEdits];
+        size_t ncuts = 0;
+        bool found[MaxEdits] = {};
+        std::ptrdiff_t body_delta = 0;
+        unsigned int sum_delta = 0;
+        for (message_reader::const_iterator i = first; i != last; ++i) {
+            size_t k = index_of(i->tag());
+            if (k == count_ || found[k]) continue;
+            found[k] = true;
+            edit const& e = edits_[k];
+            cut& c = cuts[ncuts++];
+            c.e = &e;
+            if (e.erase) {
+                c.begin = i->value().begin() - 1 - tag_size(i->tag());
+                c.end = i->value().end() + 1;
+            } else {
+                c.begin = i->value().begin();
+                c.end = i->value().end();
+            }
+            body_delta += std::ptrdiff_t(value_size(e)) - (c.end - c.begin);
+            sum_delta += sum(value_begin(e), value_size(e)) - sum(c.begin, c.end - c.begin);
+        }
+
+        // Fields to insert after MsgType.
+        size_t insert_size = 0;
+        for (size_t k = 0; k < count_; ++k) {
+            if (found[k] || edits_[k].erase) continue;
+            char t[16];
+            size_t const n = details::itoa(edits_[k].tag, t, t + sizeof(t)) - t;
+            insert_size += n + 2 + value_size(edits_[k]);
+            sum_delta += sum(t, n) + '=' + '\x01' + sum(value_begin(edits_[k]), value_size(edits_[k]));
+        }
+        body_delta += insert_size;
+
+        size_t const old_body_length = trailer - body;
+        size_t const body_length = old_body_length + body_delta;
+        char length[24];
+        size_t const length_size = details::itoa(body_length, length, length + sizeof(length)) - length;
+        char const* const old_length = reader.prefix_end() + 3; // "\x01" "9="
+        sum_delta += sum(length, length_size) - sum(old_length, body - 1 - old_length);
+
+        size_t const size = (old_length - reader.message_begin()) + length_size + 1 + body_length + 7;
+        if (size_t(end - begin) < size) details::throw_range_error();
+
+        // Write the copy.
+        char* b = begin;
+        b = copy(b, reader.message_begin(), old_length);
+        b = copy(b, length, length + length_size);
+        *b++ = '\x01';
+        char const* run = body;
+        char const* const msg_type_end = first->value().end() + 1;
+        for (size_t c = 0; c < ncuts && cuts[c].begin < msg_type_end; ++c) b = apply_cut(b, run, cuts[c]);
+        b = copy(b, run, msg_type_end);
+        run = msg_type_end;
+        for (size_t k = 0; k < count_; ++k) {
+            if (found[k] || edits_[k].erase) continue;
+            b = details::itoa(edits_[k].tag, b, b + 16);
+            *b++ = '=';
+            b = copy(b, value_begin(edits_[k]), value_begin(edits_[k]) + value_size(edits_[k]));
+            *b++ = '\x01';
+        }
+        for (size_t c = 0; c < ncuts; ++c) {
+            if (cuts[c].begin >= msg_type_end) b = apply_cut(b, run, cuts[c]);
+        }
+        b = copy(b, run, trailer);
+
+        unsigned char checksum;
+        if (calculate_checksum) {
+            checksum = static_cast<unsigned char>(sum(begin, b - begin));
+        } else {
+            checksum = static_cast<unsigned char>(last->value().as_int<unsigned int>() + sum_delta);
+        }
+        memcpy(b, "10=", 3);
+        b[3] = '0' + checksum / 100;
+        b[4] = '0' + checksum / 10 % 10;
+        b[5] = '0' + checksum % 10;
+        b[6] = '\x01';
+        return b + 7;
+    }
+
+private:
+    struct edit {
+        int tag;
+        bool erase;
+        char const* begin; // null for a value in digits
+        char const* end;
+        char digits[24];
+        size_t digits_size;
+    };
+
+    // A part of the original message which is replaced.
+    struct cut {
+        edit const* e;
+        char const* begin;
+        char const* end;
+    };
+
+    size_t index_of(int tag) const {
+        for (size_t k = 0; k < count_; ++k) {
+            if (edits_[k].tag == tag) return k;
+        }
+        return count_;
+    }
+
+    edit& find_or_add(int tag) {
+        size_t const k = index_of(tag);
+        if (k < count_) return edits_[k];
+        if (count_ == MaxEdits) throw std::length_error("hffix message_editor is full");
+        edits_[count_].tag = tag;
+        return edits_[count_++];
+    }
+
+    static char const* value_begin(edit const& e) {
+        return e.begin ? e.begin : e.digits;
+    }
+
+    // The size of the replacement for the cut, which is nothing for an erase.
+    static size_t value_size(edit const& e) {
+        if (e.erase) return 0;
+        return e.begin ? size_t(e.end - e.begin) : e.digits_size;
+    }
+
+    static size_t tag_size(int tag) {
+        size_t n = 1;
+        for (; tag >= 10; tag /= 10) ++n;
+        return n;
+    }
+
+    static unsigned int sum(char const* b, size_t n) {
+        unsigned int s = 0;
+        for (char const* e = b + n; b < e; ++b) s += static_cast<unsigned char>(*b);
+        return s;
+    }
+
+    static char* copy(char* b, char const* begin, char const* end) {
+        std::memcpy(b, begin, end - begin);
+        return b + (end - begin);
+    }
+
+    // Copy the run up to the cut, and then the replacement.
+    static char* apply_cut(char* b, char const*& run, cut const& c) {
+        b = copy(b, run, c.begin);
+        b = copy(b, value_begin(*c.e), value_begin(*c.e) + value_size(*c.e));
+        run = c.end;
+        return b;
+    }
+
+    edit edits_[MaxEdits];
+    size_t count_;
+};
+
+} // namespace hffix
+
+#endif // HFFIX_EDIT_HPP
@@ -0,0 +1,1083 @@
+/*******************************************************************************************
+Copyright 2011, T3 IP, LLC. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are
+permitted provided that the following conditions are met:
+
+   1. Redistributions of source code must retain the above copyright notice, this list of
+      conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright notice, this list
+      of conditions and the following disclaimer in the documentation and/or other materials
+      provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY T3 IP, LLC ``AS IS'' AND ANY EXPRESS OR IMPLIED
+WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL T3 IP, LLC OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those of the
+authors and should not be interpreted as representing official policies, either expressed
+or implied, of T3 IP, LLC.
+*******************************************************************************************/
+
+/*!
+ * \file
+ * \brief FAST (FIX Adapted for STreaming) decoding to, and encoding from, FIX tag-value messages.
+ *
+ * Requires hffix.hpp.
+ */
+
+#ifndef HFFIX_FAST_HPP
+#define HFFIX_FAST_HPP
+
+#include "hffix.hpp"
+#include "hffix_xml.hpp"
+#include <cstddef>   // for size_t
+#include <cstring>   // for memcpy, memmove, memset, strlen
+#include <limits>    // for numeric_limits
+#include <map>
+#include <stdexcept> // for exceptions
+#include <string>
+#include <vector>
+#include <stdint.h>  // for uint64_t
+
+namespace hffix {
+
+/*!
+ * \brief FAST (FIX Adapted for STreaming) codec.
+ *
+ * FAST is a compact binary encoding of FIX messages, used by many market data feeds.
+ * A FAST message is encoded according to a template, which lists the fields of the
+ * message and the operator which compresses each field against the field of the previous
+ * message. The templates are loaded from XML into a hffix::fast::templates, the
+ * hffix::fast::decoder decodes FAST messages into FIX tag-value fields
+ * with a hffix::message_writer, and the hffix::fast::encoder encodes the fields of a
+ * hffix::message_reader into FAST messages.
+ *
+ * Supported are the FAST 1.1 field types `uInt32`, `int32`, `uInt64`, `int64`,
+ * `decimal` and ASCII `string`, the `sequence` element, mandatory and optional
+ * presence, and the `constant`, `default`, `copy`, `increment` and `delta` operators.
+ * All operators share one global dictionary, keyed by the `key` attribute of the operator
+ * or else by the name of the field. The `group`, `templateRef` and `byteVector`
+ * elements, Unicode strings, the `tail` operator and individual operators on the
+ * exponent and mantissa of a decimal are not supported.
+ *
+ * Every field and sequence length in a template must have an `id` attribute, which is
+ * the FIX tag of the field.
+ */
+namespace fast {
+
+class decoder;
+class encoder;
+
+/* @cond EXCLUDE */
+
+namespace details {
+
+class codec;
+
+enum field_type { type_uint32, type_int32, type_uint64, type_int64, type_decimal, type_ascii, type_sequence };
+
+enum field_operator { op_none, op_constant, op_default, op_copy, op_increment, op_delta };
+
+inline void throw_truncated() {
+    throw std::out_of_range("hffix::fast message truncated");
+}
+
+inline void throw_overflow() {
+    throw std::out_of_range("hffix::fast buffer too small");
+}
+
+inline int64_t to_signed(uint64_t x) {
+    return x >> 63 ? -int64_t(~x) - 1 : int64_t(x);
+}
+
+// A value of a field, or an entry in the dictionary.
+struct entry {
+    enum state_type { undefined, assigned, empty };
+    entry() : state(undefined), integer(0), exponent(0) {}
+    state_type state;
+    uint64_t integer; // also the mantissa of a decimal
+    int64_t exponent;
+    std::string string;
+};
+
+// One field of a template. The instructions of the element of a
+// sequence follow the sequence instruction, which is for the length.
+struct instruction {
+    field_type type;
+    field_operator op;
+    bool optional;
+    int tag;
+    size_t slot;         // in the dictionary
+    entry initial;       // assigned if there is an initial value
+    size_t nested;       // sequence: number of instructions in the element
+    size_t element_bits; // sequence: presence map bits of the element
+
+    bool has_bit() const {
+        return op == op_constant ? optional : op == op_default || op == op_copy || op == op_increment;
+    }
+};
+
+// Stop-bit encoded unsigned integer.
+inline char const* read_uint(char const* p, char const* end, uint64_t& value) {
+    uint64_t x = 0;
+    for (;;) {
+        if (p == end) throw_truncated();
+        unsigned char const c = *p++;
+        x = (x << 7) | (c & 0x7f);
+        if (c & 0x80) break;
+    }
+    value = x;
+    return p;
+}
+
+// Stop-bit encoded signed integer, in two's complement.
+inline char const* read_int(char const* p, char const* end, uint64_t& value) {
+    if (p == end) throw_truncated();
+    uint64_t x = (*p & 0x40) ? ~uint64_t(0) : 0;
+    for (;;) {
+        if (p == end) throw_truncated();
+        unsigned char const c = *p++;
+        x = (x << 7) | (c & 0x7f);
+        if (c & 0x80) break;
+    }
+    value = x;
+    return p;
+}
+
+// Write the low n groups of 7 bits of x, with the stop bit on the last.
+inline char* write_groups(uint64_t x, int n, char* p, char* end) {
+    if (end - p < n) throw_overflow();
+    for (int i = n - 1; i >= 0; --i) *p++ = char((x >> (7 * i)) & 0x7f);
+    p[-1] |= char(0x80);
+    return p;
+}
+
+inline char* write_uint(uint64_t x, char* p, char* end) {
+    int n = 1;
+    while (n < 10 && (x >> (7 * n))) ++n;
+    return write_groups(x, n, p, end);
+}
+
+inline char* write_int(uint64_t x, char* p, char* end) {
+    uint64_t const magnitude = x >> 63 ? ~x : x;
+    int n = 1;
+    while (n < 10 && (magnitude >> (7 * n - 1))) ++n;
+    return write_groups(x, n, p, end);
+}
+
+// Stop-bit encoded ASCII string. False if null.
+inline char const* read_ascii(char const* p, char const* end, bool nullable, std::string& s, bool& present) {
+    char const* const b = p;
+    for (;;) {
+        if (p == end) throw_truncated();
+        if (*p++ & 0x80) break;
+    }
+    char const last = char(p[-1] & 0x7f);
+    present = true;
+    if (p - b == 1 && !last) {
+        if (nullable) present = false;
+        s.clear();
+    } else if (nullable && p - b == 2 && !*b && !last) {
+        s.clear();
+    } else {
+        s.assign(b, p - 1);
+        s.push_back(last);
+    }
+    return p;
+}
+
+inline char* write_ascii(char const* b, char const* e, bool nullable, char* p, char* end) {
+    if (b == e) {
+        if (nullable) {
+            if (end - p < 2) throw_overflow();
+            *p++ = 0;
+        }
+        if (p == end) throw_overflow();
+        *p++ = char(0x80);
+        return p;
+    }
+    if (end - p < e - b) throw_overflow();
+    std::memcpy(p, b, e - b);
+    p += e - b;
+    p[-1] |= char(0x80);
+    return p;
+}
+
+inline char* write_null(char* p, char* end) {
+    if (p == end) throw_overflow();
+    *p++ = char(0x80);
+    return p;
+}
+
+// Reads the bits of a presence map. Bits past the end are clear.
+struct presence_map_reader {
+    char const* p;
+    char const* end;
+    unsigned char mask;
+
+    presence_map_reader() : p(0), end(0), mask(0x40) {}
+
+    char const* read(char const* begin, char const* stream_end) {
+        char const* q = begin;
+        for (;;) {
+            if (q == stream_end) throw_truncated();
+            if (*q++ & 0x80) break;
+        }
+        p = begin;
+        end = q;
+        mask = 0x40;
+        return q;
+    }
+
+    bool next() {
+        if (p == end) return false;
+        bool const bit = (*p & mask) != 0;
+        mask >>= 1;
+        if (!mask) {
+            ++p;
+            mask = 0x40;
+        }
+        return bit;
+    }
+};
+
+// Writes a presence map in space reserved before the fields, and then
+// moves the fields down to the end of the presence map.
+struct presence_map_writer {
+    char* begin;
+    char* reserved_end;
+    size_t bits;
+
+    char* reserve(char* p, char* end, size_t max_bits) {
+        size_t const n = max_bits ? (max_bits + 6) / 7 : 1;
+        if (size_t(end - p) < n) throw_overflow();
+        std::memset(p, 0, n);
+        begin = p;
+        reserved_end = p + n;
+        bits = 0;
+        return reserved_end;
+    }
+
+    void push(bool bit) {
+        if (bit) begin[bits / 7] |= char(0x40 >> (bits % 7));
+        ++bits;
+    }
+
+    char* finish(char* fields_end) {
+        char* e = reserved_end;
+        while (e - begin > 1 && !e[-1]) --e;
+        e[-1] |= char(0x80);
+        if (e != reserved_end) std::memmove(e, reserved_end, fields_end - reserved_end);
+        return fields_end - (reserved_end - e);
+    }
+};
+
+} // namespace details
+
+/* @endcond */
+
+/*!
+ * \brief A set of FAST templates.
+ *
+ * Load the templates before constructing a hffix::fast::decoder or hffix::fast::encoder,
+ * and keep them until after the decoder and encoder are destroyed.
+ */
+class templates {
+public:
+    templates() : slot_count_(0) {}
+
+    /*!
+     * \brief Load the templates from a FAST template XML document.
+     *
+     * The document may have a `templates` root element or a single `template`.
+     *
+     * \param begin Pointer to the beginning of the XML text.
+     * \param end Pointer to past-the-end of the XML text.
+     *
+     * \throw std::invalid_argument If the XML is malformed, or uses unsupported FAST elements.
+     */
+    void load(char const* begin, char const* end) {
+        hffix::details::xml_element root;
+        hffix::details::xml_parser("hffix::fast templates", begin, end).document(root);
+        if (root.name == "template") {
+            add_template(root);
+        } else if (root.name == "templates") {
+            for (size_t i = 0; i < root.children.size(); ++i) {
+                if (root.children[i].name != "template") fail("unsupported element " + root.children[i].name);
+                add_template(root.children[i]);
+            }
+        } else {
+            fail("unsupported root element " + root.name);
+        }
+    }
+
+    /*!
+     * \brief Load the templates from a FAST template XML document in a C-style null-terminated string.
+     *
+     * \throw std::invalid_argument If the XML is malformed, or uses unsupported FAST elements.
+     */
+    void load(char const* cstring) {
+        load(cstring, cstring + std::strlen(cstring));
+    }
+
+    /*!
+     * \brief True if there is a template with this id.
+     */
+    bool contains(unsigned id) const {
+        return find(id) != npos;
+    }
+
+private:
+    friend class details::codec;
+    friend class decoder;
+    friend class encoder;
+
+    static size_t const npos = size_t(-1);
+
+    struct template_info {
+        unsigned id;
+        size_t first; // instruction
+        size_t count;
+        size_t bits;  // of the presence map, including the template id
+    };
+
+    std::vector<details::instruction> instructions_;
+    std::vector<template_info> templates_;
+    std::map<std::string, size_t> keys_;
+    size_t slot_count_;
+
+    size_t find(unsigned id) const {
+        for (size_t i = 0; i < templates_.size(); ++i)
+            if (templates_[i].id == id) return i;
+        return npos;
+    }
+
+    static void fail(std::string const& what) {
+        hffix::details::throw_xml_error("hffix::fast templates", what);
+    }
+
+    static char const* required(hffix::details::xml_element const& e, char const* key) {
+        char const* const a = e.attribute(key);
+        if (!a) fail(e.name + " has no " + key + " attribute");
+        return a;
+    }
+
+    void add_template(hffix::details::xml_element const& e) {
+        char const* const id = required(e, "id");
+        template_info t;
+        t.id = hffix::details::atou<unsigned>(id, id + std::strlen(id));
+        if (contains(t.id)) fail(std::string("duplicate template id ") + id);
+        t.first = instructions_.size();
+        t.bits = 1 + add_instructions(e);
+        t.count = instructions_.size() - t.first;
+        templates_.push_back(t);
+    }
+
+    // Append the instructions for the fields which are children of e,
+    // and return the number of presence map bits they need.
+    size_t add_instructions(hffix::details::xml_element const& e) {
+        size_t bits = 0;
+        for (size_t i = 0; i < e.children.size(); ++i) {
+            hffix::details::xml_element const& c = e.children[i];
+            if (c.name == "typeRef" || c.name == "length") continue;
+            if (c.name == "sequence") {
+                hffix::details::xml_element const* length = 0;
+                for (size_t j = 0; j < c.children.size(); ++j)
+                    if (c.children[j].name == "length") length = &c.children[j];
+                if (!length) fail("sequence has no length element");
+                size_t const at = instructions_.size();
+                instructions_.push_back(field(*length, details::type_sequence, is_optional(c)));
+                bits += instructions_[at].has_bit();
+                size_t const element_bits = add_instructions(c);
+                instructions_[at].nested = instructions_.size() - at - 1;
+                instructions_[at].element_bits = element_bits;
+                continue;
+            }
+            details::field_type type;
+            if (c.name == "uInt32") type = details::type_uint32;
+            else if (c.name == "int32") type = details::type_int32;
+            else if (c.name == "uInt64") type = details::type_uint64;
+            else if (c.name == "int64") type = details::type_int64;
+            else if (c.name == "decimal") type = details::type_decimal;
+            else if (c.name == "string") {
+                char const* const charset = c.attribute("charset");
+                if (charset && std::string(charset) != "ascii") fail("unsupported string charset " + std::string(charset));
+                type = details::type_ascii;
+            } else {
+                fail("unsupported element " + c.name);
+                continue;
+            }
+            instructions_.push_back(field(c, type, is_optional(c)));
+            bits += instructions_.back().has_bit();
+        }
+        return bits;
+    }
+
+    static bool is_optional(hffix::details::xml_element const& e) {
+        char const* const presence = e.attribute("presence");
+        return presence && std::string(presence) == "optional";
+    }
+
+    details::instruction field(hffix::details::xml_element const& e, details::field_type type, bool optional) {
+        details::instruction in;
+        in.type = type;
+        in.op = details::op_none;
+        in.optional = optional;
+        char const* const id = required(e, "id");
+        in.tag = hffix::details::atoi<int>(id, id + std::strlen(id));
+        in.nested = 0;
+        in.element_bits = 0;
+        char const* key = e.attribute("name");
+        for (size_t i = 0; i < e.children.size(); ++i) {
+            hffix::details::xml_element const& c = e.children[i];
+            if (in.op != details::op_none) fail(e.name + " has more than one operator");
+            if (c.name == "constant") in.op = details::op_constant;
+            else if (c.name == "default") in.op = details::op_default;
+            else if (c.name == "copy") in.op = details::op_copy;
+            else if (c.name == "increment") in.op = details::op_increment;
+            else if (c.name == "delta") in.op = details::op_delta;
+            else fail("unsupported operator " + c.name + " of " + e.name);
+            if (char const* const value = c.attribute("value")) initial(in, value);
+            if (char const* const k = c.attribute("key")) key = k;
+        }
+        if (in.op == details::op_constant && in.initial.state != details::entry::assigned)
+            fail("constant operator has no value");
+        if (in.op == details::op_increment && (type == details::type_decimal || type == details::type_ascii))
+            fail("increment operator on " + e.name);
+        if (in.op == details::op_copy || in.op == details::op_increment || in.op == details::op_delta) {
+            std::string const k = key ? key : id;
+            std::map<std::string, size_t>::const_iterator const i = keys_.find(k);
+            if (i != keys_.end()) {
+                in.slot = i->second;
+            } else {
+                in.slot = slot_count_++;
+                keys_[k] = in.slot;
+            }
+        } else {
+            in.slot = slot_count_++;
+        }
+        return in;
+    }
+
+    static void initial(details::instruction& in, char const* value) {
+        char const* const end = value + std::strlen(value);
+        switch (in.type) {
+        case details::type_uint32:
+        case details::type_uint64:
+        case details::type_sequence:
+            in.initial.integer = hffix::details::atou<uint64_t>(value, end);
+            break;
+        case details::type_int32:
+        case details::type_int64:
+            in.initial.integer = uint64_t(hffix::details::atoi<int64_t>(value, end));
+            break;
+        case details::type_decimal: {
+            int64_t mantissa, exponent;
+            hffix::details::atod<int64_t>(value, end, mantissa, exponent);
+            in.initial.integer = uint64_t(mantissa);
+            in.initial.exponent = exponent;
+            break;
+        }
+        case details::type_ascii:
+            in.initial.string.assign(value, end);
+            break;
+        }
+        in.initial.state = details::entry::assigned;
+    }
+};
+
+/* @cond EXCLUDE */
+
+namespace details {
+
+// The dictionary and the operator rules, shared by the decoder and encoder.
+class codec {
+protected:
+    explicit codec(templates const& t) : templates_(&t), template_(templates::npos) {}
+
+    templates const* templates_;
+    size_t template_; // the previous template, or npos
+    std::vector<entry> dictionary_;
+
+    void reset_dictionary() {
+        dictionary_.assign(templates_->slot_count_, entry());
+        template_ = templates::npos;
+    }
+
+    void sync_dictionary() {
+        if (dictionary_.size() < templates_->slot_count_) dictionary_.resize(templates_->slot_count_);
+    }
+
+    static void fail(char const* what, int tag) {
+        char digits[16];
+        std::string s("hffix::fast ");
+        s += what;
+        s += " for tag ";
+        s.append(digits, hffix::details::itoa(tag, digits, digits + sizeof(digits)));
+        throw std::runtime_error(s);
+    }
+
+    // The exponent of a FAST decimal is in [-63, 63].
+    static void check_exponent(int64_t exponent, int tag) {
+        if (exponent < -63 || exponent > 63) fail("decimal exponent out of range", tag);
+    }
+
+    static void assign(instruction const& in, entry& d, entry const& v) {
+        d.state = entry::assigned;
+        d.integer = v.integer;
+        d.exponent = v.exponent;
+        if (in.type == type_ascii) d.string = v.string;
+    }
+
+    // The value which a copy or increment operator has when its presence map bit is clear,
+    // or null. Assigns the initial value to an undefined dictionary entry.
+    static entry const* implicit(instruction const& in, entry& d) {
+        switch (d.state) {
+        case entry::assigned:
+            if (in.op == op_increment) ++d.integer;
+            return &d;
+        case entry::undefined:
+            if (in.initial.state == entry::assigned) {
+                assign(in, d, in.initial);
+                return &d;
+            }
+            if (!in.optional) fail("mandatory field has no previous value", in.tag);
+            d.state = entry::empty;
+            return 0;
+        default:
+            if (!in.optional) fail("mandatory field has no previous value", in.tag);
+            return 0;
+        }
+    }
+
+    // Prepare the dictionary entry to be the base of a delta.
+    static void delta_base(instruction const& in, entry& d) {
+        if (d.state == entry::undefined) {
+            if (in.initial.state == entry::assigned) {
+                assign(in, d, in.initial);
+            } else {
+                d.state = entry::assigned;
+                d.integer = 0;
+                d.exponent = 0;
+                d.string.clear();
+            }
+        } else if (d.state == entry::empty) {
+            fail("delta has no base value", in.tag);
+        }
+    }
+};
+
+} // namespace details
+
+/* @endcond */
+
+/*!
+ * \brief Decodes FAST messages into FIX tag-value fields.
+ *
+ * <h3>Usage</h3>
+ *
+ * \code
+ * hffix::fast::templates t;
+ * t.load(xml_begin, xml_end);
+ * hffix::fast::decoder d(t);
+ *
+ * // Each UDP packet begins with a new dictionary.
+ * d.reset();
+ * for (char const* p = packet_begin; p < packet_end;) {
+ *     hffix::message_writer w(buffer, buffer_end);
+ *     w.push_back_header("FIX.5.0SP2");
+ *     p = d.decode(p, packet_end, w);
+ *     w.push_back_trailer();
+ *     // hffix::message_reader r(buffer, w.message_end());
+ * }
+ * \endcode
+ *
+ * The decoder writes the fields of the template in order, and a field for the length
+ * of each sequence before the fields of its elements, like a FIX repeating group. The
+ * _MsgType_ is usually a constant field of the template.
+ *
+ * FAST messages are not self-delimiting, so the FAST message must be complete.
+ * The decoder updates the dictionary as it decodes, so after an exception the
+ * dictionary must be reset().
+ */
+class decoder : private details::codec {
+public:
+    /*!
+     * \brief Construct a decoder with an empty dictionary.
+     */
+    explicit decoder(templates const& t) : details::codec(t) {
+        reset_dictionary();
+    }
+
+    /*!
+     * \brief Reset the dictionary, as at the beginning of a packet or stream.
+     */
+    void reset() {
+        reset_dictionary();
+    }
+
+    /*!
+     * \brief Decode a FAST message, and write its fields.
+     *
+     * \param begin Pointer to the beginning of the FAST message.
+     * \param end Pointer to past-the-end of the stream.
+     * \param writer The fields of the message are written with this writer.
+     * \return Pointer to past-the-end of the FAST message.
+     *
+     * \throw std::out_of_range If the FAST message is truncated, or the writer's buffer is too small.
+     * \throw std::runtime_error If the FAST message has an unknown template id, or its operators cannot be applied.
+     */
+    char const* decode(char const* begin, char const* end, message_writer& writer) {
+        sync_dictionary();
+        details::presence_map_reader pm;
+        char const* p = pm.read(begin, end);
+        if (pm.next()) {
+            uint64_t id;
+            p = details::read_uint(p, end, id);
+            template_ = templates_->find(unsigned(id));
+            if (template_ == templates::npos) fail("unknown template id", int(id));
+        } else if (template_ == templates::npos) {
+            fail("no template id", 0);
+        }
+        templates::template_info const& t = templates_->templates_[template_];
+        return decode_range(&templates_->instructions_[t.first], t.count, pm, p, end, writer);
+    }
+
+    /*!
+     * \brief The template id of the last message decoded.
+     */
+    unsigned template_id() const {
+        return template_ != templates::npos ? templates_->templates_[template_].id : 0;
+    }
+
+private:
+    std::string scratch_;
+
+    char const* decode_range(details::instruction const* in, size_t count, details::presence_map_reader& pm, char const* p, char const* end, message_writer& w) {
+        details::instruction const* const last = in + count;
+        while (in != last) {
+            details::entry const* const v = decode_field(*in, dictionary_[in->slot], pm, p, end);
+            if (in->type != details::type_sequence) {
+                if (v) write_field(*in, *v, w);
+                ++in;
+                continue;
+            }
+            uint64_t const n = v ? v->integer : 0;
+            if (v) w.push_back_int(in->tag, n);
+            for (uint64_t k = 0; k < n; ++k) {
+                details::presence_map_reader element_pm;
+                if (in->element_bits) p = element_pm.read(p, end);
+                p = decode_range(in + 1, in->nested, element_pm, p, end, w);
+            }
+            in += 1 + in->nested;
+        }
+        return p;
+    }
+
+    // Decode a field. Returns its value, or null if the field is absent.
+    details::entry const* decode_field(details::instruction const& in, details::entry& d, details::presence_map_reader& pm, char const*& p, char const* end) {
+        switch (in.op) {
+        case details::op_none:
+            return read_value(in, p, end, d) ? &d : 0;
+        case details::op_constant:
+            return !in.optional || pm.next() ? &in.initial : 0;
+        case details::op_default:
+            if (pm.next()) return read_value(in, p, end, d) ? &d : 0;
+            return in.initial.state == details::entry::assigned ? &in.initial : 0;
+        case details::op_copy:
+        case details::op_increment:
+            if (!pm.next()) return implicit(in, d);
+            if (read_value(in, p, end, d)) {
+                d.state = details::entry::assigned;
+                return &d;
+            }
+            d.state = details::entry::empty;
+            return 0;
+        case details::op_delta:
+            return read_delta(in, p, end, d) ? &d : 0;
+        }
+        return 0;
+    }
+
+    // Read a nullable unsigned integer. False if null.
+    static bool nullable_uint(bool optional, uint64_t& x) {
+        if (!optional) return true;
+        if (!x) return false;
+        --x;
+        return true;
+    }
+
+    // Read a nullable signed integer. False if null.
+    static bool nullable_int(bool optional, uint64_t& x) {
+        if (!optional) return true;
+        if (!x) return false;
+        if (details::to_signed(x) > 0) --x;
+        return true;
+    }
+
+    bool read_value(details::instruction const& in, char const*& p, char const* end, details::entry& v) {
+        switch (in.type) {
+        case details::type_uint32:
+        case details::type_uint64:
+        case details::type_sequence:
+            p = details::read_uint(p, end, v.integer);
+            return nullable_uint(in.optional, v.integer);
+        case details::type_int32:
+        case details::type_int64:
+            p = details::read_int(p, end, v.integer);
+            return nullable_int(in.optional, v.integer);
+        case details::type_decimal: {
+            uint64_t exponent;
+            p = details::read_int(p, end, exponent);
+            if (!nullable_int(in.optional, exponent)) return false;
+            v.exponent = details::to_signed(exponent);
+            check_exponent(v.exponent, in.tag);
+            p = details::read_int(p, end, v.integer);
+            return true;
+        }
+        case details::type_ascii: {
+            bool present;
+            p = details::read_ascii(p, end, in.optional, v.string, present);
+            return present;
+        }
+        }
+        return false;
+    }
+
+    bool read_delta(details::instruction const& in, char const*& p, char const* end, details::entry& d) {
+        uint64_t x;
+        p = details::read_int(p, end, x);
+        if (!nullable_int(in.optional, x)) return false;
+        delta_base(in, d);
+        switch (in.type) {
+        case details::type_decimal: {
+            uint64_t mantissa;
+            p = details::read_int(p, end, mantissa);
+            int64_t const exponent = details::to_signed(x);
+            if (exponent < -126 || exponent > 126) fail("decimal exponent out of range", in.tag);
+            d.exponent += exponent;
+            check_exponent(d.exponent, in.tag);
+            d.integer += mantissa;
+            break;
+        }
+        case details::type_ascii: {
+            bool present;
+            p = details::read_ascii(p, end, false, scratch_, present);
+            int64_t const length = details::to_signed(x);
+            if (length < 0) {
+                uint64_t const n = uint64_t(-(length + 1));
+                if (n > d.string.size()) fail("delta subtraction length too long", in.tag);
+                d.string.replace(0, size_t(n), scratch_);
+            } else {
+                uint64_t const n = uint64_t(length);
+                if (n > d.string.size()) fail("delta subtraction length too long", in.tag);
+                d.string.replace(d.string.size() - size_t(n), size_t(n), scratch_);
+            }
+            break;
+        }
+        default:
+            d.integer += x;
+            break;
+        }
+        return true;
+    }
+
+    static void write_field(details::instruction const& in, details::entry const& v, message_writer& w) {
+        switch (in.type) {
+        case details::type_uint32:
+        case details::type_uint64:
+        case details::type_sequence:
+            w.push_back_int(in.tag, v.integer);
+            break;
+        case details::type_int32:
+        case details::type_int64:
+            w.push_back_int(in.tag, details::to_signed(v.integer));
+            break;
+        case details::type_decimal: {
+            int64_t mantissa = details::to_signed(v.integer);
+            int64_t exponent = v.exponent;
+            check_exponent(exponent, in.tag);
+            for (; exponent > 0; --exponent) {
+                if (mantissa > std::numeric_limits<int64_t>::max() / 10 || mantissa < std::numeric_limits<int64_t>::min() / 10)
+                    fail("decimal out of range", in.tag);
+                mantissa *= 10;
+            }
+            w.push_back_decimal(in.tag, mantissa, exponent);
+            break;
+        }
+        case details::type_ascii:
+            w.push_back_string(in.tag, v.string.data(), v.string.data() + v.string.size());
+            break;
+        }
+    }
+};
+
+/*!
+ * \brief Encodes the fields of FIX tag-value messages into FAST messages.
+ *
+ * <h3>Usage</h3>
+ *
+ * \code
+ * hffix::fast::encoder e(t);
+ * e.reset();
+ * char* p = packet_begin;
+ * for (; reader.is_complete(); reader = reader.next_message_reader()) {
+ *     if (reader.is_valid()) p = e.encode(template_id, reader, p, packet_end);
+ * }
+ * \endcode
+ *
+ * For each field of the template, the encoder takes the first field with the same tag
+ * after the field it took before, wrapping around to the beginning of the message if
+ * there is none. The elements of a sequence are the fields following the sequence length,
+ * where each element begins with the tag of the first field of the element template.
+ */
+class encoder : private details::codec {
+public:
+    /*!
+     * \brief Construct an encoder with an empty dictionary.
+     */
+    explicit encoder(templates const& t) : details::codec(t) {
+        reset_dictionary();
+    }
+
+    /*!
+     * \brief Reset the dictionary, as at the beginning of a packet or stream.
+     */
+    void reset() {
+        reset_dictionary();
+    }
+
+    /*!
+     * \brief Encode the fields of a FIX message as a FAST message.
+     *
+     * \param template_id Id of the template to encode with.
+     * \param reader The FIX message.
+     * \param begin Pointer to the buffer for the FAST message.
+     * \param end Pointer to past-the-end of the buffer.
+     * \return Pointer to past-the-end of the FAST message.
+     *
+     * \throw std::out_of_range If the buffer is too small.
+     * \throw std::runtime_error If the template id is unknown, or the message has no field for a mandatory field of the template.
+     */
+    char* encode(unsigned template_id, message_reader const& reader, char* begin, char* end) {
+        sync_dictionary();
+        size_t const t = templates_->find(template_id);
+        if (t == templates::npos) fail("unknown template id", int(template_id));
+        templates::template_info const& info = templates_->templates_[t];
+        details::presence_map_writer pm;
+        char* p = pm.reserve(begin, end, info.bits);
+        pm.push(t != template_);
+        if (t != template_) {
+            p = details::write_uint(template_id, p, end);
+            template_ = t;
+        }
+        message_reader::const_iterator hint = reader.begin();
+        p = encode_range(&templates_->instructions_[info.first], info.count, pm, reader.begin(), reader.end(), hint, p, end);
+        return pm.finish(p);
+    }
+
+private:
+    details::entry value_;
+
+    static message_reader::const_iterator find(int tag, message_reader::const_iterator from, message_reader::const_iterator end) {
+        for (; from != end; ++from)
+            if (from->tag() == tag) break;
+        return from;
+    }
+
+    char* encode_range(
+        details::instruction const* in,
+        size_t count,
+        details::presence_map_writer& pm,
+        message_reader::const_iterator lo,
+        message_reader::const_iterator hi,
+        message_reader::const_iterator& hint,
+        char* p,
+        char* end
+    ) {
+        details::instruction const* const last = in + count;
+        while (in != last) {
+            message_reader::const_iterator f = find(in->tag, hint, hi);
+            if (f == hi) {
+                f = find(in->tag, lo, hint);
+                if (f == hint) f = hi;
+            }
+            details::entry const* v = 0;
+            if (f != hi) {
+                parse(*in, f->value(), value_);
+                v = &value_;
+                hint = f;
+                ++hint;
+            }
+            uint64_t const n = v ? v->integer : 0;
+            p = encode_field(*in, dictionary_[in->slot], v, pm, p, end);
+            if (in->type != details::type_sequence) {
+                ++in;
+                continue;
+            }
+            message_reader::const_iterator element = hint;
+            for (uint64_t k = 0; k < n; ++k) {
+                if (element == hi) fail("fewer repeating group elements than the length", in->tag);
+                message_reader::const_iterator next = hi;
+                if (in->nested) {
+                    next = element;
+                    next = find(in[1].tag, ++next, hi);
+                }
+                details::presence_map_writer element_pm;
+                if (in->element_bits) p = element_pm.reserve(p, end, in->element_bits);
+                message_reader::const_iterator element_hint = element;
+                p = encode_range(in + 1, in->nested, element_pm, element, next, element_hint, p, end);
+                if (in->element_bits) p = element_pm.finish(p);
+                element = next;
+            }
+            hint = element;
+            in += 1 + in->nested;
+        }
+        return p;
+    }
+
+    static void parse(details::instruction const& in, field_value const& f, details::entry& v) {
+        switch (in.type) {
+        case details::type_uint32:
+        case details::type_uint64:
+        case details::type_sequence:
+            v.integer = f.as_int<uint64_t>();
+            break;
+        case details::type_int32:
+        case details::type_int64:
+            v.integer = uint64_t(f.as_int<int64_t>());
+            break;
+        case details::type_decimal: {
+            int64_t mantissa, exponent;
+            f.as_decimal(mantissa, exponent);
+            check_exponent(exponent, in.tag);
+            v.integer = uint64_t(mantissa);
+            v.exponent = exponent;
+            break;
+        }
+        case details::type_ascii:
+            v.string.assign(f.begin(), f.end());
+            break;
+        }
+    }
+
+    static bool equal(details::instruction const& in, details::entry const& a, details::entry const& b) {
+        switch (in.type) {
+        case details::type_decimal:
+            return a.integer == b.integer && a.exponent == b.exponent;
+        case details::type_ascii:
+            return a.string == b.string;
+        default:
+            return a.integer == b.integer;
+        }
+    }
+
+    char* encode_field(details::instruction const& in, details::entry& d, details::entry const* v, details::presence_map_writer& pm, char* p, char* end) {
+        if (!v && !in.optional && in.op != details::op_constant) fail("message has no field", in.tag);
+        switch (in.op) {
+        case details::op_none:
+            return v ? write_value(in, *v, p, end) : details::write_null(p, end);
+        case details::op_constant:
+            if (in.optional) pm.push(v != 0);
+            return p;
+        case details::op_default:
+            if (v ? in.initial.state == details::entry::assigned && equal(in, *v, in.initial) : in.initial.state != details::entry::assigned) {
+                pm.push(false);
+                return p;
+            }
+            pm.push(true);
+            return v ? write_value(in, *v, p, end) : details::write_null(p, end);
+        case details::op_copy:
+        case details::op_increment: {
+            // What the decoder would have with the bit clear.
+            bool implicit_matches;
+            if (d.state == details::entry::assigned) {
+                implicit_matches = v && (in.op == details::op_increment ? v->integer == d.integer + 1 : equal(in, *v, d));
+            } else if (d.state == details::entry::undefined && in.initial.state == details::entry::assigned) {
+                implicit_matches = v && equal(in, *v, in.initial);
+            } else {
+                implicit_matches = !v;
+            }
+            pm.push(!implicit_matches);
+            if (implicit_matches && d.state == details::entry::assigned) {
+                d.integer = v->integer;
+                return p;
+            }
+            if (v) assign(in, d, *v);
+            else d.state = details::entry::empty;
+            if (implicit_matches) return p;
+            return v ? write_value(in, *v, p, end) : details::write_null(p, end);
+        }
+        case details::op_delta:
+            if (!v) return details::write_null(p, end);
+            delta_base(in, d);
+            p = write_delta(in, d, *v, p, end);
+            assign(in, d, *v);
+            return p;
+        }
+        return p;
+    }
+
+    static uint64_t nullable_uint(bool optional, uint64_t x) {
+        return optional ? x + 1 : x;
+    }
+
+    static uint64_t nullable_int(bool optional, uint64_t x) {
+        return optional && details::to_signed(x) >= 0 ? x + 1 : x;
+    }
+
+    static char* write_value(details::instruction const& in, details::entry const& v, char* p, char* end) {
+        switch (in.type) {
+        case details::type_uint32:
+        case details::type_uint64:
+        case details::type_sequence:
+            return details::write_uint(nullable_uint(in.optional, v.integer), p, end);
+        case details::type_int32:
+        case details::type_int64:
+            return details::write_int(nullable_int(in.optional, v.integer), p, end);
+        case details::type_decimal:
+            p = details::write_int(nullable_int(in.optional, uint64_t(v.exponent)), p, end);
+            return details::write_int(v.integer, p, end);
+        case details::type_ascii:
+            return details::write_ascii(v.string.data(), v.string.data() + v.string.size(), in.optional, p, end);
+        }
+        return p;
+    }
+
+    static char* write_delta(details::instruction const& in, details::entry const& base, details::entry const& v, char* p, char* end) {
+        switch (in.type) {
+        case details::type_decimal:
+            p = details::write_int(nullable_int(in.optional, uint64_t(v.exponent - base.exponent)), p, end);
+            return details::write_int(v.integer - base.integer, p, end);
+        case details::type_ascii: {
+            std::string const& a = base.string;
+            std::string const& b = v.string;
+            size_t prefix = 0;
+            while (prefix < a.size() && prefix < b.size() && a[prefix] == b[prefix]) ++prefix;
+            size_t suffix = 0;
+            while (suffix < a.size() && suffix < b.size() && a[a.size() - 1 - suffix] == b[b.size() - 1 - suffix]) ++suffix;
+            if (prefix >= suffix) {
+                p = details::write_int(nullable_int(in.optional, uint64_t(a.size() - prefix)), p, end);
+                return details::write_ascii(b.data() + prefix, b.data() + b.size(), false, p, end);
+            }
+            p = details::write_int(uint64_t(-int64_t(a.size() - suffix) - 1), p, end);
+            return details::write_ascii(b.data(), b.data() + b.size() - suffix, false, p, end);
+        }
+        default:
+            return details::write_int(nullable_int(in.optional, v.integer - base.integer), p, end);
+        }
+    }
+};
+
+} // namespace fast
+} // namespace hffix
+
+#endif // HFFIX_FAST_HPP
@@ -0,0 +1,262 @@
+/*******************************************************************************************
+Copyright 2011, T3 IP, LLC. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are
+permitted provided that the following conditions are met:
+
+   1. Redistributions of source code must retain the above copyright notice, this list of
+      conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright notice, this list
+      of conditions and the following disclaimer in the documentation and/or other materials
+      provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY T3 IP, LLC ``AS IS'' AND ANY EXPRESS OR IMPLIED
+WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL T3 IP, LLC OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those of the
+authors and should not be interpreted as representing official policies, either expressed
+or implied, of T3 IP, LLC.
+*******************************************************************************************/
+
+/*!
+ * \file
+ * \brief Scatter-gather writing of FIX messages with large field values referenced in place, for `writev()` or `sendmsg()`.
+ *
+ * Requires hffix.hpp and POSIX.
+ */
+
+#ifndef HFFIX_GATHER_HPP
+#define HFFIX_GATHER_HPP
+
+#include "hffix.hpp"
+#include <cstddef>   // for size_t
+#include <stdexcept> // for exceptions
+#include <sys/uio.h> // for iovec
+
+namespace hffix {
+
+/*!
+ * \brief One FIX message for writing, with large field values referenced in place instead of copied.
+ *
+ * <h3>Usage</h3>
+ *
+ * The small fields are written into a buffer by an hffix::message_writer, which
+ * is available from writer(). String and data fields with values of at least
+ * `copy_threshold` bytes are not copied into the buffer. They are referenced by an
+ * `iovec` instead. After push_back_trailer(), the `iovec` array from iov_begin() to
+ * iov_end() covers the whole message, in order: parts of the buffer and the
+ * referenced values. It can be sent with one `writev()` or `sendmsg()`.
+ *
+ * \code
+ * char buffer[1 << 12];
+ * iovec iov[8];
+ * hffix::gather_writer g(buffer, buffer + sizeof(buffer), iov, iov + 8);
+ * g.push_back_header("FIX.4.4");
+ * g.writer().push_back_string(hffix::tag::MsgType, "AS");
+ * // ...
+ * g.push_back_data(hffix::tag::SecurityXMLLen, hffix::tag::SecurityXML, xml.data(), xml.data() + xml.size());
+ * g.push_back_trailer();
+ * writev(fd, g.iov_begin(), int(g.iov_end() - g.iov_begin()));
+ * \endcode
+ *
+ * The referenced values must stay unchanged until the message is sent.
+ *
+ * Each referenced value takes two `iovec`, and the end of the message takes one more.
+ * When there are no `iovec` left, values are copied into the buffer instead.
+ *
+ * Don't call the message_writer::push_back_header() or message_writer::push_back_trailer()
+ * methods of writer(). The gather_writer writes the _BeginString_, _BodyLength_ and _CheckSum_
+ * fields itself, so that they count the referenced values too.
+ */
+class gather_writer {
+public:
+
+    /*!
+     * \brief Construct with a buffer for the small fields and an array for the `iovec` list.
+     *
+     * \param begin Pointer to the buffer for the small fields.
+     * \param end Pointer to past-the-end of the buffer.
+     * \param iov_begin Pointer to the array of `iovec`.
+     * \param iov_end Pointer to past-the-end of the array of `iovec`. The array must have room for at least one.
+     * \param copy_threshold String and data values shorter than this are copied into the buffer.
+     *
+     * \throw std::logic_error If the array of `iovec` is empty.
+     */
+    gather_writer(char* begin, char* end, ::iovec* iov_begin, ::iovec* iov_end, size_t copy_threshold = 256) :
+        writer_(begin, end),
+        iov_begin_(iov_begin),
+        iov_end_(iov_end),
+        iov_next_(iov_begin),
+        segment_(begin),
+        body_(NULL),
+        copy_threshold_(copy_threshold) {
+        if (iov_begin >= iov_end) throw std::logic_error("hffix gather_writer needs at least one iovec");
+    }
+
+    /*!
+     * \brief The message_writer for the small fields.
+     *
+     * \pre push_back_header() has been called.
+     */
+    message_writer& writer() {
+        return writer_;
+    }
+
+    /*!
+     * \brief Write the _BeginString_ and _BodyLength_ fields to the buffer.
+     *
+     * \param begin_string_version The value for the BeginString FIX field.
+     *
+     * \throw std::out_of_range When the remaining buffer size is too small.
+     * \throw std::logic_error When called more than once for a single message.
+     */
+    void push_back_header(char const* begin_string_version) {
+        if (body_) throw std::logic_error("hffix gather_writer.push_back_header called twice");
+        writer_.push_back_string(tag::BeginString, begin_string_version);
+        writer_.push_back_string(tag::BodyLength, "000000"); // 6 characters reserved for BodyLength, like message_writer.
+        body_ = writer_.message_end();
+    }
+
+    /*!
+     * \brief Append a string field to the message, referencing the value in place if it is large.
+     *
+     * \param tag FIX tag.
+     * \param begin Pointer to the beginning of the string.
+     * \param end Pointer to past-the-end of the string.
+     *
+     * \throw std::out_of_range When the remaining buffer size is too small.
+     */
+    void push_back_string(int tag, char const* begin, char const* end) {
+        if (size_t(end - begin) < copy_threshold_ || iov_end_ - iov_next_ < 3) {
+            writer_.push_back_string(tag, begin, end);
+        } else {
+            push_back_reference(tag, begin, end);
+        }
+    }
+
+    /*!
+     * \brief Append a data length field and a data field to the message, referencing the data in place if it is large.
+     *
+     * \param tag_data_length FIX tag for the data length field.
+     * \param tag_data FIX tag for the data field.
+     * \param begin Pointer to the beginning of the data.
+     * \param end Pointer to after-the-end of the data.
+     *
+     * \throw std::out_of_range When the remaining buffer size is too small.
+     */
+    void push_back_data(int tag_data_length, int tag_data, char const* begin, char const* end) {
+        if (size_t(end - begin) < copy_threshold_ || iov_end_ - iov_next_ < 3) {
+            writer_.push_back_data(tag_data_length, tag_data, begin, end);
+        } else {
+            writer_.push_back_int(tag_data_length, end - begin);
+            push_back_reference(tag_data, begin, end);
+        }
+    }
+
+    /*!
+     * \brief Write the _BodyLength_ and _CheckSum_ fields, and finish the `iovec` list.
+     *
+     * \param calculate_checksum If false, write CheckSum=000 instead of reading the whole message, including the referenced values.
+     *
+     * \throw std::out_of_range When the remaining buffer size is too small.
+     * \throw std::logic_error When called before push_back_header()
+     */
+    void push_back_trailer(bool calculate_checksum = true) {
+        if (!body_) throw std::logic_error("hffix gather_writer.push_back_trailer called before gather_writer.push_back_header");
+
+        size_t len = writer_.message_end() - body_;
+        for (::iovec const* i = iov_begin_ + 1; i < iov_next_; i += 2) len += i->iov_len;
+        if (len > 999999) throw std::out_of_range("hffix gather_writer BodyLength too big");
+        char* b = body_ - 1;
+        for (int k = 0; k < 6; ++k, len /= 10) *--b = char('0' + len % 10);
+
+        unsigned char checksum = 0;
+        if (calculate_checksum) {
+            for (::iovec const* i = iov_begin_; i < iov_next_; ++i) {
+                checksum = sum(checksum, static_cast<char const*>(i->iov_base), i->iov_len);
+            }
+            checksum = sum(checksum, segment_, writer_.message_end() - segment_);
+        }
+        char value[3] = { char('0' + checksum / 100), char('0' + checksum / 10 % 10), char('0' + checksum % 10) };
+        writer_.push_back_string(tag::CheckSum, value, value + 3);
+
+        push_back_iov(segment_, writer_.message_end() - segment_);
+        segment_ = writer_.message_end();
+    }
+
+    /*! \name Message Access */
+    //@{
+
+    /*!
+     * \brief Pointer to the first `iovec` of the message.
+     *
+     * \pre push_back_trailer() has been called.
+     */
+    ::iovec* iov_begin() const {
+        return iov_begin_;
+    }
+
+    /*!
+     * \brief Pointer to past-the-end of the last `iovec` of the message.
+     *
+     * \pre push_back_trailer() has been called.
+     */
+    ::iovec* iov_end() const {
+        return iov_next_;
+    }
+
+    /*!
+     * \brief Total size of the message in bytes, across all `iovec`.
+     *
+     * \pre push_back_trailer() has been called.
+     */
+    size_t message_size() const {
+        size_t size = 0;
+        for (::iovec const* i = iov_begin_; i < iov_next_; ++i) size += i->iov_len;
+        return size;
+    }
+
+    //@}
+
+private:
+    // Write "tag=" and the SOH into the buffer, and cut the buffer between
+    // them for the referenced value.
+    void push_back_reference(int tag, char const* begin, char const* end) {
+        writer_.push_back_string(tag, begin, begin);
+        char* const cut = writer_.message_end() - 1;
+        push_back_iov(segment_, cut - segment_);
+        push_back_iov(const_cast<char*>(begin), end - begin);
+        segment_ = cut;
+    }
+
+    void push_back_iov(char* base, size_t len) {
+        iov_next_->iov_base = base;
+        iov_next_->iov_len = len;
+        ++iov_next_;
+    }
+
+    static unsigned char sum(unsigned char checksum, char const* b, size_t n) {
+        for (char const* e = b + n; b < e; ++b) checksum += static_cast<unsigned char>(*b);
+        return checksum;
+    }
+
+    message_writer writer_;
+    ::iovec* iov_begin_;
+    ::iovec* iov_end_;
+    ::iovec* iov_next_;
+    char* segment_; // Beginning of the part of the buffer which isn't covered by an iovec yet.
+    char* body_;    // Past-the-end of the BodyLength field.
+    size_t copy_threshold_;
+};
+
+} // namespace hffix
+
+#endif // HFFIX_GATHER_HPP
@@ -0,0 +1,331 @@
+/*******************************************************************************************
+Copyright 2011, T3 IP, LLC. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are
+permitted provided that the following conditions are met:
+
+   1. Redistributions of source code must retain the above copyright notice, this list of
+      conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright notice, this list
+      of conditions and the following disclaimer in the documentation and/or other materials
+      provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY T3 IP, LLC ``AS IS'' AND ANY EXPRESS OR IMPLIED
+WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL T3 IP, LLC OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those of the
+authors and should not be interpreted as representing official policies, either expressed
+or implied, of T3 IP, LLC.
+*******************************************************************************************/
+
+/*!
+ * \file
+ * \brief Latency instrumentation for the stages of parsing and serializing, with HDR-style histograms.
+ *
+ * Define `HFFIX_INSTRUMENT` before including hffix.hpp to compile the
+ * instrumentation points into the library. Without `HFFIX_INSTRUMENT` the
+ * instrumentation points compile to nothing, and this header is only needed
+ * for its histogram and time stamp counter.
+ */
+
+#ifndef HFFIX_INSTRUMENT_HPP
+#define HFFIX_INSTRUMENT_HPP
+
+#include "hffix_fields.hpp" // for msg_type_index
+#include <cstddef>          // for size_t
+#include <ostream>
+#include <stdint.h>         // for uint64_t
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>      // for __rdtsc
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>         // for __rdtsc
+#elif __cplusplus >= 201103L
+#include <chrono>
+#else
+#include <ctime>
+#endif
+
+namespace hffix {
+
+/*!
+ * \brief Latency instrumentation.
+ */
+namespace instrument {
+
+/*!
+ * \brief Read the time stamp counter.
+ *
+ * On x86 this is `rdtsc`, on AArch64 the virtual counter `cntvct_el0`. On other
+ * platforms it falls back to `std::chrono::steady_clock` nanoseconds, or to
+ * `std::clock()` before C++11. The units are cycles of the counter, which
+ * are not necessarily CPU cycles or nanoseconds.
+ */
+inline uint64_t tsc() {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t t;
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(t));
+    return t;
+#elif __cplusplus >= 201103L
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#else
+    return std::clock();
+#endif
+}
+
+/*!
+ * \brief Histogram of latencies with bounded relative error, in the style of HdrHistogram.
+ *
+ * Values below 128 are counted exactly. Above 128, each power of two is divided
+ * into 64 buckets, so the relative error of any reported value is less than
+ * 1/64, about 1.6%. Values up to 2<sup>41</sup> are distinguished, and larger
+ * values are counted in the top bucket. Recording a value is a few instructions
+ * with no branches on the data except one comparison.
+ *
+ * The histogram is a fixed-size array of 2304 counters. No memory is allocated.
+ */
+class latency_histogram {
+public:
+
+    /*! \brief Construct an empty histogram. */
+    latency_histogram() {
+        reset();
+    }
+
+    /*! \brief Record one value. */
+    void record(uint64_t value) {
+        ++counts_[bucket(value)];
+        ++count_;
+        if (value < min_) min_ = value;
+        if (value > max_) max_ = value;
+        sum_ += value;
+    }
+
+    /*! \brief Remove all values. */
+    void reset() {
+        for (size_t i = 0; i < buckets; ++i) counts_[i] = 0;
+        count_ = 0;
+        min_ = ~uint64_t(0);
+        max_ = 0;
+        sum_ = 0;
+    }
+
+    /*! \brief Number of values recorded. */
+    uint64_t count() const {
+        return count_;
+    }
+
+    /*! \brief Smallest value recorded, or 0 if none. */
+    uint64_t min() const {
+        return count_ ? min_ : 0;
+    }
+
+    /*! \brief Largest value recorded, or 0 if none. */
+    uint64_t max() const {
+        return max_;
+    }
+
+    /*! \brief Mean of the values recorded, or 0 if none. */
+    double mean() const {
+        return count_ ? double(sum_) / double(count_) : 0.0;
+    }
+
+    /*!
+     * \brief The value at a percentile.
+     *
+     * \param percentile From 0 to 100, for example 99.9.
+     * \return The highest value in the bucket of the value at the percentile, but not more than max(). 0 if the histogram is empty.
+     */
+    uint64_t value_at_percentile(double percentile) const {
+        if (!count_) return 0;
+        uint64_t rank = uint64_t(percentile / 100.0 * double(count_) + 0.5);
+        if (rank < 1) rank = 1;
+        if (rank > count_) rank = count_;
+        uint64_t seen = 0;
+        for (size_t i = 0; i < buckets; ++i) {
+            seen += counts_[i];
+            if (seen >= rank) {
+                if (i == buckets - 1) return max_; // The top bucket is unbounded.
+                uint64_t const high = bucket_high(i);
+                return high < max_ ? high : max_;
+            }
+        }
+        return max_;
+    }
+
+private:
+    enum {
+        linear = 128,   // Values below this are counted exactly.
+        sub_bits = 6,   // Each power of two above linear has 2^sub_bits buckets.
+        top_bit = 40,   // Most significant bit of the largest distinguished value.
+        buckets = linear + (top_bit - 6) * (1 << sub_bits)
+    };
+
+    static int msb(uint64_t v) {
+#if defined(__GNUC__)
+        return 63 - __builtin_clzll(v);
+#else
+        int m = 0;
+        while (v >>= 1) ++m;
+        return m;
+#endif
+    }
+
+    static size_t bucket(uint64_t v) {
+        if (v < linear) return size_t(v);
+        int m = msb(v);
+        if (m > top_bit) {
+            m = top_bit;
+            v = ~uint64_t(0);
+        }
+        return linear + (m - 7) * (1 << sub_bits) + size_t((v >> (m - sub_bits)) & ((1 << sub_bits) - 1));
+    }
+
+    static uint64_t bucket_high(size_t i) {
+        if (i < linear) return i;
+        size_t const k = i - linear;
+        int const shift = int(k >> sub_bits) + 7 - sub_bits;
+        uint64_t const sub = (1 << sub_bits) + (k & ((1 << sub_bits) - 1));
+        return ((sub + 1) << shift) - 1;
+    }
+
+    uint64_t counts_[buckets];
+    uint64_t count_;
+    uint64_t min_;
+    uint64_t max_;
+    uint64_t sum_;
+};
+
+/*!
+ * \brief Instrumented stages of the library.
+ */
+namespace stage {
+enum type {
+    framing,     //!< hffix::message_reader construction: find the message boundaries and check the framing.
+    validation,  //!< Message validation.
+    checksum,    //!< hffix::message_reader::calculate_check_sum().
+    index_build, //!< Building the field index of a hffix::message_snapshot.
+    dispatch,    //!< hffix::message_dispatcher and hffix::dispatch_message(), including the handler. Also recorded per MsgType.
+    trailer,     //!< hffix::message_writer::push_back_trailer(): BodyLength and CheckSum.
+    end_to_end,  //!< Not recorded by the library. For the caller, for example from socket read to the end of the strategy callback.
+    count        //!< Number of stages.
+};
+}
+
+/*! \brief Name of a stage. */
+inline char const* stage_name(stage::type s) {
+    static char const* const names[stage::count] = {
+        "framing", "validation", "checksum", "index_build", "dispatch", "trailer", "end_to_end"
+    };
+    return s < stage::count ? names[s] : "";
+}
+
+/*!
+ * \brief The latency histograms of all the stages, and of the dispatch stage for each message type.
+ *
+ * There is one set of histograms for the process. It is not thread-safe, so
+ * record from one thread, or read it only when recording has stopped.
+ */
+struct histograms_type {
+    latency_histogram stages[stage::count];                     //!< Indexed by stage::type.
+    latency_histogram msg_types[msg_type_index::unknown + 1];   //!< Indexed by msg_type_index::type.
+};
+
+/*! \brief The histograms for the process. */
+inline histograms_type& histograms() {
+    static histograms_type h;
+    return h;
+}
+
+/*! \brief Record a latency for a stage. */
+inline void record(stage::type s, uint64_t cycles) {
+    histograms().stages[s].record(cycles);
+}
+
+/*! \brief Record a latency for a stage and for a message type. */
+inline void record(stage::type s, msg_type_index::type index, uint64_t cycles) {
+    histograms_type& h = histograms();
+    h.stages[s].record(cycles);
+    h.msg_types[index].record(cycles);
+}
+
+/*! \brief Reset all of the histograms. */
+inline void reset() {
+    histograms_type& h = histograms();
+    for (int s = 0; s < stage::count; ++s) h.stages[s].reset();
+    for (int i = 0; i <= msg_type_index::unknown; ++i) h.msg_types[i].reset();
+}
+
+/*!
+ * \brief Write a table of count, p50, p99, p99.9 and max in counter cycles for each stage
+ * and message type which has recorded values.
+ */
+inline void print(std::ostream& os) {
+    histograms_type const& h = histograms();
+    os << "stage\tcount\tp50\tp99\tp99.9\tmax\n";
+    int const rows = int(stage::count) + int(msg_type_index::unknown) + 1;
+    for (int s = 0; s < rows; ++s) {
+        latency_histogram const& l = s < stage::count ? h.stages[s] : h.msg_types[s - stage::count];
+        if (!l.count()) continue;
+        char const* name = s < stage::count ? stage_name(stage::type(s)) : "dispatch ";
+        os << name;
+        if (s >= stage::count) {
+            msg_type_index::type const i = msg_type_index::type(s - stage::count);
+            os << (i == msg_type_index::unknown ? "?" : details::message_dictionary[i].value);
+        }
+        os << '\t' << l.count()
+           << '\t' << l.value_at_percentile(50.0)
+           << '\t' << l.value_at_percentile(99.0)
+           << '\t' << l.value_at_percentile(99.9)
+           << '\t' << l.max() << '\n';
+    }
+}
+
+/*!
+ * \brief Records the time from construction to destruction for a stage, and optionally a message type.
+ */
+class scoped_stage {
+public:
+    /*! \brief Start timing a stage. */
+    explicit scoped_stage(stage::type s) : stage_(s), index_(msg_type_index::unknown), per_type_(false), start_(tsc()) {}
+
+    /*! \brief Start timing a stage for a message type. */
+    scoped_stage(stage::type s, msg_type_index::type index) : stage_(s), index_(index), per_type_(true), start_(tsc()) {}
+
+    /*! \brief Record the time since construction. */
+    ~scoped_stage() {
+        uint64_t const cycles = tsc() - start_;
+        if (per_type_) record(stage_, index_, cycles);
+        else record(stage_, cycles);
+    }
+
+private:
+    scoped_stage(scoped_stage const&);
+    scoped_stage& operator=(scoped_stage const&);
+
+    stage::type stage_;
+    msg_type_index::type index_;
+    bool per_type_;
+    uint64_t start_;
+};
+
+} // namespace instrument
+} // namespace hffix
+
+#ifdef HFFIX_INSTRUMENT
+/*! \brief Time the rest of the enclosing scope as an instrument::stage. Compiles to nothing unless HFFIX_INSTRUMENT is defined. */
+#define HFFIX_INSTRUMENT_SCOPE(s) ::hffix::instrument::scoped_stage hffix_instrument_scope_(::hffix::instrument::stage::s)
+/*! \brief Time the rest of the enclosing scope as an instrument::stage for a message type. Compiles to nothing unless HFFIX_INSTRUMENT is defined. */
+#define HFFIX_INSTRUMENT_SCOPE_MSG(s, index) ::hffix::instrument::scoped_stage hffix_instrument_scope_(::hffix::instrument::stage::s, (index))
+#endif
+
+#endif // HFFIX_INSTRUMENT_HPP
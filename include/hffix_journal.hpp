@@ -0,0 +1,393 @@
+/*******************************************************************************************
+Copyright 2011, T3 IP, LLC. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are
+permitted provided that the following conditions are met:
+
+   1. Redistributions of source code must retain the above copyright notice, this list of
+      conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright notice, this list
+      of conditions and the following disclaimer in the documentation and/or other materials
+      provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY T3 IP, LLC ``AS IS'' AND ANY EXPRESS OR IMPLIED
+WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL T3 IP, LLC OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those of the
+authors and should not be interpreted as representing official policies, either expressed
+or implied, of T3 IP, LLC.
+*******************************************************************************************/
+
+/*!
+ * \file
+ * \brief Persistent outbound message journal and sequence number store in memory-mapped files.
+ *
+ * Requires hffix.hpp and POSIX.
+ */
+
+#ifndef HFFIX_JOURNAL_HPP
+#define HFFIX_JOURNAL_HPP
+
+#include "hffix.hpp"
+#include <cerrno>
+#include <cstring>   // for memcpy, strerror
+#include <stdexcept> // for exceptions
+#include <string>
+#include <stdint.h>  // for uint64_t
+#include <fcntl.h>   // for open()
+#include <unistd.h>  // for close(), ftruncate()
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace hffix {
+
+/*!
+ * \brief Persistent journal of sent messages, indexed by MsgSeqNum, with persistent next sequence numbers.
+ *
+ * The journal keeps two memory-mapped files, created if they don't exist and
+ * reopened if they do:
+ *
+ * - `<path>.data`, the append-only segment. Each appended message is copied to
+ *   the end of the previous one, so any range of sequence numbers is one
+ *   contiguous span of framed messages.
+ * - `<path>.index`, a header with the persisted next send and receive sequence
+ *   numbers, followed by the offset and size of the message for each sequence
+ *   number.
+ *
+ * Appending is two `memcpy` into the mapped files, with no system call unless
+ * the sync policy calls for `msync`. Messages which were appended are durable
+ * against a crash of the process as soon as append() returns; the sync policy
+ * decides durability against a crash of the operating system.
+ *
+ * The capacities of the files are fixed when they are created. To start a new
+ * segment, for example at the start of a FIX session day, open a journal on a
+ * new path.
+ *
+ * The journal is not thread-safe.
+ *
+ * Errors from the operating system are reported by throwing std::runtime_error.
+ *
+ * Example usage:
+ * \code
+ * hffix::message_journal journal("/var/fix/SENDER-TARGET-20240219", 1 << 30, 1 << 20);
+ *
+ * // Sending:
+ * writer.push_back_int(hffix::tag::MsgSeqNum, journal.next_send_seqnum());
+ * ...
+ * writer.push_back_trailer();
+ * journal.append(journal.next_send_seqnum(), writer.message_begin(), writer.message_end());
+ *
+ * // Resending on a ResendRequest for BeginSeqNo through EndSeqNo:
+ * char const* begin;
+ * char const* end;
+ * if (journal.range(begin_seq_no, end_seq_no, begin, end))
+ *     for (hffix::message_reader r(begin, end); r.is_complete(); r = r.next_message_reader()) ...
+ * \endcode
+ */
+class message_journal {
+public:
+
+    /*! \brief When append() calls `msync` to flush the mapped files to storage. */
+    enum sync_policy {
+        sync_never, //!< Never. The operating system writes back the files on its own schedule, or call sync().
+        sync_every, //!< After every `sync_interval` appends.
+        sync_always //!< After every append.
+    };
+
+    /*!
+     * \brief Open or create a journal.
+     *
+     * \param path Path prefix of the journal files.
+     * \param data_capacity Size in bytes of the data file, if it is created.
+     * \param index_capacity Maximum number of sequence numbers in the index file, if it is created.
+     * \param policy The sync policy.
+     * \param sync_interval Number of appends between calls to `msync`, for sync_every.
+     * \throw std::runtime_error If the files cannot be opened, created or mapped, or are not journal files.
+     */
+    message_journal(
+        std::string const& path,
+        size_t data_capacity,
+        size_t index_capacity,
+        sync_policy policy = sync_never,
+        size_t sync_interval = 1
+    ) :
+        data_(0),
+        data_size_(0),
+        index_(0),
+        index_size_(0),
+        policy_(policy),
+        sync_interval_(sync_interval ? sync_interval : 1),
+        unsynced_(0),
+        synced_data_(0),
+        synced_entries_(0)
+    {
+        size_t const index_bytes = sizeof(index_header) + index_capacity * sizeof(index_entry);
+        index_ = static_cast<char*>(map_file(path + ".index", index_bytes, sizeof(index_header), index_size_));
+        try {
+            data_ = static_cast<char*>(map_file(path + ".data", data_capacity, 0, data_size_));
+        } catch (...) {
+            ::munmap(index_, index_size_);
+            throw;
+        }
+        index_header* h = header();
+        if (h->magic == 0) {
+            h->version = 1;
+            h->next_send_seqnum = 1;
+            h->next_recv_seqnum = 1;
+            h->first_seqnum = 0;
+            h->count = 0;
+            h->data_end = 0;
+            h->magic = journal_magic;
+        } else if (h->magic != journal_magic || h->version != 1 || h->data_end > data_size_ || h->count > entry_capacity()) {
+            ::munmap(data_, data_size_);
+            ::munmap(index_, index_size_);
+            throw std::runtime_error("hffix message_journal " + path + ".index is not a journal index file");
+        }
+        synced_data_ = h->data_end;
+        synced_entries_ = h->count;
+    }
+
+    /*! \brief Sync and unmap the journal files. */
+    ~message_journal() {
+        ::msync(index_, index_size_, MS_SYNC);
+        ::msync(data_, data_size_, MS_SYNC);
+        ::munmap(data_, data_size_);
+        ::munmap(index_, index_size_);
+    }
+
+    /*!
+     * \brief Append a sent message to the journal.
+     *
+     * Also sets next_send_seqnum() to `seqnum + 1`.
+     *
+     * \param seqnum The MsgSeqNum of the message. Must be positive, and greater than the MsgSeqNum of every message already in the journal.
+     * \param begin Pointer to the beginning of the message, for example message_writer::message_begin().
+     * \param end Pointer to past-the-end of the message, for example message_writer::message_end().
+     * \throw std::logic_error If seqnum is not positive, or not greater than the last seqnum in the journal.
+     * \throw std::out_of_range If the data file or the index file is full.
+     * \throw std::runtime_error If `msync` fails.
+     */
+    void append(int seqnum, char const* begin, char const* end) {
+        index_header* h = header();
+        if (seqnum < 1) throw std::logic_error("hffix message_journal.append seqnum must be positive");
+        if (h->count == 0) {
+            h->first_seqnum = seqnum;
+        } else if (uint64_t(seqnum) < h->first_seqnum + h->count) {
+            throw std::logic_error("hffix message_journal.append seqnum must increase");
+        }
+
+        uint64_t const slot = uint64_t(seqnum) - h->first_seqnum;
+        size_t const size = end - begin;
+        if (slot >= entry_capacity() || size > data_size_ - h->data_end)
+            details::throw_range_error();
+
+        std::memcpy(data_ + h->data_end, begin, size);
+
+        // Sequence numbers skipped over have empty entries.
+        index_entry* e = entries();
+        for (uint64_t i = h->count; i < slot; ++i) {
+            e[i].offset = h->data_end;
+            e[i].size = 0;
+        }
+        e[slot].offset = h->data_end;
+        e[slot].size = size;
+
+        // Publish the message by updating the header last.
+        h->data_end += size;
+        h->count = slot + 1;
+        h->next_send_seqnum = seqnum + 1;
+
+        if (policy_ == sync_always || (policy_ == sync_every && ++unsynced_ >= sync_interval_))
+            sync();
+    }
+
+    /*!
+     * \brief Find the message with a sequence number.
+     *
+     * \param seqnum The MsgSeqNum.
+     * \param[out] begin Set to the beginning of the message in the mapped data file.
+     * \param[out] end Set to past-the-end of the message in the mapped data file.
+     * \return True if a message with this sequence number is in the journal.
+     */
+    bool find(int seqnum, char const*& begin, char const*& end) const {
+        index_header const* h = header();
+        if (h->count == 0 || seqnum < 0 || uint64_t(seqnum) < h->first_seqnum || uint64_t(seqnum) >= h->first_seqnum + h->count)
+            return false;
+        index_entry const& e = entries()[seqnum - h->first_seqnum];
+        if (e.size == 0) return false;
+        begin = data_ + e.offset;
+        end = begin + e.size;
+        return true;
+    }
+
+    /*!
+     * \brief Find all the messages in a range of sequence numbers, as one contiguous span.
+     *
+     * The span is a sequence of complete FIX messages in sequence number order,
+     * which can be read with hffix::message_reader::next_message_reader(), or
+     * written to a socket as it is.
+     *
+     * \param first First MsgSeqNum in the range.
+     * \param last Last MsgSeqNum in the range, or 0 for no limit, like the EndSeqNo field of a ResendRequest.
+     * \param[out] begin Set to the beginning of the span in the mapped data file.
+     * \param[out] end Set to past-the-end of the span in the mapped data file.
+     * \return True if there are any messages in the range.
+     */
+    bool range(int first, int last, char const*& begin, char const*& end) const {
+        index_header const* h = header();
+        if (h->count == 0) return false;
+        uint64_t const top = h->first_seqnum + h->count - 1;
+        uint64_t lo = first < 1 ? 1 : first;
+        uint64_t hi = (last <= 0 || uint64_t(last) > top) ? top : last;
+        if (lo < h->first_seqnum) lo = h->first_seqnum;
+        if (lo > hi) return false;
+        index_entry const* e = entries();
+        uint64_t const b = e[lo - h->first_seqnum].offset;
+        uint64_t const x = e[hi - h->first_seqnum].offset + e[hi - h->first_seqnum].size;
+        if (b == x) return false;
+        begin = data_ + b;
+        end = data_ + x;
+        return true;
+    }
+
+    /*! \brief The persisted next MsgSeqNum to send. Starts at 1, set by append(). */
+    int next_send_seqnum() const {
+        return int(header()->next_send_seqnum);
+    }
+
+    /*! \brief Set the persisted next MsgSeqNum to send, for example after a SequenceReset. */
+    void set_next_send_seqnum(int seqnum) {
+        header()->next_send_seqnum = seqnum;
+    }
+
+    /*! \brief The persisted next MsgSeqNum expected to be received. Starts at 1. */
+    int next_recv_seqnum() const {
+        return int(header()->next_recv_seqnum);
+    }
+
+    /*!
+     * \brief Set the persisted next MsgSeqNum expected to be received.
+     *
+     * This is a store to mapped memory, cheap enough to call for every received message.
+     */
+    void set_next_recv_seqnum(int seqnum) {
+        header()->next_recv_seqnum = seqnum;
+    }
+
+    /*! \brief Size in bytes of all the messages in the journal. */
+    size_t data_size() const {
+        return size_t(header()->data_end);
+    }
+
+    /*!
+     * \brief Flush the changes since the last sync to storage with `msync`.
+     * \throw std::runtime_error If `msync` fails.
+     */
+    void sync() {
+        index_header const* h = header();
+        msync_range(data_, synced_data_, h->data_end);
+        msync_range(index_, sizeof(index_header) + synced_entries_ * sizeof(index_entry), sizeof(index_header) + h->count * sizeof(index_entry));
+        msync_range(index_, 0, sizeof(index_header));
+        synced_data_ = h->data_end;
+        synced_entries_ = h->count;
+        unsynced_ = 0;
+    }
+
+private:
+    message_journal(message_journal const&);
+    message_journal& operator=(message_journal const&);
+
+    enum { journal_magic = 0x58494648 }; // "HFIX"
+
+    struct index_header {
+        uint64_t magic;
+        uint64_t version;
+        uint64_t next_send_seqnum;
+        uint64_t next_recv_seqnum;
+        uint64_t first_seqnum;  // MsgSeqNum of entry 0.
+        uint64_t count;         // Number of entries.
+        uint64_t data_end;      // End of the last message in the data file.
+        uint64_t reserved;
+    };
+
+    struct index_entry {
+        uint64_t offset;
+        uint64_t size;
+    };
+
+    index_header* header() const {
+        return reinterpret_cast<index_header*>(index_);
+    }
+
+    index_entry* entries() const {
+        return reinterpret_cast<index_entry*>(index_ + sizeof(index_header));
+    }
+
+    // Number of entries which fit in the index file.
+    uint64_t entry_capacity() const {
+        return (index_size_ - sizeof(index_header)) / sizeof(index_entry);
+    }
+
+    static void throw_errno(std::string const& what) {
+        throw std::runtime_error("hffix message_journal " + what + ": " + std::strerror(errno));
+    }
+
+    // Open or create a file and map it. A new file is extended to size bytes
+    // (zero-filled). An existing file is mapped at its own size, which must be
+    // at least min_size.
+    static void* map_file(std::string const& path, size_t size, size_t min_size, size_t& mapped_size) {
+        int fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+        if (fd < 0) throw_errno("open " + path);
+        struct stat st;
+        if (::fstat(fd, &st) < 0) {
+            ::close(fd);
+            throw_errno("fstat " + path);
+        }
+        if (st.st_size == 0) {
+            if (::ftruncate(fd, off_t(size)) < 0) {
+                ::close(fd);
+                throw_errno("ftruncate " + path);
+            }
+            mapped_size = size;
+        } else if (size_t(st.st_size) < min_size) {
+            ::close(fd);
+            throw std::runtime_error("hffix message_journal " + path + " is not a journal file");
+        } else {
+            mapped_size = size_t(st.st_size);
+        }
+        void* p = ::mmap(0, mapped_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (p == MAP_FAILED) throw_errno("mmap " + path);
+        return p;
+    }
+
+    // msync the pages containing [begin, end) of a mapping.
+    static void msync_range(char* base, uint64_t begin, uint64_t end) {
+        if (begin >= end) return;
+        static long const page = ::sysconf(_SC_PAGESIZE);
+        uint64_t const aligned = begin - begin % page;
+        if (::msync(base + aligned, size_t(end - aligned), MS_SYNC) < 0) throw_errno("msync");
+    }
+
+    char* data_;
+    size_t data_size_;
+    char* index_;
+    size_t index_size_;
+    sync_policy policy_;
+    size_t sync_interval_;
+    size_t unsynced_;
+    uint64_t synced_data_;
+    uint64_t synced_entries_;
+};
+
+} // namespace hffix
+
+#endif // HFFIX_JOURNAL_HPP
@@ -0,0 +1,11415 @@
+/*!
+\file
+\brief The hffix_layouts.hpp file is generated by the fixspec/spec-parse-fields Haskell program from the FIX Protocol specification documents in the fixspec/ directory.
+
+Do not edit this file, instead modify the fixspec/spec-parse-fields program and run it from the fixspec/spec-parse-fields directory as shown here.
+Requires Nix.
+
+    cd fixspec/spec-parse-fields
+    nix develop
+    cabal v2-build
+    cabal v2-run -- layouts > hffix_layouts.hpp
+    mv hffix_layouts.hpp ../../include/hffix_layouts.hpp
+
+The layouts are the fields, components and repeating groups of the body of each message type, and of each component, from the FIX Repository MsgContents.xml and Components.xml, in order. The StandardHeader and StandardTrailer are not included.
+*/
+
+#ifndef HFFIX_LAYOUTS_HEADER
+#define HFFIX_LAYOUTS_HEADER
+#include "hffix_fields.hpp" // for msg_type_index, HFFIX_CONSTEXPR
+namespace hffix {
+
+/*!
+ * \brief One field, component or repeating group in a hffix::layout.
+ *
+ * - A field has `component` -1 and the `tag` of the field.
+ * - A component has `tag` 0 and the `component` index of the component layout, whose entries belong in place of this entry.
+ * - A repeating group has the `tag` of its NumInGroup field and the `component` index of the layout of one group instance.
+ *   The first entry of that layout is the delimiter field of the group.
+ */
+struct layout_entry {
+    int tag;         //!< Field tag, or NumInGroup field tag of a repeating group, or 0 for a component.
+    short component; //!< Index of the layout of a component or repeating group for component_layout(), or -1 for a field.
+    bool required;   //!< Required by the FIX Repository, when the enclosing component or group instance is present.
+};
+
+/*!
+ * \brief The entries of the body of a message type, of a component, or of one instance of a repeating group.
+ *
+ * Iterate over the entries from layout_begin() to layout_end().
+ */
+struct layout {
+    char const* name;     //!< Message or component name.
+    unsigned short begin; //!< Index of the first entry.
+    unsigned short end;   //!< Index of past-the-last entry.
+};
+
+/* @cond EXCLUDE */
+namespace details {
+
+//! The entries of all the layouts.
+static HFFIX_CONSTEXPR layout_entry layout_entries[] = {
+{tag::Commission,                              -1,   false},
+{tag::CommType,                                -1,   false},
+{tag::CommCurrency,                            -1,   false},
+{tag::CommRate,                                -1,   false},
+{tag::CommUnitOfMeasure,                       -1,   false},
+{tag::FundRenewWaiv,                           -1,   false},
+{tag::DiscretionInst,                          -1,   false},
+{tag::DiscretionOffsetValue,                   -1,   false},
+{tag::DiscretionMoveType,                      -1,   false},
+{tag::DiscretionOffsetType,                    -1,   false},
+{tag::DiscretionLimitType,                     -1,   false},
+{tag::DiscretionRoundDirection,                -1,   false},
+{tag::DiscretionScope,                         -1,   false},
+{tag::AgreementDesc,                           -1,   false},
+{tag::AgreementID,                             -1,   false},
+{tag::AgreementVersion,                        -1,   false},
+{tag::AgreementDate,                           -1,   false},
+{tag::AgreementCurrency,                       -1,   false},
+{tag::MasterConfirmationDesc,                  -1,   false},
+{tag::MasterConfirmationDate,                  -1,   false},
+{tag::MasterConfirmationAnnexDesc,             -1,   false},
+{tag::MasterConfirmationAnnexDate,             -1,   false},
+{tag::BrokerConfirmationDesc,                  -1,   false},
+{tag::NoContractualDefinitions,                246,  false}, // FinancingContractualDefinitionGrp
+{tag::NoFinancingTermSupplements,              248,  false}, // FinancingTermSupplementGrp
+{tag::NoContractualMatrices,                   247,  false}, // FinancingContractualMatrixGrp
+{tag::CreditSupportAgreementDesc,              -1,   false},
+{tag::CreditSupportAgreementDate,              -1,   false},
+{tag::CreditSupportAgreementID,                -1,   false},
+{tag::GoverningLaw,                            -1,   false},
+{tag::DocumentationText,                       -1,   false},
+{tag::EncodedDocumentationTextLen,             -1,   false},
+{tag::EncodedDocumentationText,                -1,   false},
+{tag::TerminationType,                         -1,   false},
+{tag::StartDate,                               -1,   false},
+{tag::EndDate,                                 -1,   false},
+{tag::DeliveryType,                            -1,   false},
+{tag::MarginRatio,                             -1,   false},
+{tag::Symbol,                                  -1,   false},
+{tag::SymbolSfx,                               -1,   false},
+{tag::SecurityID,                              -1,   false},
+{tag::SecurityIDSource,                        -1,   false},
+{tag::NoSecurityAltID,                         93,   false}, // SecAltIDGrp
+{tag::Product,                                 -1,   false},
+{tag::ProductComplex,                          -1,   false},
+{tag::SecurityGroup,                           -1,   false},
+{tag::CFICode,                                 -1,   false},
+{tag::SecurityType,                            -1,   false},
+{tag::SecuritySubType,                         -1,   false},
+{tag::MaturityMonthYear,                       -1,   false},
+{tag::MaturityDate,                            -1,   false},
+{tag::MaturityTime,                            -1,   false},
+{tag::SettleOnOpenFlag,                        -1,   false},
+{tag::InstrmtAssignmentMethod,                 -1,   false},
+{tag::SecurityStatus,                          -1,   false},
+{tag::CouponPaymentDate,                       -1,   false},
+{tag::RestructuringType,                       -1,   false},
+{tag::Seniority,                               -1,   false},
+{tag::NotionalPercentageOutstanding,           -1,   false},
+{tag::OriginalNotionalPercentageOutstanding,   -1,   false},
+{tag::AttachmentPoint,                         -1,   false},
+{tag::DetachmentPoint,                         -1,   false},
+{tag::ObligationType,                          -1,   false},
+{tag::AssetGroup,                              -1,   false},
+{tag::AssetClass,                              -1,   false},
+{tag::AssetSubClass,                           -1,   false},
+{tag::AssetType,                               -1,   false},
+{tag::AssetSubType,                            -1,   false},
+{tag::NoSecondaryAssetClasses,                 307,  false}, // SecondaryAssetGrp
+{tag::NoAssetAttributes,                       398,  false}, // AssetAttributeGrp
+{tag::SwapClass,                               -1,   false},
+{tag::SwapSubClass,                            -1,   false},
+{tag::NthToDefault,                            -1,   false},
+{tag::MthToDefault,                            -1,   false},
+{tag::SettledEntityMatrixSource,               -1,   false},
+{tag::SettledEntityMatrixPublicationDate,      -1,   false},
+{tag::CouponType,                              -1,   false},
+{tag::TotalIssuedAmount,                       -1,   false},
+{tag::CouponFrequencyPeriod,                   -1,   false},
+{tag::CouponFrequencyUnit,                     -1,   false},
+{tag::CouponDayCount,                          -1,   false},
+{tag::ConvertibleBondEquityID,                 -1,   false},
+{tag::ConvertibleBondEquityIDSource,           -1,   false},
+{tag::ContractPriceRefMonth,                   -1,   false},
+{tag::LienSeniority,                           -1,   false},
+{tag::LoanFacility,                            -1,   false},
+{tag::ReferenceEntityType,                     -1,   false},
+{tag::IndexSeries,                             -1,   false},
+{tag::IndexAnnexVersion,                       -1,   false},
+{tag::IndexAnnexDate,                          -1,   false},
+{tag::IndexAnnexSource,                        -1,   false},
+{tag::SettlRateIndex,                          -1,   false},
+{tag::SettlRateIndexLocation,                  -1,   false},
+{tag::OptionExpirationDesc,                    -1,   false},
+{tag::EncodedOptionExpirationDescLen,          -1,   false},
+{tag::EncodedOptionExpirationDesc,             -1,   false},
+{tag::IssueDate,                               -1,   false},
+{tag::RepoCollateralSecurityType,              -1,   false},
+{tag::RepurchaseTerm,                          -1,   false},
+{tag::RepurchaseRate,                          -1,   false},
+{tag::Factor,                                  -1,   false},
+{tag::CreditRating,                            -1,   false},
+{tag::InstrRegistry,                           -1,   false},
+{tag::CountryOfIssue,                          -1,   false},
+{tag::StateOrProvinceOfIssue,                  -1,   false},
+{tag::LocaleOfIssue,                           -1,   false},
+{tag::RedemptionDate,                          -1,   false},
+{tag::StrikePrice,                             -1,   false},
+{tag::OrigStrikePrice,                         -1,   false},
+{tag::StrikePricePrecision,                    -1,   false},
+{tag::StrikeCurrency,                          -1,   false},
+{tag::StrikeMultiplier,                        -1,   false},
+{tag::StrikeValue,                             -1,   false},
+{tag::StrikeUnitOfMeasure,                     -1,   false},
+{tag::StrikeIndex,                             -1,   false},
+{tag::StrikeIndexCurvePoint,                   -1,   false},
+{tag::StrikeIndexSpread,                       -1,   false},
+{tag::StrikeIndexQuote,                        -1,   false},
+{tag::StrikePriceDeterminationMethod,          -1,   false},
+{tag::StrikePriceBoundaryMethod,               -1,   false},
+{tag::StrikePriceBoundaryPrecision,            -1,   false},
+{tag::UnderlyingPriceDeterminationMethod,      -1,   false},
+{tag::OptAttribute,                            -1,   false},
+{tag::ContractMultiplier,                      -1,   false},
+{tag::ContractMultiplierUnit,                  -1,   false},
+{tag::TradingUnitPeriodMultiplier,             -1,   false},
+{tag::FlowScheduleType,                        -1,   false},
+{tag::MinPriceIncrement,                       -1,   false},
+{tag::MinPriceIncrementAmount,                 -1,   false},
+{tag::UnitOfMeasure,                           -1,   false},
+{tag::UnitOfMeasureQty,                        -1,   false},
+{tag::UnitOfMeasureCurrency,                   -1,   false},
+{tag::PriceUnitOfMeasure,                      -1,   false},
+{tag::PriceUnitOfMeasureQty,                   -1,   false},
+{tag::PriceUnitOfMeasureCurrency,              -1,   false},
+{tag::SettlMethod,                             -1,   false},
+{tag::SettlSubMethod,                          -1,   false},
+{tag::ExerciseStyle,                           -1,   false},
+{tag::OptPayoutType,                           -1,   false},
+{tag::OptPayoutAmount,                         -1,   false},
+{tag::ReturnTrigger,                           -1,   false},
+{tag::PriceQuoteMethod,                        -1,   false},
+{tag::ValuationMethod,                         -1,   false},
+{tag::ValuationSource,                         -1,   false},
+{tag::ValuationReferenceModel,                 -1,   false},
+{tag::PriceQuoteCurrency,                      -1,   false},
+{tag::ListMethod,                              -1,   false},
+{tag::CapPrice,                                -1,   false},
+{tag::FloorPrice,                              -1,   false},
+{tag::PutOrCall,                               -1,   false},
+{tag::InTheMoneyCondition,                     -1,   false},
+{tag::ContraryInstructionEligibilityIndicator, -1,   false},
+{tag::FlexibleIndicator,                       -1,   false},
+{tag::FlexProductEligibilityIndicator,         -1,   false},
+{tag::BlockTradeEligibilityIndicator,          -1,   false},
+{tag::LowExercisePriceOptionIndicator,         -1,   false},
+{tag::TimeUnit,                                -1,   false},
+{tag::CouponRate,                              -1,   false},
+{tag::SecurityExchange,                        -1,   false},
+{tag::PositionLimit,                           -1,   false},
+{tag::NTPositionLimit,                         -1,   false},
+{tag::Issuer,                                  -1,   false},
+{tag::EncodedIssuerLen,                        -1,   false},
+{tag::EncodedIssuer,                           -1,   false},
+{tag::FinancialInstrumentShortName,            -1,   false},
+{tag::FinancialInstrumentFullName,             -1,   false},
+{tag::EncodedFinancialInstrumentFullNameLen,   -1,   false},
+{tag::EncodedFinancialInstrumentFullName,      -1,   false},
+{tag::SecurityDesc,                            -1,   false},
+{tag::EncodedSecurityDescLen,                  -1,   false},
+{tag::EncodedSecurityDesc,                     -1,   false},
+{0,                                            126,  false}, // SecurityXML
+{tag::Pool,                                    -1,   false},
+{tag::ContractSettlMonth,                      -1,   false},
+{tag::CPProgram,                               -1,   false},
+{tag::CPRegType,                               -1,   false},
+{tag::NoEvents,                                92,   false}, // EvntGrp
+{tag::DatedDate,                               -1,   false},
+{tag::InterestAccrualDate,                     -1,   false},
+{tag::NoInstrumentParties,                     109,  false}, // InstrumentParties
+{tag::ShortSaleRestriction,                    -1,   false},
+{tag::NoComplexEvents,                         169,  false}, // ComplexEvents
+{tag::RefTickTableID,                          -1,   false},
+{tag::StrategyType,                            -1,   false},
+{tag::CommonPricingIndicator,                  -1,   false},
+{tag::SettlDisruptionProvision,                -1,   false},
+{tag::DeliveryRouteOrCharter,                  -1,   false},
+{tag::InstrumentRoundingDirection,             -1,   false},
+{tag::InstrumentRoundingPrecision,             -1,   false},
+{tag::InstrumentPricePrecision,                -1,   false},
+{0,                                            336,  false}, // DateAdjustment
+{0,                                            432,  false}, // PricingDateTime
+{0,                                            415,  false}, // MarketDisruption
+{0,                                            419,  false}, // OptionExercise
+{tag::NoStreams,                               312,  false}, // StreamGrp
+{tag::NoProvisions,                            303,  false}, // ProvisionGrp
+{tag::NoAdditionalTerms,                       243,  false}, // AdditionalTermGrp
+{tag::NoProtectionTerms,                       292,  false}, // ProtectionTermGrp
+{tag::NoCashSettlTerms,                        245,  false}, // CashSettlTermGrp
+{tag::NoPhysicalSettlTerms,                    290,  false}, // PhysicalSettlTermGrp
+{tag::NoExtraordinaryEvents,                   606,  false}, // ExtraordinaryEventGrp
+{tag::ExtraordinaryEventAdjustmentMethod,      -1,   false},
+{tag::ExchangeLookAlike,                       -1,   false},
+{tag::DeliveryForm,                            -1,   false},
+{tag::PctAtRisk,                               -1,   false},
+{tag::NoInstrAttrib,                           96,   false}, // AttrbGrp
+{tag::CommodityFinalPriceType,                 -1,   false},
+{tag::NoIndexRollMonths,                       713,  false}, // IndexRollMonthGrp
+{tag::NextIndexRollDate,                       -1,   false},
+{0,                                            715,  false}, // FloatingRateIndex
+{tag::NoReferenceDataDates,                    714,  false}, // ReferenceDataDateGrp
+{tag::LegSymbol,                               -1,   false},
+{tag::LegSymbolSfx,                            -1,   false},
+{tag::LegSecurityID,                           -1,   false},
+{tag::LegSecurityIDSource,                     -1,   false},
+{tag::NoLegSecurityAltID,                      94,   false}, // LegSecAltIDGrp
+{tag::LegID,                                   -1,   false},
+{tag::LegProduct,                              -1,   false},
+{tag::LegSecurityGroup,                        -1,   false},
+{tag::LegCFICode,                              -1,   false},
+{tag::LegSecurityType,                         -1,   false},
+{tag::LegSecuritySubType,                      -1,   false},
+{tag::LegMaturityMonthYear,                    -1,   false},
+{tag::LegMaturityDate,                         -1,   false},
+{tag::LegMaturityTime,                         -1,   false},
+{tag::LegSettleOnOpenFlag,                     -1,   false},
+{tag::LegInstrmtAssignmentMethod,              -1,   false},
+{tag::LegSecurityStatus,                       -1,   false},
+{tag::LegCouponPaymentDate,                    -1,   false},
+{tag::LegRestructuringType,                    -1,   false},
+{tag::LegSeniority,                            -1,   false},
+{tag::LegNotionalPercentageOutstanding,        -1,   false},
+{tag::LegOriginalNotionalPercentageOutstanding, -1,   false},
+{tag::LegAttachmentPoint,                      -1,   false},
+{tag::LegDetachmentPoint,                      -1,   false},
+{tag::LegObligationType,                       -1,   false},
+{tag::LegAssetGroup,                           -1,   false},
+{tag::LegAssetClass,                           -1,   false},
+{tag::LegAssetSubClass,                        -1,   false},
+{tag::LegAssetType,                            -1,   false},
+{tag::LegAssetSubType,                         -1,   false},
+{tag::NoLegSecondaryAssetClasses,              270,  false}, // LegSecondaryAssetGrp
+{tag::NoLegAssetAttributes,                    445,  false}, // LegAssetAttributeGrp
+{tag::LegSwapClass,                            -1,   false},
+{tag::LegSwapSubClass,                         -1,   false},
+{tag::LegNthToDefault,                         -1,   false},
+{tag::LegMthToDefault,                         -1,   false},
+{tag::LegSettledEntityMatrixSource,            -1,   false},
+{tag::LegSettledEntityMatrixPublicationDate,   -1,   false},
+{tag::LegCouponType,                           -1,   false},
+{tag::LegTotalIssuedAmount,                    -1,   false},
+{tag::LegCouponFrequencyPeriod,                -1,   false},
+{tag::LegCouponFrequencyUnit,                  -1,   false},
+{tag::LegCouponDayCount,                       -1,   false},
+{tag::LegConvertibleBondEquityID,              -1,   false},
+{tag::LegConvertibleBondEquityIDSource,        -1,   false},
+{tag::LegContractPriceRefMonth,                -1,   false},
+{tag::LegLienSeniority,                        -1,   false},
+{tag::LegLoanFacility,                         -1,   false},
+{tag::LegReferenceEntityType,                  -1,   false},
+{tag::LegIndexSeries,                          -1,   false},
+{tag::LegIndexAnnexVersion,                    -1,   false},
+{tag::LegIndexAnnexDate,                       -1,   false},
+{tag::LegIndexAnnexSource,                     -1,   false},
+{tag::LegSettlRateIndex,                       -1,   false},
+{tag::LegSettlRateIndexLocation,               -1,   false},
+{tag::LegOptionExpirationDesc,                 -1,   false},
+{tag::EncodedLegOptionExpirationDescLen,       -1,   false},
+{tag::EncodedLegOptionExpirationDesc,          -1,   false},
+{tag::LegIssueDate,                            -1,   false},
+{tag::LegRepoCollateralSecurityType,           -1,   false},
+{tag::LegRepurchaseTerm,                       -1,   false},
+{tag::LegRepurchaseRate,                       -1,   false},
+{tag::LegFactor,                               -1,   false},
+{tag::LegCreditRating,                         -1,   false},
+{tag::LegInstrRegistry,                        -1,   false},
+{tag::LegCountryOfIssue,                       -1,   false},
+{tag::LegStateOrProvinceOfIssue,               -1,   false},
+{tag::LegLocaleOfIssue,                        -1,   false},
+{tag::LegRedemptionDate,                       -1,   false},
+{tag::LegStrikePrice,                          -1,   false},
+{tag::LegStrikeCurrency,                       -1,   false},
+{tag::LegStrikeMultiplier,                     -1,   false},
+{tag::LegStrikeValue,                          -1,   false},
+{tag::LegStrikeUnitOfMeasure,                  -1,   false},
+{tag::LegStrikeIndex,                          -1,   false},
+{tag::LegStrikeIndexCurvePoint,                -1,   false},
+{tag::LegStrikeIndexSpread,                    -1,   false},
+{tag::LegStrikeIndexQuote,                     -1,   false},
+{tag::LegStrikePriceDeterminationMethod,       -1,   false},
+{tag::LegStrikePriceBoundaryMethod,            -1,   false},
+{tag::LegStrikePriceBoundaryPrecision,         -1,   false},
+{tag::LegUnderlyingPriceDeterminationMethod,   -1,   false},
+{tag::LegOptAttribute,                         -1,   false},
+{tag::LegContractMultiplier,                   -1,   false},
+{tag::LegContractMultiplierUnit,               -1,   false},
+{tag::LegTradingUnitPeriodMultiplier,          -1,   false},
+{tag::LegFlowScheduleType,                     -1,   false},
+{tag::LegMinPriceIncrement,                    -1,   false},
+{tag::LegMinPriceIncrementAmount,              -1,   false},
+{tag::LegUnitOfMeasure,                        -1,   false},
+{tag::LegUnitOfMeasureQty,                     -1,   false},
+{tag::LegUnitOfMeasureCurrency,                -1,   false},
+{tag::LegPriceUnitOfMeasure,                   -1,   false},
+{tag::LegPriceUnitOfMeasureQty,                -1,   false},
+{tag::LegPriceUnitOfMeasureCurrency,           -1,   false},
+{tag::LegSettlMethod,                          -1,   false},
+{tag::LegTimeUnit,                             -1,   false},
+{tag::LegExerciseStyle,                        -1,   false},
+{tag::LegOptPayoutType,                        -1,   false},
+{tag::LegOptPayoutAmount,                      -1,   false},
+{tag::LegReturnTrigger,                        -1,   false},
+{tag::LegPriceQuoteMethod,                     -1,   false},
+{tag::LegValuationMethod,                      -1,   false},
+{tag::LegValuationSource,                      -1,   false},
+{tag::LegValuationReferenceModel,              -1,   false},
+{tag::LegPriceQuoteCurrency,                   -1,   false},
+{tag::LegListMethod,                           -1,   false},
+{tag::LegCapPrice,                             -1,   false},
+{tag::LegFloorPrice,                           -1,   false},
+{tag::LegFlexibleIndicator,                    -1,   false},
+{tag::LegFlexProductEligibilityIndicator,      -1,   false},
+{tag::LegCouponRate,                           -1,   false},
+{tag::LegSecurityExchange,                     -1,   false},
+{tag::LegPositionLimit,                        -1,   false},
+{tag::LegNTPositionLimit,                      -1,   false},
+{tag::LegIssuer,                               -1,   false},
+{tag::EncodedLegIssuerLen,                     -1,   false},
+{tag::EncodedLegIssuer,                        -1,   false},
+{tag::LegFinancialInstrumentShortName,         -1,   false},
+{tag::LegFinancialInstrumentFullName,          -1,   false},
+{tag::EncodedLegFinancialInstrumentFullNameLen, -1,   false},
+{tag::EncodedLegFinancialInstrumentFullName,   -1,   false},
+{tag::LegSecurityDesc,                         -1,   false},
+{tag::EncodedLegSecurityDescLen,               -1,   false},
+{tag::EncodedLegSecurityDesc,                  -1,   false},
+{0,                                            231,  false}, // LegSecurityXML
+{tag::LegCPProgram,                            -1,   false},
+{tag::LegCPRegType,                            -1,   false},
+{tag::LegRatioQty,                             -1,   false},
+{tag::LegSide,                                 -1,   false},
+{tag::LegCurrency,                             -1,   false},
+{tag::LegPool,                                 -1,   false},
+{tag::LegDatedDate,                            -1,   false},
+{tag::LegContractSettlMonth,                   -1,   false},
+{tag::LegInterestAccrualDate,                  -1,   false},
+{tag::LegPutOrCall,                            -1,   false},
+{tag::LegInTheMoneyCondition,                  -1,   false},
+{tag::LegContraryInstructionEligibilityIndicator, -1,   false},
+{tag::LegOptionRatio,                          -1,   false},
+{tag::LegPrice,                                -1,   false},
+{tag::NoLegEvents,                             249,  false}, // LegEvntGrp
+{tag::NoLegInstrumentParties,                  468,  false}, // LegInstrumentParties
+{tag::LegShortSaleRestriction,                 -1,   false},
+{tag::NoLegComplexEvents,                      457,  false}, // LegComplexEvents
+{tag::LegStrategyType,                         -1,   false},
+{tag::LegCommonPricingIndicator,               -1,   false},
+{tag::LegSettlDisruptionProvision,             -1,   false},
+{tag::LegDeliveryRouteOrCharter,               -1,   false},
+{tag::LegInstrumentRoundingDirection,          -1,   false},
+{tag::LegInstrumentRoundingPrecision,          -1,   false},
+{0,                                            338,  false}, // LegDateAdjustment
+{0,                                            489,  false}, // LegPricingDateTime
+{0,                                            470,  false}, // LegMarketDisruption
+{0,                                            474,  false}, // LegOptionExercise
+{tag::NoLegStreams,                            274,  false}, // LegStreamGrp
+{tag::NoLegProvisions,                         267,  false}, // LegProvisionGrp
+{tag::NoLegAdditionalTerms,                    444,  false}, // LegAdditionalTermGrp
+{tag::NoLegProtectionTerms,                    491,  false}, // LegProtectionTermGrp
+{tag::NoLegCashSettlTerms,                     447,  false}, // LegCashSettlTermGrp
+{tag::NoLegPhysicalSettlTerms,                 486,  false}, // LegPhysicalSettlTermGrp
+{tag::NoLegExtraordinaryEvents,                617,  false}, // LegExtraordinaryEventGrp
+{tag::LegExtraordinaryEventAdjustmentMethod,   -1,   false},
+{tag::LegExchangeLookAlike,                    -1,   false},
+{tag::LegBenchmarkCurveCurrency,               -1,   false},
+{tag::LegBenchmarkCurveName,                   -1,   false},
+{tag::LegBenchmarkCurvePoint,                  -1,   false},
+{tag::LegBenchmarkPrice,                       -1,   false},
+{tag::LegBenchmarkPriceType,                   -1,   false},
+{tag::LegStipulationType,                      -1,   false},
+{tag::LegStipulationValue,                     -1,   false},
+{tag::NestedPartyID,                           -1,   false},
+{tag::NestedPartyIDSource,                     -1,   false},
+{tag::NestedPartyRole,                         -1,   false},
+{tag::NestedPartyRoleQualifier,                -1,   false},
+{tag::NoNestedPartySubIDs,                     100,  false}, // NstdPtysSubGrp
+{tag::OrderQty,                                -1,   false},
+{tag::CashOrderQty,                            -1,   false},
+{tag::OrderPercent,                            -1,   false},
+{tag::RoundingDirection,                       -1,   false},
+{tag::RoundingModulus,                         -1,   false},
+{tag::PartyID,                                 -1,   false},
+{tag::PartyIDSource,                           -1,   false},
+{tag::PartyRole,                               -1,   false},
+{tag::PartyRoleQualifier,                      -1,   false},
+{tag::NoPartySubIDs,                           99,   false}, // PtysSubGrp
+{tag::PegOffsetValue,                          -1,   false},
+{tag::PegPriceType,                            -1,   false},
+{tag::PegMoveType,                             -1,   false},
+{tag::PegOffsetType,                           -1,   false},
+{tag::PegLimitType,                            -1,   false},
+{tag::PegRoundDirection,                       -1,   false},
+{tag::PegScope,                                -1,   false},
+{tag::PegSecurityIDSource,                     -1,   false},
+{tag::PegSecurityID,                           -1,   false},
+{tag::PegSymbol,                               -1,   false},
+{tag::PegSecurityDesc,                         -1,   false},
+{tag::PosAmtType,                              -1,   false},
+{tag::PosAmt,                                  -1,   false},
+{tag::PosAmtStreamDesc,                        -1,   false},
+{tag::PositionCurrency,                        -1,   false},
+{tag::PositionFXRate,                          -1,   false},
+{tag::PositionFXRateCalc,                      -1,   false},
+{tag::PosAmtReason,                            -1,   false},
+{tag::PosAmtMarketSegmentID,                   -1,   false},
+{tag::PosAmtMarketID,                          -1,   false},
+{tag::PosType,                                 -1,   false},
+{tag::LongQty,                                 -1,   false},
+{tag::ShortQty,                                -1,   false},
+{tag::CoveredQty,                              -1,   false},
+{tag::PosQtyStatus,                            -1,   false},
+{tag::QuantityDate,                            -1,   false},
+{tag::PosQtyUnitOfMeasure,                     -1,   false},
+{tag::PosQtyUnitOfMeasureCurrency,             -1,   false},
+{tag::NoNestedPartyIDs,                        8,    false}, // NestedParties
+{tag::SettlDeliveryType,                       -1,   false},
+{tag::StandInstDbType,                         -1,   false},
+{tag::StandInstDbName,                         -1,   false},
+{tag::StandInstDbID,                           -1,   false},
+{tag::NoDlvyInst,                              97,   false}, // DlvyInstGrp
+{tag::SettlPartyID,                            -1,   false},
+{tag::SettlPartyIDSource,                      -1,   false},
+{tag::SettlPartyRole,                          -1,   false},
+{tag::SettlPartyRoleQualifier,                 -1,   false},
+{tag::NoSettlPartySubIDs,                      98,   false}, // SettlPtysSubGrp
+{tag::Spread,                                  -1,   false},
+{tag::BenchmarkCurveCurrency,                  -1,   false},
+{tag::BenchmarkCurveName,                      -1,   false},
+{tag::BenchmarkCurvePoint,                     -1,   false},
+{tag::BenchmarkPrice,                          -1,   false},
+{tag::BenchmarkPriceType,                      -1,   false},
+{tag::BenchmarkSecurityID,                     -1,   false},
+{tag::BenchmarkSecurityIDSource,               -1,   false},
+{tag::StipulationType,                         -1,   false},
+{tag::StipulationValue,                        -1,   false},
+{tag::TrdRegTimestamp,                         -1,   false},
+{tag::TrdRegTimestampType,                     -1,   false},
+{tag::TrdRegTimestampOrigin,                   -1,   false},
+{tag::DeskType,                                -1,   false},
+{tag::DeskTypeSource,                          -1,   false},
+{tag::DeskOrderHandlingInst,                   -1,   false},
+{tag::InformationBarrierID,                    -1,   false},
+{tag::UnderlyingSymbol,                        -1,   false},
+{tag::UnderlyingSymbolSfx,                     -1,   false},
+{tag::UnderlyingSecurityID,                    -1,   false},
+{tag::UnderlyingSecurityIDSource,              -1,   false},
+{tag::NoUnderlyingSecurityAltID,               95,   false}, // UndSecAltIDGrp
+{tag::UnderlyingProduct,                       -1,   false},
+{0,                                            232,  false}, // UnderlyingSecurityXML
+{tag::UnderlyingCFICode,                       -1,   false},
+{tag::UnderlyingSecurityType,                  -1,   false},
+{tag::UnderlyingSecuritySubType,               -1,   false},
+{tag::UnderlyingMaturityMonthYear,             -1,   false},
+{tag::UnderlyingMaturityDate,                  -1,   false},
+{tag::UnderlyingMaturityTime,                  -1,   false},
+{tag::UnderlyingContractPriceRefMonth,         -1,   false},
+{tag::UnderlyingCouponPaymentDate,             -1,   false},
+{tag::UnderlyingRestructuringType,             -1,   false},
+{tag::UnderlyingSeniority,                     -1,   false},
+{tag::UnderlyingNotional,                      -1,   false},
+{tag::UnderlyingNotionalCurrency,              -1,   false},
+{tag::UnderlyingNotionalDeterminationMethod,   -1,   false},
+{tag::UnderlyingNotionalAdjustments,           -1,   false},
+{tag::UnderlyingNotionalXIDRef,                -1,   false},
+{tag::UnderlyingNotionalPercentageOutstanding, -1,   false},
+{tag::UnderlyingOriginalNotionalPercentageOutstanding, -1,   false},
+{tag::UnderlyingAttachmentPoint,               -1,   false},
+{tag::UnderlyingDetachmentPoint,               -1,   false},
+{tag::UnderlyingIssueDate,                     -1,   false},
+{tag::UnderlyingRepoCollateralSecurityType,    -1,   false},
+{tag::UnderlyingRepurchaseTerm,                -1,   false},
+{tag::UnderlyingRepurchaseRate,                -1,   false},
+{tag::UnderlyingFactor,                        -1,   false},
+{tag::UnderlyingCreditRating,                  -1,   false},
+{tag::UnderlyingInstrRegistry,                 -1,   false},
+{tag::UnderlyingCountryOfIssue,                -1,   false},
+{tag::UnderlyingStateOrProvinceOfIssue,        -1,   false},
+{tag::UnderlyingLocaleOfIssue,                 -1,   false},
+{tag::UnderlyingRedemptionDate,                -1,   false},
+{tag::UnderlyingStrikePrice,                   -1,   false},
+{tag::UnderlyingStrikeCurrency,                -1,   false},
+{tag::UnderlyingOptAttribute,                  -1,   false},
+{tag::UnderlyingContractMultiplier,            -1,   false},
+{tag::UnderlyingContractMultiplierUnit,        -1,   false},
+{tag::UnderlyingTradingUnitPeriodMultiplier,   -1,   false},
+{tag::UnderlyingFlowScheduleType,              -1,   false},
+{tag::UnderlyingUnitOfMeasure,                 -1,   false},
+{tag::UnderlyingUnitOfMeasureQty,              -1,   false},
+{tag::UnderlyingUnitOfMeasureCurrency,         -1,   false},
+{tag::UnderlyingPriceUnitOfMeasure,            -1,   false},
+{tag::UnderlyingPriceUnitOfMeasureQty,         -1,   false},
+{tag::UnderlyingPriceUnitOfMeasureCurrency,    -1,   false},
+{tag::UnderlyingTimeUnit,                      -1,   false},
+{tag::UnderlyingExerciseStyle,                 -1,   false},
+{tag::UnderlyingPriceQuoteCurrency,            -1,   false},
+{tag::UnderlyingCouponRate,                    -1,   false},
+{tag::UnderlyingSecurityExchange,              -1,   false},
+{tag::UnderlyingIssuer,                        -1,   false},
+{tag::EncodedUnderlyingIssuerLen,              -1,   false},
+{tag::EncodedUnderlyingIssuer,                 -1,   false},
+{tag::UnderlyingFinancialInstrumentShortName,  -1,   false},
+{tag::UnderlyingFinancialInstrumentFullName,   -1,   false},
+{tag::EncodedUnderlyingFinancialInstrumentFullNameLen, -1,   false},
+{tag::EncodedUnderlyingFinancialInstrumentFullName, -1,   false},
+{tag::UnderlyingIndexCurveUnit,                -1,   false},
+{tag::UnderlyingIndexCurvePeriod,              -1,   false},
+{tag::UnderlyingSecurityDesc,                  -1,   false},
+{tag::EncodedUnderlyingSecurityDescLen,        -1,   false},
+{tag::EncodedUnderlyingSecurityDesc,           -1,   false},
+{tag::UnderlyingCPProgram,                     -1,   false},
+{tag::UnderlyingCPRegType,                     -1,   false},
+{tag::UnderlyingAllocationPercent,             -1,   false},
+{tag::UnderlyingCurrency,                      -1,   false},
+{tag::UnderlyingQty,                           -1,   false},
+{tag::UnderlyingSettlementType,                -1,   false},
+{tag::UnderlyingCashAmount,                    -1,   false},
+{tag::UnderlyingCashType,                      -1,   false},
+{tag::UnderlyingPx,                            -1,   false},
+{tag::UnderlyingDirtyPrice,                    -1,   false},
+{tag::UnderlyingEndPrice,                      -1,   false},
+{tag::UnderlyingStartValue,                    -1,   false},
+{tag::UnderlyingCurrentValue,                  -1,   false},
+{tag::UnderlyingEndValue,                      -1,   false},
+{tag::NoUnderlyingStips,                       21,   false}, // UnderlyingStipulations
+{tag::UnderlyingAdjustedQuantity,              -1,   false},
+{tag::UnderlyingFXRate,                        -1,   false},
+{tag::UnderlyingFXRateCalc,                    -1,   false},
+{tag::UnderlyingCapValue,                      -1,   false},
+{tag::NoUndlyInstrumentParties,                113,  false}, // UndlyInstrumentParties
+{tag::UnderlyingSettlMethod,                   -1,   false},
+{tag::UnderlyingPutOrCall,                     -1,   false},
+{tag::UnderlyingInTheMoneyCondition,           -1,   false},
+{tag::UnderlyingContraryInstructionEligibilityIndicator, -1,   false},
+{tag::UnderlyingConstituentWeight,             -1,   false},
+{tag::UnderlyingCouponType,                    -1,   false},
+{tag::UnderlyingTotalIssuedAmount,             -1,   false},
+{tag::UnderlyingCouponFrequencyPeriod,         -1,   false},
+{tag::UnderlyingCouponFrequencyUnit,           -1,   false},
+{tag::UnderlyingCouponDayCount,                -1,   false},
+{tag::UnderlyingObligationID,                  -1,   false},
+{tag::UnderlyingObligationIDSource,            -1,   false},
+{tag::UnderlyingEquityID,                      -1,   false},
+{tag::UnderlyingEquityIDSource,                -1,   false},
+{tag::UnderlyingFutureID,                      -1,   false},
+{tag::UnderlyingFutureIDSource,                -1,   false},
+{tag::NoUnderlyingEvents,                      317,  false}, // UnderlyingEvntGrp
+{tag::UnderlyingLienSeniority,                 -1,   false},
+{tag::UnderlyingLoanFacility,                  -1,   false},
+{tag::UnderlyingReferenceEntityType,           -1,   false},
+{tag::UnderlyingIndexSeries,                   -1,   false},
+{tag::UnderlyingIndexAnnexVersion,             -1,   false},
+{tag::UnderlyingIndexAnnexDate,                -1,   false},
+{tag::UnderlyingIndexAnnexSource,              -1,   false},
+{tag::UnderlyingSettlRateIndex,                -1,   false},
+{tag::UnderlyingSettlRateIndexLocation,        -1,   false},
+{tag::UnderlyingOptionExpirationDesc,          -1,   false},
+{tag::EncodedUnderlyingOptionExpirationDescLen, -1,   false},
+{tag::EncodedUnderlyingOptionExpirationDesc,   -1,   false},
+{tag::UnderlyingProductComplex,                -1,   false},
+{tag::UnderlyingSecurityGroup,                 -1,   false},
+{tag::UnderlyingSettleOnOpenFlag,              -1,   false},
+{tag::UnderlyingAssignmentMethod,              -1,   false},
+{tag::UnderlyingSecurityStatus,                -1,   false},
+{tag::UnderlyingObligationType,                -1,   false},
+{tag::UnderlyingAssetGroup,                    -1,   false},
+{tag::UnderlyingAssetClass,                    -1,   false},
+{tag::UnderlyingAssetSubClass,                 -1,   false},
+{tag::UnderlyingAssetType,                     -1,   false},
+{tag::UnderlyingAssetSubType,                  -1,   false},
+{tag::NoUnderlyingSecondaryAssetClasses,       328,  false}, // UnderlyingSecondaryAssetGrp
+{tag::NoUnderlyingAssetAttributes,             503,  false}, // UnderlyingAssetAttributeGrp
+{tag::UnderlyingSwapClass,                     -1,   false},
+{tag::UnderlyingSwapSubClass,                  -1,   false},
+{tag::UnderlyingNthToDefault,                  -1,   false},
+{tag::UnderlyingMthToDefault,                  -1,   false},
+{tag::UnderlyingSettledEntityMatrixSource,     -1,   false},
+{tag::UnderlyingSettledEntityMatrixPublicationDate, -1,   false},
+{tag::UnderlyingStrikeMultiplier,              -1,   false},
+{tag::UnderlyingStrikeValue,                   -1,   false},
+{tag::UnderlyingStrikeUnitOfMeasure,           -1,   false},
+{tag::UnderlyingStrikeIndexCurvePoint,         -1,   false},
+{tag::UnderlyingStrikeIndex,                   -1,   false},
+{tag::UnderlyingStrikeIndexQuote,              -1,   false},
+{tag::UnderlyingStrikeIndexSpread,             -1,   false},
+{tag::UnderlyingStrikePriceDeterminationMethod, -1,   false},
+{tag::UnderlyingStrikePriceBoundaryMethod,     -1,   false},
+{tag::UnderlyingStrikePriceBoundaryPrecision,  -1,   false},
+{tag::UnderlyingMinPriceIncrement,             -1,   false},
+{tag::UnderlyingMinPriceIncrementAmount,       -1,   false},
+{tag::UnderlyingOptPayoutType,                 -1,   false},
+{tag::UnderlyingOptPayoutAmount,               -1,   false},
+{tag::UnderlyingReturnTrigger,                 -1,   false},
+{tag::UnderlyingPriceQuoteMethod,              -1,   false},
+{tag::UnderlyingValuationMethod,               -1,   false},
+{tag::UnderlyingValuationSource,               -1,   false},
+{tag::UnderlyingValuationReferenceModel,       -1,   false},
+{tag::UnderlyingListMethod,                    -1,   false},
+{tag::UnderlyingCapPrice,                      -1,   false},
+{tag::UnderlyingFloorPrice,                    -1,   false},
+{tag::UnderlyingFlexibleIndicator,             -1,   false},
+{tag::UnderlyingFlexProductEligibilityIndicator, -1,   false},
+{tag::UnderlyingPositionLimit,                 -1,   false},
+{tag::UnderlyingNTPositionLimit,               -1,   false},
+{tag::UnderlyingPool,                          -1,   false},
+{tag::UnderlyingContractSettlMonth,            -1,   false},
+{tag::UnderlyingDatedDate,                     -1,   false},
+{tag::UnderlyingInterestAccrualDate,           -1,   false},
+{tag::UnderlyingShortSaleRestriction,          -1,   false},
+{tag::UnderlyingRefTickTableID,                -1,   false},
+{tag::UnderlyingProtectionTermXIDRef,          -1,   false},
+{tag::UnderlyingSettlTermXIDRef,               -1,   false},
+{tag::NoUnderlyingComplexEvents,               314,  false}, // UnderlyingComplexEvents
+{tag::UnderlyingStrategyType,                  -1,   false},
+{tag::UnderlyingCommonPricingIndicator,        -1,   false},
+{tag::UnderlyingSettlDisruptionProvision,      -1,   false},
+{tag::UnderlyingDeliveryRouteOrCharter,        -1,   false},
+{tag::UnderlyingInstrumentRoundingDirection,   -1,   false},
+{tag::UnderlyingInstrumentRoundingPrecision,   -1,   false},
+{0,                                            376,  false}, // UnderlyingDateAdjustment
+{0,                                            538,  false}, // UnderlyingPricingDateTime
+{0,                                            528,  false}, // UnderlyingMarketDisruption
+{0,                                            521,  false}, // UnderlyingOptionExercise
+{tag::NoUnderlyingStreams,                     332,  false}, // UnderlyingStreamGrp
+{tag::NoUnderlyingProvisions,                  567,  false}, // UnderlyingProvisionGrp
+{tag::NoUnderlyingAdditionalTerms,             549,  false}, // UnderlyingAdditionalTermGrp
+{tag::NoUnderlyingProtectionTerms,             554,  false}, // UnderlyingProtectionTermGrp
+{tag::NoUnderlyingCashSettlTerms,              551,  false}, // UnderlyingCashSettlTermGrp
+{tag::NoUnderlyingPhysicalSettlTerms,          552,  false}, // UnderlyingPhysicalSettlTermGrp
+{0,                                            697,  false}, // UnderlyingRateSpreadSchedule
+{0,                                            677,  false}, // UnderlyingDividendPayout
+{tag::NoUnderlyingExtraordinaryEvents,         680,  false}, // UnderlyingExtraordinaryEventGrp
+{tag::UnderlyingExtraordinaryEventAdjustmentMethod, -1,   false},
+{tag::UnderlyingExchangeLookAlike,             -1,   false},
+{tag::UnderlyingAverageVolumeLimitationPercentage, -1,   false},
+{tag::UnderlyingAverageVolumeLimitationPeriodDays, -1,   false},
+{tag::UnderlyingDepositoryReceiptIndicator,    -1,   false},
+{tag::UnderlyingOpenUnits,                     -1,   false},
+{tag::UnderlyingBasketDivisor,                 -1,   false},
+{tag::UnderlyingInstrumentXID,                 -1,   false},
+{tag::YieldType,                               -1,   false},
+{tag::Yield,                                   -1,   false},
+{tag::YieldCalcDate,                           -1,   false},
+{tag::YieldRedemptionDate,                     -1,   false},
+{tag::YieldRedemptionPrice,                    -1,   false},
+{tag::YieldRedemptionPriceType,                -1,   false},
+{tag::UnderlyingStipType,                      -1,   false},
+{tag::UnderlyingStipValue,                     -1,   false},
+{tag::BeginString,                             -1,   true},
+{tag::BodyLength,                              -1,   true},
+{tag::MsgType,                                 -1,   true},
+{tag::ApplVerID,                               -1,   false},
+{tag::ApplExtID,                               -1,   false},
+{tag::CstmApplVerID,                           -1,   false},
+{tag::SenderCompID,                            -1,   true},
+{tag::TargetCompID,                            -1,   true},
+{tag::OnBehalfOfCompID,                        -1,   false},
+{tag::DeliverToCompID,                         -1,   false},
+{tag::SecureDataLen,                           -1,   false},
+{tag::SecureData,                              -1,   false},
+{tag::MsgSeqNum,                               -1,   true},
+{tag::SenderSubID,                             -1,   false},
+{tag::SenderLocationID,                        -1,   false},
+{tag::TargetSubID,                             -1,   false},
+{tag::TargetLocationID,                        -1,   false},
+{tag::OnBehalfOfSubID,                         -1,   false},
+{tag::OnBehalfOfLocationID,                    -1,   false},
+{tag::DeliverToSubID,                          -1,   false},
+{tag::DeliverToLocationID,                     -1,   false},
+{tag::PossDupFlag,                             -1,   false},
+{tag::PossResend,                              -1,   false},
+{tag::SendingTime,                             -1,   true},
+{tag::OrigSendingTime,                         -1,   false},
+{tag::XmlDataLen,                              -1,   false},
+{tag::XmlData,                                 -1,   false},
+{tag::MessageEncoding,                         -1,   false},
+{tag::LastMsgSeqNumProcessed,                  -1,   false},
+{tag::NoHops,                                  101,  false}, // HopGrp
+{tag::SignatureLength,                         -1,   false},
+{tag::Signature,                               -1,   false},
+{tag::CheckSum,                                -1,   true},
+{tag::Nested2PartyID,                          -1,   false},
+{tag::Nested2PartyIDSource,                    -1,   false},
+{tag::Nested2PartyRole,                        -1,   false},
+{tag::Nested2PartyRoleQualifier,               -1,   false},
+{tag::NoNested2PartySubIDs,                    102,  false}, // NstdPtys2SubGrp
+{tag::Nested3PartyID,                          -1,   false},
+{tag::Nested3PartyIDSource,                    -1,   false},
+{tag::Nested3PartyRole,                        -1,   false},
+{tag::Nested3PartyRoleQualifier,               -1,   false},
+{tag::NoNested3PartySubIDs,                    103,  false}, // NstdPtys3SubGrp
+{tag::AffectedOrigClOrdID,                     -1,   false},
+{tag::AffectedOrderID,                         -1,   false},
+{tag::AffectedSecondaryOrderID,                -1,   false},
+{tag::AllocAccount,                            -1,   false},
+{tag::AllocAcctIDSource,                       -1,   false},
+{tag::AllocPrice,                              -1,   false},
+{tag::AllocPositionEffect,                     -1,   false},
+{tag::IndividualAllocID,                       -1,   false},
+{tag::ParentAllocID,                           -1,   false},
+{tag::FirmMnemonic,                            -1,   false},
+{tag::ClearedIndicator,                        -1,   false},
+{tag::AllocLegRefID,                           -1,   false},
+{tag::NoAllocRegulatoryTradeIDs,               244,  false}, // AllocRegulatoryTradeIDGrp
+{tag::IndividualAllocRejCode,                  -1,   false},
+{tag::NoNestedPartyIDs,                        8,    false}, // NestedParties
+{tag::AllocText,                               -1,   false},
+{tag::EncodedAllocTextLen,                     -1,   false},
+{tag::EncodedAllocText,                        -1,   false},
+{tag::FirmAllocText,                           -1,   false},
+{tag::EncodedFirmAllocTextLen,                 -1,   false},
+{tag::EncodedFirmAllocText,                    -1,   false},
+{tag::SecondaryIndividualAllocID,              -1,   false},
+{tag::AllocCustomerCapacity,                   -1,   false},
+{tag::IndividualAllocType,                     -1,   false},
+{tag::AllocQty,                                -1,   false},
+{tag::AllocCalculatedCcyQty,                   -1,   false},
+{tag::CustodialLotID,                          -1,   false},
+{tag::VersusPurchaseDate,                      -1,   false},
+{tag::VersusPurchasePrice,                     -1,   false},
+{tag::CurrentCostBasis,                        -1,   false},
+{tag::AllocAccount,                            -1,   false},
+{tag::AllocAcctIDSource,                       -1,   false},
+{tag::MatchStatus,                             -1,   false},
+{tag::AllocPrice,                              -1,   false},
+{tag::AllocQty,                                -1,   false},
+{tag::AllocCalculatedCcyQty,                   -1,   false},
+{tag::CustodialLotID,                          -1,   false},
+{tag::VersusPurchaseDate,                      -1,   false},
+{tag::VersusPurchasePrice,                     -1,   false},
+{tag::CurrentCostBasis,                        -1,   false},
+{tag::IndividualAllocID,                       -1,   false},
+{tag::FirmMnemonic,                            -1,   false},
+{tag::ParentAllocID,                           -1,   false},
+{tag::AllocLegRefID,                           -1,   false},
+{tag::NoAllocRegulatoryTradeIDs,               244,  false}, // AllocRegulatoryTradeIDGrp
+{tag::ProcessCode,                             -1,   false},
+{tag::SecondaryIndividualAllocID,              -1,   false},
+{tag::AllocMethod,                             -1,   false},
+{tag::AllocationRollupInstruction,             -1,   false},
+{tag::AllocCustomerCapacity,                   -1,   false},
+{tag::AllocPositionEffect,                     -1,   false},
+{tag::IndividualAllocType,                     -1,   false},
+{tag::NoNestedPartyIDs,                        8,    false}, // NestedParties
+{tag::NotifyBrokerOfCredit,                    -1,   false},
+{tag::AllocHandlInst,                          -1,   false},
+{tag::AllocText,                               -1,   false},
+{tag::EncodedAllocTextLen,                     -1,   false},
+{tag::EncodedAllocText,                        -1,   false},
+{tag::FirmAllocText,                           -1,   false},
+{tag::EncodedFirmAllocTextLen,                 -1,   false},
+{tag::EncodedFirmAllocText,                    -1,   false},
+{0,                                            0,    false}, // CommissionData
+{tag::NoAllocCommissions,                      595,  false}, // AllocCommissionDataGrp
+{tag::AllocAvgPx,                              -1,   false},
+{tag::AllocNetMoney,                           -1,   false},
+{tag::SettlCurrAmt,                            -1,   false},
+{tag::AllocGrossTradeAmt,                      -1,   false},
+{tag::AllocSettlCurrAmt,                       -1,   false},
+{tag::SettlCurrency,                           -1,   false},
+{tag::AllocSettlCurrency,                      -1,   false},
+{tag::SettlCurrFxRate,                         -1,   false},
+{tag::SettlCurrFxRateCalc,                     -1,   false},
+{tag::AllocAccruedInterestAmt,                 -1,   false},
+{tag::AllocInterestAtMaturity,                 -1,   false},
+{tag::NoMiscFees,                              59,   false}, // MiscFeesGrp
+{tag::NoClearingInstructions,                  32,   false}, // ClrInstGrp
+{tag::ClearingFeeIndicator,                    -1,   false},
+{tag::AllocSettlInstType,                      -1,   false},
+{0,                                            14,   false}, // SettlInstructionsData
+{tag::AllocRefRiskLimitCheckID,                -1,   false},
+{tag::AllocRefRiskLimitCheckIDType,            -1,   false},
+{tag::AllocRiskLimitCheckStatus,               -1,   false},
+{tag::AllocGroupAmount,                        -1,   false},
+{tag::NoTradeAllocAmts,                        224,  false}, // TradeAllocAmtGrp
+{tag::ListID,                                  -1,   false},
+{tag::Side,                                    -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::NetGrossInd,                             -1,   false},
+{tag::SettlType,                               -1,   false},
+{tag::SettlDate,                               -1,   false},
+{tag::Account,                                 -1,   false},
+{tag::AcctIDSource,                            -1,   false},
+{0,                                            0,    true}, // CommissionData
+{tag::ListID,                                  -1,   false},
+{tag::Country,                                 -1,   false},
+{tag::Side,                                    -1,   false},
+{tag::Price,                                   -1,   false},
+{tag::PriceType,                               -1,   false},
+{tag::FairValue,                               -1,   false},
+{tag::NetGrossInd,                             -1,   false},
+{tag::SettlType,                               -1,   false},
+{tag::SettlDate,                               -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::BidDescriptorType,                       -1,   false},
+{tag::BidDescriptor,                           -1,   false},
+{tag::SideValueInd,                            -1,   false},
+{tag::LiquidityValue,                          -1,   false},
+{tag::LiquidityNumSecurities,                  -1,   false},
+{tag::LiquidityPctLow,                         -1,   false},
+{tag::LiquidityPctHigh,                        -1,   false},
+{tag::EFPTrackingError,                        -1,   false},
+{tag::FairValue,                               -1,   false},
+{tag::OutsideIndexPct,                         -1,   false},
+{tag::ValueOfFutures,                          -1,   false},
+{tag::ClearingInstruction,                     -1,   false},
+{tag::CollInquiryQualifier,                    -1,   false},
+{tag::RefCompID,                               -1,   false},
+{tag::RefSubID,                                -1,   false},
+{tag::LocationID,                              -1,   false},
+{tag::DeskID,                                  -1,   false},
+{tag::RefCompID,                               -1,   true},
+{tag::RefSubID,                                -1,   false},
+{tag::LocationID,                              -1,   false},
+{tag::DeskID,                                  -1,   false},
+{tag::StatusValue,                             -1,   true},
+{tag::StatusText,                              -1,   false},
+{tag::ContAmtType,                             -1,   false},
+{tag::ContAmtValue,                            -1,   false},
+{tag::ContAmtCurr,                             -1,   false},
+{tag::ContraBroker,                            -1,   false},
+{tag::ContraTrader,                            -1,   false},
+{tag::ContraTradeQty,                          -1,   false},
+{tag::ContraTradeTime,                         -1,   false},
+{tag::ContraLegRefID,                          -1,   false},
+{tag::OrderCapacity,                           -1,   true},
+{tag::OrderRestrictions,                       -1,   false},
+{tag::OrderCapacityQty,                        -1,   false},
+{tag::LastQty,                                 -1,   false},
+{tag::ExecID,                                  -1,   false},
+{tag::SecondaryExecID,                         -1,   false},
+{tag::LastPx,                                  -1,   false},
+{tag::LastParPx,                               -1,   false},
+{tag::LastCapacity,                            -1,   false},
+{tag::TradeID,                                 -1,   false},
+{tag::FirmTradeID,                             -1,   false},
+{tag::ExecutionTimestamp,                      -1,   false},
+{tag::TradeReportingIndicator,                 -1,   false},
+{tag::NoTrdRegPublications,                    708,  false}, // TrdRegPublicationGrp
+{tag::NoTradePriceConditions,                  225,  false}, // TradePriceConditionGrp
+{tag::ExecID,                                  -1,   false},
+{0,                                            3,    false}, // Instrument
+{0,                                            4,    false}, // InstrumentExtension
+{0,                                            2,    false}, // FinancingDetails
+{tag::NoRelatedInstruments,                    180,  false}, // RelatedInstrumentGrp
+{0,                                            5,    false}, // InstrumentLeg
+{tag::LegOrderQty,                             -1,   false},
+{tag::LegQty,                                  -1,   false},
+{tag::LegMidPx,                                -1,   false},
+{tag::LegSwapType,                             -1,   false},
+{tag::NoLegStipulations,                       7,    false}, // LegStipulations
+{tag::LegAllocID,                              -1,   false},
+{tag::NoLegAllocs,                             50,   false}, // LegPreAllocGrp
+{tag::LegAccount,                              -1,   false},
+{tag::LegClearingAccountType,                  -1,   false},
+{tag::LegPositionEffect,                       -1,   false},
+{tag::LegCoveredOrUncovered,                   -1,   false},
+{tag::NoNested3PartyIDs,                       25,   false}, // NestedParties3
+{tag::LegRefID,                                -1,   false},
+{tag::LegSettlType,                            -1,   false},
+{tag::LegSettlDate,                            -1,   false},
+{tag::LegLastPx,                               -1,   false},
+{tag::LegSettlCurrency,                        -1,   false},
+{tag::LegLastForwardPoints,                    -1,   false},
+{tag::LegCalculatedCcyLastQty,                 -1,   false},
+{tag::LegGrossTradeAmt,                        -1,   false},
+{tag::LegShortSaleExemptionReason,             -1,   false},
+{tag::LegVolatility,                           -1,   false},
+{tag::LegDividendYield,                        -1,   false},
+{tag::LegCurrencyRatio,                        -1,   false},
+{tag::LegExecInst,                             -1,   false},
+{tag::LegLastQty,                              -1,   false},
+{tag::FillRefID,                               -1,   false},
+{0,                                            5,    false}, // InstrumentLeg
+{0,                                            582,  false}, // LegFinancingDetails
+{0,                                            5,    false}, // InstrumentLeg
+{tag::LegIOIQty,                               -1,   false},
+{tag::NoLegStipulations,                       7,    false}, // LegStipulations
+{0,                                            5,    false}, // InstrumentLeg
+{tag::LegSwapType,                             -1,   false},
+{tag::LegSettlType,                            -1,   false},
+{tag::NoLegStipulations,                       7,    false}, // LegStipulations
+{0,                                            6,    false}, // LegBenchmarkCurveData
+{0,                                            3,    true}, // Instrument
+{0,                                            4,    false}, // InstrumentExtension
+{0,                                            2,    false}, // FinancingDetails
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::NoRelatedInstruments,                    180,  false}, // RelatedInstrumentGrp
+{0,                                            16,   false}, // SpreadOrBenchmarkCurveData
+{tag::Currency,                                -1,   false},
+{tag::QuoteType,                               -1,   false},
+{tag::SettlType,                               -1,   false},
+{tag::SettlDate,                               -1,   false},
+{tag::MDEntrySize,                             -1,   false},
+{tag::MDStreamID,                              -1,   false},
+{0,                                            3,    true}, // Instrument
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::PrevClosePx,                             -1,   false},
+{tag::ClOrdID,                                 -1,   false},
+{tag::SecondaryClOrdID,                        -1,   false},
+{tag::Side,                                    -1,   false},
+{tag::Price,                                   -1,   false},
+{tag::Currency,                                -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::IOIQualifier,                            -1,   false},
+{0,                                            5,    false}, // InstrumentLeg
+{tag::LegOrderQty,                             -1,   false},
+{tag::LegQty,                                  -1,   false},
+{tag::LegSwapType,                             -1,   false},
+{tag::NoLegStipulations,                       7,    false}, // LegStipulations
+{tag::LegAllocID,                              -1,   false},
+{tag::NoLegAllocs,                             50,   false}, // LegPreAllocGrp
+{tag::LegAccount,                              -1,   false},
+{tag::LegClearingAccountType,                  -1,   false},
+{tag::LegPositionEffect,                       -1,   false},
+{tag::LegCoveredOrUncovered,                   -1,   false},
+{tag::NoNestedPartyIDs,                        8,    false}, // NestedParties
+{tag::LegRefID,                                -1,   false},
+{tag::LegSettlType,                            -1,   false},
+{tag::LegSettlDate,                            -1,   false},
+{tag::LegSettlCurrency,                        -1,   false},
+{tag::LegVolatility,                           -1,   false},
+{tag::LegDividendYield,                        -1,   false},
+{tag::LegCurrencyRatio,                        -1,   false},
+{tag::LegExecInst,                             -1,   false},
+{tag::LegShortSaleExemptionReason,             -1,   false},
+{tag::LegAllocAccount,                         -1,   false},
+{tag::LegIndividualAllocID,                    -1,   false},
+{tag::NoNested2PartyIDs,                       24,   false}, // NestedParties2
+{tag::LegAllocQty,                             -1,   false},
+{tag::LegAllocAcctIDSource,                    -1,   false},
+{tag::LegAllocSettlCurrency,                   -1,   false},
+{tag::LegCustodialLotID,                       -1,   false},
+{tag::LegVersusPurchaseDate,                   -1,   false},
+{tag::LegVersusPurchasePrice,                  -1,   false},
+{tag::LegCurrentCostBasis,                     -1,   false},
+{0,                                            5,    false}, // InstrumentLeg
+{tag::LegOrderQty,                             -1,   false},
+{tag::LegQty,                                  -1,   false},
+{tag::LegMidPx,                                -1,   false},
+{tag::LegSwapType,                             -1,   false},
+{tag::LegSettlType,                            -1,   false},
+{tag::LegSettlDate,                            -1,   false},
+{tag::NoLegStipulations,                       7,    false}, // LegStipulations
+{tag::NoNestedPartyIDs,                        8,    false}, // NestedParties
+{tag::LegPriceType,                            -1,   false},
+{tag::LegBidPx,                                -1,   false},
+{tag::LegOfferPx,                              -1,   false},
+{0,                                            6,    false}, // LegBenchmarkCurveData
+{tag::LegRefID,                                -1,   false},
+{tag::LegBidForwardPoints,                     -1,   false},
+{tag::LegOfferForwardPoints,                   -1,   false},
+{0,                                            5,    false}, // InstrumentLeg
+{tag::LegOrderQty,                             -1,   false},
+{tag::LegQty,                                  -1,   false},
+{tag::LegMidPx,                                -1,   false},
+{tag::LegSwapType,                             -1,   false},
+{tag::LegSettlType,                            -1,   false},
+{tag::LegSettlDate,                            -1,   false},
+{tag::NoLegStipulations,                       7,    false}, // LegStipulations
+{tag::NoNestedPartyIDs,                        8,    false}, // NestedParties
+{tag::Text,                                    -1,   true},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::ClOrdID,                                 -1,   true},
+{tag::SecondaryClOrdID,                        -1,   false},
+{tag::ListSeqNo,                               -1,   true},
+{tag::ClOrdLinkID,                             -1,   false},
+{tag::SettlInstMode,                           -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::TradeOriginationDate,                    -1,   false},
+{tag::TradeDate,                               -1,   false},
+{tag::Account,                                 -1,   false},
+{tag::AcctIDSource,                            -1,   false},
+{tag::AccountType,                             -1,   false},
+{tag::DayBookingInst,                          -1,   false},
+{tag::BookingUnit,                             -1,   false},
+{tag::AllocID,                                 -1,   false},
+{tag::PreallocMethod,                          -1,   false},
+{tag::NoAllocs,                                63,   false}, // PreAllocGrp
+{tag::SettlType,                               -1,   false},
+{tag::SettlDate,                               -1,   false},
+{tag::CashMargin,                              -1,   false},
+{tag::ClearingFeeIndicator,                    -1,   false},
+{tag::HandlInst,                               -1,   false},
+{tag::ExecInst,                                -1,   false},
+{tag::MinQty,                                  -1,   false},
+{tag::MatchIncrement,                          -1,   false},
+{tag::MaxPriceLevels,                          -1,   false},
+{0,                                            115,  false}, // DisplayInstruction
+{tag::MaxFloor,                                -1,   false},
+{tag::ExDestination,                           -1,   false},
+{tag::ExDestinationIDSource,                   -1,   false},
+{tag::NoTradingSessions,                       88,   false}, // TrdgSesGrp
+{tag::ProcessCode,                             -1,   false},
+{0,                                            3,    true}, // Instrument
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::PrevClosePx,                             -1,   false},
+{tag::Side,                                    -1,   true},
+{tag::ShortMarkingExemptIndicator,             -1,   false},
+{tag::ShortSaleExemptionReason,                -1,   false},
+{tag::SideValueInd,                            -1,   false},
+{tag::LocateReqd,                              -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::NoStipulations,                          17,   false}, // Stipulations
+{tag::QtyType,                                 -1,   false},
+{0,                                            9,    true}, // OrderQtyData
+{tag::OrdType,                                 -1,   false},
+{tag::PriceType,                               -1,   false},
+{tag::Price,                                   -1,   false},
+{tag::PriceProtectionScope,                    -1,   false},
+{tag::StopPx,                                  -1,   false},
+{0,                                            116,  false}, // TriggeringInstruction
+{0,                                            16,   false}, // SpreadOrBenchmarkCurveData
+{0,                                            20,   false}, // YieldData
+{tag::Currency,                                -1,   false},
+{tag::ComplianceID,                            -1,   false},
+{tag::ComplianceText,                          -1,   false},
+{tag::EncodedComplianceTextLen,                -1,   false},
+{tag::EncodedComplianceText,                   -1,   false},
+{tag::SolicitedFlag,                           -1,   false},
+{tag::IOIID,                                   -1,   false},
+{tag::QuoteID,                                 -1,   false},
+{tag::RefOrderID,                              -1,   false},
+{tag::RefOrderIDSource,                        -1,   false},
+{tag::TimeInForce,                             -1,   false},
+{tag::EffectiveTime,                           -1,   false},
+{tag::ExpireDate,                              -1,   false},
+{tag::ExpireTime,                              -1,   false},
+{tag::GTBookingInst,                           -1,   false},
+{tag::ExposureDuration,                        -1,   false},
+{tag::ExposureDurationUnit,                    -1,   false},
+{0,                                            0,    false}, // CommissionData
+{tag::NoCommissions,                           594,  false}, // CommissionDataGrp
+{tag::OrderCapacity,                           -1,   false},
+{tag::OrderRestrictions,                       -1,   false},
+{tag::PreTradeAnonymity,                       -1,   false},
+{tag::CustOrderCapacity,                       -1,   false},
+{tag::NoOrderAttributes,                       709,  false}, // OrderAttributeGrp
+{tag::ForexReq,                                -1,   false},
+{tag::SettlCurrency,                           -1,   false},
+{tag::BookingType,                             -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::SettlDate2,                              -1,   false},
+{tag::OrderQty2,                               -1,   false},
+{tag::Price2,                                  -1,   false},
+{tag::PositionEffect,                          -1,   false},
+{tag::CoveredOrUncovered,                      -1,   false},
+{tag::MaxShow,                                 -1,   false},
+{0,                                            11,   false}, // PegInstructions
+{0,                                            1,    false}, // DiscretionInstructions
+{tag::TargetStrategy,                          -1,   false},
+{tag::NoStrategyParameters,                    104,  false}, // StrategyParametersGrp
+{tag::TargetStrategyParameters,                -1,   false},
+{tag::ParticipationRate,                       -1,   false},
+{tag::Designation,                             -1,   false},
+{tag::ManualOrderIndicator,                    -1,   false},
+{tag::MDEntryType,                             -1,   true},
+{tag::MDEntryID,                               -1,   false},
+{tag::MDEntryPx,                               -1,   false},
+{tag::PriceType,                               -1,   false},
+{tag::NoPriceQualifiers,                       712,  false}, // PriceQualifierGrp
+{tag::AvgPxIndicator,                          -1,   false},
+{0,                                            20,   false}, // YieldData
+{0,                                            16,   false}, // SpreadOrBenchmarkCurveData
+{tag::OrdType,                                 -1,   false},
+{tag::Currency,                                -1,   false},
+{tag::SettlCurrency,                           -1,   false},
+{tag::NoRateSources,                           166,  false}, // RateSource
+{tag::MDEntrySize,                             -1,   false},
+{tag::NoOfSecSizes,                            124,  false}, // SecSizesGrp
+{tag::LotType,                                 -1,   false},
+{tag::MDEntryDate,                             -1,   false},
+{tag::MDEntryTime,                             -1,   false},
+{tag::TickDirection,                           -1,   false},
+{tag::MDMkt,                                   -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::SecurityTradingStatus,                   -1,   false},
+{tag::HaltReason,                              -1,   false},
+{tag::FastMarketIndicator,                     -1,   false},
+{tag::MarketCondition,                         -1,   false},
+{tag::QuoteCondition,                          -1,   false},
+{tag::TradeCondition,                          -1,   false},
+{tag::NoTradePriceConditions,                  225,  false}, // TradePriceConditionGrp
+{tag::AlgorithmicTradeIndicator,               -1,   false},
+{tag::MDEntryOriginator,                       -1,   false},
+{tag::LocationID,                              -1,   false},
+{tag::DeskID,                                  -1,   false},
+{tag::OpenCloseSettlFlag,                      -1,   false},
+{tag::TimeInForce,                             -1,   false},
+{tag::ExpireDate,                              -1,   false},
+{tag::ExpireTime,                              -1,   false},
+{tag::ExposureDuration,                        -1,   false},
+{tag::ExposureDurationUnit,                    -1,   false},
+{tag::MinQty,                                  -1,   false},
+{tag::ExecInst,                                -1,   false},
+{tag::SellerDays,                              -1,   false},
+{tag::OrderID,                                 -1,   false},
+{tag::SecondaryOrderID,                        -1,   false},
+{tag::QuoteEntryID,                            -1,   false},
+{tag::TradeID,                                 -1,   false},
+{tag::StrategyLinkID,                          -1,   false},
+{tag::MDEntryBuyer,                            -1,   false},
+{tag::MDEntrySeller,                           -1,   false},
+{tag::NumberOfBuyOrders,                       -1,   false},
+{tag::NumberOfSellOrders,                      -1,   false},
+{tag::NumberOfOrders,                          -1,   false},
+{tag::MDEntryPositionNo,                       -1,   false},
+{tag::Scope,                                   -1,   false},
+{tag::PriceDelta,                              -1,   false},
+{tag::TrdType,                                 -1,   false},
+{tag::TrdSubType,                              -1,   false},
+{tag::RegulatoryReportType,                    -1,   false},
+{tag::ExecMethod,                              -1,   false},
+{tag::MatchType,                               -1,   false},
+{tag::OrderCategory,                           -1,   false},
+{tag::TradePublishIndicator,                   -1,   false},
+{tag::NoTrdRegPublications,                    708,  false}, // TrdRegPublicationGrp
+{tag::PreviouslyReported,                      -1,   false},
+{tag::NoRelatedTrades,                         228,  false}, // RelatedTradeGrp
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::MDPriceLevel,                            -1,   false},
+{tag::OrderCapacity,                           -1,   false},
+{tag::MDOriginType,                            -1,   false},
+{tag::HighPx,                                  -1,   false},
+{tag::LowPx,                                   -1,   false},
+{tag::FirstPx,                                 -1,   false},
+{tag::LastPx,                                  -1,   false},
+{tag::DiscountFactor,                          -1,   false},
+{tag::TradeVolume,                             -1,   false},
+{tag::SettlPriceType,                          -1,   false},
+{tag::SettlPriceDeterminationMethod,           -1,   false},
+{tag::SettlType,                               -1,   false},
+{tag::SettlDate,                               -1,   false},
+{tag::MDQuoteType,                             -1,   false},
+{tag::RptSeq,                                  -1,   false},
+{tag::DealingCapacity,                         -1,   false},
+{tag::MDEntrySpotRate,                         -1,   false},
+{tag::MDEntryForwardPoints,                    -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::AggressorTime,                           -1,   false},
+{tag::AggressorSide,                           -1,   false},
+{tag::LegRefID,                                -1,   false},
+{tag::MDUpdateAction,                          -1,   true},
+{tag::DeleteReason,                            -1,   false},
+{tag::MDSubBookType,                           -1,   false},
+{tag::MarketDepth,                             -1,   false},
+{tag::MDEntryType,                             -1,   false},
+{tag::MDEntryID,                               -1,   false},
+{tag::MDEntryRefID,                            -1,   false},
+{tag::MDStreamID,                              -1,   false},
+{0,                                            3,    false}, // Instrument
+{0,                                            4,    false}, // InstrumentExtension
+{0,                                            2,    false}, // FinancingDetails
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::NoRelatedInstruments,                    180,  false}, // RelatedInstrumentGrp
+{tag::FinancialStatus,                         -1,   false},
+{tag::CorporateAction,                         -1,   false},
+{tag::MDEntryPx,                               -1,   false},
+{tag::PriceType,                               -1,   false},
+{tag::NoPriceQualifiers,                       712,  false}, // PriceQualifierGrp
+{tag::AvgPxIndicator,                          -1,   false},
+{0,                                            20,   false}, // YieldData
+{0,                                            16,   false}, // SpreadOrBenchmarkCurveData
+{tag::OrdType,                                 -1,   false},
+{tag::Currency,                                -1,   false},
+{tag::SettlCurrency,                           -1,   false},
+{tag::NoRateSources,                           166,  false}, // RateSource
+{tag::MDEntrySize,                             -1,   false},
+{tag::NoOfSecSizes,                            124,  false}, // SecSizesGrp
+{tag::LotType,                                 -1,   false},
+{tag::MDEntryDate,                             -1,   false},
+{tag::MDEntryTime,                             -1,   false},
+{tag::TickDirection,                           -1,   false},
+{tag::MDMkt,                                   -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::SecurityTradingStatus,                   -1,   false},
+{tag::HaltReason,                              -1,   false},
+{tag::FastMarketIndicator,                     -1,   false},
+{tag::MarketCondition,                         -1,   false},
+{tag::QuoteCondition,                          -1,   false},
+{tag::TradeCondition,                          -1,   false},
+{tag::NoTradePriceConditions,                  225,  false}, // TradePriceConditionGrp
+{tag::AlgorithmicTradeIndicator,               -1,   false},
+{tag::RegulatoryReportType,                    -1,   false},
+{tag::TrdType,                                 -1,   false},
+{tag::TrdSubType,                              -1,   false},
+{tag::ExecMethod,                              -1,   false},
+{tag::MatchType,                               -1,   false},
+{tag::OrderCategory,                           -1,   false},
+{tag::TradePublishIndicator,                   -1,   false},
+{tag::NoTrdRegPublications,                    708,  false}, // TrdRegPublicationGrp
+{tag::PreviouslyReported,                      -1,   false},
+{tag::NoRelatedTrades,                         228,  false}, // RelatedTradeGrp
+{tag::MDEntryOriginator,                       -1,   false},
+{tag::LocationID,                              -1,   false},
+{tag::DeskID,                                  -1,   false},
+{tag::OpenCloseSettlFlag,                      -1,   false},
+{tag::TimeInForce,                             -1,   false},
+{tag::ExpireDate,                              -1,   false},
+{tag::ExpireTime,                              -1,   false},
+{tag::ExposureDuration,                        -1,   false},
+{tag::ExposureDurationUnit,                    -1,   false},
+{tag::MinQty,                                  -1,   false},
+{tag::ExecInst,                                -1,   false},
+{tag::SellerDays,                              -1,   false},
+{tag::OrderID,                                 -1,   false},
+{tag::SecondaryOrderID,                        -1,   false},
+{tag::QuoteEntryID,                            -1,   false},
+{tag::TradeID,                                 -1,   false},
+{tag::StrategyLinkID,                          -1,   false},
+{tag::MDEntryBuyer,                            -1,   false},
+{tag::MDEntrySeller,                           -1,   false},
+{tag::NumberOfBuyOrders,                       -1,   false},
+{tag::NumberOfSellOrders,                      -1,   false},
+{tag::NumberOfOrders,                          -1,   false},
+{tag::MDEntryPositionNo,                       -1,   false},
+{tag::Scope,                                   -1,   false},
+{tag::PriceDelta,                              -1,   false},
+{tag::NetChgPrevDay,                           -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::MDPriceLevel,                            -1,   false},
+{tag::OrderCapacity,                           -1,   false},
+{tag::MDOriginType,                            -1,   false},
+{tag::HighPx,                                  -1,   false},
+{tag::LowPx,                                   -1,   false},
+{tag::FirstPx,                                 -1,   false},
+{tag::LastPx,                                  -1,   false},
+{tag::DiscountFactor,                          -1,   false},
+{tag::TradeVolume,                             -1,   false},
+{tag::SettlPriceType,                          -1,   false},
+{tag::SettlPriceDeterminationMethod,           -1,   false},
+{tag::SettlType,                               -1,   false},
+{tag::SettlDate,                               -1,   false},
+{tag::TransBkdTime,                            -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::AggressorTime,                           -1,   false},
+{tag::AggressorSide,                           -1,   false},
+{tag::MDQuoteType,                             -1,   false},
+{tag::RptSeq,                                  -1,   false},
+{tag::DealingCapacity,                         -1,   false},
+{tag::MDEntrySpotRate,                         -1,   false},
+{tag::MDEntryForwardPoints,                    -1,   false},
+{tag::NoStatsIndicators,                       125,  false}, // StatsIndGrp
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::MDEntryType,                             -1,   true},
+{tag::AltMDSourceID,                           -1,   false},
+{tag::MiscFeeAmt,                              -1,   false},
+{tag::MiscFeeCurr,                             -1,   false},
+{tag::MiscFeeType,                             -1,   false},
+{tag::MiscFeeQualifier,                        -1,   false},
+{tag::NoMiscFeeSubTypes,                       593,  false}, // MiscFeesSubGrp
+{tag::MiscFeeBasis,                            -1,   false},
+{tag::MiscFeeRate,                             -1,   false},
+{tag::MiscFeeAmountDue,                        -1,   false},
+{tag::MiscFeeDesc,                             -1,   false},
+{tag::ClOrdID,                                 -1,   false},
+{tag::OrderID,                                 -1,   false},
+{tag::SecondaryOrderID,                        -1,   false},
+{tag::SecondaryClOrdID,                        -1,   false},
+{tag::ListID,                                  -1,   false},
+{tag::NoNested2PartyIDs,                       24,   false}, // NestedParties2
+{tag::OrderQty,                                -1,   false},
+{tag::OrderAvgPx,                              -1,   false},
+{tag::OrderBookingQty,                         -1,   false},
+{tag::OrdType,                                 -1,   false},
+{tag::ClOrdID,                                 -1,   false},
+{tag::OrderID,                                 -1,   false},
+{tag::SecondaryClOrdID,                        -1,   false},
+{tag::CumQty,                                  -1,   true},
+{tag::OrdStatus,                               -1,   true},
+{tag::WorkingIndicator,                        -1,   false},
+{tag::LeavesQty,                               -1,   true},
+{tag::CxlQty,                                  -1,   true},
+{tag::AvgPx,                                   -1,   true},
+{tag::OrdRejReason,                            -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{0,                                            19,   false}, // UnderlyingInstrument
+{tag::UnderlyingSettlPrice,                    -1,   false},
+{tag::UnderlyingSettlPriceType,                -1,   false},
+{tag::UnderlyingDeliveryAmount,                -1,   false},
+{tag::NoUnderlyingAmounts,                     107,  false}, // UnderlyingAmount
+{tag::AllocAccount,                            -1,   false},
+{tag::AllocAcctIDSource,                       -1,   false},
+{tag::AllocSettlCurrency,                      -1,   false},
+{tag::IndividualAllocID,                       -1,   false},
+{tag::AllocLegRefID,                           -1,   false},
+{tag::NoNestedPartyIDs,                        8,    false}, // NestedParties
+{tag::AllocQty,                                -1,   false},
+{tag::CustodialLotID,                          -1,   false},
+{tag::VersusPurchaseDate,                      -1,   false},
+{tag::VersusPurchasePrice,                     -1,   false},
+{tag::CurrentCostBasis,                        -1,   false},
+{tag::AllocAccount,                            -1,   false},
+{tag::AllocAcctIDSource,                       -1,   false},
+{tag::AllocSettlCurrency,                      -1,   false},
+{tag::IndividualAllocID,                       -1,   false},
+{tag::AllocLegRefID,                           -1,   false},
+{tag::NoNested3PartyIDs,                       25,   false}, // NestedParties3
+{tag::AllocQty,                                -1,   false},
+{tag::CustodialLotID,                          -1,   false},
+{tag::VersusPurchaseDate,                      -1,   false},
+{tag::VersusPurchasePrice,                     -1,   false},
+{tag::CurrentCostBasis,                        -1,   false},
+{0,                                            3,    false}, // Instrument
+{0,                                            2,    false}, // FinancingDetails
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::QuoteEntryID,                            -1,   false},
+{0,                                            3,    false}, // Instrument
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::BidPx,                                   -1,   false},
+{tag::OfferPx,                                 -1,   false},
+{tag::BidSize,                                 -1,   false},
+{tag::OfferSize,                               -1,   false},
+{tag::ValidUntilTime,                          -1,   false},
+{tag::BidSpotRate,                             -1,   false},
+{tag::OfferSpotRate,                           -1,   false},
+{tag::BidForwardPoints,                        -1,   false},
+{tag::OfferForwardPoints,                      -1,   false},
+{tag::MidPx,                                   -1,   false},
+{tag::BidYield,                                -1,   false},
+{tag::MidYield,                                -1,   false},
+{tag::OfferYield,                              -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::SettlDate,                               -1,   false},
+{tag::OrdType,                                 -1,   false},
+{tag::SettlDate2,                              -1,   false},
+{tag::OrderQty2,                               -1,   false},
+{tag::BidForwardPoints2,                       -1,   false},
+{tag::OfferForwardPoints2,                     -1,   false},
+{tag::Currency,                                -1,   false},
+{tag::BookingType,                             -1,   false},
+{tag::OrderCapacity,                           -1,   false},
+{tag::OrderRestrictions,                       -1,   false},
+{tag::QuoteEntryStatus,                        -1,   false},
+{tag::QuoteEntryRejectReason,                  -1,   false},
+{tag::QuoteEntryID,                            -1,   true},
+{0,                                            3,    false}, // Instrument
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::BidPx,                                   -1,   false},
+{tag::OfferPx,                                 -1,   false},
+{tag::TotalBidSize,                            -1,   false},
+{tag::TotalOfferSize,                          -1,   false},
+{tag::BidSize,                                 -1,   false},
+{tag::OfferSize,                               -1,   false},
+{tag::ValidUntilTime,                          -1,   false},
+{tag::BidSpotRate,                             -1,   false},
+{tag::OfferSpotRate,                           -1,   false},
+{tag::BidForwardPoints,                        -1,   false},
+{tag::OfferForwardPoints,                      -1,   false},
+{tag::MidPx,                                   -1,   false},
+{tag::BidYield,                                -1,   false},
+{tag::MidYield,                                -1,   false},
+{tag::OfferYield,                              -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::SettlDate,                               -1,   false},
+{tag::OrdType,                                 -1,   false},
+{tag::SettlDate2,                              -1,   false},
+{tag::OrderQty2,                               -1,   false},
+{tag::BidForwardPoints2,                       -1,   false},
+{tag::OfferForwardPoints2,                     -1,   false},
+{tag::Currency,                                -1,   false},
+{tag::BookingType,                             -1,   false},
+{tag::OrderCapacity,                           -1,   false},
+{tag::OrderRestrictions,                       -1,   false},
+{tag::QuoteQualifier,                          -1,   false},
+{0,                                            3,    true}, // Instrument
+{0,                                            2,    false}, // FinancingDetails
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::PrevClosePx,                             -1,   false},
+{tag::QuoteRequestType,                        -1,   false},
+{tag::QuoteID,                                 -1,   false},
+{tag::SecondaryQuoteID,                        -1,   false},
+{tag::QuoteType,                               -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::TradeOriginationDate,                    -1,   false},
+{tag::NumOfCompetitors,                        -1,   false},
+{tag::Side,                                    -1,   false},
+{tag::QtyType,                                 -1,   false},
+{0,                                            9,    false}, // OrderQtyData
+{tag::MinQty,                                  -1,   false},
+{tag::SettlType,                               -1,   false},
+{tag::SettlDate,                               -1,   false},
+{tag::SettlDate2,                              -1,   false},
+{tag::OrderQty2,                               -1,   false},
+{tag::Currency,                                -1,   false},
+{tag::SettlCurrency,                           -1,   false},
+{tag::NoRateSources,                           166,  false}, // RateSource
+{tag::NoStipulations,                          17,   false}, // Stipulations
+{tag::Account,                                 -1,   false},
+{tag::AcctIDSource,                            -1,   false},
+{tag::AccountType,                             -1,   false},
+{tag::NoLegs,                                  70,   false}, // QuotReqLegsGrp
+{tag::NoQuoteQualifiers,                       68,   false}, // QuotQualGrp
+{tag::TrdType,                                 -1,   false},
+{tag::RegulatoryTransactionType,               -1,   false},
+{tag::NegotiationMethod,                       -1,   false},
+{tag::QuotePriceType,                          -1,   false},
+{tag::NoPriceQualifiers,                       712,  false}, // PriceQualifierGrp
+{tag::OrdType,                                 -1,   false},
+{tag::ValidUntilTime,                          -1,   false},
+{tag::ExpireTime,                              -1,   false},
+{tag::ResponseTime,                            -1,   false},
+{tag::QuoteDisplayTime,                        -1,   false},
+{tag::ExposureDuration,                        -1,   false},
+{tag::ExposureDurationUnit,                    -1,   false},
+{tag::TransactTime,                            -1,   false},
+{0,                                            16,   false}, // SpreadOrBenchmarkCurveData
+{tag::PriceType,                               -1,   false},
+{tag::Price,                                   -1,   false},
+{tag::MidPx,                                   -1,   false},
+{tag::Price2,                                  -1,   false},
+{0,                                            20,   false}, // YieldData
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::StrikeTime,                              -1,   false},
+{0,                                            5,    false}, // InstrumentLeg
+{tag::LegOrderQty,                             -1,   false},
+{tag::LegQty,                                  -1,   false},
+{tag::LegMidPx,                                -1,   false},
+{tag::LegSwapType,                             -1,   false},
+{tag::LegSettlType,                            -1,   false},
+{tag::LegSettlDate,                            -1,   false},
+{tag::NoLegStipulations,                       7,    false}, // LegStipulations
+{tag::NoNestedPartyIDs,                        8,    false}, // NestedParties
+{0,                                            6,    false}, // LegBenchmarkCurveData
+{tag::LegRefID,                                -1,   false},
+{0,                                            3,    true}, // Instrument
+{0,                                            2,    false}, // FinancingDetails
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::PrevClosePx,                             -1,   false},
+{tag::QuoteRequestType,                        -1,   false},
+{tag::QuoteType,                               -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::TradeOriginationDate,                    -1,   false},
+{tag::Side,                                    -1,   false},
+{tag::QtyType,                                 -1,   false},
+{0,                                            9,    false}, // OrderQtyData
+{tag::SettlType,                               -1,   false},
+{tag::SettlDate,                               -1,   false},
+{tag::SettlDate2,                              -1,   false},
+{tag::OrderQty2,                               -1,   false},
+{tag::Currency,                                -1,   false},
+{tag::NoStipulations,                          17,   false}, // Stipulations
+{tag::Account,                                 -1,   false},
+{tag::AcctIDSource,                            -1,   false},
+{tag::AccountType,                             -1,   false},
+{tag::NoLegs,                                  70,   false}, // QuotReqLegsGrp
+{tag::NoQuoteQualifiers,                       68,   false}, // QuotQualGrp
+{tag::NegotiationMethod,                       -1,   false},
+{tag::QuotePriceType,                          -1,   false},
+{tag::NoPriceQualifiers,                       712,  false}, // PriceQualifierGrp
+{tag::OrdType,                                 -1,   false},
+{tag::ExpireTime,                              -1,   false},
+{tag::TransactTime,                            -1,   false},
+{0,                                            16,   false}, // SpreadOrBenchmarkCurveData
+{tag::PriceType,                               -1,   false},
+{tag::Price,                                   -1,   false},
+{tag::Price2,                                  -1,   false},
+{0,                                            20,   false}, // YieldData
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::StrikeTime,                              -1,   false},
+{tag::QuoteSetID,                              -1,   false},
+{0,                                            19,   false}, // UnderlyingInstrument
+{tag::QuoteSetValidUntilTime,                  -1,   false},
+{tag::TotNoQuoteEntries,                       -1,   false},
+{tag::TotNoCxldQuotes,                         -1,   false},
+{tag::TotNoAccQuotes,                          -1,   false},
+{tag::TotNoRejQuotes,                          -1,   false},
+{tag::LastFragment,                            -1,   false},
+{tag::NoQuoteEntries,                          66,   false}, // QuotEntryAckGrp
+{tag::QuoteSetID,                              -1,   true},
+{0,                                            19,   false}, // UnderlyingInstrument
+{tag::QuoteSetValidUntilTime,                  -1,   false},
+{tag::TotNoQuoteEntries,                       -1,   true},
+{tag::LastFragment,                            -1,   false},
+{tag::NoQuoteEntries,                          67,   true}, // QuotEntryGrp
+{0,                                            3,    false}, // Instrument
+{0,                                            130,  false}, // SecondaryPriceLimits
+{tag::Currency,                                -1,   false},
+{tag::CorporateAction,                         -1,   false},
+{0,                                            4,    false}, // InstrumentExtension
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::RelSymTransactTime,                      -1,   false},
+{tag::NumOfSimpleInstruments,                  -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{0,                                            3,    true}, // Instrument
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::PrevClosePx,                             -1,   false},
+{tag::QuoteRequestType,                        -1,   false},
+{tag::QuoteType,                               -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::DistribPaymentMethod,                    -1,   false},
+{tag::DistribPercentage,                       -1,   false},
+{tag::CashDistribCurr,                         -1,   false},
+{tag::CashDistribAgentName,                    -1,   false},
+{tag::CashDistribAgentCode,                    -1,   false},
+{tag::CashDistribAgentAcctNumber,              -1,   false},
+{tag::CashDistribPayRef,                       -1,   false},
+{tag::CashDistribAgentAcctName,                -1,   false},
+{tag::RegistDtls,                              -1,   false},
+{tag::RegistEmail,                             -1,   false},
+{tag::MailingDtls,                             -1,   false},
+{tag::MailingInst,                             -1,   false},
+{tag::NoNestedPartyIDs,                        8,    false}, // NestedParties
+{tag::OwnerType,                               -1,   false},
+{tag::DateOfBirth,                             -1,   false},
+{tag::InvestorCountryOfResidence,              -1,   false},
+{tag::RoutingType,                             -1,   false},
+{tag::RoutingID,                               -1,   false},
+{0,                                            3,    false}, // Instrument
+{0,                                            4,    false}, // InstrumentExtension
+{tag::NoSecurityClassifications,               205,  false}, // SecurityClassificationGrp
+{0,                                            2,    false}, // FinancingDetails
+{0,                                            121,  false}, // SecurityTradingRules
+{tag::NoStrikeRules,                           128,  false}, // StrikeRules
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::Currency,                                -1,   false},
+{tag::NoStipulations,                          17,   false}, // Stipulations
+{tag::NoLegs,                                  45,   false}, // InstrmtLegSecListGrp
+{tag::NoRelatedInstruments,                    180,  false}, // RelatedInstrumentGrp
+{0,                                            16,   false}, // SpreadOrBenchmarkCurveData
+{0,                                            20,   false}, // YieldData
+{tag::NoPriceMovements,                        239,  false}, // PriceMovementGrp
+{tag::RelSymTransactTime,                      -1,   false},
+{tag::NumOfSimpleInstruments,                  -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::SecurityType,                            -1,   false},
+{tag::SecuritySubType,                         -1,   false},
+{tag::Product,                                 -1,   false},
+{tag::CFICode,                                 -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::SettlInstID,                             -1,   false},
+{tag::SettlInstTransType,                      -1,   false},
+{tag::SettlInstRefID,                          -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::Side,                                    -1,   false},
+{tag::Product,                                 -1,   false},
+{tag::SecurityType,                            -1,   false},
+{tag::CFICode,                                 -1,   false},
+{tag::SettlCurrency,                           -1,   false},
+{tag::EffectiveTime,                           -1,   false},
+{tag::ExpireTime,                              -1,   false},
+{tag::LastUpdateTime,                          -1,   false},
+{0,                                            14,   false}, // SettlInstructionsData
+{tag::PaymentMethod,                           -1,   false},
+{tag::PaymentRef,                              -1,   false},
+{tag::CardHolderName,                          -1,   false},
+{tag::CardNumber,                              -1,   false},
+{tag::CardStartDate,                           -1,   false},
+{tag::CardExpDate,                             -1,   false},
+{tag::CardIssNum,                              -1,   false},
+{tag::PaymentDate,                             -1,   false},
+{tag::PaymentRemitterID,                       -1,   false},
+{tag::Side,                                    -1,   true},
+{tag::OrigClOrdID,                             -1,   false},
+{tag::ClOrdID,                                 -1,   true},
+{tag::SecondaryClOrdID,                        -1,   false},
+{tag::ClOrdLinkID,                             -1,   false},
+{tag::OrigOrdModTime,                          -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::TradeOriginationDate,                    -1,   false},
+{tag::TradeDate,                               -1,   false},
+{0,                                            9,    true}, // OrderQtyData
+{tag::ComplianceID,                            -1,   false},
+{tag::ComplianceText,                          -1,   false},
+{tag::EncodedComplianceTextLen,                -1,   false},
+{tag::EncodedComplianceText,                   -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::Side,                                    -1,   true},
+{tag::ShortMarkingExemptIndicator,             -1,   false},
+{tag::OrigClOrdID,                             -1,   false},
+{tag::ClOrdID,                                 -1,   true},
+{tag::SecondaryClOrdID,                        -1,   false},
+{tag::ClOrdLinkID,                             -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::NoCrossLegs,                             223,  false}, // SideCrossLegGrp
+{tag::SideShortSaleExemptionReason,            -1,   false},
+{tag::TradeOriginationDate,                    -1,   false},
+{tag::TradeDate,                               -1,   false},
+{tag::Account,                                 -1,   false},
+{tag::AcctIDSource,                            -1,   false},
+{tag::AccountType,                             -1,   false},
+{tag::DayBookingInst,                          -1,   false},
+{tag::BookingUnit,                             -1,   false},
+{tag::PreallocMethod,                          -1,   false},
+{tag::AllocID,                                 -1,   false},
+{tag::NoAllocs,                                63,   false}, // PreAllocGrp
+{tag::QtyType,                                 -1,   false},
+{0,                                            9,    true}, // OrderQtyData
+{0,                                            0,    false}, // CommissionData
+{tag::NoCommissions,                           594,  false}, // CommissionDataGrp
+{tag::OrderCapacity,                           -1,   false},
+{tag::OrderRestrictions,                       -1,   false},
+{tag::PreTradeAnonymity,                       -1,   false},
+{tag::CustOrderCapacity,                       -1,   false},
+{tag::ForexReq,                                -1,   false},
+{tag::SettlCurrency,                           -1,   false},
+{tag::BookingType,                             -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::ClearingAccountType,                     -1,   false},
+{tag::PositionEffect,                          -1,   false},
+{tag::CoveredOrUncovered,                      -1,   false},
+{tag::CashMargin,                              -1,   false},
+{tag::ClearingFeeIndicator,                    -1,   false},
+{tag::SolicitedFlag,                           -1,   false},
+{tag::SideComplianceID,                        -1,   false},
+{tag::SideTimeInForce,                         -1,   false},
+{tag::AllocAccount,                            -1,   false},
+{tag::AllocAcctIDSource,                       -1,   false},
+{tag::AllocSettlCurrency,                      -1,   false},
+{tag::IndividualAllocID,                       -1,   false},
+{tag::ParentAllocID,                           -1,   false},
+{tag::AllocLegRefID,                           -1,   false},
+{tag::NoAllocRegulatoryTradeIDs,               244,  false}, // AllocRegulatoryTradeIDGrp
+{tag::FirmMnemonic,                            -1,   false},
+{tag::NoNested2PartyIDs,                       24,   false}, // NestedParties2
+{tag::AllocQty,                                -1,   false},
+{tag::AllocCalculatedCcyQty,                   -1,   false},
+{tag::CustodialLotID,                          -1,   false},
+{tag::VersusPurchaseDate,                      -1,   false},
+{tag::VersusPurchasePrice,                     -1,   false},
+{tag::CurrentCostBasis,                        -1,   false},
+{tag::AllocCustomerCapacity,                   -1,   false},
+{tag::AllocMethod,                             -1,   false},
+{tag::SecondaryIndividualAllocID,              -1,   false},
+{tag::AllocClearingFeeIndicator,               -1,   false},
+{tag::NoTradeAllocAmts,                        224,  false}, // TradeAllocAmtGrp
+{tag::TradeAllocStatus,                        -1,   false},
+{tag::AllocationRollupInstruction,             -1,   false},
+{tag::AllocText,                               -1,   false},
+{tag::EncodedAllocTextLen,                     -1,   false},
+{tag::EncodedAllocText,                        -1,   false},
+{tag::FirmAllocText,                           -1,   false},
+{tag::EncodedFirmAllocTextLen,                 -1,   false},
+{tag::EncodedFirmAllocText,                    -1,   false},
+{tag::AllocRefRiskLimitCheckID,                -1,   false},
+{tag::AllocRefRiskLimitCheckIDType,            -1,   false},
+{tag::NoAllocCommissions,                      595,  false}, // AllocCommissionDataGrp
+{tag::Side,                                    -1,   true},
+{tag::ShortMarkingExemptIndicator,             -1,   false},
+{tag::SideExecID,                              -1,   false},
+{tag::OrderDelay,                              -1,   false},
+{tag::OrderDelayUnit,                          -1,   false},
+{tag::SideLastQty,                             -1,   false},
+{tag::SideClearingTradePrice,                  -1,   false},
+{tag::SidePriceDifferential,                   -1,   false},
+{tag::SideClearingTradePriceType,              -1,   false},
+{tag::SideTradeReportID,                       -1,   false},
+{tag::SideTradeID,                             -1,   false},
+{tag::SideOrigTradeID,                         -1,   false},
+{tag::SideFillStationCd,                       -1,   false},
+{tag::SideReasonCd,                            -1,   false},
+{tag::RptSeq,                                  -1,   false},
+{tag::SideTrdSubTyp,                           -1,   false},
+{tag::NetGrossInd,                             -1,   false},
+{tag::SideCurrency,                            -1,   false},
+{tag::SideSettlCurrency,                       -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::NoPartyDetails,                          183,  false}, // PartyDetailGrp
+{tag::Account,                                 -1,   false},
+{tag::AcctIDSource,                            -1,   false},
+{tag::AccountType,                             -1,   false},
+{tag::NoLimitAmts,                             177,  false}, // LimitAmts
+{tag::ProcessCode,                             -1,   false},
+{tag::OddLot,                                  -1,   false},
+{tag::NoClearingInstructions,                  32,   false}, // ClrInstGrp
+{tag::NoSideRegulatoryTradeIDs,                309,  false}, // SideRegulatoryTradeIDGrp
+{tag::SideTradeReportingIndicator,             -1,   false},
+{tag::FirmTradeEventID,                        -1,   false},
+{tag::TradeInputSource,                        -1,   false},
+{tag::TradeInputDevice,                        -1,   false},
+{tag::ComplianceID,                            -1,   false},
+{tag::ComplianceText,                          -1,   false},
+{tag::EncodedComplianceTextLen,                -1,   false},
+{tag::EncodedComplianceText,                   -1,   false},
+{tag::SolicitedFlag,                           -1,   false},
+{tag::CustOrderCapacity,                       -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::TimeBracket,                             -1,   false},
+{tag::RemunerationIndicator,                   -1,   false},
+{0,                                            0,    false}, // CommissionData
+{tag::NoCommissions,                           594,  false}, // CommissionDataGrp
+{tag::NumDaysInterest,                         -1,   false},
+{tag::ExDate,                                  -1,   false},
+{tag::AccruedInterestRate,                     -1,   false},
+{tag::AccruedInterestAmt,                      -1,   false},
+{tag::InterestAtMaturity,                      -1,   false},
+{tag::EndAccruedInterestAmt,                   -1,   false},
+{tag::StartCash,                               -1,   false},
+{tag::EndCash,                                 -1,   false},
+{tag::Concession,                              -1,   false},
+{tag::TotalTakedown,                           -1,   false},
+{tag::NetMoney,                                -1,   false},
+{tag::SettlCurrAmt,                            -1,   false},
+{tag::SettlCurrFxRate,                         -1,   false},
+{tag::SettlCurrFxRateCalc,                     -1,   false},
+{tag::PositionEffect,                          -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::SideMultiLegReportingType,               -1,   false},
+{tag::NoContAmts,                              36,   false}, // ContAmtGrp
+{tag::NoStipulations,                          17,   false}, // Stipulations
+{tag::NoMiscFees,                              59,   false}, // MiscFeesGrp
+{tag::ExchangeRule,                            -1,   false},
+{tag::TradeAllocIndicator,                     -1,   false},
+{tag::TradeAllocGroupInstruction,              -1,   false},
+{tag::AllocGroupID,                            -1,   false},
+{tag::GroupAmount,                             -1,   false},
+{tag::AllocGroupStatus,                        -1,   false},
+{tag::SideAvgPxIndicator,                      -1,   false},
+{tag::SideAvgPxGroupID,                        -1,   false},
+{tag::SideAvgPx,                               -1,   false},
+{tag::PreallocMethod,                          -1,   false},
+{tag::AllocID,                                 -1,   false},
+{tag::NoAllocs,                                84,   false}, // TrdAllocGrp
+{tag::NoSideTrdRegTS,                          111,  false}, // SideTrdRegTS
+{tag::NoSettlDetails,                          122,  false}, // SettlDetails
+{tag::SideGrossTradeAmt,                       -1,   false},
+{tag::AggressorIndicator,                      -1,   false},
+{tag::ExchangeSpecialInstructions,             -1,   false},
+{tag::SideShortSaleExemptionReason,            -1,   false},
+{tag::OrderCategory,                           -1,   false},
+{tag::SideLiquidityInd,                        -1,   false},
+{tag::StrategyLinkID,                          -1,   false},
+{0,                                            165,  false}, // TradeReportOrderDetail
+{tag::CustOrderHandlingInst,                   -1,   false},
+{tag::OrderHandlingInstSource,                 -1,   false},
+{tag::NoPositions,                             227,  false}, // TradePositionQty
+{tag::NoRelatedTrades,                         228,  false}, // RelatedTradeGrp
+{tag::NoRelatedPositions,                      229,  false}, // RelatedPositionGrp
+{tag::BlockTrdAllocIndicator,                  -1,   false},
+{tag::SideRiskLimitCheckStatus,                -1,   false},
+{tag::LastCapacity,                            -1,   false},
+{tag::RefRiskLimitCheckID,                     -1,   false},
+{tag::RefRiskLimitCheckIDType,                 -1,   false},
+{tag::CompressionGroupID,                      -1,   false},
+{tag::NoSideCollateralAmounts,                 710,  false}, // SideCollateralAmountGrp
+{tag::TradeReportID,                           -1,   false},
+{tag::SecondaryTradeReportID,                  -1,   false},
+{0,                                            5,    false}, // InstrumentLeg
+{0,                                            582,  false}, // LegFinancingDetails
+{tag::NoLegPosAmt,                             204,  false}, // LegPositionAmountData
+{tag::LegOrderQty,                             -1,   false},
+{tag::LegQty,                                  -1,   false},
+{tag::LegMidPx,                                -1,   false},
+{tag::LegSwapType,                             -1,   false},
+{tag::LegReportID,                             -1,   false},
+{tag::LegNumber,                               -1,   false},
+{tag::NoLegStipulations,                       7,    false}, // LegStipulations
+{tag::LegAccount,                              -1,   false},
+{tag::LegClearingAccountType,                  -1,   false},
+{tag::LegPositionEffect,                       -1,   false},
+{tag::LegCoveredOrUncovered,                   -1,   false},
+{tag::NoNestedPartyIDs,                        8,    false}, // NestedParties
+{tag::LegRefID,                                -1,   false},
+{tag::LegSettlType,                            -1,   false},
+{tag::LegSettlDate,                            -1,   false},
+{tag::LegLastPx,                               -1,   false},
+{tag::LegPriceType,                            -1,   false},
+{tag::LegSettlCurrency,                        -1,   false},
+{tag::LegLastForwardPoints,                    -1,   false},
+{tag::LegCalculatedCcyLastQty,                 -1,   false},
+{tag::LegGrossTradeAmt,                        -1,   false},
+{tag::LegShortSaleExemptionReason,             -1,   false},
+{tag::LegVolatility,                           -1,   false},
+{tag::LegDividendYield,                        -1,   false},
+{tag::LegCurrencyRatio,                        -1,   false},
+{tag::LegExecInst,                             -1,   false},
+{tag::LegLastQty,                              -1,   false},
+{tag::LegQtyType,                              -1,   false},
+{tag::LegLastMultipliedQty,                    -1,   false},
+{tag::LegTotalTradeQty,                        -1,   false},
+{tag::LegTotalTradeMultipliedQty,              -1,   false},
+{tag::LegTotalGrossTradeAmt,                   -1,   false},
+{tag::NoOfLegUnderlyings,                      154,  false}, // TradeCapLegUnderlyingsGrp
+{tag::LegDifferentialPrice,                    -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{0,                                            19,   false}, // UnderlyingInstrument
+{tag::CollAction,                              -1,   false},
+{0,                                            19,   false}, // UnderlyingInstrument
+{tag::TradeDate,                               -1,   false},
+{tag::LastUpdateTime,                          -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::EventType,                               -1,   false},
+{tag::EventDate,                               -1,   false},
+{tag::EventTime,                               -1,   false},
+{tag::EventTimeUnit,                           -1,   false},
+{tag::EventTimePeriod,                         -1,   false},
+{tag::EventMonthYear,                          -1,   false},
+{tag::EventPx,                                 -1,   false},
+{tag::EventText,                               -1,   false},
+{tag::EncodedEventTextLen,                     -1,   false},
+{tag::EncodedEventText,                        -1,   false},
+{tag::SecurityAltID,                           -1,   false},
+{tag::SecurityAltIDSource,                     -1,   false},
+{tag::LegSecurityAltID,                        -1,   false},
+{tag::LegSecurityAltIDSource,                  -1,   false},
+{tag::UnderlyingSecurityAltID,                 -1,   false},
+{tag::UnderlyingSecurityAltIDSource,           -1,   false},
+{tag::InstrAttribType,                         -1,   false},
+{tag::InstrAttribValue,                        -1,   false},
+{tag::SettlInstSource,                         -1,   false},
+{tag::DlvyInstType,                            -1,   false},
+{tag::NoSettlPartyIDs,                         15,   false}, // SettlParties
+{tag::SettlPartySubID,                         -1,   false},
+{tag::SettlPartySubIDType,                     -1,   false},
+{tag::PartySubID,                              -1,   false},
+{tag::PartySubIDType,                          -1,   false},
+{tag::NestedPartySubID,                        -1,   false},
+{tag::NestedPartySubIDType,                    -1,   false},
+{tag::HopCompID,                               -1,   false},
+{tag::HopSendingTime,                          -1,   false},
+{tag::HopRefID,                                -1,   false},
+{tag::Nested2PartySubID,                       -1,   false},
+{tag::Nested2PartySubIDType,                   -1,   false},
+{tag::Nested3PartySubID,                       -1,   false},
+{tag::Nested3PartySubIDType,                   -1,   false},
+{tag::StrategyParameterName,                   -1,   false},
+{tag::StrategyParameterType,                   -1,   false},
+{tag::StrategyParameterValue,                  -1,   false},
+{tag::ListUpdateAction,                        -1,   false},
+{0,                                            3,    false}, // Instrument
+{0,                                            4,    false}, // InstrumentExtension
+{0,                                            2,    false}, // FinancingDetails
+{0,                                            121,  false}, // SecurityTradingRules
+{tag::NoStrikeRules,                           128,  false}, // StrikeRules
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::Currency,                                -1,   false},
+{tag::NoStipulations,                          17,   false}, // Stipulations
+{tag::NoLegs,                                  106,  false}, // SecLstUpdRelSymsLegGrp
+{tag::NoRelatedInstruments,                    180,  false}, // RelatedInstrumentGrp
+{0,                                            16,   false}, // SpreadOrBenchmarkCurveData
+{0,                                            20,   false}, // YieldData
+{tag::RelSymTransactTime,                      -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{0,                                            5,    false}, // InstrumentLeg
+{tag::LegSwapType,                             -1,   false},
+{tag::LegSettlType,                            -1,   false},
+{tag::NoLegStipulations,                       7,    false}, // LegStipulations
+{0,                                            6,    false}, // LegBenchmarkCurveData
+{tag::UnderlyingPayAmount,                     -1,   false},
+{tag::UnderlyingCollectAmount,                 -1,   false},
+{tag::UnderlyingSettlementDate,                -1,   false},
+{tag::UnderlyingSettlementStatus,              -1,   false},
+{tag::ExpirationQtyType,                       -1,   false},
+{tag::ExpQty,                                  -1,   false},
+{tag::InstrumentPartyID,                       -1,   false},
+{tag::InstrumentPartyIDSource,                 -1,   false},
+{tag::InstrumentPartyRole,                     -1,   false},
+{tag::InstrumentPartyRoleQualifier,            -1,   false},
+{tag::NoInstrumentPartySubIDs,                 110,  false}, // InstrumentPtysSubGrp
+{tag::InstrumentPartySubID,                    -1,   false},
+{tag::InstrumentPartySubIDType,                -1,   false},
+{tag::SideTrdRegTimestamp,                     -1,   false},
+{tag::SideTrdRegTimestampType,                 -1,   false},
+{tag::SideTrdRegTimestampSrc,                  -1,   false},
+{tag::Side,                                    -1,   true},
+{tag::SideExecID,                              -1,   false},
+{tag::SideTradeID,                             -1,   false},
+{tag::SideOrigTradeID,                         -1,   false},
+{tag::OrderDelay,                              -1,   false},
+{tag::OrderDelayUnit,                          -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::Account,                                 -1,   false},
+{tag::AcctIDSource,                            -1,   false},
+{tag::AccountType,                             -1,   false},
+{tag::NoLimitAmts,                             177,  false}, // LimitAmts
+{tag::ProcessCode,                             -1,   false},
+{tag::OddLot,                                  -1,   false},
+{tag::NoClearingInstructions,                  32,   false}, // ClrInstGrp
+{tag::SideTradeReportingIndicator,             -1,   false},
+{tag::TradeInputSource,                        -1,   false},
+{tag::TradeInputDevice,                        -1,   false},
+{tag::ComplianceID,                            -1,   false},
+{tag::ComplianceText,                          -1,   false},
+{tag::EncodedComplianceTextLen,                -1,   false},
+{tag::EncodedComplianceText,                   -1,   false},
+{tag::SolicitedFlag,                           -1,   false},
+{tag::CustOrderCapacity,                       -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::TimeBracket,                             -1,   false},
+{tag::NetGrossInd,                             -1,   false},
+{tag::SideCurrency,                            -1,   false},
+{tag::SideSettlCurrency,                       -1,   false},
+{0,                                            0,    false}, // CommissionData
+{tag::NoCommissions,                           594,  false}, // CommissionDataGrp
+{tag::NumDaysInterest,                         -1,   false},
+{tag::ExDate,                                  -1,   false},
+{tag::AccruedInterestRate,                     -1,   false},
+{tag::AccruedInterestAmt,                      -1,   false},
+{tag::InterestAtMaturity,                      -1,   false},
+{tag::EndAccruedInterestAmt,                   -1,   false},
+{tag::StartCash,                               -1,   false},
+{tag::EndCash,                                 -1,   false},
+{tag::Concession,                              -1,   false},
+{tag::TotalTakedown,                           -1,   false},
+{tag::NetMoney,                                -1,   false},
+{tag::SettlCurrAmt,                            -1,   false},
+{tag::SettlCurrFxRate,                         -1,   false},
+{tag::SettlCurrFxRateCalc,                     -1,   false},
+{tag::PositionEffect,                          -1,   false},
+{tag::SideMultiLegReportingType,               -1,   false},
+{tag::NoContAmts,                              36,   false}, // ContAmtGrp
+{tag::NoStipulations,                          17,   false}, // Stipulations
+{tag::NoMiscFees,                              59,   false}, // MiscFeesGrp
+{tag::ExchangeRule,                            -1,   false},
+{tag::NoSettlDetails,                          122,  false}, // SettlDetails
+{tag::TradeAllocIndicator,                     -1,   false},
+{tag::AllocGroupID,                            -1,   false},
+{tag::GroupAmount,                             -1,   false},
+{tag::AllocGroupStatus,                        -1,   false},
+{tag::SideAvgPxIndicator,                      -1,   false},
+{tag::SideAvgPxGroupID,                        -1,   false},
+{tag::SideAvgPx,                               -1,   false},
+{tag::PreallocMethod,                          -1,   false},
+{tag::AllocID,                                 -1,   false},
+{tag::NoAllocs,                                84,   false}, // TrdAllocGrp
+{tag::SideGrossTradeAmt,                       -1,   false},
+{tag::AggressorIndicator,                      -1,   false},
+{tag::SideLastQty,                             -1,   false},
+{tag::SideTradeReportID,                       -1,   false},
+{tag::SideFillStationCd,                       -1,   false},
+{tag::SideReasonCd,                            -1,   false},
+{tag::RptSeq,                                  -1,   false},
+{tag::SideTrdSubTyp,                           -1,   false},
+{tag::OrderCategory,                           -1,   false},
+{tag::StrategyLinkID,                          -1,   false},
+{0,                                            165,  false}, // TradeReportOrderDetail
+{tag::NoSideTrdRegTS,                          111,  false}, // SideTrdRegTS
+{tag::CustOrderHandlingInst,                   -1,   false},
+{tag::OrderHandlingInstSource,                 -1,   false},
+{tag::NoRelatedTrades,                         228,  false}, // RelatedTradeGrp
+{tag::NoRelatedPositions,                      229,  false}, // RelatedPositionGrp
+{tag::SideRiskLimitCheckStatus,                -1,   false},
+{tag::UnderlyingInstrumentPartyID,             -1,   false},
+{tag::UnderlyingInstrumentPartyIDSource,       -1,   false},
+{tag::UnderlyingInstrumentPartyRole,           -1,   false},
+{tag::UnderlyingInstrumentPartyRoleQualifier,  -1,   false},
+{tag::NoUndlyInstrumentPartySubIDs,            114,  false}, // UndlyInstrumentPtysSubGrp
+{tag::UnderlyingInstrumentPartySubID,          -1,   false},
+{tag::UnderlyingInstrumentPartySubIDType,      -1,   false},
+{tag::DisplayQty,                              -1,   false},
+{tag::SecondaryDisplayQty,                     -1,   false},
+{tag::InitialDisplayQty,                       -1,   false},
+{tag::DisplayWhen,                             -1,   false},
+{tag::DisplayMethod,                           -1,   false},
+{tag::DisplayLowQty,                           -1,   false},
+{tag::DisplayHighQty,                          -1,   false},
+{tag::DisplayMinIncr,                          -1,   false},
+{tag::RefreshQty,                              -1,   false},
+{tag::TriggerType,                             -1,   false},
+{tag::TriggerAction,                           -1,   false},
+{tag::TriggerScope,                            -1,   false},
+{tag::TriggerPrice,                            -1,   false},
+{tag::TriggerSymbol,                           -1,   false},
+{tag::TriggerSecurityID,                       -1,   false},
+{tag::TriggerSecurityIDSource,                 -1,   false},
+{tag::TriggerSecurityDesc,                     -1,   false},
+{tag::TriggerPriceType,                        -1,   false},
+{tag::TriggerPriceTypeScope,                   -1,   false},
+{tag::TriggerPriceDirection,                   -1,   false},
+{tag::TriggerNewPrice,                         -1,   false},
+{tag::TriggerOrderType,                        -1,   false},
+{tag::TriggerNewQty,                           -1,   false},
+{tag::TriggerTradingSessionID,                 -1,   false},
+{tag::TriggerTradingSessionSubID,              -1,   false},
+{tag::RootPartyID,                             -1,   false},
+{tag::RootPartyIDSource,                       -1,   false},
+{tag::RootPartyRole,                           -1,   false},
+{tag::RootPartyRoleQualifier,                  -1,   false},
+{tag::NoRootPartySubIDs,                       118,  false}, // RootSubParties
+{tag::RootPartySubID,                          -1,   false},
+{tag::RootPartySubIDType,                      -1,   false},
+{tag::TradingSessionID,                        -1,   true},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::TradSesUpdateAction,                     -1,   false},
+{tag::SecurityExchange,                        -1,   false},
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::TradingSessionDesc,                      -1,   false},
+{tag::TradSesMethod,                           -1,   false},
+{tag::TradSesMode,                             -1,   false},
+{tag::UnsolicitedIndicator,                    -1,   false},
+{tag::TradSesStatus,                           -1,   true},
+{tag::TradSesStatusRejReason,                  -1,   false},
+{tag::TradSesStartTime,                        -1,   false},
+{tag::TradSesOpenTime,                         -1,   false},
+{tag::TradSesPreCloseTime,                     -1,   false},
+{tag::TradSesCloseTime,                        -1,   false},
+{tag::TradSesEndTime,                          -1,   false},
+{tag::TotalVolumeTraded,                       -1,   false},
+{0,                                            138,  false}, // TradingSessionRules
+{tag::TransactTime,                            -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::RefMsgType,                              -1,   false},
+{tag::MsgDirection,                            -1,   false},
+{tag::RefApplVerID,                            -1,   false},
+{tag::RefApplExtID,                            -1,   false},
+{tag::RefCstmApplVerID,                        -1,   false},
+{0,                                            140,  false}, // BaseTradingRules
+{tag::NoTradingSessionRules,                   139,  false}, // TradingSessionRulesGrp
+{1312,                                         145,  false}, // NestedInstrumentAttribute
+{tag::SettlObligSource,                        -1,   false},
+{tag::NoSettlPartyIDs,                         15,   false}, // SettlParties
+{tag::NetGrossInd,                             -1,   false},
+{tag::SettlObligID,                            -1,   false},
+{tag::SettlObligTransType,                     -1,   false},
+{tag::SettlObligRefID,                         -1,   false},
+{tag::CcyAmt,                                  -1,   false},
+{tag::SettlCurrAmt,                            -1,   false},
+{tag::Currency,                                -1,   false},
+{tag::SettlCurrency,                           -1,   false},
+{tag::SettlCurrFxRate,                         -1,   false},
+{tag::SettlDate,                               -1,   false},
+{0,                                            3,    false}, // Instrument
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::EffectiveTime,                           -1,   false},
+{tag::ExpireTime,                              -1,   false},
+{tag::LastUpdateTime,                          -1,   false},
+{tag::NoSettlDetails,                          122,  false}, // SettlDetails
+{tag::MDSecSizeType,                           -1,   false},
+{tag::MDSecSize,                               -1,   false},
+{tag::StatsType,                               -1,   false},
+{tag::SecurityXMLLen,                          -1,   false},
+{tag::SecurityXML,                             -1,   false},
+{tag::SecurityXMLSchema,                       -1,   false},
+{tag::StartTickPriceRange,                     -1,   false},
+{tag::EndTickPriceRange,                       -1,   false},
+{tag::TickIncrement,                           -1,   false},
+{tag::TickRuleType,                            -1,   false},
+{tag::TickRuleProductComplex,                  -1,   false},
+{tag::SettlPriceIncrement,                     -1,   false},
+{tag::SettlPriceSecondaryIncrement,            -1,   false},
+{tag::StrikeRuleID,                            -1,   false},
+{tag::StartStrikePxRange,                      -1,   false},
+{tag::EndStrikePxRange,                        -1,   false},
+{tag::StrikeIncrement,                         -1,   false},
+{tag::StrikeExerciseStyle,                     -1,   false},
+{tag::NoMaturityRules,                         129,  false}, // MaturityRules
+{tag::MaturityRuleID,                          -1,   false},
+{tag::MaturityMonthYearFormat,                 -1,   false},
+{tag::MaturityMonthYearIncrementUnits,         -1,   false},
+{tag::StartMaturityMonthYear,                  -1,   false},
+{tag::EndMaturityMonthYear,                    -1,   false},
+{tag::MaturityMonthYearIncrement,              -1,   false},
+{tag::SecondaryPriceLimitType,                 -1,   false},
+{tag::SecondaryLowLimitPrice,                  -1,   false},
+{tag::SecondaryHighLimitPrice,                 -1,   false},
+{tag::SecondaryTradingReferencePrice,          -1,   false},
+{tag::PriceLimitType,                          -1,   false},
+{tag::LowLimitPrice,                           -1,   false},
+{tag::HighLimitPrice,                          -1,   false},
+{tag::TradingReferencePrice,                   -1,   false},
+{tag::MDFeedType,                              -1,   false},
+{tag::MDSubFeedType,                           -1,   false},
+{tag::MarketDepth,                             -1,   false},
+{tag::MarketDepthTimeInterval,                 -1,   false},
+{tag::MarketDepthTimeIntervalUnit,             -1,   false},
+{tag::MDRecoveryTimeInterval,                  -1,   false},
+{tag::MDRecoveryTimeIntervalUnit,              -1,   false},
+{tag::MDBookType,                              -1,   false},
+{tag::MDSubBookType,                           -1,   false},
+{tag::PrimaryServiceLocationID,                -1,   false},
+{tag::SecondaryServiceLocationID,              -1,   false},
+{tag::LotType,                                 -1,   false},
+{tag::MinLotSize,                              -1,   false},
+{tag::MatchAlgorithm,                          -1,   false},
+{tag::MatchType,                               -1,   false},
+{tag::MatchRuleProductComplex,                 -1,   false},
+{tag::CustomerPriority,                        -1,   false},
+{tag::ExecInstValue,                           -1,   false},
+{tag::TimeInForce,                             -1,   false},
+{tag::OrdType,                                 -1,   false},
+{tag::NoOrdTypeRules,                          137,  false}, // OrdTypeRules
+{tag::NoTimeInForceRules,                      136,  false}, // TimeInForceRules
+{tag::NoExecInstRules,                         135,  false}, // ExecInstRules
+{tag::NoAuctionTypeRules,                      587,  false}, // AuctionTypeRuleGrp
+{tag::NoMatchRules,                            134,  false}, // MatchRules
+{tag::NoMDFeedTypes,                           132,  false}, // MarketDataFeedTypes
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{0,                                            138,  false}, // TradingSessionRules
+{tag::NoTickRules,                             127,  false}, // TickRules
+{tag::NoLotTypeRules,                          133,  false}, // LotTypeRules
+{0,                                            131,  false}, // PriceLimits
+{tag::NoPriceRangeRules,                       589,  false}, // PriceRangeRuleGrp
+{tag::NoQuoteSizeRules,                        590,  false}, // QuoteSizeRuleGrp
+{tag::ExpirationCycle,                         -1,   false},
+{tag::TradeVolType,                            -1,   false},
+{tag::MinTradeVol,                             -1,   false},
+{tag::MaxTradeVol,                             -1,   false},
+{tag::MaxPriceVariation,                       -1,   false},
+{tag::ImpliedMarketIndicator,                  -1,   false},
+{tag::TradingCurrency,                         -1,   false},
+{tag::RoundLot,                                -1,   false},
+{tag::MultilegModel,                           -1,   false},
+{tag::MultilegPriceMethod,                     -1,   false},
+{tag::PriceType,                               -1,   false},
+{tag::FastMarketPercentage,                    -1,   false},
+{tag::QuoteSideIndicator,                      -1,   false},
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{0,                                            121,  false}, // SecurityTradingRules
+{tag::NoStrikeRules,                           128,  false}, // StrikeRules
+{tag::DerivativeInstrumentPartySubID,          -1,   false},
+{tag::DerivativeInstrumentPartySubIDType,      -1,   false},
+{tag::DerivativeInstrumentPartyID,             -1,   false},
+{tag::DerivativeInstrumentPartyIDSource,       -1,   false},
+{tag::DerivativeInstrumentPartyRole,           -1,   false},
+{tag::DerivativeInstrumentPartyRoleQualifier,  -1,   false},
+{tag::NoDerivativeInstrumentPartySubIDs,       142,  false}, // DerivativeInstrumentPartySubIDsGrp
+{tag::DerivativeInstrAttribType,               -1,   false},
+{tag::DerivativeInstrAttribValue,              -1,   false},
+{tag::NestedInstrAttribType,                   -1,   false},
+{tag::NestedInstrAttribValue,                  -1,   false},
+{tag::DerivativeSymbol,                        -1,   false},
+{tag::DerivativeSymbolSfx,                     -1,   false},
+{tag::DerivativeSecurityID,                    -1,   false},
+{tag::DerivativeSecurityIDSource,              -1,   false},
+{tag::NoDerivativeSecurityAltID,               147,  false}, // DerivativeSecurityAltIDGrp
+{tag::DerivativeProductComplex,                -1,   false},
+{tag::DerivFlexProductEligibilityIndicator,    -1,   false},
+{tag::DerivativeContractMultiplierUnit,        -1,   false},
+{tag::DerivativeFlowScheduleType,              -1,   false},
+{tag::DerivativeUnitOfMeasureCurrency,         -1,   false},
+{tag::DerivativePriceUnitOfMeasure,            -1,   false},
+{tag::DerivativePriceUnitOfMeasureQty,         -1,   false},
+{tag::DerivativePriceUnitOfMeasureCurrency,    -1,   false},
+{tag::DerivativeSettlMethod,                   -1,   false},
+{tag::DerivativePriceQuoteMethod,              -1,   false},
+{tag::DerivativeValuationMethod,               -1,   false},
+{tag::DerivativePriceQuoteCurrency,            -1,   false},
+{tag::DerivativeListMethod,                    -1,   false},
+{tag::DerivativeCapPrice,                      -1,   false},
+{tag::DerivativeFloorPrice,                    -1,   false},
+{tag::DerivativePutOrCall,                     -1,   false},
+{tag::DerivativeInTheMoneyCondition,           -1,   false},
+{tag::DerivativeContraryInstructionEligibilityIndicator, -1,   false},
+{tag::DerivativeExerciseStyle,                 -1,   false},
+{tag::DerivativeOptPayAmount,                  -1,   false},
+{0,                                            151,  false}, // DerivativeSecurityXML
+{1286,                                         148,  false}, // DerivativeEventsGrp
+{tag::NoDerivativeInstrumentParties,           143,  false}, // DerivativeInstrumentParties
+{tag::DerivativeSecurityAltID,                 -1,   false},
+{tag::DerivativeSecurityAltIDSource,           -1,   false},
+{0,                                            146,  false}, // DerivativeInstrument
+{1311,                                         144,  false}, // DerivativeInstrumentAttribute
+{tag::NoMarketSegments,                        141,  false}, // MarketSegmentGrp
+{tag::NoSecurityClassifications,               205,  false}, // SecurityClassificationGrp
+{tag::ListUpdateAction,                        -1,   false},
+{tag::CorporateAction,                         -1,   false},
+{0,                                            3,    false}, // Instrument
+{0,                                            4,    false}, // InstrumentExtension
+{0,                                            130,  false}, // SecondaryPriceLimits
+{tag::Currency,                                -1,   false},
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::RelSymTransactTime,                      -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::DerivativeSecurityXMLLen,                -1,   false},
+{tag::DerivativeSecurityXML,                   -1,   false},
+{tag::DerivativeSecurityXMLSchema,             -1,   false},
+{tag::UnderlyingLegSecurityAltID,              -1,   false},
+{tag::UnderlyingLegSecurityAltIDSource,        -1,   false},
+{tag::UnderlyingLegSymbol,                     -1,   false},
+{tag::UnderlyingLegSymbolSfx,                  -1,   false},
+{tag::UnderlyingLegSecurityID,                 -1,   false},
+{tag::UnderlyingLegSecurityIDSource,           -1,   false},
+{tag::NoUnderlyingLegSecurityAltID,            152,  false}, // UnderlyingLegSecurityAltIDGrp
+{tag::UnderlyingLegCFICode,                    -1,   false},
+{tag::UnderlyingLegSecurityType,               -1,   false},
+{tag::UnderlyingLegSecuritySubType,            -1,   false},
+{tag::UnderlyingLegMaturityMonthYear,          -1,   false},
+{tag::UnderlyingLegMaturityDate,               -1,   false},
+{tag::UnderlyingLegMaturityTime,               -1,   false},
+{tag::UnderlyingLegStrikePrice,                -1,   false},
+{tag::UnderlyingLegOptAttribute,               -1,   false},
+{tag::UnderlyingLegPutOrCall,                  -1,   false},
+{tag::UnderlyingLegSecurityExchange,           -1,   false},
+{tag::UnderlyingLegSecurityDesc,               -1,   false},
+{0,                                            153,  false}, // UnderlyingLegInstrument
+{tag::Username,                                -1,   false},
+{tag::NotAffOrigClOrdID,                       -1,   false},
+{tag::NotAffectedOrderID,                      -1,   false},
+{tag::NotAffSecondaryOrderID,                  -1,   false},
+{tag::NotAffectedReason,                       -1,   false},
+{tag::FillExecID,                              -1,   false},
+{tag::FillPx,                                  -1,   false},
+{tag::FillQty,                                 -1,   false},
+{tag::FillMatchID,                             -1,   false},
+{tag::FillMatchSubID,                          -1,   false},
+{tag::FillLiquidityInd,                        -1,   false},
+{tag::FillYieldType,                           -1,   false},
+{tag::FillYield,                               -1,   false},
+{tag::NoNested4PartyIDs,                       164,  false}, // NestedParties4
+{tag::TrdRepPartyRole,                         -1,   false},
+{tag::TrdRepIndicator,                         -1,   false},
+{tag::ApplID,                                  -1,   false},
+{tag::ApplSeqNum,                              -1,   false},
+{tag::ApplLastSeqNum,                          -1,   false},
+{tag::ApplResendFlag,                          -1,   false},
+{tag::RefApplID,                               -1,   false},
+{tag::RefApplReqID,                            -1,   false},
+{tag::ApplBegSeqNum,                           -1,   false},
+{tag::ApplEndSeqNum,                           -1,   false},
+{tag::NoNestedPartyIDs,                        8,    false}, // NestedParties
+{tag::RefApplID,                               -1,   false},
+{tag::RefApplReqID,                            -1,   false},
+{tag::ApplBegSeqNum,                           -1,   false},
+{tag::ApplEndSeqNum,                           -1,   false},
+{tag::RefApplLastSeqNum,                       -1,   false},
+{tag::ApplResponseError,                       -1,   false},
+{tag::NoNestedPartyIDs,                        8,    false}, // NestedParties
+{tag::RefApplID,                               -1,   false},
+{tag::ApplNewSeqNum,                           -1,   false},
+{tag::RefApplLastSeqNum,                       -1,   false},
+{tag::Nested4PartySubID,                       -1,   false},
+{tag::Nested4PartySubIDType,                   -1,   false},
+{tag::Nested4PartyID,                          -1,   false},
+{tag::Nested4PartyIDSource,                    -1,   false},
+{tag::Nested4PartyRole,                        -1,   false},
+{tag::Nested4PartyRoleQualifier,               -1,   false},
+{tag::NoNested4PartySubIDs,                    163,  false}, // NstdPtys4SubGrp
+{tag::OrderID,                                 -1,   false},
+{tag::SecondaryOrderID,                        -1,   false},
+{tag::ClOrdID,                                 -1,   false},
+{tag::SecondaryClOrdID,                        -1,   false},
+{tag::ListID,                                  -1,   false},
+{tag::RefOrderID,                              -1,   false},
+{tag::RefOrderIDSource,                        -1,   false},
+{tag::RefOrdIDReason,                          -1,   false},
+{tag::PreTradeAnonymity,                       -1,   false},
+{tag::OrdType,                                 -1,   false},
+{tag::Price,                                   -1,   false},
+{tag::StopPx,                                  -1,   false},
+{tag::ExecInst,                                -1,   false},
+{tag::OrdStatus,                               -1,   false},
+{0,                                            9,    false}, // OrderQtyData
+{tag::LeavesQty,                               -1,   false},
+{tag::CumQty,                                  -1,   false},
+{tag::TimeInForce,                             -1,   false},
+{tag::ExpireTime,                              -1,   false},
+{tag::NoMatchInst,                             176,  false}, // MatchingInstructions
+{tag::SelfMatchPreventionID,                   -1,   false},
+{tag::ExposureDuration,                        -1,   false},
+{tag::ExposureDurationUnit,                    -1,   false},
+{0,                                            115,  false}, // DisplayInstruction
+{tag::OrderCapacity,                           -1,   false},
+{tag::OrderRestrictions,                       -1,   false},
+{tag::BookingType,                             -1,   false},
+{tag::OrigCustOrderCapacity,                   -1,   false},
+{tag::OrderOrigination,                        -1,   false},
+{tag::NoOrderAttributes,                       709,  false}, // OrderAttributeGrp
+{tag::ExDestinationType,                       -1,   false},
+{tag::OrderInputDevice,                        -1,   false},
+{tag::LotType,                                 -1,   false},
+{tag::TransBkdTime,                            -1,   false},
+{tag::OrigOrdModTime,                          -1,   false},
+{tag::OrderPercentOfTotalVolume,               -1,   false},
+{tag::RateSource,                              -1,   false},
+{tag::RateSourceType,                          -1,   false},
+{tag::ReferencePage,                           -1,   false},
+{tag::RateSourceReferemcePageHeading,          -1,   false},
+{tag::TargetPartyID,                           -1,   false},
+{tag::TargetPartyIDSource,                     -1,   false},
+{tag::TargetPartyRole,                         -1,   false},
+{tag::TargetPartyRoleQualifier,                -1,   false},
+{tag::NoTargetPartySubIDs,                     578,  false}, // TargetPtysSubGrp
+{tag::NewsRefID,                               -1,   false},
+{tag::NewsRefType,                             -1,   false},
+{tag::ComplexEventType,                        -1,   false},
+{tag::ComplexOptPayoutPaySide,                 -1,   false},
+{tag::ComplexOptPayoutReceiveSide,             -1,   false},
+{tag::ComplexOptPayoutUnderlier,               -1,   false},
+{tag::ComplexOptPayoutAmount,                  -1,   false},
+{tag::ComplexOptPayoutPercentage,              -1,   false},
+{tag::ComplexOptPayoutTime,                    -1,   false},
+{tag::ComplexOptPayoutCurrency,                -1,   false},
+{tag::ComplexEventPrice,                       -1,   false},
+{tag::ComplexEventPricePercentage,             -1,   false},
+{tag::ComplexEventPriceBoundaryMethod,         -1,   false},
+{tag::ComplexEventPriceBoundaryPrecision,      -1,   false},
+{tag::ComplexEventPriceTimeType,               -1,   false},
+{tag::ComplexEventCondition,                   -1,   false},
+{tag::NoComplexEventDates,                     170,  false}, // ComplexEventDates
+{tag::ComplexEventCurrencyOne,                 -1,   false},
+{tag::ComplexEventCurrencyTwo,                 -1,   false},
+{tag::ComplexEventQuoteBasis,                  -1,   false},
+{tag::ComplexEventFixedFXRate,                 -1,   false},
+{tag::ComplexEventSpotRate,                    -1,   false},
+{tag::ComplexEventForwardPoints,               -1,   false},
+{tag::ComplexEventDeterminationMethod,         -1,   false},
+{tag::ComplexEventCalculationAgent,            -1,   false},
+{tag::ComplexEventStrikePrice,                 -1,   false},
+{tag::ComplexEventStrikeFactor,                -1,   false},
+{tag::ComplexEventStrikeNumberOfOptions,       -1,   false},
+{tag::NoComplexEventRateSources,               404,  false}, // ComplexEventRateSourceGrp
+{0,                                            406,  false}, // ComplexEventRelativeDate
+{tag::NoComplexEventPeriods,                   403,  false}, // ComplexEventPeriodGrp
+{tag::ComplexEventCreditEventsXIDRef,          -1,   false},
+{tag::ComplexEventCreditEventNotifyingParty,   -1,   false},
+{tag::ComplexEventCreditEventBusinessCenter,   -1,   false},
+{tag::ComplexEventCreditEventStandardSources,  -1,   false},
+{tag::ComplexEventCreditEventMinimumSources,   -1,   false},
+{tag::NoComplexEventCreditEventSources,        407,  false}, // ComplexEventCreditEventSourceGrp
+{tag::NoComplexEventCreditEvents,              400,  false}, // ComplexEventCreditEventGrp
+{tag::ComplexEventFuturesPriceValuation,       -1,   false},
+{tag::ComplexEventOptionsPriceValuation,       -1,   false},
+{tag::ComplexEventPVFinalPriceElectionFallback, -1,   false},
+{tag::ComplexEventXID,                         -1,   false},
+{tag::ComplexEventXIDRef,                      -1,   false},
+{tag::ComplexEventStartDate,                   -1,   false},
+{tag::ComplexEventEndDate,                     -1,   false},
+{tag::NoComplexEventTimes,                     171,  false}, // ComplexEventTimes
+{tag::ComplexEventStartTime,                   -1,   false},
+{tag::ComplexEventEndTime,                     -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::NoRelatedSym,                            174,  false}, // StrmAsgnReqInstrmtGrp
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::NoRelatedSym,                            175,  false}, // StrmAsgnRptInstrmtGrp
+{0,                                            3,    false}, // Instrument
+{tag::SettlType,                               -1,   false},
+{tag::MDEntrySize,                             -1,   false},
+{tag::MDStreamID,                              -1,   false},
+{0,                                            3,    false}, // Instrument
+{tag::SettlType,                               -1,   false},
+{tag::StreamAsgnType,                          -1,   false},
+{tag::MDStreamID,                              -1,   false},
+{tag::StreamAsgnRejReason,                     -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::MatchInst,                               -1,   false},
+{tag::MatchInstMarketID,                       -1,   false},
+{tag::MatchAttribTagID,                        -1,   false},
+{tag::MatchAttribValue,                        -1,   false},
+{tag::LimitAmtType,                            -1,   false},
+{tag::LastLimitAmt,                            -1,   false},
+{tag::LimitAmtRemaining,                       -1,   false},
+{tag::LimitUtilizationAmt,                     -1,   false},
+{tag::LimitAmt,                                -1,   false},
+{tag::LimitAmtCurrency,                        -1,   false},
+{tag::LimitRole,                               -1,   false},
+{tag::MarginReqmtInqQualifier,                 -1,   false},
+{tag::MarginAmt,                               -1,   false},
+{tag::MarginAmtType,                           -1,   false},
+{tag::MarginAmtCcy,                            -1,   false},
+{tag::MarginAmtFXRate,                         -1,   false},
+{tag::MarginAmtFXRateCalc,                     -1,   false},
+{tag::MarginAmountMarketSegmentID,             -1,   false},
+{tag::MarginAmountMarketID,                    -1,   false},
+{tag::RelatedInstrumentType,                   -1,   false},
+{tag::RelatedSymbol,                           -1,   false},
+{tag::RelatedSecurityID,                       -1,   false},
+{tag::RelatedSecurityIDSource,                 -1,   false},
+{tag::RelatedSecurityType,                     -1,   false},
+{tag::RelatedMaturityMonthYear,                -1,   false},
+{tag::RelatedToSecurityID,                     -1,   false},
+{tag::RelatedToSecurityIDSource,               -1,   false},
+{tag::RelatedToStreamXIDRef,                   -1,   false},
+{tag::RelatedToDividendPeriodXIDRef,           -1,   false},
+{tag::RequestedPartyRole,                      -1,   false},
+{tag::RequestedPartyRoleQualifier,             -1,   false},
+{tag::PartyRelationship,                       -1,   false},
+{tag::PartyDetailID,                           -1,   false},
+{tag::PartyDetailIDSource,                     -1,   false},
+{tag::PartyDetailRole,                         -1,   false},
+{tag::PartyDetailRoleQualifier,                -1,   false},
+{tag::NoPartyDetailSubIDs,                     202,  false}, // PartyDetailSubGrp
+{tag::NoPartyDetailAltID,                      184,  false}, // PartyDetailAltIDGrp
+{tag::NoRelatedPartyDetailID,                  190,  false}, // RelatedPartyDetailGrp
+{tag::PartyDetailStatus,                       -1,   false},
+{tag::PartyDetailAltID,                        -1,   false},
+{tag::PartyDetailAltIDSource,                  -1,   false},
+{tag::NoPartyDetailAltSubIDs,                  185,  false}, // PartyDetailAltSubGrp
+{tag::PartyDetailAltSubID,                     -1,   false},
+{tag::PartyDetailAltSubIDType,                 -1,   false},
+{tag::RiskLimitType,                           -1,   false},
+{tag::RiskLimitAmount,                         -1,   false},
+{tag::RiskLimitAction,                         -1,   false},
+{tag::RiskLimitUtilizationAmount,              -1,   false},
+{tag::RiskLimitUtilizationPercent,             -1,   false},
+{tag::RiskLimitCurrency,                       -1,   false},
+{tag::RiskLimitPlatform,                       -1,   false},
+{tag::RiskLimitVelocityPeriod,                 -1,   false},
+{tag::RiskLimitVelocityUnit,                   -1,   false},
+{tag::NoRiskWarningLevels,                     189,  false}, // RiskWarningLevelGrp
+{tag::InstrumentScopeSymbol,                   -1,   false},
+{tag::InstrumentScopeSymbolSfx,                -1,   false},
+{tag::InstrumentScopeSecurityID,               -1,   false},
+{tag::InstrumentScopeSecurityIDSource,         -1,   false},
+{tag::NoInstrumentScopeSecurityAltID,          188,  false}, // InstrumentScopeSecurityAltIDGrp
+{tag::InstrumentScopeProduct,                  -1,   false},
+{tag::InstrumentScopeProductComplex,           -1,   false},
+{tag::InstrumentScopeSecurityGroup,            -1,   false},
+{tag::InstrumentScopeCFICode,                  -1,   false},
+{tag::InstrumentScopeSecurityType,             -1,   false},
+{tag::InstrumentScopeSecuritySubType,          -1,   false},
+{tag::InstrumentScopeMaturityMonthYear,        -1,   false},
+{tag::InstrumentScopeMaturityTime,             -1,   false},
+{tag::InstrumentScopeRestructuringType,        -1,   false},
+{tag::InstrumentScopeSeniority,                -1,   false},
+{tag::InstrumentScopePutOrCall,                -1,   false},
+{tag::InstrumentScopeFlexibleIndicator,        -1,   false},
+{tag::InstrumentScopeCouponRate,               -1,   false},
+{tag::InstrumentScopeSecurityExchange,         -1,   false},
+{tag::InstrumentScopeSecurityDesc,             -1,   false},
+{tag::InstrumentScopeEncodedSecurityDescLen,   -1,   false},
+{tag::InstrumentScopeEncodedSecurityDesc,      -1,   false},
+{tag::InstrumentScopeSettlType,                -1,   false},
+{tag::InstrumentScopeSecurityAltID,            -1,   false},
+{tag::InstrumentScopeSecurityAltIDSource,      -1,   false},
+{tag::RiskWarningLevelAction,                  -1,   false},
+{tag::RiskWarningLevelPercent,                 -1,   false},
+{tag::RiskWarningLevelAmount,                  -1,   false},
+{tag::RiskWarningLevelName,                    -1,   false},
+{tag::RelatedPartyDetailID,                    -1,   false},
+{tag::RelatedPartyDetailIDSource,              -1,   false},
+{tag::RelatedPartyDetailRole,                  -1,   false},
+{tag::RelatedPartyDetailRoleQualifier,         -1,   false},
+{tag::NoRelatedPartyDetailSubIDs,              191,  false}, // RelatedPartyDetailSubGrp
+{tag::NoRelatedPartyDetailAltID,               192,  false}, // RelatedPartyDetailAltIDGrp
+{tag::NoPartyRelationships,                    182,  false}, // PartyRelationshipGrp
+{tag::RelatedPartyDetailSubID,                 -1,   false},
+{tag::RelatedPartyDetailSubIDType,             -1,   false},
+{tag::RelatedPartyDetailAltID,                 -1,   false},
+{tag::RelatedPartyDetailAltIDSource,           -1,   false},
+{tag::NoRelatedPartyDetailAltSubIDs,           193,  false}, // RelatedPartyDetailAltSubGrp
+{tag::RelatedPartyDetailAltSubID,              -1,   false},
+{tag::RelatedPartyDetailAltSubIDType,          -1,   false},
+{tag::InstrumentScopeOperator,                 -1,   false},
+{0,                                            187,  false}, // InstrumentScope
+{tag::InstrumentScopeOperator,                 -1,   false},
+{0,                                            187,  false}, // InstrumentScope
+{tag::RiskInstrumentMultiplier,                -1,   false},
+{tag::RequestingPartyID,                       -1,   false},
+{tag::RequestingPartyIDSource,                 -1,   false},
+{tag::RequestingPartyRole,                     -1,   false},
+{tag::RequestingPartyRoleQualifier,            -1,   false},
+{tag::NoRequestingPartySubIDs,                 197,  false}, // RequestingPartySubGrp
+{tag::RequestingPartySubID,                    -1,   false},
+{tag::RequestingPartySubIDType,                -1,   false},
+{tag::ListUpdateAction,                        -1,   false},
+{tag::NoPartyDetails,                          183,  false}, // PartyDetailGrp
+{tag::RiskLimitType,                           -1,   false},
+{tag::NoPartyDetails,                          183,  false}, // PartyDetailGrp
+{tag::NoRiskLimits,                            201,  false}, // RiskLimitsGrp
+{tag::RiskLimitID,                             -1,   false},
+{tag::RiskLimitCheckModelType,                 -1,   false},
+{tag::PartyRiskLimitStatus,                    -1,   false},
+{tag::NoRiskLimitTypes,                        186,  false}, // RiskLimitTypesGrp
+{tag::NoRiskInstrumentScopes,                  195,  false}, // RiskInstrumentScopeGrp
+{tag::PartyDetailSubID,                        -1,   false},
+{tag::PartyDetailSubIDType,                    -1,   false},
+{0,                                            3,    false}, // Instrument
+{0,                                            4,    false}, // InstrumentExtension
+{0,                                            2,    false}, // FinancingDetails
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::NoRelatedInstruments,                    180,  false}, // RelatedInstrumentGrp
+{tag::SecurityTradingStatus,                   -1,   false},
+{tag::SecurityTradingEvent,                    -1,   false},
+{tag::HaltReason,                              -1,   false},
+{tag::FinancialStatus,                         -1,   false},
+{tag::CorporateAction,                         -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::LegPosAmt,                               -1,   false},
+{tag::LegPosAmtType,                           -1,   false},
+{tag::LegPosCurrency,                          -1,   false},
+{tag::LegPosAmtReason,                         -1,   false},
+{tag::SecurityClassificationReason,            -1,   false},
+{tag::SecurityClassificationValue,             -1,   false},
+{tag::ThrottleAction,                          -1,   false},
+{tag::ThrottleType,                            -1,   false},
+{tag::ThrottleNoMsgs,                          -1,   false},
+{tag::ThrottleTimeInterval,                    -1,   false},
+{tag::ThrottleTimeUnit,                        -1,   false},
+{tag::NoThrottleMsgType,                       207,  false}, // ThrottleMsgTypeGrp
+{tag::ThrottleMsgType,                         -1,   false},
+{tag::ThrottleInst,                            -1,   false},
+{tag::ThrottleStatus,                          -1,   false},
+{tag::ThrottleCountIndicator,                  -1,   false},
+{tag::SettlementAmount,                        -1,   false},
+{tag::SettlementAmountCurrency,                -1,   false},
+{tag::CurrentCollateralAmount,                 -1,   false},
+{tag::CollateralCurrency,                      -1,   false},
+{tag::CollateralAmountType,                    -1,   false},
+{tag::CollateralFXRate,                        -1,   false},
+{tag::CollateralFXRateCalc,                    -1,   false},
+{tag::CollateralType,                          -1,   false},
+{tag::CollateralAmountMarketSegmentID,         -1,   false},
+{tag::CollateralAmountMarketID,                -1,   false},
+{tag::HaircutIndicator,                        -1,   false},
+{tag::CollateralPortfolioID,                   -1,   false},
+{tag::CollateralPercentOverage,                -1,   false},
+{tag::CollateralMarketPrice,                   -1,   false},
+{tag::PayCollectType,                          -1,   false},
+{tag::PayCollectCurrency,                      -1,   false},
+{tag::PayCollectFXRate,                        -1,   false},
+{tag::PayCollectFXRateCalc,                    -1,   false},
+{tag::PayAmount,                               -1,   false},
+{tag::CollectAmount,                           -1,   false},
+{tag::PayCollectMarketSegmentID,               -1,   false},
+{tag::PayCollectMarketID,                      -1,   false},
+{tag::ListUpdateAction,                        -1,   false},
+{tag::NoPartyDetails,                          183,  false}, // PartyDetailGrp
+{tag::NoRiskLimits,                            201,  false}, // RiskLimitsGrp
+{tag::RiskLimitID,                             -1,   false},
+{tag::RiskLimitCheckModelType,                 -1,   false},
+{tag::PartyRiskLimitStatus,                    -1,   false},
+{tag::ListUpdateAction,                        -1,   false},
+{tag::RiskLimitStatus,                         -1,   false},
+{tag::RiskLimitResult,                         -1,   false},
+{tag::NoPartyDetails,                          183,  false}, // PartyDetailGrp
+{tag::NoRiskLimits,                            201,  false}, // RiskLimitsGrp
+{tag::RiskLimitID,                             -1,   false},
+{tag::RiskLimitCheckModelType,                 -1,   false},
+{tag::RejectText,                              -1,   false},
+{tag::EncodedRejectTextLen,                    -1,   false},
+{tag::EncodedRejectText,                       -1,   false},
+{tag::PartyRiskLimitStatus,                    -1,   false},
+{tag::NoPartyDetails,                          183,  false}, // PartyDetailGrp
+{tag::EntitlementStatus,                       -1,   false},
+{tag::NoEntitlements,                          215,  false}, // EntitlementGrp
+{tag::EntitlementIndicator,                    -1,   false},
+{tag::EntitlementType,                         -1,   false},
+{tag::EntitlementSubType,                      -1,   false},
+{tag::NoEntitlementAttrib,                     216,  false}, // EntitlementAttribGrp
+{tag::EntitlementID,                           -1,   false},
+{tag::EntitlementPlatform,                     -1,   false},
+{tag::NoInstrumentScopes,                      194,  false}, // InstrumentScopeGrp
+{tag::NoMarketSegments,                        217,  false}, // MarketSegmentScopeGrp
+{tag::EntitlementStartDate,                    -1,   false},
+{tag::EntitlementEndDate,                      -1,   false},
+{tag::EntitlementAttribType,                   -1,   false},
+{tag::EntitlementAttribDatatype,               -1,   false},
+{tag::EntitlementAttribValue,                  -1,   false},
+{tag::EntitlementAttribCurrency,               -1,   false},
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::TargetMarketSegmentID,                   -1,   false},
+{tag::AffectedMarketSegmentID,                 -1,   false},
+{tag::NotAffectedMarketSegmentID,              -1,   false},
+{tag::OrderEventType,                          -1,   false},
+{tag::OrderEventExecID,                        -1,   false},
+{tag::OrderEventReason,                        -1,   false},
+{tag::OrderEventPx,                            -1,   false},
+{tag::OrderEventQty,                           -1,   false},
+{tag::OrderEventLiquidityIndicator,            -1,   false},
+{tag::OrderEventText,                          -1,   false},
+{tag::DisclosureType,                          -1,   false},
+{tag::DisclosureInstruction,                   -1,   false},
+{tag::LegRefID,                                -1,   false},
+{tag::LegOrderQty,                             -1,   false},
+{tag::LegSwapType,                             -1,   false},
+{tag::NoLegStipulations,                       7,    false}, // LegStipulations
+{tag::LegAllocID,                              -1,   false},
+{tag::NoLegAllocs,                             50,   false}, // LegPreAllocGrp
+{tag::LegClearingAccountType,                  -1,   false},
+{tag::LegPositionEffect,                       -1,   false},
+{tag::LegCoveredOrUncovered,                   -1,   false},
+{tag::NoNested3PartyIDs,                       25,   false}, // NestedParties3
+{tag::LegSettlType,                            -1,   false},
+{tag::LegSettlDate,                            -1,   false},
+{tag::LegSettlCurrency,                        -1,   false},
+{tag::LegVolatility,                           -1,   false},
+{tag::LegDividendYield,                        -1,   false},
+{tag::LegCurrencyRatio,                        -1,   false},
+{tag::LegExecInst,                             -1,   false},
+{tag::LegShortSaleExemptionReason,             -1,   false},
+{tag::TradeAllocAmtType,                       -1,   false},
+{tag::TradeAllocAmt,                           -1,   false},
+{tag::TradeAllocCurrency,                      -1,   false},
+{tag::TradeAllocAmtReason,                     -1,   false},
+{tag::TradePriceCondition,                     -1,   false},
+{tag::TradeQtyType,                            -1,   false},
+{tag::TradeQty,                                -1,   false},
+{tag::PosType,                                 -1,   false},
+{tag::LongQty,                                 -1,   false},
+{tag::ShortQty,                                -1,   false},
+{tag::CoveredQty,                              -1,   false},
+{tag::PosQtyStatus,                            -1,   false},
+{tag::QuantityDate,                            -1,   false},
+{tag::RelatedTradeID,                          -1,   false},
+{tag::RelatedTradeIDSource,                    -1,   false},
+{tag::RelatedRegulatoryTradeIDSource,          -1,   false},
+{tag::RelatedTradeDate,                        -1,   false},
+{tag::RelatedTradeMarketID,                    -1,   false},
+{tag::RelatedTradeQuantity,                    -1,   false},
+{tag::RelatedPositionID,                       -1,   false},
+{tag::RelatedPositionIDSource,                 -1,   false},
+{tag::RelatedPositionDate,                     -1,   false},
+{tag::ValueCheckType,                          -1,   false},
+{tag::ValueCheckAction,                        -1,   false},
+{tag::LegSecurityXMLLen,                       -1,   false},
+{tag::LegSecurityXML,                          -1,   false},
+{tag::LegSecurityXMLSchema,                    -1,   false},
+{tag::UnderlyingSecurityXMLLen,                -1,   false},
+{tag::UnderlyingSecurityXML,                   -1,   false},
+{tag::UnderlyingSecurityXMLSchema,             -1,   false},
+{tag::ListUpdateAction,                        -1,   false},
+{tag::PartyDetailDefinitionStatus,             -1,   false},
+{tag::PartyDetailDefinitionResult,             -1,   false},
+{tag::RejectText,                              -1,   false},
+{tag::EncodedRejectTextLen,                    -1,   false},
+{tag::EncodedRejectText,                       -1,   false},
+{tag::NoPartyDetails,                          183,  false}, // PartyDetailGrp
+{tag::ListUpdateAction,                        -1,   false},
+{tag::NoPartyDetails,                          183,  false}, // PartyDetailGrp
+{tag::EntitlementStatus,                       -1,   false},
+{tag::NoEntitlements,                          215,  false}, // EntitlementGrp
+{tag::EntitlementRefID,                        -1,   false},
+{tag::ListUpdateAction,                        -1,   false},
+{tag::EntitlementStatus,                       -1,   false},
+{tag::EntitlementResult,                       -1,   false},
+{tag::RejectText,                              -1,   false},
+{tag::EncodedRejectTextLen,                    -1,   false},
+{tag::EncodedRejectText,                       -1,   false},
+{tag::NoPartyDetails,                          183,  false}, // PartyDetailGrp
+{tag::NoEntitlements,                          215,  false}, // EntitlementGrp
+{tag::EntitlementRefID,                        -1,   false},
+{0,                                            3,    false}, // Instrument
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::TrdMatchSubID,                           -1,   false},
+{tag::Quantity,                                -1,   false},
+{tag::Currency,                                -1,   false},
+{tag::SettlCurrency,                           -1,   false},
+{tag::QtyType,                                 -1,   false},
+{tag::LastQty,                                 -1,   false},
+{tag::PriceType,                               -1,   false},
+{tag::LastPx,                                  -1,   false},
+{tag::LastMkt,                                 -1,   false},
+{tag::NoTrdMatchSides,                         237,  false}, // TrdMatchSideGrp
+{tag::Side,                                    -1,   false},
+{tag::SideExecID,                              -1,   false},
+{tag::SideExecRefID,                           -1,   false},
+{tag::SideTradeID,                             -1,   false},
+{tag::SideTradeReportID,                       -1,   false},
+{tag::OrderDelay,                              -1,   false},
+{tag::OrderDelayUnit,                          -1,   false},
+{tag::SideLastQty,                             -1,   false},
+{tag::SideClearingTradePrice,                  -1,   false},
+{tag::SidePriceDifferential,                   -1,   false},
+{tag::SideClearingTradePriceType,              -1,   false},
+{tag::SideFillStationCd,                       -1,   false},
+{tag::SideReasonCd,                            -1,   false},
+{tag::SideTrdSubTyp,                           -1,   false},
+{tag::NetGrossInd,                             -1,   false},
+{tag::SideCurrency,                            -1,   false},
+{tag::SideSettlCurrency,                       -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::TradeInputSource,                        -1,   false},
+{tag::TradeInputDevice,                        -1,   false},
+{tag::ComplianceID,                            -1,   false},
+{tag::ComplianceText,                          -1,   false},
+{tag::EncodedComplianceTextLen,                -1,   false},
+{tag::EncodedComplianceText,                   -1,   false},
+{tag::SolicitedFlag,                           -1,   false},
+{tag::CustOrderCapacity,                       -1,   false},
+{tag::TimeBracket,                             -1,   false},
+{tag::PositionEffect,                          -1,   false},
+{tag::ExchangeRule,                            -1,   false},
+{tag::TradeAllocIndicator,                     -1,   false},
+{tag::PreallocMethod,                          -1,   false},
+{tag::AllocID,                                 -1,   false},
+{tag::NoAllocs,                                84,   false}, // TrdAllocGrp
+{tag::SideGrossTradeAmt,                       -1,   false},
+{tag::AggressorIndicator,                      -1,   false},
+{tag::ExchangeSpecialInstructions,             -1,   false},
+{tag::SideShortSaleExemptionReason,            -1,   false},
+{tag::OrderCategory,                           -1,   false},
+{tag::AvgPxIndicator,                          -1,   false},
+{tag::AvgPxGroupID,                            -1,   false},
+{tag::SideMarketSegmentID,                     -1,   false},
+{tag::SideVenueType,                           -1,   false},
+{tag::ClearingFeeIndicator,                    -1,   false},
+{0,                                            165,  false}, // TradeReportOrderDetail
+{tag::NoLegExecs,                              238,  false}, // TrdInstrmtLegExecGrp
+{tag::CustOrderHandlingInst,                   -1,   false},
+{tag::OrderHandlingInstSource,                 -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::LegRefID,                                -1,   false},
+{tag::LegExecID,                               -1,   false},
+{tag::LegExecRefID,                            -1,   false},
+{tag::LegTradeID,                              -1,   false},
+{tag::LegTradeReportID,                        -1,   false},
+{tag::LegOrderQty,                             -1,   false},
+{tag::LegPositionEffect,                       -1,   false},
+{tag::LegCoveredOrUncovered,                   -1,   false},
+{tag::NoNested3PartyIDs,                       25,   false}, // NestedParties3
+{tag::LegLastPx,                               -1,   false},
+{tag::LegPriceType,                            -1,   false},
+{tag::LegSettlCurrency,                        -1,   false},
+{tag::LegShortSaleExemptionReason,             -1,   false},
+{tag::LegLastQty,                              -1,   false},
+{tag::LegQtyType,                              -1,   false},
+{tag::NoPriceMovementValues,                   240,  false}, // PriceMovementValueGrp
+{tag::NoClearingAccountTypes,                  241,  false}, // ClearingAccountTypeGrp
+{tag::PriceMovementValue,                      -1,   false},
+{tag::PriceMovementPoint,                      -1,   false},
+{tag::PriceMovementType,                       -1,   false},
+{tag::ClearingAccountType,                     -1,   false},
+{tag::AdditionalTermBondSecurityID,            -1,   false},
+{tag::AdditionalTermBondSecurityIDSource,      -1,   false},
+{tag::AdditionalTermBondDesc,                  -1,   false},
+{tag::EncodedAdditionalTermBondDescLen,        -1,   false},
+{tag::EncodedAdditionalTermBondDesc,           -1,   false},
+{tag::AdditionalTermBondCurrency,              -1,   false},
+{tag::AdditionalTermBondIssuer,                -1,   false},
+{tag::EncodedAdditionalTermBondIssuerLen,      -1,   false},
+{tag::EncodedAdditionalTermBondIssuer,         -1,   false},
+{tag::AdditionalTermBondSeniority,             -1,   false},
+{tag::AdditionalTermBondCouponType,            -1,   false},
+{tag::AdditionalTermBondCouponRate,            -1,   false},
+{tag::AdditionalTermBondMaturityDate,          -1,   false},
+{tag::AdditionalTermBondParValue,              -1,   false},
+{tag::AdditionalTermBondCurrentTotalIssuedAmount, -1,   false},
+{tag::AdditionalTermBondCouponFrequencyPeriod, -1,   false},
+{tag::AdditionalTermBondCouponFrequencyUnit,   -1,   false},
+{tag::AdditionalTermBondDayCount,              -1,   false},
+{tag::AdditionalTermConditionPrecedentBondIndicator, -1,   false},
+{tag::AdditionalTermDiscrepancyClauseIndicator, -1,   false},
+{tag::NoAdditionalTermBondRefs,                242,  false}, // AdditionalTermBondRefGrp
+{tag::AllocRegulatoryTradeID,                  -1,   false},
+{tag::AllocRegulatoryTradeIDSource,            -1,   false},
+{tag::AllocRegulatoryTradeIDEvent,             -1,   false},
+{tag::AllocRegulatoryTradeIDType,              -1,   false},
+{tag::AllocRegulatoryLegRefID,                 -1,   false},
+{tag::AllocRegulatoryTradeIDScope,             -1,   false},
+{tag::CashSettlCurrency,                       -1,   false},
+{tag::CashSettlValuationFirstBusinessDayOffset, -1,   false},
+{tag::CashSettlValuationSubsequentBusinessDaysOffset, -1,   false},
+{tag::CashSettlNumOfValuationDates,            -1,   false},
+{tag::CashSettlValuationTime,                  -1,   false},
+{tag::CashSettlBusinessCenter,                 -1,   false},
+{tag::CashSettlQuoteMethod,                    -1,   false},
+{tag::CashSettlQuoteAmount,                    -1,   false},
+{tag::CashSettlQuoteCurrency,                  -1,   false},
+{tag::CashSettlMinimumQuoteAmount,             -1,   false},
+{tag::CashSettlMinimumQuoteCurrency,           -1,   false},
+{tag::NoCashSettlDealers,                      334,  false}, // CashSettlDealerGrp
+{tag::CashSettlPriceSource,                    -1,   false},
+{tag::CashSettlPriceDefault,                   -1,   false},
+{tag::CashSettlBusinessDays,                   -1,   false},
+{tag::CashSettlAmount,                         -1,   false},
+{0,                                            596,  false}, // CashSettlDate
+{tag::CashSettlRecoveryFactor,                 -1,   false},
+{tag::CashSettlFixedTermIndicator,             -1,   false},
+{tag::CashSettlAccruedInterestIndicator,       -1,   false},
+{tag::CashSettlValuationMethod,                -1,   false},
+{tag::CashSettlTermXID,                        -1,   false},
+{tag::ContractualDefinition,                   -1,   false},
+{tag::ContractualMatrixSource,                 -1,   false},
+{tag::ContractualMatrixDate,                   -1,   false},
+{tag::ContractualMatrixTerm,                   -1,   false},
+{tag::FinancingTermSupplementDesc,             -1,   false},
+{tag::FinancingTermSupplementDate,             -1,   false},
+{tag::LegEventType,                            -1,   false},
+{tag::LegEventDate,                            -1,   false},
+{tag::LegEventTime,                            -1,   false},
+{tag::LegEventTimeUnit,                        -1,   false},
+{tag::LegEventTimePeriod,                      -1,   false},
+{tag::LegEventMonthYear,                       -1,   false},
+{tag::LegEventPx,                              -1,   false},
+{tag::LegEventText,                            -1,   false},
+{tag::EncodedLegEventTextLen,                  -1,   false},
+{tag::EncodedLegEventText,                     -1,   false},
+{tag::LegPaymentScheduleType,                  -1,   false},
+{tag::LegPaymentScheduleXID,                   -1,   false},
+{tag::LegPaymentScheduleXIDRef,                -1,   false},
+{tag::LegPaymentScheduleStubType,              -1,   false},
+{tag::LegPaymentScheduleStartDateUnadjusted,   -1,   false},
+{tag::LegPaymentScheduleEndDateUnadjusted,     -1,   false},
+{tag::LegPaymentSchedulePaySide,               -1,   false},
+{tag::LegPaymentScheduleReceiveSide,           -1,   false},
+{tag::LegPaymentScheduleNotional,              -1,   false},
+{tag::LegPaymentScheduleCurrency,              -1,   false},
+{tag::LegPaymentScheduleRate,                  -1,   false},
+{tag::LegPaymentScheduleRateMultiplier,        -1,   false},
+{tag::LegPaymentScheduleRateSpread,            -1,   false},
+{tag::LegPaymentScheduleRateCurrency,          -1,   false},
+{tag::LegPaymentScheduleRateUnitOfMeasure,     -1,   false},
+{tag::LegPaymentScheduleRateConversionFactor,  -1,   false},
+{tag::LegPaymentScheduleRateSpreadType,        -1,   false},
+{tag::LegPaymentScheduleRateSpreadPositionType, -1,   false},
+{tag::LegPaymentScheduleRateTreatment,         -1,   false},
+{tag::LegPaymentScheduleFixedAmount,           -1,   false},
+{tag::LegPaymentScheduleFixedCurrency,         -1,   false},
+{tag::LegPaymentScheduleSettlPeriodPrice,      -1,   false},
+{tag::LegPaymentScheduleSettlPeriodPriceCurrency, -1,   false},
+{tag::LegPaymentScheduleSettlPeriodPriceUnitOfMeasure, -1,   false},
+{tag::LegPaymentScheduleStepUnitOfMeasure,     -1,   false},
+{tag::LegPaymentScheduleStepFrequencyPeriod,   -1,   false},
+{tag::LegPaymentScheduleStepFrequencyUnit,     -1,   false},
+{tag::LegPaymentScheduleStepOffsetValue,       -1,   false},
+{tag::LegPaymentScheduleStepRate,              -1,   false},
+{tag::LegPaymentScheduleStepOffsetRate,        -1,   false},
+{tag::LegPaymentScheduleStepRelativeTo,        -1,   false},
+{tag::NoLegPaymentScheduleRateSources,         251,  false}, // LegPaymentScheduleRateSourceGrp
+{tag::LegPaymentScheduleFixingDateUnadjusted,  -1,   false},
+{tag::LegPaymentScheduleWeight,                -1,   false},
+{tag::LegPaymentScheduleFixingDateRelativeTo,  -1,   false},
+{tag::LegPaymentScheduleFixingDateBusinessDayConvention, -1,   false},
+{tag::NoLegPaymentScheduleFixingDateBusinessCenters, 339,  false}, // LegPaymentScheduleFixingDateBusinessCenterGrp
+{tag::LegPaymentScheduleFixingDateOffsetPeriod, -1,   false},
+{tag::LegPaymentScheduleFixingDateOffsetUnit,  -1,   false},
+{tag::LegPaymentScheduleFixingDateOffsetDayType, -1,   false},
+{tag::LegPaymentScheduleFixingDayDistribution, -1,   false},
+{tag::LegPaymentScheduleFixingDayCount,        -1,   false},
+{tag::LegPaymentScheduleFixingDateAdjusted,    -1,   false},
+{tag::NoLegPaymentScheduleFixingDays,          481,  false}, // LegPaymentScheduleFixingDayGrp
+{tag::LegPaymentScheduleFixingLagPeriod,       -1,   false},
+{tag::LegPaymentScheduleFixingLagUnit,         -1,   false},
+{tag::LegPaymentScheduleFixingFirstObservationDateOffsetPeriod, -1,   false},
+{tag::LegPaymentScheduleFixingFirstObservationDateOffsetUnit, -1,   false},
+{tag::LegPaymentScheduleFixingTime,            -1,   false},
+{tag::LegPaymentScheduleFixingTimeBusinessCenter, -1,   false},
+{tag::LegPaymentScheduleInterimExchangePaymentDateRelativeTo, -1,   false},
+{tag::LegPaymentScheduleInterimExchangeDatesBusinessDayConvention, -1,   false},
+{tag::NoLegPaymentScheduleInterimExchangeDateBusinessCenters, 340,  false}, // LegPaymentScheduleInterimExchangeDateBusinessCenterGrp
+{tag::LegPaymentScheduleInterimExchangeDatesOffsetPeriod, -1,   false},
+{tag::LegPaymentScheduleInterimExchangeDatesOffsetUnit, -1,   false},
+{tag::LegPaymentScheduleInterimExchangeDatesOffsetDayType, -1,   false},
+{tag::LegPaymentScheduleInterimExchangeDateAdjusted, -1,   false},
+{tag::LegPaymentScheduleRateSource,            -1,   false},
+{tag::LegPaymentScheduleRateSourceType,        -1,   false},
+{tag::LegPaymentScheduleReferencePage,         -1,   false},
+{tag::LegPaymentStreamType,                    -1,   false},
+{tag::LegPaymentStreamMarketRate,              -1,   false},
+{tag::LegPaymentStreamDelayIndicator,          -1,   false},
+{tag::LegPaymentStreamCashSettlIndicator,      -1,   false},
+{tag::LegPaymentStreamSettlCurrency,           -1,   false},
+{tag::LegPaymentStreamDayCount,                -1,   false},
+{tag::LegPaymentStreamAccrualDays,             -1,   false},
+{tag::LegPaymentStreamDiscountType,            -1,   false},
+{tag::LegPaymentStreamDiscountRate,            -1,   false},
+{tag::LegPaymentStreamDiscountRateDayCount,    -1,   false},
+{tag::LegPaymentStreamCompoundingMethod,       -1,   false},
+{tag::LegPaymentStreamCompoundingXIDRef,       -1,   false},
+{tag::LegPaymentStreamCompoundingSpread,       -1,   false},
+{tag::LegPaymentStreamInterpolationMethod,     -1,   false},
+{tag::LegPaymentStreamInterpolationPeriod,     -1,   false},
+{tag::LegPaymentStreamInitialPrincipalExchangeIndicator, -1,   false},
+{tag::LegPaymentStreamInterimPrincipalExchangeIndicator, -1,   false},
+{tag::LegPaymentStreamFinalPrincipalExchangeIndicator, -1,   false},
+{tag::LegPaymentStreamFlatRateIndicator,       -1,   false},
+{tag::LegPaymentStreamFlatRateAmount,          -1,   false},
+{tag::LegPaymentStreamFlatRateCurrency,        -1,   false},
+{tag::LegStreamMaximumPaymentAmount,           -1,   false},
+{tag::LegStreamMaximumPaymentCurrency,         -1,   false},
+{tag::LegStreamMaximumTransactionAmount,       -1,   false},
+{tag::LegStreamMaximumTransactionCurrency,     -1,   false},
+{0,                                            257,  false}, // LegPaymentStreamPaymentDates
+{0,                                            258,  false}, // LegPaymentStreamResetDates
+{0,                                            253,  false}, // LegPaymentStreamFixedRate
+{0,                                            254,  false}, // LegPaymentStreamFloatingRate
+{tag::LegPaymentStreamCompoundingFixedRate,    -1,   false},
+{0,                                            623,  false}, // LegPaymentStreamCompoundingFloatingRate
+{0,                                            620,  false}, // LegPaymentStreamCompoundingDates
+{0,                                            256,  false}, // LegPaymentStreamNonDeliverableSettlTerms
+{tag::LegPaymentStreamRate,                    -1,   false},
+{tag::LegPaymentStreamFixedAmount,             -1,   false},
+{tag::LegPaymentStreamRateOrAmountCurrency,    -1,   false},
+{tag::LegPaymentStreamFixedAmountUnitOfMeasure, -1,   false},
+{tag::LegPaymentStreamTotalFixedAmount,        -1,   false},
+{tag::LegPaymentStreamFutureValueNotional,     -1,   false},
+{tag::LegPaymentStreamFutureValueDateAdjusted, -1,   false},
+{tag::LegPaymentStreamWorldScaleRate,          -1,   false},
+{tag::LegPaymentStreamContractPrice,           -1,   false},
+{tag::LegPaymentStreamContractPriceCurrency,   -1,   false},
+{tag::LegPaymentStreamRateIndex,               -1,   false},
+{tag::LegPaymentStreamRateIndexSource,         -1,   false},
+{tag::LegPaymentStreamRateIndexID,             -1,   false},
+{tag::LegPaymentStreamRateIndexIDSource,       -1,   false},
+{tag::LegPaymentStreamRateIndexCurveUnit,      -1,   false},
+{tag::LegPaymentStreamRateIndexCurvePeriod,    -1,   false},
+{tag::LegPaymentStreamRateIndex2CurveUnit,     -1,   false},
+{tag::LegPaymentStreamRateIndex2CurvePeriod,   -1,   false},
+{tag::LegPaymentStreamRateIndexLocation,       -1,   false},
+{tag::LegPaymentStreamRateIndexLevel,          -1,   false},
+{tag::LegPaymentStreamRateIndexUnitOfMeasure,  -1,   false},
+{tag::LegPaymentStreamSettlLevel,              -1,   false},
+{tag::LegPaymentStreamReferenceLevel,          -1,   false},
+{tag::LegPaymentStreamReferenceLevelUnitOfMeasure, -1,   false},
+{tag::LegPaymentStreamReferenceLevelEqualsZeroIndicator, -1,   false},
+{tag::LegPaymentStreamRateMultiplier,          -1,   false},
+{tag::LegPaymentStreamRateSpread,              -1,   false},
+{tag::LegPaymentStreamRateSpreadCurrency,      -1,   false},
+{tag::LegPaymentStreamRateSpreadUnitOfMeasure, -1,   false},
+{tag::LegPaymentStreamRateConversionFactor,    -1,   false},
+{tag::LegPaymentStreamRateSpreadType,          -1,   false},
+{tag::LegPaymentStreamRateSpreadPositionType,  -1,   false},
+{tag::LegPaymentStreamRateTreatment,           -1,   false},
+{tag::LegPaymentStreamCapRate,                 -1,   false},
+{tag::LegPaymentStreamCapRateBuySide,          -1,   false},
+{tag::LegPaymentStreamCapRateSellSide,         -1,   false},
+{tag::LegPaymentStreamFloorRate,               -1,   false},
+{tag::LegPaymentStreamFloorRateBuySide,        -1,   false},
+{tag::LegPaymentStreamFloorRateSellSide,       -1,   false},
+{tag::LegPaymentStreamInitialRate,             -1,   false},
+{tag::LegPaymentStreamLastResetRate,           -1,   false},
+{tag::LegPaymentStreamFinalRate,               -1,   false},
+{tag::LegPaymentStreamFinalRateRoundingDirection, -1,   false},
+{tag::LegPaymentStreamFinalRatePrecision,      -1,   false},
+{tag::LegPaymentStreamAveragingMethod,         -1,   false},
+{tag::LegPaymentStreamNegativeRateTreatment,   -1,   false},
+{tag::LegPaymentStreamCalculationLagPeriod,    -1,   false},
+{tag::LegPaymentStreamCalculationLagUnit,      -1,   false},
+{tag::LegPaymentStreamFirstObservationDateUnadjusted, -1,   false},
+{tag::LegPaymentStreamFirstObservationDateRelativeTo, -1,   false},
+{tag::LegPaymentStreamFirstObservationDateOffsetDayType, -1,   false},
+{tag::LegPaymentStreamFirstObservationDateOffsetPeriod, -1,   false},
+{tag::LegPaymentStreamFirstObservationDateOffsetUnit, -1,   false},
+{tag::LegPaymentStreamFirstObservationDateAdjusted, -1,   false},
+{tag::LegPaymentStreamPricingDayType,          -1,   false},
+{tag::LegPaymentStreamPricingDayDistribution,  -1,   false},
+{tag::LegPaymentStreamPricingDayCount,         -1,   false},
+{tag::LegPaymentStreamPricingBusinessCalendar, -1,   false},
+{tag::LegPaymentStreamPricingBusinessDayConvention, -1,   false},
+{tag::NoLegPaymentStreamPricingBusinessCenters, 482,  false}, // LegPaymentStreamPricingBusinessCenterGrp
+{tag::NoLegPaymentStreamPricingDays,           485,  false}, // LegPaymentStreamPricingDayGrp
+{tag::NoLegPaymentStreamPricingDates,          484,  false}, // LegPaymentStreamPricingDateGrp
+{tag::LegPaymentStreamInflationLagPeriod,      -1,   false},
+{tag::LegPaymentStreamInflationLagUnit,        -1,   false},
+{tag::LegPaymentStreamInflationLagDayType,     -1,   false},
+{tag::LegPaymentStreamInflationInterpolationMethod, -1,   false},
+{tag::LegPaymentStreamInflationIndexSource,    -1,   false},
+{tag::LegPaymentStreamInflationPublicationSource, -1,   false},
+{tag::LegPaymentStreamInflationInitialIndexLevel, -1,   false},
+{tag::LegPaymentStreamInflationFallbackBondApplicable, -1,   false},
+{tag::LegPaymentStreamFRADiscounting,          -1,   false},
+{tag::LegPaymentStreamUnderlierRefID,          -1,   false},
+{0,                                            628,  false}, // LegPaymentStreamFormula
+{0,                                            612,  false}, // LegDividendConditions
+{tag::LegReturnRateNotionalReset,              -1,   false},
+{tag::NoLegReturnRates,                        636,  false}, // LegReturnRateGrp
+{tag::LegPaymentStreamLinkInitialLevel,        -1,   false},
+{tag::LegPaymentStreamLinkClosingLevelIndicator, -1,   false},
+{tag::LegPaymentStreamLinkExpiringLevelIndicator, -1,   false},
+{tag::LegPaymentStreamLinkEstimatedTradingDays, -1,   false},
+{tag::LegPaymentStreamLinkStrikePrice,         -1,   false},
+{tag::LegPaymentStreamLinkStrikePriceType,     -1,   false},
+{tag::LegPaymentStreamLinkMaximumBoundary,     -1,   false},
+{tag::LegPaymentStreamLinkMinimumBoundary,     -1,   false},
+{tag::LegPaymentStreamLinkNumberOfDataSeries,  -1,   false},
+{tag::LegPaymentStreamVarianceUnadjustedCap,   -1,   false},
+{tag::LegPaymentStreamRealizedVarianceMethod,  -1,   false},
+{tag::LegPaymentStreamDaysAdjustmentIndicator, -1,   false},
+{tag::LegPaymentStreamNearestExchangeContractRefID, -1,   false},
+{tag::LegPaymentStreamVegaNotionalAmount,      -1,   false},
+{tag::NoLegNonDeliverableFixingDates,          -1,   false},
+{tag::LegNonDeliverableFixingDate,             -1,   false},
+{tag::LegNonDeliverableFixingDateType,         -1,   false},
+{tag::LegPaymentStreamNonDeliverableRefCurrency, -1,   false},
+{tag::LegPaymentStreamNonDeliverableFixingDatesBusinessDayConvention, -1,   false},
+{tag::NoLegPaymentStreamNonDeliverableFixingDateBusinessCenters, 341,  false}, // LegPaymentStreamNonDeliverableFixingDatesBusinessCenterGrp
+{tag::LegPaymentStreamNonDeliverableFixingDatesRelativeTo, -1,   false},
+{tag::LegPaymentStreamNonDeliverableFixingDatesOffsetPeriod, -1,   false},
+{tag::LegPaymentStreamNonDeliverableFixingDatesOffsetUnit, -1,   false},
+{tag::LegPaymentStreamNonDeliverableFixingDatesOffsetDayType, -1,   false},
+{0,                                            388,  false}, // LegPaymentStreamNonDeliverableSettlRateSource
+{0,                                            255,  false}, // LegPaymentStreamNonDeliverableFixingDateGrp
+{tag::NoLegSettlRateFallbacks,                 271,  false}, // LegSettlRateDisruptionFallbackGrp
+{tag::LegPaymentStreamPaymentDateBusinessDayConvention, -1,   false},
+{tag::NoLegPaymentStreamPaymentDateBusinessCenters, 342,  false}, // LegPaymentStreamPaymentDateBusinessCenterGrp
+{tag::NoLegPaymentStreamPaymentDates,          483,  false}, // LegPaymentStreamPaymentDateGrp
+{tag::LegPaymentStreamPaymentFrequencyPeriod,  -1,   false},
+{tag::LegPaymentStreamPaymentFrequencyUnit,    -1,   false},
+{tag::LegPaymentStreamPaymentRollConvention,   -1,   false},
+{tag::LegPaymentStreamFirstPaymentDateUnadjusted, -1,   false},
+{tag::LegPaymentStreamLastRegularPaymentDateUnadjusted, -1,   false},
+{tag::LegPaymentStreamPaymentDateRelativeTo,   -1,   false},
+{tag::LegPaymentStreamPaymentDateOffsetPeriod, -1,   false},
+{tag::LegPaymentStreamPaymentDateOffsetUnit,   -1,   false},
+{tag::LegPaymentStreamPaymentDateOffsetDayType, -1,   false},
+{tag::LegPaymentStreamMasterAgreementPaymentDatesIndicator, -1,   false},
+{0,                                            626,  false}, // LegPaymentStreamFinalPricePaymentDate
+{tag::LegPaymentStreamResetDateRelativeTo,     -1,   false},
+{tag::LegPaymentStreamResetDateBusinessDayConvention, -1,   false},
+{tag::NoLegPaymentStreamResetDateBusinessCenters, 343,  false}, // LegPaymentStreamResetDateBusinessCenterGrp
+{tag::LegPaymentStreamResetFrequencyPeriod,    -1,   false},
+{tag::LegPaymentStreamResetFrequencyUnit,      -1,   false},
+{tag::LegPaymentStreamResetWeeklyRollConvention, -1,   false},
+{tag::LegPaymentStreamInitialFixingDateRelativeTo, -1,   false},
+{tag::LegPaymentStreamInitialFixingDateBusinessDayConvention, -1,   false},
+{tag::NoLegPaymentStreamInitialFixingDateBusinessCenters, 344,  false}, // LegPaymentStreamInitialFixingDateBusinessCenterGrp
+{tag::LegPaymentStreamInitialFixingDateOffsetPeriod, -1,   false},
+{tag::LegPaymentStreamInitialFixingDateOffsetUnit, -1,   false},
+{tag::LegPaymentStreamInitialFixingDateOffsetDayType, -1,   false},
+{tag::LegPaymentStreamInitialFixingDateAdjusted, -1,   false},
+{tag::LegPaymentStreamFixingDateRelativeTo,    -1,   false},
+{tag::LegPaymentStreamFixingDateBusinessDayConvention, -1,   false},
+{tag::NoLegPaymentStreamFixingDateBusinessCenters, 345,  false}, // LegPaymentStreamFixingDateBusinessCenterGrp
+{tag::LegPaymentStreamFixingDateOffsetPeriod,  -1,   false},
+{tag::LegPaymentStreamFixingDateOffsetUnit,    -1,   false},
+{tag::LegPaymentStreamFixingDateOffsetDayType, -1,   false},
+{tag::LegPaymentStreamFixingDateAdjusted,      -1,   false},
+{tag::LegPaymentStreamRateCutoffDateOffsetPeriod, -1,   false},
+{tag::LegPaymentStreamRateCutoffDateOffsetUnit, -1,   false},
+{tag::LegPaymentStreamRateCutoffDateOffsetDayType, -1,   false},
+{tag::NoLegPaymentStreamFixingDates,           627,  false}, // LegPaymentStreamFixingDateGrp
+{tag::LegPaymentStubType,                      -1,   false},
+{tag::LegPaymentStubLength,                    -1,   false},
+{0,                                            632,  false}, // LegPaymentStubStartDate
+{0,                                            630,  false}, // LegPaymentStubEndDate
+{tag::LegPaymentStubRate,                      -1,   false},
+{tag::LegPaymentStubFixedAmount,               -1,   false},
+{tag::LegPaymentStubFixedCurrency,             -1,   false},
+{tag::LegPaymentStubIndex,                     -1,   false},
+{tag::LegPaymentStubIndexSource,               -1,   false},
+{tag::LegPaymentStubIndexCurvePeriod,          -1,   false},
+{tag::LegPaymentStubIndexCurveUnit,            -1,   false},
+{tag::LegPaymentStubIndexRateMultiplier,       -1,   false},
+{tag::LegPaymentStubIndexRateSpread,           -1,   false},
+{tag::LegPaymentStubIndexRateSpreadPositionType, -1,   false},
+{tag::LegPaymentStubIndexRateTreatment,        -1,   false},
+{tag::LegPaymentStubIndexCapRate,              -1,   false},
+{tag::LegPaymentStubIndexCapRateBuySide,       -1,   false},
+{tag::LegPaymentStubIndexCapRateSellSide,      -1,   false},
+{tag::LegPaymentStubIndexFloorRate,            -1,   false},
+{tag::LegPaymentStubIndexFloorRateBuySide,     -1,   false},
+{tag::LegPaymentStubIndexFloorRateSellSide,    -1,   false},
+{tag::LegPaymentStubIndex2,                    -1,   false},
+{tag::LegPaymentStubIndex2Source,              -1,   false},
+{tag::LegPaymentStubIndex2CurvePeriod,         -1,   false},
+{tag::LegPaymentStubIndex2CurveUnit,           -1,   false},
+{tag::LegPaymentStubIndex2RateMultiplier,      -1,   false},
+{tag::LegPaymentStubIndex2RateSpread,          -1,   false},
+{tag::LegPaymentStubIndex2RateSpreadPositionType, -1,   false},
+{tag::LegPaymentStubIndex2RateTreatment,       -1,   false},
+{tag::LegPaymentStubIndex2CapRate,             -1,   false},
+{tag::LegPaymentStubIndex2FloorRate,           -1,   false},
+{tag::LegProvisionCashSettlPaymentDateBusinessDayConvention, -1,   false},
+{tag::NoLegProvisionCashSettlPaymentDateBusinessCenters, 346,  false}, // LegProvisionCashSettlPaymentDateBusinessCenterGrp
+{tag::LegProvisionCashSettlPaymentDateRelativeTo, -1,   false},
+{tag::LegProvisionCashSettlPaymentDateOffsetPeriod, -1,   false},
+{tag::LegProvisionCashSettlPaymentDateOffsetUnit, -1,   false},
+{tag::LegProvisionCashSettlPaymentDateOffsetDayType, -1,   false},
+{tag::LegProvisionCashSettlPaymentDateRangeFirst, -1,   false},
+{tag::LegProvisionCashSettlPaymentDateRangeLast, -1,   false},
+{tag::NoLegProvisionCashSettlPaymentDates,     261,  false}, // LegProvisionCashSettlPaymentFixedDateGrp
+{tag::LegProvisionCashSettlPaymentDate,        -1,   false},
+{tag::LegProvisionCashSettlPaymentDateType,    -1,   false},
+{tag::LegProvisionCashSettlValueTime,          -1,   false},
+{tag::LegProvisionCashSettlValueTimeBusinessCenter, -1,   false},
+{tag::LegProvisionCashSettlValueDateBusinessDayConvention, -1,   false},
+{tag::NoLegProvisionCashSettlValueDateBusinessCenters, 347,  false}, // LegProvisionCashSettlValueDateBusinessCenterGrp
+{tag::LegProvisionCashSettlValueDateRelativeTo, -1,   false},
+{tag::LegProvisionCashSettlValueDateOffsetPeriod, -1,   false},
+{tag::LegProvisionCashSettlValueDateOffsetUnit, -1,   false},
+{tag::LegProvisionCashSettlValueDateOffsetDayType, -1,   false},
+{tag::LegProvisionCashSettlValueDateAdjusted,  -1,   false},
+{tag::LegProvisionOptionExerciseFixedDate,     -1,   false},
+{tag::LegProvisionOptionExerciseFixedDateType, -1,   false},
+{tag::LegProvisionOptionExerciseBusinessDayConvention, -1,   false},
+{tag::NoLegProvisionOptionExerciseBusinessCenters, 348,  false}, // LegProvisionOptionExerciseBusinessCenterGrp
+{tag::NoLegProvisionOptionExerciseFixedDates,  263,  false}, // LegProvisionOptionExerciseFixedDateGrp
+{tag::LegProvisionOptionExerciseEarliestDateOffsetPeriod, -1,   false},
+{tag::LegProvisionOptionExerciseEarliestDateOffsetUnit, -1,   false},
+{tag::LegProvisionOptionExerciseFrequencyPeriod, -1,   false},
+{tag::LegProvisionOptionExerciseFrequencyUnit, -1,   false},
+{tag::LegProvisionOptionExerciseStartDateUnadjusted, -1,   false},
+{tag::LegProvisionOptionExerciseStartDateRelativeTo, -1,   false},
+{tag::LegProvisionOptionExerciseStartDateOffsetPeriod, -1,   false},
+{tag::LegProvisionOptionExerciseStartDateOffsetUnit, -1,   false},
+{tag::LegProvisionOptionExerciseStartDateOffsetDayType, -1,   false},
+{tag::LegProvisionOptionExerciseStartDateAdjusted, -1,   false},
+{tag::LegProvisionOptionExercisePeriodSkip,    -1,   false},
+{tag::LegProvisionOptionExerciseBoundsFirstDateUnadjusted, -1,   false},
+{tag::LegProvisionOptionExerciseBoundsLastDateUnadjusted, -1,   false},
+{tag::LegProvisionOptionExerciseEarliestTime,  -1,   false},
+{tag::LegProvisionOptionExerciseEarliestTimeBusinessCenter, -1,   false},
+{tag::LegProvisionOptionExerciseLatestTime,    -1,   false},
+{tag::LegProvisionOptionExerciseLatestTimeBusinessCenter, -1,   false},
+{tag::LegProvisionOptionExpirationDateUnadjusted, -1,   false},
+{tag::LegProvisionOptionExpirationDateBusinessDayConvention, -1,   false},
+{tag::NoLegProvisionOptionExpirationDateBusinessCenters, 349,  false}, // LegProvisionOptionExpirationDateBusinessCenterGrp
+{tag::LegProvisionOptionExpirationDateRelativeTo, -1,   false},
+{tag::LegProvisionOptionExpirationDateOffsetPeriod, -1,   false},
+{tag::LegProvisionOptionExpirationDateOffsetUnit, -1,   false},
+{tag::LegProvisionOptionExpirationDateOffsetDayType, -1,   false},
+{tag::LegProvisionOptionExpirationDateAdjusted, -1,   false},
+{tag::LegProvisionOptionExpirationTime,        -1,   false},
+{tag::LegProvisionOptionExpirationTimeBusinessCenter, -1,   false},
+{tag::LegProvisionOptionRelevantUnderlyingDateUnadjusted, -1,   false},
+{tag::LegProvisionOptionRelevantUnderlyingDateBusinessDayConvention, -1,   false},
+{tag::NoLegProvisionOptionRelevantUnderlyingDateBusinessCenters, 350,  false}, // LegProvisionOptionRelevantUnderlyingDateBusinessCenterGrp
+{tag::LegProvisionOptionRelevantUnderlyingDateRelativeTo, -1,   false},
+{tag::LegProvisionOptionRelevantUnderlyingDateOffsetPeriod, -1,   false},
+{tag::LegProvisionOptionRelevantUnderlyingDateOffsetUnit, -1,   false},
+{tag::LegProvisionOptionRelevantUnderlyingDateOffsetDayType, -1,   false},
+{tag::LegProvisionOptionRelevantUnderlyingDateAdjusted, -1,   false},
+{tag::LegProvisionType,                        -1,   false},
+{tag::LegProvisionDateUnadjusted,              -1,   false},
+{tag::LegProvisionDateBusinessDayConvention,   -1,   false},
+{tag::NoLegProvisionDateBusinessCenters,       351,  false}, // LegProvisionDateBusinessCenterGrp
+{tag::LegProvisionDateAdjusted,                -1,   false},
+{tag::LegProvisionDateTenorPeriod,             -1,   false},
+{tag::LegProvisionDateTenorUnit,               -1,   false},
+{tag::LegProvisionBreakFeeElection,            -1,   false},
+{tag::LegProvisionBreakFeeRate,                -1,   false},
+{tag::LegProvisionCalculationAgent,            -1,   false},
+{tag::LegProvisionOptionSinglePartyBuyerSide,  -1,   false},
+{tag::LegProvisionOptionSinglePartySellerSide, -1,   false},
+{0,                                            262,  false}, // LegProvisionCashSettlValueDates
+{0,                                            264,  false}, // LegProvisionOptionExerciseDates
+{0,                                            265,  false}, // LegProvisionOptionExpirationDate
+{0,                                            266,  false}, // LegProvisionOptionRelevantUnderlyingDate
+{tag::LegProvisionOptionExerciseStyle,         -1,   false},
+{tag::LegProvisionOptionExerciseMultipleNotional, -1,   false},
+{tag::LegProvisionOptionExerciseMinimumNotional, -1,   false},
+{tag::LegProvisionOptionExerciseMaximumNotional, -1,   false},
+{tag::LegProvisionOptionMinimumNumber,         -1,   false},
+{tag::LegProvisionOptionMaximumNumber,         -1,   false},
+{tag::LegProvisionOptionExerciseConfirmation,  -1,   false},
+{0,                                            260,  false}, // LegProvisionCashSettlPaymentDates
+{tag::LegProvisionCashSettlMethod,             -1,   false},
+{tag::LegProvisionCashSettlCurrency,           -1,   false},
+{tag::LegProvisionCashSettlCurrency2,          -1,   false},
+{tag::LegProvisionCashSettlQuoteType,          -1,   false},
+{0,                                            395,  false}, // LegProvisionCashSettlQuoteSource
+{tag::LegProvisionText,                        -1,   false},
+{tag::EncodedLegProvisionTextLen,              -1,   false},
+{tag::EncodedLegProvisionText,                 -1,   false},
+{tag::NoLegProvisionPartyIDs,                  268,  false}, // LegProvisionParties
+{tag::LegProvisionPartyID,                     -1,   false},
+{tag::LegProvisionPartyIDSource,               -1,   false},
+{tag::LegProvisionPartyRole,                   -1,   false},
+{tag::LegProvisionPartyRoleQualifier,          -1,   false},
+{tag::NoLegProvisionPartySubIDs,               269,  false}, // LegProvisionPtysSubGrp
+{tag::LegProvisionPartySubID,                  -1,   false},
+{tag::LegProvisionPartySubIDType,              -1,   false},
+{tag::LegSecondaryAssetClass,                  -1,   false},
+{tag::LegSecondaryAssetSubClass,               -1,   false},
+{tag::LegSecondaryAssetType,                   -1,   false},
+{tag::LegSecondaryAssetSubType,                -1,   false},
+{tag::LegSettlRatePostponementMaximumDays,     -1,   false},
+{0,                                            389,  false}, // LegSettlRateFallbackRateSource
+{tag::LegSettlRatePostponementSurvey,          -1,   false},
+{tag::LegSettlRatePostponementCalculationAgent, -1,   false},
+{tag::LegStreamCalculationPeriodDatesXID,      -1,   false},
+{tag::LegStreamCalculationPeriodDatesXIDRef,   -1,   false},
+{tag::LegStreamCalculationPeriodBusinessDayConvention, -1,   false},
+{tag::NoLegStreamCalculationPeriodBusinessCenters, 352,  false}, // LegStreamCalculationPeriodBusinessCenterGrp
+{tag::NoLegStreamCalculationPeriodDates,       495,  false}, // LegStreamCalculationPeriodDateGrp
+{tag::LegStreamFirstPeriodStartDateUnadjusted, -1,   false},
+{tag::LegStreamFirstPeriodStartDateBusinessDayConvention, -1,   false},
+{tag::NoLegStreamFirstPeriodStartDateBusinessCenters, 353,  false}, // LegStreamFirstPeriodStartDateBusinessCenterGrp
+{tag::LegStreamFirstPeriodStartDateAdjusted,   -1,   false},
+{tag::LegStreamFirstRegularPeriodStartDateUnadjusted, -1,   false},
+{tag::LegStreamFirstCompoundingPeriodEndDateUnadjusted, -1,   false},
+{tag::LegStreamLastRegularPeriodEndDateUnadjusted, -1,   false},
+{tag::LegStreamCalculationFrequencyPeriod,     -1,   false},
+{tag::LegStreamCalculationFrequencyUnit,       -1,   false},
+{tag::LegStreamCalculationRollConvention,      -1,   false},
+{tag::LegStreamCalculationBalanceOfFirstPeriod, -1,   false},
+{tag::LegStreamCalculationCorrectionPeriod,    -1,   false},
+{tag::LegStreamCalculationCorrectionUnit,      -1,   false},
+{tag::LegStreamEffectiveDateUnadjusted,        -1,   false},
+{tag::LegStreamEffectiveDateBusinessDayConvention, -1,   false},
+{tag::NoLegStreamEffectiveDateBusinessCenters, 354,  false}, // LegStreamEffectiveDateBusinessCenterGrp
+{tag::LegStreamEffectiveDateRelativeTo,        -1,   false},
+{tag::LegStreamEffectiveDateOffsetPeriod,      -1,   false},
+{tag::LegStreamEffectiveDateOffsetUnit,        -1,   false},
+{tag::LegStreamEffectiveDateOffsetDayType,     -1,   false},
+{tag::LegStreamEffectiveDateAdjusted,          -1,   false},
+{tag::LegStreamType,                           -1,   false},
+{tag::LegStreamXID,                            -1,   false},
+{tag::LegStreamDesc,                           -1,   false},
+{tag::LegStreamVersion,                        -1,   false},
+{tag::LegStreamVersionEffectiveDate,           -1,   false},
+{tag::LegStreamPaySide,                        -1,   false},
+{tag::LegStreamReceiveSide,                    -1,   false},
+{tag::LegStreamNotionalXIDRef,                 -1,   false},
+{tag::LegStreamNotional,                       -1,   false},
+{tag::LegStreamCurrency,                       -1,   false},
+{tag::LegStreamNotionalDeterminationMethod,    -1,   false},
+{tag::LegStreamNotionalAdjustments,            -1,   false},
+{tag::LegStreamNotionalFrequencyPeriod,        -1,   false},
+{tag::LegStreamNotionalFrequencyUnit,          -1,   false},
+{tag::LegStreamNotionalCommodityFrequency,     -1,   false},
+{tag::LegStreamNotionalUnitOfMeasure,          -1,   false},
+{tag::LegStreamTotalNotional,                  -1,   false},
+{tag::LegStreamTotalNotionalUnitOfMeasure,     -1,   false},
+{0,                                            497,  false}, // LegStreamCommodity
+{0,                                            273,  false}, // LegStreamEffectiveDate
+{0,                                            275,  false}, // LegStreamTerminationDate
+{0,                                            272,  false}, // LegStreamCalculationPeriodDates
+{0,                                            252,  false}, // LegPaymentStream
+{tag::NoLegPaymentSchedules,                   250,  false}, // LegPaymentScheduleGrp
+{tag::NoLegPaymentStubs,                       259,  false}, // LegPaymentStubGrp
+{0,                                            464,  false}, // LegDeliveryStream
+{tag::NoLegDeliverySchedules,                  461,  false}, // LegDeliveryScheduleGrp
+{tag::LegStreamText,                           -1,   false},
+{tag::EncodedLegStreamTextLen,                 -1,   false},
+{tag::EncodedLegStreamText,                    -1,   false},
+{tag::LegStreamTerminationDateUnadjusted,      -1,   false},
+{tag::LegStreamTerminationDateBusinessDayConvention, -1,   false},
+{tag::NoLegStreamTerminationDateBusinessCenters, 355,  false}, // LegStreamTerminationDateBusinessCenterGrp
+{tag::LegStreamTerminationDateRelativeTo,      -1,   false},
+{tag::LegStreamTerminationDateOffsetPeriod,    -1,   false},
+{tag::LegStreamTerminationDateOffsetUnit,      -1,   false},
+{tag::LegStreamTerminationDateOffsetDayType,   -1,   false},
+{tag::LegStreamTerminationDateAdjusted,        -1,   false},
+{tag::PaymentType,                             -1,   false},
+{tag::PaymentSubType,                          -1,   false},
+{tag::PaymentPaySide,                          -1,   false},
+{tag::PaymentReceiveSide,                      -1,   false},
+{tag::PaymentDesc,                             -1,   false},
+{tag::PaymentCurrency,                         -1,   false},
+{tag::PaymentAmount,                           -1,   false},
+{tag::PaymentAmountRelativeTo,                 -1,   false},
+{tag::PaymentAmountDeterminationMethod,        -1,   false},
+{tag::PaymentPrice,                            -1,   false},
+{tag::PaymentPriceType,                        -1,   false},
+{tag::PaymentUnitOfMeasure,                    -1,   false},
+{tag::PaymentDateUnadjusted,                   -1,   false},
+{tag::PaymentBusinessDayConvention,            -1,   false},
+{tag::NoPaymentBusinessCenters,                356,  false}, // PaymentBusinessCenterGrp
+{tag::PaymentDateRelativeTo,                   -1,   false},
+{tag::PaymentDateOffsetPeriod,                 -1,   false},
+{tag::PaymentDateOffsetUnit,                   -1,   false},
+{tag::PaymentDateOffsetDayType,                -1,   false},
+{tag::PaymentDateAdjusted,                     -1,   false},
+{tag::PaymentForwardStartType,                 -1,   false},
+{tag::PaymentDiscountFactor,                   -1,   false},
+{tag::PaymentPresentValueAmount,               -1,   false},
+{tag::PaymentPresentValueCurrency,             -1,   false},
+{tag::PaymentSettlStyle,                       -1,   false},
+{tag::PaymentMethod,                           -1,   false},
+{tag::NoPaymentSettls,                         279,  false}, // PaymentSettlGrp
+{tag::PaymentLegRefID,                         -1,   false},
+{tag::PaymentText,                             -1,   false},
+{tag::EncodedPaymentTextLen,                   -1,   false},
+{tag::EncodedPaymentText,                      -1,   false},
+{tag::PaymentScheduleType,                     -1,   false},
+{tag::PaymentScheduleXID,                      -1,   false},
+{tag::PaymentScheduleXIDRef,                   -1,   false},
+{tag::PaymentScheduleStubType,                 -1,   false},
+{tag::PaymentScheduleStartDateUnadjusted,      -1,   false},
+{tag::PaymentScheduleEndDateUnadjusted,        -1,   false},
+{tag::PaymentSchedulePaySide,                  -1,   false},
+{tag::PaymentScheduleReceiveSide,              -1,   false},
+{tag::PaymentScheduleNotional,                 -1,   false},
+{tag::PaymentScheduleCurrency,                 -1,   false},
+{tag::PaymentScheduleRate,                     -1,   false},
+{tag::PaymentScheduleRateMultiplier,           -1,   false},
+{tag::PaymentScheduleRateSpread,               -1,   false},
+{tag::PaymentScheduleRateCurrency,             -1,   false},
+{tag::PaymentScheduleRateUnitOfMeasure,        -1,   false},
+{tag::PaymentScheduleRateConversionFactor,     -1,   false},
+{tag::PaymentScheduleRateSpreadType,           -1,   false},
+{tag::PaymentScheduleRateSpreadPositionType,   -1,   false},
+{tag::PaymentScheduleRateTreatment,            -1,   false},
+{tag::PaymentScheduleFixedAmount,              -1,   false},
+{tag::PaymentScheduleFixedCurrency,            -1,   false},
+{tag::PaymentScheduleSettlPeriodPrice,         -1,   false},
+{tag::PaymentScheduleSettlPeriodPriceCurrency, -1,   false},
+{tag::PaymentScheduleSettlPeriodPriceUnitOfMeasure, -1,   false},
+{tag::PaymentScheduleStepUnitOfMeasure,        -1,   false},
+{tag::PaymentScheduleStepFrequencyPeriod,      -1,   false},
+{tag::PaymentScheduleStepFrequencyUnit,        -1,   false},
+{tag::PaymentScheduleStepOffsetValue,          -1,   false},
+{tag::PaymentScheduleStepRate,                 -1,   false},
+{tag::PaymentScheduleStepOffsetRate,           -1,   false},
+{tag::PaymentScheduleStepRelativeTo,           -1,   false},
+{tag::NoPaymentScheduleRateSources,            278,  false}, // PaymentScheduleRateSourceGrp
+{tag::PaymentScheduleFixingDateUnadjusted,     -1,   false},
+{tag::PaymentScheduleWeight,                   -1,   false},
+{tag::PaymentScheduleFixingDateRelativeTo,     -1,   false},
+{tag::PaymentScheduleFixingDateBusinessDayConvention, -1,   false},
+{tag::NoPaymentScheduleFixingDateBusinessCenters, 357,  false}, // PaymentScheduleFixingDateBusinessCenterGrp
+{tag::PaymentScheduleFixingDateOffsetPeriod,   -1,   false},
+{tag::PaymentScheduleFixingDateOffsetUnit,     -1,   false},
+{tag::PaymentScheduleFixingDateOffsetDayType,  -1,   false},
+{tag::PaymentScheduleFixingDayDistribution,    -1,   false},
+{tag::PaymentScheduleFixingDayCount,           -1,   false},
+{tag::PaymentScheduleFixingDateAdjusted,       -1,   false},
+{tag::NoPaymentScheduleFixingDays,             426,  false}, // PaymentScheduleFixingDayGrp
+{tag::PaymentScheduleFixingLagPeriod,          -1,   false},
+{tag::PaymentScheduleFixingLagUnit,            -1,   false},
+{tag::PaymentScheduleFixingFirstObservationDateOffsetPeriod, -1,   false},
+{tag::PaymentScheduleFixingFirstObservationDateOffsetUnit, -1,   false},
+{tag::PaymentScheduleFixingTime,               -1,   false},
+{tag::PaymentScheduleFixingTimeBusinessCenter, -1,   false},
+{tag::PaymentScheduleInterimExchangePaymentDateRelativeTo, -1,   false},
+{tag::PaymentScheduleInterimExchangeDatesBusinessDayConvention, -1,   false},
+{tag::NoPaymentScheduleInterimExchangeDateBusinessCenters, 358,  false}, // PaymentScheduleInterimExchangeDateBusinessCenterGrp
+{tag::PaymentScheduleInterimExchangeDatesOffsetPeriod, -1,   false},
+{tag::PaymentScheduleInterimExchangeDatesOffsetUnit, -1,   false},
+{tag::PaymentScheduleInterimExchangeDatesOffsetDayType, -1,   false},
+{tag::PaymentScheduleInterimExchangeDateAdjusted, -1,   false},
+{tag::PaymentScheduleRateSource,               -1,   false},
+{tag::PaymentScheduleRateSourceType,           -1,   false},
+{tag::PaymentScheduleReferencePage,            -1,   false},
+{tag::PaymentSettlAmount,                      -1,   false},
+{tag::PaymentSettlCurrency,                    -1,   false},
+{tag::NoPaymentSettlPartyIDs,                  280,  false}, // PaymentSettlParties
+{tag::PaymentSettlPartyID,                     -1,   false},
+{tag::PaymentSettlPartyIDSource,               -1,   false},
+{tag::PaymentSettlPartyRole,                   -1,   false},
+{tag::PaymentSettlPartyRoleQualifier,          -1,   false},
+{tag::NoPaymentSettlPartySubIDs,               281,  false}, // PaymentSettlPtysSubGrp
+{tag::PaymentSettlPartySubID,                  -1,   false},
+{tag::PaymentSettlPartySubIDType,              -1,   false},
+{tag::PaymentStreamType,                       -1,   false},
+{tag::PaymentStreamMarketRate,                 -1,   false},
+{tag::PaymentStreamDelayIndicator,             -1,   false},
+{tag::PaymentStreamCashSettlIndicator,         -1,   false},
+{tag::PaymentStreamSettlCurrency,              -1,   false},
+{tag::PaymentStreamDayCount,                   -1,   false},
+{tag::PaymentStreamAccrualDays,                -1,   false},
+{tag::PaymentStreamDiscountType,               -1,   false},
+{tag::PaymentStreamDiscountRate,               -1,   false},
+{tag::PaymentStreamDiscountRateDayCount,       -1,   false},
+{tag::PaymentStreamCompoundingMethod,          -1,   false},
+{tag::PaymentStreamCompoundingXIDRef,          -1,   false},
+{tag::PaymentStreamCompoundingSpread,          -1,   false},
+{tag::PaymentStreamInterpolationMethod,        -1,   false},
+{tag::PaymentStreamInterpolationPeriod,        -1,   false},
+{tag::PaymentStreamInitialPrincipalExchangeIndicator, -1,   false},
+{tag::PaymentStreamInterimPrincipalExchangeIndicator, -1,   false},
+{tag::PaymentStreamFinalPrincipalExchangeIndicator, -1,   false},
+{tag::PaymentStreamFlatRateIndicator,          -1,   false},
+{tag::PaymentStreamFlatRateAmount,             -1,   false},
+{tag::PaymentStreamFlatRateCurrency,           -1,   false},
+{tag::PaymentStreamMaximumPaymentAmount,       -1,   false},
+{tag::PaymentStreamMaximumPaymentCurrency,     -1,   false},
+{tag::PaymentStreamMaximumTransactionAmount,   -1,   false},
+{tag::PaymentStreamMaximumTransactionCurrency, -1,   false},
+{0,                                            287,  false}, // PaymentStreamPaymentDates
+{0,                                            288,  false}, // PaymentStreamResetDates
+{0,                                            283,  false}, // PaymentStreamFixedRate
+{0,                                            284,  false}, // PaymentStreamFloatingRate
+{tag::PaymentStreamCompoundingFixedRate,       -1,   false},
+{0,                                            648,  false}, // PaymentStreamCompoundingFloatingRate
+{0,                                            645,  false}, // PaymentStreamCompoundingDates
+{0,                                            286,  false}, // PaymentStreamNonDeliverableSettlTerms
+{tag::PaymentStreamRate,                       -1,   false},
+{tag::PaymentStreamFixedAmount,                -1,   false},
+{tag::PaymentStreamRateOrAmountCurrency,       -1,   false},
+{tag::PaymentStreamFixedAmountUnitOfMeasure,   -1,   false},
+{tag::PaymentStreamTotalFixedAmount,           -1,   false},
+{tag::PaymentStreamFutureValueNotional,        -1,   false},
+{tag::PaymentStreamFutureValueDateAdjusted,    -1,   false},
+{tag::PaymentStreamWorldScaleRate,             -1,   false},
+{tag::PaymentStreamContractPrice,              -1,   false},
+{tag::PaymentStreamContractPriceCurrency,      -1,   false},
+{tag::PaymentStreamRateIndex,                  -1,   false},
+{tag::PaymentStreamRateIndexSource,            -1,   false},
+{tag::PaymentStreamRateIndexID,                -1,   false},
+{tag::PaymentStreamRateIndexIDSource,          -1,   false},
+{tag::PaymentStreamRateIndexCurveUnit,         -1,   false},
+{tag::PaymentStreamRateIndexCurvePeriod,       -1,   false},
+{tag::PaymentStreamRateIndex2CurvePeriod,      -1,   false},
+{tag::PaymentStreamRateIndex2CurveUnit,        -1,   false},
+{tag::PaymentStreamRateIndexLocation,          -1,   false},
+{tag::PaymentStreamRateIndexLevel,             -1,   false},
+{tag::PaymentStreamRateIndexUnitOfMeasure,     -1,   false},
+{tag::PaymentStreamSettlLevel,                 -1,   false},
+{tag::PaymentStreamReferenceLevel,             -1,   false},
+{tag::PaymentStreamReferenceLevelUnitOfMeasure, -1,   false},
+{tag::PaymentStreamReferenceLevelEqualsZeroIndicator, -1,   false},
+{tag::PaymentStreamRateMultiplier,             -1,   false},
+{tag::PaymentStreamRateSpread,                 -1,   false},
+{tag::PaymentStreamRateSpreadCurrency,         -1,   false},
+{tag::PaymentStreamRateSpreadUnitOfMeasure,    -1,   false},
+{tag::PaymentStreamRateConversionFactor,       -1,   false},
+{tag::PaymentStreamRateSpreadType,             -1,   false},
+{tag::PaymentStreamRateSpreadPositionType,     -1,   false},
+{tag::PaymentStreamRateTreatment,              -1,   false},
+{tag::PaymentStreamCapRate,                    -1,   false},
+{tag::PaymentStreamCapRateBuySide,             -1,   false},
+{tag::PaymentStreamCapRateSellSide,            -1,   false},
+{tag::PaymentStreamFloorRate,                  -1,   false},
+{tag::PaymentStreamFloorRateBuySide,           -1,   false},
+{tag::PaymentStreamFloorRateSellSide,          -1,   false},
+{tag::PaymentStreamInitialRate,                -1,   false},
+{tag::PaymentStreamLastResetRate,              -1,   false},
+{tag::PaymentStreamFinalRate,                  -1,   false},
+{tag::PaymentStreamFinalRateRoundingDirection, -1,   false},
+{tag::PaymentStreamFinalRatePrecision,         -1,   false},
+{tag::PaymentStreamAveragingMethod,            -1,   false},
+{tag::PaymentStreamNegativeRateTreatment,      -1,   false},
+{tag::PaymentStreamCalculationLagPeriod,       -1,   false},
+{tag::PaymentStreamCalculationLagUnit,         -1,   false},
+{tag::PaymentStreamFirstObservationDateUnadjusted, -1,   false},
+{tag::PaymentStreamFirstObservationDateRelativeTo, -1,   false},
+{tag::PaymentStreamFirstObservationDateOffsetDayType, -1,   false},
+{tag::PaymentStreamFirstObservationDateOffsetPeriod, -1,   false},
+{tag::PaymentStreamFirstObservationDateOffsetUnit, -1,   false},
+{tag::PaymentStreamFirstObservationDateAdjusted, -1,   false},
+{tag::PaymentStreamPricingDayType,             -1,   false},
+{tag::PaymentStreamPricingDayDistribution,     -1,   false},
+{tag::PaymentStreamPricingDayCount,            -1,   false},
+{tag::PaymentStreamPricingBusinessCalendar,    -1,   false},
+{tag::PaymentStreamPricingBusinessDayConvention, -1,   false},
+{tag::NoPaymentStreamPricingBusinessCenters,   427,  false}, // PaymentStreamPricingBusinessCenterGrp
+{tag::NoPaymentStreamPricingDays,              430,  false}, // PaymentStreamPricingDayGrp
+{tag::NoPaymentStreamPricingDates,             429,  false}, // PaymentStreamPricingDateGrp
+{tag::PaymentStreamInflationLagPeriod,         -1,   false},
+{tag::PaymentStreamInflationLagUnit,           -1,   false},
+{tag::PaymentStreamInflationLagDayType,        -1,   false},
+{tag::PaymentStreamInflationInterpolationMethod, -1,   false},
+{tag::PaymentStreamInflationIndexSource,       -1,   false},
+{tag::PaymentStreamInflationPublicationSource, -1,   false},
+{tag::PaymentStreamInflationInitialIndexLevel, -1,   false},
+{tag::PaymentStreamInflationFallbackBondApplicable, -1,   false},
+{tag::PaymentStreamFRADiscounting,             -1,   false},
+{tag::PaymentStreamUnderlierRefID,             -1,   false},
+{0,                                            654,  false}, // PaymentStreamFormula
+{0,                                            601,  false}, // DividendConditions
+{tag::ReturnRateNotionalReset,                 -1,   false},
+{tag::NoReturnRates,                           661,  false}, // ReturnRateGrp
+{tag::PaymentStreamLinkInitialLevel,           -1,   false},
+{tag::PaymentStreamLinkClosingLevelIndicator,  -1,   false},
+{tag::PaymentStreamLinkExpiringLevelIndicator, -1,   false},
+{tag::PaymentStreamLinkEstimatedTradingDays,   -1,   false},
+{tag::PaymentStreamLinkStrikePrice,            -1,   false},
+{tag::PaymentStreamLinkStrikePriceType,        -1,   false},
+{tag::PaymentStreamLinkMaximumBoundary,        -1,   false},
+{tag::PaymentStreamLinkMinimumBoundary,        -1,   false},
+{tag::PaymentStreamLinkNumberOfDataSeries,     -1,   false},
+{tag::PaymentStreamVarianceUnadjustedCap,      -1,   false},
+{tag::PaymentStreamRealizedVarianceMethod,     -1,   false},
+{tag::PaymentStreamDaysAdjustmentIndicator,    -1,   false},
+{tag::PaymentStreamNearestExchangeContractRefID, -1,   false},
+{tag::PaymentStreamVegaNotionalAmount,         -1,   false},
+{tag::NoNonDeliverableFixingDates,             -1,   false},
+{tag::NonDeliverableFixingDate,                -1,   false},
+{tag::NonDeliverableFixingDateType,            -1,   false},
+{tag::PaymentStreamNonDeliverableRefCurrency,  -1,   false},
+{tag::PaymentStreamNonDeliverableFixingDatesBusinessDayConvention, -1,   false},
+{tag::NoPaymentStreamNonDeliverableFixingDatesBusinessCenters, 359,  false}, // PaymentStreamNonDeliverableFixingDatesBusinessCenterGrp
+{tag::PaymentStreamNonDeliverableFixingDatesRelativeTo, -1,   false},
+{tag::PaymentStreamNonDeliverableFixingDatesOffsetPeriod, -1,   false},
+{tag::PaymentStreamNonDeliverableFixingDatesOffsetUnit, -1,   false},
+{tag::PaymentStreamNonDeliverableFixingDatesOffsetDayType, -1,   false},
+{0,                                            390,  false}, // PaymentStreamNonDeliverableSettlRateSource
+{0,                                            285,  false}, // PaymentStreamNonDeliverableFixingDateGrp
+{tag::NoSettlRateFallbacks,                    308,  false}, // SettlRateDisruptionFallbackGrp
+{tag::PaymentStreamPaymentDateBusinessDayConvention, -1,   false},
+{tag::NoPaymentStreamPaymentDateBusinessCenters, 360,  false}, // PaymentStreamPaymentDateBusinessCenterGrp
+{tag::NoPaymentStreamPaymentDates,             428,  false}, // PaymentStreamPaymentDateGrp
+{tag::PaymentStreamPaymentFrequencyPeriod,     -1,   false},
+{tag::PaymentStreamPaymentFrequencyUnit,       -1,   false},
+{tag::PaymentStreamPaymentRollConvention,      -1,   false},
+{tag::PaymentStreamFirstPaymentDateUnadjusted, -1,   false},
+{tag::PaymentStreamLastRegularPaymentDateUnadjusted, -1,   false},
+{tag::PaymentStreamPaymentDateRelativeTo,      -1,   false},
+{tag::PaymentStreamPaymentDateOffsetPeriod,    -1,   false},
+{tag::PaymentStreamPaymentDateOffsetUnit,      -1,   false},
+{tag::PaymentStreamPaymentDateOffsetDayType,   -1,   false},
+{tag::PaymentStreamMasterAgreementPaymentDatesIndicator, -1,   false},
+{0,                                            651,  false}, // PaymentStreamFinalPricePaymentDate
+{tag::PaymentStreamResetDateRelativeTo,        -1,   false},
+{tag::PaymentStreamResetDateBusinessDayConvention, -1,   false},
+{tag::NoPaymentStreamResetDateBusinessCenters, 361,  false}, // PaymentStreamResetDateBusinessCenterGrp
+{tag::PaymentStreamResetFrequencyPeriod,       -1,   false},
+{tag::PaymentStreamResetFrequencyUnit,         -1,   false},
+{tag::PaymentStreamResetWeeklyRollConvention,  -1,   false},
+{tag::PaymentStreamInitialFixingDateRelativeTo, -1,   false},
+{tag::PaymentStreamInitialFixingDateBusinessDayConvention, -1,   false},
+{tag::NoPaymentStreamInitialFixingDateBusinessCenters, 362,  false}, // PaymentStreamInitialFixingDateBusinessCenterGrp
+{tag::PaymentStreamInitialFixingDateOffsetPeriod, -1,   false},
+{tag::PaymentStreamInitialFixingDateOffsetUnit, -1,   false},
+{tag::PaymentStreamInitialFixingDateOffsetDayType, -1,   false},
+{tag::PaymentStreamInitialFixingDateAdjusted,  -1,   false},
+{tag::PaymentStreamFixingDateRelativeTo,       -1,   false},
+{tag::PaymentStreamFixingDateBusinessDayConvention, -1,   false},
+{tag::NoPaymentStreamFixingDateBusinessCenters, 363,  false}, // PaymentStreamFixingDateBusinessCenterGrp
+{tag::PaymentStreamFixingDateOffsetPeriod,     -1,   false},
+{tag::PaymentStreamFixingDateOffsetUnit,       -1,   false},
+{tag::PaymentStreamFixingDateOffsetDayType,    -1,   false},
+{tag::PaymentStreamFixingDateAdjusted,         -1,   false},
+{tag::PaymentStreamRateCutoffDateOffsetPeriod, -1,   false},
+{tag::PaymentStreamRateCutoffDateOffsetUnit,   -1,   false},
+{tag::PaymentStreamRateCutoffDateOffsetDayType, -1,   false},
+{0,                                            652,  false}, // PaymentStreamFixingDateGrp
+{tag::PaymentStubType,                         -1,   false},
+{tag::PaymentStubLength,                       -1,   false},
+{0,                                            657,  false}, // PaymentStubStartDate
+{0,                                            655,  false}, // PaymentStubEndDate
+{tag::PaymentStubRate,                         -1,   false},
+{tag::PaymentStubFixedAmount,                  -1,   false},
+{tag::PaymentStubFixedCurrency,                -1,   false},
+{tag::PaymentStubIndex,                        -1,   false},
+{tag::PaymentStubIndexSource,                  -1,   false},
+{tag::PaymentStubIndexCurvePeriod,             -1,   false},
+{tag::PaymentStubIndexCurveUnit,               -1,   false},
+{tag::PaymentStubIndexRateMultiplier,          -1,   false},
+{tag::PaymentStubIndexRateSpread,              -1,   false},
+{tag::PaymentStubIndexRateSpreadPositionType,  -1,   false},
+{tag::PaymentStubIndexRateTreatment,           -1,   false},
+{tag::PaymentStubIndexCapRate,                 -1,   false},
+{tag::PaymentStubIndexCapRateBuySide,          -1,   false},
+{tag::PaymentStubIndexCapRateSellSide,         -1,   false},
+{tag::PaymentStubIndexFloorRate,               -1,   false},
+{tag::PaymentStubIndexFloorRateBuySide,        -1,   false},
+{tag::PaymentStubIndexFloorRateSellSide,       -1,   false},
+{tag::PaymentStubIndex2,                       -1,   false},
+{tag::PaymentStubIndex2Source,                 -1,   false},
+{tag::PaymentStubIndex2CurvePeriod,            -1,   false},
+{tag::PaymentStubIndex2CurveUnit,              -1,   false},
+{tag::PaymentStubIndex2RateMultiplier,         -1,   false},
+{tag::PaymentStubIndex2RateSpread,             -1,   false},
+{tag::PaymentStubIndex2RateSpreadPositionType, -1,   false},
+{tag::PaymentStubIndex2RateTreatment,          -1,   false},
+{tag::PaymentStubIndex2CapRate,                -1,   false},
+{tag::PaymentStubIndex2FloorRate,              -1,   false},
+{tag::NoPhysicalSettlDeliverableObligations,   291,  false}, // PhysicalSettlDeliverableObligationGrp
+{tag::PhysicalSettlCurrency,                   -1,   false},
+{tag::PhysicalSettlBusinessDays,               -1,   false},
+{tag::PhysicalSettlMaximumBusinessDays,        -1,   false},
+{tag::PhysicalSettlTermXID,                    -1,   false},
+{tag::PhysicalSettlDeliverableObligationType,  -1,   false},
+{tag::PhysicalSettlDeliverableObligationValue, -1,   false},
+{tag::ProtectionTermNotional,                  -1,   false},
+{tag::ProtectionTermCurrency,                  -1,   false},
+{tag::ProtectionTermSellerNotifies,            -1,   false},
+{tag::ProtectionTermBuyerNotifies,             -1,   false},
+{tag::ProtectionTermEventBusinessCenter,       -1,   false},
+{tag::ProtectionTermStandardSources,           -1,   false},
+{tag::ProtectionTermEventMinimumSources,       -1,   false},
+{tag::NoProtectionTermEventNewsSources,        364,  false}, // ProtectionTermEventNewsSourceGrp
+{tag::NoProtectionTermEvents,                  293,  false}, // ProtectionTermEventGrp
+{tag::NoProtectionTermObligations,             295,  false}, // ProtectionTermObligationGrp
+{tag::ProtectionTermXID,                       -1,   false},
+{tag::ProtectionTermEventType,                 -1,   false},
+{tag::ProtectionTermEventValue,                -1,   false},
+{tag::ProtectionTermEventCurrency,             -1,   false},
+{tag::ProtectionTermEventPeriod,               -1,   false},
+{tag::ProtectionTermEventUnit,                 -1,   false},
+{tag::ProtectionTermEventDayType,              -1,   false},
+{tag::ProtectionTermEventRateSource,           -1,   false},
+{tag::NoProtectionTermEventQualifiers,         294,  false}, // ProtectionTermEventQualifierGrp
+{tag::ProtectionTermEventQualifier,            -1,   false},
+{tag::ProtectionTermObligationType,            -1,   false},
+{tag::ProtectionTermObligationValue,           -1,   false},
+{tag::ProvisionCashSettlPaymentDateBusinessDayConvention, -1,   false},
+{tag::NoProvisionCashSettlPaymentDateBusinessCenters, 365,  false}, // ProvisionCashSettlPaymentDateBusinessCenterGrp
+{tag::ProvisionCashSettlPaymentDateRelativeTo, -1,   false},
+{tag::ProvisionCashSettlPaymentDateOffsetPeriod, -1,   false},
+{tag::ProvisionCashSettlPaymentDateOffsetUnit, -1,   false},
+{tag::ProvisionCashSettlPaymentDateOffsetDayType, -1,   false},
+{tag::ProvisionCashSettlPaymentDateRangeFirst, -1,   false},
+{tag::ProvisionCashSettlPaymentDateRangeLast,  -1,   false},
+{tag::NoProvisionCashSettlPaymentDates,        297,  false}, // ProvisionCashSettlPaymentFixedDateGrp
+{tag::ProvisionCashSettlPaymentDate,           -1,   false},
+{tag::ProvisionCashSettlPaymentDateType,       -1,   false},
+{tag::ProvisionCashSettlValueTime,             -1,   false},
+{tag::ProvisionCashSettlValueTimeBusinessCenter, -1,   false},
+{tag::ProvisionCashSettlValueDateBusinessDayConvention, -1,   false},
+{tag::NoProvisionCashSettlValueDateBusinessCenters, 366,  false}, // ProvisionCashSettlValueDateBusinessCenterGrp
+{tag::ProvisionCashSettlValueDateRelativeTo,   -1,   false},
+{tag::ProvisionCashSettlValueDateOffsetPeriod, -1,   false},
+{tag::ProvisionCashSettlValueDateOffsetUnit,   -1,   false},
+{tag::ProvisionCashSettlValueDateOffsetDayType, -1,   false},
+{tag::ProvisionCashSettlValueDateAdjusted,     -1,   false},
+{tag::ProvisionOptionExerciseFixedDate,        -1,   false},
+{tag::ProvisionOptionExerciseFixedDateType,    -1,   false},
+{tag::ProvisionOptionExerciseBusinessDayConvention, -1,   false},
+{tag::NoProvisionOptionExerciseBusinessCenters, 367,  false}, // ProvisionOptionExerciseBusinessCenterGrp
+{tag::NoProvisionOptionExerciseFixedDates,     299,  false}, // ProvisionOptionExerciseFixedDateGrp
+{tag::ProvisionOptionExerciseEarliestDateOffsetPeriod, -1,   false},
+{tag::ProvisionOptionExerciseEarliestDateOffsetUnit, -1,   false},
+{tag::ProvisionOptionExerciseFrequencyPeriod,  -1,   false},
+{tag::ProvisionOptionExerciseFrequencyUnit,    -1,   false},
+{tag::ProvisionOptionExerciseStartDateUnadjusted, -1,   false},
+{tag::ProvisionOptionExerciseStartDateRelativeTo, -1,   false},
+{tag::ProvisionOptionExerciseStartDateOffsetPeriod, -1,   false},
+{tag::ProvisionOptionExerciseStartDateOffsetUnit, -1,   false},
+{tag::ProvisionOptionExerciseStartDateOffsetDayType, -1,   false},
+{tag::ProvisionOptionExerciseStartDateAdjusted, -1,   false},
+{tag::ProvisionOptionExercisePeriodSkip,       -1,   false},
+{tag::ProvisionOptionExerciseBoundsFirstDateUnadjusted, -1,   false},
+{tag::ProvisionOptionExerciseBoundsLastDateUnadjusted, -1,   false},
+{tag::ProvisionOptionExerciseEarliestTime,     -1,   false},
+{tag::ProvisionOptionExerciseEarliestTimeBusinessCenter, -1,   false},
+{tag::ProvisionOptionExerciseLatestTime,       -1,   false},
+{tag::ProvisionOptionExerciseLatestTimeBusinessCenter, -1,   false},
+{tag::ProvisionOptionExpirationDateUnadjusted, -1,   false},
+{tag::ProvisionOptionExpirationDateBusinessDayConvention, -1,   false},
+{tag::NoProvisionOptionExpirationDateBusinessCenters, 368,  false}, // ProvisionOptionExpirationDateBusinessCenterGrp
+{tag::ProvisionOptionExpirationDateRelativeTo, -1,   false},
+{tag::ProvisionOptionExpirationDateOffsetPeriod, -1,   false},
+{tag::ProvisionOptionExpirationDateOffsetUnit, -1,   false},
+{tag::ProvisionOptionExpirationDateOffsetDayType, -1,   false},
+{tag::ProvisionOptionExpirationDateAdjusted,   -1,   false},
+{tag::ProvisionOptionExpirationTime,           -1,   false},
+{tag::ProvisionOptionExpirationTimeBusinessCenter, -1,   false},
+{tag::ProvisionOptionRelevantUnderlyingDateUnadjusted, -1,   false},
+{tag::ProvisionOptionRelevantUnderlyingDateBusinessDayConvention, -1,   false},
+{tag::NoProvisionOptionRelevantUnderlyingDateBusinessCenters, 369,  false}, // ProvisionOptionRelevantUnderlyingDateBusinessCenterGrp
+{tag::ProvisionOptionRelevantUnderlyingDateRelativeTo, -1,   false},
+{tag::ProvisionOptionRelevantUnderlyingDateOffsetPeriod, -1,   false},
+{tag::ProvisionOptionRelevantUnderlyingDateOffsetUnit, -1,   false},
+{tag::ProvisionOptionRelevantUnderlyingDateOffsetDayType, -1,   false},
+{tag::ProvisionOptionRelevantUnderlyingDateAdjusted, -1,   false},
+{tag::ProvisionType,                           -1,   false},
+{tag::ProvisionDateUnadjusted,                 -1,   false},
+{tag::ProvisionDateBusinessDayConvention,      -1,   false},
+{tag::NoProvisionDateBusinessCenters,          370,  false}, // ProvisionDateBusinessCenterGrp
+{tag::ProvisionDateAdjusted,                   -1,   false},
+{tag::ProvisionDateTenorPeriod,                -1,   false},
+{tag::ProvisionDateTenorUnit,                  -1,   false},
+{tag::ProvisionBreakFeeElection,               -1,   false},
+{tag::ProvisionBreakFeeRate,                   -1,   false},
+{tag::ProvisionCalculationAgent,               -1,   false},
+{tag::ProvisionOptionSinglePartyBuyerSide,     -1,   false},
+{tag::ProvisionOptionSinglePartySellerSide,    -1,   false},
+{0,                                            298,  false}, // ProvisionCashSettlValueDates
+{0,                                            300,  false}, // ProvisionOptionExerciseDates
+{0,                                            301,  false}, // ProvisionOptionExpirationDate
+{0,                                            302,  false}, // ProvisionOptionRelevantUnderlyingDate
+{tag::ProvisionOptionExerciseStyle,            -1,   false},
+{tag::ProvisionOptionExerciseMultipleNotional, -1,   false},
+{tag::ProvisionOptionExerciseMinimumNotional,  -1,   false},
+{tag::ProvisionOptionExerciseMaximumNotional,  -1,   false},
+{tag::ProvisionOptionMinimumNumber,            -1,   false},
+{tag::ProvisionOptionMaximumNumber,            -1,   false},
+{tag::ProvisionOptionExerciseConfirmation,     -1,   false},
+{0,                                            296,  false}, // ProvisionCashSettlPaymentDates
+{tag::ProvisionCashSettlMethod,                -1,   false},
+{tag::ProvisionCashSettlCurrency,              -1,   false},
+{tag::ProvisionCashSettlCurrency2,             -1,   false},
+{tag::ProvisionCashSettlQuoteType,             -1,   false},
+{0,                                            394,  false}, // ProvisionCashSettlQuoteSource
+{tag::ProvisionText,                           -1,   false},
+{tag::EncodedProvisionTextLen,                 -1,   false},
+{tag::EncodedProvisionText,                    -1,   false},
+{tag::NoProvisionPartyIDs,                     304,  false}, // ProvisionParties
+{tag::ProvisionPartyID,                        -1,   false},
+{tag::ProvisionPartyIDSource,                  -1,   false},
+{tag::ProvisionPartyRole,                      -1,   false},
+{tag::ProvisionPartyRoleQualifier,             -1,   false},
+{tag::NoProvisionPartySubIDs,                  305,  false}, // ProvisionPtysSubGrp
+{tag::ProvisionPartySubID,                     -1,   false},
+{tag::ProvisionPartySubIDType,                 -1,   false},
+{tag::RegulatoryTradeID,                       -1,   false},
+{tag::RegulatoryTradeIDSource,                 -1,   false},
+{tag::RegulatoryTradeIDEvent,                  -1,   false},
+{tag::RegulatoryTradeIDType,                   -1,   false},
+{tag::RegulatoryLegRefID,                      -1,   false},
+{tag::RegulatoryTradeIDScope,                  -1,   false},
+{tag::SecondaryAssetClass,                     -1,   false},
+{tag::SecondaryAssetSubClass,                  -1,   false},
+{tag::SecondaryAssetType,                      -1,   false},
+{tag::SecondaryAssetSubType,                   -1,   false},
+{tag::SettlRatePostponementMaximumDays,        -1,   false},
+{0,                                            391,  false}, // SettlRateFallbackRateSource
+{tag::SettlRatePostponementSurvey,             -1,   false},
+{tag::SettlRatePostponementCalculationAgent,   -1,   false},
+{tag::SideRegulatoryTradeID,                   -1,   false},
+{tag::SideRegulatoryTradeIDSource,             -1,   false},
+{tag::SideRegulatoryTradeIDEvent,              -1,   false},
+{tag::SideRegulatoryTradeIDType,               -1,   false},
+{tag::SideRegulatoryLegRefID,                  -1,   false},
+{tag::SideRegulatoryTradeIDScope,              -1,   false},
+{tag::StreamCalculationPeriodDatesXID,         -1,   false},
+{tag::StreamCalculationPeriodDatesXIDRef,      -1,   false},
+{tag::StreamCalculationPeriodBusinessDayConvention, -1,   false},
+{tag::NoStreamCalculationPeriodBusinessCenters, 371,  false}, // StreamCalculationPeriodBusinessCenterGrp
+{tag::NoStreamCalculationPeriodDates,          434,  false}, // StreamCalculationPeriodDateGrp
+{tag::StreamFirstPeriodStartDateUnadjusted,    -1,   false},
+{tag::StreamFirstPeriodStartDateBusinessDayConvention, -1,   false},
+{tag::NoStreamFirstPeriodStartDateBusinessCenters, 372,  false}, // StreamFirstPeriodStartDateBusinessCenterGrp
+{tag::StreamFirstPeriodStartDateAdjusted,      -1,   false},
+{tag::StreamFirstRegularPeriodStartDateUnadjusted, -1,   false},
+{tag::StreamFirstCompoundingPeriodEndDateUnadjusted, -1,   false},
+{tag::StreamLastRegularPeriodEndDateUnadjusted, -1,   false},
+{tag::StreamCalculationFrequencyPeriod,        -1,   false},
+{tag::StreamCalculationFrequencyUnit,          -1,   false},
+{tag::StreamCalculationRollConvention,         -1,   false},
+{tag::StreamCalculationBalanceOfFirstPeriod,   -1,   false},
+{tag::StreamCalculationCorrectionPeriod,       -1,   false},
+{tag::StreamCalculationCorrectionUnit,         -1,   false},
+{tag::StreamEffectiveDateUnadjusted,           -1,   false},
+{tag::StreamEffectiveDateBusinessDayConvention, -1,   false},
+{tag::NoStreamEffectiveBusinessCenters,        373,  false}, // StreamEffectiveBusinessCenterGrp
+{tag::StreamEffectiveDateRelativeTo,           -1,   false},
+{tag::StreamEffectiveDateOffsetPeriod,         -1,   false},
+{tag::StreamEffectiveDateOffsetUnit,           -1,   false},
+{tag::StreamEffectiveDateOffsetDayType,        -1,   false},
+{tag::StreamEffectiveDateAdjusted,             -1,   false},
+{tag::StreamType,                              -1,   false},
+{tag::StreamXID,                               -1,   false},
+{tag::StreamDesc,                              -1,   false},
+{tag::StreamVersion,                           -1,   false},
+{tag::StreamVersionEffectiveDate,              -1,   false},
+{tag::StreamPaySide,                           -1,   false},
+{tag::StreamReceiveSide,                       -1,   false},
+{tag::StreamNotionalXIDRef,                    -1,   false},
+{tag::StreamNotional,                          -1,   false},
+{tag::StreamCurrency,                          -1,   false},
+{tag::StreamNotionalDeterminationMethod,       -1,   false},
+{tag::StreamNotionalAdjustments,               -1,   false},
+{tag::StreamNotionalFrequencyPeriod,           -1,   false},
+{tag::StreamNotionalFrequencyUnit,             -1,   false},
+{tag::StreamNotionalCommodityFrequency,        -1,   false},
+{tag::StreamNotionalUnitOfMeasure,             -1,   false},
+{tag::StreamTotalNotional,                     -1,   false},
+{tag::StreamTotalNotionalUnitOfMeasure,        -1,   false},
+{0,                                            436,  false}, // StreamCommodity
+{0,                                            311,  false}, // StreamEffectiveDate
+{0,                                            313,  false}, // StreamTerminationDate
+{0,                                            310,  false}, // StreamCalculationPeriodDates
+{0,                                            282,  false}, // PaymentStream
+{tag::NoPaymentSchedules,                      277,  false}, // PaymentScheduleGrp
+{tag::NoPaymentStubs,                          289,  false}, // PaymentStubGrp
+{0,                                            412,  false}, // DeliveryStream
+{tag::NoDeliverySchedules,                     409,  false}, // DeliveryScheduleGrp
+{tag::StreamText,                              -1,   false},
+{tag::EncodedStreamTextLen,                    -1,   false},
+{tag::EncodedStreamText,                       -1,   false},
+{tag::StreamTerminationDateUnadjusted,         -1,   false},
+{tag::StreamTerminationDateBusinessDayConvention, -1,   false},
+{tag::NoStreamTerminationDateBusinessCenters,  374,  false}, // StreamTerminationDateBusinessCenterGrp
+{tag::StreamTerminationDateRelativeTo,         -1,   false},
+{tag::StreamTerminationDateOffsetPeriod,       -1,   false},
+{tag::StreamTerminationDateOffsetUnit,         -1,   false},
+{tag::StreamTerminationDateOffsetDayType,      -1,   false},
+{tag::StreamTerminationDateAdjusted,           -1,   false},
+{tag::UnderlyingComplexEventType,              -1,   false},
+{tag::UnderlyingComplexOptPayoutPaySide,       -1,   false},
+{tag::UnderlyingComplexOptPayoutReceiveSide,   -1,   false},
+{tag::UnderlyingComplexOptPayoutUnderlier,     -1,   false},
+{tag::UnderlyingComplexOptPayoutAmount,        -1,   false},
+{tag::UnderlyingComplexOptPayoutPercentage,    -1,   false},
+{tag::UnderlyingComplexOptPayoutTime,          -1,   false},
+{tag::UnderlyingComplexOptPayoutCurrency,      -1,   false},
+{tag::UnderlyingComplexEventPrice,             -1,   false},
+{tag::UnderlyingComplexEventPricePercentage,   -1,   false},
+{tag::UnderlyingComplexEventPriceBoundaryMethod, -1,   false},
+{tag::UnderlyingComplexEventPriceBoundaryPrecision, -1,   false},
+{tag::UnderlyingComplexEventPriceTimeType,     -1,   false},
+{tag::UnderlyingComplexEventCondition,         -1,   false},
+{tag::NoUnderlyingComplexEventDates,           315,  false}, // UnderlyingComplexEventDates
+{tag::UnderlyingComplexEventCurrencyOne,       -1,   false},
+{tag::UnderlyingComplexEventCurrencyTwo,       -1,   false},
+{tag::UnderlyingComplexEventQuoteBasis,        -1,   false},
+{tag::UnderlyingComplexEventFixedFXRate,       -1,   false},
+{tag::UnderlyingComplexEventSpotRate,          -1,   false},
+{tag::UnderlyingComplexEventForwardPoints,     -1,   false},
+{tag::UnderlyingComplexEventDeterminationMethod, -1,   false},
+{tag::UnderlyingComplexEventCalculationAgent,  -1,   false},
+{tag::UnderlyingComplexEventStrikePrice,       -1,   false},
+{tag::UnderlyingComplexEventStrikeFactor,      -1,   false},
+{tag::UnderlyingComplexEventStrikeNumberOfOptions, -1,   false},
+{tag::NoUnderlyingComplexEventRateSources,     509,  false}, // UnderlyingComplexEventRateSourceGrp
+{0,                                            511,  false}, // UnderlyingComplexEventRelativeDate
+{tag::NoUnderlyingComplexEventPeriods,         508,  false}, // UnderlyingComplexEventPeriodGrp
+{tag::UnderlyingComplexEventCreditEventsXIDRef, -1,   false},
+{tag::UnderlyingComplexEventCreditEventNotifyingParty, -1,   false},
+{tag::UnderlyingComplexEventCreditEventBusinessCenter, -1,   false},
+{tag::UnderlyingComplexEventCreditEventStandardSources, -1,   false},
+{tag::UnderlyingComplexEventCreditEventMinimumSources, -1,   false},
+{tag::NoUnderlyingComplexEventCreditEventSources, 512,  false}, // UnderlyingComplexEventCreditEventSourceGrp
+{tag::NoUnderlyingComplexEventCreditEvents,    505,  false}, // UnderlyingComplexEventCreditEventGrp
+{tag::UnderlyingComplexEventFuturesPriceValuation, -1,   false},
+{tag::UnderlyingComplexEventOptionsPriceValuation, -1,   false},
+{tag::UnderlyingComplexEventPVFinalPriceElectionFallback, -1,   false},
+{tag::UnderlyingComplexEventXID,               -1,   false},
+{tag::UnderlyingComplexEventXIDRef,            -1,   false},
+{tag::UnderlyingComplexEventStartDate,         -1,   false},
+{tag::UnderlyingComplexEventEndDate,           -1,   false},
+{tag::NoUnderlyingComplexEventTimes,           316,  false}, // UnderlyingComplexEventTimes
+{tag::UnderlyingComplexEventStartTime,         -1,   false},
+{tag::UnderlyingComplexEventEndTime,           -1,   false},
+{tag::UnderlyingEventType,                     -1,   false},
+{tag::UnderlyingEventDate,                     -1,   false},
+{tag::UnderlyingEventTime,                     -1,   false},
+{tag::UnderlyingEventTimeUnit,                 -1,   false},
+{tag::UnderlyingEventTimePeriod,               -1,   false},
+{tag::UnderlyingEventMonthYear,                -1,   false},
+{tag::UnderlyingEventPx,                       -1,   false},
+{tag::UnderlyingEventText,                     -1,   false},
+{tag::EncodedUnderlyingEventTextLen,           -1,   false},
+{tag::EncodedUnderlyingEventText,              -1,   false},
+{tag::UnderlyingPaymentScheduleType,           -1,   false},
+{tag::UnderlyingPaymentScheduleXID,            -1,   false},
+{tag::UnderlyingPaymentScheduleXIDRef,         -1,   false},
+{tag::UnderlyingPaymentScheduleStubType,       -1,   false},
+{tag::UnderlyingPaymentScheduleStartDateUnadjusted, -1,   false},
+{tag::UnderlyingPaymentScheduleEndDateUnadjusted, -1,   false},
+{tag::UnderlyingPaymentSchedulePaySide,        -1,   false},
+{tag::UnderlyingPaymentScheduleReceiveSide,    -1,   false},
+{tag::UnderlyingPaymentScheduleNotional,       -1,   false},
+{tag::UnderlyingPaymentScheduleCurrency,       -1,   false},
+{tag::UnderlyingPaymentScheduleRate,           -1,   false},
+{tag::UnderlyingPaymentScheduleRateMultiplier, -1,   false},
+{tag::UnderlyingPaymentScheduleRateSpread,     -1,   false},
+{tag::UnderlyingPaymentScheduleRateCurrency,   -1,   false},
+{tag::UnderlyingPaymentScheduleRateUnitOfMeasure, -1,   false},
+{tag::UnderlyingPaymentScheduleRateConversionFactor, -1,   false},
+{tag::UnderlyingPaymentScheduleRateSpreadType, -1,   false},
+{tag::UnderlyingPaymentScheduleRateSpreadPositionType, -1,   false},
+{tag::UnderlyingPaymentScheduleRateTreatment,  -1,   false},
+{tag::UnderlyingPaymentScheduleFixedAmount,    -1,   false},
+{tag::UnderlyingPaymentScheduleFixedCurrency,  -1,   false},
+{tag::UnderlyingPaymentScheduleSettlPeriodPrice, -1,   false},
+{tag::UnderlyingPaymentScheduleSettlPeriodPriceCurrency, -1,   false},
+{tag::UnderlyingPaymentScheduleSettlPeriodPriceUnitOfMeasure, -1,   false},
+{tag::UnderlyingPaymentScheduleStepUnitOfMeasure, -1,   false},
+{tag::UnderlyingPaymentScheduleStepFrequencyPeriod, -1,   false},
+{tag::UnderlyingPaymentScheduleStepFrequencyUnit, -1,   false},
+{tag::UnderlyingPaymentScheduleStepOffsetValue, -1,   false},
+{tag::UnderlyingPaymentScheduleStepRate,       -1,   false},
+{tag::UnderlyingPaymentScheduleStepOffsetRate, -1,   false},
+{tag::UnderlyingPaymentScheduleStepRelativeTo, -1,   false},
+{tag::NoUnderlyingPaymentScheduleRateSources,  319,  false}, // UnderlyingPaymentScheduleRateSourceGrp
+{tag::UnderlyingPaymentScheduleFixingDateUnadjusted, -1,   false},
+{tag::UnderlyingPaymentScheduleWeight,         -1,   false},
+{tag::UnderlyingPaymentScheduleFixingDateRelativeTo, -1,   false},
+{tag::UnderlyingPaymentScheduleFixingDateBusinessDayCnvtn, -1,   false},
+{tag::NoUnderlyingPaymentScheduleFixingDateBusinessCenters, 377,  false}, // UnderlyingPaymentScheduleFixingDateBusinessCenterGrp
+{tag::UnderlyingPaymentScheduleFixingDateOffsetPeriod, -1,   false},
+{tag::UnderlyingPaymentScheduleFixingDateOffsetUnit, -1,   false},
+{tag::UnderlyingPaymentScheduleFixingDateOffsetDayType, -1,   false},
+{tag::UnderlyingPaymentScheduleFixingDayDistribution, -1,   false},
+{tag::UnderlyingPaymentScheduleFixingDayCount, -1,   false},
+{tag::UnderlyingPaymentScheduleFixingDateAdjusted, -1,   false},
+{tag::NoUnderlyingPaymentScheduleFixingDays,   532,  false}, // UnderlyingPaymentScheduleFixingDayGrp
+{tag::UnderlyingPaymentScheduleFixingLagPeriod, -1,   false},
+{tag::UnderlyingPaymentScheduleFixingLagUnit,  -1,   false},
+{tag::UnderlyingPaymentScheduleFixingFirstObservationDateOffsetPeriod, -1,   false},
+{tag::UnderlyingPaymentScheduleFixingFirstObservationDateOffsetUnit, -1,   false},
+{tag::UnderlyingPaymentScheduleFixingTime,     -1,   false},
+{tag::UnderlyingPaymentScheduleFixingTimeBusinessCenter, -1,   false},
+{tag::UnderlyingPaymentScheduleInterimExchangePaymentDateRelativeTo, -1,   false},
+{tag::UnderlyingPaymentScheduleInterimExchangeDatesBusinessDayConvention, -1,   false},
+{tag::NoUnderlyingPaymentScheduleInterimExchangeDateBusinessCenters, 378,  false}, // UnderlyingPaymentScheduleInterimExchangeDateBusinessCenterGrp
+{tag::UnderlyingPaymentScheduleInterimExchangeDatesOffsetPeriod, -1,   false},
+{tag::UnderlyingPaymentScheduleInterimExchangeDatesOffsetUnit, -1,   false},
+{tag::UnderlyingPaymentScheduleInterimExchangeDatesOffsetDayType, -1,   false},
+{tag::UnderlyingPaymentScheduleInterimExchangeDateAdjusted, -1,   false},
+{tag::UnderlyingPaymentScheduleRateSource,     -1,   false},
+{tag::UnderlyingPaymentScheduleRateSourceType, -1,   false},
+{tag::UnderlyingPaymentScheduleReferencePage,  -1,   false},
+{tag::UnderlyingPaymentStreamType,             -1,   false},
+{tag::UnderlyingPaymentStreamMarketRate,       -1,   false},
+{tag::UnderlyingPaymentStreamDelayIndicator,   -1,   false},
+{tag::UnderlyingPaymentStreamCashSettlIndicator, -1,   false},
+{tag::UnderlyingPaymentStreamSettlCurrency,    -1,   false},
+{tag::UnderlyingPaymentStreamDayCount,         -1,   false},
+{tag::UnderlyingPaymentStreamAccrualDays,      -1,   false},
+{tag::UnderlyingPaymentStreamDiscountType,     -1,   false},
+{tag::UnderlyingPaymentStreamDiscountRate,     -1,   false},
+{tag::UnderlyingPaymentStreamDiscountRateDayCount, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingMethod, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingXIDRef, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingSpread, -1,   false},
+{tag::UnderlyingPaymentStreamInterpolationMethod, -1,   false},
+{tag::UnderlyingPaymentStreamInterpolationPeriod, -1,   false},
+{tag::UnderlyingPaymentStreamInitialPrincipalExchangeIndicator, -1,   false},
+{tag::UnderlyingPaymentStreamInterimPrincipalExchangeIndicator, -1,   false},
+{tag::UnderlyingPaymentStreamFinalPrincipalExchangeIndicator, -1,   false},
+{tag::UnderlyingPaymentStreamFlatRateIndicator, -1,   false},
+{tag::UnderlyingPaymentStreamFlatRateAmount,   -1,   false},
+{tag::UnderlyingPaymentStreamFlatRateCurrency, -1,   false},
+{tag::UnderlyingPaymentStreamMaximumPaymentAmount, -1,   false},
+{tag::UnderlyingPaymentStreamMaximumPaymentCurrency, -1,   false},
+{tag::UnderlyingPaymentStreamMaximumTransactionAmount, -1,   false},
+{tag::UnderlyingPaymentStreamMaximumTransactionCurrency, -1,   false},
+{0,                                            325,  false}, // UnderlyingPaymentStreamPaymentDates
+{0,                                            326,  false}, // UnderlyingPaymentStreamResetDates
+{0,                                            321,  false}, // UnderlyingPaymentStreamFixedRate
+{0,                                            322,  false}, // UnderlyingPaymentStreamFloatingRate
+{tag::UnderlyingPaymentStreamCompoundingFixedRate, -1,   false},
+{0,                                            686,  false}, // UnderlyingPaymentStreamCompoundingFloatingRate
+{0,                                            683,  false}, // UnderlyingPaymentStreamCompoundingDates
+{0,                                            324,  false}, // UnderlyingPaymentStreamNonDeliverableSettlTerms
+{tag::UnderlyingPaymentStreamRate,             -1,   false},
+{tag::UnderlyingPaymentStreamFixedAmount,      -1,   false},
+{tag::UnderlyingPaymentStreamRateOrAmountCurrency, -1,   false},
+{tag::UnderlyingPaymentStreamFixedAmountUnitOfMeasure, -1,   false},
+{tag::UnderlyingPaymentStreamTotalFixedAmount, -1,   false},
+{tag::UnderlyingPaymentStreamFutureValueNotional, -1,   false},
+{tag::UnderlyingPaymentStreamFutureValueDateAdjusted, -1,   false},
+{tag::UnderlyingPaymentStreamWorldScaleRate,   -1,   false},
+{tag::UnderlyingPaymentStreamContractPrice,    -1,   false},
+{tag::UnderlyingPaymentStreamContractPriceCurrency, -1,   false},
+{tag::UnderlyingPaymentStreamRateIndex,        -1,   false},
+{tag::UnderlyingPaymentStreamRateIndexSource,  -1,   false},
+{tag::UnderlyingPaymentStreamRateIndexID,      -1,   false},
+{tag::UnderlyingPaymentStreamRateIndexIDSource, -1,   false},
+{tag::UnderlyingPaymentStreamRateIndexCurveUnit, -1,   false},
+{tag::UnderlyingPaymentStreamRateIndexCurvePeriod, -1,   false},
+{tag::UnderlyingPaymentStreamRateIndex2CurveUnit, -1,   false},
+{tag::UnderlyingPaymentStreamRateIndex2CurvePeriod, -1,   false},
+{tag::UnderlyingPaymentStreamRateIndexLocation, -1,   false},
+{tag::UnderlyingPaymentStreamRateIndexLevel,   -1,   false},
+{tag::UnderlyingPaymentStreamRateIndexUnitOfMeasure, -1,   false},
+{tag::UnderlyingPaymentStreamSettlLevel,       -1,   false},
+{tag::UnderlyingPaymentStreamReferenceLevel,   -1,   false},
+{tag::UnderlyingPaymentStreamReferenceLevelUnitOfMeasure, -1,   false},
+{tag::UnderlyingPaymentStreamReferenceLevelEqualsZeroIndicator, -1,   false},
+{tag::UnderlyingPaymentStreamRateMultiplier,   -1,   false},
+{tag::UnderlyingPaymentStreamRateSpread,       -1,   false},
+{tag::UnderlyingPaymentStreamRateSpreadCurrency, -1,   false},
+{tag::UnderlyingPaymentStreamRateSpreadUnitOfMeasure, -1,   false},
+{tag::UnderlyingPaymentStreamRateConversionFactor, -1,   false},
+{tag::UnderlyingPaymentStreamRateSpreadType,   -1,   false},
+{tag::UnderlyingPaymentStreamRateSpreadPositionType, -1,   false},
+{tag::UnderlyingPaymentStreamRateTreatment,    -1,   false},
+{tag::UnderlyingPaymentStreamCapRate,          -1,   false},
+{tag::UnderlyingPaymentStreamCapRateBuySide,   -1,   false},
+{tag::UnderlyingPaymentStreamCapRateSellSide,  -1,   false},
+{tag::UnderlyingPaymentStreamFloorRate,        -1,   false},
+{tag::UnderlyingPaymentStreamFloorRateBuySide, -1,   false},
+{tag::UnderlyingPaymentStreamFloorRateSellSide, -1,   false},
+{tag::UnderlyingPaymentStreamInitialRate,      -1,   false},
+{tag::UnderlyingPaymentStreamLastResetRate,    -1,   false},
+{tag::UnderlyingPaymentStreamFinalRate,        -1,   false},
+{tag::UnderlyingPaymentStreamFinalRateRoundingDirection, -1,   false},
+{tag::UnderlyingPaymentStreamFinalRatePrecision, -1,   false},
+{tag::UnderlyingPaymentStreamAveragingMethod,  -1,   false},
+{tag::UnderlyingPaymentStreamNegativeRateTreatment, -1,   false},
+{tag::UnderlyingPaymentStreamCalculationLagPeriod, -1,   false},
+{tag::UnderlyingPaymentStreamCalculationLagUnit, -1,   false},
+{tag::UnderlyingPaymentStreamFirstObservationDateUnadjusted, -1,   false},
+{tag::UnderlyingPaymentStreamFirstObservationDateRelativeTo, -1,   false},
+{tag::UnderlyingPaymentStreamFirstObservationDateOffsetDayType, -1,   false},
+{tag::UnderlyingPaymentStreamFirstObservationDateOffsetPeriod, -1,   false},
+{tag::UnderlyingPaymentStreamFirstObservationDateOffsetUnit, -1,   false},
+{tag::UnderlyingPaymentStreamFirstObservationDateAdjusted, -1,   false},
+{tag::UnderlyingPaymentStreamPricingDayType,   -1,   false},
+{tag::UnderlyingPaymentStreamPricingDayDistribution, -1,   false},
+{tag::UnderlyingPaymentStreamPricingDayCount,  -1,   false},
+{tag::UnderlyingPaymentStreamPricingBusinessCalendar, -1,   false},
+{tag::UnderlyingPaymentStreamPricingBusinessDayConvention, -1,   false},
+{tag::NoUnderlyingPaymentStreamPricingBusinessCenters, 533,  false}, // UnderlyingPaymentStreamPricingBusinessCenterGrp
+{tag::NoUnderlyingPaymentStreamPricingDays,    536,  false}, // UnderlyingPaymentStreamPricingDayGrp
+{tag::NoUnderlyingPaymentStreamPricingDates,   535,  false}, // UnderlyingPaymentStreamPricingDateGrp
+{tag::UnderlyingPaymentStreamInflationLagPeriod, -1,   false},
+{tag::UnderlyingPaymentStreamInflationLagUnit, -1,   false},
+{tag::UnderlyingPaymentStreamInflationLagDayType, -1,   false},
+{tag::UnderlyingPaymentStreamInflationInterpolationMethod, -1,   false},
+{tag::UnderlyingPaymentStreamInflationIndexSource, -1,   false},
+{tag::UnderlyingPaymentStreamInflationPublicationSource, -1,   false},
+{tag::UnderlyingPaymentStreamInflationInitialIndexLevel, -1,   false},
+{tag::UnderlyingPaymentStreamInflationFallbackBondApplicable, -1,   false},
+{tag::UnderlyingPaymentStreamFRADiscounting,   -1,   false},
+{tag::UnderlyingPaymentStreamUnderlierRefID,   -1,   false},
+{0,                                            691,  false}, // UnderlyingPaymentStreamFormula
+{0,                                            673,  false}, // UnderlyingDividendConditions
+{tag::UnderlyingReturnRateNotionalReset,       -1,   false},
+{tag::NoUnderlyingReturnRates,                 701,  false}, // UnderlyingReturnRateGrp
+{tag::UnderlyingPaymentStreamLinkInitialLevel, -1,   false},
+{tag::UnderlyingPaymentStreamLinkClosingLevelIndicator, -1,   false},
+{tag::UnderlyingPaymentStreamLinkExpiringLevelIndicator, -1,   false},
+{tag::UnderlyingPaymentStreamLinkEstimatedTradingDays, -1,   false},
+{tag::UnderlyingPaymentStreamLinkStrikePrice,  -1,   false},
+{tag::UnderlyingPaymentStreamLinkStrikePriceType, -1,   false},
+{tag::UnderlyingPaymentStreamLinkMaximumBoundary, -1,   false},
+{tag::UnderlyingPaymentStreamLinkMinimumBoundary, -1,   false},
+{tag::UnderlyingPaymentStreamLinkNumberOfDataSeries, -1,   false},
+{tag::UnderlyingPaymentStreamVarianceUnadjustedCap, -1,   false},
+{tag::UnderlyingPaymentStreamRealizedVarianceMethod, -1,   false},
+{tag::UnderlyingPaymentStreamDaysAdjustmentIndicator, -1,   false},
+{tag::UnderlyingPaymentStreamNearestExchangeContractRefID, -1,   false},
+{tag::UnderlyingPaymentStreamVegaNotionalAmount, -1,   false},
+{tag::NoUnderlyingNonDeliverableFixingDates,   -1,   false},
+{tag::UnderlyingNonDeliverableFixingDate,      -1,   false},
+{tag::UnderlyingNonDeliverableFixingDateType,  -1,   false},
+{tag::UnderlyingPaymentStreamNonDeliverableRefCurrency, -1,   false},
+{tag::UnderlyingPaymentStreamNonDeliverableFixingDatesBusinessDayConvention, -1,   false},
+{tag::NoUnderlyingPaymentStreamNonDeliverableFixingDatesBusinessCenters, 379,  false}, // UnderlyingPaymentStreamNonDeliverableFixingDatesBusinessCenterGrp
+{tag::UnderlyingPaymentStreamNonDeliverableFixingDatesRelativeTo, -1,   false},
+{tag::UnderlyingPaymentStreamNonDeliverableFixingDatesOffsetPeriod, -1,   false},
+{tag::UnderlyingPaymentStreamNonDeliverableFixingDatesOffsetUnit, -1,   false},
+{tag::UnderlyingPaymentStreamNonDeliverableFixingDatesOffsetDayType, -1,   false},
+{0,                                            392,  false}, // UnderlyingPaymentStreamNonDeliverableSettlRateSource
+{0,                                            323,  false}, // UnderlyingPaymentStreamNonDeliverableFixingDateGrp
+{tag::NoUnderlyingSettlRateFallbacks,          329,  false}, // UnderlyingSettlRateDisruptionFallbackGrp
+{tag::UnderlyingPaymentStreamPaymentDateBusinessDayConvention, -1,   false},
+{tag::NoUnderlyingPaymentStreamPaymentDateBusinessCenters, 380,  false}, // UnderlyingPaymentStreamPaymentDateBusinessCenterGrp
+{tag::NoUnderlyingPaymentStreamPaymentDates,   534,  false}, // UnderlyingPaymentStreamPaymentDateGrp
+{tag::UnderlyingPaymentStreamPaymentFrequencyPeriod, -1,   false},
+{tag::UnderlyingPaymentStreamPaymentFrequencyUnit, -1,   false},
+{tag::UnderlyingPaymentStreamPaymentRollConvention, -1,   false},
+{tag::UnderlyingPaymentStreamFirstPaymentDateUnadjusted, -1,   false},
+{tag::UnderlyingPaymentStreamLastRegularPaymentDateUnadjusted, -1,   false},
+{tag::UnderlyingPaymentStreamPaymentDateRelativeTo, -1,   false},
+{tag::UnderlyingPaymentStreamPaymentDateOffsetPeriod, -1,   false},
+{tag::UnderlyingPaymentStreamPaymentDateOffsetUnit, -1,   false},
+{tag::UnderlyingPaymentStreamPaymentDateOffsetDayType, -1,   false},
+{tag::UnderlyingPaymentStreamMasterAgreementPaymentDatesIndicator, -1,   false},
+{0,                                            689,  false}, // UnderlyingPaymentStreamFinalPricePaymentDate
+{tag::UnderlyingPaymentStreamResetDateRelativeTo, -1,   false},
+{tag::UnderlyingPaymentStreamResetDateBusinessDayConvention, -1,   false},
+{tag::NoUnderlyingPaymentStreamResetDateBusinessCenters, 381,  false}, // UnderlyingPaymentStreamResetDateBusinessCenterGrp
+{tag::UnderlyingPaymentStreamResetFrequencyPeriod, -1,   false},
+{tag::UnderlyingPaymentStreamResetFrequencyUnit, -1,   false},
+{tag::UnderlyingPaymentStreamResetWeeklyRollConvention, -1,   false},
+{tag::UnderlyingPaymentStreamInitialFixingDateRelativeTo, -1,   false},
+{tag::UnderlyingPaymentStreamInitialFixingDateBusinessDayConvention, -1,   false},
+{tag::NoUnderlyingPaymentStreamInitialFixingDateBusinessCenters, 382,  false}, // UnderlyingPaymentStreamInitialFixingDateBusinessCenterGrp
+{tag::UnderlyingPaymentStreamInitialFixingDateOffsetPeriod, -1,   false},
+{tag::UnderlyingPaymentStreamInitialFixingDateOffsetUnit, -1,   false},
+{tag::UnderlyingPaymentStreamInitialFixingDateOffsetDayType, -1,   false},
+{tag::UnderlyingPaymentStreamInitialFixingDateAdjusted, -1,   false},
+{tag::UnderlyingPaymentStreamFixingDateRelativeTo, -1,   false},
+{tag::UnderlyingPaymentStreamFixingDateBusinessDayConvention, -1,   false},
+{tag::NoUnderlyingPaymentStreamFixingDateBusinessCenters, 383,  false}, // UnderlyingPaymentStreamFixingDateBusinessCenterGrp
+{tag::UnderlyingPaymentStreamFixingDateOffsetPeriod, -1,   false},
+{tag::UnderlyingPaymentStreamFixingDateOffsetUnit, -1,   false},
+{tag::UnderlyingPaymentStreamFixingDateOffsetDayType, -1,   false},
+{tag::UnderlyingPaymentStreamFixingDateAdjusted, -1,   false},
+{tag::UnderlyingPaymentStreamRateCutoffDateOffsetPeriod, -1,   false},
+{tag::UnderlyingPaymentStreamRateCutoffDateOffsetUnit, -1,   false},
+{tag::UnderlyingPaymentStreamRateCutoffDateOffsetDayType, -1,   false},
+{0,                                            690,  false}, // UnderlyingPaymentStreamFixingDateGrp
+{tag::UnderlyingPaymentStubType,               -1,   false},
+{tag::UnderlyingPaymentStubLength,             -1,   false},
+{0,                                            695,  false}, // UnderlyingPaymentStubStartDate
+{0,                                            693,  false}, // UnderlyingPaymentStubEndDate
+{tag::UnderlyingPaymentStubRate,               -1,   false},
+{tag::UnderlyingPaymentStubFixedAmount,        -1,   false},
+{tag::UnderlyingPaymentStubFixedCurrency,      -1,   false},
+{tag::UnderlyingPaymentStubIndex,              -1,   false},
+{tag::UnderlyingPaymentStubIndexSource,        -1,   false},
+{tag::UnderlyingPaymentStubIndexCurvePeriod,   -1,   false},
+{tag::UnderlyingPaymentStubIndexCurveUnit,     -1,   false},
+{tag::UnderlyingPaymentStubIndexRateMultiplier, -1,   false},
+{tag::UnderlyingPaymentStubIndexRateSpread,    -1,   false},
+{tag::UnderlyingPaymentStubIndexRateSpreadPositionType, -1,   false},
+{tag::UnderlyingPaymentStubIndexRateTreatment, -1,   false},
+{tag::UnderlyingPaymentStubIndexCapRate,       -1,   false},
+{tag::UnderlyingPaymentStubIndexCapRateBuySide, -1,   false},
+{tag::UnderlyingPaymentStubIndexCapRateSellSide, -1,   false},
+{tag::UnderlyingPaymentStubIndexFloorRate,     -1,   false},
+{tag::UnderlyingPaymentStubIndexFloorRateBuySide, -1,   false},
+{tag::UnderlyingPaymentStubIndexFloorRateSellSide, -1,   false},
+{tag::UnderlyingPaymentStubIndex2,             -1,   false},
+{tag::UnderlyingPaymentStubIndex2Source,       -1,   false},
+{tag::UnderlyingPaymentStubIndex2CurvePeriod,  -1,   false},
+{tag::UnderlyingPaymentStubIndex2CurveUnit,    -1,   false},
+{tag::UnderlyingPaymentStubIndex2RateMultiplier, -1,   false},
+{tag::UnderlyingPaymentStubIndex2RateSpread,   -1,   false},
+{tag::UnderlyingPaymentStubIndex2RateSpreadPositionType, -1,   false},
+{tag::UnderlyingPaymentStubIndex2RateTreatment, -1,   false},
+{tag::UnderlyingPaymentStubIndex2CapRate,      -1,   false},
+{tag::UnderlyingPaymentStubIndex2FloorRate,    -1,   false},
+{tag::UnderlyingSecondaryAssetClass,           -1,   false},
+{tag::UnderlyingSecondaryAssetSubClass,        -1,   false},
+{tag::UnderlyingSecondaryAssetType,            -1,   false},
+{tag::UnderlyingSecondaryAssetSubType,         -1,   false},
+{tag::UnderlyingSettlRatePostponementMaximumDays, -1,   false},
+{0,                                            393,  false}, // UnderlyingSettlRateFallbackRateSource
+{tag::UnderlyingSettlRatePostponementSurvey,   -1,   false},
+{tag::UnderlyingSettlRatePostponementCalculationAgent, -1,   false},
+{tag::UnderlyingStreamCalculationPeriodDatesXID, -1,   false},
+{tag::UnderlyingStreamCalculationPeriodDatesXIDRef, -1,   false},
+{tag::UnderlyingStreamCalculationPeriodBusinessDayConvention, -1,   false},
+{tag::NoUnderlyingStreamCalculationPeriodBusinessCenters, 384,  false}, // UnderlyingStreamCalculationPeriodBusinessCenterGrp
+{tag::NoUnderlyingStreamCalculationPeriodDates, 539,  false}, // UnderlyingStreamCalculationPeriodDateGrp
+{tag::UnderlyingStreamFirstPeriodStartDateUnadjusted, -1,   false},
+{tag::UnderlyingStreamFirstPeriodStartDateBusinessDayConvention, -1,   false},
+{tag::NoUnderlyingStreamFirstPeriodStartDateBusinessCenters, 385,  false}, // UnderlyingStreamFirstPeriodStartDateBusinessCenterGrp
+{tag::UnderlyingStreamFirstPeriodStartDateAdjusted, -1,   false},
+{tag::UnderlyingStreamFirstRegularPeriodStartDateUnadjusted, -1,   false},
+{tag::UnderlyingStreamFirstCompoundingPeriodEndDateUnadjusted, -1,   false},
+{tag::UnderlyingStreamLastRegularPeriodEndDateUnadjusted, -1,   false},
+{tag::UnderlyingStreamCalculationFrequencyPeriod, -1,   false},
+{tag::UnderlyingStreamCalculationFrequencyUnit, -1,   false},
+{tag::UnderlyingStreamCalculationRollConvention, -1,   false},
+{tag::UnderlyingStreamCalculationBalanceOfFirstPeriod, -1,   false},
+{tag::UnderlyingStreamCalculationCorrectionPeriod, -1,   false},
+{tag::UnderlyingStreamCalculationCorrectionUnit, -1,   false},
+{tag::UnderlyingStreamEffectiveDateUnadjusted, -1,   false},
+{tag::UnderlyingStreamEffectiveDateBusinessDayConvention, -1,   false},
+{tag::NoUnderlyingStreamEffectiveDateBusinessCenters, 386,  false}, // UnderlyingStreamEffectiveDateBusinessCenterGrp
+{tag::UnderlyingStreamEffectiveDateRelativeTo, -1,   false},
+{tag::UnderlyingStreamEffectiveDateOffsetPeriod, -1,   false},
+{tag::UnderlyingStreamEffectiveDateOffsetUnit, -1,   false},
+{tag::UnderlyingStreamEffectiveDateOffsetDayType, -1,   false},
+{tag::UnderlyingStreamEffectiveDateAdjusted,   -1,   false},
+{tag::UnderlyingStreamType,                    -1,   false},
+{tag::UnderlyingStreamXID,                     -1,   false},
+{tag::UnderlyingStreamDesc,                    -1,   false},
+{tag::UnderlyingStreamVersion,                 -1,   false},
+{tag::UnderlyingStreamVersionEffectiveDate,    -1,   false},
+{tag::UnderlyingStreamPaySide,                 -1,   false},
+{tag::UnderlyingStreamReceiveSide,             -1,   false},
+{tag::UnderlyingStreamNotionalXIDRef,          -1,   false},
+{tag::UnderlyingStreamNotional,                -1,   false},
+{tag::UnderlyingStreamCurrency,                -1,   false},
+{tag::UnderlyingStreamNotionalDeterminationMethod, -1,   false},
+{tag::UnderlyingStreamNotionalAdjustments,     -1,   false},
+{tag::UnderlyingStreamNotionalFrequencyPeriod, -1,   false},
+{tag::UnderlyingStreamNotionalFrequencyUnit,   -1,   false},
+{tag::UnderlyingStreamNotionalCommodityFrequency, -1,   false},
+{tag::UnderlyingStreamNotionalUnitOfMeasure,   -1,   false},
+{tag::UnderlyingStreamTotalNotional,           -1,   false},
+{tag::UnderlyingStreamTotalNotionalUnitOfMeasure, -1,   false},
+{0,                                            541,  false}, // UnderlyingStreamCommodity
+{0,                                            331,  false}, // UnderlyingStreamEffectiveDate
+{0,                                            333,  false}, // UnderlyingStreamTerminationDate
+{0,                                            330,  false}, // UnderlyingStreamCalculationPeriodDates
+{0,                                            320,  false}, // UnderlyingPaymentStream
+{tag::NoUnderlyingPaymentSchedules,            318,  false}, // UnderlyingPaymentScheduleGrp
+{tag::NoUnderlyingPaymentStubs,                327,  false}, // UnderlyingPaymentStubGrp
+{0,                                            517,  false}, // UnderlyingDeliveryStream
+{tag::NoUnderlyingDeliverySchedules,           514,  false}, // UnderlyingDeliveryScheduleGrp
+{tag::UnderlyingStreamText,                    -1,   false},
+{tag::EncodedUnderlyingStreamTextLen,          -1,   false},
+{tag::EncodedUnderlyingStreamText,             -1,   false},
+{tag::UnderlyingStreamTerminationDateUnadjusted, -1,   false},
+{tag::UnderlyingStreamTerminationDateBusinessDayConvention, -1,   false},
+{tag::NoUnderlyingStreamTerminationDateBusinessCenters, 387,  false}, // UnderlyingStreamTerminationDateBusinessCenterGrp
+{tag::UnderlyingStreamTerminationDateRelativeTo, -1,   false},
+{tag::UnderlyingStreamTerminationDateOffsetPeriod, -1,   false},
+{tag::UnderlyingStreamTerminationDateOffsetUnit, -1,   false},
+{tag::UnderlyingStreamTerminationDateOffsetDayType, -1,   false},
+{tag::UnderlyingStreamTerminationDateAdjusted, -1,   false},
+{tag::CashSettlDealer,                         -1,   false},
+{tag::BusinessCenter,                          -1,   false},
+{tag::BusinessDayConvention,                   -1,   false},
+{tag::NoBusinessCenters,                       335,  false}, // BusinessCenterGrp
+{tag::DateRollConvention,                      -1,   false},
+{tag::LegBusinessCenter,                       -1,   false},
+{tag::LegBusinessDayConvention,                -1,   false},
+{tag::NoLegBusinessCenters,                    337,  false}, // LegBusinessCenterGrp
+{tag::LegDateRollConvention,                   -1,   false},
+{tag::LegPaymentScheduleFixingDateBusinessCenter, -1,   false},
+{tag::LegPaymentScheduleInterimExchangeDatesBusinessCenter, -1,   false},
+{tag::LegPaymentStreamNonDeliverableFixingDatesBusinessCenter, -1,   false},
+{tag::LegPaymentStreamPaymentDateBusinessCenter, -1,   false},
+{tag::LegPaymentStreamResetDateBusinessCenter, -1,   false},
+{tag::LegPaymentStreamInitialFixingDateBusinessCenter, -1,   false},
+{tag::LegPaymentStreamFixingDateBusinessCenter, -1,   false},
+{tag::LegProvisionCashSettlPaymentDateBusinessCenter, -1,   false},
+{tag::LegProvisionCashSettlValueDateBusinessCenter, -1,   false},
+{tag::LegProvisionOptionExerciseBusinessCenter, -1,   false},
+{tag::LegProvisionOptionExpirationDateBusinessCenter, -1,   false},
+{tag::LegProvisionOptionRelevantUnderlyingDateBusinessCenter, -1,   false},
+{tag::LegProvisionDateBusinessCenter,          -1,   false},
+{tag::LegStreamCalculationPeriodBusinessCenter, -1,   false},
+{tag::LegStreamFirstPeriodStartDateBusinessCenter, -1,   false},
+{tag::LegStreamEffectiveDateBusinessCenter,    -1,   false},
+{tag::LegStreamTerminationDateBusinessCenter,  -1,   false},
+{tag::PaymentBusinessCenter,                   -1,   false},
+{tag::PaymentScheduleFixingDateBusinessCenter, -1,   false},
+{tag::PaymentScheduleInterimExchangeDatesBusinessCenter, -1,   false},
+{tag::PaymentStreamNonDeliverableFixingDatesBusinessCenter, -1,   false},
+{tag::PaymentStreamPaymentDateBusinessCenter,  -1,   false},
+{tag::PaymentStreamResetDateBusinessCenter,    -1,   false},
+{tag::PaymentStreamInitialFixingDateBusinessCenter, -1,   false},
+{tag::PaymentStreamFixingDateBusinessCenter,   -1,   false},
+{tag::ProtectionTermEventNewsSource,           -1,   false},
+{tag::ProvisionCashSettlPaymentDateBusinessCenter, -1,   false},
+{tag::ProvisionCashSettlValueDateBusinessCenter, -1,   false},
+{tag::ProvisionOptionExerciseBusinessCenter,   -1,   false},
+{tag::ProvisionOptionExpirationDateBusinessCenter, -1,   false},
+{tag::ProvisionOptionRelevantUnderlyingDateBusinessCenter, -1,   false},
+{tag::ProvisionDateBusinessCenter,             -1,   false},
+{tag::StreamCalculationPeriodBusinessCenter,   -1,   false},
+{tag::StreamFirstPeriodStartDateBusinessCenter, -1,   false},
+{tag::StreamEffectiveDateBusinessCenter,       -1,   false},
+{tag::StreamTerminationDateBusinessCenter,     -1,   false},
+{tag::UnderlyingBusinessCenter,                -1,   false},
+{tag::UnderlyingBusinessDayConvention,         -1,   false},
+{tag::NoUnderlyingBusinessCenters,             375,  false}, // UnderlyingBusinessCenterGrp
+{tag::UnderlyingDateRollConvention,            -1,   false},
+{tag::UnderlyingPaymentScheduleFixingDateBusinessCenter, -1,   false},
+{tag::UnderlyingPaymentScheduleInterimExchangeDatesBusinessCenter, -1,   false},
+{tag::UnderlyingPaymentStreamNonDeliverableFixingDatesBusinessCenter, -1,   false},
+{tag::UnderlyingPaymentStreamPaymentDateBusinessCenter, -1,   false},
+{tag::UnderlyingPaymentStreamResetDateBusinessCenter, -1,   false},
+{tag::UnderlyingPaymentStreamInitialFixingDateBusinessCenter, -1,   false},
+{tag::UnderlyingPaymentStreamFixingDateBusinessCenter, -1,   false},
+{tag::UnderlyingStreamCalculationPeriodBusinessCenter, -1,   false},
+{tag::UnderlyingStreamFirstPeriodStartDateBusinessCenter, -1,   false},
+{tag::UnderlyingStreamEffectiveDateBusinessCenter, -1,   false},
+{tag::UnderlyingStreamTerminationDateBusinessCenter, -1,   false},
+{tag::LegPaymentStreamNonDeliverableSettlRateSource, -1,   false},
+{tag::LegPaymentStreamNonDeliverableSettlReferencePage, -1,   false},
+{tag::LegSettlRateFallbackRateSource,          -1,   false},
+{tag::LegSettlRateFallbackReferencePage,       -1,   false},
+{tag::PaymentStreamNonDeliverableSettlRateSource, -1,   false},
+{tag::PaymentStreamNonDeliverableSettlReferencePage, -1,   false},
+{tag::SettlRateFallbackRateSource,             -1,   false},
+{tag::SettlRateFallbackReferencePage,          -1,   false},
+{tag::UnderlyingPaymentStreamNonDeliverableSettlRateSource, -1,   false},
+{tag::UnderlyingPaymentStreamNonDeliverableSettlReferencePage, -1,   false},
+{tag::UnderlyingSettlRateFallbackRateSource,   -1,   false},
+{tag::UnderlyingSettlRateFallbackReferencePage, -1,   false},
+{tag::ProvisionCashSettlQuoteSource,           -1,   false},
+{tag::ProvisionCashSettlQuoteReferencePage,    -1,   false},
+{tag::LegProvisionCashSettlQuoteSource,        -1,   false},
+{tag::LegProvisionCashSettlQuoteReferencePage, -1,   false},
+{tag::AttachmentName,                          -1,   false},
+{tag::AttachmentMediaType,                     -1,   false},
+{tag::AttachmentClassification,                -1,   false},
+{tag::AttachmentExternalURL,                   -1,   false},
+{tag::AttachmentEncodingType,                  -1,   false},
+{tag::UnencodedAttachmentLen,                  -1,   false},
+{tag::EncodedAttachmentLen,                    -1,   false},
+{tag::EncodedAttachment,                       -1,   false},
+{tag::NoAttachmentKeywords,                    397,  false}, // AttachmentKeywordGrp
+{tag::AttachmentKeyword,                       -1,   false},
+{tag::AssetAttributeType,                      -1,   false},
+{tag::AssetAttributeValue,                     -1,   false},
+{tag::AssetAttributeLimit,                     -1,   false},
+{tag::ComplexEventAveragingObservationNumber,  -1,   false},
+{tag::ComplexEventAveragingWeight,             -1,   false},
+{tag::ComplexEventCreditEventType,             -1,   false},
+{tag::ComplexEventCreditEventValue,            -1,   false},
+{tag::ComplexEventCreditEventCurrency,         -1,   false},
+{tag::ComplexEventCreditEventPeriod,           -1,   false},
+{tag::ComplexEventCreditEventUnit,             -1,   false},
+{tag::ComplexEventCreditEventDayType,          -1,   false},
+{tag::ComplexEventCreditEventRateSource,       -1,   false},
+{tag::NoComplexEventCreditEventQualifiers,     401,  false}, // ComplexEventCreditEventQualifierGrp
+{tag::ComplexEventCreditEventQualifier,        -1,   false},
+{tag::ComplexEventPeriodDate,                  -1,   false},
+{tag::ComplexEventPeriodTime,                  -1,   false},
+{tag::ComplexEventPeriodType,                  -1,   false},
+{tag::ComplexEventBusinessCenter,              -1,   false},
+{tag::NoComplexEventSchedules,                 408,  false}, // ComplexEventScheduleGrp
+{tag::NoComplexEventPeriodDateTimes,           402,  false}, // ComplexEventPeriodDateGrp
+{tag::NoComplexEventAveragingObservations,     399,  false}, // ComplexEventAveragingObservationGrp
+{tag::ComplexEventRateSource,                  -1,   false},
+{tag::ComplexEventRateSourceType,              -1,   false},
+{tag::ComplexEventReferencePage,               -1,   false},
+{tag::ComplexEventReferencePageHeading,        -1,   false},
+{tag::ComplexEventDateBusinessCenter,          -1,   false},
+{tag::ComplexEventDateUnadjusted,              -1,   false},
+{tag::ComplexEventDateRelativeTo,              -1,   false},
+{tag::ComplexEventDateOffsetPeriod,            -1,   false},
+{tag::ComplexEventDateOffsetUnit,              -1,   false},
+{tag::ComplexEventDateOffsetDayType,           -1,   false},
+{tag::ComplexEventDateBusinessDayConvention,   -1,   false},
+{tag::NoComplexEventDateBusinessCenters,       405,  false}, // ComplexEventDateBusinessCenterGrp
+{tag::ComplexEventDateAdjusted,                -1,   false},
+{tag::ComplexEventFixingTime,                  -1,   false},
+{tag::ComplexEventFixingTimeBusinessCenter,    -1,   false},
+{tag::ComplexEventCreditEventSource,           -1,   false},
+{tag::ComplexEventScheduleStartDate,           -1,   false},
+{tag::ComplexEventScheduleEndDate,             -1,   false},
+{tag::ComplexEventScheduleFrequencyPeriod,     -1,   false},
+{tag::ComplexEventScheduleFrequencyUnit,       -1,   false},
+{tag::ComplexEventScheduleRollConvention,      -1,   false},
+{tag::DeliveryScheduleType,                    -1,   false},
+{tag::DeliveryScheduleXID,                     -1,   false},
+{tag::DeliveryScheduleNotional,                -1,   false},
+{tag::DeliveryScheduleNotionalUnitOfMeasure,   -1,   false},
+{tag::DeliveryScheduleNotionalCommodityFrequency, -1,   false},
+{tag::DeliveryScheduleNegativeTolerance,       -1,   false},
+{tag::DeliverySchedulePositiveTolerance,       -1,   false},
+{tag::DeliveryScheduleToleranceUnitOfMeasure,  -1,   false},
+{tag::DeliveryScheduleToleranceType,           -1,   false},
+{tag::DeliveryScheduleSettlCountry,            -1,   false},
+{tag::DeliveryScheduleSettlTimeZone,           -1,   false},
+{tag::DeliveryScheduleSettlFlowType,           -1,   false},
+{tag::DeliveryScheduleSettlHolidaysProcessingInstruction, -1,   false},
+{tag::NoDeliveryScheduleSettlDays,             410,  false}, // DeliveryScheduleSettlDayGrp
+{tag::DeliveryScheduleSettlDay,                -1,   false},
+{tag::DeliveryScheduleSettlTotalHours,         -1,   false},
+{tag::NoDeliveryScheduleSettlTimes,            411,  false}, // DeliveryScheduleSettlTimeGrp
+{tag::DeliveryScheduleSettlStart,              -1,   false},
+{tag::DeliveryScheduleSettlEnd,                -1,   false},
+{tag::DeliveryScheduleSettlTimeType,           -1,   false},
+{tag::DeliveryStreamType,                      -1,   false},
+{tag::NoDeliveryStreamCommoditySources,        414,  false}, // DeliveryStreamCommoditySourceGrp
+{tag::DeliveryStreamPipeline,                  -1,   false},
+{tag::DeliveryStreamEntryPoint,                -1,   false},
+{tag::DeliveryStreamWithdrawalPoint,           -1,   false},
+{tag::DeliveryStreamDeliveryPoint,             -1,   false},
+{tag::DeliveryStreamDeliveryPointSource,       -1,   false},
+{tag::DeliveryStreamDeliveryPointDesc,         -1,   false},
+{tag::DeliveryStreamDeliveryRestriction,       -1,   false},
+{tag::DeliveryStreamDeliveryContingency,       -1,   false},
+{tag::DeliveryStreamDeliveryContingentPartySide, -1,   false},
+{tag::DeliveryStreamDeliverAtSourceIndicator,  -1,   false},
+{tag::DeliveryStreamRiskApportionment,         -1,   false},
+{tag::DeliveryStreamRiskApportionmentSource,   -1,   false},
+{tag::NoDeliveryStreamCycles,                  413,  false}, // DeliveryStreamCycleGrp
+{tag::DeliveryStreamTitleTransferLocation,     -1,   false},
+{tag::DeliveryStreamTitleTransferCondition,    -1,   false},
+{tag::DeliveryStreamImporterOfRecord,          -1,   false},
+{tag::DeliveryStreamNegativeTolerance,         -1,   false},
+{tag::DeliveryStreamPositiveTolerance,         -1,   false},
+{tag::DeliveryStreamToleranceUnitOfMeasure,    -1,   false},
+{tag::DeliveryStreamToleranceType,             -1,   false},
+{tag::DeliveryStreamToleranceOptionSide,       -1,   false},
+{tag::DeliveryStreamTotalPositiveTolerance,    -1,   false},
+{tag::DeliveryStreamTotalNegativeTolerance,    -1,   false},
+{tag::DeliveryStreamNotionalConversionFactor,  -1,   false},
+{tag::DeliveryStreamTransportEquipment,        -1,   false},
+{tag::DeliveryStreamElectingPartySide,         -1,   false},
+{tag::DeliveryStreamRouteOrCharter,            -1,   false},
+{tag::DeliveryStreamCycleDesc,                 -1,   false},
+{tag::EncodedDeliveryStreamCycleDescLen,       -1,   false},
+{tag::EncodedDeliveryStreamCycleDesc,          -1,   false},
+{tag::DeliveryStreamCommoditySource,           -1,   false},
+{tag::MarketDisruptionProvision,               -1,   false},
+{tag::NoMarketDisruptionEvents,                416,  false}, // MarketDisruptionEventGrp
+{tag::MarketDisruptionFallbackProvision,       -1,   false},
+{tag::NoMarketDisruptionFallbacks,             417,  false}, // MarketDisruptionFallbackGrp
+{tag::NoMarketDisruptionFallbackReferencePrices, 418,  false}, // MarketDisruptionFallbackReferencePriceGrp
+{tag::MarketDisruptionMaximumDays,             -1,   false},
+{tag::MarketDisruptionMaterialityPercentage,   -1,   false},
+{tag::MarketDisruptionMinimumFuturesContracts, -1,   false},
+{tag::MarketDisruptionEvent,                   -1,   false},
+{tag::MarketDisruptionValue,                   -1,   false},
+{tag::MarketDisruptionFallbackType,            -1,   false},
+{tag::MarketDisruptionFallbackValue,           -1,   false},
+{tag::MarketDisruptionFallbackUnderlierType,   -1,   false},
+{tag::MarketDisruptionFallbackUnderlierSecurityID, -1,   false},
+{tag::MarketDisruptionFallbackUnderlierSecurityIDSource, -1,   false},
+{tag::MarketDisruptionFallbackUnderlierSecurityDesc, -1,   false},
+{tag::EncodedMarketDisruptionFallbackUnderlierSecurityDescLen, -1,   false},
+{tag::EncodedMarketDisruptionFallbackUnderlierSecurityDesc, -1,   false},
+{tag::MarketDisruptionFallbackOpenUnits,       -1,   false},
+{tag::MarketDisruptionFallbackBasketCurrency,  -1,   false},
+{tag::MarketDisruptionFallbackBasketDivisor,   -1,   false},
+{tag::ExerciseDesc,                            -1,   false},
+{tag::EncodedExerciseDescLen,                  -1,   false},
+{tag::EncodedExerciseDesc,                     -1,   false},
+{tag::AutomaticExerciseIndicator,              -1,   false},
+{tag::AutomaticExerciseThresholdRate,          -1,   false},
+{tag::ExerciseConfirmationMethod,              -1,   false},
+{tag::ManualNoticeBusinessCenter,              -1,   false},
+{tag::FallbackExerciseIndicator,               -1,   false},
+{tag::LimitedRightToConfirmIndicator,          -1,   false},
+{tag::ExerciseSplitTicketIndicator,            -1,   false},
+{tag::SettlMethodElectingPartySide,            -1,   false},
+{0,                                            667,  false}, // SettlMethodElectionDate
+{0,                                            421,  false}, // OptionExerciseDates
+{0,                                            424,  false}, // OptionExerciseExpiration
+{0,                                            643,  false}, // OptionExerciseMakeWholeProvision
+{tag::OptionExerciseBusinessCenter,            -1,   false},
+{tag::OptionExerciseBusinessDayConvention,     -1,   false},
+{tag::NoOptionExerciseBusinessCenters,         420,  false}, // OptionExerciseBusinessCenterGrp
+{tag::NoOptionExerciseDates,                   422,  false}, // OptionExerciseDateGrp
+{tag::OptionExerciseEarliestDateOffsetDayType, -1,   false},
+{tag::OptionExerciseEarliestDateOffsetPeriod,  -1,   false},
+{tag::OptionExerciseEarliestDateOffsetUnit,    -1,   false},
+{tag::OptionExerciseFrequencyPeriod,           -1,   false},
+{tag::OptionExerciseFrequencyUnit,             -1,   false},
+{tag::OptionExerciseStartDateUnadjusted,       -1,   false},
+{tag::OptionExerciseStartDateRelativeTo,       -1,   false},
+{tag::OptionExerciseStartDateOffsetPeriod,     -1,   false},
+{tag::OptionExerciseStartDateOffsetUnit,       -1,   false},
+{tag::OptionExerciseStartDateOffsetDayType,    -1,   false},
+{tag::OptionExerciseStartDateAdjusted,         -1,   false},
+{tag::OptionExerciseSkip,                      -1,   false},
+{tag::OptionExerciseNominationDeadline,        -1,   false},
+{tag::OptionExerciseFirstDateUnadjusted,       -1,   false},
+{tag::OptionExerciseLastDateUnadjusted,        -1,   false},
+{tag::OptionExerciseEarliestTime,              -1,   false},
+{tag::OptionExerciseLatestTime,                -1,   false},
+{tag::OptionExerciseTimeBusinessCenter,        -1,   false},
+{tag::OptionExerciseDate,                      -1,   false},
+{tag::OptionExerciseDateType,                  -1,   false},
+{tag::OptionExerciseExpirationDateBusinessCenter, -1,   false},
+{tag::OptionExerciseExpirationDateBusinessDayConvention, -1,   false},
+{tag::NoOptionExerciseExpirationDateBusinessCenters, 423,  false}, // OptionExerciseExpirationDateBusinessCenterGrp
+{tag::NoOptionExerciseExpirationDates,         425,  false}, // OptionExerciseExpirationDateGrp
+{tag::OptionExerciseExpirationDateRelativeTo,  -1,   false},
+{tag::OptionExerciseExpirationDateOffsetPeriod, -1,   false},
+{tag::OptionExerciseExpirationDateOffsetUnit,  -1,   false},
+{tag::OptionExerciseExpirationFrequencyPeriod, -1,   false},
+{tag::OptionExerciseExpirationFrequencyUnit,   -1,   false},
+{tag::OptionExerciseExpirationRollConvention,  -1,   false},
+{tag::OptionExerciseExpirationDateOffsetDayType, -1,   false},
+{tag::OptionExerciseExpirationTime,            -1,   false},
+{tag::OptionExerciseExpirationTimeBusinessCenter, -1,   false},
+{tag::OptionExerciseExpirationDate,            -1,   false},
+{tag::OptionExerciseExpirationDateType,        -1,   false},
+{tag::PaymentScheduleFixingDayOfWeek,          -1,   false},
+{tag::PaymentScheduleFixingDayNumber,          -1,   false},
+{tag::PaymentStreamPricingBusinessCenter,      -1,   false},
+{tag::PaymentStreamPaymentDate,                -1,   false},
+{tag::PaymentStreamPaymentDateType,            -1,   false},
+{tag::PaymentStreamPricingDate,                -1,   false},
+{tag::PaymentStreamPricingDateType,            -1,   false},
+{tag::PaymentStreamPricingDayOfWeek,           -1,   false},
+{tag::PaymentStreamPricingDayNumber,           -1,   false},
+{tag::PricingDateBusinessCenter,               -1,   false},
+{tag::PricingDateUnadjusted,                   -1,   false},
+{tag::PricingDateBusinessDayConvention,        -1,   false},
+{tag::NoPricingDateBusinessCenters,            431,  false}, // PricingDateBusinessCenterGrp
+{tag::PricingDateAdjusted,                     -1,   false},
+{tag::PricingTime,                             -1,   false},
+{tag::PricingTimeBusinessCenter,               -1,   false},
+{tag::StreamAssetAttributeType,                -1,   false},
+{tag::StreamAssetAttributeValue,               -1,   false},
+{tag::StreamAssetAttributeLimit,               -1,   false},
+{tag::StreamCalculationPeriodDate,             -1,   false},
+{tag::StreamCalculationPeriodDateType,         -1,   false},
+{tag::StreamCommoditySettlBusinessCenter,      -1,   false},
+{tag::StreamCommodityBase,                     -1,   false},
+{tag::StreamCommodityType,                     -1,   false},
+{tag::StreamCommoditySecurityID,               -1,   false},
+{tag::StreamCommoditySecurityIDSource,         -1,   false},
+{tag::NoStreamCommodityAltIDs,                 437,  false}, // StreamCommodityAltIDGrp
+{tag::StreamCommodityDesc,                     -1,   false},
+{tag::EncodedStreamCommodityDescLen,           -1,   false},
+{tag::EncodedStreamCommodityDesc,              -1,   false},
+{tag::StreamCommodityDeliveryPricingRegion,    -1,   false},
+{tag::NoStreamAssetAttributes,                 433,  false}, // StreamAssetAttributeGrp
+{tag::StreamCommodityUnitOfMeasure,            -1,   false},
+{tag::StreamCommodityCurrency,                 -1,   false},
+{tag::StreamCommodityExchange,                 -1,   false},
+{tag::StreamCommodityRateSource,               -1,   false},
+{tag::StreamCommodityRateReferencePage,        -1,   false},
+{tag::StreamCommodityRateReferencePageHeading, -1,   false},
+{tag::StreamDataProvider,                      -1,   false},
+{tag::NoStreamCommodityDataSources,            438,  false}, // StreamCommodityDataSourceGrp
+{tag::StreamCommodityPricingType,              -1,   false},
+{tag::StreamCommodityNearbySettlDayPeriod,     -1,   false},
+{tag::StreamCommodityNearbySettlDayUnit,       -1,   false},
+{tag::StreamCommoditySettlDateUnadjusted,      -1,   false},
+{tag::StreamCommoditySettlDateBusinessDayConvention, -1,   false},
+{tag::NoStreamCommoditySettlBusinessCenters,   435,  false}, // StreamCommoditySettlBusinessCenterGrp
+{tag::StreamCommoditySettlDateAdjusted,        -1,   false},
+{tag::StreamCommoditySettlMonth,               -1,   false},
+{tag::StreamCommoditySettlDateRollPeriod,      -1,   false},
+{tag::StreamCommoditySettlDateRollUnit,        -1,   false},
+{tag::StreamCommoditySettlDayType,             -1,   false},
+{tag::NoStreamCommoditySettlPeriods,           441,  false}, // StreamCommoditySettlPeriodGrp
+{tag::StreamCommodityXID,                      -1,   false},
+{tag::StreamCommodityXIDRef,                   -1,   false},
+{tag::StreamCommodityAltID,                    -1,   false},
+{tag::StreamCommodityAltIDSource,              -1,   false},
+{tag::StreamCommodityDataSourceID,             -1,   false},
+{tag::StreamCommodityDataSourceIDType,         -1,   false},
+{tag::StreamCommoditySettlDay,                 -1,   false},
+{tag::StreamCommoditySettlTotalHours,          -1,   false},
+{tag::NoStreamCommoditySettlTimes,             440,  false}, // StreamCommoditySettlTimeGrp
+{tag::StreamCommoditySettlStart,               -1,   false},
+{tag::StreamCommoditySettlEnd,                 -1,   false},
+{tag::StreamCommoditySettlTimeType,            -1,   false},
+{tag::StreamCommoditySettlCountry,             -1,   false},
+{tag::StreamCommoditySettlTimeZone,            -1,   false},
+{tag::StreamCommoditySettlFlowType,            -1,   false},
+{tag::StreamCommoditySettlPeriodNotional,      -1,   false},
+{tag::StreamCommoditySettlPeriodNotionalUnitOfMeasure, -1,   false},
+{tag::StreamCommoditySettlPeriodFrequencyPeriod, -1,   false},
+{tag::StreamCommoditySettlPeriodFrequencyUnit, -1,   false},
+{tag::StreamCommoditySettlPeriodPrice,         -1,   false},
+{tag::StreamCommoditySettlPeriodPriceUnitOfMeasure, -1,   false},
+{tag::StreamCommoditySettlPeriodPriceCurrency, -1,   false},
+{tag::StreamCommoditySettlHolidaysProcessingInstruction, -1,   false},
+{tag::NoStreamCommoditySettlDays,              439,  false}, // StreamCommoditySettlDayGrp
+{tag::StreamCommoditySettlPeriodXID,           -1,   false},
+{tag::StreamCommoditySettlPeriodXIDRef,        -1,   false},
+{tag::MandatoryClearingJurisdiction,           -1,   false},
+{tag::LegAdditionalTermBondSecurityID,         -1,   false},
+{tag::LegAdditionalTermBondSecurityIDSource,   -1,   false},
+{tag::LegAdditionalTermBondDesc,               -1,   false},
+{tag::EncodedLegAdditionalTermBondDescLen,     -1,   false},
+{tag::EncodedLegAdditionalTermBondDesc,        -1,   false},
+{tag::LegAdditionalTermBondCurrency,           -1,   false},
+{tag::LegAdditionalTermBondIssuer,             -1,   false},
+{tag::EncodedLegAdditionalTermBondIssuerLen,   -1,   false},
+{tag::EncodedLegAdditionalTermBondIssuer,      -1,   false},
+{tag::LegAdditionalTermBondSeniority,          -1,   false},
+{tag::LegAdditionalTermBondCouponType,         -1,   false},
+{tag::LegAdditionalTermBondCouponRate,         -1,   false},
+{tag::LegAdditionalTermBondMaturityDate,       -1,   false},
+{tag::LegAdditionalTermBondParValue,           -1,   false},
+{tag::LegAdditionalTermBondCurrentTotalIssuedAmount, -1,   false},
+{tag::LegAdditionalTermBondCouponFrequencyPeriod, -1,   false},
+{tag::LegAdditionalTermBondCouponFrequencyUnit, -1,   false},
+{tag::LegAdditionalTermBondDayCount,           -1,   false},
+{tag::LegAdditionalTermConditionPrecedentBondIndicator, -1,   false},
+{tag::LegAdditionalTermDiscrepancyClauseIndicator, -1,   false},
+{tag::NoLegAdditionalTermBondRefs,             443,  false}, // LegAdditionalTermBondRefGrp
+{tag::LegAssetAttributeType,                   -1,   false},
+{tag::LegAssetAttributeValue,                  -1,   false},
+{tag::LegAssetAttributeLimit,                  -1,   false},
+{tag::LegCashSettlDealer,                      -1,   false},
+{tag::LegCashSettlCurrency,                    -1,   false},
+{tag::LegCasSettlValuationFirstBusinessDayOffset, -1,   false},
+{tag::LegCashSettlValuationSubsequentBusinessDaysOffset, -1,   false},
+{tag::LegCashSettlNumOfValuationDates,         -1,   false},
+{tag::LegCashSettlValuationTime,               -1,   false},
+{tag::LegCashSettlBusinessCenter,              -1,   false},
+{tag::LegCashSettlQuoteMethod,                 -1,   false},
+{tag::LegCashSettlQuoteAmount,                 -1,   false},
+{tag::LegCashSettlQuoteCurrency,               -1,   false},
+{tag::LegCashSettlMinimumQuoteAmount,          -1,   false},
+{tag::LegCashSettlMinimumQuoteCurrency,        -1,   false},
+{tag::NoLegCashSettlDealers,                   446,  false}, // LegCashSettlDealerGrp
+{tag::LegCashSettlPriceSource,                 -1,   false},
+{tag::LegCashSettlPriceDefault,                -1,   false},
+{tag::LegCashSettlBusinessDays,                -1,   false},
+{tag::LegCashSettlAmount,                      -1,   false},
+{0,                                            607,  false}, // LegCashSettlDate
+{tag::LegCashSettlRecoveryFactor,              -1,   false},
+{tag::LegCashSettlFixedTermIndicator,          -1,   false},
+{tag::LegCashSettlAccruedInterestIndicator,    -1,   false},
+{tag::LegCashSettlValuationMethod,             -1,   false},
+{tag::LegCashSettlTermXID,                     -1,   false},
+{tag::LegComplexEventAveragingObservationNumber, -1,   false},
+{tag::LegComplexEventAveragingWeight,          -1,   false},
+{tag::LegComplexEventCreditEventType,          -1,   false},
+{tag::LegComplexEventCreditEventValue,         -1,   false},
+{tag::LegComplexEventCreditEventCurrency,      -1,   false},
+{tag::LegComplexEventCreditEventPeriod,        -1,   false},
+{tag::LegComplexEventCreditEventUnit,          -1,   false},
+{tag::LegComplexEventCreditEventDayType,       -1,   false},
+{tag::LegComplexEventCreditEventRateSource,    -1,   false},
+{tag::NoLegComplexEventCreditEventQualifiers,  450,  false}, // LegComplexEventCreditEventQualifierGrp
+{tag::LegComplexEventCreditEventQualifier,     -1,   false},
+{tag::LegComplexEventPeriodDate,               -1,   false},
+{tag::LegComplexEventPeriodTime,               -1,   false},
+{tag::LegComplexEventPeriodType,               -1,   false},
+{tag::LegComplexEventBusinessCenter,           -1,   false},
+{tag::NoLegComplexEventSchedules,              460,  false}, // LegComplexEventScheduleGrp
+{tag::NoLegComplexEventPeriodDateTimes,        451,  false}, // LegComplexEventPeriodDateGrp
+{tag::NoLegComplexEventAveragingObservations,  448,  false}, // LegComplexEventAveragingObservationGrp
+{tag::LegComplexEventRateSource,               -1,   false},
+{tag::LegComplexEventRateSourceType,           -1,   false},
+{tag::LegComplexEventReferencePage,            -1,   false},
+{tag::LegComplexEvenReferencePageHeading,      -1,   false},
+{tag::LegComplexEventDateBusinessCenter,       -1,   false},
+{tag::LegComplexEventDateUnadjusted,           -1,   false},
+{tag::LegComplexEventDateRelativeTo,           -1,   false},
+{tag::LegComplexEventDateOffsetPeriod,         -1,   false},
+{tag::LegComplexEventDateOffsetUnit,           -1,   false},
+{tag::LegComplexEventDateOffsetDayType,        -1,   false},
+{tag::LegComplexEventDateBusinessDayConvention, -1,   false},
+{tag::NoLegComplexEventDateBusinessCenters,    454,  false}, // LegComplexEventDateBusinessCenterGrp
+{tag::LegComplexEventDateAdjusted,             -1,   false},
+{tag::LegComplexEventFixingTime,               -1,   false},
+{tag::LegComplexEventFixingTimeBusinessCenter, -1,   false},
+{tag::LegComplexEventCreditEventSource,        -1,   false},
+{tag::LegComplexEventType,                     -1,   false},
+{tag::LegComplexOptPayoutPaySide,              -1,   false},
+{tag::LegComplexOptPayoutReceiveSide,          -1,   false},
+{tag::LegComplexOptPayoutUnderlier,            -1,   false},
+{tag::LegComplexOptPayoutAmount,               -1,   false},
+{tag::LegComplexOptPayoutPercentage,           -1,   false},
+{tag::LegComplexOptPayoutTime,                 -1,   false},
+{tag::LegComplexOptPayoutCurrency,             -1,   false},
+{tag::LegComplexEventPrice,                    -1,   false},
+{tag::LegComplexEventPricePercentage,          -1,   false},
+{tag::LegComplexEventPriceBoundaryMethod,      -1,   false},
+{tag::LegComplexEventPriceBoundaryPrecision,   -1,   false},
+{tag::LegComplexEventPriceTimeType,            -1,   false},
+{tag::LegComplexEventCondition,                -1,   false},
+{tag::NoLegComplexEventDates,                  458,  false}, // LegComplexEventDates
+{tag::LegComplexEventCurrencyOne,              -1,   false},
+{tag::LegComplexEventCurrencyTwo,              -1,   false},
+{tag::LegComplexEventQuoteBasis,               -1,   false},
+{tag::LegComplexEventFixedFXRate,              -1,   false},
+{tag::LegComplexEventSpotRate,                 -1,   false},
+{tag::LegComplexEventForwardPoints,            -1,   false},
+{tag::LegComplexEventDeterminationMethod,      -1,   false},
+{tag::LegComplexEventCalculationAgent,         -1,   false},
+{tag::LegComplexEventStrikePrice,              -1,   false},
+{tag::LegComplexEventStrikeFactor,             -1,   false},
+{tag::LegComplexEventStrikeNumberOfOptions,    -1,   false},
+{tag::NoLegComplexEventRateSources,            453,  false}, // LegComplexEventRateSourceGrp
+{0,                                            455,  false}, // LegComplexEventRelativeDate
+{tag::NoLegComplexEventPeriods,                452,  false}, // LegComplexEventPeriodGrp
+{tag::LegComplexEventCreditEventsXIDRef,       -1,   false},
+{tag::LegComplexEventCreditEventNotifyingParty, -1,   false},
+{tag::LegComplexEventCreditEventBusinessCenter, -1,   false},
+{tag::LegComplexEventCreditEventStandardSources, -1,   false},
+{tag::LegComplexEventCreditEventMinimumSources, -1,   false},
+{tag::NoLegComplexEventCreditEventSources,     456,  false}, // LegComplexEventCreditEventSourceGrp
+{tag::NoLegComplexEventCreditEvents,           449,  false}, // LegComplexEventCreditEventGrp
+{tag::LegComplexEventFuturesPriceValuation,    -1,   false},
+{tag::LegComplexEventOptionsPriceValuation,    -1,   false},
+{tag::LegComplexEventPVFinalPriceElectionFallback, -1,   false},
+{tag::LegComplexEventXID,                      -1,   false},
+{tag::LegComplexEventXIDRef,                   -1,   false},
+{tag::LegComplexEventStartDate,                -1,   false},
+{tag::LegComplexEventEndDate,                  -1,   false},
+{tag::NoLegComplexEventTimes,                  459,  false}, // LegComplexEventTimes
+{tag::LegComplexEventStartTime,                -1,   false},
+{tag::LegComplexEventEndTime,                  -1,   false},
+{tag::LegComplexEventScheduleStartDate,        -1,   false},
+{tag::LegComplexEventScheduleEndDate,          -1,   false},
+{tag::LegComplexEventScheduleFrequencyPeriod,  -1,   false},
+{tag::LegComplexEventScheduleFrequencyUnit,    -1,   false},
+{tag::LegComplexEventScheduleRollConvention,   -1,   false},
+{tag::LegDeliveryScheduleType,                 -1,   false},
+{tag::LegDeliveryScheduleXID,                  -1,   false},
+{tag::LegDeliveryScheduleNotional,             -1,   false},
+{tag::LegDeliveryScheduleNotionalUnitOfMeasure, -1,   false},
+{tag::LegDeliveryScheduleNotionalCommodityFrequency, -1,   false},
+{tag::LegDeliveryScheduleNegativeTolerance,    -1,   false},
+{tag::LegDeliverySchedulePositiveTolerance,    -1,   false},
+{tag::LegDeliveryScheduleToleranceUnitOfMeasure, -1,   false},
+{tag::LegDeliveryScheduleToleranceType,        -1,   false},
+{tag::LegDeliveryScheduleSettlCountry,         -1,   false},
+{tag::LegDeliveryScheduleSettlTimeZone,        -1,   false},
+{tag::LegDeliveryScheduleSettlFlowType,        -1,   false},
+{tag::LegDeliveryScheduleSettlHolidaysProcessingInstruction, -1,   false},
+{tag::NoLegDeliveryScheduleSettlDays,          462,  false}, // LegDeliveryScheduleSettlDayGrp
+{tag::LegDeliveryScheduleSettlDay,             -1,   false},
+{tag::LegDeliveryScheduleSettlTotalHours,      -1,   false},
+{tag::NoLegDeliveryScheduleSettlTimes,         463,  false}, // LegDeliveryScheduleSettlTimeGrp
+{tag::LegDeliveryScheduleSettlStart,           -1,   false},
+{tag::LegDeliveryScheduleSettlEnd,             -1,   false},
+{tag::LegDeliveryScheduleSettlTimeType,        -1,   false},
+{tag::LegDeliveryStreamType,                   -1,   false},
+{tag::NoLegDeliveryStreamCommoditySources,     467,  false}, // LegDeliveryStreamCommoditySourceGrp
+{tag::LegDeliveryStreamPipeline,               -1,   false},
+{tag::LegDeliveryStreamEntryPoint,             -1,   false},
+{tag::LegDeliveryStreamWithdrawalPoint,        -1,   false},
+{tag::LegDeliveryStreamDeliveryPoint,          -1,   false},
+{tag::LegDeliveryStreamDeliveryPointSource,    -1,   false},
+{tag::LegDeliveryStreamDeliveryPointDesc,      -1,   false},
+{tag::LegDeliveryStreamDeliveryRestriction,    -1,   false},
+{tag::LegDeliveryStreamDeliveryContingency,    -1,   false},
+{tag::LegDeliveryStreamDeliveryContingentPartySide, -1,   false},
+{tag::LegDeliveryStreamDeliverAtSourceIndicator, -1,   false},
+{tag::LegDeliveryStreamRiskApportionment,      -1,   false},
+{tag::LegDeliveryStreamRiskApportionmentSource, -1,   false},
+{tag::NoLegDeliveryStreamCycles,               466,  false}, // LegDeliveryStreamCycleGrp
+{tag::LegDeliveryStreamTitleTransferLocation,  -1,   false},
+{tag::LegDeliveryStreamTitleTransferCondition, -1,   false},
+{tag::LegDeliveryStreamImporterOfRecord,       -1,   false},
+{tag::LegDeliveryStreamNegativeTolerance,      -1,   false},
+{tag::LegDeliveryStreamPositiveTolerance,      -1,   false},
+{tag::LegDeliveryStreamToleranceUnitOfMeasure, -1,   false},
+{tag::LegDeliveryStreamToleranceType,          -1,   false},
+{tag::LegDeliveryStreamToleranceOptionSide,    -1,   false},
+{tag::LegDeliveryStreamTotalPositiveTolerance, -1,   false},
+{tag::LegDeliveryStreamTotalNegativeTolerance, -1,   false},
+{tag::LegDeliveryStreamNotionalConversionFactor, -1,   false},
+{tag::LegDeliveryStreamTransportEquipment,     -1,   false},
+{tag::LegDeliveryStreamElectingPartySide,      -1,   false},
+{tag::LegDeliveryStreamRouteOrCharter,         -1,   false},
+{tag::LegStreamAssetAttributeType,             -1,   false},
+{tag::LegStreamAssetAttributeValue,            -1,   false},
+{tag::LegStreamAssetAttributeLimit,            -1,   false},
+{tag::LegDeliveryStreamCycleDesc,              -1,   false},
+{tag::EncodedLegDeliveryStreamCycleDescLen,    -1,   false},
+{tag::EncodedLegDeliveryStreamCycleDesc,       -1,   false},
+{tag::LegDeliveryStreamCommoditySource,        -1,   false},
+{tag::LegInstrumentPartyID,                    -1,   false},
+{tag::LegInstrumentPartyIDSource,              -1,   false},
+{tag::LegInstrumentPartyRole,                  -1,   false},
+{tag::LegInstrumentPartyRoleQualifier,         -1,   false},
+{tag::NoLegInstrumentPartySubIDs,              469,  false}, // LegInstrumentPtysSubGrp
+{tag::LegInstrumentPartySubID,                 -1,   false},
+{tag::LegInstrumentPartySubIDType,             -1,   false},
+{tag::LegMarketDisruptionProvision,            -1,   false},
+{tag::NoLegMarketDisruptionEvents,             471,  false}, // LegMarketDisruptionEventGrp
+{tag::LegMarketDisruptionFallbackProvision,    -1,   false},
+{tag::NoLegMarketDisruptionFallbacks,          472,  false}, // LegMarketDisruptionFallbackGrp
+{tag::NoLegMarketDisruptionFallbackReferencePrices, 473,  false}, // LegMarketDisruptionFallbackReferencePriceGrp
+{tag::LegMarketDisruptionMaximumDays,          -1,   false},
+{tag::LegMarketDisruptionMaterialityPercentage, -1,   false},
+{tag::LegMarketDisruptionMinimumFuturesContracts, -1,   false},
+{tag::LegMarketDisruptionEvent,                -1,   false},
+{tag::LegMarketDisruptionValue,                -1,   false},
+{tag::LegMarketDisruptionFallbackType,         -1,   false},
+{tag::LegMarketDisruptionFallbackValue,        -1,   false},
+{tag::LegMarketDisruptionFallbackUnderlierType, -1,   false},
+{tag::LegMarketDisruptionFallbackUnderlierSecurityID, -1,   false},
+{tag::LegMarketDisruptionFallbackUnderlierSecurityIDSource, -1,   false},
+{tag::LegMarketDisruptionFallbackUnderlierSecurityDesc, -1,   false},
+{tag::EncodedLegMarketDisruptionFallbackUnderlierSecurityDescLen, -1,   false},
+{tag::EncodedLegMarketDisruptionFallbackUnderlierSecurityDesc, -1,   false},
+{tag::LegMarketDisruptionFallbackOpenUnits,    -1,   false},
+{tag::LegMarketDisruptionFallbackBasketCurrency, -1,   false},
+{tag::LegMarketDisruptionFallbackBasketDivisor, -1,   false},
+{tag::LegExerciseDesc,                         -1,   false},
+{tag::EncodedLegExerciseDescLen,               -1,   false},
+{tag::EncodedLegExerciseDesc,                  -1,   false},
+{tag::LegAutomaticExerciseIndicator,           -1,   false},
+{tag::LegAutomaticExerciseThresholdRate,       -1,   false},
+{tag::LegExerciseConfirmationMethod,           -1,   false},
+{tag::LegManualNoticeBusinessCenter,           -1,   false},
+{tag::LegFallbackExerciseIndicator,            -1,   false},
+{tag::LegLimitRightToConfirmIndicator,         -1,   false},
+{tag::LegExerciseSplitTicketIndicator,         -1,   false},
+{tag::LegSettlMethodElectingPartySide,         -1,   false},
+{0,                                            641,  false}, // LegSettlMethodElectionDate
+{0,                                            476,  false}, // LegOptionExerciseDates
+{0,                                            479,  false}, // LegOptionExerciseExpiration
+{0,                                            618,  false}, // LegOptionExerciseMakeWholeProvision
+{tag::LegOptionExerciseBusinessCenter,         -1,   false},
+{tag::LegOptionExerciseBusinessDayConvention,  -1,   false},
+{tag::NoLegOptionExerciseBusinessCenters,      475,  false}, // LegOptionExerciseBusinessCenterGrp
+{tag::NoLegOptionExerciseDates,                477,  false}, // LegOptionExerciseDateGrp
+{tag::LegOptionExerciseEarliestDateOffsetDayType, -1,   false},
+{tag::LegOptionExerciseEarliestDateOffsetPeriod, -1,   false},
+{tag::LegOptionExerciseEarliestDateOffsetUnit, -1,   false},
+{tag::LegOptionExerciseFrequencyPeriod,        -1,   false},
+{tag::LegOptionExerciseFrequencyUnit,          -1,   false},
+{tag::LegOptionExerciseStartDateUnadjusted,    -1,   false},
+{tag::LegOptionExerciseStartDateRelativeTo,    -1,   false},
+{tag::LegOptionExerciseStartDateOffsetPeriod,  -1,   false},
+{tag::LegOptionExerciseStartDateOffsetUnit,    -1,   false},
+{tag::LegOptionExerciseStartDateOffsetDayType, -1,   false},
+{tag::LegOptionExerciseStartDateAdjusted,      -1,   false},
+{tag::LegOptionExerciseSkip,                   -1,   false},
+{tag::LegOptionExerciseNominationDeadline,     -1,   false},
+{tag::LegOptionExerciseFirstDateUnadjusted,    -1,   false},
+{tag::LegOptionExerciseLastDateUnadjusted,     -1,   false},
+{tag::LegOptionExerciseEarliestTime,           -1,   false},
+{tag::LegOptionExerciseLatestTime,             -1,   false},
+{tag::LegOptionExerciseTimeBusinessCenter,     -1,   false},
+{tag::LegOptionExerciseDate,                   -1,   false},
+{tag::LegOptionExerciseDateType,               -1,   false},
+{tag::LegOptionExerciseExpirationDateBusinessCenter, -1,   false},
+{tag::LegOptionExerciseExpirationDateBusinessDayConvention, -1,   false},
+{tag::NoLegOptionExerciseExpirationDateBusinessCenters, 478,  false}, // LegOptionExerciseExpirationDateBusinessCenterGrp
+{tag::NoLegOptionExerciseExpirationDates,      480,  false}, // LegOptionExerciseExpirationDateGrp
+{tag::LegOptionExerciseExpirationDateRelativeTo, -1,   false},
+{tag::LegOptionExerciseExpirationDateOffsetPeriod, -1,   false},
+{tag::LegOptionExerciseExpirationDateOffsetUnit, -1,   false},
+{tag::LegOptionExerciseExpirationFrequencyPeriod, -1,   false},
+{tag::LegOptionExerciseExpirationFrequencyUnit, -1,   false},
+{tag::LegOptionExerciseExpirationRollConvention, -1,   false},
+{tag::LegOptionExerciseExpirationDateOffsetDayType, -1,   false},
+{tag::LegOptionExerciseExpirationTime,         -1,   false},
+{tag::LegOptionExerciseExpirationTimeBusinessCenter, -1,   false},
+{tag::LegOptionExerciseExpirationDate,         -1,   false},
+{tag::LegOptionExerciseExpirationDateType,     -1,   false},
+{tag::LegPaymentScheduleFixingDayOfWeek,       -1,   false},
+{tag::LegPaymentScheduleFixingDayNumber,       -1,   false},
+{tag::LegPaymentStreamPricingBusinessCenter,   -1,   false},
+{tag::LegPaymentStreamPaymentDate,             -1,   false},
+{tag::LegPaymentStreamPaymentDateType,         -1,   false},
+{tag::LegPaymentStreamPricingDate,             -1,   false},
+{tag::LegPaymentStreamPricingDateType,         -1,   false},
+{tag::LegPaymentStreamPricingDayOfWeek,        -1,   false},
+{tag::LegPaymentStreamPricingDayNumber,        -1,   false},
+{tag::NoLegPhysicalSettlDeliverableObligations, 487,  false}, // LegPhysicalSettlDeliverableObligationGrp
+{tag::LegPhysicalSettlCurency,                 -1,   false},
+{tag::LegPhysicalSettlBusinessDays,            -1,   false},
+{tag::LegPhysicalSettlMaximumBusinessDays,     -1,   false},
+{tag::LegPhysicalSettlTermXID,                 -1,   false},
+{tag::LegPhysicalSettlDeliverableObligationType, -1,   false},
+{tag::LegPhysicalSettlDeliverableObligationValue, -1,   false},
+{tag::LegPricingDateBusinessCenter,            -1,   false},
+{tag::LegPricingDateUnadjusted,                -1,   false},
+{tag::LegPricingDateBusinessDayConvention,     -1,   false},
+{tag::NoLegPricingDateBusinessCenters,         488,  false}, // LegPricingDateBusinessCenterGrp
+{tag::LegPricingDateAdjusted,                  -1,   false},
+{tag::LegPricingTime,                          -1,   false},
+{tag::LegPricingTimeBusinessCenter,            -1,   false},
+{tag::LegProtectionTermEventNewsSource,        -1,   false},
+{tag::LegProtectionTermNotional,               -1,   false},
+{tag::LegProtectionTermCurrency,               -1,   false},
+{tag::LegProtectionTermSellerNotifies,         -1,   false},
+{tag::LegProtectionTermBuyerNotifies,          -1,   false},
+{tag::LegProtectionTermEventBusinessCenter,    -1,   false},
+{tag::LegProtectionTermStandardSources,        -1,   false},
+{tag::LegProtectionTermEventMinimumSources,    -1,   false},
+{tag::NoLegProtectionTermEventNewsSources,     490,  false}, // LegProtectionTermEventNewsSourceGrp
+{tag::NoLegProtectionTermEvents,               492,  false}, // LegProtectionTermEventGrp
+{tag::NoLegProtectionTermObligations,          494,  false}, // LegProtectionTermObligationGrp
+{tag::LegProtectionTermXID,                    -1,   false},
+{tag::LegProtectionTermEventType,              -1,   false},
+{tag::LegProtectionTermEventValue,             -1,   false},
+{tag::LegProtectionTermEventCurrency,          -1,   false},
+{tag::LegProtectionTermEventPeriod,            -1,   false},
+{tag::LegProtectionTermEventUnit,              -1,   false},
+{tag::LegProtectionTermEventDayType,           -1,   false},
+{tag::LegProtectionTermEventRateSource,        -1,   false},
+{tag::NoLegProtectionTermEventQualifiers,      493,  false}, // LegProtectionTermEventQualifierGrp
+{tag::LegProtectionTermEventQualifier,         -1,   false},
+{tag::LegProtectionTermObligationType,         -1,   false},
+{tag::LegProtectionTermObligationValue,        -1,   false},
+{tag::LegStreamCalculationPeriodDate,          -1,   false},
+{tag::LegStreamCalculationPeriodDateType,      -1,   false},
+{tag::LegStreamCommoditySettlBusinessCenter,   -1,   false},
+{tag::LegStreamCommodityBase,                  -1,   false},
+{tag::LegStreamCommodityType,                  -1,   false},
+{tag::LegStreamCommoditySecurityID,            -1,   false},
+{tag::LegStreamCommoditySecurityIDSource,      -1,   false},
+{tag::NoLegStreamCommodityAltIDs,              498,  false}, // LegStreamCommodityAltIDGrp
+{tag::LegStreamCommodityDesc,                  -1,   false},
+{tag::EncodedLegStreamCommodityDescLen,        -1,   false},
+{tag::EncodedLegStreamCommodityDesc,           -1,   false},
+{tag::LegStreamCommodityDeliveryPricingRegion, -1,   false},
+{tag::NoLegStreamAssetAttributes,              465,  false}, // LegStreamAssetAttributeGrp
+{tag::LegStreamCommodityUnitOfMeasure,         -1,   false},
+{tag::LegStreamCommodityCurrency,              -1,   false},
+{tag::LegStreamCommodityExchange,              -1,   false},
+{tag::LegStreamCommodityRateSource,            -1,   false},
+{tag::LegStreamCommodityRateReferencePage,     -1,   false},
+{tag::LegStreamCommodityRateReferencePageHeading, -1,   false},
+{tag::LegStreamDataProvider,                   -1,   false},
+{tag::NoLegStreamCommodityDataSources,         499,  false}, // LegStreamCommodityDataSourceGrp
+{tag::LegStreamCommodityPricingType,           -1,   false},
+{tag::LegStreamCommodityNearbySettlDayPeriod,  -1,   false},
+{tag::LegStreamCommodityNearbySettlDayUnit,    -1,   false},
+{tag::LegStreamCommoditySettlDateUnadjusted,   -1,   false},
+{tag::LegStreamCommoditySettlDateBusinessDayConvention, -1,   false},
+{tag::NoLegStreamCommoditySettlBusinessCenters, 496,  false}, // LegStreamCommoditySettlBusinessCenterGrp
+{tag::LegStreamCommoditySettlDateAdjusted,     -1,   false},
+{tag::LegStreamCommoditySettlMonth,            -1,   false},
+{tag::LegStreamCommoditySettlDateRollPeriod,   -1,   false},
+{tag::LegStreamCommoditySettlDateRollUnit,     -1,   false},
+{tag::LegStreamCommoditySettlDayType,          -1,   false},
+{tag::NoLegStreamCommoditySettlPeriods,        502,  false}, // LegStreamCommoditySettlPeriodGrp
+{tag::LegStreamCommodityXID,                   -1,   false},
+{tag::LegStreamCommodityXIDRef,                -1,   false},
+{tag::LegStreamCommodityAltID,                 -1,   false},
+{tag::LegStreamCommodityAltIDSource,           -1,   false},
+{tag::LegStreamCommodityDataSourceID,          -1,   false},
+{tag::LegStreamCommodityDataSourceIDType,      -1,   false},
+{tag::LegStreamCommoditySettlDay,              -1,   false},
+{tag::LegStreamCommoditySettlTotalHours,       -1,   false},
+{tag::NoLegStreamCommoditySettlTimes,          501,  false}, // LegStreamCommoditySettlTimeGrp
+{tag::LegStreamCommoditySettlStart,            -1,   false},
+{tag::LegStreamCommoditySettlEnd,              -1,   false},
+{tag::LegStreamCommoditySettlTimeType,         -1,   false},
+{tag::LegStreamCommoditySettlCountry,          -1,   false},
+{tag::LegStreamCommoditySettlTimeZone,         -1,   false},
+{tag::LegStreamCommoditySettlFlowType,         -1,   false},
+{tag::LegStreamCommoditySettlPeriodNotional,   -1,   false},
+{tag::LegStreamCommoditySettlPeriodNotionalUnitOfMeasure, -1,   false},
+{tag::LegStreamCommoditySettlPeriodFrequencyPeriod, -1,   false},
+{tag::LegStreamCommoditySettlPeriodFrequencyUnit, -1,   false},
+{tag::LegStreamCommoditySettlPeriodPrice,      -1,   false},
+{tag::LegStreamCommoditySettlPeriodPriceUnitOfMeasure, -1,   false},
+{tag::LegStreamCommoditySettlPeriodPriceCurrency, -1,   false},
+{tag::LegStreamCommoditySettlHolidaysProcessingInstruction, -1,   false},
+{tag::NoLegStreamCommoditySettlDays,           500,  false}, // LegStreamCommoditySettlDayGrp
+{tag::LegStreamCommoditySettlPeriodXID,        -1,   false},
+{tag::LegStreamCommoditySettlPeriodXIDRef,     -1,   false},
+{tag::UnderlyingAssetAttributeType,            -1,   false},
+{tag::UnderlyingAssetAttributeValue,           -1,   false},
+{tag::UnderlyingAssetAttributeLimit,           -1,   false},
+{tag::UnderlyingComplexEventAveragingObservationNumber, -1,   false},
+{tag::UnderlyingComplexEventAveragingWeight,   -1,   false},
+{tag::UnderlyingComplexEventCreditEventType,   -1,   false},
+{tag::UnderlyingComplexEventCreditEventValue,  -1,   false},
+{tag::UnderlyingComplexEventCreditEventCurrency, -1,   false},
+{tag::UnderlyingComplexEventCreditEventPeriod, -1,   false},
+{tag::UnderlyingComplexEventCreditEventUnit,   -1,   false},
+{tag::UnderlyingComplexEventCreditEventDayType, -1,   false},
+{tag::UnderlyingComplexEventCreditEventRateSource, -1,   false},
+{tag::NoUnderlyingComplexEventCreditEventQualifiers, 506,  false}, // UnderlyingComplexEventCreditEventQualifierGrp
+{tag::UnderlyingComplexEventCreditEventQualifier, -1,   false},
+{tag::UnderlyingComplexEventPeriodDate,        -1,   false},
+{tag::UnderlyingComplexEventPeriodTime,        -1,   false},
+{tag::UnderlyingComplexEventPeriodType,        -1,   false},
+{tag::UnderlyingComplexEventBusinessCenter,    -1,   false},
+{tag::NoUnderlyingComplexEventSchedules,       513,  false}, // UnderlyingComplexEventScheduleGrp
+{tag::NoUnderlyingComplexEventPeriodDateTimes, 507,  false}, // UnderlyingComplexEventPeriodDateGrp
+{tag::NoUnderlyingComplexEventAveragingObservations, 504,  false}, // UnderlyingComplexEventAveragingObservationGrp
+{tag::UnderlyingComplexEventRateSource,        -1,   false},
+{tag::UnderlyingComplexEventRateSourceType,    -1,   false},
+{tag::UnderlyingComplexEventReferencePage,     -1,   false},
+{tag::UnderlyingComplexEventReferencePageHeading, -1,   false},
+{tag::UnderlyingComplexEventDateBusinessCenter, -1,   false},
+{tag::UnderlyingComplexEventDateUnadjusted,    -1,   false},
+{tag::UnderlyingComplexEventDateRelativeTo,    -1,   false},
+{tag::UnderlyingComplexEventDateOffsetPeriod,  -1,   false},
+{tag::UnderlyingComplexEventDateOffsetUnit,    -1,   false},
+{tag::UnderlyingComplexEventDateOffsetDayType, -1,   false},
+{tag::UnderlyingComplexEventDateBusinessDayConvention, -1,   false},
+{tag::NoUnderlyingComplexEventDateBusinessCenters, 510,  false}, // UnderlyingComplexEventDateBusinessCenterGrp
+{tag::UnderlyingComplexEventDateAdjusted,      -1,   false},
+{tag::UnderlyingComplexEventFixingTime,        -1,   false},
+{tag::UnderlyingComplexEventFixingTimeBusinessCenter, -1,   false},
+{tag::UnderlyingComplexEventCreditEventSource, -1,   false},
+{tag::UnderlyingComplexEventScheduleStartDate, -1,   false},
+{tag::UnderlyingComplexEventScheduleEndDate,   -1,   false},
+{tag::UnderlyingComplexEventScheduleFrequencyPeriod, -1,   false},
+{tag::UnderlyingComplexEventScheduleFrequencyUnit, -1,   false},
+{tag::UnderlyingComplexEventScheduleRollConvention, -1,   false},
+{tag::UnderlyingDeliveryScheduleType,          -1,   false},
+{tag::UnderlyingDeliveryScheduleXID,           -1,   false},
+{tag::UnderlyingDeliveryScheduleNotional,      -1,   false},
+{tag::UnderlyingDeliveryScheduleNotionalUnitOfMeasure, -1,   false},
+{tag::UnderlyingDeliveryScheduleNotionalCommodityFrequency, -1,   false},
+{tag::UnderlyingDeliveryScheduleNegativeTolerance, -1,   false},
+{tag::UnderlyingDeliverySchedulePositiveTolerance, -1,   false},
+{tag::UnderlyingDeliveryScheduleToleranceUnitOfMeasure, -1,   false},
+{tag::UnderlyingDeliveryScheduleToleranceType, -1,   false},
+{tag::UnderlyingDeliveryScheduleSettlCountry,  -1,   false},
+{tag::UnderlyingDeliveryScheduleSettlTimeZone, -1,   false},
+{tag::UnderlyingDeliveryScheduleSettlFlowType, -1,   false},
+{tag::UnderlyingDeliveryScheduleSettlHolidaysProcessingInstruction, -1,   false},
+{tag::NoUnderlyingDeliveryScheduleSettlDays,   515,  false}, // UnderlyingDeliveryScheduleSettlDayGrp
+{tag::UnderlyingDeliveryScheduleSettlDay,      -1,   false},
+{tag::UnderlyingDeliveryScheduleSettlTotalHours, -1,   false},
+{tag::NoUnderlyingDeliveryScheduleSettlTimes,  516,  false}, // UnderlyingDeliveryScheduleSettlTimeGrp
+{tag::UnderlyingDeliveryScheduleSettlStart,    -1,   false},
+{tag::UnderlyingDeliveryScheduleSettlEnd,      -1,   false},
+{tag::UnderlyingDeliveryScheduleSettlTimeType, -1,   false},
+{tag::UnderlyingDeliveryStreamType,            -1,   false},
+{tag::NoUnderlyingDeliveryStreamCommoditySources, 520,  false}, // UnderlyingDeliveryStreamCommoditySourceGrp
+{tag::UnderlyingDeliveryStreamPipeline,        -1,   false},
+{tag::UnderlyingDeliveryStreamEntryPoint,      -1,   false},
+{tag::UnderlyingDeliveryStreamWithdrawalPoint, -1,   false},
+{tag::UnderlyingDeliveryStreamDeliveryPoint,   -1,   false},
+{tag::UnderlyingDeliveryStreamDeliveryPointSource, -1,   false},
+{tag::UnderlyingDeliveryStreamDeliveryPointDesc, -1,   false},
+{tag::UnderlyingDeliveryStreamDeliveryRestriction, -1,   false},
+{tag::UnderlyingDeliveryStreamDeliveryContingency, -1,   false},
+{tag::UnderlyingDeliveryStreamDeliveryContingentPartySide, -1,   false},
+{tag::UnderlyingDeliveryStreamDeliverAtSourceIndicator, -1,   false},
+{tag::UnderlyingDeliveryStreamRiskApportionment, -1,   false},
+{tag::UnderlyingDeliveryStreamRiskApportionmentSource, -1,   false},
+{tag::NoUnderlyingDeliveryStreamCycles,        519,  false}, // UnderlyingDeliveryStreamCycleGrp
+{tag::UnderlyingDeliveryStreamTitleTransferLocation, -1,   false},
+{tag::UnderlyingDeliveryStreamTitleTransferCondition, -1,   false},
+{tag::UnderlyingDeliveryStreamImporterOfRecord, -1,   false},
+{tag::UnderlyingDeliveryStreamNegativeTolerance, -1,   false},
+{tag::UnderlyingDeliveryStreamPositiveTolerance, -1,   false},
+{tag::UnderlyingDeliveryStreamToleranceUnitOfMeasure, -1,   false},
+{tag::UnderlyingDeliveryStreamToleranceType,   -1,   false},
+{tag::UnderlyingDeliveryStreamToleranceOptionSide, -1,   false},
+{tag::UnderlyingDeliveryStreamTotalPositiveTolerance, -1,   false},
+{tag::UnderlyingDeliveryStreamTotalNegativeTolerance, -1,   false},
+{tag::UnderlyingDeliveryStreamNotionalConversionFactor, -1,   false},
+{tag::UnderlyingDeliveryStreamTransportEquipment, -1,   false},
+{tag::UnderlyingDeliveryStreamElectingPartySide, -1,   false},
+{tag::UnderlyingDeliveryStreamRouteOrCharter,  -1,   false},
+{tag::UnderlyingStreamAssetAttributeType,      -1,   false},
+{tag::UnderlyingStreamAssetAttributeValue,     -1,   false},
+{tag::UnderlyingStreamAssetAttributeLimit,     -1,   false},
+{tag::UnderlyingDeliveryStreamCycleDesc,       -1,   false},
+{tag::EncodedUnderlyingDeliveryStreamCycleDescLen, -1,   false},
+{tag::EncodedUnderlyingDeliveryStreamCycleDesc, -1,   false},
+{tag::UnderlyingDeliveryStreamCommoditySource, -1,   false},
+{tag::UnderlyingExerciseDesc,                  -1,   false},
+{tag::EncodedUnderlyingExerciseDescLen,        -1,   false},
+{tag::EncodedUnderlyingExerciseDesc,           -1,   false},
+{tag::UnderlyingAutomaticExerciseIndicator,    -1,   false},
+{tag::UnderlyingAutomaticExerciseThresholdRate, -1,   false},
+{tag::UnderlyingExerciseConfirmationMethod,    -1,   false},
+{tag::UnderlyingManualNoticeBusinessCenter,    -1,   false},
+{tag::UnderlyingFallbackExerciseIndicator,     -1,   false},
+{tag::UnderlyingLimitedRightToConfirmIndicator, -1,   false},
+{tag::UnderlyingExerciseSplitTicketIndicator,  -1,   false},
+{tag::UnderlyingSettlMethodElectingPartySide,  -1,   false},
+{0,                                            707,  false}, // UnderlyingSettlMethodElectionDate
+{0,                                            523,  false}, // UnderlyingOptionExerciseDates
+{0,                                            526,  false}, // UnderlyingOptionExerciseExpiration
+{0,                                            681,  false}, // UnderlyingOptionExerciseMakeWholeProvision
+{tag::UnderlyingOptionExerciseBusinessCenter,  -1,   false},
+{tag::UnderlyingOptionExerciseBusinessDayConvention, -1,   false},
+{tag::NoUnderlyingOptionExerciseBusinessCenters, 522,  false}, // UnderlyingOptionExerciseBusinessCenterGrp
+{tag::NoUnderlyingOptionExerciseDates,         524,  false}, // UnderlyingOptionExerciseDateGrp
+{tag::UnderlyingOptionExerciseEarliestDateOffsetDayType, -1,   false},
+{tag::UnderlyingOptionExerciseEarliestDateOffsetPeriod, -1,   false},
+{tag::UnderlyingOptionExerciseEarliestDateOffsetUnit, -1,   false},
+{tag::UnderlyingOptionExerciseFrequencyPeriod, -1,   false},
+{tag::UnderlyingOptionExerciseFrequencyUnit,   -1,   false},
+{tag::UnderlyingOptionExerciseStartDateUnadjusted, -1,   false},
+{tag::UnderlyingOptionExerciseStartDateRelativeTo, -1,   false},
+{tag::UnderlyingOptionExerciseStartDateOffsetPeriod, -1,   false},
+{tag::UnderlyingOptionExerciseStartDateOffsetUnit, -1,   false},
+{tag::UnderlyingOptionExerciseStartDateOffsetDayType, -1,   false},
+{tag::UnderlyingOptionExerciseStartDateAdjusted, -1,   false},
+{tag::UnderlyingOptionExerciseSkip,            -1,   false},
+{tag::UnderlyingOptionExerciseNominationDeadline, -1,   false},
+{tag::UnderlyingOptionExerciseFirstDateUnadjusted, -1,   false},
+{tag::UnderlyingOptionExerciseLastDateUnadjusted, -1,   false},
+{tag::UnderlyingOptionExerciseEarliestTime,    -1,   false},
+{tag::UnderlyingOptionExerciseLatestTime,      -1,   false},
+{tag::UnderlyingOptionExerciseTimeBusinessCenter, -1,   false},
+{tag::UnderlyingOptionExerciseDate,            -1,   false},
+{tag::UnderlyingOptionExerciseDateType,        -1,   false},
+{tag::UnderlyingOptionExerciseExpirationDateBusinessCenter, -1,   false},
+{tag::UnderlyingOptionExerciseExpirationDateBusinessDayConvention, -1,   false},
+{tag::NoUnderlyingOptionExerciseExpirationDateBusinessCenters, 525,  false}, // UnderlyingOptionExerciseExpirationDateBusinessCenterGrp
+{tag::NoUnderlyingOptionExerciseExpirationDates, 527,  false}, // UnderlyingOptionExerciseExpirationDateGrp
+{tag::UnderlyingOptionExerciseExpirationDateRelativeTo, -1,   false},
+{tag::UnderlyingOptionExerciseExpirationDateOffsetPeriod, -1,   false},
+{tag::UnderlyingOptionExerciseExpirationDateOffsetUnit, -1,   false},
+{tag::UnderlyingOptionExerciseExpirationFrequencyPeriod, -1,   false},
+{tag::UnderlyingOptionExerciseExpirationFrequencyUnit, -1,   false},
+{tag::UnderlyingOptionExerciseExpirationRollConvention, -1,   false},
+{tag::UnderlyingOptionExerciseExpirationDateOffsetDayType, -1,   false},
+{tag::UnderlyingOptionExerciseExpirationTime,  -1,   false},
+{tag::UnderlyingOptionExerciseExpirationTimeBusinessCenter, -1,   false},
+{tag::UnderlyingOptionExerciseExpirationDate,  -1,   false},
+{tag::UnderlyingOptionExerciseExpirationDateType, -1,   false},
+{tag::UnderlyingMarketDisruptionProvision,     -1,   false},
+{tag::NoUnderlyingMarketDisruptionEvents,      529,  false}, // UnderlyingMarketDisruptionEventGrp
+{tag::UnderlyingMarketDisruptionFallbackProvision, -1,   false},
+{tag::NoUnderlyingMarketDisruptionFallbacks,   530,  false}, // UnderlyingMarketDisruptionFallbackGrp
+{tag::NoUnderlyingMarketDisruptionFallbackReferencePrices, 531,  false}, // UnderlyingMarketDisruptionFallbackReferencePriceGrp
+{tag::UnderlyingMarketDisruptionMaximumDays,   -1,   false},
+{tag::UnderlyingMarketDisruptionMaterialityPercentage, -1,   false},
+{tag::UnderlyingMarketDisruptionMinimumFuturesContracts, -1,   false},
+{tag::UnderlyingMarketDisruptionEvent,         -1,   false},
+{tag::UnderlyingMarketDisruptionValue,         -1,   false},
+{tag::UnderlyingMarketDisruptionFallbackType,  -1,   false},
+{tag::UnderlyingMarketDisruptionFallbackValue, -1,   false},
+{tag::UnderlyingMarketDisruptionFallbackUnderlierType, -1,   false},
+{tag::UnderlyingMarketDisruptionFallbackUnderlierSecurityID, -1,   false},
+{tag::UnderlyingMarketDisruptionFallbackUnderlierSecurityIDSource, -1,   false},
+{tag::UnderlyingMarketDisruptionFallbackUnderlierSecurityDesc, -1,   false},
+{tag::EncodedUnderlyingMarketDisruptionFallbackUnderlierSecurityDescLen, -1,   false},
+{tag::EncodedUnderlyingMarketDisruptionFallbackUnderlierSecurityDesc, -1,   false},
+{tag::UnderlyingMarketDisruptionFallbackOpenUnits, -1,   false},
+{tag::UnderlyingMarketDisruptionFallbackBasketCurrency, -1,   false},
+{tag::UnderlyingMarketDisruptionFallbackBasketDivisor, -1,   false},
+{tag::UnderlyingPaymentScheduleFixingDayOfWeek, -1,   false},
+{tag::UnderlyingPaymentScheduleFixingDayNumber, -1,   false},
+{tag::UnderlyingPaymentStreamPricingBusinessCenter, -1,   false},
+{tag::UnderlyingPaymentStreamPaymentDate,      -1,   false},
+{tag::UnderlyingPaymentStreamPaymentDateType,  -1,   false},
+{tag::UnderlyingPaymentStreamPricingDate,      -1,   false},
+{tag::UnderlyingPaymentStreamPricingDateType,  -1,   false},
+{tag::UnderlyingPaymentStreamPricingDayOfWeek, -1,   false},
+{tag::UnderlyingPaymentStreamPricingDayNumber, -1,   false},
+{tag::UnderlyingPricingDateBusinessCenter,     -1,   false},
+{tag::UnderlyingPricingDateUnadjusted,         -1,   false},
+{tag::UnderlyingPricingDateBusinessDayConvention, -1,   false},
+{tag::NoUnderlyingPricingDateBusinessCenters,  537,  false}, // UnderlyingPricingDateBusinessCenterGrp
+{tag::UnderlyingPricingDateAdjusted,           -1,   false},
+{tag::UnderlyingPricingTime,                   -1,   false},
+{tag::UnderlyingPricingTimeBusinessCenter,     -1,   false},
+{tag::UnderlyingStreamCalculationPeriodDate,   -1,   false},
+{tag::UnderlyingStreamCalculationPeriodDateType, -1,   false},
+{tag::UnderlyingStreamCommoditySettlBusinessCenter, -1,   false},
+{tag::UnderlyingStreamCommodityBase,           -1,   false},
+{tag::UnderlyingStreamCommodityType,           -1,   false},
+{tag::UnderlyingStreamCommoditySecurityID,     -1,   false},
+{tag::UnderlyingStreamCommoditySecurityIDSource, -1,   false},
+{tag::NoUnderlyingStreamCommodityAltIDs,       542,  false}, // UnderlyingStreamCommodityAltIDGrp
+{tag::UnderlyingStreamCommodityDesc,           -1,   false},
+{tag::EncodedUnderlyingStreamCommodityDescLen, -1,   false},
+{tag::EncodedUnderlyingStreamCommodityDesc,    -1,   false},
+{tag::UnderlyingStreamCommodityDeliveryPricingRegion, -1,   false},
+{tag::NoUnderlyingStreamAssetAttributes,       518,  false}, // UnderlyingStreamAssetAttributeGrp
+{tag::UnderlyingStreamCommodityUnitOfMeasure,  -1,   false},
+{tag::UnderlyingStreamCommodityCurrency,       -1,   false},
+{tag::UnderlyingStreamCommodityExchange,       -1,   false},
+{tag::UnderlyingStreamCommodityRateSource,     -1,   false},
+{tag::UnderlyingStreamCommodityRateReferencePage, -1,   false},
+{tag::UnderlyingStreamCommodityRateReferencePageHeading, -1,   false},
+{tag::UnderlyingStreamDataProvider,            -1,   false},
+{tag::NoUnderlyingStreamCommodityDataSources,  543,  false}, // UnderlyingStreamCommodityDataSourceGrp
+{tag::UnderlyingStreamCommodityPricingType,    -1,   false},
+{tag::UnderlyingStreamCommodityNearbySettlDayPeriod, -1,   false},
+{tag::UnderlyingStreamCommodityNearbySettlDayUnit, -1,   false},
+{tag::UnderlyingStreamCommoditySettlDateUnadjusted, -1,   false},
+{tag::UnderlyingStreamCommoditySettlDateBusinessDayConvention, -1,   false},
+{tag::NoUnderlyingStreamCommoditySettlBusinessCenters, 540,  false}, // UnderlyingStreamCommoditySettlBusinessCenterGrp
+{tag::UnderlyingStreamCommoditySettlDateAdjusted, -1,   false},
+{tag::UnderlyingStreamCommoditySettlMonth,     -1,   false},
+{tag::UnderlyingStreamCommoditySettlDateRollPeriod, -1,   false},
+{tag::UnderlyingStreamCommoditySettlDateRollUnit, -1,   false},
+{tag::UnderlyingStreamCommoditySettlDayType,   -1,   false},
+{tag::NoUnderlyingStreamCommoditySettlPeriods, 546,  false}, // UnderlyingStreamCommoditySettlPeriodGrp
+{tag::UnderlyingStreamCommodityXID,            -1,   false},
+{tag::UnderlyingStreamCommodityXIDRef,         -1,   false},
+{tag::UnderlyingStreamCommodityAltID,          -1,   false},
+{tag::UnderlyingStreamCommodityAltIDSource,    -1,   false},
+{tag::UnderlyingStreamCommodityDataSourceID,   -1,   false},
+{tag::UnderlyingStreamCommodityDataSourceIDType, -1,   false},
+{tag::UnderlyingStreamCommoditySettlDay,       -1,   false},
+{tag::UnderlyingStreamCommoditySettlTotalHours, -1,   false},
+{tag::NoUnderlyingStreamCommoditySettlTimes,   545,  false}, // UnderlyingStreamCommoditySettlTimeGrp
+{tag::UnderlyingStreamCommoditySettlStart,     -1,   false},
+{tag::UnderlyingStreamCommoditySettlEnd,       -1,   false},
+{tag::UnderlyingStreamCommoditySettlTimeType,  -1,   false},
+{tag::UnderlyingStreamCommoditySettlCountry,   -1,   false},
+{tag::UnderlyingStreamCommoditySettlTimeZone,  -1,   false},
+{tag::UnderlyingStreamCommoditySettlFlowType,  -1,   false},
+{tag::UnderlyingStreamCommoditySettlPeriodNotional, -1,   false},
+{tag::UnderlyingStreamCommoditySettlPeriodNotionalUnitOfMeasure, -1,   false},
+{tag::UnderlyingStreamCommoditySettlPeriodFrequencyPeriod, -1,   false},
+{tag::UnderlyingStreamCommoditySettlPeriodFrequencyUnit, -1,   false},
+{tag::UnderlyingStreamCommoditySettlPeriodPrice, -1,   false},
+{tag::UnderlyingStreamCommoditySettlPeriodPriceUnitOfMeasure, -1,   false},
+{tag::UnderlyingStreamCommoditySettlPeriodPriceCurrency, -1,   false},
+{tag::UnderlyingStreamCommoditySettlHolidaysProcessingInstruction, -1,   false},
+{tag::NoUnderlyingStreamCommoditySettlDays,    544,  false}, // UnderlyingStreamCommoditySettlDayGrp
+{tag::UnderlyingStreamCommoditySettlPeriodXID, -1,   false},
+{tag::UnderlyingStreamCommoditySettlPeriodXIDRef, -1,   false},
+{tag::EntitlementType,                         -1,   false},
+{tag::EntitlementSubType,                      -1,   false},
+{tag::UnderlyingAdditionalTermBondSecurityID,  -1,   false},
+{tag::UnderlyingAdditionalTermBondSecurityIDSource, -1,   false},
+{tag::UnderlyingAdditionalTermBondDesc,        -1,   false},
+{tag::EncodedUnderlyingAdditionalTermBondDescLen, -1,   false},
+{tag::EncodedUnderlyingAdditionalTermBondDesc, -1,   false},
+{tag::UnderlyingAdditionalTermBondCurrency,    -1,   false},
+{tag::UnderlyingAdditionalTermBondIssuer,      -1,   false},
+{tag::EncodedUnderlyingAdditionalTermBondIssuerLen, -1,   false},
+{tag::EncodedUnderlyingAdditionalTermBondIssuer, -1,   false},
+{tag::UnderlyingAdditionalTermBondSeniority,   -1,   false},
+{tag::UnderlyingAdditionalTermBondCouponType,  -1,   false},
+{tag::UnderlyingAdditionalTermBondCouponRate,  -1,   false},
+{tag::UnderlyingAdditionalTermBondMaturityDate, -1,   false},
+{tag::UnderlyingAdditionalTermBondParValue,    -1,   false},
+{tag::UnderlyingAdditionalTermBondCurrentTotalIssuedAmount, -1,   false},
+{tag::UnderlyingAdditionalTermBondCouponFrequencyPeriod, -1,   false},
+{tag::UnderlyingAdditionalTermBondCouponFrequencyUnit, -1,   false},
+{tag::UnderlyingAdditionalTermBondDayCount,    -1,   false},
+{tag::UnderlyingAdditionalTermConditionPrecedentBondIndicator, -1,   false},
+{tag::UnderlyingAdditionalTermDiscrepancyClauseIndicator, -1,   false},
+{tag::NoUnderlyingAdditionalTermBondRefs,      548,  false}, // UnderlyingAdditionalTermBondRefGrp
+{tag::UnderlyingCashSettlDealer,               -1,   false},
+{tag::UnderlyingCashSettlCurrency,             -1,   false},
+{tag::UnderlyingCashSettlValuationFirstBusinessDayOffset, -1,   false},
+{tag::UnderlyingCashSettlValuationSubsequentBusinessDaysOffset, -1,   false},
+{tag::UnderlyingCashSettlNumOfValuationDates,  -1,   false},
+{tag::UnderlyingCashSettlValuationTime,        -1,   false},
+{tag::UnderlyingCashSettlBusinessCenter,       -1,   false},
+{tag::UnderlyingCashSettlQuoteMethod,          -1,   false},
+{tag::UnderlyingCashSettlQuoteAmount,          -1,   false},
+{tag::UnderlyingCashSettlQuoteCurrency,        -1,   false},
+{tag::UnderlyingCashSettlMinimumQuoteAmount,   -1,   false},
+{tag::UnderlyingCashSettlMinimumQuoteCurrency, -1,   false},
+{tag::NoUnderlyingCashSettlDealers,            550,  false}, // UnderlyingCashSettlDealerGrp
+{tag::UnderlyingCashSettlPriceSource,          -1,   false},
+{tag::UnderlyingCashSettlPriceDefault,         -1,   false},
+{tag::UnderlyingCashSettlBusinessDays,         -1,   false},
+{tag::UnderlyingCashSettlAmount,               -1,   false},
+{0,                                            669,  false}, // UnderlyingCashSettlDate
+{tag::UnderlyingCashSettlRecoveryFactor,       -1,   false},
+{tag::UnderlyingCashSettlFixedTermIndicator,   -1,   false},
+{tag::UnderlyingCashSettlAccruedInterestIndicator, -1,   false},
+{tag::UnderlyingCashSettlValuationMethod,      -1,   false},
+{tag::UnderlyingCashSettlTermXID,              -1,   false},
+{tag::NoUnderlyingPhysicalSettlDeliverableObligations, 553,  false}, // UnderlyingPhysicalSettlDeliverableObligationGrp
+{tag::UnderlyingPhysicalSettlCurrency,         -1,   false},
+{tag::UnderlyingPhysicalSettlBusinessDays,     -1,   false},
+{tag::UnderlyingPhysicalSettlMaximumBusinessDays, -1,   false},
+{tag::UnderlyingPhysicalSettlTermXID,          -1,   false},
+{tag::UnderlyingPhysicalSettlDeliverableObligationType, -1,   false},
+{tag::UnderlyingPhysicalSettlDeliverableObligationValue, -1,   false},
+{tag::UnderlyingProtectionTermNotional,        -1,   false},
+{tag::UnderlyingProtectionTermCurrency,        -1,   false},
+{tag::UnderlyingProtectionTermSellerNotifies,  -1,   false},
+{tag::UnderlyingProtectionTermBuyerNotifies,   -1,   false},
+{tag::UnderlyingProtectionTermEventBusinessCenter, -1,   false},
+{tag::UnderlyingProtectionTermStandardSources, -1,   false},
+{tag::UnderlyingProtectionTermEventMinimumSources, -1,   false},
+{tag::NoUnderlyingProtectionTermEventNewsSources, 558,  false}, // UnderlyingProtectionTermEventNewsSourceGrp
+{tag::NoUnderlyingProtectionTermEvents,        555,  false}, // UnderlyingProtectionTermEventGrp
+{tag::NoUnderlyingProtectionTermObligations,   557,  false}, // UnderlyingProtectionTermObligationGrp
+{tag::UnderlyingProtectionTermXID,             -1,   false},
+{tag::UnderlyingProtectionTermEventType,       -1,   false},
+{tag::UnderlyingProtectionTermEventValue,      -1,   false},
+{tag::UnderlyingProtectionTermEventCurrency,   -1,   false},
+{tag::UnderlyingProtectionTermEventPeriod,     -1,   false},
+{tag::UnderlyingProtectionTermEventUnit,       -1,   false},
+{tag::UnderlyingProtectionTermEventDayType,    -1,   false},
+{tag::UnderlyingProtectionTermEventRateSource, -1,   false},
+{tag::NoUnderlyingProtectionTermEventQualifiers, 556,  false}, // UnderlyingProtectionTermEventQualifierGrp
+{tag::UnderlyingProtectionTermEventQualifier,  -1,   false},
+{tag::UnderlyingProtectionTermObligationType,  -1,   false},
+{tag::UnderlyingProtectionTermObligationValue, -1,   false},
+{tag::UnderlyingProtectionTermEventNewsSource, -1,   false},
+{tag::UnderlyingProvisionCashSettlPaymentDateBusinessDayConvention, -1,   false},
+{tag::NoUnderlyingProvisionCashSettlPaymentDateBusinessCenters, 570,  false}, // UnderlyingProvisionCashSettlPaymentDateBusinessCenterGrp
+{tag::UnderlyingProvisionCashSettlPaymentDateRelativeTo, -1,   false},
+{tag::UnderlyingProvisionCashSettlPaymentDateOffsetPeriod, -1,   false},
+{tag::UnderlyingProvisionCashSettlPaymentDateOffsetUnit, -1,   false},
+{tag::UnderlyingProvisionCashSettlPaymentDateOffsetDayType, -1,   false},
+{tag::UnderlyingProvisionCashSettlPaymentDateRangeFirst, -1,   false},
+{tag::UnderlyingProvisionCashSettlPaymentDateRangeLast, -1,   false},
+{tag::NoUnderlyingProvisionCashSettlPaymentDates, 560,  false}, // UnderlyingProvisionCashSettlPaymentFixedDateGrp
+{tag::UnderlyingProvisionCashSettlPaymentDate, -1,   false},
+{tag::UnderlyingProvisionCashSettlPaymentDateType, -1,   false},
+{tag::UnderlyingProvisionCashSettlQuoteSource, -1,   false},
+{tag::UnderlyingProvisionCashSettlQuoteReferencePage, -1,   false},
+{tag::UnderlyingProvisionCashSettlValueTime,   -1,   false},
+{tag::UnderlyingProvisionCashSettlValueTimeBusinessCenter, -1,   false},
+{tag::UnderlyingProvisionCashSettlValueDateBusinessDayConvention, -1,   false},
+{tag::NoUnderlyingProvisionCashSettlValueDateBusinessCenters, 571,  false}, // UnderlyingProvisionCashSettlValueDateBusinessCenterGrp
+{tag::UnderlyingProvisionCashSettlValueDateRelativeTo, -1,   false},
+{tag::UnderlyingProvisionCashSettlValueDateOffsetPeriod, -1,   false},
+{tag::UnderlyingProvisionCashSettlValueDateOffsetUnit, -1,   false},
+{tag::UnderlyingProvisionCashSettlValueDateOffsetDayType, -1,   false},
+{tag::UnderlyingProvisionCashSettlValueDateAdjusted, -1,   false},
+{tag::UnderlyingProvisionOptionExerciseFixedDate, -1,   false},
+{tag::UnderlyingProvisionOptionExerciseFixedDateType, -1,   false},
+{tag::UnderlyingProvisionOptionExerciseBusinessDayConvention, -1,   false},
+{tag::NoUnderlyingProvisionOptionExerciseBusinessCenters, 572,  false}, // UnderlyingProvisionOptionExerciseBusinessCenterGrp
+{tag::NoUnderlyingProvisionOptionExerciseFixedDates, 563,  false}, // UnderlyingProvisionOptionExerciseFixedDateGrp
+{tag::UnderlyingProvisionOptionExerciseEarliestDateOffsetPeriod, -1,   false},
+{tag::UnderlyingProvisionOptionExerciseEarliestDateOffsetUnit, -1,   false},
+{tag::UnderlyingProvisionOptionExerciseFrequencyPeriod, -1,   false},
+{tag::UnderlyingProvisionOptionExerciseFrequencyUnit, -1,   false},
+{tag::UnderlyingProvisionOptionExerciseStartDateUnadjusted, -1,   false},
+{tag::UnderlyingProvisionOptionExerciseStartDateRelativeTo, -1,   false},
+{tag::UnderlyingProvisionOptionExerciseStartDateOffsetPeriod, -1,   false},
+{tag::UnderlyingProvisionOptionExerciseStartDateOffsetUnit, -1,   false},
+{tag::UnderlyingProvisionOptionExerciseStartDateOffsetDayType, -1,   false},
+{tag::UnderlyingProvisionOptionExerciseStartDateAdjusted, -1,   false},
+{tag::UnderlyingProvisionOptionExercisePeriodSkip, -1,   false},
+{tag::UnderlyingProvisionOptionExerciseBoundsFirstDateUnadjusted, -1,   false},
+{tag::UnderlyingProvisionOptionExerciseBoundsLastDateUnadjusted, -1,   false},
+{tag::UnderlyingProvisionOptionExerciseEarliestTime, -1,   false},
+{tag::UnderlyingProvisionOptionExerciseEarliestTimeBusinessCenter, -1,   false},
+{tag::UnderlyingProvisionOptionExerciseLatestTime, -1,   false},
+{tag::UnderlyingProvisionOptionExerciseLatestTimeBusinessCenter, -1,   false},
+{tag::UnderlyingProvisionOptionExpirationDateUnadjusted, -1,   false},
+{tag::UnderlyingProvisionOptionExpirationDateBusinessDayConvention, -1,   false},
+{tag::NoUnderlyingProvisionOptionExpirationDateBusinessCenters, 573,  false}, // UnderlyingProvisionOptionExpirationDateBusinessCenterGrp
+{tag::UnderlyingProvisionOptionExpirationDateRelativeTo, -1,   false},
+{tag::UnderlyingProvisionOptionExpirationDateOffsetPeriod, -1,   false},
+{tag::UnderlyingProvisionOptionExpirationDateOffsetUnit, -1,   false},
+{tag::UnderlyingProvisionOptionExpirationDateOffsetDayType, -1,   false},
+{tag::UnderlyingProvisionOptionExpirationDateAdjusted, -1,   false},
+{tag::UnderlyingProvisionOptionExpirationTime, -1,   false},
+{tag::UnderlyingProvisionOptionExpirationTimeBusinessCenter, -1,   false},
+{tag::UnderlyingProvisionOptionRelevantUnderlyingDateUnadjusted, -1,   false},
+{tag::UnderlyingProvisionOptionRelevantUnderlyingDateBusinessDayConvention, -1,   false},
+{tag::NoUnderlyingProvisionOptionRelevantUnderlyingDateBusinessCenters, 574,  false}, // UnderlyingProvisionOptionRelevantUnderlyingDateBusinessCenterGrp
+{tag::UnderlyingProvisionOptionRelevantUnderlyingDateRelativeTo, -1,   false},
+{tag::UnderlyingProvisionOptionRelevantUnderlyingDateOffsetPeriod, -1,   false},
+{tag::UnderlyingProvisionOptionRelevantUnderlyingDateOffsetUnit, -1,   false},
+{tag::UnderlyingProvisionOptionRelevantUnderlyingDateOffsetDayType, -1,   false},
+{tag::UnderlyingProvisionOptionRelevantUnderlyingDateAdjusted, -1,   false},
+{tag::UnderlyingProvisionType,                 -1,   false},
+{tag::UnderlyingProvisionDateUnadjusted,       -1,   false},
+{tag::UnderlyingProvisionDateBusinessDayConvention, -1,   false},
+{tag::NoUnderlyingProvisionDateBusinessCenters, 575,  false}, // UnderlyingProvisionDateBusinessCenterGrp
+{tag::UnderlyingProvisionDateAdjusted,         -1,   false},
+{tag::UnderlyingProvisionDateTenorPeriod,      -1,   false},
+{tag::UnderlyingProvisionDateTenorUnit,        -1,   false},
+{tag::UnderlyingProvisionBreakFeeElection,     -1,   false},
+{tag::UnderlyingProvisionBreakFeeRate,         -1,   false},
+{tag::UnderlyingProvisionCalculationAgent,     -1,   false},
+{tag::UnderlyingProvisionOptionSinglePartyBuyerSide, -1,   false},
+{tag::UnderlyingProvisionOptionSinglePartySellerSide, -1,   false},
+{0,                                            562,  false}, // UnderlyingProvisionCashSettlValueDates
+{0,                                            564,  false}, // UnderlyingProvisionOptionExerciseDates
+{0,                                            565,  false}, // UnderlyingProvisionOptionExpirationDate
+{0,                                            566,  false}, // UnderlyingProvisionOptionRelevantUnderlyingDate
+{tag::UnderlyingProvisionOptionExerciseStyle,  -1,   false},
+{tag::UnderlyingProvisionOptionExerciseMultipleNotional, -1,   false},
+{tag::UnderlyingProvisionOptionExerciseMinimumNotional, -1,   false},
+{tag::UnderlyingProvisionOptionExerciseMaximumNotional, -1,   false},
+{tag::UnderlyingProvisionOptionMinimumNumber,  -1,   false},
+{tag::UnderlyingProvisionOptionMaximumNumber,  -1,   false},
+{tag::UnderlyingProvisionOptionExerciseConfirmation, -1,   false},
+{0,                                            559,  false}, // UnderlyingProvisionCashSettlPaymentDates
+{tag::UnderlyingProvisionCashSettlMethod,      -1,   false},
+{tag::UnderlyingProvisionCashSettlCurrency,    -1,   false},
+{tag::UnderlyingProvisionCashSettlCurrency2,   -1,   false},
+{tag::UnderlyingProvisionCashSettlQuoteType,   -1,   false},
+{0,                                            561,  false}, // UnderlyingProvisionCashSettlQuoteSource
+{tag::UnderlyingProvisionText,                 -1,   false},
+{tag::EncodedUnderlyingProvisionTextLen,       -1,   false},
+{tag::EncodedUnderlyingProvisionText,          -1,   false},
+{tag::NoUnderlyingProvisionPartyIDs,           568,  false}, // UnderlyingProvisionParties
+{tag::UnderlyingProvisionPartyID,              -1,   false},
+{tag::UnderlyingProvisionPartyIDSource,        -1,   false},
+{tag::UnderlyingProvisionPartyRole,            -1,   false},
+{tag::UnderlyingProvisionPartyRoleQualifier,   -1,   false},
+{tag::NoUnderlyingProvisionPartySubIDs,        569,  false}, // UnderlyingProvisionPtysSubGrp
+{tag::UnderlyingProvisionPartySubID,           -1,   false},
+{tag::UnderlyingProvisionPartySubIDType,       -1,   false},
+{tag::UnderlyingProvisionCashSettlPaymentDateBusinessCenter, -1,   false},
+{tag::UnderlyingProvisionCashSettlValueDateBusinessCenter, -1,   false},
+{tag::UnderlyingProvisionOptionExerciseBusinessCenter, -1,   false},
+{tag::UnderlyingProvisionOptionExpirationDateBusinessCenter, -1,   false},
+{tag::UnderlyingProvisionOptionRelevantUnderlyingDateBusinessCenter, -1,   false},
+{tag::UnderlyingProvisionDateBusinessCenter,   -1,   false},
+{tag::OrderEntryAction,                        -1,   false},
+{tag::OrderEntryID,                            -1,   false},
+{tag::ClOrdID,                                 -1,   false},
+{tag::OrigClOrdID,                             -1,   false},
+{tag::OrderID,                                 -1,   false},
+{tag::OrdType,                                 -1,   false},
+{tag::Price,                                   -1,   false},
+{tag::Side,                                    -1,   false},
+{tag::TimeInForce,                             -1,   false},
+{0,                                            9,    false}, // OrderQtyData
+{0,                                            3,    false}, // Instrument
+{tag::OrdStatus,                               -1,   false},
+{tag::ExecType,                                -1,   false},
+{tag::ExecTypeReason,                          -1,   false},
+{tag::OrderEntryAction,                        -1,   false},
+{tag::OrderEntryID,                            -1,   false},
+{tag::ClOrdID,                                 -1,   false},
+{tag::OrigClOrdID,                             -1,   false},
+{tag::OrderID,                                 -1,   false},
+{tag::OrdRejReason,                            -1,   false},
+{tag::CumQty,                                  -1,   false},
+{tag::LeavesQty,                               -1,   false},
+{tag::CxlQty,                                  -1,   false},
+{tag::OrdType,                                 -1,   false},
+{tag::Price,                                   -1,   false},
+{tag::Side,                                    -1,   false},
+{tag::TimeInForce,                             -1,   false},
+{0,                                            9,    false}, // OrderQtyData
+{0,                                            3,    false}, // Instrument
+{tag::TargetPartySubID,                        -1,   false},
+{tag::TargetPartySubIDType,                    -1,   false},
+{tag::MDStatisticID,                           -1,   false},
+{0,                                            581,  false}, // MDStatisticParameters
+{0,                                            581,  false}, // MDStatisticParameters
+{tag::MDStatisticID,                           -1,   false},
+{tag::MDStatisticTime,                         -1,   false},
+{tag::MDStatisticStatus,                       -1,   false},
+{tag::MDStatisticValue,                        -1,   false},
+{tag::MDStatisticValueType,                    -1,   false},
+{tag::MDStatisticValueUnit,                    -1,   false},
+{tag::MDStatisticType,                         -1,   true},
+{tag::MDStatisticScope,                        -1,   true},
+{tag::MDStatisticSubScope,                     -1,   false},
+{tag::MDStatisticScopeType,                    -1,   false},
+{tag::MDStatisticName,                         -1,   false},
+{tag::MDStatisticDesc,                         -1,   false},
+{tag::EncodedMDStatisticDescLen,               -1,   false},
+{tag::EncodedMDStatisticDesc,                  -1,   false},
+{tag::MarketDepth,                             -1,   false},
+{tag::MDStatisticFrequencyPeriod,              -1,   false},
+{tag::MDStatisticFrequencyUnit,                -1,   false},
+{tag::MDStatisticDelayPeriod,                  -1,   false},
+{tag::MDStatisticDelayUnit,                    -1,   false},
+{tag::MDStatisticIntervalType,                 -1,   true},
+{tag::MDStatisticIntervalTypeUnit,             -1,   false},
+{tag::MDStatisticIntervalPeriod,               -1,   false},
+{tag::MDStatisticIntervalUnit,                 -1,   false},
+{tag::MDStatisticStartDate,                    -1,   false},
+{tag::MDStatisticEndDate,                      -1,   false},
+{tag::MDStatisticStartTime,                    -1,   false},
+{tag::MDStatisticEndTime,                      -1,   false},
+{tag::MDStatisticRatioType,                    -1,   false},
+{tag::NoNestedPartyIDs,                        8,    false}, // NestedParties
+{tag::AnnualTradingBusinessDays,               -1,   false},
+{tag::TradingCapacity,                         -1,   false},
+{tag::OrdType,                                 -1,   false},
+{tag::TimeInForce,                             -1,   false},
+{tag::QuoteCondition,                          -1,   false},
+{tag::TradeCondition,                          -1,   false},
+{tag::Side,                                    -1,   false},
+{tag::TradeInputSource,                        -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::MDOriginType,                            -1,   false},
+{tag::MDValueTier,                             -1,   false},
+{tag::TradSesMethod,                           -1,   false},
+{tag::MDFeedType,                              -1,   false},
+{tag::ExposureDuration,                        -1,   false},
+{tag::ExposureDurationUnit,                    -1,   false},
+{tag::AggressorIndicator,                      -1,   false},
+{tag::LegAgreementDesc,                        -1,   false},
+{tag::LegAgreementID,                          -1,   false},
+{tag::LegAgreementVersion,                     -1,   false},
+{tag::LegAgreementDate,                        -1,   false},
+{tag::LegAgreementCurrency,                    -1,   false},
+{tag::LegMasterConfirmationDesc,               -1,   false},
+{tag::LegMasterConfirmationDate,               -1,   false},
+{tag::LegMasterConfirmationAnnexDesc,          -1,   false},
+{tag::LegMasterConfirmationAnnexDate,          -1,   false},
+{tag::LegBrokerConfirmationDesc,               -1,   false},
+{tag::NoLegContractualDefinitions,             583,  false}, // LegFinancingContractualDefinitionsGrp
+{tag::NoLegFinancingTermSupplements,           584,  false}, // LegFinancingTermSupplementGrp
+{tag::NoLegContractualMatrices,                585,  false}, // LegFinancingContractualMatrixGrp
+{tag::LegCreditSupportAgreementDesc,           -1,   false},
+{tag::LegCreditSupportAgreementDate,           -1,   false},
+{tag::LegCreditSupportAgreementID,             -1,   false},
+{tag::LegGoverningLaw,                         -1,   false},
+{tag::LegDocumentationText,                    -1,   false},
+{tag::EncodedLegDocumentationTextLen,          -1,   false},
+{tag::EncodedLegDocumentationText,             -1,   false},
+{tag::LegTerminationType,                      -1,   false},
+{tag::LegStartDate,                            -1,   false},
+{tag::LegEndDate,                              -1,   false},
+{tag::LegDeliveryType,                         -1,   false},
+{tag::LegMarginRatio,                          -1,   false},
+{tag::LegContractualDefinition,                -1,   false},
+{tag::LegFinancingTermSupplementDesc,          -1,   false},
+{tag::LegFinancingTermSupplementDate,          -1,   false},
+{tag::LegContractualMatrixSource,              -1,   false},
+{tag::LegContractualMatrixDate,                -1,   false},
+{tag::LegContractualMatrixTerm,                -1,   false},
+{tag::RelativeValueType,                       -1,   false},
+{tag::RelativeValue,                           -1,   false},
+{tag::RelativeValueSide,                       -1,   false},
+{tag::AuctionType,                             -1,   false},
+{tag::AuctionTypeProductComplex,               -1,   false},
+{tag::FlexProductEligibilityIndicator,         -1,   false},
+{tag::FlexProductEligibilityComplex,           -1,   false},
+{tag::StartPriceRange,                         -1,   false},
+{tag::EndPriceRange,                           -1,   false},
+{tag::PriceRangeValue,                         -1,   false},
+{tag::PriceRangePercentage,                    -1,   false},
+{tag::PriceRangeRuleID,                        -1,   false},
+{tag::PriceRangeProductComplex,                -1,   false},
+{tag::MinBidSize,                              -1,   false},
+{tag::MinOfferSize,                            -1,   false},
+{tag::FastMarketIndicator,                     -1,   false},
+{tag::RelatedMarketSegmentID,                  -1,   false},
+{tag::MarketSegmentRelationship,               -1,   false},
+{tag::BusinessDayType,                         -1,   false},
+{tag::ClearingPriceOffset,                     -1,   false},
+{tag::VegaMultiplier,                          -1,   false},
+{tag::AnnualTradingBusinessDays,               -1,   false},
+{tag::TotalTradingBusinessDays,                -1,   false},
+{tag::TradingBusinessDays,                     -1,   false},
+{tag::StandardVariance,                        -1,   false},
+{tag::RealizedVariance,                        -1,   false},
+{tag::RelatedClosePrice,                       -1,   false},
+{tag::RiskFreeRate,                            -1,   false},
+{tag::OvernightInterestRate,                   -1,   false},
+{tag::AccumulatedReturnModifiedVariationMargin, -1,   false},
+{tag::DiscountFactor,                          -1,   false},
+{tag::Volatility,                              -1,   false},
+{tag::ClearingSettlPrice,                      -1,   false},
+{tag::CalculationMethod,                       -1,   false},
+{tag::MiscFeeSubType,                          -1,   false},
+{tag::MiscFeeSubTypeAmt,                       -1,   false},
+{tag::MiscFeeSubTypeDesc,                      -1,   false},
+{tag::EncodedMiscFeeSubTypeDescLen,            -1,   false},
+{tag::EncodedMiscFeeSubTypeDesc,               -1,   false},
+{tag::CommissionAmount,                        -1,   false},
+{tag::CommissionAmountType,                    -1,   false},
+{tag::CommissionAmountSubType,                 -1,   false},
+{tag::CommissionBasis,                         -1,   false},
+{tag::CommissionCurrency,                      -1,   false},
+{tag::CommissionUnitOfMeasure,                 -1,   false},
+{tag::CommissionUnitOfMeasureCurrency,         -1,   false},
+{tag::CommissionRate,                          -1,   false},
+{tag::CommissionSharedIndicator,               -1,   false},
+{tag::CommissionAmountShared,                  -1,   false},
+{tag::CommissionLegRefID,                      -1,   false},
+{tag::CommissionDesc,                          -1,   false},
+{tag::EncodedCommissionDescLen,                -1,   false},
+{tag::EncodedCommissionDesc,                   -1,   false},
+{tag::AllocCommissionAmount,                   -1,   false},
+{tag::AllocCommissionAmountType,               -1,   false},
+{tag::AllocCommissionAmountSubType,            -1,   false},
+{tag::AllocCommissionBasis,                    -1,   false},
+{tag::AllocCommissionCurrency,                 -1,   false},
+{tag::AllocCommissionUnitOfMeasure,            -1,   false},
+{tag::AllocCommissionUnitOfMeasureCurrency,    -1,   false},
+{tag::AllocCommissionRate,                     -1,   false},
+{tag::AllocCommissionSharedIndicator,          -1,   false},
+{tag::AllocCommissionAmountShared,             -1,   false},
+{tag::AllocCommissionLegRefID,                 -1,   false},
+{tag::AllocCommissionDesc,                     -1,   false},
+{tag::EncodedAllocCommissionDescLen,           -1,   false},
+{tag::EncodedAllocCommissionDesc,              -1,   false},
+{tag::CashSettlDateUnadjusted,                 -1,   false},
+{tag::CashSettlDateBusinessDayConvention,      -1,   false},
+{tag::NoCashSettlDateBusinessCenters,          597,  false}, // CashSettlDateBusinessCenterGrp
+{tag::CashSettlDateRelativeTo,                 -1,   false},
+{tag::CashSettlDateOffsetPeriod,               -1,   false},
+{tag::CashSettlDateOffsetUnit,                 -1,   false},
+{tag::CashSettlDateOffsetDayType,              -1,   false},
+{tag::CashSettlDateAdjusted,                   -1,   false},
+{tag::CashSettlDateBusinessCenter,             -1,   false},
+{tag::DividendFloatingRateIndex,               -1,   false},
+{tag::DividendFloatingRateIndexCurvePeriod,    -1,   false},
+{tag::DividendFloatingRateIndexCurveUnit,      -1,   false},
+{tag::DividendFloatingRateMultiplier,          -1,   false},
+{tag::DividendFloatingRateSpread,              -1,   false},
+{tag::DividendFloatingRateSpreadPositionType,  -1,   false},
+{tag::DividendFloatingRateTreatment,           -1,   false},
+{tag::DividendCapRate,                         -1,   false},
+{tag::DividendCapRateBuySide,                  -1,   false},
+{tag::DividendCapRateSellSide,                 -1,   false},
+{tag::DividendFloorRate,                       -1,   false},
+{tag::DividendFloorRateBuySide,                -1,   false},
+{tag::DividendFloorRateSellSide,               -1,   false},
+{tag::DividendInitialRate,                     -1,   false},
+{tag::DividendFinalRateRoundingDirection,      -1,   false},
+{tag::DividendFinalRatePrecision,              -1,   false},
+{tag::DividendAveragingMethod,                 -1,   false},
+{tag::DividendNegativeRateTreatment,           -1,   false},
+{tag::DividendAccrualPaymentDateBusinessCenter, -1,   false},
+{tag::DividendAccrualPaymentDateRelativeTo,    -1,   false},
+{tag::DividendAccrualPaymentDateOffsetPeriod,  -1,   false},
+{tag::DividendAccrualPaymentDateOffsetUnit,    -1,   false},
+{tag::DividendAccrualPaymentDateOffsetDayType, -1,   false},
+{tag::DividendAccrualPaymentDateUnadjusted,    -1,   false},
+{tag::DividendAccrualPaymeentDateBusinessDayConvention, -1,   false},
+{tag::NoDividendAccrualPaymentDateBusinessCenters, 599,  false}, // DividendAccrualPaymentDateBusinessCenterGrp
+{tag::DividendAccrualPaymentDateAdjusted,      -1,   false},
+{tag::DividendReinvestmentIndicator,           -1,   false},
+{tag::DividendEntitlementEvent,                -1,   false},
+{tag::DividendAmountType,                      -1,   false},
+{tag::DividendUnderlierRefID,                  -1,   false},
+{tag::NoDividendPeriods,                       604,  false}, // DividendPeriodGrp
+{tag::ExtraordinaryDividendPartySide,          -1,   false},
+{tag::ExtraordinaryDividendAmountType,         -1,   false},
+{tag::ExtraordinaryDividendCurrency,           -1,   false},
+{tag::ExtraordinaryDividendDeterminationMethod, -1,   false},
+{0,                                            602,  false}, // DividendFXTriggerDate
+{0,                                            598,  false}, // DividendAccrualFloatingRate
+{tag::DividendAccrualFixedRate,                -1,   false},
+{0,                                            600,  false}, // DividendAccrualPaymentDate
+{tag::DividendCompoundingMethod,               -1,   false},
+{tag::DividendNumOfIndexUnits,                 -1,   false},
+{tag::DividendCashPercentage,                  -1,   false},
+{tag::DividendCashEquivalentPercentage,        -1,   false},
+{tag::NonCashDividendTreatment,                -1,   false},
+{tag::DividendComposition,                     -1,   false},
+{tag::SpecialDividendsIndicator,               -1,   false},
+{tag::MaterialDividendsIndicator,              -1,   false},
+{tag::OptionsExchangeDividendsIndicator,       -1,   false},
+{tag::AdditionalDividendsIndicator,            -1,   false},
+{tag::AllDividendsIndicator,                   -1,   false},
+{tag::DividendFXTriggerDateRelativeTo,         -1,   false},
+{tag::DividendFXTriggerDateOffsetPeriod,       -1,   false},
+{tag::DividendFXTriggerDateOffsetUnit,         -1,   false},
+{tag::DividendFXTriggerDateOffsetDayType,      -1,   false},
+{tag::DividendFXTriggerDateUnadjusted,         -1,   false},
+{tag::DividendFXTriggerDateBusinessDayConvention, -1,   false},
+{tag::NoDividendFXTriggerDateBusinessCenters,  603,  false}, // DividendFXTriggerDateBusinessCenterGrp
+{tag::DividendFXTriggerDateAdjusted,           -1,   false},
+{tag::DividendFXTriggerDateBusinessCenter,     -1,   false},
+{tag::DividendPeriodSequence,                  -1,   false},
+{tag::DividendPeriodStartDateUnadjusted,       -1,   false},
+{tag::DividendPeriodEndDateUnadjusted,         -1,   false},
+{tag::DividendPeriodUnderlierRefID,            -1,   false},
+{tag::DividendPeriodStrikePrice,               -1,   false},
+{tag::DividendPeriodBusinessDayConvention,     -1,   false},
+{tag::NoDividendPeriodBusinessCenters,         605,  false}, // DividendPeriodBusinessCenterGrp
+{tag::DividendPeriodValuationDateUnadjusted,   -1,   false},
+{tag::DividendPeriodValuationDateRelativeTo,   -1,   false},
+{tag::DividendPeriodValuationDateOffsetPeriod, -1,   false},
+{tag::DividendPeriodValuationDateOffsetUnit,   -1,   false},
+{tag::DividendPeriodValuationDateOffsetDayType, -1,   false},
+{tag::DividendPeriodValuationDateAdjusted,     -1,   false},
+{tag::DividendPeriodPaymentDateUnadjusted,     -1,   false},
+{tag::DividendPeriodPaymentDateRelativeTo,     -1,   false},
+{tag::DividendPeriodPaymentDateOffsetPeriod,   -1,   false},
+{tag::DividendPeriodPaymentDateOffsetUnit,     -1,   false},
+{tag::DividendPeriodPaymentDateOffsetDayType,  -1,   false},
+{tag::DividendPeriodPaymentDateAdjusted,       -1,   false},
+{tag::DividendPeriodXID,                       -1,   false},
+{tag::DividendPeriodBusinessCenter,            -1,   false},
+{tag::ExtraordinaryEventType,                  -1,   false},
+{tag::ExtraordinaryEventValue,                 -1,   false},
+{tag::LegCashSettlDateUnadjusted,              -1,   false},
+{tag::LegCashSettlDateBusinessDayConvention,   -1,   false},
+{tag::NoLegCashSettlDateBusinessCenters,       608,  false}, // LegCashSettlDateBusinessCenterGrp
+{tag::LegCashSettlDateRelativeTo,              -1,   false},
+{tag::LegCashSettlDateOffsetPeriod,            -1,   false},
+{tag::LegCashSettlDateOffsetUnit,              -1,   false},
+{tag::LegCashSettlDateOffsetDayType,           -1,   false},
+{tag::LegCashSettlDateAdjusted,                -1,   false},
+{tag::LegCashSettlDateBusinessCenter,          -1,   false},
+{tag::LegDividendAccrualPaymentDateBusinessCenter, -1,   false},
+{tag::LegDividendFloatingRateIndex,            -1,   false},
+{tag::LegDividendFloatingRateIndexCurvePeriod, -1,   false},
+{tag::LegDividendFloatingRateIndexCurveUnit,   -1,   false},
+{tag::LegDividendFloatingRateMultiplier,       -1,   false},
+{tag::LegDividendFloatingRateSpread,           -1,   false},
+{tag::LegDividendFloatingRateSpreadPositionType, -1,   false},
+{tag::LegDividendFloatingRateTreatment,        -1,   false},
+{tag::LegDividendCapRate,                      -1,   false},
+{tag::LegDividendCapRateBuySide,               -1,   false},
+{tag::LegDividendCapRateSellSide,              -1,   false},
+{tag::LegDividendFloorRate,                    -1,   false},
+{tag::LegDividendFloorRateBuySide,             -1,   false},
+{tag::LegDividendFloorRateSellSide,            -1,   false},
+{tag::LegDividendInitialRate,                  -1,   false},
+{tag::LegDividendFinalRateRoundingDirection,   -1,   false},
+{tag::LegDividendFinalRatePrecision,           -1,   false},
+{tag::LegDividendAveragingMethod,              -1,   false},
+{tag::LegDividendNegativeRateTreatment,        -1,   false},
+{tag::LegDividendAccrualPaymentDateRelativeTo, -1,   false},
+{tag::LegDividendAccrualPaymentDateOffsetPeriod, -1,   false},
+{tag::LegDividendAccrualPaymentDateOffsetUnit, -1,   false},
+{tag::LegDividendAccrualPaymentDateOffsetDayType, -1,   false},
+{tag::LegDividendAccrualPaymentDateUnadjusted, -1,   false},
+{tag::LegDividendAccrualPaymentDateBusinessDayConvention, -1,   false},
+{tag::NoLegDividendAccrualPaymentDateBusinessCenters, 609,  false}, // LegDividendAccrualPaymentDateBusinessCenterGrp
+{tag::LegDividendAccrualPaymentDateAdjusted,   -1,   false},
+{tag::LegDividendReinvestmentIndicator,        -1,   false},
+{tag::LegDividendEntitlementEvent,             -1,   false},
+{tag::LegDividendAmountType,                   -1,   false},
+{tag::LegDividendUnderlierRefID,               -1,   false},
+{tag::NoLegDividendPeriods,                    615,  false}, // LegDividendPeriodGrp
+{tag::LegExtraordinaryDividendPartySide,       -1,   false},
+{tag::LegExtraordinaryDividendAmountType,      -1,   false},
+{tag::LegExtraordinaryDividendCurrency,        -1,   false},
+{tag::LegExtraordinaryDividendDeterminationMethod, -1,   false},
+{0,                                            613,  false}, // LegDividendFXTriggerDate
+{0,                                            610,  false}, // LegDividendAccrualFloatingRate
+{tag::LegDividendAccrualFixedRate,             -1,   false},
+{0,                                            611,  false}, // LegDividendAccrualPaymentDate
+{tag::LegDividendCompoundingMethod,            -1,   false},
+{tag::LegDividendNumOfIndexUnits,              -1,   false},
+{tag::LegDividendCashPercentage,               -1,   false},
+{tag::LegDividendCashEquivalentPercentage,     -1,   false},
+{tag::LegNonCashDividendTreatment,             -1,   false},
+{tag::LegDividendComposition,                  -1,   false},
+{tag::LegSpecialDividendsIndicator,            -1,   false},
+{tag::LegMaterialDividendsIndicator,           -1,   false},
+{tag::LegOptionsExchangeDividendsIndicator,    -1,   false},
+{tag::LegAdditionalDividendsIndicator,         -1,   false},
+{tag::LegAllDividendsIndicator,                -1,   false},
+{tag::LegDividendFXTriggerDateRelativeTo,      -1,   false},
+{tag::LegDividendFXTriggerDateOffsetPeriod,    -1,   false},
+{tag::LegDividendFXTriggerDateOffsetUnit,      -1,   false},
+{tag::LegDividendFXTriggerDateOffsetDayType,   -1,   false},
+{tag::LegDividendFXTriggerDateUnadjusted,      -1,   false},
+{tag::LegDividendFXTriggerDateBusinessDayConvention, -1,   false},
+{tag::NoLegDividendFXTriggerDateBusinessCenters, 614,  false}, // LegDividendFXTriggerDateBusinessCenterGrp
+{tag::LegDividendFXTriggerDateAdjusted,        -1,   false},
+{tag::LegDividendFXTriggerDateBusinessCenter,  -1,   false},
+{tag::LegDividendPeriodSequence,               -1,   false},
+{tag::LegDividendPeriodStartDateUnadjusted,    -1,   false},
+{tag::LegDividendPeriodEndDateUnadjusted,      -1,   false},
+{tag::LegDividendPeriodUnderlierRefID,         -1,   false},
+{tag::LegDividendPeriodStrikePrice,            -1,   false},
+{tag::LegDividendPeriodBusinessDayConvention,  -1,   false},
+{tag::NoLegDividendPeriodBusinessCenters,      616,  false}, // LegDividendPeriodBusinessCenterGrp
+{tag::LegDividendPeriodValuationDateUnadjusted, -1,   false},
+{tag::LegDividendPeriodValuationDateRelativeTo, -1,   false},
+{tag::LegDividendPeriodValuationDateOffsetPeriod, -1,   false},
+{tag::LegDividendPeriodValuationDateOffsetUnit, -1,   false},
+{tag::LegDividendPeriodValuationDateOffsetDayType, -1,   false},
+{tag::LegDividendPeriodValuationDateAdjusted,  -1,   false},
+{tag::LegDividendPeriodPaymentDateUnadjusted,  -1,   false},
+{tag::LegDividendPeriodPaymentDateRelativeTo,  -1,   false},
+{tag::LegDividendPeriodPaymentDateOffsetPeriod, -1,   false},
+{tag::LegDividendPeriodPaymentDateOffsetUnit,  -1,   false},
+{tag::LegDividendPeriodPaymentDateOffsetDayType, -1,   false},
+{tag::LegDividendPeriodPaymentDateAdjusted,    -1,   false},
+{tag::LegDividendPeriodXID,                    -1,   false},
+{tag::LegDividendPeriodBusinessCenter,         -1,   false},
+{tag::LegExtraordinaryEventType,               -1,   false},
+{tag::LegExtraordinaryEventValue,              -1,   false},
+{tag::LegMakeWholeDate,                        -1,   false},
+{tag::LegMakeWholeAmount,                      -1,   false},
+{tag::LegMakeWholeBenchmarkCurveName,          -1,   false},
+{tag::LegMakeWholeBenchmarkCurvePoint,         -1,   false},
+{tag::LegMakeWholeRecallSpread,                -1,   false},
+{tag::LegMakeWholeBenchmarkQuote,              -1,   false},
+{tag::LegMakeWholeInterpolationMethod,         -1,   false},
+{tag::LegPaymentStreamCompoundingDate,         -1,   false},
+{tag::LegPaymentStreamCompoundingDateType,     -1,   false},
+{tag::LegPaymentStreamCompoundingDatesBusinessDayConvention, -1,   false},
+{tag::NoLegPaymentStreamCompoundingDatesBusinessCenters, 621,  false}, // LegPaymentStreamCompoundingDatesBusinessCenterGrp
+{tag::NoLegPaymentStreamCompoundingDates,      619,  false}, // LegPaymentStreamCompoundingDateGrp
+{tag::LegPaymentStreamCompoundingDatesRelativeTo, -1,   false},
+{tag::LegPaymentStreamCompoundingDatesOffsetPeriod, -1,   false},
+{tag::LegPaymentStreamCompoundingDatesOffsetUnit, -1,   false},
+{tag::LegPaymentStreamCompoundingDatesOffsetDayType, -1,   false},
+{tag::LegPaymentStreamCompoundingPeriodSkip,   -1,   false},
+{0,                                            624,  false}, // LegPaymentStreamCompoundingStartDate
+{0,                                            622,  false}, // LegPaymentStreamCompoundingEndDate
+{tag::LegPaymentStreamCompoundingFrequencyPeriod, -1,   false},
+{tag::LegPaymentStreamCompoundingFrequencyUnit, -1,   false},
+{tag::LegPaymentStreamCompoundingRollConvention, -1,   false},
+{tag::LegPaymentStreamBoundsFirstDateUnadjusted, -1,   false},
+{tag::LegPaymentStreamBoundsLastDateUnadjusted, -1,   false},
+{tag::LegPaymentStreamCompoundingDatesBusinessCenter, -1,   false},
+{tag::LegPaymentStreamCompoundingEndDateUnadjusted, -1,   false},
+{tag::LegPaymentStreamCompoundingEndDateRelativeTo, -1,   false},
+{tag::LegPaymentStreamCompoundingEndDateOffsetPeriod, -1,   false},
+{tag::LegPaymentStreamCompoundingEndDateOffsetUnit, -1,   false},
+{tag::LegPaymentStreamCompoundingEndDateOffsetDayType, -1,   false},
+{tag::LegPaymentStreamCompoundingEndDateAdjusted, -1,   false},
+{tag::LegPaymentStreamCompoundingRateIndex,    -1,   false},
+{tag::LegPaymentStreamCompoundingRateIndexCurvePeriod, -1,   false},
+{tag::LegPaymentStreamCompoundingRateIndexCurveUnit, -1,   false},
+{tag::LegPaymentStreamCompoundingRateMultiplier, -1,   false},
+{tag::LegPaymentStreamCompoundingRateSpread,   -1,   false},
+{tag::LegPaymentStreamCompoundingRateSpreadPositionType, -1,   false},
+{tag::LegPaymentStreamCompoundingRateTreatment, -1,   false},
+{tag::LegPaymentStreamCompoundingCapRate,      -1,   false},
+{tag::LegPaymentStreamCompoundingCapRateBuySide, -1,   false},
+{tag::LegPaymentStreamCompoundingCapRateSellSide, -1,   false},
+{tag::LegPaymentStreamCompoundingFloorRate,    -1,   false},
+{tag::LegPaymentStreamCompoundingFloorRateBuySide, -1,   false},
+{tag::LegPaymentStreamCompoundingFloorRateSellSide, -1,   false},
+{tag::LegPaymentStreamCompoundingInitialRate,  -1,   false},
+{tag::LegPaymentStreamCompoundingFinalRateRoundingDirection, -1,   false},
+{tag::LegPaymentStreamCompoundingFinalRatePrecision, -1,   false},
+{tag::LegPaymentStreamCompoundingAveragingMethod, -1,   false},
+{tag::LegPaymentStreamCompoundingNegativeRateTreatment, -1,   false},
+{tag::LegPaymentStreamCompoundingStartDateUnadjusted, -1,   false},
+{tag::LegPaymentStreamCompoundingStartDateRelativeTo, -1,   false},
+{tag::LegPaymentStreamCompoundingStartDateOffsetPeriod, -1,   false},
+{tag::LegPaymentStreamCompoundingStartDateOffsetUnit, -1,   false},
+{tag::LegPaymentStreamCompoundingStartDateOffsetDayType, -1,   false},
+{tag::LegPaymentStreamCompoundingStartDateAdjusted, -1,   false},
+{tag::LegPaymentStreamFormulaImageLength,      -1,   false},
+{tag::LegPaymentStreamFormulaImage,            -1,   false},
+{tag::LegPaymentStreamFinalPricePaymentDateUnadjusted, -1,   false},
+{tag::LegPaymentStreamFinalPricePaymentDateRelativeTo, -1,   false},
+{tag::LegPaymentStreamFinalPricePaymentDateOffsetPeriod, -1,   false},
+{tag::LegPaymentStreamFinalPricePaymentDateOffsetUnit, -1,   false},
+{tag::LegPaymentStreamFinalPricePaymentDateOffsetDayType, -1,   false},
+{tag::LegPaymentStreamFinalPricePaymentDateAdjusted, -1,   false},
+{tag::LegPaymentStreamFixingDate,              -1,   false},
+{tag::LegPaymentStreamFixingDateType,          -1,   false},
+{tag::LegPaymentStreamFormulaCurrency,         -1,   false},
+{tag::LegPaymentStreamFormulaCurrencyDeterminationMethod, -1,   false},
+{tag::LegPaymentStreamFormulaReferenceAmount,  -1,   false},
+{0,                                            629,  false}, // LegPaymentStreamFormulaMathGrp
+{0,                                            625,  false}, // LegPaymentStreamFormulaImage
+{tag::NoLegPaymentStreamFormulas,              -1,   false},
+{tag::LegPaymentStreamFormula,                 -1,   false},
+{tag::LegPaymentStreamFormulaDesc,             -1,   false},
+{tag::LegPaymentStubEndDateUnadjusted,         -1,   false},
+{tag::LegPaymentStubEndDateBusinessDayConvention, -1,   false},
+{tag::NoLegPaymentStubEndDateBusinessCenters,  631,  false}, // LegPaymentStubEndDateBusinessCenterGrp
+{tag::LegPaymentStubEndDateRelativeTo,         -1,   false},
+{tag::LegPaymentStubEndDateOffsetPeriod,       -1,   false},
+{tag::LegPaymentStubEndDateOffsetUnit,         -1,   false},
+{tag::LegPaymentStubEndDateOffsetDayType,      -1,   false},
+{tag::LegPaymentStubEndDateAdjusted,           -1,   false},
+{tag::LegPaymentStubEndDateBusinessCenter,     -1,   false},
+{tag::LegPaymentStubStartDateUnadjusted,       -1,   false},
+{tag::LegPaymentStubStartDateBusinessDayConvention, -1,   false},
+{tag::NoLegPaymentStubStartDateBusinessCenters, 633,  false}, // LegPaymentStubStartDateBusinessCenterGrp
+{tag::LegPaymentStubStartDateRelativeTo,       -1,   false},
+{tag::LegPaymentStubStartDateOffsetPeriod,     -1,   false},
+{tag::LegPaymentStubStartDateOffsetUnit,       -1,   false},
+{tag::LegPaymentStubStartDateOffsetDayType,    -1,   false},
+{tag::LegPaymentStubStartDateAdjusted,         -1,   false},
+{tag::LegPaymentStubStartDateBusinessCenter,   -1,   false},
+{tag::LegReturnRateDateMode,                   -1,   false},
+{tag::NoLegReturnRateValuationDates,           640,  false}, // LegReturnRateValuationDateGrp
+{tag::LegReturnRateValuationDateRelativeTo,    -1,   false},
+{tag::LegReturnRateValuationDateOffsetPeriod,  -1,   false},
+{tag::LegReturnRateValuationDateOffsetUnit,    -1,   false},
+{tag::LegReturnRateValuationDateOffsetDayType, -1,   false},
+{tag::LegReturnRateValuationStartDateUnadjusted, -1,   false},
+{tag::LegReturnRateValuationStartDateRelativeTo, -1,   false},
+{tag::LegReturnRateValuationStartDateOffsetPeriod, -1,   false},
+{tag::LegReturnRateValuationStartDateOffsetUnit, -1,   false},
+{tag::LegReturnRateValuationStartDateOffsetDayType, -1,   false},
+{tag::LegReturnRateValuationStartDateAdjusted, -1,   false},
+{tag::LegReturnRateValuationEndDateUnadjusted, -1,   false},
+{tag::LegReturnRateValuationEndDateRelativeTo, -1,   false},
+{tag::LegReturnRateValuationEndDateOffsetPeriod, -1,   false},
+{tag::LegReturnRateValuationEndDateOffsetUnit, -1,   false},
+{tag::LegReturnRateValuationEndDateOffsetDayType, -1,   false},
+{tag::LegReturnRateValuationEndDateAdjusted,   -1,   false},
+{tag::LegReturnRateValuationFrequencyPeriod,   -1,   false},
+{tag::LegReturnRateValuationFrequencyUnit,     -1,   false},
+{tag::LegReturnRateValuationFrequencyRollConvention, -1,   false},
+{tag::LegReturnRateValuationDateBusinessDayConvention, -1,   false},
+{tag::NoLegReturnRateValuationDateBusinessCenters, 639,  false}, // LegReturnRateValuationDateBusinessCenterGrp
+{tag::LegReturnRateFXCurrencySymbol,           -1,   false},
+{tag::LegReturnRateFXRate,                     -1,   false},
+{tag::LegReturnRateFXRateCalc,                 -1,   false},
+{tag::LegReturnRatePriceSequence,              -1,   false},
+{tag::LegReturnRateCommissionBasis,            -1,   false},
+{tag::LegReturnRateCommissionAmount,           -1,   false},
+{tag::LegReturnRateCommissionCurrency,         -1,   false},
+{tag::LegReturnRateTotalCommissionPerTrade,    -1,   false},
+{tag::LegReturnRateDeterminationMethod,        -1,   false},
+{tag::NoLegReturnRatePrices,                   638,  false}, // LegReturnRatePriceGrp
+{tag::NoLegReturnRateFXConversions,            635,  false}, // LegReturnRateFXConversionGrp
+{tag::LegReturnRateAmountRelativeTo,           -1,   false},
+{tag::LegReturnRateQuoteMeasureType,           -1,   false},
+{tag::LegReturnRateQuoteUnits,                 -1,   false},
+{tag::LegReturnRateQuoteMethod,                -1,   false},
+{tag::LegReturnRateQuoteCurrency,              -1,   false},
+{tag::LegReturnRateQuoteCurrencyType,          -1,   false},
+{tag::LegReturnRateQuoteTimeType,              -1,   false},
+{tag::LegReturnRateQuoteTime,                  -1,   false},
+{tag::LegReturnRateQuoteDate,                  -1,   false},
+{tag::LegReturnRateQuoteExpirationTime,        -1,   false},
+{tag::LegReturnRateQuoteBusinessCenter,        -1,   false},
+{tag::LegReturnRateQuoteExchange,              -1,   false},
+{tag::NoLegReturnRateInformationSources,       637,  false}, // LegReturnRateInformationSourceGrp
+{tag::LegReturnRateQuotePricingModel,          -1,   false},
+{tag::LegReturnRateCashFlowType,               -1,   false},
+{tag::NoLegReturnRateDates,                    634,  false}, // LegReturnRateDateGrp
+{tag::LegReturnRateValuationTimeType,          -1,   false},
+{tag::LegReturnRateValuationTime,              -1,   false},
+{tag::LegReturnRateValuationTimeBusinessCenter, -1,   false},
+{tag::LegReturnRateValuationPriceOption,       -1,   false},
+{tag::LegReturnRateFinalPriceFallback,         -1,   false},
+{tag::LegReturnRateInformationSource,          -1,   false},
+{tag::LegReturnRateReferencePage,              -1,   false},
+{tag::LegReturnRateReferencePageHeading,       -1,   false},
+{tag::LegReturnRatePriceBasis,                 -1,   false},
+{tag::LegReturnRatePrice,                      -1,   false},
+{tag::LegReturnRatePriceCurrency,              -1,   false},
+{tag::LegReturnRatePriceType,                  -1,   false},
+{tag::LegReturnRateValuationDateBusinessCenter, -1,   false},
+{tag::LegReturnRateValuationDate,              -1,   false},
+{tag::LegReturnRateValuationDateType,          -1,   false},
+{tag::LegSettlMethodElectionDateUnadjusted,    -1,   false},
+{tag::LegSettlMethodElectionDateBusinessDayConvention, -1,   false},
+{tag::NoLegSettlMethodElectionDateBusinessCenters, 642,  false}, // LegSettlMethodElectionDateBusinessCenterGrp
+{tag::LegSettlMethodElectionDateRelativeTo,    -1,   false},
+{tag::LegSettlMethodElectionDateOffsetPeriod,  -1,   false},
+{tag::LegSettlMethodElectionDateOffsetUnit,    -1,   false},
+{tag::LegSettlMethodElectionDateOffsetDayType, -1,   false},
+{tag::LegSettlMethodElectionDateAdjusted,      -1,   false},
+{tag::LegSettlMethodElectionDateBusinessCenter, -1,   false},
+{tag::MakeWholeDate,                           -1,   false},
+{tag::MakeWholeAmount,                         -1,   false},
+{tag::MakeWholeBenchmarkCurveName,             -1,   false},
+{tag::MakeWholeBenchmarkCurvePoint,            -1,   false},
+{tag::MakeWholeRecallSpread,                   -1,   false},
+{tag::MakeWholeBenchmarkQuote,                 -1,   false},
+{tag::MakeWholeInterpolationMethod,            -1,   false},
+{tag::NoPaymentStreamCompoundingDates,         -1,   false},
+{tag::PaymentStreamCompoundingDate,            -1,   false},
+{tag::PaymentStreamCompoundingDateType,        -1,   false},
+{tag::PaymentStreamCompoundingDatesBusinessDayConvention, -1,   false},
+{tag::NoPaymentStreamCompoundingDatesBusinessCenters, 646,  false}, // PaymentStreamCompoundingDatesBusinessCenterGrp
+{0,                                            644,  false}, // PaymentStreamCompoundingDateGrp
+{tag::PaymentStreamCompoundingDatesRelativeTo, -1,   false},
+{tag::PaymentStreamCompoundingDatesOffsetPeriod, -1,   false},
+{tag::PaymentStreamCompoundingDatesOffsetUnit, -1,   false},
+{tag::PaymentStreamCompoundingDatesOffsetDayType, -1,   false},
+{tag::PaymentStreamCompoundingPeriodSkip,      -1,   false},
+{0,                                            649,  false}, // PaymentStreamCompoundingStartDate
+{0,                                            647,  false}, // PaymentStreamCompoundingEndDate
+{tag::PaymentStreamCompoundingFrequencyPeriod, -1,   false},
+{tag::PaymentStreamCompoundingFrequencyUnit,   -1,   false},
+{tag::PaymentStreamCompoundingRollConvention,  -1,   false},
+{tag::PaymentStreamBoundsFirstDateUnadjusted,  -1,   false},
+{tag::PaymentStreamBoundsLastDateUnadjusted,   -1,   false},
+{tag::PaymentStreamCompoundingDatesBusinessCenter, -1,   false},
+{tag::PaymentStreamCompoundingEndDateUnadjusted, -1,   false},
+{tag::PaymentStreamCompoundingEndDateRelativeTo, -1,   false},
+{tag::PaymentStreamCompoundingEndDateOffsetPeriod, -1,   false},
+{tag::PaymentStreamCompoundingEndDateOffsetUnit, -1,   false},
+{tag::PaymentStreamCompoundingEndDateOffsetDayType, -1,   false},
+{tag::PaymentStreamCompoundingEndDateAdjusted, -1,   false},
+{tag::PaymentStreamCompoundingRateIndex,       -1,   false},
+{tag::PaymentStreamCompoundingRateIndexCurvePeriod, -1,   false},
+{tag::PaymentStreamCompoundingRateIndexCurveUnit, -1,   false},
+{tag::PaymentStreamCompoundingRateMultiplier,  -1,   false},
+{tag::PaymentStreamCompoundingRateSpread,      -1,   false},
+{tag::PaymentStreamCompoundingRateSpreadPositionType, -1,   false},
+{tag::PaymentStreamCompoundingRateTreatment,   -1,   false},
+{tag::PaymentStreamCompoundingCapRate,         -1,   false},
+{tag::PaymentStreamCompoundingCapRateBuySide,  -1,   false},
+{tag::PaymentStreamCompoundingCapRateSellSide, -1,   false},
+{tag::PaymentStreamCompoundingFloorRate,       -1,   false},
+{tag::PaymentStreamCompoundingFloorRateBuySide, -1,   false},
+{tag::PaymentStreamCompoundingFloorRateSellSide, -1,   false},
+{tag::PaymentStreamCompoundingInitialRate,     -1,   false},
+{tag::PaymentStreamCompoundingFinalRateRoundingDirection, -1,   false},
+{tag::PaymentStreamCompoundingFinalRatePrecision, -1,   false},
+{tag::PaymentStreamCompoundingAveragingMethod, -1,   false},
+{tag::PaymentStreamCompoundingNegativeRateTreatment, -1,   false},
+{tag::PaymentStreamCompoundingStartDateUnadjusted, -1,   false},
+{tag::PaymentStreamCompoundingStartDateRelativeTo, -1,   false},
+{tag::PaymentStreamCompoundingStartDateOffsetPeriod, -1,   false},
+{tag::PaymentStreamCompoundingStartDateOffsetUnit, -1,   false},
+{tag::PaymentStreamCompoundingStartDateOffsetDayType, -1,   false},
+{tag::PaymentStreamCompoundingStartDateAdjusted, -1,   false},
+{tag::PaymentStreamFormulaImageLength,         -1,   false},
+{tag::PaymentStreamFormulaImage,               -1,   false},
+{tag::PaymentStreamFinalPricePaymentDateUnadjusted, -1,   false},
+{tag::PaymentStreamFinalPricePaymentDateRelativeTo, -1,   false},
+{tag::PaymentStreamFinalPricePaymentDateOffsetfPeriod, -1,   false},
+{tag::PaymentStreamFinalPricePaymentDateOffsetUnit, -1,   false},
+{tag::PaymentStreamFinalPricePaymentDateOffsetDayType, -1,   false},
+{tag::PaymentStreamFinalPricePaymentDateAdjusted, -1,   false},
+{tag::NoPaymentStreamFixingDates,              -1,   false},
+{tag::PaymentStreamFixingDate,                 -1,   false},
+{tag::PaymentStreamFixingDateType,             -1,   false},
+{tag::NoPaymentStreamFormulas,                 -1,   false},
+{tag::PaymentStreamFormula,                    -1,   false},
+{tag::PaymentStreamFormulaDesc,                -1,   false},
+{tag::PaymentStreamFormulaCurrency,            -1,   false},
+{tag::PaymentStreamFormulaCurrencyDeterminationMethod, -1,   false},
+{tag::PaymentStreamFormulaReferenceAmount,     -1,   false},
+{0,                                            653,  false}, // PaymentStreamFormulaMathGrp
+{0,                                            650,  false}, // PaymentStreamFormulaImage
+{tag::PaymentStubEndDateUnadjusted,            -1,   false},
+{tag::PaymentStubEndDateBusinessDayConvention, -1,   false},
+{tag::NoPaymentStubEndDateBusinessCenters,     656,  false}, // PaymentStubEndDateBusinessCenterGrp
+{tag::PaymentStubEndDateRelativeTo,            -1,   false},
+{tag::PaymentStubEndDateOffsetPeriod,          -1,   false},
+{tag::PaymentStubEndDateOffsetUnit,            -1,   false},
+{tag::PaymentStubEndDateOffsetDayType,         -1,   false},
+{tag::PaymentStubEndDateAdjusted,              -1,   false},
+{tag::PaymentStubEndDateBusinessCenter,        -1,   false},
+{tag::PaymentStubStartDateUnadjusted,          -1,   false},
+{tag::PaymentStubStartDateBusinessDayConvention, -1,   false},
+{tag::NoPaymentStubStartDateBusinessCenters,   658,  false}, // PaymentStubStartDateBusinessCenterGrp
+{tag::PaymentStubStartDateRelativeTo,          -1,   false},
+{tag::PaymentStubStartDateOffsetPeriod,        -1,   false},
+{tag::PaymentStubStartDateOffsetUnit,          -1,   false},
+{tag::PaymentStubStartDateOffsetDayType,       -1,   false},
+{tag::PaymentStubStartDateAdjusted,            -1,   false},
+{tag::PaymentStubStartDateBusinessCenter,      -1,   false},
+{tag::ReturnRateDateMode,                      -1,   false},
+{tag::NoReturnRateValuationDates,              665,  false}, // ReturnRateValuationDateGrp
+{tag::ReturnRateValuationDateRelativeTo,       -1,   false},
+{tag::ReturnRateValuationDateOffsetPeriod,     -1,   false},
+{tag::ReturnRateValuationDateOffsetUnit,       -1,   false},
+{tag::ReturnRateValuationDateOffsetDayType,    -1,   false},
+{tag::ReturnRateValuationStartDateUnadjusted,  -1,   false},
+{tag::ReturnRateValuationStartDateRelativeTo,  -1,   false},
+{tag::ReturnRateValuationStartDateOffsetPeriod, -1,   false},
+{tag::ReturnRateValuationStartDateOffsetUnit,  -1,   false},
+{tag::ReturnRateValuationStartDateOffsetDayType, -1,   false},
+{tag::ReturnRateValuationStartDateAdjusted,    -1,   false},
+{tag::ReturnRateValuationEndDateUnadjusted,    -1,   false},
+{tag::ReturnRateValuationEndDateRelativeTo,    -1,   false},
+{tag::ReturnRateValuationEndDateOffsetPeriod,  -1,   false},
+{tag::ReturnRateValuationEndDateOffsetUnit,    -1,   false},
+{tag::ReturnRateValuationEndDateOffsetDayType, -1,   false},
+{tag::ReturnRateValuationEndDateAdjusted,      -1,   false},
+{tag::ReturnRateValuationFrequencyPeriod,      -1,   false},
+{tag::ReturnRateValuationFrequencyUnit,        -1,   false},
+{tag::ReturnRateValuationFrequencyRollConvention, -1,   false},
+{tag::ReturnRateValuationDateBusinessDayConvention, -1,   false},
+{tag::NoReturnRateValuationDateBusinessCenters, 664,  false}, // ReturnRateValuationDateBusinessCenterGrp
+{tag::ReturnRateFXCurrencySymbol,              -1,   false},
+{tag::ReturnRateFXRate,                        -1,   false},
+{tag::ReturnRateFXRateCalc,                    -1,   false},
+{tag::ReturnRatePriceSequence,                 -1,   false},
+{tag::ReturnRateCommissionBasis,               -1,   false},
+{tag::ReturnRateCommissionAmount,              -1,   false},
+{tag::ReturnRateCommissionCurrency,            -1,   false},
+{tag::ReturnRateTotalCommissionPerTrade,       -1,   false},
+{tag::ReturnRateDeterminationMethod,           -1,   false},
+{tag::NoReturnRatePrices,                      663,  false}, // ReturnRatePriceGrp
+{tag::NoReturnRateFXConversions,               660,  false}, // ReturnRateFXConversionGrp
+{tag::ReturnRateAmountRelativeTo,              -1,   false},
+{tag::ReturnRateQuoteMeasureType,              -1,   false},
+{tag::ReturnRateQuoteUnits,                    -1,   false},
+{tag::ReturnRateQuoteMethod,                   -1,   false},
+{tag::ReturnRateQuoteCurrency,                 -1,   false},
+{tag::ReturnRateQuoteCurrencyType,             -1,   false},
+{tag::ReturnRateQuoteTimeType,                 -1,   false},
+{tag::ReturnRateQuoteTime,                     -1,   false},
+{tag::ReturnRateQuoteDate,                     -1,   false},
+{tag::ReturnRateQuoteExpirationTime,           -1,   false},
+{tag::ReturnRateQuoteBusinessCenter,           -1,   false},
+{tag::ReturnRateQuoteExchange,                 -1,   false},
+{tag::NoReturnRateInformationSources,          662,  false}, // ReturnRateInformationSourceGrp
+{tag::ReturnRateQuotePricingModel,             -1,   false},
+{tag::ReturnRateCashFlowType,                  -1,   false},
+{tag::NoReturnRateDates,                       659,  false}, // ReturnRateDateGrp
+{tag::ReturnRateValuationTimeType,             -1,   false},
+{tag::ReturnRateValuationTime,                 -1,   false},
+{tag::ReturnRateValuationTimeBusinessCenter,   -1,   false},
+{tag::ReturnRateValuationPriceOption,          -1,   false},
+{tag::ReturnRateFinalPriceFallback,            -1,   false},
+{tag::ReturnRateInformationSource,             -1,   false},
+{tag::ReturnRateReferencePage,                 -1,   false},
+{tag::ReturnRateReferencePageHeading,          -1,   false},
+{tag::ReturnRatePriceBasis,                    -1,   false},
+{tag::ReturnRatePrice,                         -1,   false},
+{tag::ReturnRatePriceCurrency,                 -1,   false},
+{tag::ReturnRatePriceType,                     -1,   false},
+{tag::ReturnRateValuationDateBusinessCenter,   -1,   false},
+{tag::ReturnRateValuationDate,                 -1,   false},
+{tag::ReturnRateValuationDateType,             -1,   false},
+{tag::SettlMethodElectionDateBusinessCenter,   -1,   false},
+{tag::SettlMethodElectionDateUnadjusted,       -1,   false},
+{tag::SettlMethodElectionDateBusinessDayConvention, -1,   false},
+{tag::NoSettlMethodElectionDateBusinessCenters, 666,  false}, // SettlMethodElectionDateBusinessCenterGrp
+{tag::SettlMethodElectionDateRelativeTo,       -1,   false},
+{tag::SettlMethodElectionDateOffsetPeriod,     -1,   false},
+{tag::SettlMethodElectionDateOffsetUnit,       -1,   false},
+{tag::SettlMethodElectionDateOffsetDayType,    -1,   false},
+{tag::SettlMethodElectionDateAdjusted,         -1,   false},
+{tag::UnderlyingCashSettlDateBusinessCenter,   -1,   false},
+{tag::UnderlyingCashSettlDateUnadjusted,       -1,   false},
+{tag::UnderlyingCashSettlDateBusinessDayConvention, -1,   false},
+{tag::NoUnderlyingCashSettlDateBusinessCenters, 668,  false}, // UnderlyingCashSettlDateBusinessCenterGrp
+{tag::UnderlyingCashSettlDateRelativeTo,       -1,   false},
+{tag::UnderlyingCashSettlDateOffsetPeriod,     -1,   false},
+{tag::UnderlyingCashSettlDateOffsetUnit,       -1,   false},
+{tag::UnderlyingCashSettlDateOffsetDayType,    -1,   false},
+{tag::UnderlyingCashSettlDateAdjusted,         -1,   false},
+{tag::UnderlyingDividendAccrualPaymentDateBusinessCenter, -1,   false},
+{tag::UnderlyingDividendFloatingRateIndex,     -1,   false},
+{tag::UnderlyingDividendFloatingRateIndexCurvePeriod, -1,   false},
+{tag::UnderlyingDividendFloatingRateIndexCurveUnit, -1,   false},
+{tag::UnderlyingDividendFloatingRateMultiplier, -1,   false},
+{tag::UnderlyingDividendFloatingRateSpread,    -1,   false},
+{tag::UnderlyingDividendFloatingRateSpreadPositionType, -1,   false},
+{tag::UnderlyingDividendFloatingRateTreatment, -1,   false},
+{tag::UnderlyingDividendCapRate,               -1,   false},
+{tag::UnderlyingDividendCapRateBuySide,        -1,   false},
+{tag::UnderlyingDividendCapRateSellSide,       -1,   false},
+{tag::UnderlyingDividendFloorRate,             -1,   false},
+{tag::UnderlyingDividendFloorRateBuySide,      -1,   false},
+{tag::UnderlyingDividendFloorRateSellSide,     -1,   false},
+{tag::UnderlyingDividendInitialRate,           -1,   false},
+{tag::UnderlyingDividendFinalRateRoundingDirection, -1,   false},
+{tag::UnderlyingDividendFinalRatePrecision,    -1,   false},
+{tag::UnderlyingDividendAveragingMethod,       -1,   false},
+{tag::UnderlyingDividendNegativeRateTreatment, -1,   false},
+{tag::UnderlyingDividendAccrualPaymentDateRelativeTo, -1,   false},
+{tag::UnderlyingDividendAccrualPaymentDateOffsetPeriod, -1,   false},
+{tag::UnderlyingDividendAccrualPaymentDateOffsetUnit, -1,   false},
+{tag::UnderlyingDividendAccrualPaymentDateOffsetDayType, -1,   false},
+{tag::UnderlyingDividendAccrualPaymentDateUnadjusted, -1,   false},
+{tag::UnderlyingDividendAccrualPaymentDateBusinessDayConvention, -1,   false},
+{tag::NoUnderlyingDividendAccrualPaymentDateBusinessCenters, 670,  false}, // UnderlyingDividendAccrualPaymentDateBusinessCenterGrp
+{tag::UnderlyingDividendAccrualPaymentDateAdjusted, -1,   false},
+{tag::UnderlyingDividendReinvestmentIndicator, -1,   false},
+{tag::UnderlyingDividendEntitlementEvent,      -1,   false},
+{tag::UnderlyingDividendAmountType,            -1,   false},
+{tag::UnderlyingDividendUnderlierRefID,        -1,   false},
+{tag::NoUnderlyingDividendPeriods,             678,  false}, // UnderlyingDividendPeriodGrp
+{tag::UnderlyingExtraordinaryDividendPartySide, -1,   false},
+{tag::UnderlyingExtraordinaryDividendAmountType, -1,   false},
+{tag::UnderlyingExtraordinaryDividendCurrency, -1,   false},
+{tag::UnderlyingExtraordinaryDividendDeterminationMethod, -1,   false},
+{0,                                            674,  false}, // UnderlyingDividendFXTriggerDate
+{0,                                            671,  false}, // UnderlyingDividendAccrualFloatingRate
+{tag::UnderlyingDividendAccrualFixedRate,      -1,   false},
+{0,                                            672,  false}, // UnderlyingDividendAccrualPaymentDate
+{tag::UnderlyingDividendCompoundingMethod,     -1,   false},
+{tag::UnderlyingDividendNumOfIndexUnits,       -1,   false},
+{tag::UnderlyingDividendCashPercentage,        -1,   false},
+{tag::UnderlyingDividendCashEquivalentPercentage, -1,   false},
+{tag::UnderlyingNonCashDividendTreatment,      -1,   false},
+{tag::UnderlyingDividendComposition,           -1,   false},
+{tag::UnderlyingSpecialDividendsIndicator,     -1,   false},
+{tag::UnderlyingMaterialDividendsIndicator,    -1,   false},
+{tag::UnderlyingOptionsExchangeDividendsIndicator, -1,   false},
+{tag::UnderlyingAdditionalDividendsIndicator,  -1,   false},
+{tag::UnderlyingAllDividendsIndicator,         -1,   false},
+{tag::UnderlyingDividendFXTriggerDateRelativeTo, -1,   false},
+{tag::UnderlyingDividendFXTriggerDateOffsetPeriod, -1,   false},
+{tag::UnderlyingDividendFXTriggerDateOffsetUnit, -1,   false},
+{tag::UnderlyingDividendFXTriggerDateOffsetDayType, -1,   false},
+{tag::UnderlyingDividendFXTriggerDateUnadjusted, -1,   false},
+{tag::UnderlyingDividendFXTriggerDateBusinessDayConvention, -1,   false},
+{tag::NoUnderlyingDividendFXTriggerDateBusinessCenters, 675,  false}, // UnderlyingDividendFXTriggerDateBusinessCenterGrp
+{tag::UnderlyingDividendFXTriggerDateAdjusted, -1,   false},
+{tag::UnderlyingDividendFXTriggerDateBusinessCenter, -1,   false},
+{tag::UnderlyingDividendPaymentDate,           -1,   false},
+{tag::UnderlyingDividendPaymentAmount,         -1,   false},
+{tag::UnderlyingDividendPaymentCurrency,       -1,   false},
+{tag::UnderlyingDividendAccruedInterest,       -1,   false},
+{tag::UnderlyingDividendPayoutRatio,           -1,   false},
+{tag::UnderlyingDividendPayoutConditions,      -1,   false},
+{tag::NoUnderlyingDividendPayments,            676,  false}, // UnderlyingDividendPaymentGrp
+{tag::UnderlyingDividendPeriodSequence,        -1,   false},
+{tag::UnderlyingDividendPeriodStartDateUnadjusted, -1,   false},
+{tag::UnderlyingDividendPeriodEndDateUnadjusted, -1,   false},
+{tag::UnderlyingDividendPeriodUnderlierRefID,  -1,   false},
+{tag::UnderlyingDividendPeriodStrikePrice,     -1,   false},
+{tag::UnderlyingDividendPeriodBusinessDayConvention, -1,   false},
+{tag::NoUnderlyingDividendPeriodBusinessCenters, 679,  false}, // UnderlyingDividendPeriodBusinessCenterGrp
+{tag::UnderlyingDividendPeriodValuationDateUnadjusted, -1,   false},
+{tag::UnderlyingDividendPeriodValuationDateRelativeTo, -1,   false},
+{tag::UnderlyingDividendPeriodValuationDateOffsetPeriod, -1,   false},
+{tag::UnderlyingDividendPeriodValuationDateOffsetUnit, -1,   false},
+{tag::UnderlyingDividendPeriodValuationDateOffsetDayType, -1,   false},
+{tag::UnderlyingDividendPeriodValuationDateAdjusted, -1,   false},
+{tag::UnderlyingDividendPeriodPaymentDateUnadjusted, -1,   false},
+{tag::UnderlyingDividendPeriodPaymentDateRelativeTo, -1,   false},
+{tag::UnderlyingDividendPeriodPaymentDateOffsetPeriod, -1,   false},
+{tag::UnderlyingDividendPeriodPaymentDateOffsetUnit, -1,   false},
+{tag::UnderlyingDividendPeriodPaymentDateOffsetDayType, -1,   false},
+{tag::UnderlyingDividendPeriodPaymentDateAdjusted, -1,   false},
+{tag::UnderlyingDividendPeriodXID,             -1,   false},
+{tag::UnderlyingDividendPeriodBusinessCenter,  -1,   false},
+{tag::UnderlyingExtraordinaryEventType,        -1,   false},
+{tag::UnderlyingExtraordinaryEventValue,       -1,   false},
+{tag::UnderlyingMakeWholeDate,                 -1,   false},
+{tag::UnderlyingMakeWholeAmount,               -1,   false},
+{tag::UnderlyingMakeWholeBenchmarkCurveName,   -1,   false},
+{tag::UnderlyingMakeWholeBenchmarkCurvePoint,  -1,   false},
+{tag::UnderlyingMakeWholeRecallSpread,         -1,   false},
+{tag::UnderlyingMakeWholeBenchmarkQuote,       -1,   false},
+{tag::UnderlyingMakeWholeInterpolationMethod,  -1,   false},
+{tag::NoUnderlyingPaymentStreamCompoundingDates, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingDate,  -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingDateType, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingDatesBusinessDayConvention, -1,   false},
+{tag::NoUnderlyingPaymentStreamCompoundingDatesBusinessCenters, 684,  false}, // UnderlyingPaymentStreamCompoundingDatesBusinessCenterGrp
+{0,                                            682,  false}, // UnderlyingPaymentStreamCompoundingDateGrp
+{tag::UnderlyingPaymentStreamCompoundingDatesRelativeTo, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingDatesOffsetPeriod, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingDatesOffsetUnit, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingDatesOffsetDayType, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingPeriodSkip, -1,   false},
+{0,                                            687,  false}, // UnderlyingPaymentStreamCompoundingStartDate
+{0,                                            685,  false}, // UnderlyingPaymentStreamCompoundingEndDate
+{tag::UnderlyingPaymentStreamCompoundingFrequencyPeriod, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingFrequencyUnit, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingRollConvention, -1,   false},
+{tag::UnderlyingPaymentStreamBoundsFirstDateUnadjusted, -1,   false},
+{tag::UnderlyingPaymentStreamBoundsLastDateUnadjusted, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingDatesBusinessCenter, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingEndDateUnadjusted, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingEndDateRelativeTo, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingEndDateOffsetPeriod, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingEndDateOffsetUnit, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingEndDateOffsetDayType, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingEndDateAdjusted, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingRateIndex, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingRateIndexCurvePeriod, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingRateIndexCurveUnit, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingRateMultiplier, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingRateSpread, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingRateSpreadPositionType, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingRateTreatment, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingCapRate, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingCapRateBuySide, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingCapRateSellSide, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingFloorRate, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingFloorRateBuySide, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingFloorRateSellSide, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingInitialRate, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingFinalRateRoundingDirection, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingFinalRatePrecision, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingAveragingMethod, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingNegativeRateTreatment, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingStartDateUnadjusted, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingStartDateRelativeTo, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingStartDateOffsetPeriod, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingStartDateOffsetUnit, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingStartDateOffsetDayType, -1,   false},
+{tag::UnderlyingPaymentStreamCompoundingStartDateAdjusted, -1,   false},
+{tag::UnderlyingPaymentStreamFormulaImageLength, -1,   false},
+{tag::UnderlyingPaymentStreamFormulaImage,     -1,   false},
+{tag::UnderlyingPaymentStreamFinalPricePaymentDateUnadjusted, -1,   false},
+{tag::UnderlyingPaymentStreamFinalPricePaymentDateRelativeTo, -1,   false},
+{tag::UnderlyingPaymentStreamFinalPricePaymentDateOffsetPeriod, -1,   false},
+{tag::UnderlyingPaymentStreamFinalPricePaymentDateOffsetUnit, -1,   false},
+{tag::UnderlyingPaymentStreamFinalPricePaymentDateOffsetDayType, -1,   false},
+{tag::UnderlyingPaymentStreamFinalPricePaymentDateAdjusted, -1,   false},
+{tag::NoUnderlyingPaymentStreamFixingDates,    -1,   false},
+{tag::UnderlyingPaymentStreamFixingDate,       -1,   false},
+{tag::UnderlyingPaymentStreamFixingDateType,   -1,   false},
+{tag::UnderlyingPaymentStreamFormulaCurrency,  -1,   false},
+{tag::UnderlyingPaymentStreamFormulaCurrencyDeterminationMethod, -1,   false},
+{tag::UnderlyingPaymentStreamFormulaReferenceAmount, -1,   false},
+{0,                                            692,  false}, // UnderlyingPaymentStreamFormulaMathGrp
+{0,                                            688,  false}, // UnderlyingPaymentStreamFormulaImage
+{tag::NoUnderlyingPaymentStreamFormulas,       -1,   false},
+{tag::UnderlyingPaymentStreamFormula,          -1,   false},
+{tag::UnderlyingPaymentStreamFormulaDesc,      -1,   false},
+{tag::UnderlyingPaymentStubEndDateUnadjusted,  -1,   false},
+{tag::UnderlyingPaymentStubEndDateBusinessDayConvention, -1,   false},
+{tag::NoUnderlyingPaymentStubEndDateBusinessCenters, 694,  false}, // UnderlyingPaymentStubEndDateBusinessCenterGrp
+{tag::UnderlyingPaymentStubEndDateRelativeTo,  -1,   false},
+{tag::UnderlyingPaymentStubEndDateOffsetPeriod, -1,   false},
+{tag::UnderlyingPaymentStubEndDateOffsetUnit,  -1,   false},
+{tag::UnderlyingPaymentStubEndDateOffsetDayType, -1,   false},
+{tag::UnderlyingPaymentStubEndDateAdjusted,    -1,   false},
+{tag::UnderlyingPaymentStubEndDateBusinessCenter, -1,   false},
+{tag::UnderlyingPaymentStubStartDateUnadjusted, -1,   false},
+{tag::UnderlyingPaymentStubStartDateBusinessDayConvention, -1,   false},
+{tag::NoUnderlyingPaymentStubStartDateBusinessCenters, 696,  false}, // UnderlyingPaymentStubStartDateBusinessCenterGrp
+{tag::UnderlyingPaymentStubStartDateRelativeTo, -1,   false},
+{tag::UnderlyingPaymentStubStartDateOffsetPeriod, -1,   false},
+{tag::UnderlyingPaymentStubStartDateOffsetUnit, -1,   false},
+{tag::UnderlyingPaymentStubStartDateOffsetDayType, -1,   false},
+{tag::UnderlyingPaymentStubStartDateAdjusted,  -1,   false},
+{tag::UnderlyingPaymentStubStartDateBusinessCenter, -1,   false},
+{tag::UnderlyingRateSpreadInitialValue,        -1,   false},
+{tag::NoUnderlyingRateSpreadSteps,             698,  false}, // UnderlyingRateSpreadStepGrp
+{tag::UnderlyingRateSpreadStepDate,            -1,   false},
+{tag::UnderlyingRateSpreadStepValue,           -1,   false},
+{tag::UnderlyingReturnRateDateMode,            -1,   false},
+{tag::NoUnderlyingReturnRateValuationDates,    705,  false}, // UnderlyingReturnRateValuationDateGrp
+{tag::UnderlyingReturnRateValuationDateRelativeTo, -1,   false},
+{tag::UnderlyingReturnRateValuationDateOffsetPeriod, -1,   false},
+{tag::UnderlyingReturnRateValuationDateOffsetUnit, -1,   false},
+{tag::UnderlyingReturnRateValuationDateOffsetDayType, -1,   false},
+{tag::UnderlyingReturnRateValuationStartDateUnadjusted, -1,   false},
+{tag::UnderlyingReturnRateValuationStartDateRelativeTo, -1,   false},
+{tag::UnderlyingReturnRateValuationStartDateOffsetPeriod, -1,   false},
+{tag::UnderlyingReturnRateValuationStartDateOffsetUnit, -1,   false},
+{tag::UnderlyingReturnRateValuationStartDateOffsetDayType, -1,   false},
+{tag::UnderlyingReturnRateValuationStartDateAdjusted, -1,   false},
+{tag::UnderlyingReturnRateValuationEndDateUnadjusted, -1,   false},
+{tag::UnderlyingReturnRateValuationEndDateRelativeTo, -1,   false},
+{tag::UnderlyingReturnRateValuationEndDateOffsetPeriod, -1,   false},
+{tag::UnderlyingReturnRateValuationEndDateOffsetUnit, -1,   false},
+{tag::UnderlyingReturnRateValuationEndDateOffsetDayType, -1,   false},
+{tag::UnderlyingReturnRateValuationEndDateAdjusted, -1,   false},
+{tag::UnderlyingReturnRateValuationFrequencyPeriod, -1,   false},
+{tag::UnderlyingReturnRateValuationFrequencyUnit, -1,   false},
+{tag::UnderlyingReturnRateValuationFrequencyRollConvention, -1,   false},
+{tag::UnderlyingReturnRateValuationDateBusinessDayConvention, -1,   false},
+{tag::NoUnderlyingReturnRateValuationDateBusinessCenters, 704,  false}, // UnderlyingReturnRateValuationDateBusinessCenterGrp
+{tag::UnderlyingReturnRateFXCurrencySymbol,    -1,   false},
+{tag::UnderlyingReturnRateFXRate,              -1,   false},
+{tag::UnderlyingReturnRateFXRateCalc,          -1,   false},
+{tag::UnderlyingReturnRatePriceSequence,       -1,   false},
+{tag::UnderlyingReturnRateCommissionBasis,     -1,   false},
+{tag::UnderlyingReturnRateCommissionAmount,    -1,   false},
+{tag::UnderlyingReturnRateCommissionCurrency,  -1,   false},
+{tag::UnderlyingReturnRateTotalCommissionPerTrade, -1,   false},
+{tag::UnderlyingReturnRateDeterminationMethod, -1,   false},
+{tag::NoUnderlyingReturnRatePrices,            703,  false}, // UnderlyingReturnRatePriceGrp
+{tag::NoUnderlyingReturnRateFXConversions,     700,  false}, // UnderlyingReturnRateFXConversionGrp
+{tag::UnderlyingReturnRateAmountRelativeTo,    -1,   false},
+{tag::UnderlyingReturnRateQuoteMeasureType,    -1,   false},
+{tag::UnderlyingReturnRateQuoteUnits,          -1,   false},
+{tag::UnderlyingReturnRateQuoteMethod,         -1,   false},
+{tag::UnderlyingReturnRateQuoteCurrency,       -1,   false},
+{tag::UnderlyingReturnRateQuoteCurrencyType,   -1,   false},
+{tag::UnderlyingReturnRateQuoteTimeType,       -1,   false},
+{tag::UnderlyingReturnRateQuoteTime,           -1,   false},
+{tag::UnderlyingReturnRateQuoteDate,           -1,   false},
+{tag::UnderlyingReturnRateQuoteExpirationTime, -1,   false},
+{tag::UnderlyingReturnRateQuoteBusinessCenter, -1,   false},
+{tag::UnderlyingReturnRateQuoteExchange,       -1,   false},
+{tag::NoUnderlyingReturnRateInformationSources, 702,  false}, // UnderlyingReturnRateInformationSourceGrp
+{tag::UnderlyingReturnRateQuotePricingModel,   -1,   false},
+{tag::UnderlyingReturnRateCashFlowType,        -1,   false},
+{tag::NoUnderlyingReturnRateDates,             699,  false}, // UnderlyingReturnRateDateGrp
+{tag::UnderlyingReturnRateValuationTimeType,   -1,   false},
+{tag::UnderlyingReturnRateValuationTime,       -1,   false},
+{tag::UnderlyingReturnRateValuationTimeBusinessCenter, -1,   false},
+{tag::UnderlyingReturnRateValuationPriceOption, -1,   false},
+{tag::UnderlyingReturnRateFinalPriceFallback,  -1,   false},
+{tag::UnderlyingReturnRateInformationSource,   -1,   false},
+{tag::UnderlyingReturnRateReferencePage,       -1,   false},
+{tag::UnderlyingReturnRateReferencePageHeading, -1,   false},
+{tag::UnderlyingReturnRatePriceBasis,          -1,   false},
+{tag::UnderlyingReturnRatePrice,               -1,   false},
+{tag::UnderlyingReturnRatePriceCurrency,       -1,   false},
+{tag::UnderlyingReturnRatePriceType,           -1,   false},
+{tag::UnderlyingReturnRateValuationDateBusinessCenter, -1,   false},
+{tag::UnderlyingReturnRateValuationDate,       -1,   false},
+{tag::UnderlyingReturnRateValuationDateType,   -1,   false},
+{tag::UnderlyingSettlMethodElectionDateBusinessCenter, -1,   false},
+{tag::UnderlyingSettlMethodElectionDateUnadjusted, -1,   false},
+{tag::UnderlyingSettlMethodElectionDateBusinessDayConvention, -1,   false},
+{tag::NoUnderlyingSettlMethodElectionDateBusinessCenters, 706,  false}, // UnderlyingSettlMethodElectionDateBusinessCenterGrp
+{tag::UnderlyingSettlMethodElectionDateRelativeTo, -1,   false},
+{tag::UnderlyingSettlMethodElectionDateOffsetPeriod, -1,   false},
+{tag::UnderlyingSettlMethodElectionDateOffsetUnit, -1,   false},
+{tag::UnderlyingSettlMethodElectionDateOffsetDayType, -1,   false},
+{tag::UnderlyingSettlMethodElectionDateAdjusted, -1,   false},
+{tag::TrdRegPublicationType,                   -1,   false},
+{tag::TrdRegPublicationReason,                 -1,   false},
+{tag::OrderAttributeType,                      -1,   false},
+{tag::OrderAttributeValue,                     -1,   false},
+{tag::SideCurrentCollateralAmount,             -1,   false},
+{tag::SideCollateralCurrency,                  -1,   false},
+{tag::SideCollateralAmountType,                -1,   false},
+{tag::SideCollateralFXRate,                    -1,   false},
+{tag::SideCollateralFXRateCalc,                -1,   false},
+{tag::SideCollateralType,                      -1,   false},
+{tag::SideCollateralAmountMarketSegmentID,     -1,   false},
+{tag::SideCollateralAmountMarketID,            -1,   false},
+{tag::SideHaircutIndicator,                    -1,   false},
+{tag::SideCollateralPortfolioID,               -1,   false},
+{tag::SideCollateralPercentOverage,            -1,   false},
+{tag::SideCollateralMarketPrice,               -1,   false},
+{tag::QuoteAttributeType,                      -1,   false},
+{tag::QuoteAttributeValue,                     -1,   false},
+{tag::PriceQualifier,                          -1,   false},
+{tag::IndexRollMonth,                          -1,   false},
+{tag::ReferenceDataDate,                       -1,   false},
+{tag::ReferenceDataDateType,                   -1,   false},
+{tag::FloatingRateIndexID,                     -1,   false},
+{tag::FloatingRateIndexIDSource,               -1,   false},
+{tag::FloatingRateIndexCurveUnit,              -1,   false},
+{tag::FloatingRateIndexCurvePeriod,            -1,   false},
+{tag::FloatingRateIndexCurveSpread,            -1,   false},
+{tag::AveragePriceType,                        -1,   false},
+{tag::AveragePriceStartTime,                   -1,   false},
+{tag::AveragePriceEndTime,                     -1,   false},
+{tag::TestReqID,                               -1,   false},
+{tag::TestReqID,                               -1,   true},
+{tag::BeginSeqNo,                              -1,   true},
+{tag::EndSeqNo,                                -1,   true},
+{tag::RefSeqNum,                               -1,   true},
+{tag::RefTagID,                                -1,   false},
+{tag::RefMsgType,                              -1,   false},
+{tag::RefApplVerID,                            -1,   false},
+{tag::RefApplExtID,                            -1,   false},
+{tag::RefCstmApplVerID,                        -1,   false},
+{tag::SessionRejectReason,                     -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::GapFillFlag,                             -1,   false},
+{tag::NewSeqNo,                                -1,   true},
+{tag::SessionStatus,                           -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::IOIID,                                   -1,   true},
+{tag::IOITransType,                            -1,   true},
+{tag::IOIRefID,                                -1,   false},
+{0,                                            3,    true}, // Instrument
+{0,                                            4,    false}, // InstrumentExtension
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{0,                                            2,    false}, // FinancingDetails
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoRelatedInstruments,                    180,  false}, // RelatedInstrumentGrp
+{tag::Side,                                    -1,   true},
+{tag::QtyType,                                 -1,   false},
+{0,                                            9,    false}, // OrderQtyData
+{tag::IOIQty,                                  -1,   true},
+{tag::Currency,                                -1,   false},
+{tag::NoStipulations,                          17,   false}, // Stipulations
+{tag::NoLegs,                                  44,   false}, // InstrmtLegIOIGrp
+{tag::PriceType,                               -1,   false},
+{tag::NoPriceQualifiers,                       712,  false}, // PriceQualifierGrp
+{tag::Price,                                   -1,   false},
+{tag::ValidUntilTime,                          -1,   false},
+{tag::IOIQltyInd,                              -1,   false},
+{tag::IOINaturalFlag,                          -1,   false},
+{tag::NoIOIQualifiers,                         48,   false}, // IOIQualGrp
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::URLLink,                                 -1,   false},
+{tag::NoRoutingIDs,                            78,   false}, // RoutingGrp
+{0,                                            16,   false}, // SpreadOrBenchmarkCurveData
+{tag::NoRelativeValues,                        586,  false}, // RelativeValueGrp
+{0,                                            20,   false}, // YieldData
+{tag::AdvId,                                   -1,   true},
+{tag::AdvTransType,                            -1,   true},
+{tag::AdvRefID,                                -1,   false},
+{0,                                            3,    true}, // Instrument
+{0,                                            4,    false}, // InstrumentExtension
+{0,                                            2,    false}, // FinancingDetails
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoRelatedInstruments,                    180,  false}, // RelatedInstrumentGrp
+{tag::AdvSide,                                 -1,   true},
+{tag::Quantity,                                -1,   true},
+{tag::QtyType,                                 -1,   false},
+{tag::Price,                                   -1,   false},
+{tag::Currency,                                -1,   false},
+{tag::TradeDate,                               -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::URLLink,                                 -1,   false},
+{tag::LastMkt,                                 -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::OrderID,                                 -1,   true},
+{tag::OrderRequestID,                          -1,   false},
+{tag::MassOrderRequestID,                      -1,   false},
+{tag::SecondaryOrderID,                        -1,   false},
+{tag::SecondaryClOrdID,                        -1,   false},
+{tag::SecondaryExecID,                         -1,   false},
+{tag::ClOrdID,                                 -1,   false},
+{tag::QuoteMsgID,                              -1,   false},
+{tag::OrigClOrdID,                             -1,   false},
+{tag::ClOrdLinkID,                             -1,   false},
+{tag::MDEntryID,                               -1,   false},
+{tag::QuoteRespID,                             -1,   false},
+{tag::OrdStatusReqID,                          -1,   false},
+{tag::MassStatusReqID,                         -1,   false},
+{tag::HostCrossID,                             -1,   false},
+{tag::TotNumReports,                           -1,   false},
+{tag::LastRptRequested,                        -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::NoTargetPartyIDs,                        167,  false}, // TargetParties
+{tag::TradeOriginationDate,                    -1,   false},
+{tag::NoContraBrokers,                         37,   false}, // ContraGrp
+{tag::ListID,                                  -1,   false},
+{tag::CrossID,                                 -1,   false},
+{tag::OrigCrossID,                             -1,   false},
+{tag::CrossType,                               -1,   false},
+{tag::RefRiskLimitCheckID,                     -1,   false},
+{tag::RefRiskLimitCheckIDType,                 -1,   false},
+{tag::TrdMatchID,                              -1,   false},
+{tag::TrdMatchSubID,                           -1,   false},
+{tag::ExecID,                                  -1,   true},
+{tag::ExecRefID,                               -1,   false},
+{tag::ExecType,                                -1,   true},
+{tag::ExecTypeReason,                          -1,   false},
+{tag::OrdStatus,                               -1,   true},
+{tag::WorkingIndicator,                        -1,   false},
+{tag::OrdRejReason,                            -1,   false},
+{tag::RejectText,                              -1,   false},
+{tag::EncodedRejectTextLen,                    -1,   false},
+{tag::EncodedRejectText,                       -1,   false},
+{tag::ExecRestatementReason,                   -1,   false},
+{tag::AlgorithmicTradeIndicator,               -1,   false},
+{tag::TrdType,                                 -1,   false},
+{tag::TrdSubType,                              -1,   false},
+{tag::SecondaryTrdType,                        -1,   false},
+{tag::RegulatoryTransactionType,               -1,   false},
+{tag::NoRegulatoryTradeIDs,                    306,  false}, // RegulatoryTradeIDGrp
+{tag::PreviouslyReported,                      -1,   false},
+{tag::TradeReportingIndicator,                 -1,   false},
+{tag::Account,                                 -1,   false},
+{tag::AcctIDSource,                            -1,   false},
+{tag::AccountType,                             -1,   false},
+{tag::DayBookingInst,                          -1,   false},
+{tag::BookingUnit,                             -1,   false},
+{tag::PreallocMethod,                          -1,   false},
+{tag::AllocID,                                 -1,   false},
+{tag::NoAllocs,                                63,   false}, // PreAllocGrp
+{tag::SettlType,                               -1,   false},
+{tag::SettlDate,                               -1,   false},
+{tag::MatchType,                               -1,   false},
+{tag::OrderCategory,                           -1,   false},
+{tag::CashMargin,                              -1,   false},
+{tag::ClearingFeeIndicator,                    -1,   false},
+{0,                                            3,    true}, // Instrument
+{0,                                            2,    false}, // FinancingDetails
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoPayments,                              276,  false}, // PaymentGrp
+{tag::Side,                                    -1,   true},
+{tag::ShortMarkingExemptIndicator,             -1,   false},
+{tag::ShortSaleExemptionReason,                -1,   false},
+{tag::NoStipulations,                          17,   false}, // Stipulations
+{tag::QtyType,                                 -1,   false},
+{0,                                            9,    false}, // OrderQtyData
+{tag::LotType,                                 -1,   false},
+{tag::OrdType,                                 -1,   false},
+{tag::PriceType,                               -1,   false},
+{tag::NoPriceQualifiers,                       712,  false}, // PriceQualifierGrp
+{tag::Price,                                   -1,   false},
+{tag::PriceProtectionScope,                    -1,   false},
+{tag::StopPx,                                  -1,   false},
+{0,                                            116,  false}, // TriggeringInstruction
+{tag::Triggered,                               -1,   false},
+{0,                                            11,   false}, // PegInstructions
+{0,                                            1,    false}, // DiscretionInstructions
+{tag::PeggedPrice,                             -1,   false},
+{tag::PeggedRefPrice,                          -1,   false},
+{tag::DiscretionPrice,                         -1,   false},
+{tag::TradePriceNegotiationMethod,             -1,   false},
+{tag::UpfrontPrice,                            -1,   false},
+{tag::UpfrontPriceType,                        -1,   false},
+{tag::TargetStrategy,                          -1,   false},
+{tag::NoStrategyParameters,                    104,  false}, // StrategyParametersGrp
+{tag::TargetStrategyParameters,                -1,   false},
+{tag::ParticipationRate,                       -1,   false},
+{tag::TargetStrategyPerformance,               -1,   false},
+{tag::Currency,                                -1,   false},
+{tag::ComplianceID,                            -1,   false},
+{tag::ComplianceText,                          -1,   false},
+{tag::EncodedComplianceTextLen,                -1,   false},
+{tag::EncodedComplianceText,                   -1,   false},
+{tag::SolicitedFlag,                           -1,   false},
+{tag::TimeInForce,                             -1,   false},
+{tag::EffectiveTime,                           -1,   false},
+{tag::ExpireDate,                              -1,   false},
+{tag::ExpireTime,                              -1,   false},
+{tag::ExposureDuration,                        -1,   false},
+{tag::ExposureDurationUnit,                    -1,   false},
+{tag::ExecInst,                                -1,   false},
+{tag::AuctionInstruction,                      -1,   false},
+{tag::AggressorIndicator,                      -1,   false},
+{tag::OrderCapacity,                           -1,   false},
+{tag::OrderRestrictions,                       -1,   false},
+{tag::TradingCapacity,                         -1,   false},
+{tag::PreTradeAnonymity,                       -1,   false},
+{tag::TradePublishIndicator,                   -1,   false},
+{tag::CustOrderCapacity,                       -1,   false},
+{tag::NoOrderAttributes,                       709,  false}, // OrderAttributeGrp
+{tag::LastQty,                                 -1,   false},
+{tag::CalculatedCcyLastQty,                    -1,   false},
+{tag::LastSwapPoints,                          -1,   false},
+{tag::UnderlyingLastQty,                       -1,   false},
+{tag::LastQtyVariance,                         -1,   false},
+{tag::LastPx,                                  -1,   false},
+{tag::UnderlyingLastPx,                        -1,   false},
+{tag::LastParPx,                               -1,   false},
+{tag::MidPx,                                   -1,   false},
+{tag::LastSpotRate,                            -1,   false},
+{tag::LastForwardPoints,                       -1,   false},
+{tag::LastUpfrontPrice,                        -1,   false},
+{tag::ReportingPx,                             -1,   false},
+{tag::ReportingQty,                            -1,   false},
+{tag::LastMkt,                                 -1,   false},
+{tag::VenueType,                               -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::ExDestination,                           -1,   false},
+{tag::ExDestinationIDSource,                   -1,   false},
+{tag::ExDestinationType,                       -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::TimeBracket,                             -1,   false},
+{tag::LastCapacity,                            -1,   false},
+{tag::NoLimitAmts,                             177,  false}, // LimitAmts
+{tag::LeavesQty,                               -1,   true},
+{tag::CumQty,                                  -1,   true},
+{tag::CxlQty,                                  -1,   false},
+{tag::AvgPx,                                   -1,   false},
+{tag::DayOrderQty,                             -1,   false},
+{tag::DayCumQty,                               -1,   false},
+{tag::DayAvgPx,                                -1,   false},
+{tag::TotNoFills,                              -1,   false},
+{tag::LastFragment,                            -1,   false},
+{1362,                                         157,  false}, // FillsGrp
+{tag::NoOrderEvents,                           221,  false}, // OrderEventGrp
+{tag::GTBookingInst,                           -1,   false},
+{tag::TradeDate,                               -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::ReportToExch,                            -1,   false},
+{0,                                            0,    false}, // CommissionData
+{tag::NoCommissions,                           594,  false}, // CommissionDataGrp
+{0,                                            16,   false}, // SpreadOrBenchmarkCurveData
+{tag::NoRelativeValues,                        586,  false}, // RelativeValueGrp
+{0,                                            20,   false}, // YieldData
+{tag::GrossTradeAmt,                           -1,   false},
+{tag::NumDaysInterest,                         -1,   false},
+{tag::ExDate,                                  -1,   false},
+{tag::AccruedInterestRate,                     -1,   false},
+{tag::AccruedInterestAmt,                      -1,   false},
+{tag::InterestAtMaturity,                      -1,   false},
+{tag::EndAccruedInterestAmt,                   -1,   false},
+{tag::StartCash,                               -1,   false},
+{tag::EndCash,                                 -1,   false},
+{tag::TradedFlatSwitch,                        -1,   false},
+{tag::BasisFeatureDate,                        -1,   false},
+{tag::BasisFeaturePrice,                       -1,   false},
+{tag::Concession,                              -1,   false},
+{tag::TotalTakedown,                           -1,   false},
+{tag::NetMoney,                                -1,   false},
+{tag::SettlCurrAmt,                            -1,   false},
+{tag::SettlCurrency,                           -1,   false},
+{tag::NoRateSources,                           166,  false}, // RateSource
+{tag::SettlCurrFxRate,                         -1,   false},
+{tag::SettlCurrFxRateCalc,                     -1,   false},
+{tag::HandlInst,                               -1,   false},
+{tag::MinQty,                                  -1,   false},
+{tag::MinQtyMethod,                            -1,   false},
+{tag::MatchIncrement,                          -1,   false},
+{tag::MaxPriceLevels,                          -1,   false},
+{tag::MaximumPricePercentage,                  -1,   false},
+{tag::NoValueChecks,                           230,  false}, // ValueChecksGrp
+{tag::NoMatchInst,                             176,  false}, // MatchingInstructions
+{tag::SelfMatchPreventionID,                   -1,   false},
+{tag::CrossedIndicator,                        -1,   false},
+{0,                                            115,  false}, // DisplayInstruction
+{tag::NoDisclosureInstructions,                222,  false}, // DisclosureInstructionGrp
+{tag::MaxFloor,                                -1,   false},
+{tag::ClearingAccountType,                     -1,   false},
+{tag::PositionEffect,                          -1,   false},
+{tag::MaxShow,                                 -1,   false},
+{tag::BookingType,                             -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::SettlDate2,                              -1,   false},
+{tag::OrderQty2,                               -1,   false},
+{tag::LastForwardPoints2,                      -1,   false},
+{tag::MultiLegReportingType,                   -1,   false},
+{tag::ContingencyType,                         -1,   false},
+{tag::CancellationRights,                      -1,   false},
+{tag::MoneyLaunderingStatus,                   -1,   false},
+{tag::RegistID,                                -1,   false},
+{tag::Designation,                             -1,   false},
+{tag::TransBkdTime,                            -1,   false},
+{tag::ExecValuationPoint,                      -1,   false},
+{tag::ExecPriceType,                           -1,   false},
+{tag::ExecPriceAdjustment,                     -1,   false},
+{tag::PriorityIndicator,                       -1,   false},
+{tag::PriceImprovement,                        -1,   false},
+{tag::LastLiquidityInd,                        -1,   false},
+{tag::NoContAmts,                              36,   false}, // ContAmtGrp
+{tag::NoLegs,                                  42,   false}, // InstrmtLegExecGrp
+{tag::CopyMsgIndicator,                        -1,   false},
+{tag::NoMiscFees,                              59,   false}, // MiscFeesGrp
+{tag::DividendYield,                           -1,   false},
+{tag::ManualOrderIndicator,                    -1,   false},
+{tag::CustDirectedOrder,                       -1,   false},
+{tag::ReceivedDeptID,                          -1,   false},
+{tag::CustOrderHandlingInst,                   -1,   false},
+{tag::OrderHandlingInstSource,                 -1,   false},
+{tag::OrderOrigination,                        -1,   false},
+{tag::OriginatingDeptID,                       -1,   false},
+{tag::ReceivingDeptID,                         -1,   false},
+{tag::OwnerType,                               -1,   false},
+{tag::OrderOwnershipIndicator,                 -1,   false},
+{tag::NoTrdRegTimestamps,                      18,   false}, // TrdRegTimestamps
+{tag::NoTrdRegPublications,                    708,  false}, // TrdRegPublicationGrp
+{tag::NoTradePriceConditions,                  225,  false}, // TradePriceConditionGrp
+{tag::Volatility,                              -1,   false},
+{tag::TimeToExpiration,                        -1,   false},
+{tag::RiskFreeRate,                            -1,   false},
+{tag::PriceDelta,                              -1,   false},
+{tag::CoverPrice,                              -1,   false},
+{0,                                            208,  false}, // ThrottleResponse
+{tag::RefOrderID,                              -1,   false},
+{tag::RefOrderIDSource,                        -1,   false},
+{tag::RefClOrdID,                              -1,   false},
+{tag::AuctionType,                             -1,   false},
+{tag::AuctionAllocationPct,                    -1,   false},
+{tag::LockedQty,                               -1,   false},
+{tag::SecondaryLockedQty,                      -1,   false},
+{tag::LockType,                                -1,   false},
+{tag::ReleaseInstruction,                      -1,   false},
+{tag::ReleaseQty,                              -1,   false},
+{tag::RelatedHighPrice,                        -1,   false},
+{tag::RelatedLowPrice,                         -1,   false},
+{tag::RelatedPriceSource,                      -1,   false},
+{tag::OrderID,                                 -1,   true},
+{tag::OrderRequestID,                          -1,   false},
+{tag::SecondaryOrderID,                        -1,   false},
+{tag::SecondaryClOrdID,                        -1,   false},
+{tag::ClOrdID,                                 -1,   true},
+{tag::ClOrdLinkID,                             -1,   false},
+{tag::OrigClOrdID,                             -1,   false},
+{tag::OrdStatus,                               -1,   true},
+{tag::WorkingIndicator,                        -1,   false},
+{tag::OrigOrdModTime,                          -1,   false},
+{tag::ListID,                                  -1,   false},
+{tag::Account,                                 -1,   false},
+{tag::AcctIDSource,                            -1,   false},
+{tag::AccountType,                             -1,   false},
+{tag::TradeOriginationDate,                    -1,   false},
+{tag::TradeDate,                               -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::CxlRejResponseTo,                        -1,   true},
+{tag::CxlRejReason,                            -1,   false},
+{tag::RejectText,                              -1,   false},
+{tag::EncodedRejectTextLen,                    -1,   false},
+{tag::EncodedRejectText,                       -1,   false},
+{tag::ExDestination,                           -1,   false},
+{tag::ExDestinationIDSource,                   -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::EncryptMethod,                           -1,   true},
+{tag::HeartBtInt,                              -1,   true},
+{tag::RawDataLength,                           -1,   false},
+{tag::RawData,                                 -1,   false},
+{tag::ResetSeqNumFlag,                         -1,   false},
+{tag::NextExpectedMsgSeqNum,                   -1,   false},
+{tag::MaxMessageSize,                          -1,   false},
+{tag::NoMsgTypes,                              120,  false}, // MsgTypeGrp
+{tag::TestMessageIndicator,                    -1,   false},
+{tag::Username,                                -1,   false},
+{tag::Password,                                -1,   false},
+{tag::NewPassword,                             -1,   false},
+{tag::EncryptedPasswordMethod,                 -1,   false},
+{tag::EncryptedPasswordLen,                    -1,   false},
+{tag::EncryptedPassword,                       -1,   false},
+{tag::EncryptedNewPasswordLen,                 -1,   false},
+{tag::EncryptedNewPassword,                    -1,   false},
+{tag::SessionStatus,                           -1,   false},
+{tag::DefaultApplVerID,                        -1,   true},
+{tag::DefaultApplExtID,                        -1,   false},
+{tag::DefaultCstmApplVerID,                    -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::SecurityReportID,                        -1,   false},
+{tag::SecurityReqID,                           -1,   false},
+{tag::SecurityResponseID,                      -1,   false},
+{tag::SecurityRequestResult,                   -1,   false},
+{tag::SecurityRejectReason,                    -1,   false},
+{tag::ClearingBusinessDate,                    -1,   false},
+{0,                                            19,   false}, // UnderlyingInstrument
+{0,                                            149,  false}, // DerivativeSecurityDefinition
+{tag::LastUpdateTime,                          -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::TotNoRelatedSym,                         -1,   false},
+{tag::LastFragment,                            -1,   false},
+{tag::NoRelatedSym,                            74,   false}, // RelSymDerivSecGrp
+{tag::ClOrdID,                                 -1,   true},
+{tag::OrderRequestID,                          -1,   false},
+{tag::SecondaryClOrdID,                        -1,   false},
+{tag::ClOrdLinkID,                             -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::NoTargetPartyIDs,                        167,  false}, // TargetParties
+{tag::TradeOriginationDate,                    -1,   false},
+{tag::TradeDate,                               -1,   false},
+{tag::Account,                                 -1,   false},
+{tag::AcctIDSource,                            -1,   false},
+{tag::AccountType,                             -1,   false},
+{tag::DayBookingInst,                          -1,   false},
+{tag::BookingUnit,                             -1,   false},
+{tag::PreallocMethod,                          -1,   false},
+{tag::AllocID,                                 -1,   false},
+{tag::NoAllocs,                                64,   false}, // PreAllocMlegGrp
+{tag::SettlType,                               -1,   false},
+{tag::SettlDate,                               -1,   false},
+{tag::CashMargin,                              -1,   false},
+{tag::ClearingFeeIndicator,                    -1,   false},
+{tag::HandlInst,                               -1,   false},
+{tag::ExecInst,                                -1,   false},
+{tag::AuctionInstruction,                      -1,   false},
+{tag::MinQty,                                  -1,   false},
+{tag::MinQtyMethod,                            -1,   false},
+{tag::MatchIncrement,                          -1,   false},
+{tag::MaxPriceLevels,                          -1,   false},
+{tag::MaximumPricePercentage,                  -1,   false},
+{tag::NoValueChecks,                           230,  false}, // ValueChecksGrp
+{tag::NoMatchInst,                             176,  false}, // MatchingInstructions
+{tag::SelfMatchPreventionID,                   -1,   false},
+{0,                                            115,  false}, // DisplayInstruction
+{tag::NoDisclosureInstructions,                222,  false}, // DisclosureInstructionGrp
+{tag::MaxFloor,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::ExDestination,                           -1,   false},
+{tag::ExDestinationIDSource,                   -1,   false},
+{tag::ExDestinationType,                       -1,   false},
+{tag::NoTradingSessions,                       88,   false}, // TrdgSesGrp
+{tag::ProcessCode,                             -1,   false},
+{tag::Side,                                    -1,   true},
+{tag::ShortMarkingExemptIndicator,             -1,   false},
+{0,                                            3,    false}, // Instrument
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::PrevClosePx,                             -1,   false},
+{tag::SwapPoints,                              -1,   false},
+{tag::NoLegs,                                  49,   false}, // LegOrdGrp
+{tag::LocateReqd,                              -1,   false},
+{tag::TransactTime,                            -1,   true},
+{tag::QtyType,                                 -1,   false},
+{0,                                            9,    false}, // OrderQtyData
+{tag::OrdType,                                 -1,   true},
+{tag::MultilegModel,                           -1,   false},
+{tag::MultilegPriceMethod,                     -1,   false},
+{tag::PriceType,                               -1,   false},
+{tag::Price,                                   -1,   false},
+{tag::PriceProtectionScope,                    -1,   false},
+{tag::StopPx,                                  -1,   false},
+{0,                                            116,  false}, // TriggeringInstruction
+{tag::Currency,                                -1,   false},
+{tag::TradePriceNegotiationMethod,             -1,   false},
+{tag::UpfrontPriceType,                        -1,   false},
+{tag::UpfrontPrice,                            -1,   false},
+{tag::ComplianceID,                            -1,   false},
+{tag::ComplianceText,                          -1,   false},
+{tag::EncodedComplianceTextLen,                -1,   false},
+{tag::EncodedComplianceText,                   -1,   false},
+{tag::SolicitedFlag,                           -1,   false},
+{tag::IOIID,                                   -1,   false},
+{tag::QuoteID,                                 -1,   false},
+{tag::RefOrderID,                              -1,   false},
+{tag::RefOrderIDSource,                        -1,   false},
+{tag::RefClOrdID,                              -1,   false},
+{tag::TimeInForce,                             -1,   false},
+{tag::EffectiveTime,                           -1,   false},
+{tag::ExpireDate,                              -1,   false},
+{tag::ExpireTime,                              -1,   false},
+{tag::GTBookingInst,                           -1,   false},
+{tag::ExposureDuration,                        -1,   false},
+{tag::ExposureDurationUnit,                    -1,   false},
+{0,                                            0,    false}, // CommissionData
+{tag::NoCommissions,                           594,  false}, // CommissionDataGrp
+{tag::OrderCapacity,                           -1,   false},
+{tag::OrderRestrictions,                       -1,   false},
+{tag::TradingCapacity,                         -1,   false},
+{tag::PreTradeAnonymity,                       -1,   false},
+{tag::TradePublishIndicator,                   -1,   false},
+{tag::CustOrderCapacity,                       -1,   false},
+{tag::OrderOrigination,                        -1,   false},
+{tag::NoOrderAttributes,                       709,  false}, // OrderAttributeGrp
+{tag::ForexReq,                                -1,   false},
+{tag::SettlCurrency,                           -1,   false},
+{tag::BookingType,                             -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::ClearingAccountType,                     -1,   false},
+{tag::PositionEffect,                          -1,   false},
+{tag::CoveredOrUncovered,                      -1,   false},
+{tag::MaxShow,                                 -1,   false},
+{0,                                            11,   false}, // PegInstructions
+{0,                                            1,    false}, // DiscretionInstructions
+{tag::TargetStrategy,                          -1,   false},
+{tag::NoStrategyParameters,                    104,  false}, // StrategyParametersGrp
+{tag::TargetStrategyParameters,                -1,   false},
+{tag::RiskFreeRate,                            -1,   false},
+{tag::ParticipationRate,                       -1,   false},
+{tag::CancellationRights,                      -1,   false},
+{tag::MoneyLaunderingStatus,                   -1,   false},
+{tag::RegistID,                                -1,   false},
+{tag::Designation,                             -1,   false},
+{tag::MultiLegRptTypeReq,                      -1,   false},
+{tag::ThrottleInst,                            -1,   false},
+{tag::AuctionType,                             -1,   false},
+{tag::AuctionAllocationPct,                    -1,   false},
+{tag::RelatedHighPrice,                        -1,   false},
+{tag::RelatedLowPrice,                         -1,   false},
+{tag::RelatedPriceSource,                      -1,   false},
+{tag::OrderID,                                 -1,   false},
+{tag::OrderRequestID,                          -1,   false},
+{tag::OrigClOrdID,                             -1,   false},
+{tag::ClOrdID,                                 -1,   false},
+{tag::SecondaryClOrdID,                        -1,   false},
+{tag::ClOrdLinkID,                             -1,   false},
+{tag::OrigOrdModTime,                          -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::NoTargetPartyIDs,                        167,  false}, // TargetParties
+{tag::TradeOriginationDate,                    -1,   false},
+{tag::TradeDate,                               -1,   false},
+{tag::Account,                                 -1,   false},
+{tag::AcctIDSource,                            -1,   false},
+{tag::AccountType,                             -1,   false},
+{tag::DayBookingInst,                          -1,   false},
+{tag::BookingUnit,                             -1,   false},
+{tag::PreallocMethod,                          -1,   false},
+{tag::AllocID,                                 -1,   false},
+{tag::NoAllocs,                                64,   false}, // PreAllocMlegGrp
+{tag::SettlType,                               -1,   false},
+{tag::SettlDate,                               -1,   false},
+{tag::CashMargin,                              -1,   false},
+{tag::ClearingFeeIndicator,                    -1,   false},
+{tag::HandlInst,                               -1,   false},
+{tag::ExecInst,                                -1,   false},
+{tag::AuctionInstruction,                      -1,   false},
+{tag::MinQty,                                  -1,   false},
+{tag::MinQtyMethod,                            -1,   false},
+{tag::MatchIncrement,                          -1,   false},
+{tag::MaxPriceLevels,                          -1,   false},
+{tag::MaximumPricePercentage,                  -1,   false},
+{tag::NoValueChecks,                           230,  false}, // ValueChecksGrp
+{tag::NoMatchInst,                             176,  false}, // MatchingInstructions
+{tag::SelfMatchPreventionID,                   -1,   false},
+{0,                                            115,  false}, // DisplayInstruction
+{tag::NoDisclosureInstructions,                222,  false}, // DisclosureInstructionGrp
+{tag::MaxFloor,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::ExDestination,                           -1,   false},
+{tag::ExDestinationIDSource,                   -1,   false},
+{tag::ExDestinationType,                       -1,   false},
+{tag::NoTradingSessions,                       88,   false}, // TrdgSesGrp
+{tag::ProcessCode,                             -1,   false},
+{tag::Side,                                    -1,   true},
+{tag::ShortMarkingExemptIndicator,             -1,   false},
+{0,                                            3,    false}, // Instrument
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::PrevClosePx,                             -1,   false},
+{tag::SwapPoints,                              -1,   false},
+{tag::NoLegs,                                  49,   false}, // LegOrdGrp
+{tag::LocateReqd,                              -1,   false},
+{tag::TransactTime,                            -1,   true},
+{tag::QtyType,                                 -1,   false},
+{0,                                            9,    false}, // OrderQtyData
+{tag::OrdType,                                 -1,   true},
+{tag::MultilegModel,                           -1,   false},
+{tag::MultilegPriceMethod,                     -1,   false},
+{tag::PriceType,                               -1,   false},
+{tag::Price,                                   -1,   false},
+{tag::PriceProtectionScope,                    -1,   false},
+{tag::StopPx,                                  -1,   false},
+{0,                                            116,  false}, // TriggeringInstruction
+{tag::Currency,                                -1,   false},
+{tag::ComplianceID,                            -1,   false},
+{tag::ComplianceText,                          -1,   false},
+{tag::EncodedComplianceTextLen,                -1,   false},
+{tag::EncodedComplianceText,                   -1,   false},
+{tag::SolicitedFlag,                           -1,   false},
+{tag::IOIID,                                   -1,   false},
+{tag::QuoteID,                                 -1,   false},
+{tag::TimeInForce,                             -1,   false},
+{tag::EffectiveTime,                           -1,   false},
+{tag::ExpireDate,                              -1,   false},
+{tag::ExpireTime,                              -1,   false},
+{tag::GTBookingInst,                           -1,   false},
+{tag::ExposureDuration,                        -1,   false},
+{tag::ExposureDurationUnit,                    -1,   false},
+{0,                                            0,    false}, // CommissionData
+{tag::NoCommissions,                           594,  false}, // CommissionDataGrp
+{tag::OrderCapacity,                           -1,   false},
+{tag::OrderRestrictions,                       -1,   false},
+{tag::TradingCapacity,                         -1,   false},
+{tag::PreTradeAnonymity,                       -1,   false},
+{tag::TradePublishIndicator,                   -1,   false},
+{tag::CustOrderCapacity,                       -1,   false},
+{tag::OrderOrigination,                        -1,   false},
+{tag::NoOrderAttributes,                       709,  false}, // OrderAttributeGrp
+{tag::ForexReq,                                -1,   false},
+{tag::SettlCurrency,                           -1,   false},
+{tag::BookingType,                             -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::ClearingAccountType,                     -1,   false},
+{tag::PositionEffect,                          -1,   false},
+{tag::CoveredOrUncovered,                      -1,   false},
+{tag::MaxShow,                                 -1,   false},
+{0,                                            11,   false}, // PegInstructions
+{0,                                            1,    false}, // DiscretionInstructions
+{tag::TargetStrategy,                          -1,   false},
+{tag::NoStrategyParameters,                    104,  false}, // StrategyParametersGrp
+{tag::TargetStrategyParameters,                -1,   false},
+{tag::RiskFreeRate,                            -1,   false},
+{tag::ParticipationRate,                       -1,   false},
+{tag::CancellationRights,                      -1,   false},
+{tag::MoneyLaunderingStatus,                   -1,   false},
+{tag::RegistID,                                -1,   false},
+{tag::Designation,                             -1,   false},
+{tag::OwnerType,                               -1,   false},
+{tag::OrderOwnershipIndicator,                 -1,   false},
+{tag::MultiLegRptTypeReq,                      -1,   false},
+{tag::ThrottleInst,                            -1,   false},
+{tag::AuctionType,                             -1,   false},
+{tag::AuctionAllocationPct,                    -1,   false},
+{tag::RelatedHighPrice,                        -1,   false},
+{tag::RelatedLowPrice,                         -1,   false},
+{tag::RelatedPriceSource,                      -1,   false},
+{tag::TradeRequestID,                          -1,   true},
+{tag::TradeID,                                 -1,   false},
+{tag::SecondaryTradeID,                        -1,   false},
+{tag::FirmTradeID,                             -1,   false},
+{tag::SecondaryFirmTradeID,                    -1,   false},
+{tag::TradeRequestType,                        -1,   true},
+{tag::SubscriptionRequestType,                 -1,   false},
+{tag::TradeReportID,                           -1,   false},
+{tag::SecondaryTradeReportID,                  -1,   false},
+{tag::SecondaryExecID,                         -1,   false},
+{tag::ExecID,                                  -1,   false},
+{tag::ExecType,                                -1,   false},
+{tag::OrderID,                                 -1,   false},
+{tag::ClOrdID,                                 -1,   false},
+{tag::MatchStatus,                             -1,   false},
+{tag::TrdType,                                 -1,   false},
+{tag::TrdSubType,                              -1,   false},
+{tag::OffsetInstruction,                       -1,   false},
+{tag::TradeHandlingInstr,                      -1,   false},
+{tag::TransferReason,                          -1,   false},
+{tag::SecondaryTrdType,                        -1,   false},
+{tag::TradeLinkID,                             -1,   false},
+{tag::TrdMatchID,                              -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{0,                                            3,    false}, // Instrument
+{0,                                            4,    false}, // InstrumentExtension
+{0,                                            2,    false}, // FinancingDetails
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::NoDates,                                 91,   false}, // TrdCapDtGrp
+{tag::ClearingBusinessDate,                    -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::TimeBracket,                             -1,   false},
+{tag::Side,                                    -1,   false},
+{tag::MultiLegReportingType,                   -1,   false},
+{tag::TradeInputSource,                        -1,   false},
+{tag::TradeInputDevice,                        -1,   false},
+{tag::ResponseTransportType,                   -1,   false},
+{tag::ResponseDestination,                     -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::MessageEventSource,                      -1,   false},
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::TradeReportID,                           -1,   false},
+{tag::TradeID,                                 -1,   false},
+{tag::SecondaryTradeID,                        -1,   false},
+{tag::FirmTradeID,                             -1,   false},
+{tag::SecondaryFirmTradeID,                    -1,   false},
+{tag::PackageID,                               -1,   false},
+{tag::TradeNumber,                             -1,   false},
+{tag::TradeReportTransType,                    -1,   false},
+{tag::TradeReportType,                         -1,   false},
+{tag::TrdRptStatus,                            -1,   false},
+{tag::TradeRequestID,                          -1,   false},
+{tag::TrdType,                                 -1,   false},
+{tag::TrdSubType,                              -1,   false},
+{tag::SecondaryTrdType,                        -1,   false},
+{tag::AlgorithmicTradeIndicator,               -1,   false},
+{tag::OffsetInstruction,                       -1,   false},
+{tag::NoTradePriceConditions,                  225,  false}, // TradePriceConditionGrp
+{tag::TradeHandlingInstr,                      -1,   false},
+{tag::OrigTradeHandlingInstr,                  -1,   false},
+{tag::OrigTradeDate,                           -1,   false},
+{tag::OrigTradeID,                             -1,   false},
+{tag::OrigSecondaryTradeID,                    -1,   false},
+{tag::TransferReason,                          -1,   false},
+{tag::ExecType,                                -1,   false},
+{tag::TotNumTradeReports,                      -1,   false},
+{tag::LastRptRequested,                        -1,   false},
+{tag::UnsolicitedIndicator,                    -1,   false},
+{tag::SubscriptionRequestType,                 -1,   false},
+{tag::TradeReportRefID,                        -1,   false},
+{tag::SecondaryTradeReportRefID,               -1,   false},
+{tag::SecondaryTradeReportID,                  -1,   false},
+{tag::TradeLinkID,                             -1,   false},
+{tag::TrdMatchID,                              -1,   false},
+{tag::ExecID,                                  -1,   false},
+{tag::SecondaryExecID,                         -1,   false},
+{tag::ExecRestatementReason,                   -1,   false},
+{tag::RegulatoryTransactionType,               -1,   false},
+{tag::NoRegulatoryTradeIDs,                    306,  false}, // RegulatoryTradeIDGrp
+{tag::PreviouslyReported,                      -1,   false},
+{tag::PriceType,                               -1,   false},
+{tag::NoPriceQualifiers,                       712,  false}, // PriceQualifierGrp
+{tag::CrossType,                               -1,   false},
+{tag::NoRootPartyIDs,                          117,  false}, // RootParties
+{tag::AsOfIndicator,                           -1,   false},
+{tag::SettlSessID,                             -1,   false},
+{tag::SettlSessSubID,                          -1,   false},
+{tag::VenueType,                               -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::MarketID,                                -1,   false},
+{tag::TaxonomyType,                            -1,   false},
+{0,                                            3,    true}, // Instrument
+{0,                                            4,    false}, // InstrumentExtension
+{0,                                            2,    false}, // FinancingDetails
+{tag::NoPayments,                              276,  false}, // PaymentGrp
+{tag::QtyType,                                 -1,   false},
+{0,                                            20,   false}, // YieldData
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoRelatedInstruments,                    180,  false}, // RelatedInstrumentGrp
+{tag::NoCollateralAmounts,                     210,  false}, // CollateralAmountGrp
+{tag::NoRateSources,                           166,  false}, // RateSource
+{tag::UnderlyingTradingSessionID,              -1,   false},
+{tag::UnderlyingTradingSessionSubID,           -1,   false},
+{tag::LastQty,                                 -1,   false},
+{tag::LastQtyVariance,                         -1,   false},
+{tag::LastQtyChanged,                          -1,   false},
+{tag::LastMultipliedQty,                       -1,   false},
+{tag::TotalTradeQty,                           -1,   false},
+{tag::TotalTradeMultipliedQty,                 -1,   false},
+{tag::LastPx,                                  -1,   false},
+{tag::MidPx,                                   -1,   false},
+{tag::DifferentialPrice,                       -1,   false},
+{tag::CalculatedCcyLastQty,                    -1,   false},
+{tag::PriceMarkup,                             -1,   false},
+{0,                                            716,  false}, // AveragePriceDetail
+{tag::Currency,                                -1,   false},
+{tag::SettlCurrency,                           -1,   false},
+{tag::SettlPriceFxRateCalc,                    -1,   false},
+{tag::LastParPx,                               -1,   false},
+{tag::LastSpotRate,                            -1,   false},
+{tag::LastForwardPoints,                       -1,   false},
+{tag::LastSwapPoints,                          -1,   false},
+{tag::PricePrecision,                          -1,   false},
+{tag::LastMkt,                                 -1,   false},
+{tag::ClearingTradePrice,                      -1,   false},
+{tag::TradePriceNegotiationMethod,             -1,   false},
+{tag::LastUpfrontPrice,                        -1,   false},
+{tag::UpfrontPriceType,                        -1,   false},
+{tag::TradeDate,                               -1,   false},
+{tag::ClearingBusinessDate,                    -1,   false},
+{tag::AvgPx,                                   -1,   false},
+{0,                                            16,   false}, // SpreadOrBenchmarkCurveData
+{tag::AvgPxGroupID,                            -1,   false},
+{tag::AvgPxIndicator,                          -1,   false},
+{tag::ValuationDate,                           -1,   false},
+{tag::ValuationTime,                           -1,   false},
+{tag::ValuationBusinessCenter,                 -1,   false},
+{tag::NoPosAmt,                                12,   false}, // PositionAmountData
+{tag::MultiLegReportingType,                   -1,   false},
+{tag::TradeLegRefID,                           -1,   false},
+{tag::NoLegs,                                  87,   false}, // TrdInstrmtLegGrp
+{tag::TransactTime,                            -1,   false},
+{tag::NoTrdRegTimestamps,                      18,   false}, // TrdRegTimestamps
+{tag::SettlType,                               -1,   false},
+{tag::SettlDate,                               -1,   false},
+{tag::UnderlyingSettlementDate,                -1,   false},
+{tag::MatchStatus,                             -1,   false},
+{tag::ExecMethod,                              -1,   false},
+{tag::MatchType,                               -1,   false},
+{tag::NoTradeQtys,                             226,  false}, // TradeQtyGrp
+{tag::NoSides,                                 85,   true}, // TrdCapRptSideGrp
+{tag::Volatility,                              -1,   false},
+{tag::TimeToExpiration,                        -1,   false},
+{tag::DividendYield,                           -1,   false},
+{tag::RiskFreeRate,                            -1,   false},
+{tag::PriceDelta,                              -1,   false},
+{tag::CurrencyRatio,                           -1,   false},
+{tag::CopyMsgIndicator,                        -1,   false},
+{tag::NoTrdRepIndicators,                      158,  false}, // TrdRepIndicatorsGrp
+{tag::PublishTrdIndicator,                     -1,   false},
+{tag::TradePublishIndicator,                   -1,   false},
+{tag::NoTrdRegPublications,                    708,  false}, // TrdRegPublicationGrp
+{tag::ShortSaleReason,                         -1,   false},
+{tag::TierCode,                                -1,   false},
+{tag::MessageEventSource,                      -1,   false},
+{tag::LastUpdateTime,                          -1,   false},
+{tag::RndPx,                                   -1,   false},
+{tag::TZTransactTime,                          -1,   false},
+{tag::ReportedPxDiff,                          -1,   false},
+{tag::GrossTradeAmt,                           -1,   false},
+{tag::TotalGrossTradeAmt,                      -1,   false},
+{tag::TradeReportRejectReason,                 -1,   false},
+{tag::RejectText,                              -1,   false},
+{tag::EncodedRejectTextLen,                    -1,   false},
+{tag::EncodedRejectText,                       -1,   false},
+{tag::FeeMultiplier,                           -1,   false},
+{tag::ClearedIndicator,                        -1,   false},
+{tag::ClearingIntention,                       -1,   false},
+{tag::TradeClearingInstruction,                -1,   false},
+{tag::BackloadedTradeIndicator,                -1,   false},
+{tag::ConfirmationMethod,                      -1,   false},
+{tag::MandatoryClearingIndicator,              -1,   false},
+{tag::NoMandatoryClearingJurisdictions,        442,  false}, // MandatoryClearingJurisdictionGrp
+{tag::MixedSwapIndicator,                      -1,   false},
+{tag::MultiAssetSwapIndicator,                 -1,   false},
+{tag::InternationalSwapIndicator,              -1,   false},
+{tag::OffMarketPriceIndicator,                 -1,   false},
+{tag::VerificationMethod,                      -1,   false},
+{tag::ClearingRequirementException,            -1,   false},
+{tag::IRSDirection,                            -1,   false},
+{tag::RegulatoryReportType,                    -1,   false},
+{tag::VoluntaryRegulatoryReport,               -1,   false},
+{tag::TradeCollateralization,                  -1,   false},
+{tag::TradeContinuation,                       -1,   false},
+{tag::TradeContingency,                        -1,   false},
+{tag::TradeVersion,                            -1,   false},
+{tag::HistoricalReportIndicator,               -1,   false},
+{tag::DeltaCrossed,                            -1,   false},
+{tag::TradeContinuationText,                   -1,   false},
+{tag::EncodedTradeContinuationTextLen,         -1,   false},
+{tag::EncodedTradeContinuationText,            -1,   false},
+{tag::IntraFirmTradeIndicator,                 -1,   false},
+{tag::AffiliatedFirmsTradeIndicator,           -1,   false},
+{tag::NoAttachments,                           396,  false}, // AttachmentGrp
+{tag::RiskLimitCheckStatus,                    -1,   false},
+{tag::MassStatusReqID,                         -1,   true},
+{tag::MassStatusReqType,                       -1,   true},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::NoTargetPartyIDs,                        167,  false}, // TargetParties
+{tag::Account,                                 -1,   false},
+{tag::AcctIDSource,                            -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{0,                                            3,    false}, // Instrument
+{0,                                            19,   false}, // UnderlyingInstrument
+{tag::Side,                                    -1,   false},
+{tag::QuoteReqID,                              -1,   true},
+{tag::RFQReqID,                                -1,   false},
+{tag::QuoteRequestRejectReason,                -1,   true},
+{tag::PrivateQuote,                            -1,   false},
+{tag::RespondentType,                          -1,   false},
+{tag::PreTradeAnonymity,                       -1,   false},
+{tag::NoRootPartyIDs,                          117,  false}, // RootParties
+{tag::NoRelatedSym,                            71,   true}, // QuotReqRjctGrp
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::RFQReqID,                                -1,   true},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::NoRelatedSym,                            75,   true}, // RFQReqGrp
+{tag::SubscriptionRequestType,                 -1,   false},
+{tag::PrivateQuote,                            -1,   false},
+{tag::QuoteStatusReqID,                        -1,   false},
+{tag::QuoteReqID,                              -1,   false},
+{tag::QuoteID,                                 -1,   false},
+{tag::BidID,                                   -1,   false},
+{tag::OfferID,                                 -1,   false},
+{tag::SecondaryQuoteID,                        -1,   false},
+{tag::QuoteMsgID,                              -1,   false},
+{tag::QuoteRespID,                             -1,   false},
+{tag::QuoteType,                               -1,   false},
+{tag::QuoteCancelType,                         -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::NoTargetPartyIDs,                        167,  false}, // TargetParties
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{0,                                            3,    false}, // Instrument
+{0,                                            2,    false}, // FinancingDetails
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::Side,                                    -1,   false},
+{0,                                            9,    false}, // OrderQtyData
+{tag::SettlType,                               -1,   false},
+{tag::SettlDate,                               -1,   false},
+{tag::SettlDate2,                              -1,   false},
+{tag::OrderQty2,                               -1,   false},
+{tag::Currency,                                -1,   false},
+{tag::NoStipulations,                          17,   false}, // Stipulations
+{tag::Account,                                 -1,   false},
+{tag::AcctIDSource,                            -1,   false},
+{tag::AccountType,                             -1,   false},
+{tag::NoLegs,                                  52,   false}, // LegQuotStatGrp
+{tag::NoQuoteQualifiers,                       68,   false}, // QuotQualGrp
+{tag::NegotiationMethod,                       -1,   false},
+{tag::ExpireTime,                              -1,   false},
+{tag::Price,                                   -1,   false},
+{tag::PriceType,                               -1,   false},
+{tag::NoPriceQualifiers,                       712,  false}, // PriceQualifierGrp
+{0,                                            16,   false}, // SpreadOrBenchmarkCurveData
+{0,                                            20,   false}, // YieldData
+{tag::BidQuoteID,                              -1,   false},
+{tag::OfferQuoteID,                            -1,   false},
+{tag::BidMDEntryID,                            -1,   false},
+{tag::OfferMDEntryID,                          -1,   false},
+{tag::BidPx,                                   -1,   false},
+{tag::OfferPx,                                 -1,   false},
+{tag::MktBidPx,                                -1,   false},
+{tag::MktOfferPx,                              -1,   false},
+{tag::MinBidSize,                              -1,   false},
+{tag::BidSize,                                 -1,   false},
+{tag::TotalBidSize,                            -1,   false},
+{tag::MinOfferSize,                            -1,   false},
+{tag::OfferSize,                               -1,   false},
+{tag::TotalOfferSize,                          -1,   false},
+{tag::MinQty,                                  -1,   false},
+{tag::ValidUntilTime,                          -1,   false},
+{tag::BidSpotRate,                             -1,   false},
+{tag::OfferSpotRate,                           -1,   false},
+{tag::BidForwardPoints,                        -1,   false},
+{tag::OfferForwardPoints,                      -1,   false},
+{tag::MidPx,                                   -1,   false},
+{tag::BidYield,                                -1,   false},
+{tag::MidYield,                                -1,   false},
+{tag::OfferYield,                              -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::OrdType,                                 -1,   false},
+{tag::BidForwardPoints2,                       -1,   false},
+{tag::OfferForwardPoints2,                     -1,   false},
+{tag::SettlCurrBidFxRate,                      -1,   false},
+{tag::SettlCurrOfferFxRate,                    -1,   false},
+{tag::SettlCurrFxRateCalc,                     -1,   false},
+{0,                                            0,    false}, // CommissionData
+{tag::CustOrderCapacity,                       -1,   false},
+{tag::ExDestination,                           -1,   false},
+{tag::ExDestinationIDSource,                   -1,   false},
+{tag::BookingType,                             -1,   false},
+{tag::OrderCapacity,                           -1,   false},
+{tag::OrderRestrictions,                       -1,   false},
+{tag::QuoteStatus,                             -1,   false},
+{tag::QuoteRejectReason,                       -1,   false},
+{tag::RejectText,                              -1,   false},
+{tag::EncodedRejectTextLen,                    -1,   false},
+{tag::EncodedRejectText,                       -1,   false},
+{0,                                            208,  false}, // ThrottleResponse
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::StrikeTime,                              -1,   false},
+{tag::QuoteRespID,                             -1,   true},
+{tag::QuoteID,                                 -1,   false},
+{tag::QuoteMsgID,                              -1,   false},
+{tag::QuoteReqID,                              -1,   false},
+{tag::QuoteRespType,                           -1,   true},
+{tag::ClOrdID,                                 -1,   false},
+{tag::OrderCapacity,                           -1,   false},
+{tag::OrderRestrictions,                       -1,   false},
+{tag::IOIID,                                   -1,   false},
+{tag::QuoteType,                               -1,   false},
+{tag::PreTradeAnonymity,                       -1,   false},
+{tag::NoQuoteQualifiers,                       68,   false}, // QuotQualGrp
+{tag::TrdType,                                 -1,   false},
+{tag::RegulatoryTransactionType,               -1,   false},
+{tag::NegotiationMethod,                       -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{0,                                            3,    true}, // Instrument
+{0,                                            2,    false}, // FinancingDetails
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::Side,                                    -1,   false},
+{0,                                            9,    false}, // OrderQtyData
+{tag::MinQty,                                  -1,   false},
+{tag::SettlType,                               -1,   false},
+{tag::SettlDate,                               -1,   false},
+{tag::SettlDate2,                              -1,   false},
+{tag::OrderQty2,                               -1,   false},
+{tag::Currency,                                -1,   false},
+{tag::NoStipulations,                          17,   false}, // Stipulations
+{tag::Account,                                 -1,   false},
+{tag::AcctIDSource,                            -1,   false},
+{tag::AccountType,                             -1,   false},
+{tag::NoLegs,                                  51,   false}, // LegQuotGrp
+{tag::BidPx,                                   -1,   false},
+{tag::OfferPx,                                 -1,   false},
+{tag::MktBidPx,                                -1,   false},
+{tag::MktOfferPx,                              -1,   false},
+{tag::MinBidSize,                              -1,   false},
+{tag::BidSize,                                 -1,   false},
+{tag::MinOfferSize,                            -1,   false},
+{tag::OfferSize,                               -1,   false},
+{tag::ValidUntilTime,                          -1,   false},
+{tag::BidSpotRate,                             -1,   false},
+{tag::OfferSpotRate,                           -1,   false},
+{tag::BidForwardPoints,                        -1,   false},
+{tag::OfferForwardPoints,                      -1,   false},
+{tag::MidPx,                                   -1,   false},
+{tag::BidYield,                                -1,   false},
+{tag::MidYield,                                -1,   false},
+{tag::OfferYield,                              -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::OrdType,                                 -1,   false},
+{tag::BidForwardPoints2,                       -1,   false},
+{tag::OfferForwardPoints2,                     -1,   false},
+{tag::SettlCurrBidFxRate,                      -1,   false},
+{tag::SettlCurrOfferFxRate,                    -1,   false},
+{tag::SettlCurrFxRateCalc,                     -1,   false},
+{0,                                            0,    false}, // CommissionData
+{tag::CustOrderCapacity,                       -1,   false},
+{tag::ExDestination,                           -1,   false},
+{tag::ExDestinationIDSource,                   -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::Price,                                   -1,   false},
+{tag::PriceType,                               -1,   false},
+{tag::NoPriceQualifiers,                       712,  false}, // PriceQualifierGrp
+{tag::CoverPrice,                              -1,   false},
+{0,                                            16,   false}, // SpreadOrBenchmarkCurveData
+{0,                                            20,   false}, // YieldData
+{tag::StrikeTime,                              -1,   false},
+{tag::ConfirmID,                               -1,   true},
+{tag::ConfirmRefID,                            -1,   false},
+{tag::ConfirmReqID,                            -1,   false},
+{tag::ConfirmTransType,                        -1,   true},
+{tag::ConfirmType,                             -1,   true},
+{tag::CopyMsgIndicator,                        -1,   false},
+{tag::LegalConfirm,                            -1,   false},
+{tag::ConfirmStatus,                           -1,   true},
+{tag::AffirmStatus,                            -1,   false},
+{tag::TradeConfirmationReferenceID,            -1,   false},
+{tag::ClearedIndicator,                        -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::NoOrders,                                60,   false}, // OrdAllocGrp
+{tag::NoExecs,                                 39,   false}, // ExecAllocGrp
+{tag::AllocID,                                 -1,   false},
+{tag::SecondaryAllocID,                        -1,   false},
+{tag::IndividualAllocID,                       -1,   false},
+{tag::TrdType,                                 -1,   false},
+{tag::TrdSubType,                              -1,   false},
+{tag::SecondaryTrdType,                        -1,   false},
+{tag::TradeContinuation,                       -1,   false},
+{tag::MatchType,                               -1,   false},
+{tag::TransactTime,                            -1,   true},
+{tag::TradeDate,                               -1,   true},
+{tag::NoTrdRegTimestamps,                      18,   false}, // TrdRegTimestamps
+{0,                                            3,    true}, // Instrument
+{0,                                            4,    false}, // InstrumentExtension
+{0,                                            2,    false}, // FinancingDetails
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{0,                                            20,   false}, // YieldData
+{tag::AllocQty,                                -1,   true},
+{tag::QtyType,                                 -1,   false},
+{tag::Side,                                    -1,   true},
+{tag::Currency,                                -1,   false},
+{tag::LastMkt,                                 -1,   false},
+{tag::NoCapacities,                            38,   true}, // CpctyConfGrp
+{tag::AllocAccount,                            -1,   true},
+{tag::AllocAcctIDSource,                       -1,   false},
+{tag::AllocAccountType,                        -1,   false},
+{tag::AvgPx,                                   -1,   true},
+{tag::AvgPxPrecision,                          -1,   false},
+{tag::PriceType,                               -1,   false},
+{tag::NoPriceQualifiers,                       712,  false}, // PriceQualifierGrp
+{tag::AvgParPx,                                -1,   false},
+{0,                                            16,   false}, // SpreadOrBenchmarkCurveData
+{tag::ReportedPx,                              -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::ProcessCode,                             -1,   false},
+{tag::GrossTradeAmt,                           -1,   true},
+{tag::NumDaysInterest,                         -1,   false},
+{tag::ExDate,                                  -1,   false},
+{tag::AccruedInterestRate,                     -1,   false},
+{tag::AccruedInterestAmt,                      -1,   false},
+{tag::InterestAtMaturity,                      -1,   false},
+{tag::EndAccruedInterestAmt,                   -1,   false},
+{tag::StartCash,                               -1,   false},
+{tag::EndCash,                                 -1,   false},
+{tag::Concession,                              -1,   false},
+{tag::TotalTakedown,                           -1,   false},
+{tag::NetMoney,                                -1,   true},
+{tag::MaturityNetMoney,                        -1,   false},
+{tag::SettlCurrAmt,                            -1,   false},
+{tag::SettlCurrency,                           -1,   false},
+{tag::SettlCurrFxRate,                         -1,   false},
+{tag::SettlCurrFxRateCalc,                     -1,   false},
+{tag::SettlType,                               -1,   false},
+{tag::SettlDate,                               -1,   false},
+{0,                                            14,   false}, // SettlInstructionsData
+{0,                                            0,    false}, // CommissionData
+{tag::SharedCommission,                        -1,   false},
+{tag::NoCommissions,                           594,  false}, // CommissionDataGrp
+{tag::NoStipulations,                          17,   false}, // Stipulations
+{tag::NoMiscFees,                              59,   false}, // MiscFeesGrp
+{tag::PosReqID,                                -1,   false},
+{tag::PosTransType,                            -1,   true},
+{tag::PosMaintAction,                          -1,   true},
+{tag::OrigPosReqRefID,                         -1,   false},
+{tag::PosMaintRptRefID,                        -1,   false},
+{tag::ClearingBusinessDate,                    -1,   true},
+{tag::SettlDate,                               -1,   false},
+{tag::SettlSessID,                             -1,   false},
+{tag::SettlSessSubID,                          -1,   false},
+{tag::NoPartyIDs,                              10,   true}, // Parties
+{tag::Account,                                 -1,   false},
+{tag::AcctIDSource,                            -1,   false},
+{tag::AccountType,                             -1,   false},
+{0,                                            3,    true}, // Instrument
+{tag::Currency,                                -1,   false},
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::NoRelatedInstruments,                    180,  false}, // RelatedInstrumentGrp
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoTradingSessions,                       88,   false}, // TrdgSesGrp
+{tag::TransactTime,                            -1,   false},
+{tag::NoPositions,                             13,   true}, // PositionQty
+{tag::NoPosAmt,                                12,   false}, // PositionAmountData
+{tag::AdjustmentType,                          -1,   false},
+{tag::ContraryInstructionIndicator,            -1,   false},
+{tag::PriorSpreadIndicator,                    -1,   false},
+{tag::ThresholdAmount,                         -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::SettlCurrency,                           -1,   false},
+{tag::PosMaintRptID,                           -1,   true},
+{tag::PosTransType,                            -1,   true},
+{tag::PositionID,                              -1,   false},
+{tag::PosReqID,                                -1,   false},
+{tag::PosMaintAction,                          -1,   true},
+{tag::OrigPosReqRefID,                         -1,   false},
+{tag::PosMaintStatus,                          -1,   false},
+{tag::PosMaintResult,                          -1,   false},
+{tag::ClearingBusinessDate,                    -1,   true},
+{tag::PreviousClearingBusinessDate,            -1,   false},
+{tag::ValuationDate,                           -1,   false},
+{tag::ValuationTime,                           -1,   false},
+{tag::ValuationBusinessCenter,                 -1,   false},
+{tag::DiscountFactor,                          -1,   false},
+{tag::RejectText,                              -1,   false},
+{tag::EncodedRejectTextLen,                    -1,   false},
+{tag::EncodedRejectText,                       -1,   false},
+{tag::SettlSessID,                             -1,   false},
+{tag::SettlSessSubID,                          -1,   false},
+{tag::ClearedIndicator,                        -1,   false},
+{tag::ContractRefPosType,                      -1,   false},
+{tag::PositionCapacity,                        -1,   false},
+{tag::TerminatedIndicator,                     -1,   false},
+{tag::InputSource,                             -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::Account,                                 -1,   false},
+{tag::AcctIDSource,                            -1,   false},
+{tag::AccountType,                             -1,   false},
+{tag::PosMaintRptRefID,                        -1,   false},
+{0,                                            3,    true}, // Instrument
+{tag::Currency,                                -1,   false},
+{tag::SettlDate,                               -1,   false},
+{tag::SettlCurrency,                           -1,   false},
+{tag::ContraryInstructionIndicator,            -1,   false},
+{tag::PriorSpreadIndicator,                    -1,   false},
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::NoRelatedInstruments,                    180,  false}, // RelatedInstrumentGrp
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoTradingSessions,                       88,   false}, // TrdgSesGrp
+{tag::TransactTime,                            -1,   false},
+{tag::NoPositions,                             13,   false}, // PositionQty
+{tag::NoPosAmt,                                12,   false}, // PositionAmountData
+{tag::NoRegulatoryTradeIDs,                    306,  false}, // RegulatoryTradeIDGrp
+{tag::NoPayments,                              276,  false}, // PaymentGrp
+{tag::AdjustmentType,                          -1,   false},
+{tag::ThresholdAmount,                         -1,   false},
+{tag::NoRelatedTrades,                         228,  false}, // RelatedTradeGrp
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::PosReqID,                                -1,   true},
+{tag::PosReqType,                              -1,   true},
+{tag::MatchStatus,                             -1,   false},
+{tag::SubscriptionRequestType,                 -1,   false},
+{tag::SettlCurrency,                           -1,   false},
+{tag::NoPartyIDs,                              10,   true}, // Parties
+{tag::Account,                                 -1,   false},
+{tag::AcctIDSource,                            -1,   false},
+{tag::AccountType,                             -1,   false},
+{0,                                            3,    false}, // Instrument
+{tag::Currency,                                -1,   false},
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::ClearingBusinessDate,                    -1,   true},
+{tag::SettlDate,                               -1,   false},
+{tag::SettlSessID,                             -1,   false},
+{tag::SettlSessSubID,                          -1,   false},
+{tag::NoTradingSessions,                       88,   false}, // TrdgSesGrp
+{tag::TransactTime,                            -1,   true},
+{tag::ResponseTransportType,                   -1,   false},
+{tag::ResponseDestination,                     -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::PosMaintRptID,                           -1,   true},
+{tag::PosReqID,                                -1,   false},
+{tag::TotalNumPosReports,                      -1,   false},
+{tag::TotNumReports,                           -1,   false},
+{tag::UnsolicitedIndicator,                    -1,   false},
+{tag::PosReqResult,                            -1,   true},
+{tag::PosReqStatus,                            -1,   true},
+{tag::PosReqType,                              -1,   false},
+{tag::MatchStatus,                             -1,   false},
+{tag::ClearingBusinessDate,                    -1,   false},
+{tag::SubscriptionRequestType,                 -1,   false},
+{tag::SettlSessID,                             -1,   false},
+{tag::SettlSessSubID,                          -1,   false},
+{tag::SettlCurrency,                           -1,   false},
+{tag::NoPartyIDs,                              10,   true}, // Parties
+{tag::Account,                                 -1,   false},
+{tag::AcctIDSource,                            -1,   false},
+{tag::AccountType,                             -1,   false},
+{0,                                            3,    false}, // Instrument
+{tag::Currency,                                -1,   false},
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::ResponseTransportType,                   -1,   false},
+{tag::ResponseDestination,                     -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::PosMaintRptID,                           -1,   true},
+{tag::PositionID,                              -1,   false},
+{tag::PosReqID,                                -1,   false},
+{tag::PosReqType,                              -1,   false},
+{tag::PosReportAction,                         -1,   false},
+{tag::MarginReqmtInqID,                        -1,   false},
+{tag::SubscriptionRequestType,                 -1,   false},
+{tag::TotalNumPosReports,                      -1,   false},
+{tag::TotNumReports,                           -1,   false},
+{tag::LastRptRequested,                        -1,   false},
+{tag::PosReqResult,                            -1,   false},
+{tag::UnsolicitedIndicator,                    -1,   false},
+{tag::ClearingBusinessDate,                    -1,   true},
+{tag::PreviousClearingBusinessDate,            -1,   false},
+{tag::SettlSessID,                             -1,   false},
+{tag::SettlSessSubID,                          -1,   false},
+{tag::PriceType,                               -1,   false},
+{tag::SettlCurrency,                           -1,   false},
+{tag::MessageEventSource,                      -1,   false},
+{tag::ClearedIndicator,                        -1,   false},
+{tag::ContractRefPosType,                      -1,   false},
+{tag::PositionCapacity,                        -1,   false},
+{tag::TerminatedIndicator,                     -1,   false},
+{tag::IntraFirmTradeIndicator,                 -1,   false},
+{tag::TradeContinuation,                       -1,   false},
+{tag::TradeContinuationText,                   -1,   false},
+{tag::EncodedTradeContinuationTextLen,         -1,   false},
+{tag::EncodedTradeContinuationText,            -1,   false},
+{tag::TradeCollateralization,                  -1,   false},
+{tag::NoPartyIDs,                              10,   true}, // Parties
+{tag::Account,                                 -1,   false},
+{tag::AcctIDSource,                            -1,   false},
+{tag::AccountType,                             -1,   false},
+{tag::TaxonomyType,                            -1,   false},
+{0,                                            3,    false}, // Instrument
+{0,                                            2,    false}, // FinancingDetails
+{tag::Currency,                                -1,   false},
+{tag::SettlDate,                               -1,   false},
+{tag::SettlPrice,                              -1,   false},
+{tag::SettlPriceFxRateCalc,                    -1,   false},
+{tag::SettlForwardPoints,                      -1,   false},
+{tag::SettlPriceUnitOfMeasure,                 -1,   false},
+{tag::SettlPriceUnitOfMeasureCurrency,         -1,   false},
+{tag::SettlPriceType,                          -1,   false},
+{tag::PriorSettlPrice,                         -1,   false},
+{tag::PositionContingentPrice,                 -1,   false},
+{tag::DiscountFactor,                          -1,   false},
+{tag::ValuationDate,                           -1,   false},
+{tag::ValuationTime,                           -1,   false},
+{tag::ValuationBusinessCenter,                 -1,   false},
+{tag::MatchStatus,                             -1,   false},
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::NoRelatedInstruments,                    180,  false}, // RelatedInstrumentGrp
+{tag::NoCollateralAmounts,                     210,  false}, // CollateralAmountGrp
+{tag::NoUnderlyings,                           62,   false}, // PosUndInstrmtGrp
+{tag::TransactTime,                            -1,   false},
+{tag::NoPositions,                             13,   false}, // PositionQty
+{tag::NoPosAmt,                                12,   false}, // PositionAmountData
+{tag::NoRegulatoryTradeIDs,                    306,  false}, // RegulatoryTradeIDGrp
+{tag::NoPayments,                              276,  false}, // PaymentGrp
+{tag::RegistStatus,                            -1,   false},
+{tag::DeliveryDate,                            -1,   false},
+{tag::ModelType,                               -1,   false},
+{tag::PriceDelta,                              -1,   false},
+{tag::NoRelatedTrades,                         228,  false}, // RelatedTradeGrp
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::TradeRequestID,                          -1,   true},
+{tag::TradeID,                                 -1,   false},
+{tag::SecondaryTradeID,                        -1,   false},
+{tag::FirmTradeID,                             -1,   false},
+{tag::SecondaryFirmTradeID,                    -1,   false},
+{tag::TradeRequestType,                        -1,   true},
+{tag::SubscriptionRequestType,                 -1,   false},
+{tag::TotNumTradeReports,                      -1,   false},
+{tag::TradeRequestResult,                      -1,   true},
+{tag::TradeRequestStatus,                      -1,   true},
+{0,                                            3,    false}, // Instrument
+{0,                                            4,    false}, // InstrumentExtension
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::MultiLegReportingType,                   -1,   false},
+{tag::ResponseTransportType,                   -1,   false},
+{tag::ResponseDestination,                     -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::MessageEventSource,                      -1,   false},
+{tag::TradeReportID,                           -1,   false},
+{tag::TradeID,                                 -1,   false},
+{tag::SecondaryTradeID,                        -1,   false},
+{tag::FirmTradeID,                             -1,   false},
+{tag::SecondaryFirmTradeID,                    -1,   false},
+{tag::TradeReportTransType,                    -1,   false},
+{tag::TradeReportType,                         -1,   false},
+{tag::TrdType,                                 -1,   false},
+{tag::TrdSubType,                              -1,   false},
+{tag::SecondaryTrdType,                        -1,   false},
+{tag::OffsetInstruction,                       -1,   false},
+{tag::TradeHandlingInstr,                      -1,   false},
+{tag::OrigTradeHandlingInstr,                  -1,   false},
+{tag::OrigTradeDate,                           -1,   false},
+{tag::OrigTradeID,                             -1,   false},
+{tag::OrigSecondaryTradeID,                    -1,   false},
+{tag::TransferReason,                          -1,   false},
+{tag::NoRootPartyIDs,                          117,  false}, // RootParties
+{tag::ExecType,                                -1,   false},
+{tag::TradeReportRefID,                        -1,   false},
+{tag::SecondaryTradeReportRefID,               -1,   false},
+{tag::TrdRptStatus,                            -1,   false},
+{tag::TrdAckStatus,                            -1,   false},
+{tag::TradeReportRejectReason,                 -1,   false},
+{tag::RejectText,                              -1,   false},
+{tag::EncodedRejectTextLen,                    -1,   false},
+{tag::EncodedRejectText,                       -1,   false},
+{tag::SecondaryTradeReportID,                  -1,   false},
+{tag::SubscriptionRequestType,                 -1,   false},
+{tag::TradeLinkID,                             -1,   false},
+{tag::TrdMatchID,                              -1,   false},
+{tag::ExecID,                                  -1,   false},
+{tag::SecondaryExecID,                         -1,   false},
+{tag::ExecRestatementReason,                   -1,   false},
+{tag::PreviouslyReported,                      -1,   false},
+{tag::PriceType,                               -1,   false},
+{tag::NoPriceQualifiers,                       712,  false}, // PriceQualifierGrp
+{tag::CrossType,                               -1,   false},
+{tag::UnderlyingTradingSessionID,              -1,   false},
+{tag::UnderlyingTradingSessionSubID,           -1,   false},
+{tag::SettlSessID,                             -1,   false},
+{tag::SettlSessSubID,                          -1,   false},
+{tag::QtyType,                                 -1,   false},
+{tag::LastQty,                                 -1,   false},
+{tag::LastPx,                                  -1,   false},
+{tag::VenueType,                               -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::MarketID,                                -1,   false},
+{0,                                            3,    true}, // Instrument
+{0,                                            4,    false}, // InstrumentExtension
+{0,                                            2,    false}, // FinancingDetails
+{tag::LastParPx,                               -1,   false},
+{tag::CalculatedCcyLastQty,                    -1,   false},
+{tag::LastSwapPoints,                          -1,   false},
+{tag::PriceMarkup,                             -1,   false},
+{0,                                            716,  false}, // AveragePriceDetail
+{tag::Currency,                                -1,   false},
+{tag::SettlCurrency,                           -1,   false},
+{tag::LastSpotRate,                            -1,   false},
+{tag::LastForwardPoints,                       -1,   false},
+{tag::LastMkt,                                 -1,   false},
+{tag::TradeDate,                               -1,   false},
+{tag::ClearingBusinessDate,                    -1,   false},
+{tag::AvgPx,                                   -1,   false},
+{tag::AvgPxGroupID,                            -1,   false},
+{tag::AvgPxIndicator,                          -1,   false},
+{tag::MultiLegReportingType,                   -1,   false},
+{tag::TradeLegRefID,                           -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::SettlType,                               -1,   false},
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::MatchStatus,                             -1,   false},
+{tag::MatchType,                               -1,   false},
+{tag::CopyMsgIndicator,                        -1,   false},
+{tag::NoTrdRepIndicators,                      158,  false}, // TrdRepIndicatorsGrp
+{tag::PublishTrdIndicator,                     -1,   false},
+{tag::TradePublishIndicator,                   -1,   false},
+{tag::ShortSaleReason,                         -1,   false},
+{tag::NoLegs,                                  87,   false}, // TrdInstrmtLegGrp
+{tag::NoTrdRegTimestamps,                      18,   false}, // TrdRegTimestamps
+{tag::ResponseTransportType,                   -1,   false},
+{tag::ResponseDestination,                     -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::AsOfIndicator,                           -1,   false},
+{tag::ClearingFeeIndicator,                    -1,   false},
+{tag::NoPosAmt,                                12,   false}, // PositionAmountData
+{tag::TierCode,                                -1,   false},
+{tag::MessageEventSource,                      -1,   false},
+{tag::LastUpdateTime,                          -1,   false},
+{tag::RndPx,                                   -1,   false},
+{tag::NoTradeQtys,                             226,  false}, // TradeQtyGrp
+{tag::NoSides,                                 112,  false}, // TrdCapRptAckSideGrp
+{tag::RptSys,                                  -1,   false},
+{tag::GrossTradeAmt,                           -1,   false},
+{tag::SettlDate,                               -1,   false},
+{tag::FeeMultiplier,                           -1,   false},
+{tag::RiskLimitCheckStatus,                    -1,   false},
+{tag::AllocReportID,                           -1,   true},
+{tag::AllocID,                                 -1,   false},
+{tag::AllocTransType,                          -1,   true},
+{tag::AllocReportRefID,                        -1,   false},
+{tag::AllocCancReplaceReason,                  -1,   false},
+{tag::SecondaryAllocID,                        -1,   false},
+{tag::AllocGroupID,                            -1,   false},
+{tag::FirmGroupID,                             -1,   false},
+{tag::AllocReportType,                         -1,   true},
+{tag::AllocStatus,                             -1,   true},
+{tag::AllocRejCode,                            -1,   false},
+{tag::RefAllocID,                              -1,   false},
+{tag::AllocReversalStatus,                     -1,   false},
+{tag::AllocIntermedReqType,                    -1,   false},
+{tag::AllocLinkID,                             -1,   false},
+{tag::AllocLinkType,                           -1,   false},
+{tag::BookingRefID,                            -1,   false},
+{tag::ClearingBusinessDate,                    -1,   false},
+{tag::TrdType,                                 -1,   false},
+{tag::TrdSubType,                              -1,   false},
+{tag::SecondaryTrdType,                        -1,   false},
+{tag::TradeContinuation,                       -1,   false},
+{tag::MultiLegReportingType,                   -1,   false},
+{tag::CustOrderCapacity,                       -1,   false},
+{tag::TradeInputSource,                        -1,   false},
+{tag::RndPx,                                   -1,   false},
+{tag::MessageEventSource,                      -1,   false},
+{tag::TradeInputDevice,                        -1,   false},
+{tag::AvgPxIndicator,                          -1,   false},
+{tag::AvgPxGroupID,                            -1,   false},
+{tag::AllocNoOrdersType,                       -1,   false},
+{tag::NoOrders,                                60,   false}, // OrdAllocGrp
+{tag::NoExecs,                                 39,   false}, // ExecAllocGrp
+{tag::PreviouslyReported,                      -1,   false},
+{tag::ReversalIndicator,                       -1,   false},
+{tag::MatchType,                               -1,   false},
+{tag::Side,                                    -1,   true},
+{0,                                            3,    true}, // Instrument
+{0,                                            4,    false}, // InstrumentExtension
+{0,                                            2,    false}, // FinancingDetails
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::Quantity,                                -1,   true},
+{tag::QtyType,                                 -1,   false},
+{tag::AllocGroupQuantity,                      -1,   false},
+{tag::AllocGroupRemainingQuantity,             -1,   false},
+{tag::LastMkt,                                 -1,   false},
+{tag::TradeOriginationDate,                    -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::PriceType,                               -1,   false},
+{tag::NoPriceQualifiers,                       712,  false}, // PriceQualifierGrp
+{tag::AvgPx,                                   -1,   true},
+{tag::AvgParPx,                                -1,   false},
+{0,                                            16,   false}, // SpreadOrBenchmarkCurveData
+{tag::Currency,                                -1,   false},
+{tag::AvgPxPrecision,                          -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::TradeDate,                               -1,   true},
+{tag::TransactTime,                            -1,   false},
+{tag::SettlType,                               -1,   false},
+{tag::SettlDate,                               -1,   false},
+{tag::BookingType,                             -1,   false},
+{tag::GrossTradeAmt,                           -1,   false},
+{tag::Concession,                              -1,   false},
+{tag::TotalTakedown,                           -1,   false},
+{tag::NetMoney,                                -1,   false},
+{tag::PositionEffect,                          -1,   false},
+{tag::AutoAcceptIndicator,                     -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::NumDaysInterest,                         -1,   false},
+{tag::AccruedInterestRate,                     -1,   false},
+{tag::AccruedInterestAmt,                      -1,   false},
+{tag::TotalAccruedInterestAmt,                 -1,   false},
+{tag::InterestAtMaturity,                      -1,   false},
+{tag::EndAccruedInterestAmt,                   -1,   false},
+{tag::StartCash,                               -1,   false},
+{tag::EndCash,                                 -1,   false},
+{tag::LegalConfirm,                            -1,   false},
+{tag::NoStipulations,                          17,   false}, // Stipulations
+{0,                                            20,   false}, // YieldData
+{tag::NoRegulatoryTradeIDs,                    306,  false}, // RegulatoryTradeIDGrp
+{tag::NoPosAmt,                                12,   false}, // PositionAmountData
+{tag::CustOrderHandlingInst,                   -1,   false},
+{tag::OrderHandlingInstSource,                 -1,   false},
+{tag::TotNoAllocs,                             -1,   false},
+{tag::LastFragment,                            -1,   false},
+{tag::NoAllocs,                                28,   false}, // AllocGrp
+{tag::NoRateSources,                           166,  false}, // RateSource
+{tag::VenueType,                               -1,   false},
+{tag::RefRiskLimitCheckID,                     -1,   false},
+{tag::RefRiskLimitCheckIDType,                 -1,   false},
+{tag::RiskLimitCheckStatus,                    -1,   false},
+{tag::AllocReportID,                           -1,   true},
+{tag::AllocID,                                 -1,   false},
+{tag::ClearingBusinessDate,                    -1,   false},
+{tag::AvgPxIndicator,                          -1,   false},
+{tag::Quantity,                                -1,   false},
+{tag::AllocTransType,                          -1,   false},
+{0,                                            3,    false}, // Instrument
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::SecondaryAllocID,                        -1,   false},
+{tag::AllocGroupID,                            -1,   false},
+{tag::FirmGroupID,                             -1,   false},
+{tag::AvgPxGroupID,                            -1,   false},
+{tag::TradeDate,                               -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::AllocStatus,                             -1,   false},
+{tag::AllocRejCode,                            -1,   false},
+{tag::AllocReportType,                         -1,   false},
+{tag::AllocIntermedReqType,                    -1,   false},
+{tag::MatchStatus,                             -1,   false},
+{tag::CustOrderHandlingInst,                   -1,   false},
+{tag::OrderHandlingInstSource,                 -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::RejectText,                              -1,   false},
+{tag::EncodedRejectTextLen,                    -1,   false},
+{tag::EncodedRejectText,                       -1,   false},
+{tag::NoRegulatoryTradeIDs,                    306,  false}, // RegulatoryTradeIDGrp
+{tag::NoAllocs,                                27,   false}, // AllocAckGrp
+{tag::ConfirmID,                               -1,   true},
+{tag::TradeDate,                               -1,   true},
+{tag::TransactTime,                            -1,   true},
+{tag::AffirmStatus,                            -1,   true},
+{tag::TradeConfirmationReferenceID,            -1,   false},
+{tag::ConfirmRejReason,                        -1,   false},
+{tag::MatchStatus,                             -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::SettlInstReqID,                          -1,   true},
+{tag::TransactTime,                            -1,   true},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::AllocAccount,                            -1,   false},
+{tag::AllocAcctIDSource,                       -1,   false},
+{tag::Side,                                    -1,   false},
+{tag::Product,                                 -1,   false},
+{tag::SecurityType,                            -1,   false},
+{tag::CFICode,                                 -1,   false},
+{tag::SettlCurrency,                           -1,   false},
+{tag::EffectiveTime,                           -1,   false},
+{tag::ExpireTime,                              -1,   false},
+{tag::LastUpdateTime,                          -1,   false},
+{tag::StandInstDbType,                         -1,   false},
+{tag::StandInstDbName,                         -1,   false},
+{tag::StandInstDbID,                           -1,   false},
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::AsgnRptID,                               -1,   true},
+{tag::PosReqID,                                -1,   false},
+{tag::TotNumAssignmentReports,                 -1,   false},
+{tag::LastRptRequested,                        -1,   false},
+{tag::NoPartyIDs,                              10,   true}, // Parties
+{tag::Account,                                 -1,   false},
+{tag::AccountType,                             -1,   false},
+{0,                                            3,    false}, // Instrument
+{tag::Currency,                                -1,   false},
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoPositions,                             13,   false}, // PositionQty
+{tag::NoPosAmt,                                12,   false}, // PositionAmountData
+{tag::ThresholdAmount,                         -1,   false},
+{tag::SettlPrice,                              -1,   false},
+{tag::SettlPriceType,                          -1,   false},
+{tag::UnderlyingSettlPrice,                    -1,   false},
+{tag::PriorSettlPrice,                         -1,   false},
+{tag::PositionContingentPrice,                 -1,   false},
+{tag::ExpireDate,                              -1,   false},
+{tag::AssignmentMethod,                        -1,   false},
+{tag::AssignmentUnit,                          -1,   false},
+{tag::OpenInterest,                            -1,   false},
+{tag::ExerciseMethod,                          -1,   false},
+{tag::SettlSessID,                             -1,   false},
+{tag::SettlSessSubID,                          -1,   false},
+{tag::ClearingBusinessDate,                    -1,   true},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::CollReqID,                               -1,   true},
+{tag::CollAsgnReason,                          -1,   true},
+{tag::TransactTime,                            -1,   true},
+{tag::ExpireTime,                              -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::Account,                                 -1,   false},
+{tag::AccountType,                             -1,   false},
+{tag::ClOrdID,                                 -1,   false},
+{tag::OrderID,                                 -1,   false},
+{tag::SecondaryOrderID,                        -1,   false},
+{tag::SecondaryClOrdID,                        -1,   false},
+{tag::NoExecs,                                 40,   false}, // ExecCollGrp
+{tag::NoTrades,                                86,   false}, // TrdCollGrp
+{0,                                            3,    false}, // Instrument
+{0,                                            2,    false}, // FinancingDetails
+{tag::SettlDate,                               -1,   false},
+{tag::Quantity,                                -1,   false},
+{tag::QtyType,                                 -1,   false},
+{tag::Currency,                                -1,   false},
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::NoUnderlyings,                           89,   false}, // UndInstrmtCollGrp
+{tag::MarginExcess,                            -1,   false},
+{tag::TotalNetValue,                           -1,   false},
+{tag::CashOutstanding,                         -1,   false},
+{tag::NoTrdRegTimestamps,                      18,   false}, // TrdRegTimestamps
+{tag::Side,                                    -1,   false},
+{tag::NoMiscFees,                              59,   false}, // MiscFeesGrp
+{tag::Price,                                   -1,   false},
+{tag::PriceType,                               -1,   false},
+{tag::AccruedInterestAmt,                      -1,   false},
+{tag::EndAccruedInterestAmt,                   -1,   false},
+{tag::StartCash,                               -1,   false},
+{tag::EndCash,                                 -1,   false},
+{0,                                            16,   false}, // SpreadOrBenchmarkCurveData
+{tag::NoStipulations,                          17,   false}, // Stipulations
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::SettlSessID,                             -1,   false},
+{tag::SettlSessSubID,                          -1,   false},
+{tag::ClearingBusinessDate,                    -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::CollAsgnID,                              -1,   true},
+{tag::CollReqID,                               -1,   false},
+{tag::CollAsgnReason,                          -1,   true},
+{tag::CollAsgnTransType,                       -1,   true},
+{tag::CollAsgnRefID,                           -1,   false},
+{tag::TransactTime,                            -1,   true},
+{tag::ExpireTime,                              -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::Account,                                 -1,   false},
+{tag::AccountType,                             -1,   false},
+{tag::ClOrdID,                                 -1,   false},
+{tag::OrderID,                                 -1,   false},
+{tag::SecondaryOrderID,                        -1,   false},
+{tag::SecondaryClOrdID,                        -1,   false},
+{tag::NoExecs,                                 40,   false}, // ExecCollGrp
+{tag::NoTrades,                                86,   false}, // TrdCollGrp
+{0,                                            3,    false}, // Instrument
+{0,                                            2,    false}, // FinancingDetails
+{tag::SettlDate,                               -1,   false},
+{tag::Quantity,                                -1,   false},
+{tag::QtyType,                                 -1,   false},
+{tag::Currency,                                -1,   false},
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::NoUnderlyings,                           89,   false}, // UndInstrmtCollGrp
+{tag::MarginExcess,                            -1,   false},
+{tag::TotalNetValue,                           -1,   false},
+{tag::CashOutstanding,                         -1,   false},
+{tag::NoTrdRegTimestamps,                      18,   false}, // TrdRegTimestamps
+{tag::Side,                                    -1,   false},
+{tag::NoMiscFees,                              59,   false}, // MiscFeesGrp
+{tag::Price,                                   -1,   false},
+{tag::PriceType,                               -1,   false},
+{tag::AccruedInterestAmt,                      -1,   false},
+{tag::EndAccruedInterestAmt,                   -1,   false},
+{tag::StartCash,                               -1,   false},
+{tag::EndCash,                                 -1,   false},
+{0,                                            16,   false}, // SpreadOrBenchmarkCurveData
+{tag::NoStipulations,                          17,   false}, // Stipulations
+{0,                                            14,   false}, // SettlInstructionsData
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::SettlSessID,                             -1,   false},
+{tag::SettlSessSubID,                          -1,   false},
+{tag::WireReference,                           -1,   false},
+{tag::TradeDate,                               -1,   false},
+{tag::TransactionID,                           -1,   false},
+{tag::FirmTransactionID,                       -1,   false},
+{tag::ClearingBusinessDate,                    -1,   false},
+{tag::CollateralRequestLinkID,                 -1,   false},
+{tag::TotNumCollateralRequests,                -1,   false},
+{tag::CollateralRequestNumber,                 -1,   false},
+{tag::CollateralRequestInstruction,            -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::CollRespID,                              -1,   true},
+{tag::CollAsgnID,                              -1,   false},
+{tag::CollReqID,                               -1,   false},
+{tag::CollAsgnReason,                          -1,   false},
+{tag::CollAsgnTransType,                       -1,   false},
+{tag::CollAsgnRespType,                        -1,   true},
+{tag::CollAsgnRejectReason,                    -1,   false},
+{tag::TransactTime,                            -1,   true},
+{tag::CollApplType,                            -1,   false},
+{tag::FinancialStatus,                         -1,   false},
+{tag::ClearingBusinessDate,                    -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::Account,                                 -1,   false},
+{tag::AccountType,                             -1,   false},
+{tag::ClOrdID,                                 -1,   false},
+{tag::OrderID,                                 -1,   false},
+{tag::SecondaryOrderID,                        -1,   false},
+{tag::SecondaryClOrdID,                        -1,   false},
+{tag::NoExecs,                                 40,   false}, // ExecCollGrp
+{tag::NoTrades,                                86,   false}, // TrdCollGrp
+{0,                                            3,    false}, // Instrument
+{0,                                            2,    false}, // FinancingDetails
+{tag::SettlDate,                               -1,   false},
+{tag::Quantity,                                -1,   false},
+{tag::QtyType,                                 -1,   false},
+{tag::Currency,                                -1,   false},
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::NoUnderlyings,                           89,   false}, // UndInstrmtCollGrp
+{tag::MarginExcess,                            -1,   false},
+{tag::TotalNetValue,                           -1,   false},
+{tag::CashOutstanding,                         -1,   false},
+{tag::NoCollateralAmounts,                     210,  false}, // CollateralAmountGrp
+{tag::NoTrdRegTimestamps,                      18,   false}, // TrdRegTimestamps
+{tag::Side,                                    -1,   false},
+{tag::NoMiscFees,                              59,   false}, // MiscFeesGrp
+{tag::Price,                                   -1,   false},
+{tag::PriceType,                               -1,   false},
+{tag::AccruedInterestAmt,                      -1,   false},
+{tag::EndAccruedInterestAmt,                   -1,   false},
+{tag::StartCash,                               -1,   false},
+{tag::EndCash,                                 -1,   false},
+{0,                                            16,   false}, // SpreadOrBenchmarkCurveData
+{tag::NoStipulations,                          17,   false}, // Stipulations
+{tag::WireReference,                           -1,   false},
+{tag::TradeDate,                               -1,   false},
+{tag::TransactionID,                           -1,   false},
+{tag::FirmTransactionID,                       -1,   false},
+{tag::CollateralRequestLinkID,                 -1,   false},
+{tag::TotNumCollateralRequests,                -1,   false},
+{tag::CollateralRequestNumber,                 -1,   false},
+{tag::CollateralRequestInstruction,            -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::WarningText,                             -1,   false},
+{tag::EncodedWarningTextLen,                   -1,   false},
+{tag::EncodedWarningText,                      -1,   false},
+{tag::RejectText,                              -1,   false},
+{tag::EncodedRejectTextLen,                    -1,   false},
+{tag::EncodedRejectText,                       -1,   false},
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::NewsID,                                  -1,   false},
+{tag::NoNewsRefIDs,                            168,  false}, // NewsRefGrp
+{tag::NewsCategory,                            -1,   false},
+{tag::LanguageCode,                            -1,   false},
+{tag::OrigTime,                                -1,   false},
+{tag::Urgency,                                 -1,   false},
+{tag::Headline,                                -1,   true},
+{tag::EncodedHeadlineLen,                      -1,   false},
+{tag::EncodedHeadline,                         -1,   false},
+{tag::NoRoutingIDs,                            78,   false}, // RoutingGrp
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::NoRelatedSym,                            41,   false}, // InstrmtGrp
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoLinesOfText,                           53,   true}, // LinesOfTextGrp
+{tag::URLLink,                                 -1,   false},
+{tag::RawDataLength,                           -1,   false},
+{tag::RawData,                                 -1,   false},
+{tag::CollRptID,                               -1,   true},
+{tag::CollInquiryID,                           -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::CollApplType,                            -1,   false},
+{tag::FinancialStatus,                         -1,   false},
+{tag::CollStatus,                              -1,   true},
+{tag::TotNumReports,                           -1,   false},
+{tag::LastRptRequested,                        -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::Account,                                 -1,   false},
+{tag::AccountType,                             -1,   false},
+{tag::ClOrdID,                                 -1,   false},
+{tag::OrderID,                                 -1,   false},
+{tag::SecondaryOrderID,                        -1,   false},
+{tag::SecondaryClOrdID,                        -1,   false},
+{tag::NoExecs,                                 40,   false}, // ExecCollGrp
+{tag::NoTrades,                                86,   false}, // TrdCollGrp
+{0,                                            3,    false}, // Instrument
+{0,                                            2,    false}, // FinancingDetails
+{tag::SettlDate,                               -1,   false},
+{tag::Quantity,                                -1,   false},
+{tag::QtyType,                                 -1,   false},
+{tag::Currency,                                -1,   false},
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::MarginExcess,                            -1,   false},
+{tag::TotalNetValue,                           -1,   false},
+{tag::CashOutstanding,                         -1,   false},
+{tag::NoCollateralAmounts,                     210,  false}, // CollateralAmountGrp
+{tag::NoRegulatoryTradeIDs,                    306,  false}, // RegulatoryTradeIDGrp
+{tag::NoTrdRegTimestamps,                      18,   false}, // TrdRegTimestamps
+{tag::Side,                                    -1,   false},
+{tag::NoMiscFees,                              59,   false}, // MiscFeesGrp
+{tag::Price,                                   -1,   false},
+{tag::PriceType,                               -1,   false},
+{tag::AccruedInterestAmt,                      -1,   false},
+{tag::EndAccruedInterestAmt,                   -1,   false},
+{tag::StartCash,                               -1,   false},
+{tag::EndCash,                                 -1,   false},
+{0,                                            16,   false}, // SpreadOrBenchmarkCurveData
+{tag::NoStipulations,                          17,   false}, // Stipulations
+{0,                                            14,   false}, // SettlInstructionsData
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::SettlSessID,                             -1,   false},
+{tag::SettlSessSubID,                          -1,   false},
+{tag::ClearingBusinessDate,                    -1,   false},
+{tag::WireReference,                           -1,   false},
+{tag::TradeDate,                               -1,   false},
+{tag::TransactionID,                           -1,   false},
+{tag::FirmTransactionID,                       -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::CollInquiryID,                           -1,   true},
+{tag::NoCollInquiryQualifier,                  33,   false}, // CollInqQualGrp
+{tag::SubscriptionRequestType,                 -1,   false},
+{tag::ResponseTransportType,                   -1,   false},
+{tag::ResponseDestination,                     -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::Account,                                 -1,   false},
+{tag::AccountType,                             -1,   false},
+{tag::ClOrdID,                                 -1,   false},
+{tag::OrderID,                                 -1,   false},
+{tag::SecondaryOrderID,                        -1,   false},
+{tag::SecondaryClOrdID,                        -1,   false},
+{tag::NoExecs,                                 40,   false}, // ExecCollGrp
+{tag::NoTrades,                                86,   false}, // TrdCollGrp
+{0,                                            3,    false}, // Instrument
+{0,                                            2,    false}, // FinancingDetails
+{tag::SettlDate,                               -1,   false},
+{tag::Quantity,                                -1,   false},
+{tag::QtyType,                                 -1,   false},
+{tag::Currency,                                -1,   false},
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::MarginExcess,                            -1,   false},
+{tag::TotalNetValue,                           -1,   false},
+{tag::CashOutstanding,                         -1,   false},
+{tag::NoTrdRegTimestamps,                      18,   false}, // TrdRegTimestamps
+{tag::Side,                                    -1,   false},
+{tag::Price,                                   -1,   false},
+{tag::PriceType,                               -1,   false},
+{tag::AccruedInterestAmt,                      -1,   false},
+{tag::EndAccruedInterestAmt,                   -1,   false},
+{tag::StartCash,                               -1,   false},
+{tag::EndCash,                                 -1,   false},
+{0,                                            16,   false}, // SpreadOrBenchmarkCurveData
+{tag::NoStipulations,                          17,   false}, // Stipulations
+{0,                                            14,   false}, // SettlInstructionsData
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::SettlSessID,                             -1,   false},
+{tag::SettlSessSubID,                          -1,   false},
+{tag::ClearingBusinessDate,                    -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::NetworkRequestType,                      -1,   true},
+{tag::NetworkRequestID,                        -1,   true},
+{tag::NoCompIDs,                               34,   false}, // CompIDReqGrp
+{tag::NetworkStatusResponseType,               -1,   true},
+{tag::NetworkRequestID,                        -1,   false},
+{tag::NetworkResponseID,                       -1,   true},
+{tag::LastNetworkResponseID,                   -1,   false},
+{tag::NoCompIDs,                               35,   true}, // CompIDStatGrp
+{tag::UserRequestID,                           -1,   true},
+{tag::UserRequestType,                         -1,   true},
+{tag::Username,                                -1,   true},
+{tag::Password,                                -1,   false},
+{tag::NewPassword,                             -1,   false},
+{tag::EncryptedPasswordMethod,                 -1,   false},
+{tag::EncryptedPasswordLen,                    -1,   false},
+{tag::EncryptedPassword,                       -1,   false},
+{tag::EncryptedNewPasswordLen,                 -1,   false},
+{tag::EncryptedNewPassword,                    -1,   false},
+{tag::RawDataLength,                           -1,   false},
+{tag::RawData,                                 -1,   false},
+{tag::UserRequestID,                           -1,   true},
+{tag::Username,                                -1,   true},
+{tag::UserStatus,                              -1,   false},
+{tag::NoThrottles,                             206,  false}, // ThrottleParamsGrp
+{tag::UserStatusText,                          -1,   false},
+{tag::CollInquiryID,                           -1,   true},
+{tag::CollInquiryStatus,                       -1,   true},
+{tag::CollInquiryResult,                       -1,   false},
+{tag::NoCollInquiryQualifier,                  33,   false}, // CollInqQualGrp
+{tag::TotNumReports,                           -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::Account,                                 -1,   false},
+{tag::AccountType,                             -1,   false},
+{tag::ClOrdID,                                 -1,   false},
+{tag::OrderID,                                 -1,   false},
+{tag::SecondaryOrderID,                        -1,   false},
+{tag::SecondaryClOrdID,                        -1,   false},
+{tag::NoExecs,                                 40,   false}, // ExecCollGrp
+{tag::NoTrades,                                86,   false}, // TrdCollGrp
+{0,                                            3,    false}, // Instrument
+{0,                                            2,    false}, // FinancingDetails
+{tag::SettlDate,                               -1,   false},
+{tag::Quantity,                                -1,   false},
+{tag::QtyType,                                 -1,   false},
+{tag::Currency,                                -1,   false},
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::SettlSessID,                             -1,   false},
+{tag::SettlSessSubID,                          -1,   false},
+{tag::ClearingBusinessDate,                    -1,   false},
+{tag::ResponseTransportType,                   -1,   false},
+{tag::ResponseDestination,                     -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::ConfirmReqID,                            -1,   true},
+{tag::ConfirmType,                             -1,   true},
+{tag::NoOrders,                                60,   false}, // OrdAllocGrp
+{tag::AllocID,                                 -1,   false},
+{tag::SecondaryAllocID,                        -1,   false},
+{tag::IndividualAllocID,                       -1,   false},
+{tag::TransactTime,                            -1,   true},
+{tag::AllocAccount,                            -1,   false},
+{tag::AllocAcctIDSource,                       -1,   false},
+{tag::AllocAccountType,                        -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::TradSesReqID,                            -1,   true},
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::SecurityExchange,                        -1,   false},
+{tag::TradSesMethod,                           -1,   false},
+{tag::TradSesMode,                             -1,   false},
+{tag::SubscriptionRequestType,                 -1,   true},
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::TradSesReqID,                            -1,   false},
+{tag::NoTradingSessions,                       119,  true}, // TrdSessLstGrp
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::SecurityReportID,                        -1,   false},
+{tag::SecurityListID,                          -1,   false},
+{tag::SecurityListRefID,                       -1,   false},
+{tag::SecurityListDesc,                        -1,   false},
+{tag::EncodedSecurityListDescLen,              -1,   false},
+{tag::EncodedSecurityListDesc,                 -1,   false},
+{tag::SecurityListType,                        -1,   false},
+{tag::SecurityListTypeSource,                  -1,   false},
+{tag::SecurityReqID,                           -1,   false},
+{tag::SecurityResponseID,                      -1,   false},
+{tag::SecurityRequestResult,                   -1,   false},
+{tag::TotNoRelatedSym,                         -1,   false},
+{tag::ClearingBusinessDate,                    -1,   false},
+{tag::CorporateAction,                         -1,   false},
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::LastFragment,                            -1,   false},
+{tag::NoRelatedSym,                            105,  false}, // SecLstUpdRelSymGrp
+{tag::PosMaintRptID,                           -1,   true},
+{tag::PosReqType,                              -1,   false},
+{tag::ClearingBusinessDate,                    -1,   true},
+{tag::SettlSessID,                             -1,   false},
+{tag::PosMaintRptRefID,                        -1,   false},
+{tag::NoPartyIDs,                              10,   true}, // Parties
+{tag::NoPositions,                             13,   true}, // PositionQty
+{tag::NoRelatedSym,                            41,   false}, // InstrmtGrp
+{tag::SettlPrice,                              -1,   false},
+{tag::PriorSettlPrice,                         -1,   false},
+{tag::AllocID,                                 -1,   true},
+{tag::AllocTransType,                          -1,   true},
+{tag::AllocType,                               -1,   true},
+{tag::AllocRequestID,                          -1,   false},
+{tag::SecondaryAllocID,                        -1,   false},
+{tag::RefAllocID,                              -1,   false},
+{tag::AllocCancReplaceReason,                  -1,   false},
+{tag::AllocIntermedReqType,                    -1,   false},
+{tag::AllocLinkID,                             -1,   false},
+{tag::AllocLinkType,                           -1,   false},
+{tag::AllocGroupID,                            -1,   false},
+{tag::FirmGroupID,                             -1,   false},
+{tag::BookingRefID,                            -1,   false},
+{tag::AllocNoOrdersType,                       -1,   false},
+{tag::NoOrders,                                60,   false}, // OrdAllocGrp
+{tag::NoExecs,                                 39,   false}, // ExecAllocGrp
+{tag::PreviouslyReported,                      -1,   false},
+{tag::ReversalIndicator,                       -1,   false},
+{tag::MatchType,                               -1,   false},
+{tag::Side,                                    -1,   true},
+{0,                                            3,    true}, // Instrument
+{0,                                            4,    false}, // InstrumentExtension
+{0,                                            2,    false}, // FinancingDetails
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::Quantity,                                -1,   false},
+{tag::QtyType,                                 -1,   false},
+{tag::AllocGroupQuantity,                      -1,   false},
+{tag::AllocGroupRemainingQuantity,             -1,   false},
+{tag::GroupAmount,                             -1,   false},
+{tag::GroupRemainingAmount,                    -1,   false},
+{tag::LastMkt,                                 -1,   false},
+{tag::TradeOriginationDate,                    -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::PriceType,                               -1,   false},
+{tag::NoPriceQualifiers,                       712,  false}, // PriceQualifierGrp
+{tag::AvgPx,                                   -1,   false},
+{tag::AvgParPx,                                -1,   false},
+{tag::HighPx,                                  -1,   false},
+{tag::LowPx,                                   -1,   false},
+{0,                                            16,   false}, // SpreadOrBenchmarkCurveData
+{tag::Currency,                                -1,   false},
+{tag::AvgPxPrecision,                          -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::TradeDate,                               -1,   true},
+{tag::TransactTime,                            -1,   false},
+{tag::AllocStatus,                             -1,   false},
+{tag::SettlType,                               -1,   false},
+{tag::SettlDate,                               -1,   false},
+{tag::BookingType,                             -1,   false},
+{tag::GrossTradeAmt,                           -1,   false},
+{tag::Concession,                              -1,   false},
+{tag::TotalTakedown,                           -1,   false},
+{tag::NetMoney,                                -1,   false},
+{tag::PositionEffect,                          -1,   false},
+{tag::AutoAcceptIndicator,                     -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::NumDaysInterest,                         -1,   false},
+{tag::AccruedInterestRate,                     -1,   false},
+{tag::AccruedInterestAmt,                      -1,   false},
+{tag::TotalAccruedInterestAmt,                 -1,   false},
+{tag::InterestAtMaturity,                      -1,   false},
+{tag::EndAccruedInterestAmt,                   -1,   false},
+{tag::StartCash,                               -1,   false},
+{tag::EndCash,                                 -1,   false},
+{tag::LegalConfirm,                            -1,   false},
+{tag::NoStipulations,                          17,   false}, // Stipulations
+{0,                                            20,   false}, // YieldData
+{tag::NoPosAmt,                                12,   false}, // PositionAmountData
+{tag::TotNoAllocs,                             -1,   false},
+{tag::LastFragment,                            -1,   false},
+{tag::NoAllocs,                                28,   false}, // AllocGrp
+{tag::AvgPxIndicator,                          -1,   false},
+{tag::AvgPxGroupID,                            -1,   false},
+{tag::ClearingBusinessDate,                    -1,   false},
+{tag::TrdType,                                 -1,   false},
+{tag::TrdSubType,                              -1,   false},
+{tag::CustOrderCapacity,                       -1,   false},
+{tag::TradeInputSource,                        -1,   false},
+{tag::MultiLegReportingType,                   -1,   false},
+{tag::MessageEventSource,                      -1,   false},
+{tag::RndPx,                                   -1,   false},
+{tag::CustOrderHandlingInst,                   -1,   false},
+{tag::OrderHandlingInstSource,                 -1,   false},
+{tag::OrderID,                                 -1,   true},
+{tag::SecondaryOrderID,                        -1,   false},
+{tag::ClOrdID,                                 -1,   false},
+{tag::ExecAckStatus,                           -1,   true},
+{tag::ExecID,                                  -1,   true},
+{tag::DKReason,                                -1,   false},
+{0,                                            3,    true}, // Instrument
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::Side,                                    -1,   true},
+{0,                                            9,    false}, // OrderQtyData
+{tag::LastQty,                                 -1,   false},
+{tag::LastPx,                                  -1,   false},
+{tag::PriceType,                               -1,   false},
+{tag::NoPriceQualifiers,                       712,  false}, // PriceQualifierGrp
+{tag::LastParPx,                               -1,   false},
+{tag::CumQty,                                  -1,   false},
+{tag::AvgPx,                                   -1,   false},
+{tag::NoRegulatoryTradeIDs,                    306,  false}, // RegulatoryTradeIDGrp
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::ContIntRptID,                            -1,   true},
+{tag::TransactTime,                            -1,   false},
+{tag::LateIndicator,                           -1,   false},
+{tag::InputSource,                             -1,   false},
+{tag::ClearingBusinessDate,                    -1,   true},
+{tag::NoPartyIDs,                              10,   true}, // Parties
+{tag::NoExpiration,                            108,  true}, // ExpirationQty
+{0,                                            3,    true}, // Instrument
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::SecurityReportID,                        -1,   false},
+{tag::SecurityReqID,                           -1,   false},
+{tag::SecurityResponseID,                      -1,   false},
+{tag::SecurityResponseType,                    -1,   false},
+{tag::ClearingBusinessDate,                    -1,   false},
+{tag::CorporateAction,                         -1,   false},
+{0,                                            3,    false}, // Instrument
+{0,                                            4,    false}, // InstrumentExtension
+{0,                                            2,    false}, // FinancingDetails
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoRelatedInstruments,                    180,  false}, // RelatedInstrumentGrp
+{tag::Currency,                                -1,   false},
+{tag::PreviousAdjustedOpenInterest,            -1,   false},
+{tag::PreviousUnadjustedOpenInterest,          -1,   false},
+{tag::PriorSettlPrice,                         -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::NoStipulations,                          17,   false}, // Stipulations
+{tag::NumOfSimpleInstruments,                  -1,   false},
+{tag::NumOfComplexInstruments,                 -1,   false},
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{0,                                            16,   false}, // SpreadOrBenchmarkCurveData
+{0,                                            20,   false}, // YieldData
+{tag::NoMarketSegments,                        141,  false}, // MarketSegmentGrp
+{tag::LastUpdateTime,                          -1,   false},
+{tag::EffectiveBusinessDate,                   -1,   false},
+{tag::TransactTime,                            -1,   false},
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::ClearingBusinessDate,                    -1,   false},
+{tag::SettlementCycleNo,                       -1,   false},
+{tag::SettlObligMsgID,                         -1,   true},
+{tag::SettlObligMode,                          -1,   true},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::NoSettlOblig,                            123,  true}, // SettlObligationInstructions
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::SecurityReqID,                           -1,   false},
+{tag::SecurityResponseID,                      -1,   false},
+{tag::SecurityRequestResult,                   -1,   false},
+{0,                                            19,   false}, // UnderlyingInstrument
+{0,                                            149,  false}, // DerivativeSecurityDefinition
+{tag::LastUpdateTime,                          -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::TotNoRelatedSym,                         -1,   false},
+{tag::LastFragment,                            -1,   false},
+{tag::NoRelatedSym,                            150,  false}, // RelSymDerivSecUpdGrp
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::TradSesReqID,                            -1,   false},
+{tag::NoTradingSessions,                       119,  true}, // TrdSessLstGrp
+{tag::MarketReqID,                             -1,   true},
+{tag::SubscriptionRequestType,                 -1,   true},
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::ParentMktSegmID,                         -1,   false},
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::MarketReportID,                          -1,   true},
+{tag::MarketReqID,                             -1,   false},
+{tag::MarketID,                                -1,   true},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::MarketSegmentDesc,                       -1,   false},
+{tag::EncodedMktSegmDescLen,                   -1,   false},
+{tag::EncodedMktSegmDesc,                      -1,   false},
+{tag::ParentMktSegmID,                         -1,   false},
+{tag::MarketSegmentStatus,                     -1,   false},
+{tag::MarketSegmentType,                       -1,   false},
+{tag::MarketSegmentSubType,                    -1,   false},
+{tag::NoInstrumentScopes,                      194,  false}, // InstrumentScopeGrp
+{tag::NoRelatedMarketSegments,                 591,  false}, // RelatedMarketSegmentGrp
+{tag::Currency,                                -1,   false},
+{0,                                            140,  false}, // BaseTradingRules
+{tag::NoOrdTypeRules,                          137,  false}, // OrdTypeRules
+{tag::NoTimeInForceRules,                      136,  false}, // TimeInForceRules
+{tag::NoExecInstRules,                         135,  false}, // ExecInstRules
+{tag::NoAuctionTypeRules,                      587,  false}, // AuctionTypeRuleGrp
+{tag::NoMDFeedTypes,                           132,  false}, // MarketDataFeedTypes
+{tag::NoMatchRules,                            134,  false}, // MatchRules
+{tag::NoFlexProductEligibilities,              588,  false}, // FlexProductEligibilityGrp
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::NoMiscFees,                              59,   false}, // MiscFeesGrp
+{tag::EffectiveBusinessDate,                   -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::MarketReportID,                          -1,   true},
+{tag::MarketReqID,                             -1,   false},
+{tag::MarketUpdateAction,                      -1,   false},
+{tag::MarketID,                                -1,   true},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::MarketSegmentDesc,                       -1,   false},
+{tag::EncodedMktSegmDescLen,                   -1,   false},
+{tag::EncodedMktSegmDesc,                      -1,   false},
+{tag::ParentMktSegmID,                         -1,   false},
+{tag::MarketSegmentStatus,                     -1,   false},
+{tag::MarketSegmentType,                       -1,   false},
+{tag::MarketSegmentSubType,                    -1,   false},
+{tag::NoInstrumentScopes,                      194,  false}, // InstrumentScopeGrp
+{tag::NoRelatedMarketSegments,                 591,  false}, // RelatedMarketSegmentGrp
+{tag::Currency,                                -1,   false},
+{0,                                            140,  false}, // BaseTradingRules
+{tag::NoOrdTypeRules,                          137,  false}, // OrdTypeRules
+{tag::NoTimeInForceRules,                      136,  false}, // TimeInForceRules
+{tag::NoExecInstRules,                         135,  false}, // ExecInstRules
+{tag::NoAuctionTypeRules,                      587,  false}, // AuctionTypeRuleGrp
+{tag::NoMDFeedTypes,                           132,  false}, // MarketDataFeedTypes
+{tag::NoMatchRules,                            134,  false}, // MatchRules
+{tag::NoFlexProductEligibilities,              588,  false}, // FlexProductEligibilityGrp
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::EffectiveBusinessDate,                   -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::ApplReqID,                               -1,   true},
+{tag::ApplReqType,                             -1,   true},
+{tag::NoApplIDs,                               160,  false}, // ApplIDRequestGrp
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::ApplResponseID,                          -1,   true},
+{tag::ApplReqID,                               -1,   false},
+{tag::ApplReqType,                             -1,   false},
+{tag::ApplResponseType,                        -1,   false},
+{tag::ApplTotalMessageCount,                   -1,   false},
+{tag::NoApplIDs,                               161,  false}, // ApplIDRequestAckGrp
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::ApplReportID,                            -1,   true},
+{tag::ApplReqID,                               -1,   false},
+{tag::ApplReportType,                          -1,   true},
+{tag::NoApplIDs,                               162,  false}, // ApplIDReportGrp
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::ClOrdID,                                 -1,   false},
+{tag::SecondaryClOrdID,                        -1,   false},
+{tag::MassActionReportID,                      -1,   true},
+{tag::MassActionType,                          -1,   true},
+{tag::MassActionScope,                         -1,   true},
+{tag::MassActionReason,                        -1,   false},
+{tag::MassActionResponse,                      -1,   true},
+{tag::MassActionRejectReason,                  -1,   false},
+{tag::TotalAffectedOrders,                     -1,   false},
+{tag::TotalNotAffectedOrders,                  -1,   false},
+{tag::LastFragment,                            -1,   false},
+{tag::NoAffectedOrders,                        26,   false}, // AffectedOrdGrp
+{tag::NoNotAffectedOrders,                     156,  false}, // NotAffectedOrdGrp
+{tag::NoAffectedMarketSegments,                219,  false}, // AffectedMarketSegmentGrp
+{tag::NoNotAffectedMarketSegments,             220,  false}, // NotAffectedMarketSegmentGrp
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::NoTargetMarketSegments,                  218,  false}, // TargetMarketSegmentGrp
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::NoTargetPartyIDs,                        167,  false}, // TargetParties
+{0,                                            3,    false}, // Instrument
+{0,                                            19,   false}, // UnderlyingInstrument
+{tag::Side,                                    -1,   false},
+{tag::Price,                                   -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::ComplianceID,                            -1,   false},
+{tag::ComplianceText,                          -1,   false},
+{tag::EncodedComplianceTextLen,                -1,   false},
+{tag::EncodedComplianceText,                   -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::EmailThreadID,                           -1,   true},
+{tag::EmailType,                               -1,   true},
+{tag::OrigTime,                                -1,   false},
+{tag::Subject,                                 -1,   true},
+{tag::EncodedSubjectLen,                       -1,   false},
+{tag::EncodedSubject,                          -1,   false},
+{tag::NoRoutingIDs,                            78,   false}, // RoutingGrp
+{tag::NoRelatedSym,                            41,   false}, // InstrmtGrp
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::OrderID,                                 -1,   false},
+{tag::ClOrdID,                                 -1,   false},
+{tag::NoLinesOfText,                           53,   true}, // LinesOfTextGrp
+{tag::RawDataLength,                           -1,   false},
+{tag::RawData,                                 -1,   false},
+{tag::NoAttachments,                           396,  false}, // AttachmentGrp
+{tag::ClOrdID,                                 -1,   true},
+{tag::SecondaryClOrdID,                        -1,   false},
+{tag::MassActionType,                          -1,   true},
+{tag::MassActionScope,                         -1,   true},
+{tag::MassActionReason,                        -1,   false},
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::NoTargetMarketSegments,                  218,  false}, // TargetMarketSegmentGrp
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::NoTargetPartyIDs,                        167,  false}, // TargetParties
+{0,                                            3,    false}, // Instrument
+{0,                                            19,   false}, // UnderlyingInstrument
+{tag::Side,                                    -1,   false},
+{tag::Price,                                   -1,   false},
+{tag::TransactTime,                            -1,   true},
+{tag::ComplianceID,                            -1,   false},
+{tag::ComplianceText,                          -1,   false},
+{tag::EncodedComplianceTextLen,                -1,   false},
+{tag::EncodedComplianceText,                   -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::NoUsernames,                             155,  false}, // UsernameGrp
+{tag::UserStatus,                              -1,   true},
+{tag::NoThrottles,                             206,  false}, // ThrottleParamsGrp
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::StreamAsgnReqID,                         -1,   true},
+{tag::StreamAsgnReqType,                       -1,   true},
+{tag::NoAsgnReqs,                              172,  true}, // StrmAsgnReqGrp
+{tag::StreamAsgnRptID,                         -1,   true},
+{tag::StreamAsgnReqType,                       -1,   false},
+{tag::StreamAsgnReqID,                         -1,   false},
+{tag::NoAsgnReqs,                              173,  false}, // StrmAsgnRptGrp
+{tag::StreamAsgnAckType,                       -1,   true},
+{tag::StreamAsgnRptID,                         -1,   true},
+{tag::StreamAsgnRejReason,                     -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::PartyDetailsListRequestID,               -1,   true},
+{tag::NoRequestingPartyIDs,                    196,  false}, // RequestingPartyGrp
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::NoRequestedPartyRoles,                   181,  false}, // RequestedPartyRoleGrp
+{tag::NoPartyRelationships,                    182,  false}, // PartyRelationshipGrp
+{tag::SubscriptionRequestType,                 -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::PartyDetailsListReportID,                -1,   true},
+{tag::PartyDetailsListRequestID,               -1,   false},
+{tag::RequestResult,                           -1,   false},
+{tag::TotNoParties,                            -1,   false},
+{tag::LastFragment,                            -1,   false},
+{tag::NoPartyDetails,                          183,  false}, // PartyDetailGrp
+{tag::TransactTime,                            -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::RejectText,                              -1,   false},
+{tag::EncodedRejectTextLen,                    -1,   false},
+{tag::EncodedRejectText,                       -1,   false},
+{tag::MarginReqmtInqID,                        -1,   true},
+{tag::NoMarginReqmtInqQualifier,               178,  true}, // MarginReqmtInqQualGrp
+{tag::SubscriptionRequestType,                 -1,   false},
+{tag::ResponseTransportType,                   -1,   false},
+{tag::ResponseDestination,                     -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::ClearingBusinessDate,                    -1,   false},
+{tag::SettlSessID,                             -1,   false},
+{tag::SettlSessSubID,                          -1,   false},
+{tag::MarginClass,                             -1,   false},
+{0,                                            3,    false}, // Instrument
+{tag::TransactTime,                            -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::MarginReqmtInqID,                        -1,   true},
+{tag::NoMarginReqmtInqQualifier,               178,  true}, // MarginReqmtInqQualGrp
+{tag::MarginReqmtInqStatus,                    -1,   true},
+{tag::MarginReqmtInqResult,                    -1,   false},
+{tag::TotNumReports,                           -1,   false},
+{tag::SubscriptionRequestType,                 -1,   false},
+{tag::ResponseTransportType,                   -1,   false},
+{tag::ResponseDestination,                     -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::ClearingBusinessDate,                    -1,   false},
+{tag::SettlSessID,                             -1,   false},
+{tag::SettlSessSubID,                          -1,   false},
+{tag::MarginClass,                             -1,   false},
+{0,                                            3,    false}, // Instrument
+{tag::TransactTime,                            -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::MarginReqmtRptID,                        -1,   true},
+{tag::MarginReqmtInqID,                        -1,   false},
+{tag::MarginReqmtRptType,                      -1,   true},
+{tag::TotNumReports,                           -1,   false},
+{tag::LastRptRequested,                        -1,   false},
+{tag::UnsolicitedIndicator,                    -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::ClearingBusinessDate,                    -1,   false},
+{tag::SettlSessID,                             -1,   false},
+{tag::SettlSessSubID,                          -1,   false},
+{tag::MarginClass,                             -1,   false},
+{tag::Currency,                                -1,   false},
+{0,                                            3,    false}, // Instrument
+{tag::NoMarginAmt,                             179,  true}, // MarginAmount
+{tag::TransactTime,                            -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::PartyDetailsListReportID,                -1,   true},
+{tag::PartyDetailsListRequestID,               -1,   false},
+{tag::TotNoParties,                            -1,   false},
+{tag::LastFragment,                            -1,   false},
+{tag::NoRequestingPartyIDs,                    196,  false}, // RequestingPartyGrp
+{tag::NoPartyUpdates,                          198,  false}, // PartyDetailsUpdateGrp
+{tag::TransactTime,                            -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::RiskLimitRequestID,                      -1,   true},
+{tag::RiskLimitRequestType,                    -1,   false},
+{tag::SubscriptionRequestType,                 -1,   false},
+{tag::NoRequestingPartyIDs,                    196,  false}, // RequestingPartyGrp
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::NoRequestedPartyRoles,                   181,  false}, // RequestedPartyRoleGrp
+{tag::NoRequestedRiskLimitType,                199,  false}, // RequestedRiskLimitTypesGrp
+{tag::RiskLimitPlatform,                       -1,   false},
+{tag::NoRiskInstrumentScopes,                  195,  false}, // RiskInstrumentScopeGrp
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::RiskLimitReportID,                       -1,   true},
+{tag::RiskLimitRequestID,                      -1,   false},
+{tag::RiskLimitRequestType,                    -1,   false},
+{tag::RequestResult,                           -1,   false},
+{tag::UnsolicitedIndicator,                    -1,   false},
+{tag::TotNoParties,                            -1,   false},
+{tag::LastFragment,                            -1,   false},
+{tag::NoPartyRiskLimits,                       200,  false}, // PartyRiskLimitsGrp
+{tag::TransactTime,                            -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::RejectText,                              -1,   false},
+{tag::EncodedRejectTextLen,                    -1,   false},
+{tag::EncodedRejectText,                       -1,   false},
+{tag::SecurityStatusReqID,                     -1,   true},
+{0,                                            187,  false}, // InstrumentScope
+{tag::SubscriptionRequestType,                 -1,   true},
+{tag::SecurityListID,                          -1,   false},
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::SecurityStatusReqID,                     -1,   false},
+{tag::SecurityListID,                          -1,   false},
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::TradeDate,                               -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{0,                                            187,  false}, // InstrumentScope
+{tag::UnsolicitedIndicator,                    -1,   false},
+{tag::SecurityMassTradingStatus,               -1,   false},
+{tag::FastMarketIndicator,                     -1,   false},
+{tag::SecurityMassTradingEvent,                -1,   false},
+{tag::MassHaltReason,                          -1,   false},
+{tag::MDBookType,                              -1,   false},
+{tag::MarketDepth,                             -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::Adjustment,                              -1,   false},
+{tag::NoRelatedSym,                            203,  false}, // SecMassStatGrp
+{tag::AccountSummaryReportID,                  -1,   true},
+{tag::ClearingBusinessDate,                    -1,   true},
+{tag::Currency,                                -1,   false},
+{tag::TotalNetValue,                           -1,   false},
+{tag::MarginExcess,                            -1,   false},
+{tag::SettlSessID,                             -1,   false},
+{tag::SettlSessSubID,                          -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::NoSettlementAmounts,                     209,  false}, // SettlementAmountGrp
+{tag::NoMarginAmt,                             179,  false}, // MarginAmount
+{tag::NoPartyIDs,                              10,   true}, // Parties
+{tag::NoCollateralAmounts,                     210,  false}, // CollateralAmountGrp
+{tag::NoPayCollects,                           211,  false}, // PayCollectGrp
+{tag::NoPosAmt,                                12,   false}, // PositionAmountData
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::RiskLimitReportID,                       -1,   true},
+{tag::RiskLimitRequestID,                      -1,   false},
+{tag::RiskLimitRequestType,                    -1,   false},
+{tag::TotNoParties,                            -1,   false},
+{tag::LastFragment,                            -1,   false},
+{tag::NoRequestingPartyIDs,                    196,  false}, // RequestingPartyGrp
+{tag::NoPartyRiskLimits,                       212,  false}, // PartyRiskLimitsUpdateGrp
+{tag::TransactTime,                            -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::RiskLimitRequestID,                      -1,   true},
+{tag::NoRequestingPartyIDs,                    196,  false}, // RequestingPartyGrp
+{tag::NoPartyRiskLimits,                       212,  false}, // PartyRiskLimitsUpdateGrp
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::RiskLimitRequestID,                      -1,   true},
+{tag::RiskLimitRequestResult,                  -1,   false},
+{tag::RiskLimitRequestStatus,                  -1,   true},
+{tag::NoRequestingPartyIDs,                    196,  false}, // RequestingPartyGrp
+{tag::NoPartyRiskLimits,                       213,  false}, // PartyRiskLimitsAckGrp
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::EntitlementRequestID,                    -1,   false},
+{tag::SubscriptionRequestType,                 -1,   false},
+{tag::NoRequestingPartyIDs,                    196,  false}, // RequestingPartyGrp
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::NoRequestedPartyRoles,                   181,  false}, // RequestedPartyRoleGrp
+{tag::EntitlementStatus,                       -1,   false},
+{tag::NoEntitlementTypes,                      547,  false}, // EntitlementTypeGrp
+{tag::EntitlementPlatform,                     -1,   false},
+{tag::NoInstrumentScopes,                      194,  false}, // InstrumentScopeGrp
+{tag::NoMarketSegments,                        217,  false}, // MarketSegmentScopeGrp
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::EntitlementReportID,                     -1,   true},
+{tag::EntitlementRequestID,                    -1,   false},
+{tag::RequestResult,                           -1,   false},
+{tag::TotNoParties,                            -1,   false},
+{tag::LastFragment,                            -1,   false},
+{tag::NoPartyEntitlements,                     214,  false}, // PartyEntitlementGrp
+{tag::TransactTime,                            -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::RejectText,                              -1,   false},
+{tag::EncodedRejectTextLen,                    -1,   false},
+{tag::EncodedRejectText,                       -1,   false},
+{tag::QuoteID,                                 -1,   false},
+{tag::QuoteMsgID,                              -1,   false},
+{tag::QuoteReqID,                              -1,   false},
+{tag::QuoteType,                               -1,   false},
+{tag::QuoteCancelType,                         -1,   false},
+{tag::SecondaryQuoteID,                        -1,   false},
+{tag::QuoteAckStatus,                          -1,   true},
+{tag::QuoteRejectReason,                       -1,   false},
+{tag::RejectText,                              -1,   false},
+{tag::EncodedRejectTextLen,                    -1,   false},
+{tag::EncodedRejectText,                       -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::NoQuoteAttributes,                       711,  false}, // QuoteAttributeGrp
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::PartyDetailsListRequestID,               -1,   true},
+{tag::NoRequestingPartyIDs,                    196,  false}, // RequestingPartyGrp
+{tag::NoPartyUpdates,                          198,  true}, // PartyDetailsUpdateGrp
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::PartyDetailsListRequestID,               -1,   true},
+{tag::PartyDetailRequestStatus,                -1,   true},
+{tag::PartyDetailRequestResult,                -1,   false},
+{tag::NoRequestingPartyIDs,                    196,  false}, // RequestingPartyGrp
+{tag::NoPartyUpdates,                          233,  false}, // PartyDetailAckGrp
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::EntitlementReportID,                     -1,   true},
+{tag::EntitlementRequestID,                    -1,   false},
+{tag::TotNoParties,                            -1,   false},
+{tag::LastFragment,                            -1,   false},
+{tag::NoRequestingPartyIDs,                    196,  false}, // RequestingPartyGrp
+{tag::NoPartyEntitlements,                     234,  true}, // PartyEntitlementUpdateGrp
+{tag::TransactTime,                            -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::ClOrdID,                                 -1,   true},
+{tag::OrderRequestID,                          -1,   false},
+{tag::SecondaryClOrdID,                        -1,   false},
+{tag::ClOrdLinkID,                             -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::NoTargetPartyIDs,                        167,  false}, // TargetParties
+{tag::TradeOriginationDate,                    -1,   false},
+{tag::TradeDate,                               -1,   false},
+{tag::Account,                                 -1,   false},
+{tag::AcctIDSource,                            -1,   false},
+{tag::AccountType,                             -1,   false},
+{tag::DayBookingInst,                          -1,   false},
+{tag::BookingUnit,                             -1,   false},
+{tag::PreallocMethod,                          -1,   false},
+{tag::AllocID,                                 -1,   false},
+{tag::NoAllocs,                                63,   false}, // PreAllocGrp
+{tag::SettlType,                               -1,   false},
+{tag::SettlDate,                               -1,   false},
+{tag::CashMargin,                              -1,   false},
+{tag::ClearingFeeIndicator,                    -1,   false},
+{tag::HandlInst,                               -1,   false},
+{tag::ExecInst,                                -1,   false},
+{tag::AuctionInstruction,                      -1,   false},
+{tag::MinQty,                                  -1,   false},
+{tag::MinQtyMethod,                            -1,   false},
+{tag::MatchIncrement,                          -1,   false},
+{tag::MaxPriceLevels,                          -1,   false},
+{tag::MaximumPricePercentage,                  -1,   false},
+{tag::NoValueChecks,                           230,  false}, // ValueChecksGrp
+{tag::NoMatchInst,                             176,  false}, // MatchingInstructions
+{tag::SelfMatchPreventionID,                   -1,   false},
+{0,                                            115,  false}, // DisplayInstruction
+{tag::NoDisclosureInstructions,                222,  false}, // DisclosureInstructionGrp
+{tag::MaxFloor,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::ExDestination,                           -1,   false},
+{tag::ExDestinationIDSource,                   -1,   false},
+{tag::ExDestinationType,                       -1,   false},
+{tag::NoTradingSessions,                       88,   false}, // TrdgSesGrp
+{tag::ProcessCode,                             -1,   false},
+{0,                                            3,    true}, // Instrument
+{0,                                            2,    false}, // FinancingDetails
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::PrevClosePx,                             -1,   false},
+{tag::Side,                                    -1,   true},
+{tag::ShortMarkingExemptIndicator,             -1,   false},
+{tag::ShortSaleExemptionReason,                -1,   false},
+{tag::LocateReqd,                              -1,   false},
+{tag::TransactTime,                            -1,   true},
+{tag::NoStipulations,                          17,   false}, // Stipulations
+{tag::QtyType,                                 -1,   false},
+{0,                                            9,    true}, // OrderQtyData
+{tag::OrdType,                                 -1,   true},
+{tag::PriceType,                               -1,   false},
+{tag::Price,                                   -1,   false},
+{tag::PriceProtectionScope,                    -1,   false},
+{tag::StopPx,                                  -1,   false},
+{0,                                            116,  false}, // TriggeringInstruction
+{0,                                            16,   false}, // SpreadOrBenchmarkCurveData
+{0,                                            20,   false}, // YieldData
+{tag::Currency,                                -1,   false},
+{tag::TradePriceNegotiationMethod,             -1,   false},
+{tag::UpfrontPriceType,                        -1,   false},
+{tag::UpfrontPrice,                            -1,   false},
+{tag::ComplianceID,                            -1,   false},
+{tag::ComplianceText,                          -1,   false},
+{tag::EncodedComplianceTextLen,                -1,   false},
+{tag::EncodedComplianceText,                   -1,   false},
+{tag::SolicitedFlag,                           -1,   false},
+{tag::IOIID,                                   -1,   false},
+{tag::QuoteID,                                 -1,   false},
+{tag::TimeInForce,                             -1,   false},
+{tag::EffectiveTime,                           -1,   false},
+{tag::ExpireDate,                              -1,   false},
+{tag::ExpireTime,                              -1,   false},
+{tag::GTBookingInst,                           -1,   false},
+{tag::ExposureDuration,                        -1,   false},
+{tag::ExposureDurationUnit,                    -1,   false},
+{0,                                            0,    false}, // CommissionData
+{tag::NoCommissions,                           594,  false}, // CommissionDataGrp
+{tag::OrderCapacity,                           -1,   false},
+{tag::OrderRestrictions,                       -1,   false},
+{tag::TradingCapacity,                         -1,   false},
+{tag::PreTradeAnonymity,                       -1,   false},
+{tag::TradePublishIndicator,                   -1,   false},
+{tag::CustOrderCapacity,                       -1,   false},
+{tag::NoOrderAttributes,                       709,  false}, // OrderAttributeGrp
+{tag::ForexReq,                                -1,   false},
+{tag::SettlCurrency,                           -1,   false},
+{tag::BookingType,                             -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::SettlDate2,                              -1,   false},
+{tag::OrderQty2,                               -1,   false},
+{tag::Price2,                                  -1,   false},
+{tag::ClearingAccountType,                     -1,   false},
+{tag::PositionEffect,                          -1,   false},
+{tag::CoveredOrUncovered,                      -1,   false},
+{tag::MaxShow,                                 -1,   false},
+{0,                                            11,   false}, // PegInstructions
+{0,                                            1,    false}, // DiscretionInstructions
+{tag::TargetStrategy,                          -1,   false},
+{tag::NoStrategyParameters,                    104,  false}, // StrategyParametersGrp
+{tag::TargetStrategyParameters,                -1,   false},
+{tag::ParticipationRate,                       -1,   false},
+{tag::CancellationRights,                      -1,   false},
+{tag::MoneyLaunderingStatus,                   -1,   false},
+{tag::RegistID,                                -1,   false},
+{tag::Designation,                             -1,   false},
+{tag::ManualOrderIndicator,                    -1,   false},
+{tag::CustDirectedOrder,                       -1,   false},
+{tag::ReceivedDeptID,                          -1,   false},
+{tag::CustOrderHandlingInst,                   -1,   false},
+{tag::OrderHandlingInstSource,                 -1,   false},
+{tag::OrderOrigination,                        -1,   false},
+{tag::OriginatingDeptID,                       -1,   false},
+{tag::ReceivingDeptID,                         -1,   false},
+{tag::OwnerType,                               -1,   false},
+{tag::NoTrdRegTimestamps,                      18,   false}, // TrdRegTimestamps
+{tag::RefOrderID,                              -1,   false},
+{tag::RefOrderIDSource,                        -1,   false},
+{tag::ThrottleInst,                            -1,   false},
+{tag::RefClOrdID,                              -1,   false},
+{tag::AuctionType,                             -1,   false},
+{tag::AuctionAllocationPct,                    -1,   false},
+{tag::EntitlementRequestID,                    -1,   true},
+{tag::NoRequestingPartyIDs,                    196,  false}, // RequestingPartyGrp
+{tag::NoPartyEntitlements,                     234,  true}, // PartyEntitlementUpdateGrp
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::EntitlementRequestID,                    -1,   true},
+{tag::EntitlementRequestStatus,                -1,   true},
+{tag::EntitlementRequestResult,                -1,   false},
+{tag::NoRequestingPartyIDs,                    196,  false}, // RequestingPartyGrp
+{tag::NoPartyEntitlements,                     235,  false}, // PartyEntitlementAckGrp
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::TrdMatchID,                              -1,   true},
+{tag::MatchType,                               -1,   false},
+{tag::TradeReportType,                         -1,   false},
+{tag::ClearingBusinessDate,                    -1,   false},
+{tag::TrdType,                                 -1,   false},
+{tag::TrdSubType,                              -1,   false},
+{tag::TradeDate,                               -1,   false},
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::VenueType,                               -1,   false},
+{tag::TradeMatchTimestamp,                     -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::MultiLegReportingType,                   -1,   false},
+{tag::NoInstrmtMatchSides,                     236,  false}, // InstrmtMatchSideGrp
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::TrdMatchID,                              -1,   true},
+{tag::TradeMatchAckStatus,                     -1,   true},
+{tag::TradeMatchRejectReason,                  -1,   false},
+{tag::RejectText,                              -1,   false},
+{tag::EncodedRejectTextLen,                    -1,   false},
+{tag::EncodedRejectText,                       -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::RiskLimitReportID,                       -1,   true},
+{tag::RiskLimitRequestID,                      -1,   false},
+{tag::RiskLimitReportStatus,                   -1,   true},
+{tag::RiskLimitReportRejectReason,             -1,   false},
+{tag::NoPartyRiskLimits,                       212,  false}, // PartyRiskLimitsUpdateGrp
+{tag::TransactTime,                            -1,   false},
+{tag::RejectText,                              -1,   false},
+{tag::EncodedRejectTextLen,                    -1,   false},
+{tag::EncodedRejectText,                       -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::RiskLimitCheckRequestID,                 -1,   false},
+{tag::RiskLimitCheckID,                        -1,   false},
+{tag::RiskLimitCheckTransType,                 -1,   true},
+{tag::RiskLimitCheckType,                      -1,   true},
+{tag::RiskLimitCheckRequestRefID,              -1,   false},
+{tag::RefOrderID,                              -1,   false},
+{tag::RefOrderIDSource,                        -1,   false},
+{tag::RiskLimitCheckRequestType,               -1,   false},
+{tag::RiskLimitCheckAmount,                    -1,   false},
+{tag::Currency,                                -1,   false},
+{tag::RiskLimitID,                             -1,   false},
+{tag::NoRequestingPartyIDs,                    196,  false}, // RequestingPartyGrp
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::NoRelatedPartyDetailID,                  190,  false}, // RelatedPartyDetailGrp
+{0,                                            3,    false}, // Instrument
+{tag::NoLegs,                                  49,   false}, // LegOrdGrp
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::Side,                                    -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::RiskLimitCheckRequestID,                 -1,   false},
+{tag::RiskLimitCheckID,                        -1,   false},
+{tag::RiskLimitCheckRequestStatus,             -1,   true},
+{tag::RiskLimitCheckRequestResult,             -1,   false},
+{tag::RiskLimitCheckTransType,                 -1,   true},
+{tag::RiskLimitCheckType,                      -1,   true},
+{tag::RiskLimitCheckRequestRefID,              -1,   false},
+{tag::RejectText,                              -1,   false},
+{tag::EncodedRejectTextLen,                    -1,   false},
+{tag::EncodedRejectText,                       -1,   false},
+{tag::RefOrderID,                              -1,   false},
+{tag::RefOrderIDSource,                        -1,   false},
+{tag::Side,                                    -1,   false},
+{tag::RiskLimitApprovedAmount,                 -1,   false},
+{tag::RiskLimitCheckAmount,                    -1,   false},
+{tag::RiskLimitID,                             -1,   false},
+{tag::Currency,                                -1,   false},
+{tag::ExpireTime,                              -1,   false},
+{tag::NoRequestingPartyIDs,                    196,  false}, // RequestingPartyGrp
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::NoRelatedPartyDetailID,                  190,  false}, // RelatedPartyDetailGrp
+{0,                                            3,    false}, // Instrument
+{tag::NoLegs,                                  49,   false}, // LegOrdGrp
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::TransactTime,                            -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::PartyActionRequestID,                    -1,   true},
+{tag::PartyActionType,                         -1,   true},
+{tag::ApplTestMessageIndicator,                -1,   false},
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{0,                                            187,  false}, // InstrumentScope
+{tag::NoRequestingPartyIDs,                    196,  false}, // RequestingPartyGrp
+{tag::NoPartyIDs,                              10,   true}, // Parties
+{tag::NoRelatedPartyDetailID,                  190,  false}, // RelatedPartyDetailGrp
+{tag::TransactTime,                            -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::EffectiveBusinessDate,                   -1,   false},
+{tag::PartyActionRequestID,                    -1,   false},
+{tag::PartyActionReportID,                     -1,   true},
+{tag::PartyActionType,                         -1,   true},
+{tag::PartyActionResponse,                     -1,   true},
+{tag::PartyActionRejectReason,                 -1,   false},
+{tag::ApplTestMessageIndicator,                -1,   false},
+{tag::RejectText,                              -1,   false},
+{tag::EncodedRejectTextLen,                    -1,   false},
+{tag::EncodedRejectText,                       -1,   false},
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{0,                                            187,  false}, // InstrumentScope
+{tag::NoRequestingPartyIDs,                    196,  false}, // RequestingPartyGrp
+{tag::NoPartyIDs,                              10,   true}, // Parties
+{tag::NoRelatedPartyDetailID,                  190,  false}, // RelatedPartyDetailGrp
+{tag::TransactTime,                            -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::CopyMsgIndicator,                        -1,   false},
+{tag::MassOrderRequestID,                      -1,   true},
+{tag::OrderResponseLevel,                      -1,   false},
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::TradingCapacity,                         -1,   false},
+{tag::ClearingAccountType,                     -1,   false},
+{tag::Account,                                 -1,   false},
+{tag::AcctIDSource,                            -1,   false},
+{tag::AccountType,                             -1,   false},
+{tag::OrderCapacity,                           -1,   false},
+{tag::OrderRestrictions,                       -1,   false},
+{tag::CustOrderCapacity,                       -1,   false},
+{tag::ManualOrderIndicator,                    -1,   false},
+{tag::CustOrderHandlingInst,                   -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::ThrottleInst,                            -1,   false},
+{tag::TotNoOrderEntries,                       -1,   false},
+{tag::LastFragment,                            -1,   false},
+{tag::NoOrderEntries,                          576,  true}, // OrderEntryGrp
+{0,                                            159,  true}, // ApplicationSequenceControl
+{tag::MassOrderRequestID,                      -1,   false},
+{tag::MassOrderReportID,                       -1,   false},
+{tag::MassOrderRequestStatus,                  -1,   true},
+{tag::MassOrderRequestResult,                  -1,   false},
+{tag::OrderResponseLevel,                      -1,   false},
+{tag::RejectText,                              -1,   false},
+{tag::EncodedRejectTextLen,                    -1,   false},
+{tag::EncodedRejectText,                       -1,   false},
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::TradingCapacity,                         -1,   true},
+{tag::ClearingAccountType,                     -1,   false},
+{tag::Account,                                 -1,   false},
+{tag::AcctIDSource,                            -1,   false},
+{tag::AccountType,                             -1,   false},
+{tag::OrderCapacity,                           -1,   false},
+{tag::OrderRestrictions,                       -1,   false},
+{tag::CustOrderCapacity,                       -1,   false},
+{tag::ManualOrderIndicator,                    -1,   false},
+{tag::CustOrderHandlingInst,                   -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::CopyMsgIndicator,                        -1,   false},
+{tag::TotNoOrderEntries,                       -1,   false},
+{tag::LastFragment,                            -1,   false},
+{0,                                            208,  false}, // ThrottleResponse
+{tag::NoOrderEntries,                          577,  false}, // OrderEntryAckGrp
+{tag::TransferInstructionID,                   -1,   true},
+{tag::TransferID,                              -1,   false},
+{tag::TransferTransType,                       -1,   false},
+{tag::TransferType,                            -1,   false},
+{tag::TransferScope,                           -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::NoTargetPartyIDs,                        167,  true}, // TargetParties
+{tag::ClearingBusinessDate,                    -1,   false},
+{tag::TradeDate,                               -1,   false},
+{tag::TransactTime,                            -1,   false},
+{0,                                            3,    false}, // Instrument
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoPositions,                             13,   false}, // PositionQty
+{tag::ClearingTradePrice,                      -1,   false},
+{tag::Currency,                                -1,   false},
+{tag::PriceType,                               -1,   false},
+{tag::NoPosAmt,                                12,   false}, // PositionAmountData
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::TransferInstructionID,                   -1,   true},
+{tag::TransferID,                              -1,   false},
+{tag::TransferTransType,                       -1,   false},
+{tag::TransferType,                            -1,   false},
+{tag::TransferStatus,                          -1,   false},
+{tag::TransferRejectReason,                    -1,   false},
+{tag::TransferScope,                           -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::NoTargetPartyIDs,                        167,  false}, // TargetParties
+{tag::TransactTime,                            -1,   false},
+{tag::RejectText,                              -1,   false},
+{tag::EncodedRejectTextLen,                    -1,   false},
+{tag::EncodedRejectText,                       -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::TransferInstructionID,                   -1,   false},
+{tag::TransferReportID,                        -1,   true},
+{tag::TransferID,                              -1,   true},
+{tag::TransferTransType,                       -1,   true},
+{tag::TransferReportType,                      -1,   true},
+{tag::TransferStatus,                          -1,   true},
+{tag::TransferRejectReason,                    -1,   false},
+{tag::TransferScope,                           -1,   false},
+{tag::NoPartyIDs,                              10,   true}, // Parties
+{tag::NoTargetPartyIDs,                        167,  false}, // TargetParties
+{tag::ClearingBusinessDate,                    -1,   false},
+{tag::TradeDate,                               -1,   false},
+{tag::TransactTime,                            -1,   false},
+{0,                                            3,    false}, // Instrument
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoPositions,                             13,   false}, // PositionQty
+{tag::ClearingTradePrice,                      -1,   false},
+{tag::Currency,                                -1,   false},
+{tag::PriceType,                               -1,   false},
+{tag::NoPosAmt,                                12,   false}, // PositionAmountData
+{tag::RejectText,                              -1,   false},
+{tag::EncodedRejectTextLen,                    -1,   false},
+{tag::EncodedRejectText,                       -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::MDStatisticReqID,                        -1,   true},
+{tag::SubscriptionRequestType,                 -1,   true},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::TradeDate,                               -1,   false},
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::MarketSegmentDesc,                       -1,   false},
+{tag::EncodedMktSegmDescLen,                   -1,   false},
+{tag::EncodedMktSegmDesc,                      -1,   false},
+{tag::SecurityListID,                          -1,   false},
+{0,                                            3,    false}, // Instrument
+{0,                                            4,    false}, // InstrumentExtension
+{0,                                            2,    false}, // FinancingDetails
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::NoRelatedInstruments,                    180,  false}, // RelatedInstrumentGrp
+{tag::NoMDStatistics,                          579,  false}, // MDStatisticReqGrp
+{tag::TransactTime,                            -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::MDStatisticRptID,                        -1,   true},
+{tag::MDStatisticReqID,                        -1,   false},
+{tag::MDStatisticRequestResult,                -1,   false},
+{tag::UnsolicitedIndicator,                    -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::CustOrderCapacity,                       -1,   false},
+{tag::TradeDate,                               -1,   false},
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::MarketSegmentDesc,                       -1,   false},
+{tag::EncodedMktSegmDescLen,                   -1,   false},
+{tag::EncodedMktSegmDesc,                      -1,   false},
+{tag::SecurityListID,                          -1,   false},
+{tag::Currency,                                -1,   false},
+{0,                                            3,    false}, // Instrument
+{0,                                            4,    false}, // InstrumentExtension
+{0,                                            2,    false}, // FinancingDetails
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::NoRelatedInstruments,                    180,  false}, // RelatedInstrumentGrp
+{tag::NoMDStatistics,                          580,  true}, // MDStatisticRptGrp
+{tag::TransactTime,                            -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::CollRptID,                               -1,   true},
+{tag::TransactTime,                            -1,   false},
+{tag::CollRptStatus,                           -1,   true},
+{tag::CollRptRejectReason,                     -1,   false},
+{tag::RejectText,                              -1,   false},
+{tag::EncodedRejectTextLen,                    -1,   false},
+{tag::EncodedRejectText,                       -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::MDReportID,                              -1,   false},
+{tag::MDReportEvent,                           -1,   true},
+{tag::MDReportCount,                           -1,   true},
+{tag::TransactTime,                            -1,   false},
+{tag::TotNumReports,                           -1,   false},
+{tag::TotNoMarketSegmentReports,               -1,   false},
+{tag::TotNoInstrumentReports,                  -1,   false},
+{tag::TotNoPartyDetailReports,                 -1,   false},
+{tag::TotNoEntitlementReports,                 -1,   false},
+{tag::TotNoRiskLimitReports,                   -1,   false},
+{tag::CrossRequestID,                          -1,   true},
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{0,                                            3,    true}, // Instrument
+{tag::OrderQty,                                -1,   false},
+{tag::ComplianceID,                            -1,   false},
+{tag::ComplianceText,                          -1,   false},
+{tag::CrossRequestID,                          -1,   true},
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{0,                                            3,    true}, // Instrument
+{tag::OrderQty,                                -1,   false},
+{tag::ComplianceID,                            -1,   false},
+{tag::ComplianceText,                          -1,   false},
+{tag::AllocRequestID,                          -1,   false},
+{tag::AllocGroupID,                            -1,   false},
+{tag::AvgPxGroupID,                            -1,   false},
+{tag::TradeDate,                               -1,   false},
+{tag::ListID,                                  -1,   true},
+{tag::BidID,                                   -1,   false},
+{tag::ClientBidID,                             -1,   false},
+{tag::ProgRptReqs,                             -1,   false},
+{tag::BidType,                                 -1,   true},
+{tag::ProgPeriodInterval,                      -1,   false},
+{tag::CancellationRights,                      -1,   false},
+{tag::MoneyLaunderingStatus,                   -1,   false},
+{tag::RegistID,                                -1,   false},
+{tag::ListExecInstType,                        -1,   false},
+{tag::ListExecInst,                            -1,   false},
+{tag::ContingencyType,                         -1,   false},
+{tag::EncodedListExecInstLen,                  -1,   false},
+{tag::EncodedListExecInst,                     -1,   false},
+{tag::AllowableOneSidednessPct,                -1,   false},
+{tag::AllowableOneSidednessValue,              -1,   false},
+{tag::AllowableOneSidednessCurr,               -1,   false},
+{tag::ListManualOrderIndicator,                -1,   false},
+{tag::TotNoOrders,                             -1,   true},
+{tag::LastFragment,                            -1,   false},
+{tag::NoRootPartyIDs,                          117,  false}, // RootParties
+{tag::NoOrders,                                54,   true}, // ListOrdGrp
+{tag::ThrottleInst,                            -1,   false},
+{tag::OrderRequestID,                          -1,   false},
+{tag::OrigClOrdID,                             -1,   false},
+{tag::OrderID,                                 -1,   false},
+{tag::ClOrdID,                                 -1,   true},
+{tag::SecondaryClOrdID,                        -1,   false},
+{tag::ClOrdLinkID,                             -1,   false},
+{tag::ListID,                                  -1,   false},
+{tag::OrigOrdModTime,                          -1,   false},
+{tag::Account,                                 -1,   false},
+{tag::AcctIDSource,                            -1,   false},
+{tag::AccountType,                             -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{0,                                            3,    true}, // Instrument
+{0,                                            2,    false}, // FinancingDetails
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::MarketSegmentID,                         -1,   false},
+{tag::ExDestination,                           -1,   false},
+{tag::ExDestinationIDSource,                   -1,   false},
+{tag::Side,                                    -1,   true},
+{tag::TransactTime,                            -1,   true},
+{0,                                            9,    false}, // OrderQtyData
+{tag::ComplianceID,                            -1,   false},
+{tag::ComplianceText,                          -1,   false},
+{tag::EncodedComplianceTextLen,                -1,   false},
+{tag::EncodedComplianceText,                   -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::OrderID,                                 -1,   false},
+{tag::OrderRequestID,                          -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::NoTargetPartyIDs,                        167,  false}, // TargetParties
+{tag::TradeOriginationDate,                    -1,   false},
+{tag::TradeDate,                               -1,   false},
+{tag::OrigClOrdID,                             -1,   false},
+{tag::ClOrdID,                                 -1,   true},
+{tag::SecondaryClOrdID,                        -1,   false},
+{tag::ClOrdLinkID,                             -1,   false},
+{tag::ListID,                                  -1,   false},
+{tag::OrigOrdModTime,                          -1,   false},
+{tag::Account,                                 -1,   false},
+{tag::AcctIDSource,                            -1,   false},
+{tag::AccountType,                             -1,   false},
+{tag::DayBookingInst,                          -1,   false},
+{tag::BookingUnit,                             -1,   false},
+{tag::PreallocMethod,                          -1,   false},
+{tag::AllocID,                                 -1,   false},
+{tag::NoAllocs,                                63,   false}, // PreAllocGrp
+{tag::SettlType,                               -1,   false},
+{tag::SettlDate,                               -1,   false},
+{tag::CashMargin,                              -1,   false},
+{tag::ClearingFeeIndicator,                    -1,   false},
+{tag::HandlInst,                               -1,   false},
+{tag::ExecInst,                                -1,   false},
+{tag::AuctionInstruction,                      -1,   false},
+{tag::MinQty,                                  -1,   false},
+{tag::MinQtyMethod,                            -1,   false},
+{tag::MatchIncrement,                          -1,   false},
+{tag::MaxPriceLevels,                          -1,   false},
+{tag::MaximumPricePercentage,                  -1,   false},
+{tag::NoValueChecks,                           230,  false}, // ValueChecksGrp
+{tag::NoMatchInst,                             176,  false}, // MatchingInstructions
+{tag::SelfMatchPreventionID,                   -1,   false},
+{0,                                            115,  false}, // DisplayInstruction
+{tag::NoDisclosureInstructions,                222,  false}, // DisclosureInstructionGrp
+{tag::MaxFloor,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::ExDestination,                           -1,   false},
+{tag::ExDestinationIDSource,                   -1,   false},
+{tag::ExDestinationType,                       -1,   false},
+{tag::NoTradingSessions,                       88,   false}, // TrdgSesGrp
+{0,                                            3,    true}, // Instrument
+{0,                                            2,    false}, // FinancingDetails
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::Side,                                    -1,   true},
+{tag::ShortMarkingExemptIndicator,             -1,   false},
+{tag::ShortSaleExemptionReason,                -1,   false},
+{tag::TransactTime,                            -1,   true},
+{tag::QtyType,                                 -1,   false},
+{0,                                            9,    true}, // OrderQtyData
+{tag::OrdType,                                 -1,   true},
+{tag::PriceType,                               -1,   false},
+{tag::Price,                                   -1,   false},
+{tag::PriceProtectionScope,                    -1,   false},
+{tag::StopPx,                                  -1,   false},
+{0,                                            116,  false}, // TriggeringInstruction
+{0,                                            16,   false}, // SpreadOrBenchmarkCurveData
+{0,                                            20,   false}, // YieldData
+{0,                                            11,   false}, // PegInstructions
+{0,                                            1,    false}, // DiscretionInstructions
+{tag::TargetStrategy,                          -1,   false},
+{tag::NoStrategyParameters,                    104,  false}, // StrategyParametersGrp
+{tag::TargetStrategyParameters,                -1,   false},
+{tag::ParticipationRate,                       -1,   false},
+{tag::ComplianceID,                            -1,   false},
+{tag::ComplianceText,                          -1,   false},
+{tag::EncodedComplianceTextLen,                -1,   false},
+{tag::EncodedComplianceText,                   -1,   false},
+{tag::SolicitedFlag,                           -1,   false},
+{tag::Currency,                                -1,   false},
+{tag::TimeInForce,                             -1,   false},
+{tag::EffectiveTime,                           -1,   false},
+{tag::ExpireDate,                              -1,   false},
+{tag::ExpireTime,                              -1,   false},
+{tag::GTBookingInst,                           -1,   false},
+{tag::ExposureDuration,                        -1,   false},
+{tag::ExposureDurationUnit,                    -1,   false},
+{0,                                            0,    false}, // CommissionData
+{tag::NoCommissions,                           594,  false}, // CommissionDataGrp
+{tag::OrderCapacity,                           -1,   false},
+{tag::OrderRestrictions,                       -1,   false},
+{tag::TradingCapacity,                         -1,   false},
+{tag::PreTradeAnonymity,                       -1,   false},
+{tag::TradePublishIndicator,                   -1,   false},
+{tag::CustOrderCapacity,                       -1,   false},
+{tag::NoOrderAttributes,                       709,  false}, // OrderAttributeGrp
+{tag::ForexReq,                                -1,   false},
+{tag::SettlCurrency,                           -1,   false},
+{tag::BookingType,                             -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::SettlDate2,                              -1,   false},
+{tag::OrderQty2,                               -1,   false},
+{tag::Price2,                                  -1,   false},
+{tag::ClearingAccountType,                     -1,   false},
+{tag::PositionEffect,                          -1,   false},
+{tag::CoveredOrUncovered,                      -1,   false},
+{tag::MaxShow,                                 -1,   false},
+{tag::LocateReqd,                              -1,   false},
+{tag::CancellationRights,                      -1,   false},
+{tag::MoneyLaunderingStatus,                   -1,   false},
+{tag::RegistID,                                -1,   false},
+{tag::Designation,                             -1,   false},
+{tag::ManualOrderIndicator,                    -1,   false},
+{tag::CustDirectedOrder,                       -1,   false},
+{tag::ReceivedDeptID,                          -1,   false},
+{tag::CustOrderHandlingInst,                   -1,   false},
+{tag::OrderHandlingInstSource,                 -1,   false},
+{tag::OrderOrigination,                        -1,   false},
+{tag::OriginatingDeptID,                       -1,   false},
+{tag::ReceivingDeptID,                         -1,   false},
+{tag::OwnerType,                               -1,   false},
+{tag::OrderOwnershipIndicator,                 -1,   false},
+{tag::NoTrdRegTimestamps,                      18,   false}, // TrdRegTimestamps
+{tag::ThrottleInst,                            -1,   false},
+{tag::AuctionType,                             -1,   false},
+{tag::AuctionAllocationPct,                    -1,   false},
+{tag::ReleaseInstruction,                      -1,   false},
+{tag::ReleaseQty,                              -1,   false},
+{tag::OrderID,                                 -1,   false},
+{tag::ClOrdID,                                 -1,   false},
+{tag::SecondaryClOrdID,                        -1,   false},
+{tag::ClOrdLinkID,                             -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::OrdStatusReqID,                          -1,   false},
+{tag::Account,                                 -1,   false},
+{tag::AcctIDSource,                            -1,   false},
+{0,                                            3,    true}, // Instrument
+{0,                                            2,    false}, // FinancingDetails
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::MarketSegmentID,                         -1,   false},
+{tag::Side,                                    -1,   true},
+{tag::AllocID,                                 -1,   true},
+{tag::AllocTransType,                          -1,   true},
+{tag::AllocType,                               -1,   true},
+{tag::SecondaryAllocID,                        -1,   false},
+{tag::RefAllocID,                              -1,   false},
+{tag::AllocCancReplaceReason,                  -1,   false},
+{tag::AllocIntermedReqType,                    -1,   false},
+{tag::AllocLinkID,                             -1,   false},
+{tag::AllocLinkType,                           -1,   false},
+{tag::AllocGroupID,                            -1,   false},
+{tag::FirmGroupID,                             -1,   false},
+{tag::BookingRefID,                            -1,   false},
+{tag::AllocNoOrdersType,                       -1,   false},
+{tag::NoOrders,                                60,   false}, // OrdAllocGrp
+{tag::NoExecs,                                 39,   false}, // ExecAllocGrp
+{tag::PreviouslyReported,                      -1,   false},
+{tag::ReversalIndicator,                       -1,   false},
+{tag::MatchType,                               -1,   false},
+{tag::Side,                                    -1,   true},
+{0,                                            3,    true}, // Instrument
+{0,                                            4,    false}, // InstrumentExtension
+{0,                                            2,    false}, // FinancingDetails
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::Quantity,                                -1,   true},
+{tag::QtyType,                                 -1,   false},
+{tag::LastMkt,                                 -1,   false},
+{tag::TradeOriginationDate,                    -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::PriceType,                               -1,   false},
+{tag::NoPriceQualifiers,                       712,  false}, // PriceQualifierGrp
+{tag::AvgPx,                                   -1,   false},
+{tag::AvgParPx,                                -1,   false},
+{0,                                            16,   false}, // SpreadOrBenchmarkCurveData
+{tag::Currency,                                -1,   false},
+{tag::AvgPxPrecision,                          -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::TradeDate,                               -1,   true},
+{tag::TransactTime,                            -1,   false},
+{tag::SettlType,                               -1,   false},
+{tag::SettlDate,                               -1,   false},
+{tag::BookingType,                             -1,   false},
+{tag::GrossTradeAmt,                           -1,   false},
+{tag::Concession,                              -1,   false},
+{tag::TotalTakedown,                           -1,   false},
+{tag::NetMoney,                                -1,   false},
+{tag::PositionEffect,                          -1,   false},
+{tag::AutoAcceptIndicator,                     -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::NumDaysInterest,                         -1,   false},
+{tag::AccruedInterestRate,                     -1,   false},
+{tag::AccruedInterestAmt,                      -1,   false},
+{tag::TotalAccruedInterestAmt,                 -1,   false},
+{tag::InterestAtMaturity,                      -1,   false},
+{tag::EndAccruedInterestAmt,                   -1,   false},
+{tag::StartCash,                               -1,   false},
+{tag::EndCash,                                 -1,   false},
+{tag::LegalConfirm,                            -1,   false},
+{tag::NoStipulations,                          17,   false}, // Stipulations
+{0,                                            20,   false}, // YieldData
+{tag::NoRegulatoryTradeIDs,                    306,  false}, // RegulatoryTradeIDGrp
+{tag::NoPosAmt,                                12,   false}, // PositionAmountData
+{tag::TotNoAllocs,                             -1,   false},
+{tag::LastFragment,                            -1,   false},
+{tag::NoAllocs,                                28,   false}, // AllocGrp
+{tag::AvgPxIndicator,                          -1,   false},
+{tag::AvgPxGroupID,                            -1,   false},
+{tag::ClearingBusinessDate,                    -1,   false},
+{tag::TrdType,                                 -1,   false},
+{tag::TrdSubType,                              -1,   false},
+{tag::SecondaryTrdType,                        -1,   false},
+{tag::TradeContinuation,                       -1,   false},
+{tag::CustOrderCapacity,                       -1,   false},
+{tag::TradeInputSource,                        -1,   false},
+{tag::MultiLegReportingType,                   -1,   false},
+{tag::MessageEventSource,                      -1,   false},
+{tag::RndPx,                                   -1,   false},
+{tag::NoRateSources,                           166,  false}, // RateSource
+{tag::VenueType,                               -1,   false},
+{tag::RefRiskLimitCheckID,                     -1,   false},
+{tag::RefRiskLimitCheckIDType,                 -1,   false},
+{tag::RiskLimitCheckStatus,                    -1,   false},
+{tag::ListID,                                  -1,   true},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::TransactTime,                            -1,   true},
+{tag::TradeOriginationDate,                    -1,   false},
+{tag::TradeDate,                               -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::ListID,                                  -1,   true},
+{tag::ClientBidID,                             -1,   false},
+{tag::BidID,                                   -1,   false},
+{tag::TransactTime,                            -1,   true},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::ListID,                                  -1,   true},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::ListID,                                  -1,   true},
+{tag::ListStatusType,                          -1,   true},
+{tag::NoRpts,                                  -1,   true},
+{tag::ListOrderStatus,                         -1,   true},
+{tag::ContingencyType,                         -1,   false},
+{tag::ListRejectReason,                        -1,   false},
+{tag::RptSeq,                                  -1,   true},
+{tag::ListStatusText,                          -1,   false},
+{tag::EncodedListStatusTextLen,                -1,   false},
+{tag::EncodedListStatusText,                   -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::TotNoOrders,                             -1,   true},
+{tag::LastFragment,                            -1,   false},
+{tag::NoOrders,                                61,   true}, // OrdListStatGrp
+{tag::AllocID,                                 -1,   true},
+{0,                                            3,    false}, // Instrument
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::SecondaryAllocID,                        -1,   false},
+{tag::AllocGroupID,                            -1,   false},
+{tag::FirmGroupID,                             -1,   false},
+{tag::AvgPxGroupID,                            -1,   false},
+{tag::TradeDate,                               -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::AllocStatus,                             -1,   true},
+{tag::AllocRejCode,                            -1,   false},
+{tag::AllocType,                               -1,   false},
+{tag::AllocIntermedReqType,                    -1,   false},
+{tag::MatchStatus,                             -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::RejectText,                              -1,   false},
+{tag::EncodedRejectTextLen,                    -1,   false},
+{tag::EncodedRejectText,                       -1,   false},
+{tag::NoRegulatoryTradeIDs,                    306,  false}, // RegulatoryTradeIDGrp
+{tag::NoAllocs,                                27,   false}, // AllocAckGrp
+{tag::OrderID,                                 -1,   true},
+{tag::SecondaryOrderID,                        -1,   false},
+{tag::ExecID,                                  -1,   true},
+{tag::DKReason,                                -1,   true},
+{0,                                            3,    true}, // Instrument
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::Side,                                    -1,   true},
+{0,                                            9,    true}, // OrderQtyData
+{tag::LastQty,                                 -1,   false},
+{tag::LastPx,                                  -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::QuoteReqID,                              -1,   true},
+{tag::RFQReqID,                                -1,   false},
+{tag::ClOrdID,                                 -1,   false},
+{tag::BookingType,                             -1,   false},
+{tag::OrderCapacity,                           -1,   false},
+{tag::OrderRestrictions,                       -1,   false},
+{tag::PrivateQuote,                            -1,   false},
+{tag::RespondentType,                          -1,   false},
+{tag::PreTradeAnonymity,                       -1,   false},
+{tag::NoRootPartyIDs,                          117,  false}, // RootParties
+{tag::NoRelatedSym,                            69,   true}, // QuotReqGrp
+{tag::ComplianceID,                            -1,   false},
+{tag::ComplianceText,                          -1,   false},
+{tag::EncodedComplianceTextLen,                -1,   false},
+{tag::EncodedComplianceText,                   -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::QuoteReqID,                              -1,   false},
+{tag::QuoteID,                                 -1,   true},
+{tag::BidID,                                   -1,   false},
+{tag::OfferID,                                 -1,   false},
+{tag::SecondaryQuoteID,                        -1,   false},
+{tag::QuoteMsgID,                              -1,   false},
+{tag::QuoteRespID,                             -1,   false},
+{tag::QuoteType,                               -1,   false},
+{tag::QuoteModelType,                          -1,   false},
+{tag::PrivateQuote,                            -1,   false},
+{tag::NoQuoteQualifiers,                       68,   false}, // QuotQualGrp
+{tag::NegotiationMethod,                       -1,   false},
+{tag::QuoteResponseLevel,                      -1,   false},
+{tag::NoQuoteAttributes,                       711,  false}, // QuoteAttributeGrp
+{tag::NoValueChecks,                           230,  false}, // ValueChecksGrp
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{0,                                            3,    true}, // Instrument
+{0,                                            2,    false}, // FinancingDetails
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::Side,                                    -1,   false},
+{0,                                            9,    false}, // OrderQtyData
+{tag::SettlType,                               -1,   false},
+{tag::SettlDate,                               -1,   false},
+{tag::SettlDate2,                              -1,   false},
+{tag::OrderQty2,                               -1,   false},
+{tag::Currency,                                -1,   false},
+{tag::SettlCurrency,                           -1,   false},
+{tag::NoRateSources,                           166,  false}, // RateSource
+{tag::NoStipulations,                          17,   false}, // Stipulations
+{tag::Account,                                 -1,   false},
+{tag::AcctIDSource,                            -1,   false},
+{tag::AccountType,                             -1,   false},
+{tag::NoLegs,                                  51,   false}, // LegQuotGrp
+{tag::BidPx,                                   -1,   false},
+{tag::OfferPx,                                 -1,   false},
+{tag::MktBidPx,                                -1,   false},
+{tag::MktOfferPx,                              -1,   false},
+{tag::MinBidSize,                              -1,   false},
+{tag::BidSize,                                 -1,   false},
+{tag::TotalBidSize,                            -1,   false},
+{tag::MinOfferSize,                            -1,   false},
+{tag::OfferSize,                               -1,   false},
+{tag::TotalOfferSize,                          -1,   false},
+{tag::MinQty,                                  -1,   false},
+{tag::ExposureDuration,                        -1,   false},
+{tag::ExposureDurationUnit,                    -1,   false},
+{tag::ValidUntilTime,                          -1,   false},
+{tag::BidSpotRate,                             -1,   false},
+{tag::OfferSpotRate,                           -1,   false},
+{tag::BidForwardPoints,                        -1,   false},
+{tag::OfferForwardPoints,                      -1,   false},
+{tag::BidSwapPoints,                           -1,   false},
+{tag::OfferSwapPoints,                         -1,   false},
+{tag::MidPx,                                   -1,   false},
+{tag::BidYield,                                -1,   false},
+{tag::MidYield,                                -1,   false},
+{tag::OfferYield,                              -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::OrdType,                                 -1,   false},
+{tag::BidForwardPoints2,                       -1,   false},
+{tag::OfferForwardPoints2,                     -1,   false},
+{tag::SettlCurrBidFxRate,                      -1,   false},
+{tag::SettlCurrOfferFxRate,                    -1,   false},
+{tag::SettlCurrFxRateCalc,                     -1,   false},
+{0,                                            0,    false}, // CommissionData
+{tag::CustOrderCapacity,                       -1,   false},
+{tag::ExDestination,                           -1,   false},
+{tag::ExDestinationIDSource,                   -1,   false},
+{tag::BookingType,                             -1,   false},
+{tag::OrderCapacity,                           -1,   false},
+{tag::OrderRestrictions,                       -1,   false},
+{tag::PriceType,                               -1,   false},
+{tag::NoPriceQualifiers,                       712,  false}, // PriceQualifierGrp
+{tag::BidSpread,                               -1,   false},
+{tag::OfferSpread,                             -1,   false},
+{0,                                            16,   false}, // SpreadOrBenchmarkCurveData
+{tag::NoRelativeValues,                        586,  false}, // RelativeValueGrp
+{0,                                            20,   false}, // YieldData
+{tag::NoRoutingIDs,                            78,   false}, // RoutingGrp
+{tag::SelfMatchPreventionID,                   -1,   false},
+{tag::ThrottleInst,                            -1,   false},
+{tag::ComplianceID,                            -1,   false},
+{tag::ComplianceText,                          -1,   false},
+{tag::EncodedComplianceTextLen,                -1,   false},
+{tag::EncodedComplianceText,                   -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::StrikeTime,                              -1,   false},
+{tag::SettlInstMsgID,                          -1,   true},
+{tag::SettlInstReqID,                          -1,   false},
+{tag::SettlInstMode,                           -1,   true},
+{tag::SettlInstReqRejCode,                     -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::ClOrdID,                                 -1,   false},
+{tag::TransactTime,                            -1,   true},
+{tag::NoSettlInst,                             81,   false}, // SettlInstGrp
+{tag::MDReqID,                                 -1,   true},
+{tag::SubscriptionRequestType,                 -1,   true},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::MarketDepth,                             -1,   true},
+{tag::MDUpdateType,                            -1,   false},
+{tag::AggregatedBook,                          -1,   false},
+{tag::OpenCloseSettlFlag,                      -1,   false},
+{tag::Scope,                                   -1,   false},
+{tag::MDImplicitDelete,                        -1,   false},
+{tag::NoMDEntryTypes,                          57,   true}, // MDReqGrp
+{tag::NoMarketSegments,                        217,  false}, // MarketSegmentScopeGrp
+{tag::NoRelatedSym,                            46,   true}, // InstrmtMDReqGrp
+{tag::NoTradingSessions,                       88,   false}, // TrdgSesGrp
+{tag::ApplQueueAction,                         -1,   false},
+{tag::ApplQueueMax,                            -1,   false},
+{tag::MDQuoteType,                             -1,   false},
+{tag::FastMarketIndicator,                     -1,   false},
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::TotNumReports,                           -1,   false},
+{tag::MDReportID,                              -1,   false},
+{tag::ClearingBusinessDate,                    -1,   false},
+{tag::MDBookType,                              -1,   false},
+{tag::MDSubBookType,                           -1,   false},
+{tag::MarketDepth,                             -1,   false},
+{tag::MDFeedType,                              -1,   false},
+{tag::MDSubFeedType,                           -1,   false},
+{tag::RefreshIndicator,                        -1,   false},
+{tag::TradeDate,                               -1,   false},
+{tag::MDReqID,                                 -1,   false},
+{tag::MDStreamID,                              -1,   false},
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{0,                                            3,    true}, // Instrument
+{0,                                            4,    false}, // InstrumentExtension
+{0,                                            2,    false}, // FinancingDetails
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::NoRelatedInstruments,                    180,  false}, // RelatedInstrumentGrp
+{tag::LastUpdateTime,                          -1,   true},
+{tag::FinancialStatus,                         -1,   false},
+{tag::CorporateAction,                         -1,   false},
+{tag::NetChgPrevDay,                           -1,   false},
+{tag::MDSecurityTradingStatus,                 -1,   false},
+{tag::MDHaltReason,                            -1,   false},
+{tag::NoMDEntries,                             55,   true}, // MDFullGrp
+{tag::ApplQueueDepth,                          -1,   false},
+{tag::ApplQueueResolution,                     -1,   false},
+{tag::NoRoutingIDs,                            78,   false}, // RoutingGrp
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::MDBookType,                              -1,   false},
+{tag::MDFeedType,                              -1,   false},
+{tag::MDSubFeedType,                           -1,   false},
+{tag::TradeDate,                               -1,   false},
+{tag::MDReqID,                                 -1,   false},
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::NoMDEntries,                             56,   true}, // MDIncGrp
+{tag::ApplQueueDepth,                          -1,   false},
+{tag::ApplQueueResolution,                     -1,   false},
+{tag::NoRoutingIDs,                            78,   false}, // RoutingGrp
+{tag::MDReqID,                                 -1,   true},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::MDReqRejReason,                          -1,   false},
+{tag::NoAltMDSource,                           58,   false}, // MDRjctGrp
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::QuoteReqID,                              -1,   false},
+{tag::QuoteID,                                 -1,   false},
+{tag::SecondaryQuoteID,                        -1,   false},
+{tag::QuoteMsgID,                              -1,   false},
+{tag::QuoteCancelType,                         -1,   true},
+{tag::QuoteType,                               -1,   false},
+{tag::QuoteResponseLevel,                      -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::NoTargetPartyIDs,                        167,  false}, // TargetParties
+{tag::Account,                                 -1,   false},
+{tag::AcctIDSource,                            -1,   false},
+{tag::AccountType,                             -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::NoQuoteEntries,                          65,   false}, // QuotCxlEntriesGrp
+{tag::QuoteStatusReqID,                        -1,   false},
+{tag::QuoteID,                                 -1,   false},
+{0,                                            3,    false}, // Instrument
+{0,                                            2,    false}, // FinancingDetails
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::NoTargetPartyIDs,                        167,  false}, // TargetParties
+{tag::Account,                                 -1,   false},
+{tag::AcctIDSource,                            -1,   false},
+{tag::AccountType,                             -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::SubscriptionRequestType,                 -1,   false},
+{tag::QuoteReqID,                              -1,   false},
+{tag::QuoteID,                                 -1,   false},
+{tag::QuoteStatus,                             -1,   true},
+{tag::QuoteRejectReason,                       -1,   false},
+{tag::QuoteResponseLevel,                      -1,   false},
+{tag::QuoteType,                               -1,   false},
+{tag::QuoteCancelType,                         -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::NoTargetPartyIDs,                        167,  false}, // TargetParties
+{tag::Account,                                 -1,   false},
+{tag::AcctIDSource,                            -1,   false},
+{tag::AccountType,                             -1,   false},
+{tag::ComplianceID,                            -1,   false},
+{tag::ComplianceText,                          -1,   false},
+{tag::EncodedComplianceTextLen,                -1,   false},
+{tag::EncodedComplianceText,                   -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::NoQuoteSets,                             72,   false}, // QuotSetAckGrp
+{0,                                            208,  false}, // ThrottleResponse
+{tag::SecurityReqID,                           -1,   true},
+{tag::SecurityRequestType,                     -1,   true},
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{0,                                            3,    false}, // Instrument
+{0,                                            4,    false}, // InstrumentExtension
+{0,                                            2,    false}, // FinancingDetails
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoRelatedInstruments,                    180,  false}, // RelatedInstrumentGrp
+{tag::Currency,                                -1,   false},
+{tag::ComplianceID,                            -1,   false},
+{tag::ComplianceText,                          -1,   false},
+{tag::EncodedComplianceTextLen,                -1,   false},
+{tag::EncodedComplianceText,                   -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::NoStipulations,                          17,   false}, // Stipulations
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{0,                                            16,   false}, // SpreadOrBenchmarkCurveData
+{0,                                            20,   false}, // YieldData
+{tag::ExpirationCycle,                         -1,   false},
+{tag::SubscriptionRequestType,                 -1,   false},
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::SecurityReportID,                        -1,   false},
+{tag::ClearingBusinessDate,                    -1,   false},
+{tag::SecurityReqID,                           -1,   false},
+{tag::OrderRequestID,                          -1,   false},
+{tag::SecurityResponseID,                      -1,   false},
+{tag::SecurityResponseType,                    -1,   false},
+{tag::SecurityRequestResult,                   -1,   false},
+{tag::SecurityRejectReason,                    -1,   false},
+{tag::CorporateAction,                         -1,   false},
+{0,                                            3,    false}, // Instrument
+{0,                                            4,    false}, // InstrumentExtension
+{0,                                            2,    false}, // FinancingDetails
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoRelatedInstruments,                    180,  false}, // RelatedInstrumentGrp
+{tag::NoSecurityClassifications,               205,  false}, // SecurityClassificationGrp
+{tag::Currency,                                -1,   false},
+{tag::PreviousAdjustedOpenInterest,            -1,   false},
+{tag::PreviousUnadjustedOpenInterest,          -1,   false},
+{tag::PriorSettlPrice,                         -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::NoStipulations,                          17,   false}, // Stipulations
+{tag::NumOfSimpleInstruments,                  -1,   false},
+{tag::NumOfComplexInstruments,                 -1,   false},
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{0,                                            16,   false}, // SpreadOrBenchmarkCurveData
+{0,                                            20,   false}, // YieldData
+{tag::NoMarketSegments,                        141,  false}, // MarketSegmentGrp
+{tag::LastUpdateTime,                          -1,   false},
+{tag::EffectiveBusinessDate,                   -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::SecurityStatusReqID,                     -1,   true},
+{0,                                            3,    true}, // Instrument
+{0,                                            4,    false}, // InstrumentExtension
+{0,                                            2,    false}, // FinancingDetails
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::NoRelatedInstruments,                    180,  false}, // RelatedInstrumentGrp
+{tag::Currency,                                -1,   false},
+{tag::SubscriptionRequestType,                 -1,   true},
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::SecurityStatusReqID,                     -1,   false},
+{0,                                            3,    true}, // Instrument
+{0,                                            4,    false}, // InstrumentExtension
+{0,                                            2,    false}, // FinancingDetails
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::NoRelatedInstruments,                    180,  false}, // RelatedInstrumentGrp
+{tag::Currency,                                -1,   false},
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::TradeDate,                               -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::UnsolicitedIndicator,                    -1,   false},
+{tag::SecurityTradingStatus,                   -1,   false},
+{tag::MarketMakerActivity,                     -1,   false},
+{tag::FastMarketIndicator,                     -1,   false},
+{tag::SecurityTradingEvent,                    -1,   false},
+{tag::NextAuctionTime,                         -1,   false},
+{tag::FinancialStatus,                         -1,   false},
+{tag::CorporateAction,                         -1,   false},
+{tag::HaltReason,                              -1,   false},
+{tag::InViewOfCommon,                          -1,   false},
+{tag::DueToRelated,                            -1,   false},
+{tag::MDBookType,                              -1,   false},
+{tag::MarketDepth,                             -1,   false},
+{tag::BuyVolume,                               -1,   false},
+{tag::SellVolume,                              -1,   false},
+{tag::HighPx,                                  -1,   false},
+{tag::LowPx,                                   -1,   false},
+{tag::LastPx,                                  -1,   false},
+{tag::NoClearingPriceParameters,               592,  false}, // ClearingPriceParametersGrp
+{tag::SettlPrice,                              -1,   false},
+{tag::SettlPriceType,                          -1,   false},
+{tag::SettlPriceDeterminationMethod,           -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::Adjustment,                              -1,   false},
+{tag::FirstPx,                                 -1,   false},
+{tag::LinkageHandlingIndicator,                -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::TradSesReqID,                            -1,   true},
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::TradSesMethod,                           -1,   false},
+{tag::TradSesMode,                             -1,   false},
+{tag::SubscriptionRequestType,                 -1,   true},
+{tag::SecurityExchange,                        -1,   false},
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::TradSesReqID,                            -1,   false},
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::TradeDate,                               -1,   false},
+{tag::TradingSessionID,                        -1,   true},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::TradSesMethod,                           -1,   false},
+{tag::TradSesMode,                             -1,   false},
+{tag::UnsolicitedIndicator,                    -1,   false},
+{tag::TradSesStatus,                           -1,   true},
+{tag::TradSesEvent,                            -1,   false},
+{tag::FastMarketIndicator,                     -1,   false},
+{tag::TradSesStatusRejReason,                  -1,   false},
+{tag::TradSesStartTime,                        -1,   false},
+{tag::TradSesOpenTime,                         -1,   false},
+{tag::TradSesPreCloseTime,                     -1,   false},
+{tag::TradSesCloseTime,                        -1,   false},
+{tag::TradSesEndTime,                          -1,   false},
+{tag::TradSesControl,                          -1,   false},
+{tag::TotalVolumeTraded,                       -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{0,                                            3,    false}, // Instrument
+{tag::QuoteReqID,                              -1,   false},
+{tag::QuoteID,                                 -1,   true},
+{tag::QuoteType,                               -1,   false},
+{tag::QuoteModelType,                          -1,   false},
+{tag::QuoteResponseLevel,                      -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::Account,                                 -1,   false},
+{tag::AcctIDSource,                            -1,   false},
+{tag::AccountType,                             -1,   false},
+{tag::DefBidSize,                              -1,   false},
+{tag::DefOfferSize,                            -1,   false},
+{tag::NoQuoteSets,                             73,   true}, // QuotSetGrp
+{tag::SelfMatchPreventionID,                   -1,   false},
+{tag::ThrottleInst,                            -1,   false},
+{tag::ComplianceID,                            -1,   false},
+{tag::ComplianceText,                          -1,   false},
+{tag::EncodedComplianceTextLen,                -1,   false},
+{tag::EncodedComplianceText,                   -1,   false},
+{tag::RefSeqNum,                               -1,   false},
+{tag::RefMsgType,                              -1,   true},
+{tag::RefApplVerID,                            -1,   false},
+{tag::RefApplExtID,                            -1,   false},
+{tag::RefCstmApplVerID,                        -1,   false},
+{tag::BusinessRejectRefID,                     -1,   false},
+{tag::BusinessRejectReason,                    -1,   true},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::BidID,                                   -1,   false},
+{tag::ClientBidID,                             -1,   true},
+{tag::BidRequestTransType,                     -1,   true},
+{tag::ListName,                                -1,   false},
+{tag::TotNoRelatedSym,                         -1,   true},
+{tag::BidType,                                 -1,   true},
+{tag::NumTickets,                              -1,   false},
+{tag::Currency,                                -1,   false},
+{tag::SideValue1,                              -1,   false},
+{tag::SideValue2,                              -1,   false},
+{tag::NoBidDescriptors,                        31,   false}, // BidDescReqGrp
+{tag::NoBidComponents,                         29,   false}, // BidCompReqGrp
+{tag::LiquidityIndType,                        -1,   false},
+{tag::WtAverageLiquidity,                      -1,   false},
+{tag::ExchangeForPhysical,                     -1,   false},
+{tag::OutMainCntryUIndex,                      -1,   false},
+{tag::CrossPercent,                            -1,   false},
+{tag::ProgRptReqs,                             -1,   false},
+{tag::ProgPeriodInterval,                      -1,   false},
+{tag::IncTaxInd,                               -1,   false},
+{tag::ForexReq,                                -1,   false},
+{tag::NumBidders,                              -1,   false},
+{tag::TradeDate,                               -1,   false},
+{tag::BidTradeType,                            -1,   true},
+{tag::BasisPxType,                             -1,   true},
+{tag::StrikeTime,                              -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::BidID,                                   -1,   false},
+{tag::ClientBidID,                             -1,   false},
+{tag::NoBidComponents,                         30,   true}, // BidCompRspGrp
+{tag::ListID,                                  -1,   true},
+{tag::TotNoStrikes,                            -1,   true},
+{tag::LastFragment,                            -1,   false},
+{tag::NoStrikes,                               47,   true}, // InstrmtStrkPxGrp
+{tag::NoAttachments,                           396,  false}, // AttachmentGrp
+{tag::RegistID,                                -1,   true},
+{tag::ClearingBusinessDate,                    -1,   false},
+{tag::RegistTransType,                         -1,   true},
+{tag::RegistRefID,                             -1,   true},
+{tag::ClOrdID,                                 -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::Account,                                 -1,   false},
+{tag::AcctIDSource,                            -1,   false},
+{tag::RegistAcctType,                          -1,   false},
+{tag::TaxAdvantageType,                        -1,   false},
+{tag::OwnershipType,                           -1,   false},
+{tag::NoRegistDtls,                            77,   false}, // RgstDtlsGrp
+{tag::NoDistribInsts,                          76,   false}, // RgstDistInstGrp
+{tag::RegistID,                                -1,   true},
+{tag::RegistTransType,                         -1,   true},
+{tag::RegistRefID,                             -1,   true},
+{tag::ClOrdID,                                 -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::Account,                                 -1,   false},
+{tag::AcctIDSource,                            -1,   false},
+{tag::RegistStatus,                            -1,   true},
+{tag::RegistRejReasonCode,                     -1,   false},
+{tag::RegistRejReasonText,                     -1,   false},
+{tag::ClOrdID,                                 -1,   true},
+{tag::SecondaryClOrdID,                        -1,   false},
+{tag::MassCancelRequestType,                   -1,   true},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::NoTargetPartyIDs,                        167,  false}, // TargetParties
+{0,                                            3,    false}, // Instrument
+{0,                                            19,   false}, // UnderlyingInstrument
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::Side,                                    -1,   false},
+{tag::TransactTime,                            -1,   true},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::ClOrdID,                                 -1,   false},
+{tag::SecondaryClOrdID,                        -1,   false},
+{tag::OrderID,                                 -1,   true},
+{tag::MassActionReportID,                      -1,   true},
+{tag::SecondaryOrderID,                        -1,   false},
+{tag::MassCancelRequestType,                   -1,   true},
+{tag::MassCancelResponse,                      -1,   true},
+{tag::MassCancelRejectReason,                  -1,   false},
+{tag::TotalAffectedOrders,                     -1,   false},
+{tag::NoAffectedOrders,                        26,   false}, // AffectedOrdGrp
+{tag::NoNotAffectedOrders,                     156,  false}, // NotAffectedOrdGrp
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::NoPartyIDs,                              10,   false}, // Parties
+{tag::NoTargetPartyIDs,                        167,  false}, // TargetParties
+{0,                                            3,    false}, // Instrument
+{0,                                            19,   false}, // UnderlyingInstrument
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::Side,                                    -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::CrossID,                                 -1,   true},
+{tag::OrderRequestID,                          -1,   false},
+{tag::CrossType,                               -1,   true},
+{tag::CrossPrioritization,                     -1,   true},
+{tag::NoRootPartyIDs,                          117,  false}, // RootParties
+{tag::NoSides,                                 83,   true}, // SideCrossOrdModGrp
+{0,                                            3,    true}, // Instrument
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::SettlType,                               -1,   false},
+{tag::SettlDate,                               -1,   false},
+{tag::HandlInst,                               -1,   false},
+{tag::ExecInst,                                -1,   false},
+{tag::MinQty,                                  -1,   false},
+{tag::MinQtyMethod,                            -1,   false},
+{tag::MatchIncrement,                          -1,   false},
+{tag::MaxPriceLevels,                          -1,   false},
+{0,                                            115,  false}, // DisplayInstruction
+{tag::MaxFloor,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::ExDestination,                           -1,   false},
+{tag::ExDestinationIDSource,                   -1,   false},
+{tag::NoTradingSessions,                       88,   false}, // TrdgSesGrp
+{tag::ProcessCode,                             -1,   false},
+{tag::PrevClosePx,                             -1,   false},
+{tag::LocateReqd,                              -1,   false},
+{tag::TransactTime,                            -1,   true},
+{tag::TransBkdTime,                            -1,   false},
+{tag::NoStipulations,                          17,   false}, // Stipulations
+{tag::OrdType,                                 -1,   true},
+{tag::PriceType,                               -1,   false},
+{tag::Price,                                   -1,   false},
+{tag::PriceProtectionScope,                    -1,   false},
+{tag::StopPx,                                  -1,   false},
+{0,                                            116,  false}, // TriggeringInstruction
+{0,                                            16,   false}, // SpreadOrBenchmarkCurveData
+{0,                                            20,   false}, // YieldData
+{tag::Currency,                                -1,   false},
+{tag::ComplianceID,                            -1,   false},
+{tag::IOIID,                                   -1,   false},
+{tag::QuoteID,                                 -1,   false},
+{tag::TimeInForce,                             -1,   false},
+{tag::EffectiveTime,                           -1,   false},
+{tag::ExpireDate,                              -1,   false},
+{tag::ExpireTime,                              -1,   false},
+{tag::GTBookingInst,                           -1,   false},
+{tag::ExposureDuration,                        -1,   false},
+{tag::ExposureDurationUnit,                    -1,   false},
+{tag::TradingCapacity,                         -1,   false},
+{tag::MaxShow,                                 -1,   false},
+{0,                                            11,   false}, // PegInstructions
+{0,                                            1,    false}, // DiscretionInstructions
+{tag::TargetStrategy,                          -1,   false},
+{tag::NoStrategyParameters,                    104,  false}, // StrategyParametersGrp
+{tag::TargetStrategyParameters,                -1,   false},
+{tag::ParticipationRate,                       -1,   false},
+{tag::CancellationRights,                      -1,   false},
+{tag::MoneyLaunderingStatus,                   -1,   false},
+{tag::RegistID,                                -1,   false},
+{tag::Designation,                             -1,   false},
+{tag::ThrottleInst,                            -1,   false},
+{tag::OrderID,                                 -1,   false},
+{tag::OrderRequestID,                          -1,   false},
+{tag::CrossID,                                 -1,   true},
+{tag::OrigCrossID,                             -1,   true},
+{tag::HostCrossID,                             -1,   false},
+{tag::CrossType,                               -1,   true},
+{tag::CrossPrioritization,                     -1,   true},
+{tag::NoRootPartyIDs,                          117,  false}, // RootParties
+{tag::NoSides,                                 83,   true}, // SideCrossOrdModGrp
+{0,                                            3,    true}, // Instrument
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::SettlType,                               -1,   false},
+{tag::SettlDate,                               -1,   false},
+{tag::HandlInst,                               -1,   false},
+{tag::ExecInst,                                -1,   false},
+{tag::MinQty,                                  -1,   false},
+{tag::MinQtyMethod,                            -1,   false},
+{tag::MatchIncrement,                          -1,   false},
+{tag::MaxPriceLevels,                          -1,   false},
+{0,                                            115,  false}, // DisplayInstruction
+{tag::MaxFloor,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::ExDestination,                           -1,   false},
+{tag::ExDestinationIDSource,                   -1,   false},
+{tag::NoTradingSessions,                       88,   false}, // TrdgSesGrp
+{tag::ProcessCode,                             -1,   false},
+{tag::PrevClosePx,                             -1,   false},
+{tag::LocateReqd,                              -1,   false},
+{tag::TransactTime,                            -1,   true},
+{tag::TransBkdTime,                            -1,   false},
+{tag::NoStipulations,                          17,   false}, // Stipulations
+{tag::OrdType,                                 -1,   true},
+{tag::PriceType,                               -1,   false},
+{tag::Price,                                   -1,   false},
+{tag::PriceProtectionScope,                    -1,   false},
+{tag::StopPx,                                  -1,   false},
+{0,                                            116,  false}, // TriggeringInstruction
+{0,                                            16,   false}, // SpreadOrBenchmarkCurveData
+{0,                                            20,   false}, // YieldData
+{tag::Currency,                                -1,   false},
+{tag::ComplianceID,                            -1,   false},
+{tag::IOIID,                                   -1,   false},
+{tag::QuoteID,                                 -1,   false},
+{tag::TimeInForce,                             -1,   false},
+{tag::EffectiveTime,                           -1,   false},
+{tag::ExpireDate,                              -1,   false},
+{tag::ExpireTime,                              -1,   false},
+{tag::GTBookingInst,                           -1,   false},
+{tag::ExposureDuration,                        -1,   false},
+{tag::ExposureDurationUnit,                    -1,   false},
+{tag::TradingCapacity,                         -1,   false},
+{tag::MaxShow,                                 -1,   false},
+{0,                                            11,   false}, // PegInstructions
+{0,                                            1,    false}, // DiscretionInstructions
+{tag::TargetStrategy,                          -1,   false},
+{tag::NoStrategyParameters,                    104,  false}, // StrategyParametersGrp
+{tag::TargetStrategyParameters,                -1,   false},
+{tag::ParticipationRate,                       -1,   false},
+{tag::CancellationRights,                      -1,   false},
+{tag::MoneyLaunderingStatus,                   -1,   false},
+{tag::RegistID,                                -1,   false},
+{tag::Designation,                             -1,   false},
+{tag::ThrottleInst,                            -1,   false},
+{tag::OrderID,                                 -1,   false},
+{tag::OrderRequestID,                          -1,   false},
+{tag::CrossID,                                 -1,   true},
+{tag::OrigCrossID,                             -1,   true},
+{tag::HostCrossID,                             -1,   false},
+{tag::CrossType,                               -1,   true},
+{tag::CrossPrioritization,                     -1,   true},
+{tag::NoRootPartyIDs,                          117,  false}, // RootParties
+{tag::NoSides,                                 82,   true}, // SideCrossOrdCxlGrp
+{0,                                            3,    true}, // Instrument
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::MarketSegmentID,                         -1,   false},
+{tag::TransactTime,                            -1,   true},
+{tag::SecurityReqID,                           -1,   true},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::Product,                                 -1,   false},
+{tag::SecurityType,                            -1,   false},
+{tag::SecuritySubType,                         -1,   false},
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::SecurityReqID,                           -1,   true},
+{tag::SecurityResponseID,                      -1,   true},
+{tag::SecurityResponseType,                    -1,   true},
+{tag::TotNoSecurityTypes,                      -1,   false},
+{tag::LastFragment,                            -1,   false},
+{tag::NoSecurityTypes,                         80,   false}, // SecTypesGrp
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::SubscriptionRequestType,                 -1,   false},
+{tag::SecurityReqID,                           -1,   true},
+{tag::SecurityListRequestType,                 -1,   true},
+{tag::SecurityListID,                          -1,   false},
+{tag::SecurityListType,                        -1,   false},
+{tag::SecurityListTypeSource,                  -1,   false},
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{0,                                            3,    false}, // Instrument
+{0,                                            4,    false}, // InstrumentExtension
+{0,                                            2,    false}, // FinancingDetails
+{tag::NoUnderlyings,                           90,   false}, // UndInstrmtGrp
+{tag::NoLegs,                                  43,   false}, // InstrmtLegGrp
+{tag::NoRelatedInstruments,                    180,  false}, // RelatedInstrumentGrp
+{tag::Currency,                                -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::SubscriptionRequestType,                 -1,   false},
+{0,                                            159,  false}, // ApplicationSequenceControl
+{tag::SecurityReportID,                        -1,   false},
+{tag::ClearingBusinessDate,                    -1,   false},
+{tag::SecurityListID,                          -1,   false},
+{tag::SecurityListRefID,                       -1,   false},
+{tag::SecurityListDesc,                        -1,   false},
+{tag::EncodedSecurityListDescLen,              -1,   false},
+{tag::EncodedSecurityListDesc,                 -1,   false},
+{tag::SecurityListType,                        -1,   false},
+{tag::SecurityListTypeSource,                  -1,   false},
+{tag::SecurityReqID,                           -1,   false},
+{tag::SecurityResponseID,                      -1,   false},
+{tag::SecurityRequestResult,                   -1,   false},
+{tag::SecurityRejectReason,                    -1,   false},
+{tag::TransactTime,                            -1,   false},
+{tag::TotNoRelatedSym,                         -1,   false},
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{tag::LastFragment,                            -1,   false},
+{tag::NoRelatedSym,                            79,   false}, // SecListGrp
+{tag::SecurityReqID,                           -1,   true},
+{tag::SecurityListRequestType,                 -1,   true},
+{tag::MarketID,                                -1,   false},
+{tag::MarketSegmentID,                         -1,   false},
+{0,                                            19,   false}, // UnderlyingInstrument
+{0,                                            146,  false}, // DerivativeInstrument
+{tag::SecuritySubType,                         -1,   false},
+{tag::Currency,                                -1,   false},
+{tag::Text,                                    -1,   false},
+{tag::EncodedTextLen,                          -1,   false},
+{tag::EncodedText,                             -1,   false},
+{tag::TradingSessionID,                        -1,   false},
+{tag::TradingSessionSubID,                     -1,   false},
+{tag::SubscriptionRequestType,                 -1,   false}
+};
+
+//! Component layouts, in FIX Repository Components.xml order.
+static HFFIX_CONSTEXPR layout component_layouts[] = {
+{"CommissionData",                             0,     6},
+{"DiscretionInstructions",                     6,     13},
+{"FinancingDetails",                           13,    38},
+{"Instrument",                                 38,    203},
+{"InstrumentExtension",                        203,   211},
+{"InstrumentLeg",                              211,   374},
+{"LegBenchmarkCurveData",                      374,   379},
+{"LegStipulations",                            379,   381},
+{"NestedParties",                              381,   386},
+{"OrderQtyData",                               386,   391},
+{"Parties",                                    391,   396},
+{"PegInstructions",                            396,   407},
+{"PositionAmountData",                         407,   416},
+{"PositionQty",                                416,   425},
+{"SettlInstructionsData",                      425,   430},
+{"SettlParties",                               430,   435},
+{"SpreadOrBenchmarkCurveData",                 435,   443},
+{"Stipulations",                               443,   445},
+{"TrdRegTimestamps",                           445,   452},
+{"UnderlyingInstrument",                       452,   649},
+{"YieldData",                                  649,   655},
+{"UnderlyingStipulations",                     655,   657},
+{"StandardHeader",                             657,   687},
+{"StandardTrailer",                            687,   690},
+{"NestedParties2",                             690,   695},
+{"NestedParties3",                             695,   700},
+{"AffectedOrdGrp",                             700,   703},
+{"AllocAckGrp",                                703,   730},
+{"AllocGrp",                                   730,   784},
+{"BidCompReqGrp",                              784,   793},
+{"BidCompRspGrp",                              793,   808},
+{"BidDescReqGrp",                              808,   819},
+{"ClrInstGrp",                                 819,   820},
+{"CollInqQualGrp",                             820,   821},
+{"CompIDReqGrp",                               821,   825},
+{"CompIDStatGrp",                              825,   831},
+{"ContAmtGrp",                                 831,   834},
+{"ContraGrp",                                  834,   839},
+{"CpctyConfGrp",                               839,   842},
+{"ExecAllocGrp",                               842,   854},
+{"ExecCollGrp",                                854,   855},
+{"InstrmtGrp",                                 855,   859},
+{"InstrmtLegExecGrp",                          859,   887},
+{"InstrmtLegGrp",                              887,   889},
+{"InstrmtLegIOIGrp",                           889,   892},
+{"InstrmtLegSecListGrp",                       892,   897},
+{"InstrmtMDReqGrp",                            897,   910},
+{"InstrmtStrkPxGrp",                           910,   921},
+{"IOIQualGrp",                                 921,   922},
+{"LegOrdGrp",                                  922,   943},
+{"LegPreAllocGrp",                             943,   953},
+{"LegQuotGrp",                                 953,   969},
+{"LegQuotStatGrp",                             969,   978},
+{"LinesOfTextGrp",                             978,   981},
+{"ListOrdGrp",                                 981,   1076},
+{"MDFullGrp",                                  1076,  1165},
+{"MDIncGrp",                                   1165,  1271},
+{"MDReqGrp",                                   1271,  1272},
+{"MDRjctGrp",                                  1272,  1273},
+{"MiscFeesGrp",                                1273,  1282},
+{"OrdAllocGrp",                                1282,  1292},
+{"OrdListStatGrp",                             1292,  1305},
+{"PosUndInstrmtGrp",                           1305,  1310},
+{"PreAllocGrp",                                1310,  1321},
+{"PreAllocMlegGrp",                            1321,  1332},
+{"QuotCxlEntriesGrp",                          1332,  1336},
+{"QuotEntryAckGrp",                            1336,  1367},
+{"QuotEntryGrp",                               1367,  1398},
+{"QuotQualGrp",                                1398,  1399},
+{"QuotReqGrp",                                 1399,  1449},
+{"QuotReqLegsGrp",                             1449,  1460},
+{"QuotReqRjctGrp",                             1460,  1496},
+{"QuotSetAckGrp",                              1496,  1505},
+{"QuotSetGrp",                                 1505,  1511},
+{"RelSymDerivSecGrp",                          1511,  1522},
+{"RFQReqGrp",                                  1522,  1530},
+{"RgstDistInstGrp",                            1530,  1538},
+{"RgstDtlsGrp",                                1538,  1546},
+{"RoutingGrp",                                 1546,  1548},
+{"SecListGrp",                                 1548,  1567},
+{"SecTypesGrp",                                1567,  1572},
+{"SettlInstGrp",                               1572,  1594},
+{"SideCrossOrdCxlGrp",                         1594,  1611},
+{"SideCrossOrdModGrp",                         1611,  1652},
+{"TrdAllocGrp",                                1652,  1683},
+{"TrdCapRptSideGrp",                           1683,  1784},
+{"TrdCollGrp",                                 1784,  1786},
+{"TrdInstrmtLegGrp",                           1786,  1823},
+{"TrdgSesGrp",                                 1823,  1825},
+{"UndInstrmtCollGrp",                          1825,  1827},
+{"UndInstrmtGrp",                              1827,  1828},
+{"TrdCapDtGrp",                                1828,  1831},
+{"EvntGrp",                                    1831,  1841},
+{"SecAltIDGrp",                                1841,  1843},
+{"LegSecAltIDGrp",                             1843,  1845},
+{"UndSecAltIDGrp",                             1845,  1847},
+{"AttrbGrp",                                   1847,  1849},
+{"DlvyInstGrp",                                1849,  1852},
+{"SettlPtysSubGrp",                            1852,  1854},
+{"PtysSubGrp",                                 1854,  1856},
+{"NstdPtysSubGrp",                             1856,  1858},
+{"HopGrp",                                     1858,  1861},
+{"NstdPtys2SubGrp",                            1861,  1863},
+{"NstdPtys3SubGrp",                            1863,  1865},
+{"StrategyParametersGrp",                      1865,  1868},
+{"SecLstUpdRelSymGrp",                         1868,  1885},
+{"SecLstUpdRelSymsLegGrp",                     1885,  1890},
+{"UnderlyingAmount",                           1890,  1894},
+{"ExpirationQty",                              1894,  1896},
+{"InstrumentParties",                          1896,  1901},
+{"InstrumentPtysSubGrp",                       1901,  1903},
+{"SideTrdRegTS",                               1903,  1906},
+{"TrdCapRptAckSideGrp",                        1906,  1985},
+{"UndlyInstrumentParties",                     1985,  1990},
+{"UndlyInstrumentPtysSubGrp",                  1990,  1992},
+{"DisplayInstruction",                         1992,  2001},
+{"TriggeringInstruction",                      2001,  2017},
+{"RootParties",                                2017,  2022},
+{"RootSubParties",                             2022,  2024},
+{"TrdSessLstGrp",                              2024,  2047},
+{"MsgTypeGrp",                                 2047,  2052},
+{"SecurityTradingRules",                       2052,  2055},
+{"SettlDetails",                               2055,  2057},
+{"SettlObligationInstructions",                2057,  2073},
+{"SecSizesGrp",                                2073,  2075},
+{"StatsIndGrp",                                2075,  2076},
+{"SecurityXML",                                2076,  2079},
+{"TickRules",                                  2079,  2086},
+{"StrikeRules",                                2086,  2092},
+{"MaturityRules",                              2092,  2098},
+{"SecondaryPriceLimits",                       2098,  2102},
+{"PriceLimits",                                2102,  2106},
+{"MarketDataFeedTypes",                        2106,  2117},
+{"LotTypeRules",                               2117,  2119},
+{"MatchRules",                                 2119,  2123},
+{"ExecInstRules",                              2123,  2124},
+{"TimeInForceRules",                           2124,  2125},
+{"OrdTypeRules",                               2125,  2126},
+{"TradingSessionRules",                        2126,  2132},
+{"TradingSessionRulesGrp",                     2132,  2135},
+{"BaseTradingRules",                           2135,  2153},
+{"MarketSegmentGrp",                           2153,  2157},
+{"DerivativeInstrumentPartySubIDsGrp",         2157,  2159},
+{"DerivativeInstrumentParties",                2159,  2164},
+{"DerivativeInstrumentAttribute",              2164,  2166},
+{"NestedInstrumentAttribute",                  2166,  2168},
+{"DerivativeInstrument",                       2168,  2196},
+{"DerivativeSecurityAltIDGrp",                 2196,  2198},
+{"DerivativeEventsGrp",                        2198,  2198},
+{"DerivativeSecurityDefinition",               2198,  2202},
+{"RelSymDerivSecUpdGrp",                       2202,  2213},
+{"DerivativeSecurityXML",                      2213,  2216},
+{"UnderlyingLegSecurityAltIDGrp",              2216,  2218},
+{"UnderlyingLegInstrument",                    2218,  2234},
+{"TradeCapLegUnderlyingsGrp",                  2234,  2235},
+{"UsernameGrp",                                2235,  2236},
+{"NotAffectedOrdGrp",                          2236,  2240},
+{"FillsGrp",                                   2240,  2249},
+{"TrdRepIndicatorsGrp",                        2249,  2251},
+{"ApplicationSequenceControl",                 2251,  2255},
+{"ApplIDRequestGrp",                           2255,  2260},
+{"ApplIDRequestAckGrp",                        2260,  2267},
+{"ApplIDReportGrp",                            2267,  2270},
+{"NstdPtys4SubGrp",                            2270,  2272},
+{"NestedParties4",                             2272,  2277},
+{"TradeReportOrderDetail",                     2277,  2313},
+{"RateSource",                                 2313,  2317},
+{"TargetParties",                              2317,  2322},
+{"NewsRefGrp",                                 2322,  2324},
+{"ComplexEvents",                              2324,  2365},
+{"ComplexEventDates",                          2365,  2368},
+{"ComplexEventTimes",                          2368,  2370},
+{"StrmAsgnReqGrp",                             2370,  2372},
+{"StrmAsgnRptGrp",                             2372,  2374},
+{"StrmAsgnReqInstrmtGrp",                      2374,  2378},
+{"StrmAsgnRptInstrmtGrp",                      2378,  2386},
+{"MatchingInstructions",                       2386,  2390},
+{"LimitAmts",                                  2390,  2397},
+{"MarginReqmtInqQualGrp",                      2397,  2398},
+{"MarginAmount",                               2398,  2405},
+{"RelatedInstrumentGrp",                       2405,  2415},
+{"RequestedPartyRoleGrp",                      2415,  2417},
+{"PartyRelationshipGrp",                       2417,  2418},
+{"PartyDetailGrp",                             2418,  2426},
+{"PartyDetailAltIDGrp",                        2426,  2429},
+{"PartyDetailAltSubGrp",                       2429,  2431},
+{"RiskLimitTypesGrp",                          2431,  2441},
+{"InstrumentScope",                            2441,  2464},
+{"InstrumentScopeSecurityAltIDGrp",            2464,  2466},
+{"RiskWarningLevelGrp",                        2466,  2470},
+{"RelatedPartyDetailGrp",                      2470,  2477},
+{"RelatedPartyDetailSubGrp",                   2477,  2479},
+{"RelatedPartyDetailAltIDGrp",                 2479,  2482},
+{"RelatedPartyDetailAltSubGrp",                2482,  2484},
+{"InstrumentScopeGrp",                         2484,  2486},
+{"RiskInstrumentScopeGrp",                     2486,  2489},
+{"RequestingPartyGrp",                         2489,  2494},
+{"RequestingPartySubGrp",                      2494,  2496},
+{"PartyDetailsUpdateGrp",                      2496,  2498},
+{"RequestedRiskLimitTypesGrp",                 2498,  2499},
+{"PartyRiskLimitsGrp",                         2499,  2504},
+{"RiskLimitsGrp",                              2504,  2506},
+{"PartyDetailSubGrp",                          2506,  2508},
+{"SecMassStatGrp",                             2508,  2522},
+{"LegPositionAmountData",                      2522,  2526},
+{"SecurityClassificationGrp",                  2526,  2528},
+{"ThrottleParamsGrp",                          2528,  2534},
+{"ThrottleMsgTypeGrp",                         2534,  2535},
+{"ThrottleResponse",                           2535,  2538},
+{"SettlementAmountGrp",                        2538,  2540},
+{"CollateralAmountGrp",                        2540,  2552},
+{"PayCollectGrp",                              2552,  2560},
+{"PartyRiskLimitsUpdateGrp",                   2560,  2566},
+{"PartyRiskLimitsAckGrp",                      2566,  2577},
+{"PartyEntitlementGrp",                        2577,  2580},
+{"EntitlementGrp",                             2580,  2590},
+{"EntitlementAttribGrp",                       2590,  2594},
+{"MarketSegmentScopeGrp",                      2594,  2596},
+{"TargetMarketSegmentGrp",                     2596,  2597},
+{"AffectedMarketSegmentGrp",                   2597,  2598},
+{"NotAffectedMarketSegmentGrp",                2598,  2599},
+{"OrderEventGrp",                              2599,  2606},
+{"DisclosureInstructionGrp",                   2606,  2608},
+{"SideCrossLegGrp",                            2608,  2626},
+{"TradeAllocAmtGrp",                           2626,  2630},
+{"TradePriceConditionGrp",                     2630,  2631},
+{"TradeQtyGrp",                                2631,  2633},
+{"TradePositionQty",                           2633,  2639},
+{"RelatedTradeGrp",                            2639,  2645},
+{"RelatedPositionGrp",                         2645,  2648},
+{"ValueChecksGrp",                             2648,  2650},
+{"LegSecurityXML",                             2650,  2653},
+{"UnderlyingSecurityXML",                      2653,  2656},
+{"PartyDetailAckGrp",                          2656,  2663},
+{"PartyEntitlementUpdateGrp",                  2663,  2668},
+{"PartyEntitlementAckGrp",                     2668,  2677},
+{"InstrmtMatchSideGrp",                        2677,  2690},
+{"TrdMatchSideGrp",                            2690,  2740},
+{"TrdInstrmtLegExecGrp",                       2740,  2755},
+{"PriceMovementGrp",                           2755,  2757},
+{"PriceMovementValueGrp",                      2757,  2760},
+{"ClearingAccountTypeGrp",                     2760,  2761},
+{"AdditionalTermBondRefGrp",                   2761,  2779},
+{"AdditionalTermGrp",                          2779,  2782},
+{"AllocRegulatoryTradeIDGrp",                  2782,  2788},
+{"CashSettlTermGrp",                           2788,  2810},
+{"FinancingContractualDefinitionGrp",          2810,  2811},
+{"FinancingContractualMatrixGrp",              2811,  2814},
+{"FinancingTermSupplementGrp",                 2814,  2816},
+{"LegEvntGrp",                                 2816,  2826},
+{"LegPaymentScheduleGrp",                      2826,  2883},
+{"LegPaymentScheduleRateSourceGrp",            2883,  2886},
+{"LegPaymentStream",                           2886,  2919},
+{"LegPaymentStreamFixedRate",                  2919,  2929},
+{"LegPaymentStreamFloatingRate",               2929,  3009},
+{"LegPaymentStreamNonDeliverableFixingDateGrp", 3009,  3012},
+{"LegPaymentStreamNonDeliverableSettlTerms",   3012,  3022},
+{"LegPaymentStreamPaymentDates",               3022,  3036},
+{"LegPaymentStreamResetDates",                 3036,  3060},
+{"LegPaymentStubGrp",                          3060,  3091},
+{"LegProvisionCashSettlPaymentDates",          3091,  3100},
+{"LegProvisionCashSettlPaymentFixedDateGrp",   3100,  3102},
+{"LegProvisionCashSettlValueDates",            3102,  3111},
+{"LegProvisionOptionExerciseFixedDateGrp",     3111,  3113},
+{"LegProvisionOptionExerciseDates",            3113,  3133},
+{"LegProvisionOptionExpirationDate",           3133,  3143},
+{"LegProvisionOptionRelevantUnderlyingDate",   3143,  3151},
+{"LegProvisionGrp",                            3151,  3184},
+{"LegProvisionParties",                        3184,  3189},
+{"LegProvisionPtysSubGrp",                     3189,  3191},
+{"LegSecondaryAssetGrp",                       3191,  3195},
+{"LegSettlRateDisruptionFallbackGrp",          3195,  3199},
+{"LegStreamCalculationPeriodDates",            3199,  3217},
+{"LegStreamEffectiveDate",                     3217,  3225},
+{"LegStreamGrp",                               3225,  3255},
+{"LegStreamTerminationDate",                   3255,  3263},
+{"PaymentGrp",                                 3263,  3294},
+{"PaymentScheduleGrp",                         3294,  3351},
+{"PaymentScheduleRateSourceGrp",               3351,  3354},
+{"PaymentSettlGrp",                            3354,  3357},
+{"PaymentSettlParties",                        3357,  3362},
+{"PaymentSettlPtysSubGrp",                     3362,  3364},
+{"PaymentStream",                              3364,  3397},
+{"PaymentStreamFixedRate",                     3397,  3407},
+{"PaymentStreamFloatingRate",                  3407,  3487},
+{"PaymentStreamNonDeliverableFixingDateGrp",   3487,  3490},
+{"PaymentStreamNonDeliverableSettlTerms",      3490,  3500},
+{"PaymentStreamPaymentDates",                  3500,  3514},
+{"PaymentStreamResetDates",                    3514,  3538},
+{"PaymentStubGrp",                             3538,  3569},
+{"PhysicalSettlTermGrp",                       3569,  3574},
+{"PhysicalSettlDeliverableObligationGrp",      3574,  3576},
+{"ProtectionTermGrp",                          3576,  3587},
+{"ProtectionTermEventGrp",                     3587,  3595},
+{"ProtectionTermEventQualifierGrp",            3595,  3596},
+{"ProtectionTermObligationGrp",                3596,  3598},
+{"ProvisionCashSettlPaymentDates",             3598,  3607},
+{"ProvisionCashSettlPaymentFixedDateGrp",      3607,  3609},
+{"ProvisionCashSettlValueDates",               3609,  3618},
+{"ProvisionOptionExerciseFixedDateGrp",        3618,  3620},
+{"ProvisionOptionExerciseDates",               3620,  3640},
+{"ProvisionOptionExpirationDate",              3640,  3650},
+{"ProvisionOptionRelevantUnderlyingDate",      3650,  3658},
+{"ProvisionGrp",                               3658,  3691},
+{"ProvisionParties",                           3691,  3696},
+{"ProvisionPtysSubGrp",                        3696,  3698},
+{"RegulatoryTradeIDGrp",                       3698,  3704},
+{"SecondaryAssetGrp",                          3704,  3708},
+{"SettlRateDisruptionFallbackGrp",             3708,  3712},
+{"SideRegulatoryTradeIDGrp",                   3712,  3718},
+{"StreamCalculationPeriodDates",               3718,  3736},
+{"StreamEffectiveDate",                        3736,  3744},
+{"StreamGrp",                                  3744,  3774},
+{"StreamTerminationDate",                      3774,  3782},
+{"UnderlyingComplexEvents",                    3782,  3823},
+{"UnderlyingComplexEventDates",                3823,  3826},
+{"UnderlyingComplexEventTimes",                3826,  3828},
+{"UnderlyingEvntGrp",                          3828,  3838},
+{"UnderlyingPaymentScheduleGrp",               3838,  3895},
+{"UnderlyingPaymentScheduleRateSourceGrp",     3895,  3898},
+{"UnderlyingPaymentStream",                    3898,  3931},
+{"UnderlyingPaymentStreamFixedRate",           3931,  3941},
+{"UnderlyingPaymentStreamFloatingRate",        3941,  4021},
+{"UnderlyingPaymentStreamNonDeliverableFixingDateGrp", 4021,  4024},
+{"UnderlyingPaymentStreamNonDeliverableSettlTerms", 4024,  4034},
+{"UnderlyingPaymentStreamPaymentDates",        4034,  4048},
+{"UnderlyingPaymentStreamResetDates",          4048,  4072},
+{"UnderlyingPaymentStubGrp",                   4072,  4103},
+{"UnderlyingSecondaryAssetGrp",                4103,  4107},
+{"UnderlyingSettlRateDisruptionFallbackGrp",   4107,  4111},
+{"UnderlyingStreamCalculationPeriodDates",     4111,  4129},
+{"UnderlyingStreamEffectiveDate",              4129,  4137},
+{"UnderlyingStreamGrp",                        4137,  4167},
+{"UnderlyingStreamTerminationDate",            4167,  4175},
+{"CashSettlDealerGrp",                         4175,  4176},
+{"BusinessCenterGrp",                          4176,  4177},
+{"DateAdjustment",                             4177,  4180},
+{"LegBusinessCenterGrp",                       4180,  4181},
+{"LegDateAdjustment",                          4181,  4184},
+{"LegPaymentScheduleFixingDateBusinessCenterGrp", 4184,  4185},
+{"LegPaymentScheduleInterimExchangeDateBusinessCenterGrp", 4185,  4186},
+{"LegPaymentStreamNonDeliverableFixingDatesBusinessCenterGrp", 4186,  4187},
+{"LegPaymentStreamPaymentDateBusinessCenterGrp", 4187,  4188},
+{"LegPaymentStreamResetDateBusinessCenterGrp", 4188,  4189},
+{"LegPaymentStreamInitialFixingDateBusinessCenterGrp", 4189,  4190},
+{"LegPaymentStreamFixingDateBusinessCenterGrp", 4190,  4191},
+{"LegProvisionCashSettlPaymentDateBusinessCenterGrp", 4191,  4192},
+{"LegProvisionCashSettlValueDateBusinessCenterGrp", 4192,  4193},
+{"LegProvisionOptionExerciseBusinessCenterGrp", 4193,  4194},
+{"LegProvisionOptionExpirationDateBusinessCenterGrp", 4194,  4195},
+{"LegProvisionOptionRelevantUnderlyingDateBusinessCenterGrp", 4195,  4196},
+{"LegProvisionDateBusinessCenterGrp",          4196,  4197},
+{"LegStreamCalculationPeriodBusinessCenterGrp", 4197,  4198},
+{"LegStreamFirstPeriodStartDateBusinessCenterGrp", 4198,  4199},
+{"LegStreamEffectiveDateBusinessCenterGrp",    4199,  4200},
+{"LegStreamTerminationDateBusinessCenterGrp",  4200,  4201},
+{"PaymentBusinessCenterGrp",                   4201,  4202},
+{"PaymentScheduleFixingDateBusinessCenterGrp", 4202,  4203},
+{"PaymentScheduleInterimExchangeDateBusinessCenterGrp", 4203,  4204},
+{"PaymentStreamNonDeliverableFixingDatesBusinessCenterGrp", 4204,  4205},
+{"PaymentStreamPaymentDateBusinessCenterGrp",  4205,  4206},
+{"PaymentStreamResetDateBusinessCenterGrp",    4206,  4207},
+{"PaymentStreamInitialFixingDateBusinessCenterGrp", 4207,  4208},
+{"PaymentStreamFixingDateBusinessCenterGrp",   4208,  4209},
+{"ProtectionTermEventNewsSourceGrp",           4209,  4210},
+{"ProvisionCashSettlPaymentDateBusinessCenterGrp", 4210,  4211},
+{"ProvisionCashSettlValueDateBusinessCenterGrp", 4211,  4212},
+{"ProvisionOptionExerciseBusinessCenterGrp",   4212,  4213},
+{"ProvisionOptionExpirationDateBusinessCenterGrp", 4213,  4214},
+{"ProvisionOptionRelevantUnderlyingDateBusinessCenterGrp", 4214,  4215},
+{"ProvisionDateBusinessCenterGrp",             4215,  4216},
+{"StreamCalculationPeriodBusinessCenterGrp",   4216,  4217},
+{"StreamFirstPeriodStartDateBusinessCenterGrp", 4217,  4218},
+{"StreamEffectiveBusinessCenterGrp",           4218,  4219},
+{"StreamTerminationDateBusinessCenterGrp",     4219,  4220},
+{"UnderlyingBusinessCenterGrp",                4220,  4221},
+{"UnderlyingDateAdjustment",                   4221,  4224},
+{"UnderlyingPaymentScheduleFixingDateBusinessCenterGrp", 4224,  4225},
+{"UnderlyingPaymentScheduleInterimExchangeDateBusinessCenterGrp", 4225,  4226},
+{"UnderlyingPaymentStreamNonDeliverableFixingDatesBusinessCenterGrp", 4226,  4227},
+{"UnderlyingPaymentStreamPaymentDateBusinessCenterGrp", 4227,  4228},
+{"UnderlyingPaymentStreamResetDateBusinessCenterGrp", 4228,  4229},
+{"UnderlyingPaymentStreamInitialFixingDateBusinessCenterGrp", 4229,  4230},
+{"UnderlyingPaymentStreamFixingDateBusinessCenterGrp", 4230,  4231},
+{"UnderlyingStreamCalculationPeriodBusinessCenterGrp", 4231,  4232},
+{"UnderlyingStreamFirstPeriodStartDateBusinessCenterGrp", 4232,  4233},
+{"UnderlyingStreamEffectiveDateBusinessCenterGrp", 4233,  4234},
+{"UnderlyingStreamTerminationDateBusinessCenterGrp", 4234,  4235},
+{"LegPaymentStreamNonDeliverableSettlRateSource", 4235,  4237},
+{"LegSettlRateFallbackRateSource",             4237,  4239},
+{"PaymentStreamNonDeliverableSettlRateSource", 4239,  4241},
+{"SettlRateFallbackRateSource",                4241,  4243},
+{"UnderlyingPaymentStreamNonDeliverableSettlRateSource", 4243,  4245},
+{"UnderlyingSettlRateFallbackRateSource",      4245,  4247},
+{"ProvisionCashSettlQuoteSource",              4247,  4249},
+{"LegProvisionCashSettlQuoteSource",           4249,  4251},
+{"AttachmentGrp",                              4251,  4260},
+{"AttachmentKeywordGrp",                       4260,  4261},
+{"AssetAttributeGrp",                          4261,  4264},
+{"ComplexEventAveragingObservationGrp",        4264,  4266},
+{"ComplexEventCreditEventGrp",                 4266,  4274},
+{"ComplexEventCreditEventQualifierGrp",        4274,  4275},
+{"ComplexEventPeriodDateGrp",                  4275,  4277},
+{"ComplexEventPeriodGrp",                      4277,  4282},
+{"ComplexEventRateSourceGrp",                  4282,  4286},
+{"ComplexEventDateBusinessCenterGrp",          4286,  4287},
+{"ComplexEventRelativeDate",                   4287,  4297},
+{"ComplexEventCreditEventSourceGrp",           4297,  4298},
+{"ComplexEventScheduleGrp",                    4298,  4303},
+{"DeliveryScheduleGrp",                        4303,  4317},
+{"DeliveryScheduleSettlDayGrp",                4317,  4320},
+{"DeliveryScheduleSettlTimeGrp",               4320,  4323},
+{"DeliveryStream",                             4323,  4352},
+{"DeliveryStreamCycleGrp",                     4352,  4355},
+{"DeliveryStreamCommoditySourceGrp",           4355,  4356},
+{"MarketDisruption",                           4356,  4364},
+{"MarketDisruptionEventGrp",                   4364,  4366},
+{"MarketDisruptionFallbackGrp",                4366,  4368},
+{"MarketDisruptionFallbackReferencePriceGrp",  4368,  4377},
+{"OptionExercise",                             4377,  4392},
+{"OptionExerciseBusinessCenterGrp",            4392,  4393},
+{"OptionExerciseDates",                        4393,  4414},
+{"OptionExerciseDateGrp",                      4414,  4416},
+{"OptionExerciseExpirationDateBusinessCenterGrp", 4416,  4417},
+{"OptionExerciseExpiration",                   4417,  4429},
+{"OptionExerciseExpirationDateGrp",            4429,  4431},
+{"PaymentScheduleFixingDayGrp",                4431,  4433},
+{"PaymentStreamPricingBusinessCenterGrp",      4433,  4434},
+{"PaymentStreamPaymentDateGrp",                4434,  4436},
+{"PaymentStreamPricingDateGrp",                4436,  4438},
+{"PaymentStreamPricingDayGrp",                 4438,  4440},
+{"PricingDateBusinessCenterGrp",               4440,  4441},
+{"PricingDateTime",                            4441,  4447},
+{"StreamAssetAttributeGrp",                    4447,  4450},
+{"StreamCalculationPeriodDateGrp",             4450,  4452},
+{"StreamCommoditySettlBusinessCenterGrp",      4452,  4453},
+{"StreamCommodity",                            4453,  4485},
+{"StreamCommodityAltIDGrp",                    4485,  4487},
+{"StreamCommodityDataSourceGrp",               4487,  4489},
+{"StreamCommoditySettlDayGrp",                 4489,  4492},
+{"StreamCommoditySettlTimeGrp",                4492,  4495},
+{"StreamCommoditySettlPeriodGrp",              4495,  4509},
+{"MandatoryClearingJurisdictionGrp",           4509,  4510},
+{"LegAdditionalTermBondRefGrp",                4510,  4528},
+{"LegAdditionalTermGrp",                       4528,  4531},
+{"LegAssetAttributeGrp",                       4531,  4534},
+{"LegCashSettlDealerGrp",                      4534,  4535},
+{"LegCashSettlTermGrp",                        4535,  4557},
+{"LegComplexEventAveragingObservationGrp",     4557,  4559},
+{"LegComplexEventCreditEventGrp",              4559,  4567},
+{"LegComplexEventCreditEventQualifierGrp",     4567,  4568},
+{"LegComplexEventPeriodDateGrp",               4568,  4570},
+{"LegComplexEventPeriodGrp",                   4570,  4575},
+{"LegComplexEventRateSourceGrp",               4575,  4579},
+{"LegComplexEventDateBusinessCenterGrp",       4579,  4580},
+{"LegComplexEventRelativeDate",                4580,  4590},
+{"LegComplexEventCreditEventSourceGrp",        4590,  4591},
+{"LegComplexEvents",                           4591,  4632},
+{"LegComplexEventDates",                       4632,  4635},
+{"LegComplexEventTimes",                       4635,  4637},
+{"LegComplexEventScheduleGrp",                 4637,  4642},
+{"LegDeliveryScheduleGrp",                     4642,  4656},
+{"LegDeliveryScheduleSettlDayGrp",             4656,  4659},
+{"LegDeliveryScheduleSettlTimeGrp",            4659,  4662},
+{"LegDeliveryStream",                          4662,  4691},
+{"LegStreamAssetAttributeGrp",                 4691,  4694},
+{"LegDeliveryStreamCycleGrp",                  4694,  4697},
+{"LegDeliveryStreamCommoditySourceGrp",        4697,  4698},
+{"LegInstrumentParties",                       4698,  4703},
+{"LegInstrumentPtysSubGrp",                    4703,  4705},
+{"LegMarketDisruption",                        4705,  4713},
+{"LegMarketDisruptionEventGrp",                4713,  4715},
+{"LegMarketDisruptionFallbackGrp",             4715,  4717},
+{"LegMarketDisruptionFallbackReferencePriceGrp", 4717,  4726},
+{"LegOptionExercise",                          4726,  4741},
+{"LegOptionExerciseBusinessCenterGrp",         4741,  4742},
+{"LegOptionExerciseDates",                     4742,  4763},
+{"LegOptionExerciseDateGrp",                   4763,  4765},
+{"LegOptionExerciseExpirationDateBusinessCenterGrp", 4765,  4766},
+{"LegOptionExerciseExpiration",                4766,  4778},
+{"LegOptionExerciseExpirationDateGrp",         4778,  4780},
+{"LegPaymentScheduleFixingDayGrp",             4780,  4782},
+{"LegPaymentStreamPricingBusinessCenterGrp",   4782,  4783},
+{"LegPaymentStreamPaymentDateGrp",             4783,  4785},
+{"LegPaymentStreamPricingDateGrp",             4785,  4787},
+{"LegPaymentStreamPricingDayGrp",              4787,  4789},
+{"LegPhysicalSettlTermGrp",                    4789,  4794},
+{"LegPhysicalSettlDeliverableObligationGrp",   4794,  4796},
+{"LegPricingDateBusinessCenterGrp",            4796,  4797},
+{"LegPricingDateTime",                         4797,  4803},
+{"LegProtectionTermEventNewsSourceGrp",        4803,  4804},
+{"LegProtectionTermGrp",                       4804,  4815},
+{"LegProtectionTermEventGrp",                  4815,  4823},
+{"LegProtectionTermEventQualifierGrp",         4823,  4824},
+{"LegProtectionTermObligationGrp",             4824,  4826},
+{"LegStreamCalculationPeriodDateGrp",          4826,  4828},
+{"LegStreamCommoditySettlBusinessCenterGrp",   4828,  4829},
+{"LegStreamCommodity",                         4829,  4861},
+{"LegStreamCommodityAltIDGrp",                 4861,  4863},
+{"LegStreamCommodityDataSourceGrp",            4863,  4865},
+{"LegStreamCommoditySettlDayGrp",              4865,  4868},
+{"LegStreamCommoditySettlTimeGrp",             4868,  4871},
+{"LegStreamCommoditySettlPeriodGrp",           4871,  4885},
+{"UnderlyingAssetAttributeGrp",                4885,  4888},
+{"UnderlyingComplexEventAveragingObservationGrp", 4888,  4890},
+{"UnderlyingComplexEventCreditEventGrp",       4890,  4898},
+{"UnderlyingComplexEventCreditEventQualifierGrp", 4898,  4899},
+{"UnderlyingComplexEventPeriodDateGrp",        4899,  4901},
+{"UnderlyingComplexEventPeriodGrp",            4901,  4906},
+{"UnderlyingComplexEventRateSourceGrp",        4906,  4910},
+{"UnderlyingComplexEventDateBusinessCenterGrp", 4910,  4911},
+{"UnderlyingComplexEventRelativeDate",         4911,  4921},
+{"UnderlyingComplexEventCreditEventSourceGrp", 4921,  4922},
+{"UnderlyingComplexEventScheduleGrp",          4922,  4927},
+{"UnderlyingDeliveryScheduleGrp",              4927,  4941},
+{"UnderlyingDeliveryScheduleSettlDayGrp",      4941,  4944},
+{"UnderlyingDeliveryScheduleSettlTimeGrp",     4944,  4947},
+{"UnderlyingDeliveryStream",                   4947,  4976},
+{"UnderlyingStreamAssetAttributeGrp",          4976,  4979},
+{"UnderlyingDeliveryStreamCycleGrp",           4979,  4982},
+{"UnderlyingDeliveryStreamCommoditySourceGrp", 4982,  4983},
+{"UnderlyingOptionExercise",                   4983,  4998},
+{"UnderlyingOptionExerciseBusinessCenterGrp",  4998,  4999},
+{"UnderlyingOptionExerciseDates",              4999,  5020},
+{"UnderlyingOptionExerciseDateGrp",            5020,  5022},
+{"UnderlyingOptionExerciseExpirationDateBusinessCenterGrp", 5022,  5023},
+{"UnderlyingOptionExerciseExpiration",         5023,  5035},
+{"UnderlyingOptionExerciseExpirationDateGrp",  5035,  5037},
+{"UnderlyingMarketDisruption",                 5037,  5045},
+{"UnderlyingMarketDisruptionEventGrp",         5045,  5047},
+{"UnderlyingMarketDisruptionFallbackGrp",      5047,  5049},
+{"UnderlyingMarketDisruptionFallbackReferencePriceGrp", 5049,  5058},
+{"UnderlyingPaymentScheduleFixingDayGrp",      5058,  5060},
+{"UnderlyingPaymentStreamPricingBusinessCenterGrp", 5060,  5061},
+{"UnderlyingPaymentStreamPaymentDateGrp",      5061,  5063},
+{"UnderlyingPaymentStreamPricingDateGrp",      5063,  5065},
+{"UnderlyingPaymentStreamPricingDayGrp",       5065,  5067},
+{"UnderlyingPricingDateBusinessCenterGrp",     5067,  5068},
+{"UnderlyingPricingDateTime",                  5068,  5074},
+{"UnderlyingStreamCalculationPeriodDateGrp",   5074,  5076},
+{"UnderlyingStreamCommoditySettlBusinessCenterGrp", 5076,  5077},
+{"UnderlyingStreamCommodity",                  5077,  5109},
+{"UnderlyingStreamCommodityAltIDGrp",          5109,  5111},
+{"UnderlyingStreamCommodityDataSourceGrp",     5111,  5113},
+{"UnderlyingStreamCommoditySettlDayGrp",       5113,  5116},
+{"UnderlyingStreamCommoditySettlTimeGrp",      5116,  5119},
+{"UnderlyingStreamCommoditySettlPeriodGrp",    5119,  5133},
+{"EntitlementTypeGrp",                         5133,  5135},
+{"UnderlyingAdditionalTermBondRefGrp",         5135,  5153},
+{"UnderlyingAdditionalTermGrp",                5153,  5156},
+{"UnderlyingCashSettlDealerGrp",               5156,  5157},
+{"UnderlyingCashSettlTermGrp",                 5157,  5179},
+{"UnderlyingPhysicalSettlTermGrp",             5179,  5184},
+{"UnderlyingPhysicalSettlDeliverableObligationGrp", 5184,  5186},
+{"UnderlyingProtectionTermGrp",                5186,  5197},
+{"UnderlyingProtectionTermEventGrp",           5197,  5205},
+{"UnderlyingProtectionTermEventQualifierGrp",  5205,  5206},
+{"UnderlyingProtectionTermObligationGrp",      5206,  5208},
+{"UnderlyingProtectionTermEventNewsSourceGrp", 5208,  5209},
+{"UnderlyingProvisionCashSettlPaymentDates",   5209,  5218},
+{"UnderlyingProvisionCashSettlPaymentFixedDateGrp", 5218,  5220},
+{"UnderlyingProvisionCashSettlQuoteSource",    5220,  5222},
+{"UnderlyingProvisionCashSettlValueDates",     5222,  5231},
+{"UnderlyingProvisionOptionExerciseFixedDateGrp", 5231,  5233},
+{"UnderlyingProvisionOptionExerciseDates",     5233,  5253},
+{"UnderlyingProvisionOptionExpirationDate",    5253,  5263},
+{"UnderlyingProvisionOptionRelevantUnderlyingDate", 5263,  5271},
+{"UnderlyingProvisionGrp",                     5271,  5304},
+{"UnderlyingProvisionParties",                 5304,  5309},
+{"UnderlyingProvisionPtysSubGrp",              5309,  5311},
+{"UnderlyingProvisionCashSettlPaymentDateBusinessCenterGrp", 5311,  5312},
+{"UnderlyingProvisionCashSettlValueDateBusinessCenterGrp", 5312,  5313},
+{"UnderlyingProvisionOptionExerciseBusinessCenterGrp", 5313,  5314},
+{"UnderlyingProvisionOptionExpirationDateBusinessCenterGrp", 5314,  5315},
+{"UnderlyingProvisionOptionRelevantUnderlyingDateBusinessCenterGrp", 5315,  5316},
+{"UnderlyingProvisionDateBusinessCenterGrp",   5316,  5317},
+{"OrderEntryGrp",                              5317,  5328},
+{"OrderEntryAckGrp",                           5328,  5346},
+{"TargetPtysSubGrp",                           5346,  5348},
+{"MDStatisticReqGrp",                          5348,  5350},
+{"MDStatisticRptGrp",                          5350,  5357},
+{"MDStatisticParameters",                      5357,  5397},
+{"LegFinancingDetails",                        5397,  5422},
+{"LegFinancingContractualDefinitionsGrp",      5422,  5423},
+{"LegFinancingTermSupplementGrp",              5423,  5425},
+{"LegFinancingContractualMatrixGrp",           5425,  5428},
+{"RelativeValueGrp",                           5428,  5431},
+{"AuctionTypeRuleGrp",                         5431,  5433},
+{"FlexProductEligibilityGrp",                  5433,  5435},
+{"PriceRangeRuleGrp",                          5435,  5441},
+{"QuoteSizeRuleGrp",                           5441,  5444},
+{"RelatedMarketSegmentGrp",                    5444,  5446},
+{"ClearingPriceParametersGrp",                 5446,  5462},
+{"MiscFeesSubGrp",                             5462,  5467},
+{"CommissionDataGrp",                          5467,  5481},
+{"AllocCommissionDataGrp",                     5481,  5495},
+{"CashSettlDate",                              5495,  5503},
+{"CashSettlDateBusinessCenterGrp",             5503,  5504},
+{"DividendAccrualFloatingRate",                5504,  5522},
+{"DividendAccrualPaymentDateBusinessCenterGrp", 5522,  5523},
+{"DividendAccrualPaymentDate",                 5523,  5531},
+{"DividendConditions",                         5531,  5555},
+{"DividendFXTriggerDate",                      5555,  5563},
+{"DividendFXTriggerDateBusinessCenterGrp",     5563,  5564},
+{"DividendPeriodGrp",                          5564,  5584},
+{"DividendPeriodBusinessCenterGrp",            5584,  5585},
+{"ExtraordinaryEventGrp",                      5585,  5587},
+{"LegCashSettlDate",                           5587,  5595},
+{"LegCashSettlDateBusinessCenterGrp",          5595,  5596},
+{"LegDividendAccrualPaymentDateBusinessCenterGrp", 5596,  5597},
+{"LegDividendAccrualFloatingRate",             5597,  5615},
+{"LegDividendAccrualPaymentDate",              5615,  5623},
+{"LegDividendConditions",                      5623,  5647},
+{"LegDividendFXTriggerDate",                   5647,  5655},
+{"LegDividendFXTriggerDateBusinessCenterGrp",  5655,  5656},
+{"LegDividendPeriodGrp",                       5656,  5676},
+{"LegDividendPeriodBusinessCenterGrp",         5676,  5677},
+{"LegExtraordinaryEventGrp",                   5677,  5679},
+{"LegOptionExerciseMakeWholeProvision",        5679,  5686},
+{"LegPaymentStreamCompoundingDateGrp",         5686,  5688},
+{"LegPaymentStreamCompoundingDates",           5688,  5703},
+{"LegPaymentStreamCompoundingDatesBusinessCenterGrp", 5703,  5704},
+{"LegPaymentStreamCompoundingEndDate",         5704,  5710},
+{"LegPaymentStreamCompoundingFloatingRate",    5710,  5728},
+{"LegPaymentStreamCompoundingStartDate",       5728,  5734},
+{"LegPaymentStreamFormulaImage",               5734,  5736},
+{"LegPaymentStreamFinalPricePaymentDate",      5736,  5742},
+{"LegPaymentStreamFixingDateGrp",              5742,  5744},
+{"LegPaymentStreamFormula",                    5744,  5749},
+{"LegPaymentStreamFormulaMathGrp",             5749,  5752},
+{"LegPaymentStubEndDate",                      5752,  5760},
+{"LegPaymentStubEndDateBusinessCenterGrp",     5760,  5761},
+{"LegPaymentStubStartDate",                    5761,  5769},
+{"LegPaymentStubStartDateBusinessCenterGrp",   5769,  5770},
+{"LegReturnRateDateGrp",                       5770,  5793},
+{"LegReturnRateFXConversionGrp",               5793,  5796},
+{"LegReturnRateGrp",                           5796,  5825},
+{"LegReturnRateInformationSourceGrp",          5825,  5828},
+{"LegReturnRatePriceGrp",                      5828,  5832},
+{"LegReturnRateValuationDateBusinessCenterGrp", 5832,  5833},
+{"LegReturnRateValuationDateGrp",              5833,  5835},
+{"LegSettlMethodElectionDate",                 5835,  5843},
+{"LegSettlMethodElectionDateBusinessCenterGrp", 5843,  5844},
+{"OptionExerciseMakeWholeProvision",           5844,  5851},
+{"PaymentStreamCompoundingDateGrp",            5851,  5854},
+{"PaymentStreamCompoundingDates",              5854,  5869},
+{"PaymentStreamCompoundingDatesBusinessCenterGrp", 5869,  5870},
+{"PaymentStreamCompoundingEndDate",            5870,  5876},
+{"PaymentStreamCompoundingFloatingRate",       5876,  5894},
+{"PaymentStreamCompoundingStartDate",          5894,  5900},
+{"PaymentStreamFormulaImage",                  5900,  5902},
+{"PaymentStreamFinalPricePaymentDate",         5902,  5908},
+{"PaymentStreamFixingDateGrp",                 5908,  5911},
+{"PaymentStreamFormulaMathGrp",                5911,  5914},
+{"PaymentStreamFormula",                       5914,  5919},
+{"PaymentStubEndDate",                         5919,  5927},
+{"PaymentStubEndDateBusinessCenterGrp",        5927,  5928},
+{"PaymentStubStartDate",                       5928,  5936},
+{"PaymentStubStartDateBusinessCenterGrp",      5936,  5937},
+{"ReturnRateDateGrp",                          5937,  5960},
+{"ReturnRateFXConversionGrp",                  5960,  5963},
+{"ReturnRateGrp",                              5963,  5992},
+{"ReturnRateInformationSourceGrp",             5992,  5995},
+{"ReturnRatePriceGrp",                         5995,  5999},
+{"ReturnRateValuationDateBusinessCenterGrp",   5999,  6000},
+{"ReturnRateValuationDateGrp",                 6000,  6002},
+{"SettlMethodElectionDateBusinessCenterGrp",   6002,  6003},
+{"SettlMethodElectionDate",                    6003,  6011},
+{"UnderlyingCashSettlDateBusinessCenterGrp",   6011,  6012},
+{"UnderlyingCashSettlDate",                    6012,  6020},
+{"UnderlyingDividendAccrualPaymentDateBusinessCenterGrp", 6020,  6021},
+{"UnderlyingDividendAccrualFloatingRate",      6021,  6039},
+{"UnderlyingDividendAccrualPaymentDate",       6039,  6047},
+{"UnderlyingDividendConditions",               6047,  6071},
+{"UnderlyingDividendFXTriggerDate",            6071,  6079},
+{"UnderlyingDividendFXTriggerDateBusinessCenterGrp", 6079,  6080},
+{"UnderlyingDividendPaymentGrp",               6080,  6084},
+{"UnderlyingDividendPayout",                   6084,  6087},
+{"UnderlyingDividendPeriodGrp",                6087,  6107},
+{"UnderlyingDividendPeriodBusinessCenterGrp",  6107,  6108},
+{"UnderlyingExtraordinaryEventGrp",            6108,  6110},
+{"UnderlyingOptionExerciseMakeWholeProvision", 6110,  6117},
+{"UnderlyingPaymentStreamCompoundingDateGrp",  6117,  6120},
+{"UnderlyingPaymentStreamCompoundingDates",    6120,  6135},
+{"UnderlyingPaymentStreamCompoundingDatesBusinessCenterGrp", 6135,  6136},
+{"UnderlyingPaymentStreamCompoundingEndDate",  6136,  6142},
+{"UnderlyingPaymentStreamCompoundingFloatingRate", 6142,  6160},
+{"UnderlyingPaymentStreamCompoundingStartDate", 6160,  6166},
+{"UnderlyingPaymentStreamFormulaImage",        6166,  6168},
+{"UnderlyingPaymentStreamFinalPricePaymentDate", 6168,  6174},
+{"UnderlyingPaymentStreamFixingDateGrp",       6174,  6177},
+{"UnderlyingPaymentStreamFormula",             6177,  6182},
+{"UnderlyingPaymentStreamFormulaMathGrp",      6182,  6185},
+{"UnderlyingPaymentStubEndDate",               6185,  6193},
+{"UnderlyingPaymentStubEndDateBusinessCenterGrp", 6193,  6194},
+{"UnderlyingPaymentStubStartDate",             6194,  6202},
+{"UnderlyingPaymentStubStartDateBusinessCenterGrp", 6202,  6203},
+{"UnderlyingRateSpreadSchedule",               6203,  6205},
+{"UnderlyingRateSpreadStepGrp",                6205,  6207},
+{"UnderlyingReturnRateDateGrp",                6207,  6230},
+{"UnderlyingReturnRateFXConversionGrp",        6230,  6233},
+{"UnderlyingReturnRateGrp",                    6233,  6262},
+{"UnderlyingReturnRateInformationSourceGrp",   6262,  6265},
+{"UnderlyingReturnRatePriceGrp",               6265,  6269},
+{"UnderlyingReturnRateValuationDateBusinessCenterGrp", 6269,  6270},
+{"UnderlyingReturnRateValuationDateGrp",       6270,  6272},
+{"UnderlyingSettlMethodElectionDateBusinessCenterGrp", 6272,  6273},
+{"UnderlyingSettlMethodElectionDate",          6273,  6281},
+{"TrdRegPublicationGrp",                       6281,  6283},
+{"OrderAttributeGrp",                          6283,  6285},
+{"SideCollateralAmountGrp",                    6285,  6297},
+{"QuoteAttributeGrp",                          6297,  6299},
+{"PriceQualifierGrp",                          6299,  6300},
+{"IndexRollMonthGrp",                          6300,  6301},
+{"ReferenceDataDateGrp",                       6301,  6303},
+{"FloatingRateIndex",                          6303,  6308},
+{"AveragePriceDetail",                         6308,  6311}
+};
+
+//! Message body layouts, indexed by msg_type_index::type.
+static HFFIX_CONSTEXPR layout message_layouts[] = {
+{"Heartbeat",                                  6311,  6312},
+{"TestRequest",                                6312,  6313},
+{"ResendRequest",                              6313,  6315},
+{"Reject",                                     6315,  6325},
+{"SequenceReset",                              6325,  6327},
+{"Logout",                                     6327,  6331},
+{"IOI",                                        6331,  6364},
+{"Advertisement",                              6364,  6387},
+{"ExecutionReport",                            6387,  6642},
+{"OrderCancelReject",                          6642,  6670},
+{"Logon",                                      6670,  6694},
+{"DerivativeSecurityList",                     6694,  6708},
+{"NewOrderMultileg",                           6708,  6826},
+{"MultilegOrderCancelReplace",                 6826,  6943},
+{"TradeCaptureReportRequest",                  6943,  6987},
+{"TradeCaptureReport",                         6987,  7152},
+{"OrderMassStatusRequest",                     7152,  7163},
+{"QuoteRequestReject",                         7163,  7174},
+{"RFQRequest",                                 7174,  7179},
+{"QuoteStatusReport",                          7179,  7264},
+{"QuoteResponse",                              7264,  7336},
+{"Confirmation",                               7336,  7412},
+{"PositionMaintenanceRequest",                 7412,  7442},
+{"PositionMaintenanceReport",                  7442,  7492},
+{"RequestForPositions",                        7492,  7516},
+{"RequestForPositionsAck",                     7516,  7543},
+{"PositionReport",                             7543,  7612},
+{"TradeCaptureReportRequestAck",               7612,  7633},
+{"TradeCaptureReportAck",                      7633,  7732},
+{"AllocationReport",                           7732,  7827},
+{"AllocationReportAck",                        7827,  7856},
+{"ConfirmationAck",                            7856,  7866},
+{"SettlementInstructionRequest",               7866,  7882},
+{"AssignmentReport",                           7882,  7913},
+{"CollateralRequest",                          7913,  7956},
+{"CollateralAssignment",                       7956,  8011},
+{"CollateralResponse",                         8011,  8071},
+{"News",                                       8071,  8091},
+{"CollateralReport",                           8091,  8145},
+{"CollateralInquiry",                          8145,  8189},
+{"NetworkCounterpartySystemStatusRequest",     8189,  8192},
+{"NetworkCounterpartySystemStatusResponse",    8192,  8197},
+{"UserRequest",                                8197,  8209},
+{"UserResponse",                               8209,  8214},
+{"CollateralInquiryAck",                       8214,  8246},
+{"ConfirmationRequest",                        8246,  8259},
+{"TradingSessionListRequest",                  8259,  8268},
+{"TradingSessionList",                         8268,  8271},
+{"SecurityListUpdateReport",                   8271,  8291},
+{"AdjustedPositionReport",                     8291,  8301},
+{"AllocationInstructionAlert",                 8301,  8388},
+{"ExecutionAck",                               8388,  8410},
+{"ContraryIntentionReport",                    8410,  8423},
+{"SecurityDefinitionUpdateReport",             8423,  8452},
+{"SettlementObligationReport",                 8452,  8462},
+{"DerivativeSecurityListUpdateReport",         8462,  8473},
+{"TradingSessionListUpdateReport",             8473,  8476},
+{"MarketDefinitionRequest",                    8476,  8481},
+{"MarketDefinition",                           8481,  8511},
+{"MarketDefinitionUpdateReport",               8511,  8541},
+{"ApplicationMessageRequest",                  8541,  8548},
+{"ApplicationMessageRequestAck",               8548,  8558},
+{"ApplicationMessageReport",                   8558,  8565},
+{"OrderMassActionReport",                      8565,  8599},
+{"Email",                                      8599,  8615},
+{"OrderMassActionRequest",                     8615,  8639},
+{"UserNotification",                           8639,  8645},
+{"StreamAssignmentRequest",                    8645,  8648},
+{"StreamAssignmentReport",                     8648,  8652},
+{"StreamAssignmentReportACK",                  8652,  8658},
+{"PartyDetailsListRequest",                    8658,  8667},
+{"PartyDetailsListReport",                     8667,  8681},
+{"MarginRequirementInquiry",                   8681,  8696},
+{"MarginRequirementInquiryAck",                8696,  8714},
+{"MarginRequirementReport",                    8714,  8733},
+{"PartyDetailsListUpdateReport",               8733,  8744},
+{"PartyRiskLimitsRequest",                     8744,  8756},
+{"PartyRiskLimitsReport",                      8756,  8772},
+{"SecurityMassStatusRequest",                  8772,  8780},
+{"SecurityMassStatus",                         8780,  8799},
+{"AccountSummaryReport",                       8799,  8813},
+{"PartyRiskLimitsUpdateReport",                8813,  8825},
+{"PartyRiskLimitsDefinitionRequest",           8825,  8831},
+{"PartyRiskLimitsDefinitionRequestAck",        8831,  8839},
+{"PartyEntitlementsRequest",                   8839,  8852},
+{"PartyEntitlementsReport",                    8852,  8866},
+{"QuoteAck",                                   8866,  8882},
+{"PartyDetailsDefinitionRequest",              8882,  8888},
+{"PartyDetailsDefinitionRequestAck",           8888,  8896},
+{"PartyEntitlementsUpdateReport",              8896,  8907},
+{"NewOrderSingle",                             8907,  9033},
+{"PartyEntitlementsDefinitionRequest",         9033,  9039},
+{"PartyEntitlementsDefinitionRequestAck",      9039,  9047},
+{"TradeMatchReport",                           9047,  9064},
+{"TradeMatchReportAck",                        9064,  9074},
+{"PartyRiskLimitsReportAck",                   9074,  9086},
+{"PartyRiskLimitCheckRequest",                 9086,  9108},
+{"PartyRiskLimitCheckRequestAck",              9108,  9136},
+{"PartyActionRequest",                         9136,  9149},
+{"PartyActionReport",                          9149,  9170},
+{"MassOrder",                                  9170,  9193},
+{"MassOrderAck",                               9193,  9224},
+{"PositionTransferInstruction",                9224,  9244},
+{"PositionTransferInstructionAck",             9244,  9260},
+{"PositionTransferReport",                     9260,  9286},
+{"MarketDataStatisticsRequest",                9286,  9307},
+{"MarketDataStatisticsReport",                 9307,  9333},
+{"CollateralReportAck",                        9333,  9344},
+{"MarketDataReport",                           9344,  9355},
+{"CrossRequest",                               9355,  9362},
+{"CrossRequestAck",                            9362,  9369},
+{"AllocationInstructionAlertRequest",          9369,  9373},
+{"NewOrderList",                               9373,  9396},
+{"OrderCancelRequest",                         9396,  9424},
+{"OrderCancelReplaceRequest",                  9424,  9546},
+{"OrderStatusRequest",                         9546,  9559},
+{"AllocationInstruction",                      9559,  9644},
+{"ListCancelRequest",                          9644,  9652},
+{"ListExecute",                                9652,  9659},
+{"ListStatusRequest",                          9659,  9663},
+{"ListStatus",                                 9663,  9677},
+{"AllocationInstructionAck",                   9677,  9699},
+{"DontKnowTrade",                              9699,  9713},
+{"QuoteRequest",                               9713,  9731},
+{"Quote",                                      9731,  9822},
+{"SettlementInstructions",                     9822,  9832},
+{"MarketDataRequest",                          9832,  9849},
+{"MarketDataSnapshotFullRefresh",              9849,  9880},
+{"MarketDataIncrementalRefresh",               9880,  9892},
+{"MarketDataRequestReject",                    9892,  9899},
+{"QuoteCancel",                                9899,  9914},
+{"QuoteStatusRequest",                         9914,  9928},
+{"MassQuoteAck",                               9928,  9949},
+{"SecurityDefinitionRequest",                  9949,  9974},
+{"SecurityDefinition",                         9974,  10007},
+{"SecurityStatusRequest",                      10007, 10020},
+{"SecurityStatus",                             10020, 10063},
+{"TradingSessionStatusRequest",                10063, 10072},
+{"TradingSessionStatus",                       10072, 10098},
+{"MassQuote",                                  10098, 10116},
+{"BusinessMessageReject",                      10116, 10126},
+{"BidRequest",                                 10126, 10155},
+{"BidResponse",                                10155, 10158},
+{"ListStrikePrice",                            10158, 10162},
+{"XMLnonFIX",                                  10162, 10163},
+{"RegistrationInstructions",                   10163, 10176},
+{"RegistrationInstructionsResponse",           10176, 10186},
+{"OrderMassCancelRequest",                     10186, 10202},
+{"OrderMassCancelReport",                      10202, 10226},
+{"NewOrderCross",                              10226, 10287},
+{"CrossOrderCancelReplaceRequest",             10287, 10351},
+{"CrossOrderCancelRequest",                    10351, 10365},
+{"SecurityTypeRequest",                        10365, 10376},
+{"SecurityTypes",                              10376, 10391},
+{"SecurityListRequest",                        10391, 10411},
+{"SecurityList",                               10411, 10431},
+{"DerivativeSecurityListRequest",              10431, 10445},
+{"",                                           0,     0}
+};
+
+} // namespace details
+/* @endcond */
+
+//! Number of component layouts.
+enum { component_layout_count = 717 };
+
+/*!
+ * \brief The layout of the body of a message type.
+ * \param index The message type index. For msg_type_index::unknown, the layout is empty.
+ */
+inline layout const& message_layout(msg_type_index::type index) {
+    return details::message_layouts[index];
+}
+
+/*!
+ * \brief The layout of a component, or of one instance of a repeating group.
+ * \param component The layout_entry::component index, less than component_layout_count.
+ */
+inline layout const& component_layout(int component) {
+    return details::component_layouts[component];
+}
+
+//! Pointer to the first entry of a layout.
+inline layout_entry const* layout_begin(layout const& l) {
+    return details::layout_entries + l.begin;
+}
+
+//! Pointer to past-the-last entry of a layout.
+inline layout_entry const* layout_end(layout const& l) {
+    return details::layout_entries + l.end;
+}
+
+} // namespace hffix
+#endif // HFFIX_LAYOUTS_HEADER
@@ -0,0 +1,334 @@
+/*******************************************************************************************
+Copyright 2011, T3 IP, LLC. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are
+permitted provided that the following conditions are met:
+
+   1. Redistributions of source code must retain the above copyright notice, this list of
+      conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright notice, this list
+      of conditions and the following disclaimer in the documentation and/or other materials
+      provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY T3 IP, LLC ``AS IS'' AND ANY EXPRESS OR IMPLIED
+WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL T3 IP, LLC OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those of the
+authors and should not be interpreted as representing official policies, either expressed
+or implied, of T3 IP, LLC.
+*******************************************************************************************/
+
+/*!
+ * \file
+ * \brief Reflection macros which generate the fields of a struct, and the code to write them to a FIX message and read them from a FIX message.
+ *
+ * Requires hffix.hpp and C++11.
+ */
+
+#ifndef HFFIX_REFLECT_HPP
+#define HFFIX_REFLECT_HPP
+
+#include "hffix.hpp"
+
+#if __cplusplus >= 201103L
+
+#include <cstddef>     // for size_t
+#include <cstdint>     // for int64_t
+#include <chrono>
+#include <ratio>       // for ratio_less
+#include <string>
+#include <type_traits> // for enable_if, is_integral
+#if __cplusplus >= 201703L
+#include <optional>
+#include <string_view>
+#endif
+
+namespace hffix {
+
+/*!
+ * \brief Struct reflection for writing and reading FIX messages, see #HFFIX_MESSAGE.
+ */
+namespace reflect {
+
+/*!
+ * \brief A decimal float field value, of the form \htmlonly mantissa&times;10<sup>exponent</sup>\endhtmlonly.
+ */
+struct decimal {
+    std::int64_t mantissa;
+    std::int64_t exponent; //!< Less than or equal to zero.
+};
+
+/*!
+ * \brief Writes and reads a field of C++ type _T_.
+ *
+ * Specialize this template to write and read members of other types.
+ *
+ * \code
+ * template <> struct hffix::reflect::field_codec<my_price> {
+ *     static void push_back(hffix::message_writer& w, int tag, my_price const& v);
+ *     static void read(hffix::field_value const& v, my_price& out);
+ * };
+ * \endcode
+ *
+ * The specializations are
+ * - Integer types, written with hffix::message_writer::push_back_int().
+ * - `char`, written with hffix::message_writer::push_back_char().
+ * - `bool`, written as `'Y'` or `'N'`.
+ * - `std::string`, and `std::string_view` which refers to the buffer of the hffix::message_reader.
+ * - hffix::reflect::decimal.
+ * - `std::chrono::time_point`, written as a UTCTimestamp with millisecond precision, or
+ *   with nanosecond precision if the `time_point` is more precise than milliseconds.
+ * - `std::optional<T>`, which is written only if it has a value.
+ */
+template <typename T, typename Enable = void> struct field_codec;
+
+/* @cond EXCLUDE */
+
+template <typename T> struct field_codec<T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, char>::value && !std::is_same<T, bool>::value>::type> {
+    static void push_back(message_writer& w, int tag, T v) { w.push_back_int(tag, v); }
+    static void read(field_value const& v, T& out) { out = v.as_int<T>(); }
+};
+
+template <> struct field_codec<char> {
+    static void push_back(message_writer& w, int tag, char v) { w.push_back_char(tag, v); }
+    static void read(field_value const& v, char& out) { out = v.as_char(); }
+};
+
+template <> struct field_codec<bool> {
+    static void push_back(message_writer& w, int tag, bool v) { w.push_back_char(tag, v ? 'Y' : 'N'); }
+    static void read(field_value const& v, bool& out) { out = v.as_char() == 'Y'; }
+};
+
+template <> struct field_codec<std::string> {
+    static void push_back(message_writer& w, int tag, std::string const& v) { w.push_back_string(tag, v.data(), v.data() + v.size()); }
+    static void read(field_value const& v, std::string& out) { out.assign(v.begin(), v.end()); }
+};
+
+template <> struct field_codec<decimal> {
+    static void push_back(message_writer& w, int tag, decimal const& v) { w.push_back_decimal(tag, v.mantissa, v.exponent); }
+    static void read(field_value const& v, decimal& out) { v.as_decimal(out.mantissa, out.exponent); }
+};
+
+template <typename Clock, typename Duration> struct field_codec<std::chrono::time_point<Clock, Duration> > {
+    static void push_back(message_writer& w, int tag, std::chrono::time_point<Clock, Duration> const& v) {
+        if (std::ratio_less<typename Duration::period, std::milli>::value) w.push_back_timestamp_nano(tag, v);
+        else w.push_back_timestamp(tag, v);
+    }
+    static void read(field_value const& v, std::chrono::time_point<Clock, Duration>& out) {
+        std::chrono::time_point<Clock, std::chrono::nanoseconds> t;
+        if (v.as_timestamp_nano(t)) out = std::chrono::time_point_cast<Duration>(t);
+    }
+};
+
+#if __cplusplus >= 201703L
+template <> struct field_codec<std::string_view> {
+    static void push_back(message_writer& w, int tag, std::string_view v) { w.push_back_string(tag, v); }
+    static void read(field_value const& v, std::string_view& out) { out = v.as_string_view(); }
+};
+
+template <typename T> struct field_codec<std::optional<T> > {
+    static void push_back(message_writer& w, int tag, std::optional<T> const& v) {
+        if (v) field_codec<T>::push_back(w, tag, *v);
+    }
+    static void read(field_value const& v, std::optional<T>& out) { field_codec<T>::read(v, out.emplace()); }
+};
+#endif
+
+namespace details {
+
+template <typename T> inline void push_back(message_writer& w, int tag, T const& v) {
+    field_codec<T>::push_back(w, tag, v);
+}
+
+template <typename T> inline void read(field_value const& v, T& out) {
+    field_codec<T>::read(v, out);
+}
+
+} // namespace details
+
+/* @endcond */
+
+} // namespace reflect
+} // namespace hffix
+
+/* @cond EXCLUDE */
+
+#define HFFIX_PP_EXPAND(x) x
+#define HFFIX_PP_CAT(a, b) HFFIX_PP_CAT_(a, b)
+#define HFFIX_PP_CAT_(a, b) a##b
+#define HFFIX_PP_COUNT(...) HFFIX_PP_EXPAND(HFFIX_PP_COUNT_(__VA_ARGS__, 64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49, 48, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1))
+#define HFFIX_PP_COUNT_(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, n, ...) n
+
+// Expand m(i, x) for each argument x with index i, for up to 64 arguments.
+#define HFFIX_PP_FOR_EACH(m, ...) HFFIX_PP_EXPAND(HFFIX_PP_CAT(HFFIX_PP_FOR_EACH_, HFFIX_PP_COUNT(__VA_ARGS__))(m, 0, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_1(m, i, x) m(i, x)
+#define HFFIX_PP_FOR_EACH_2(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_1(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_3(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_2(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_4(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_3(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_5(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_4(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_6(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_5(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_7(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_6(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_8(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_7(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_9(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_8(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_10(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_9(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_11(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_10(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_12(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_11(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_13(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_12(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_14(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_13(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_15(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_14(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_16(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_15(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_17(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_16(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_18(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_17(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_19(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_18(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_20(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_19(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_21(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_20(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_22(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_21(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_23(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_22(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_24(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_23(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_25(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_24(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_26(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_25(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_27(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_26(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_28(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_27(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_29(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_28(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_30(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_29(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_31(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_30(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_32(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_31(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_33(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_32(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_34(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_33(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_35(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_34(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_36(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_35(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_37(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_36(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_38(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_37(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_39(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_38(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_40(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_39(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_41(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_40(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_42(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_41(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_43(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_42(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_44(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_43(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_45(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_44(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_46(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_45(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_47(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_46(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_48(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_47(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_49(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_48(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_50(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_49(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_51(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_50(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_52(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_51(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_53(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_52(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_54(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_53(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_55(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_54(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_56(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_55(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_57(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_56(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_58(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_57(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_59(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_58(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_60(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_59(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_61(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_60(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_62(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_61(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_63(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_62(m, i + 1, __VA_ARGS__))
+#define HFFIX_PP_FOR_EACH_64(m, i, x, ...) m(i, x) HFFIX_PP_EXPAND(HFFIX_PP_FOR_EACH_63(m, i + 1, __VA_ARGS__))
+
+// A field is (name, type).
+#define HFFIX_REFLECT_NAME(f) HFFIX_PP_EXPAND(HFFIX_REFLECT_NAME_ f)
+#define HFFIX_REFLECT_NAME_(name, ...) name
+#define HFFIX_REFLECT_TYPE(f) HFFIX_PP_EXPAND(HFFIX_REFLECT_TYPE_ f)
+#define HFFIX_REFLECT_TYPE_(name, ...) __VA_ARGS__
+
+#define HFFIX_REFLECT_MEMBER(i, f) HFFIX_REFLECT_TYPE(f) HFFIX_REFLECT_NAME(f);
+#define HFFIX_REFLECT_PUSH_BACK(i, f) ::hffix::reflect::details::push_back(w, ::hffix::tag::HFFIX_REFLECT_NAME(f), HFFIX_REFLECT_NAME(f));
+#define HFFIX_REFLECT_TAG(i, f) ::hffix::tag::HFFIX_REFLECT_NAME(f),
+#define HFFIX_REFLECT_CASE_INDEX(i, f) case ::hffix::tag::HFFIX_REFLECT_NAME(f): return i;
+#define HFFIX_REFLECT_CASE_READ(i, f) case i: ::hffix::reflect::details::read(v, HFFIX_REFLECT_NAME(f)); return;
+
+/* @endcond */
+
+/*!
+ * \brief Define a struct with a member for each of some FIX fields, and the code to write and read the fields.
+ *
+ * The first argument is the name of the struct, and each following argument is a parenthesized
+ * `(name, type)` pair for a member. The name of each member is the name of its tag in
+ * `hffix::tag`, and the type is any type with a hffix::reflect::field_codec. Up to
+ * 64 members are supported.
+ *
+ * \code
+ * HFFIX_MESSAGE(NewOrder,
+ *     (ClOrdID, std::string),
+ *     (Side, char),
+ *     (OrderQty, std::int64_t),
+ *     (Price, hffix::reflect::decimal),
+ *     (TransactTime, std::chrono::system_clock::time_point)
+ * );
+ * \endcode
+ *
+ * The struct is an aggregate with the members in the same order, and these member functions.
+ *
+ * - `void push_back_fields(hffix::message_writer& w) const` writes each member as a field, in order.
+ *   Write the header and _MsgType_ before, and the trailer after.
+ *
+ * - `std::size_t read_fields(hffix::message_reader const& r)` reads each field of the message
+ *   which has the tag of a member into the member, in one pass, and returns the number of fields
+ *   read. Members whose tags are not in the message are unchanged. If a tag occurs more than once,
+ *   as in a repeating group, the last value is read. Each field is matched first against the member
+ *   after the last one read, so messages with fields in member order are read without searching,
+ *   and otherwise the member is found by a `switch` on the tag.
+ *
+ * To reflect a custom tag, add it to the `hffix::tag` namespace.
+ *
+ * \code
+ * namespace hffix { namespace tag { enum { MyStrategy = 7001 }; } }
+ * \endcode
+ */
+#define HFFIX_MESSAGE(name, ...)                                                                          \
+struct name {                                                                                             \
+    HFFIX_PP_FOR_EACH(HFFIX_REFLECT_MEMBER, __VA_ARGS__)                                                  \
+                                                                                                          \
+    enum { field_count = HFFIX_PP_COUNT(__VA_ARGS__) }; /* Needs no definition, even before C++17. */     \
+                                                                                                          \
+    void push_back_fields(::hffix::message_writer& w) const {                                             \
+        HFFIX_PP_FOR_EACH(HFFIX_REFLECT_PUSH_BACK, __VA_ARGS__)                                           \
+    }                                                                                                     \
+                                                                                                          \
+    std::size_t read_fields(::hffix::message_reader const& r) {                                           \
+        std::size_t n = 0, next = 0;                                                                      \
+        for (::hffix::message_reader::const_iterator i = r.begin(); i != r.end(); ++i) {                  \
+            std::size_t k = next;                                                                         \
+            if (k == field_count || i->tag() != hffix_tag_at_(k)) {                                       \
+                k = hffix_index_of_(i->tag());                                                            \
+                if (k == field_count) continue;                                                           \
+            }                                                                                             \
+            hffix_read_at_(k, i->value());                                                                \
+            next = k + 1;                                                                                 \
+            ++n;                                                                                          \
+        }                                                                                                 \
+        return n;                                                                                         \
+    }                                                                                                     \
+                                                                                                          \
+private:                                                                                                  \
+    static int hffix_tag_at_(std::size_t k) {                                                             \
+        static int const tags[] = { HFFIX_PP_FOR_EACH(HFFIX_REFLECT_TAG, __VA_ARGS__) };                  \
+        return tags[k];                                                                                   \
+    }                                                                                                     \
+                                                                                                          \
+    static std::size_t hffix_index_of_(int tag) {                                                         \
+        switch (tag) {                                                                                    \
+        HFFIX_PP_FOR_EACH(HFFIX_REFLECT_CASE_INDEX, __VA_ARGS__)                                          \
+        default: return field_count;                                                                      \
+        }                                                                                                 \
+    }                                                                                                     \
+                                                                                                          \
+    void hffix_read_at_(std::size_t k, ::hffix::field_value const& v) {                                   \
+        switch (k) {                                                                                      \
+        HFFIX_PP_FOR_EACH(HFFIX_REFLECT_CASE_READ, __VA_ARGS__)                                           \
+        }                                                                                                 \
+    }                                                                                                     \
+}
+
+#endif // __cplusplus >= 201103L
+
+#endif // HFFIX_REFLECT_HPP
@@ -0,0 +1,345 @@
+/*******************************************************************************************
+Copyright 2011, T3 IP, LLC. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are
+permitted provided that the following conditions are met:
+
+   1. Redistributions of source code must retain the above copyright notice, this list of
+      conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright notice, this list
+      of conditions and the following disclaimer in the documentation and/or other materials
+      provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY T3 IP, LLC ``AS IS'' AND ANY EXPRESS OR IMPLIED
+WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL T3 IP, LLC OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those of the
+authors and should not be interpreted as representing official policies, either expressed
+or implied, of T3 IP, LLC.
+*******************************************************************************************/
+
+/*!
+ * \file
+ * \brief Responder for ResendRequest which replays journaled messages with PossDupFlag and SequenceReset-GapFill.
+ *
+ * Requires hffix.hpp.
+ */
+
+#ifndef HFFIX_RESEND_HPP
+#define HFFIX_RESEND_HPP
+
+#include "hffix.hpp"
+#include <cstddef>   // for size_t
+#include <cstring>   // for strlen
+#include <stdexcept> // for exceptions
+#include <string>
+
+namespace hffix {
+
+namespace details {
+
+/*
+ * True for the tags of the FIX 4.4 Standard Header.
+ */
+inline bool is_standard_header_tag(int tag) {
+    switch (tag) {
+    case 8: case 9: case 34: case 35: case 43: case 49: case 50: case 52:
+    case 56: case 57: case 90: case 91: case 97: case 115: case 116: case 122:
+    case 128: case 129: case 142: case 143: case 144: case 145: case 212: case 213:
+    case 347: case 369: case 627: case 628: case 629: case 630:
+    case 1128: case 1129: case 1156:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/*
+ * True for the MsgTypes of the session-level messages, which are not resent.
+ */
+inline bool is_session_msg_type(field_value const& msg_type) {
+    if (msg_type.size() != 1) return false;
+    switch (*msg_type.begin()) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case 'A':
+        return true;
+    default:
+        return false;
+    }
+}
+
+/*
+ * Pointer to the beginning of the tag of a field in a message_reader buffer.
+ */
+inline char const* field_begin(field const& f) {
+    char const* b = f.value().begin() - 1; // The '='.
+    while (b[-1] >= '0' && b[-1] <= '9') --b;
+    return b;
+}
+
+} // namespace details
+
+/*!
+ * \brief Responds to a ResendRequest by replaying sent messages.
+ *
+ * The resend engine reads a span of sent messages in MsgSeqNum order, such as
+ * the span returned by message_journal::range(), and writes the messages to
+ * resend into a batch buffer. When the batch buffer is full, and at the end of
+ * each resend, the batch is passed to the `Sink` function object, which might
+ * write it to a socket, with a call like
+ *
+ * \code
+ * sink(char const* begin, char const* end);
+ * \endcode
+ *
+ * - Application messages are resent with *PossDupFlag* `Y`, *OrigSendingTime*
+ *   equal to their original *SendingTime*, and a new *SendingTime*. The rest of
+ *   the header and the body are copied with `memcpy`, as they are, and only
+ *   *BodyLength* and *CheckSum* are recalculated.
+ * - Each run of consecutive session-level messages (*Heartbeat*, *TestRequest*,
+ *   *ResendRequest*, *Reject*, *SequenceReset*, *Logout*, *Logon*) and missing
+ *   sequence numbers is replaced by a single *SequenceReset-GapFill*.
+ *
+ * No memory is allocated.
+ *
+ * A large resend can be split into several calls to resend() over consecutive
+ * ranges of sequence numbers, so that the caller can do other work between
+ * batches. A run of session-level messages which crosses a split becomes two
+ * *SequenceReset-GapFill* messages, which is still correct.
+ *
+ * Example usage:
+ * \code
+ * struct socket_sink {
+ *     int fd;
+ *     void operator()(char const* begin, char const* end) { ::write(fd, begin, end - begin); }
+ * } sink = { fd };
+ * char batch[1 << 16];
+ * hffix::resend_engine<socket_sink> engine("FIX.4.4", "SENDER", "TARGET", batch, sizeof(batch), sink);
+ *
+ * // SendingTime for the resent messages.
+ * char now[32];
+ * hffix::message_writer t(now);
+ * t.push_back_timestamp(hffix::tag::SendingTime, std::chrono::system_clock::now());
+ *
+ * engine.resend(journal, begin_seq_no, end_seq_no, now + 3, t.message_end() - 1);
+ * \endcode
+ *
+ * \tparam Sink Function object type which is called with each full batch.
+ */
+template <typename Sink> class resend_engine {
+public:
+
+    /*!
+     * \brief Construct a resend engine for one FIX session.
+     *
+     * \param begin_string The BeginString of the resent messages, for example "FIX.4.4". Not copied.
+     * \param sender_comp_id The SenderCompID of the SequenceReset-GapFill messages. Not copied.
+     * \param target_comp_id The TargetCompID of the SequenceReset-GapFill messages. Not copied.
+     * \param buffer Batch buffer. Must be big enough for the biggest resent message, plus room for the new header fields.
+     * \param size Size of the batch buffer.
+     * \param sink Function object which is called with each batch. Not copied.
+     */
+    resend_engine(
+        char const* begin_string,
+        char const* sender_comp_id,
+        char const* target_comp_id,
+        char* buffer,
+        size_t size,
+        Sink& sink
+    ) :
+        begin_string_(begin_string),
+        sender_comp_id_(sender_comp_id),
+        target_comp_id_(target_comp_id),
+        buffer_(buffer),
+        buffer_end_(buffer + size),
+        next_(buffer),
+        sink_(sink),
+        gap_fill_size_(
+            // 8= 9= 35= 49= 56= 34= 43= 52= 122= 123= 36= 10= with their '=' and SOH,
+            // the widest int values and the 6-digit BodyLength, with some to spare.
+            96
+            + std::strlen(begin_string)
+            + std::strlen(sender_comp_id)
+            + std::strlen(target_comp_id))
+    {}
+
+    /*!
+     * \brief Resend the messages in a range of sequence numbers from a span of sent messages.
+     *
+     * \param begin Pointer to the beginning of the span of sent messages, in MsgSeqNum order.
+     * \param end Pointer to past-the-end of the span of sent messages.
+     * \param first The BeginSeqNo of the ResendRequest.
+     * \param last The EndSeqNo of the ResendRequest, or 0 for all messages after first.
+     * \param sending_time_begin Pointer to the beginning of the value for the new SendingTime fields.
+     * \param sending_time_end Pointer to past-the-end of the value for the new SendingTime fields.
+     * \return The number of messages written to the sink.
+     * \throw std::out_of_range If a message doesn't fit in the batch buffer.
+     */
+    size_t resend(
+        char const* begin,
+        char const* end,
+        int first,
+        int last,
+        char const* sending_time_begin,
+        char const* sending_time_end
+    ) {
+        time_begin_ = sending_time_begin;
+        time_end_ = sending_time_end;
+        size_t count = 0;
+        int next = first;           // The first sequence number not yet resent.
+        int top = first - 1;        // The last sequence number seen.
+
+        if (begin < end) {
+            for (message_reader r(begin, end); r.is_complete() && r.is_valid(); r = r.next_message_reader()) {
+                message_reader::const_iterator i = r.begin();
+                message_reader::const_iterator const e = r.end();
+                field_value const msg_type = i->value();
+
+                // Find the MsgSeqNum and the original SendingTime in the header.
+                int seqnum = 0;
+                char const* original_time_begin = 0;
+                char const* original_time_end = 0;
+                for (++i; i != e && details::is_standard_header_tag(i->tag()); ++i) {
+                    if (i->tag() == tag::MsgSeqNum) {
+                        seqnum = i->value().as_int<int>();
+                    } else if (i->tag() == tag::SendingTime) {
+                        original_time_begin = i->value().begin();
+                        original_time_end = i->value().end();
+                    }
+                }
+
+                if (seqnum < next) continue;
+                if (last > 0 && seqnum > last) break;
+                top = seqnum;
+                if (details::is_session_msg_type(msg_type)) continue;
+
+                if (seqnum > next) {
+                    gap_fill(next, seqnum);
+                    ++count;
+                }
+
+                reserve(r.message_size() + 32 + (time_end_ - time_begin_));
+                message_writer w(next_, buffer_end_);
+                w.push_back_header(begin_string_);
+                w.push_back_string(tag::MsgType, msg_type.begin(), msg_type.end());
+                w.push_back_char(tag::PossDupFlag, 'Y');
+                w.push_back_string(tag::SendingTime, time_begin_, time_end_);
+                if (original_time_begin)
+                    w.push_back_string(tag::OrigSendingTime, original_time_begin, original_time_end);
+                // Copy everything after MsgType except PossDupFlag, SendingTime
+                // and OrigSendingTime, which are rewritten, one run of fields at a time.
+                char const* run = msg_type.end() + 1;
+                for (i = r.begin() + 1; i != e && details::is_standard_header_tag(i->tag()); ++i) {
+                    switch (i->tag()) {
+                    case tag::PossDupFlag:
+                    case tag::SendingTime:
+                    case tag::OrigSendingTime:
+                        w.push_back_fields(run, details::field_begin(*i));
+                        run = i->value().end() + 1;
+                        break;
+                    }
+                }
+                w.push_back_fields(run, r.message_end() - 7); // Up to the CheckSum field.
+                w.push_back_trailer();
+                next_ = w.message_end();
+                ++count;
+                next = seqnum + 1;
+            }
+        }
+
+        int const stop = last > 0 ? last : top;
+        if (next <= stop) {
+            gap_fill(next, stop + 1);
+            ++count;
+        }
+        flush();
+        return count;
+    }
+
+    /*!
+     * \brief Resend the messages in a range of sequence numbers from a hffix::message_journal.
+     *
+     * If last is 0, or beyond the end of the journal, then the resend ends with
+     * the last sequence number sent, which is one before message_journal::next_send_seqnum().
+     *
+     * \param journal A message_journal, or any type with the same `range` and `next_send_seqnum` methods.
+     * \param first The BeginSeqNo of the ResendRequest.
+     * \param last The EndSeqNo of the ResendRequest, or 0 for all messages after first.
+     * \param sending_time_begin Pointer to the beginning of the value for the new SendingTime fields.
+     * \param sending_time_end Pointer to past-the-end of the value for the new SendingTime fields.
+     * \return The number of messages written to the sink.
+     * \throw std::out_of_range If a message doesn't fit in the batch buffer.
+     */
+    template <typename Journal> size_t resend(
+        Journal const& journal,
+        int first,
+        int last,
+        char const* sending_time_begin,
+        char const* sending_time_end
+    ) {
+        int const top = journal.next_send_seqnum() - 1;
+        if (last <= 0 || last > top) last = top;
+        if (first > last) return 0;
+        char const* begin = 0;
+        char const* end = 0;
+        journal.range(first, last, begin, end);
+        return resend(begin, end, first, last, sending_time_begin, sending_time_end);
+    }
+
+    /*! \brief Pass the messages in the batch buffer to the sink, if there are any. */
+    void flush() {
+        if (next_ != buffer_) {
+            sink_(static_cast<char const*>(buffer_), static_cast<char const*>(next_));
+            next_ = buffer_;
+        }
+    }
+
+private:
+    resend_engine(resend_engine const&);
+    resend_engine& operator=(resend_engine const&);
+
+    // Flush the batch if there are not at least size bytes remaining.
+    void reserve(size_t size) {
+        if (size_t(buffer_end_ - next_) < size) flush();
+    }
+
+    // Write a SequenceReset-GapFill for seqnum with NewSeqNo new_seqnum.
+    void gap_fill(int seqnum, int new_seqnum) {
+        reserve(gap_fill_size_ + 2 * (time_end_ - time_begin_));
+        message_writer w(next_, buffer_end_);
+        w.push_back_header(begin_string_);
+        w.push_back_string(tag::MsgType, "4");
+        w.push_back_string(tag::SenderCompID, sender_comp_id_);
+        w.push_back_string(tag::TargetCompID, target_comp_id_);
+        w.push_back_int(tag::MsgSeqNum, seqnum);
+        w.push_back_char(tag::PossDupFlag, 'Y');
+        w.push_back_string(tag::SendingTime, time_begin_, time_end_);
+        w.push_back_string(tag::OrigSendingTime, time_begin_, time_end_);
+        w.push_back_char(tag::GapFillFlag, 'Y');
+        w.push_back_int(tag::NewSeqNo, new_seqnum);
+        w.push_back_trailer();
+        next_ = w.message_end();
+    }
+
+    char const* begin_string_;
+    char const* sender_comp_id_;
+    char const* target_comp_id_;
+    char* buffer_;
+    char* buffer_end_;
+    char* next_;
+    Sink& sink_;
+    size_t gap_fill_size_; // The size of a SequenceReset-GapFill, without the SendingTimes.
+    char const* time_begin_;
+    char const* time_end_;
+};
+
+} // namespace hffix
+
+#endif // HFFIX_RESEND_HPP
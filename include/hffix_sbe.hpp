@@ -0,0 +1,1155 @@
+/*******************************************************************************************
+Copyright 2011, T3 IP, LLC. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are
+permitted provided that the following conditions are met:
+
+   1. Redistributions of source code must retain the above copyright notice, this list of
+      conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright notice, this list
+      of conditions and the following disclaimer in the documentation and/or other materials
+      provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY T3 IP, LLC ``AS IS'' AND ANY EXPRESS OR IMPLIED
+WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL T3 IP, LLC OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those of the
+authors and should not be interpreted as representing official policies, either expressed
+or implied, of T3 IP, LLC.
+*******************************************************************************************/
+
+/*!
+ * \file
+ * \brief Transcoding between FIX tag-value messages and SBE (Simple Binary Encoding) messages.
+ *
+ * Requires hffix.hpp.
+ */
+
+#ifndef HFFIX_SBE_HPP
+#define HFFIX_SBE_HPP
+
+#include "hffix.hpp"
+#include "hffix_xml.hpp"
+#include <algorithm> // for lower_bound
+#include <cstddef>   // for size_t
+#include <cstring>   // for memcpy, memchr, strlen
+#include <limits>    // for numeric_limits
+#include <map>
+#include <stdexcept> // for exceptions
+#include <string>
+#include <vector>
+#include <stdint.h>  // for uint64_t
+
+namespace hffix {
+
+/*!
+ * \brief SBE (Simple Binary Encoding) transcoder.
+ *
+ * SBE messages have fixed-size fields at fixed offsets in a root block, followed by
+ * repeating groups of fixed-size blocks, followed by variable-length data. An SBE
+ * message can be read without parsing, by loading each field from its offset.
+ *
+ * The message schema is loaded from SBE XML into a hffix::sbe::schema. The
+ * hffix::sbe::encoder transcodes the fields of a hffix::message_reader into an SBE
+ * message in one pass, and the hffix::sbe::decoder transcodes an SBE message into
+ * FIX tag-value fields with a hffix::message_writer.
+ *
+ * The `id` of each field, group and data element of the schema is its FIX tag. The `id`
+ * of a group is the tag of its _NumInGroup_ field.
+ *
+ * Supported field types are
+ * - The integer primitive types, and enums encoded as integers, as FIX integers.
+ * - `char`, and enums encoded as `char`, as FIX chars.
+ * - `char` arrays as FIX strings, padded with zeros.
+ * - Composites with `mantissa` and `exponent` members, where the exponent may be constant, as FIX decimals.
+ * - Composites with `time` and constant `unit` members, as FIX UTCTimestamps. The unit
+ *   is the SBE `TimeUnit`: 0 for seconds, 3 for milliseconds, 6 for microseconds and
+ *   9 for nanoseconds, and the time is from the Unix epoch.
+ * - Constant fields.
+ *
+ * Floating point types, sets, and composites of other shapes are not supported.
+ * Nothing is checked against `sinceVersion`, but the decoder uses the block length in
+ * the message header and in each group dimension, so it can decode messages with
+ * blocks extended by later versions of the schema.
+ */
+namespace sbe {
+
+class encoder;
+class decoder;
+
+/* @cond EXCLUDE */
+
+namespace details {
+
+enum primitive_type { type_char, type_int8, type_int16, type_int32, type_int64, type_uint8, type_uint16, type_uint32, type_uint64 };
+
+inline size_t primitive_size(primitive_type t) {
+    switch (t) {
+    case type_int16:
+    case type_uint16:
+        return 2;
+    case type_int32:
+    case type_uint32:
+        return 4;
+    case type_int64:
+    case type_uint64:
+        return 8;
+    default:
+        return 1;
+    }
+}
+
+inline bool primitive_signed(primitive_type t) {
+    return t == type_int8 || t == type_int16 || t == type_int32 || t == type_int64;
+}
+
+// The default null value, sign-extended.
+inline uint64_t primitive_null(primitive_type t) {
+    if (t == type_char) return 0;
+    size_t const bits = primitive_size(t) * 8;
+    if (primitive_signed(t)) return ~uint64_t(0) << (bits - 1);
+    return bits == 64 ? ~uint64_t(0) : (uint64_t(1) << bits) - 1;
+}
+
+inline int64_t to_signed(uint64_t x) {
+    return x >> 63 ? -int64_t(~x) - 1 : int64_t(x);
+}
+
+// True if the sign-extended or zero-extended value fits in the primitive type.
+inline bool fits(primitive_type t, uint64_t x) {
+    size_t const bits = primitive_size(t) * 8;
+    if (bits == 64) return true;
+    if (primitive_signed(t)) {
+        uint64_t const high = x >> (bits - 1);
+        return !high || high == (~uint64_t(0) >> (bits - 1));
+    }
+    return !(x >> bits);
+}
+
+template <size_t N> inline void store_n(char* p, uint64_t x, bool big_endian) {
+    for (size_t i = 0; i < N; ++i) p[big_endian ? N - 1 - i : i] = char(x >> (8 * i));
+}
+
+template <size_t N> inline uint64_t load_n(char const* p, bool big_endian) {
+    uint64_t x = 0;
+    for (size_t i = 0; i < N; ++i) x |= uint64_t(static_cast<unsigned char>(p[big_endian ? N - 1 - i : i])) << (8 * i);
+    return x;
+}
+
+inline void store(char* p, primitive_type t, uint64_t x, bool big_endian) {
+    switch (primitive_size(t)) {
+    case 1: *p = char(x); break;
+    case 2: store_n<2>(p, x, big_endian); break;
+    case 4: store_n<4>(p, x, big_endian); break;
+    default: store_n<8>(p, x, big_endian); break;
+    }
+}
+
+// Load, and sign-extend the signed types.
+inline uint64_t load(char const* p, primitive_type t, bool big_endian) {
+    uint64_t x;
+    size_t const size = primitive_size(t);
+    switch (size) {
+    case 1: x = static_cast<unsigned char>(*p); break;
+    case 2: x = load_n<2>(p, big_endian); break;
+    case 4: x = load_n<4>(p, big_endian); break;
+    default: return load_n<8>(p, big_endian);
+    }
+    if (primitive_signed(t) && (x >> (size * 8 - 1))) x |= ~uint64_t(0) << (size * 8);
+    return x;
+}
+
+inline int64_t pow10(int n) {
+    int64_t x = 1;
+    while (n-- > 0) x *= 10;
+    return x;
+}
+
+// Days from 1970-01-01 in the proleptic Gregorian calendar,
+// from http://howardhinnant.github.io/date_algorithms.html
+inline int64_t days_from_civil(int64_t y, unsigned m, unsigned d) {
+    y -= m <= 2;
+    int64_t const era = (y >= 0 ? y : y - 399) / 400;
+    unsigned const yoe = unsigned(y - era * 400);
+    unsigned const doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+    unsigned const doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + int64_t(doe) - 719468;
+}
+
+inline void civil_from_days(int64_t z, int& y, int& m, int& d) {
+    z += 719468;
+    int64_t const era = (z >= 0 ? z : z - 146096) / 146097;
+    unsigned const doe = unsigned(z - era * 146097);
+    unsigned const yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    unsigned const doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    unsigned const mp = (5 * doy + 2) / 153;
+    d = int(doy - (153 * mp + 2) / 5 + 1);
+    m = int(mp < 10 ? mp + 3 : mp - 9);
+    y = int(int64_t(yoe) + era * 400 + (m <= 2));
+}
+
+// A simple type, or a member of a composite.
+struct simple_type {
+    simple_type() : primitive(type_uint8), length(1), null(0), constant(false), optional(false), offset(0) {}
+    std::string name;
+    primitive_type primitive;
+    size_t length;  // number of primitives
+    uint64_t null;
+    bool constant;
+    bool optional;
+    std::string value; // of a constant
+    size_t offset;  // in a composite
+    size_t size() const { return constant ? 0 : primitive_size(primitive) * length; }
+};
+
+struct composite_type {
+    std::vector<simple_type> members;
+    size_t size;
+
+    simple_type const* member(char const* name) const {
+        for (size_t i = 0; i < members.size(); ++i)
+            if (members[i].name == name) return &members[i];
+        return 0;
+    }
+};
+
+enum field_kind { kind_int, kind_uint, kind_char, kind_string, kind_decimal, kind_timestamp, kind_constant };
+
+struct field_info {
+    int tag;
+    field_kind kind;
+    size_t offset;            // in the block
+    size_t size;
+    primitive_type primitive; // of the value, the mantissa or the time
+    uint64_t null;
+    size_t value_offset;      // in the field
+    bool exponent_constant;
+    int exponent;             // constant exponent, or time unit exponent
+    primitive_type exponent_primitive;
+    size_t exponent_offset;   // in the field
+    std::string value;        // of a constant
+};
+
+struct data_info {
+    int tag;
+    primitive_type length_primitive;
+    size_t length_offset;
+    size_t header_size;
+};
+
+// A composite with a block length and a count, for a group dimension or a message header.
+struct dimension_info {
+    size_t size;
+    primitive_type block_length_primitive;
+    size_t block_length_offset;
+    primitive_type count_primitive;
+    size_t count_offset;
+};
+
+struct member_ref {
+    enum kind_type { field, group, data };
+    int tag;
+    kind_type kind;
+    size_t index; // in fields, groups or data
+
+    bool operator<(member_ref const& b) const { return tag < b.tag; }
+};
+
+// The root block of a message, or the block of a group entry.
+struct block_info {
+    int tag;          // of the NumInGroup field of a group
+    int first_tag;    // of a group entry
+    size_t block_length;
+    std::vector<field_info> fields;
+    std::vector<size_t> groups; // blocks
+    std::vector<data_info> data;
+    std::vector<member_ref> members; // sorted by tag
+    std::string null_block;
+    dimension_info dimension;   // of a group
+
+    member_ref const* find(int tag) const {
+        member_ref key;
+        key.tag = tag;
+        std::vector<member_ref>::const_iterator const i = std::lower_bound(members.begin(), members.end(), key);
+        return i != members.end() && i->tag == tag ? &*i : 0;
+    }
+};
+
+struct header_info {
+    size_t size;
+    primitive_type block_length_primitive;
+    size_t block_length_offset;
+    primitive_type template_id_primitive;
+    size_t template_id_offset;
+    primitive_type schema_id_primitive;
+    size_t schema_id_offset;
+    primitive_type version_primitive;
+    size_t version_offset;
+};
+
+struct message_info {
+    unsigned id;
+    std::string msg_type;
+    size_t block;
+};
+
+inline void throw_truncated() {
+    throw std::out_of_range("hffix::sbe message truncated");
+}
+
+inline void throw_overflow() {
+    throw std::out_of_range("hffix::sbe buffer too small");
+}
+
+inline void throw_error(char const* what, int tag) {
+    char digits[16];
+    std::string s("hffix::sbe ");
+    s += what;
+    s += " for tag ";
+    s.append(digits, hffix::details::itoa(tag, digits, digits + sizeof(digits)));
+    throw std::runtime_error(s);
+}
+
+// Multiply the mantissa by 10 to the n, or throw if it overflows.
+inline int64_t scale10(int64_t mantissa, int64_t n, int tag) {
+    for (; n > 0 && mantissa; --n) {
+        if (mantissa > std::numeric_limits<int64_t>::max() / 10 || mantissa < std::numeric_limits<int64_t>::min() / 10)
+            throw_error("value out of range", tag);
+        mantissa *= 10;
+    }
+    return mantissa;
+}
+
+} // namespace details
+
+/* @endcond */
+
+/*!
+ * \brief An SBE message schema.
+ *
+ * Load the schema before constructing a hffix::sbe::encoder or hffix::sbe::decoder,
+ * and keep it until after the encoder and decoder are destroyed.
+ */
+class schema {
+public:
+    schema() : id_(0), version_(0), big_endian_(false) {}
+
+    /*!
+     * \brief Load the schema from an SBE XML `messageSchema` document.
+     *
+     * \param begin Pointer to the beginning of the XML text.
+     * \param end Pointer to past-the-end of the XML text.
+     *
+     * \throw std::invalid_argument If the XML is malformed, or uses unsupported SBE types.
+     */
+    void load(char const* begin, char const* end) {
+        hffix::details::xml_element root;
+        hffix::details::xml_parser("hffix::sbe schema", begin, end).document(root);
+        if (root.name != "messageSchema") fail("unsupported root element " + root.name);
+        id_ = unsigned_attribute(root, "id", 0);
+        version_ = unsigned_attribute(root, "version", 0);
+        char const* const byte_order = root.attribute("byteOrder");
+        big_endian_ = byte_order && std::string(byte_order) == "bigEndian";
+        types_.clear();
+        composites_.clear();
+        blocks_.clear();
+        messages_.clear();
+        for (size_t i = 0; i < root.children.size(); ++i)
+            if (root.children[i].name == "types") add_types(root.children[i]);
+        char const* const header_type = root.attribute("headerType");
+        header_ = header(header_type ? header_type : "messageHeader");
+        for (size_t i = 0; i < root.children.size(); ++i) {
+            hffix::details::xml_element const& c = root.children[i];
+            if (c.name == "types") continue;
+            if (c.name != "message") fail("unsupported element " + c.name);
+            details::message_info m;
+            m.id = unsigned_attribute(c, "id", 0);
+            if (contains(m.id)) fail("duplicate message id " + std::string(c.attribute("id")));
+            char const* const semantic_type = c.attribute("semanticType");
+            if (semantic_type) m.msg_type = semantic_type;
+            m.block = add_block(c, 0);
+            messages_.push_back(m);
+        }
+    }
+
+    /*!
+     * \brief Load the schema from an SBE XML `messageSchema` document in a C-style null-terminated string.
+     *
+     * \throw std::invalid_argument If the XML is malformed, or uses unsupported SBE types.
+     */
+    void load(char const* cstring) {
+        load(cstring, cstring + std::strlen(cstring));
+    }
+
+    /*!
+     * \brief True if there is a message with this template id.
+     */
+    bool contains(unsigned template_id) const {
+        return find(template_id) != npos;
+    }
+
+    /*!
+     * \brief Size of the message header.
+     */
+    size_t header_size() const {
+        return header_.size;
+    }
+
+    /*!
+     * \brief Offset of a field from the beginning of an SBE message, for reading fields of the root block.
+     *
+     * For a decimal field, the offset of the mantissa, and for a timestamp field, the offset of the time.
+     *
+     * \return The offset, or `size_t(-1)` if there is no such field in the root block.
+     */
+    size_t field_offset(unsigned template_id, int tag) const {
+        size_t const m = find(template_id);
+        if (m == npos) return npos;
+        details::block_info const& b = blocks_[messages_[m].block];
+        details::member_ref const* const r = b.find(tag);
+        if (!r || r->kind != details::member_ref::field || b.fields[r->index].kind == details::kind_constant) return npos;
+        return header_.size + b.fields[r->index].offset + b.fields[r->index].value_offset;
+    }
+
+private:
+    friend class encoder;
+    friend class decoder;
+
+    static size_t const npos = size_t(-1);
+
+    unsigned id_;
+    unsigned version_;
+    bool big_endian_;
+    details::header_info header_;
+    std::map<std::string, details::simple_type> types_;
+    std::map<std::string, details::composite_type> composites_;
+    std::vector<details::block_info> blocks_;
+    std::vector<details::message_info> messages_;
+
+    size_t find(unsigned template_id) const {
+        for (size_t i = 0; i < messages_.size(); ++i)
+            if (messages_[i].id == template_id) return i;
+        return npos;
+    }
+
+    static void fail(std::string const& what) {
+        hffix::details::throw_xml_error("hffix::sbe schema", what);
+    }
+
+    static unsigned unsigned_attribute(hffix::details::xml_element const& e, char const* key, unsigned otherwise) {
+        char const* const a = e.attribute(key);
+        return a ? hffix::details::atou<unsigned>(a, a + std::strlen(a)) : otherwise;
+    }
+
+    static details::primitive_type primitive(std::string const& name) {
+        static char const* const names[] = { "char", "int8", "int16", "int32", "int64", "uint8", "uint16", "uint32", "uint64" };
+        for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); ++i)
+            if (name == names[i]) return details::primitive_type(i);
+        fail("unsupported primitive type " + name);
+        return details::type_char;
+    }
+
+    static bool is_primitive(std::string const& name) {
+        return name == "char" || name == "int8" || name == "int16" || name == "int32" || name == "int64"
+            || name == "uint8" || name == "uint16" || name == "uint32" || name == "uint64";
+    }
+
+    // A type element, or an enum as its encoding type.
+    details::simple_type simple(hffix::details::xml_element const& e) const {
+        details::simple_type t;
+        char const* const name = e.attribute("name");
+        if (name) t.name = name;
+        if (e.name == "enum") {
+            char const* const encoding = e.attribute("encodingType");
+            if (!encoding) fail("enum has no encodingType");
+            if (is_primitive(encoding)) {
+                t.primitive = primitive(encoding);
+                t.null = details::primitive_null(t.primitive);
+            } else {
+                std::map<std::string, details::simple_type>::const_iterator const i = types_.find(encoding);
+                if (i == types_.end()) fail("unknown enum encodingType " + std::string(encoding));
+                t.primitive = i->second.primitive;
+                t.null = i->second.null;
+            }
+        } else {
+            char const* const p = e.attribute("primitiveType");
+            if (!p) fail("type has no primitiveType");
+            t.primitive = primitive(p);
+            t.length = unsigned_attribute(e, "length", 1);
+            t.null = details::primitive_null(t.primitive);
+            if (char const* const null = e.attribute("nullValue")) t.null = parse_integer(t.primitive, null);
+            char const* const presence = e.attribute("presence");
+            t.constant = presence && std::string(presence) == "constant";
+            t.optional = presence && std::string(presence) == "optional";
+            t.value = e.text;
+        }
+        t.offset = unsigned_attribute(e, "offset", 0);
+        return t;
+    }
+
+    static uint64_t parse_integer(details::primitive_type t, char const* s) {
+        char const* const end = s + std::strlen(s);
+        if (t == details::type_char) return s == end ? 0 : static_cast<unsigned char>(*s);
+        if (details::primitive_signed(t)) return uint64_t(hffix::details::atoi<int64_t>(s, end));
+        return hffix::details::atou<uint64_t>(s, end);
+    }
+
+    void add_types(hffix::details::xml_element const& types) {
+        for (size_t i = 0; i < types.children.size(); ++i) {
+            hffix::details::xml_element const& e = types.children[i];
+            char const* const name = e.attribute("name");
+            if (!name) fail(e.name + " has no name");
+            if (e.name == "type" || e.name == "enum") {
+                types_[name] = simple(e);
+            } else if (e.name == "composite") {
+                details::composite_type c;
+                size_t offset = 0;
+                for (size_t j = 0; j < e.children.size(); ++j) {
+                    if (e.children[j].name != "type") fail("unsupported member " + e.children[j].name + " of composite " + name);
+                    details::simple_type m = simple(e.children[j]);
+                    if (!e.children[j].attribute("offset")) m.offset = offset;
+                    offset = m.offset + m.size();
+                    c.members.push_back(m);
+                }
+                c.size = offset;
+                composites_[name] = c;
+            }
+            // Sets are not supported, and are an unknown type if a field has one.
+        }
+    }
+
+    details::header_info header(std::string const& name) const {
+        details::header_info h;
+        std::map<std::string, details::composite_type>::const_iterator const i = composites_.find(name);
+        if (i == composites_.end()) {
+            h.size = 8;
+            h.block_length_primitive = h.template_id_primitive = h.schema_id_primitive = h.version_primitive = details::type_uint16;
+            h.block_length_offset = 0;
+            h.template_id_offset = 2;
+            h.schema_id_offset = 4;
+            h.version_offset = 6;
+            return h;
+        }
+        details::composite_type const& c = i->second;
+        h.size = c.size;
+        member(c, "blockLength", h.block_length_primitive, h.block_length_offset);
+        member(c, "templateId", h.template_id_primitive, h.template_id_offset);
+        member(c, "schemaId", h.schema_id_primitive, h.schema_id_offset);
+        member(c, "version", h.version_primitive, h.version_offset);
+        return h;
+    }
+
+    static void member(details::composite_type const& c, char const* name, details::primitive_type& primitive, size_t& offset) {
+        details::simple_type const* const m = c.member(name);
+        if (!m || m->constant) fail(std::string("composite has no ") + name + " member");
+        primitive = m->primitive;
+        offset = m->offset;
+    }
+
+    static int tag_of(hffix::details::xml_element const& e) {
+        char const* const id = e.attribute("id");
+        if (!id) fail(e.name + " has no id");
+        return hffix::details::atoi<int>(id, id + std::strlen(id));
+    }
+
+    // Add the block for a message or group element, and return its index.
+    size_t add_block(hffix::details::xml_element const& e, int tag) {
+        size_t const index = blocks_.size();
+        blocks_.push_back(details::block_info());
+        details::block_info b;
+        b.tag = tag;
+        b.first_tag = 0;
+        size_t offset = 0;
+        for (size_t i = 0; i < e.children.size(); ++i) {
+            hffix::details::xml_element const& c = e.children[i];
+            details::member_ref r;
+            r.tag = tag_of(c);
+            if (!b.first_tag) b.first_tag = r.tag;
+            if (c.name == "field") {
+                details::field_info f = field(c);
+                if (!c.attribute("offset")) f.offset = offset;
+                offset = f.offset + f.size;
+                r.kind = details::member_ref::field;
+                r.index = b.fields.size();
+                b.fields.push_back(f);
+            } else if (c.name == "group") {
+                char const* const dimension = c.attribute("dimensionType");
+                details::dimension_info d = group_dimension(dimension ? dimension : "groupSizeEncoding");
+                size_t const g = add_block(c, r.tag);
+                blocks_[g].dimension = d;
+                r.kind = details::member_ref::group;
+                r.index = b.groups.size();
+                b.groups.push_back(g);
+            } else if (c.name == "data") {
+                r.kind = details::member_ref::data;
+                r.index = b.data.size();
+                b.data.push_back(data(c, r.tag));
+            } else {
+                fail("unsupported element " + c.name);
+            }
+            b.members.push_back(r);
+        }
+        std::sort(b.members.begin(), b.members.end());
+        for (size_t i = 1; i < b.members.size(); ++i)
+            if (b.members[i].tag == b.members[i - 1].tag) fail("duplicate id " + std::string(e.attribute("name") ? e.attribute("name") : ""));
+        b.block_length = std::max(offset, size_t(unsigned_attribute(e, "blockLength", 0)));
+        b.null_block.assign(b.block_length, '\0');
+        for (size_t i = 0; i < b.fields.size(); ++i) {
+            details::field_info const& f = b.fields[i];
+            if (f.kind == details::kind_constant || f.kind == details::kind_string) continue;
+            details::store(&b.null_block[f.offset + f.value_offset], f.primitive, f.null, big_endian_);
+            if (f.kind == details::kind_decimal && !f.exponent_constant)
+                details::store(&b.null_block[f.offset + f.exponent_offset], f.exponent_primitive, details::primitive_null(f.exponent_primitive), big_endian_);
+        }
+        details::dimension_info const d = blocks_[index].dimension;
+        blocks_[index] = b;
+        blocks_[index].dimension = d;
+        return index;
+    }
+
+    details::dimension_info group_dimension(std::string const& name) const {
+        details::dimension_info d;
+        std::map<std::string, details::composite_type>::const_iterator const i = composites_.find(name);
+        if (i == composites_.end()) {
+            d.size = 4;
+            d.block_length_primitive = d.count_primitive = details::type_uint16;
+            d.block_length_offset = 0;
+            d.count_offset = 2;
+            return d;
+        }
+        d.size = i->second.size;
+        member(i->second, "blockLength", d.block_length_primitive, d.block_length_offset);
+        member(i->second, "numInGroup", d.count_primitive, d.count_offset);
+        return d;
+    }
+
+    details::data_info data(hffix::details::xml_element const& e, int tag) const {
+        char const* const type = e.attribute("type");
+        if (!type) fail("data has no type");
+        std::map<std::string, details::composite_type>::const_iterator const i = composites_.find(type);
+        if (i == composites_.end()) fail("unknown data type " + std::string(type));
+        details::data_info d;
+        d.tag = tag;
+        member(i->second, "length", d.length_primitive, d.length_offset);
+        details::simple_type const* const v = i->second.member("varData");
+        if (!v) fail("composite " + std::string(type) + " has no varData member");
+        d.header_size = v->offset;
+        return d;
+    }
+
+    details::field_info field(hffix::details::xml_element const& e) const {
+        details::field_info f;
+        f.tag = tag_of(e);
+        f.offset = unsigned_attribute(e, "offset", 0);
+        f.value_offset = 0;
+        f.exponent_constant = false;
+        f.exponent = 0;
+        f.exponent_primitive = details::type_int8;
+        f.exponent_offset = 0;
+        char const* const type = e.attribute("type");
+        if (!type) fail("field has no type");
+        char const* const presence = e.attribute("presence");
+        if (presence && std::string(presence) == "constant") {
+            f.kind = details::kind_constant;
+            f.size = 0;
+            f.value = e.text;
+            f.primitive = details::type_char;
+            f.null = 0;
+            if (!f.value.empty()) return f;
+        }
+        std::map<std::string, details::composite_type>::const_iterator const c = composites_.find(type);
+        if (c != composites_.end()) {
+            composite(f, c->second, type);
+            return f;
+        }
+        details::simple_type t;
+        if (is_primitive(type)) {
+            t.primitive = primitive(type);
+            t.null = details::primitive_null(t.primitive);
+        } else {
+            std::map<std::string, details::simple_type>::const_iterator const i = types_.find(type);
+            if (i == types_.end()) fail("unknown type " + std::string(type));
+            t = i->second;
+        }
+        f.primitive = t.primitive;
+        f.null = t.null;
+        f.size = t.size();
+        if (t.constant) {
+            f.kind = details::kind_constant;
+            f.value = t.value;
+        } else if (t.primitive == details::type_char) {
+            f.kind = t.length == 1 ? details::kind_char : details::kind_string;
+        } else if (t.length != 1) {
+            fail("unsupported array type " + std::string(type));
+        } else {
+            f.kind = details::primitive_signed(t.primitive) ? details::kind_int : details::kind_uint;
+        }
+        return f;
+    }
+
+    static void composite(details::field_info& f, details::composite_type const& c, std::string const& type) {
+        f.size = c.size;
+        details::simple_type const* const mantissa = c.member("mantissa");
+        details::simple_type const* const exponent = c.member("exponent");
+        details::simple_type const* const time = c.member("time");
+        details::simple_type const* const unit = c.member("unit");
+        if (mantissa && exponent && !mantissa->constant) {
+            f.kind = details::kind_decimal;
+            f.primitive = mantissa->primitive;
+            f.null = mantissa->null;
+            f.value_offset = mantissa->offset;
+            f.exponent_primitive = exponent->primitive;
+            f.exponent_offset = exponent->offset;
+            f.exponent_constant = exponent->constant;
+            if (exponent->constant) f.exponent = hffix::details::atoi<int>(exponent->value.data(), exponent->value.data() + exponent->value.size());
+        } else if (time && unit && !time->constant && unit->constant) {
+            f.kind = details::kind_timestamp;
+            f.primitive = time->primitive;
+            f.null = time->null;
+            f.value_offset = time->offset;
+            int const u = hffix::details::atoi<int>(unit->value.data(), unit->value.data() + unit->value.size());
+            if (u != 0 && u != 3 && u != 6 && u != 9) fail("unsupported time unit " + unit->value);
+            f.exponent = -u;
+        } else {
+            fail("unsupported composite type " + type);
+        }
+    }
+};
+
+/*!
+ * \brief Transcodes FIX tag-value messages into SBE messages.
+ *
+ * <h3>Usage</h3>
+ *
+ * \code
+ * hffix::sbe::schema s;
+ * s.load(xml_begin, xml_end);
+ * hffix::sbe::encoder e(s);
+ * for (; reader.is_complete(); reader = reader.next_message_reader()) {
+ *     if (reader.is_valid()) p = e.encode(reader, p, bus_end);
+ * }
+ * \endcode
+ *
+ * The encoder walks the fields of the message once, and writes each field with a tag in the
+ * schema at its offset. Fields with tags which are not in the schema are skipped. Fields of the
+ * schema which are not in the message are null.
+ *
+ * A repeating group begins at its _NumInGroup_ field, and an entry of the group begins at
+ * the first field of the group in the schema. The repeating groups in the message must be in
+ * the same order as in the schema. The SBE _numInGroup_ is the number of entries in the
+ * message.
+ *
+ * Data elements are written after the groups, as SBE requires. Timestamps more precise than
+ * the time unit are truncated.
+ */
+class encoder {
+public:
+    /*!
+     * \brief Construct an encoder.
+     */
+    explicit encoder(schema const& s) : schema_(&s) {
+        levels_.reserve(8);
+    }
+
+    /*!
+     * \brief Transcode a FIX message into an SBE message, choosing the SBE message with the _semanticType_ of the FIX _MsgType_.
+     *
+     * \param reader The FIX message.
+     * \param begin Pointer to the buffer for the SBE message.
+     * \param end Pointer to past-the-end of the buffer.
+     * \return Pointer to past-the-end of the SBE message.
+     *
+     * \throw std::out_of_range If the buffer is too small.
+     * \throw std::runtime_error If there is no SBE message for the _MsgType_, or a field value does not fit its SBE type.
+     */
+    char* encode(message_reader const& reader, char* begin, char* end) {
+        message_reader::const_iterator const t = reader.message_type();
+        std::vector<details::message_info>::const_iterator m = schema_->messages_.begin();
+        for (; m != schema_->messages_.end(); ++m) {
+            if (m->msg_type.size() == t->value().size() && !std::memcmp(m->msg_type.data(), t->value().begin(), m->msg_type.size())) break;
+        }
+        if (m == schema_->messages_.end()) details::throw_error("no message for MsgType", tag::MsgType);
+        return encode(*m, reader, begin, end);
+    }
+
+    /*!
+     * \brief Transcode a FIX message into an SBE message.
+     *
+     * \param template_id The template id of the SBE message.
+     * \param reader The FIX message.
+     * \param begin Pointer to the buffer for the SBE message.
+     * \param end Pointer to past-the-end of the buffer.
+     * \return Pointer to past-the-end of the SBE message.
+     *
+     * \throw std::out_of_range If the buffer is too small.
+     * \throw std::runtime_error If the template id is unknown, or a field value does not fit its SBE type.
+     */
+    char* encode(unsigned template_id, message_reader const& reader, char* begin, char* end) {
+        size_t const m = schema_->find(template_id);
+        if (m == schema::npos) details::throw_error("unknown template id", int(template_id));
+        return encode(schema_->messages_[m], reader, begin, end);
+    }
+
+private:
+    schema const* schema_;
+
+    // The root block, or a repeating group.
+    struct level {
+        details::block_info const* block;
+        char* entry;          // the current entry
+        char* dimension;      // of a group
+        size_t count;         // of entries
+        size_t next_group;    // of the current entry
+        size_t data_begin;    // of the current entry
+    };
+
+    struct data_ref {
+        size_t index;
+        char const* begin;
+        char const* end;
+    };
+
+    std::vector<level> levels_;
+    std::vector<data_ref> data_;
+
+    char* encode(details::message_info const& m, message_reader const& reader, char* begin, char* end) {
+        details::header_info const& h = schema_->header_;
+        bool const big = schema_->big_endian_;
+        details::block_info const& root = schema_->blocks_[m.block];
+        if (size_t(end - begin) < h.size + root.block_length) details::throw_overflow();
+        details::store(begin + h.block_length_offset, h.block_length_primitive, root.block_length, big);
+        details::store(begin + h.template_id_offset, h.template_id_primitive, m.id, big);
+        details::store(begin + h.schema_id_offset, h.schema_id_primitive, schema_->id_, big);
+        details::store(begin + h.version_offset, h.version_primitive, schema_->version_, big);
+        char* p = begin + h.size;
+        std::memcpy(p, root.null_block.data(), root.block_length);
+        levels_.clear();
+        data_.clear();
+        level const l = { &root, p, 0, 0, 0, 0 };
+        levels_.push_back(l);
+        p += root.block_length;
+
+        for (message_reader::const_iterator i = reader.begin(); i != reader.end(); ++i) {
+            int const tag = i->tag();
+            size_t depth = levels_.size();
+            details::member_ref const* r = 0;
+            for (; depth; --depth)
+                if ((r = levels_[depth - 1].block->find(tag))) break;
+            if (!r) continue;
+            while (levels_.size() > depth) p = close_group(p, end);
+            if (levels_.size() > 1 && (!levels_.back().entry || tag == levels_.back().block->first_tag))
+                p = next_entry(p, end);
+            level& current = levels_.back();
+            switch (r->kind) {
+            case details::member_ref::field:
+                write_field(current.block->fields[r->index], i->value(), current.entry);
+                break;
+            case details::member_ref::data: {
+                data_ref const d = { r->index, i->value().begin(), i->value().end() };
+                data_.push_back(d);
+                break;
+            }
+            case details::member_ref::group: {
+                if (r->index < current.next_group) details::throw_error("repeating group out of schema order", tag);
+                for (; current.next_group < r->index; ++current.next_group)
+                    p = empty_group(schema_->blocks_[current.block->groups[current.next_group]], p, end);
+                ++current.next_group;
+                details::block_info const& g = schema_->blocks_[current.block->groups[r->index]];
+                char* const dimension = p;
+                p = empty_group(g, p, end);
+                level const nested = { &g, 0, dimension, 0, 0, data_.size() };
+                levels_.push_back(nested);
+                break;
+            }
+            }
+        }
+        while (levels_.size() > 1) p = close_group(p, end);
+        return close_entry(levels_.back(), p, end);
+    }
+
+    char* empty_group(details::block_info const& g, char* p, char* end) const {
+        if (size_t(end - p) < g.dimension.size) details::throw_overflow();
+        std::memset(p, 0, g.dimension.size);
+        details::store(p + g.dimension.block_length_offset, g.dimension.block_length_primitive, g.block_length, schema_->big_endian_);
+        return p + g.dimension.size;
+    }
+
+    char* next_entry(char* p, char* end) {
+        level& l = levels_.back();
+        if (l.entry) p = close_entry(l, p, end);
+        if (size_t(end - p) < l.block->block_length) details::throw_overflow();
+        std::memcpy(p, l.block->null_block.data(), l.block->block_length);
+        l.entry = p;
+        ++l.count;
+        return p + l.block->block_length;
+    }
+
+    // Write the remaining groups, which are empty, and the data of the current entry.
+    char* close_entry(level& l, char* p, char* end) {
+        for (; l.next_group < l.block->groups.size(); ++l.next_group)
+            p = empty_group(schema_->blocks_[l.block->groups[l.next_group]], p, end);
+        l.next_group = 0;
+        for (size_t i = 0; i < l.block->data.size(); ++i) {
+            details::data_info const& d = l.block->data[i];
+            char const* b = 0;
+            char const* e = 0;
+            for (size_t j = l.data_begin; j < data_.size(); ++j) {
+                if (data_[j].index == i) {
+                    b = data_[j].begin;
+                    e = data_[j].end;
+                }
+            }
+            size_t const n = e - b;
+            if (!details::fits(d.length_primitive, n)) details::throw_error("data too long", d.tag);
+            if (size_t(end - p) < d.header_size + n) details::throw_overflow();
+            std::memset(p, 0, d.header_size);
+            details::store(p + d.length_offset, d.length_primitive, n, schema_->big_endian_);
+            p += d.header_size;
+            if (n) std::memcpy(p, b, n);
+            p += n;
+        }
+        data_.resize(l.data_begin);
+        return p;
+    }
+
+    char* close_group(char* p, char* end) {
+        level& l = levels_.back();
+        if (l.entry) p = close_entry(l, p, end);
+        details::dimension_info const& d = l.block->dimension;
+        if (!details::fits(d.count_primitive, l.count)) details::throw_error("too many repeating group entries", l.block->tag);
+        details::store(l.dimension + d.count_offset, d.count_primitive, l.count, schema_->big_endian_);
+        levels_.pop_back();
+        return p;
+    }
+
+    void write_field(details::field_info const& f, field_value const& v, char* entry) const {
+        char* const p = entry + f.offset;
+        bool const big = schema_->big_endian_;
+        uint64_t x = 0;
+        switch (f.kind) {
+        case details::kind_int:
+            x = uint64_t(v.as_int<int64_t>());
+            break;
+        case details::kind_uint:
+            x = v.as_int<uint64_t>();
+            break;
+        case details::kind_char:
+            if (v.size() != 1) details::throw_error("value is not one char", f.tag);
+            *p = *v.begin();
+            return;
+        case details::kind_string:
+            if (v.size() > f.size) details::throw_error("value too long", f.tag);
+            std::memcpy(p, v.begin(), v.size());
+            return;
+        case details::kind_decimal: {
+            int64_t mantissa, exponent;
+            v.as_decimal(mantissa, exponent);
+            if (f.exponent_constant) {
+                if (exponent > f.exponent) {
+                    mantissa = details::scale10(mantissa, exponent - f.exponent, f.tag);
+                } else {
+                    for (; exponent < f.exponent && mantissa; ++exponent) {
+                        if (mantissa % 10) details::throw_error("value too precise", f.tag);
+                        mantissa /= 10;
+                    }
+                }
+            } else {
+                if (!details::fits(f.exponent_primitive, uint64_t(exponent))) details::throw_error("value out of range", f.tag);
+                details::store(p + f.exponent_offset, f.exponent_primitive, uint64_t(exponent), big);
+            }
+            x = uint64_t(mantissa);
+            break;
+        }
+        case details::kind_timestamp: {
+            int year, month, day, hour, minute, second, nanosecond;
+            if (!v.as_timestamp_nano(year, month, day, hour, minute, second, nanosecond)) details::throw_error("value is not a timestamp", f.tag);
+            int64_t const seconds = details::days_from_civil(year, unsigned(month), unsigned(day)) * 86400 + hour * 3600 + minute * 60 + second;
+            int64_t const per_second = details::pow10(-f.exponent);
+            x = uint64_t(seconds * per_second + nanosecond / (1000000000 / per_second));
+            break;
+        }
+        case details::kind_constant:
+            return;
+        }
+        if (!details::fits(f.primitive, x) || x == f.null) details::throw_error("value out of range", f.tag);
+        details::store(p + f.value_offset, f.primitive, x, big);
+    }
+};
+
+/*!
+ * \brief Transcodes SBE messages into FIX tag-value fields.
+ *
+ * <h3>Usage</h3>
+ *
+ * \code
+ * hffix::sbe::decoder d(s);
+ * hffix::message_writer w(buffer, buffer_end);
+ * w.push_back_header("FIX.5.0SP2");
+ * char const* p = d.decode(sbe_begin, sbe_end, w);
+ * w.push_back_trailer();
+ * \endcode
+ *
+ * The decoder writes a _MsgType_ field with the _semanticType_ of the SBE message, if the
+ * message has no field with the _MsgType_ tag. Then it writes the fields of the root block
+ * which are not null, in schema order, then the repeating groups which are not empty,
+ * and then the data which are not empty.
+ *
+ * A data element whose tag follows a FIX binary data length tag is written as a FIX data
+ * field with hffix::message_writer::push_back_data(), and other data elements are written
+ * as strings.
+ *
+ * Decimals with a constant exponent are written without trailing zeros.
+ */
+class decoder {
+public:
+    /*!
+     * \brief Construct a decoder.
+     */
+    explicit decoder(schema const& s) : schema_(&s), template_id_(0) {}
+
+    /*!
+     * \brief Transcode an SBE message into FIX tag-value fields.
+     *
+     * \param begin Pointer to the beginning of the SBE message.
+     * \param end Pointer to past-the-end of the buffer.
+     * \param writer The fields of the message are written with this writer.
+     * \return Pointer to past-the-end of the SBE message.
+     *
+     * \throw std::out_of_range If the SBE message is truncated, or the writer's buffer is too small.
+     * \throw std::runtime_error If the SBE message has an unknown template id.
+     */
+    char const* decode(char const* begin, char const* end, message_writer& writer) {
+        details::header_info const& h = schema_->header_;
+        bool const big = schema_->big_endian_;
+        if (size_t(end - begin) < h.size) details::throw_truncated();
+        size_t const block_length = size_t(details::load(begin + h.block_length_offset, h.block_length_primitive, big));
+        template_id_ = unsigned(details::load(begin + h.template_id_offset, h.template_id_primitive, big));
+        size_t const m = schema_->find(template_id_);
+        if (m == schema::npos) details::throw_error("unknown template id", int(template_id_));
+        details::message_info const& message = schema_->messages_[m];
+        details::block_info const& root = schema_->blocks_[message.block];
+        char const* const entry = begin + h.size;
+        if (size_t(end - entry) < block_length) details::throw_truncated();
+        if (!message.msg_type.empty() && !root.find(tag::MsgType))
+            writer.push_back_string(tag::MsgType, message.msg_type.data(), message.msg_type.data() + message.msg_type.size());
+        return decode_entry(root, entry, block_length, entry + block_length, end, writer);
+    }
+
+    /*!
+     * \brief The template id of the last message decoded.
+     */
+    unsigned template_id() const {
+        return template_id_;
+    }
+
+private:
+    schema const* schema_;
+    unsigned template_id_;
+
+    char const* decode_entry(details::block_info const& b, char const* entry, size_t block_length, char const* p, char const* end, message_writer& w) const {
+        bool const big = schema_->big_endian_;
+        for (size_t i = 0; i < b.fields.size(); ++i) {
+            details::field_info const& f = b.fields[i];
+            if (f.offset + f.size <= block_length) read_field(f, entry + f.offset, w);
+        }
+        for (size_t i = 0; i < b.groups.size(); ++i) {
+            details::block_info const& g = schema_->blocks_[b.groups[i]];
+            if (size_t(end - p) < g.dimension.size) details::throw_truncated();
+            size_t const length = size_t(details::load(p + g.dimension.block_length_offset, g.dimension.block_length_primitive, big));
+            uint64_t const count = details::load(p + g.dimension.count_offset, g.dimension.count_primitive, big);
+            p += g.dimension.size;
+            if (count) w.push_back_int(g.tag, count);
+            for (uint64_t k = 0; k < count; ++k) {
+                if (size_t(end - p) < length) details::throw_truncated();
+                p = decode_entry(g, p, length, p + length, end, w);
+            }
+        }
+        for (size_t i = 0; i < b.data.size(); ++i) {
+            details::data_info const& d = b.data[i];
+            if (size_t(end - p) < d.header_size) details::throw_truncated();
+            uint64_t const n = details::load(p + d.length_offset, d.length_primitive, big);
+            p += d.header_size;
+            if (uint64_t(end - p) < n) details::throw_truncated();
+            if (n) {
+                if (hffix::details::is_tag_a_data_length(d.tag - 1)) w.push_back_data(d.tag - 1, d.tag, p, p + n);
+                else w.push_back_string(d.tag, p, p + n);
+            }
+            p += n;
+        }
+        return p;
+    }
+
+    void read_field(details::field_info const& f, char const* p, message_writer& w) const {
+        bool const big = schema_->big_endian_;
+        uint64_t x = 0;
+        if (f.kind != details::kind_constant && f.kind != details::kind_string && f.kind != details::kind_char) {
+            x = details::load(p + f.value_offset, f.primitive, big);
+            if (x == f.null) return;
+        }
+        switch (f.kind) {
+        case details::kind_int:
+            w.push_back_int(f.tag, details::to_signed(x));
+            break;
+        case details::kind_uint:
+            w.push_back_int(f.tag, x);
+            break;
+        case details::kind_char:
+            if (*p) w.push_back_char(f.tag, *p);
+            break;
+        case details::kind_string: {
+            char const* const e = static_cast<char const*>(std::memchr(p, 0, f.size));
+            if (e != p) w.push_back_string(f.tag, p, e ? e : p + f.size);
+            break;
+        }
+        case details::kind_decimal: {
+            int64_t mantissa = details::to_signed(x);
+            int64_t exponent = f.exponent;
+            if (f.exponent_constant) {
+                while (exponent < 0 && mantissa && !(mantissa % 10)) {
+                    mantissa /= 10;
+                    ++exponent;
+                }
+                if (!mantissa) exponent = 0;
+            } else {
+                exponent = details::to_signed(details::load(p + f.exponent_offset, f.exponent_primitive, big));
+            }
+            if (exponent > 0) {
+                mantissa = details::scale10(mantissa, exponent, f.tag);
+                exponent = 0;
+            }
+            w.push_back_decimal(f.tag, mantissa, exponent);
+            break;
+        }
+        case details::kind_timestamp: {
+            int64_t const per_second = details::pow10(-f.exponent);
+            int64_t const seconds = int64_t(x / uint64_t(per_second));
+            int const fraction = int(x % uint64_t(per_second));
+            int64_t const days = seconds / 86400;
+            int const second_of_day = int(seconds % 86400);
+            int year, month, day;
+            details::civil_from_days(days, year, month, day);
+            int const hour = second_of_day / 3600, minute = second_of_day / 60 % 60, second = second_of_day % 60;
+            if (f.exponent == 0) w.push_back_timestamp(f.tag, year, month, day, hour, minute, second);
+            else if (f.exponent == -3) w.push_back_timestamp(f.tag, year, month, day, hour, minute, second, fraction);
+            else w.push_back_timestamp_nano(f.tag, year, month, day, hour, minute, second, f.exponent == -6 ? fraction * 1000 : fraction);
+            break;
+        }
+        case details::kind_constant:
+            if (f.tag) w.push_back_string(f.tag, f.value.data(), f.value.data() + f.value.size());
+            break;
+        }
+    }
+};
+
+} // namespace sbe
+} // namespace hffix
+
+#endif // HFFIX_SBE_HPP
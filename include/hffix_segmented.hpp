@@ -0,0 +1,530 @@
+/*******************************************************************************************
+Copyright 2011, T3 IP, LLC. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are
+permitted provided that the following conditions are met:
+
+   1. Redistributions of source code must retain the above copyright notice, this list of
+      conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright notice, this list
+      of conditions and the following disclaimer in the documentation and/or other materials
+      provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY T3 IP, LLC ``AS IS'' AND ANY EXPRESS OR IMPLIED
+WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL T3 IP, LLC OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those of the
+authors and should not be interpreted as representing official policies, either expressed
+or implied, of T3 IP, LLC.
+*******************************************************************************************/
+
+/*!
+ * \file
+ * \brief Reading FIX messages which are split across a list of buffer segments, for example from `readv()` or io_uring provided buffers.
+ *
+ * Requires hffix.hpp and POSIX.
+ */
+
+#ifndef HFFIX_SEGMENTED_HPP
+#define HFFIX_SEGMENTED_HPP
+
+#include "hffix.hpp"
+#include <cstddef>   // for size_t
+#include <cstring>   // for memchr, memcpy
+#include <stdexcept> // for exceptions
+#include <sys/uio.h> // for iovec
+
+namespace hffix {
+
+class segmented_reader;
+
+/* @cond EXCLUDE */
+
+namespace details {
+
+// A position in a list of segments. Never at the end of a segment, except
+// at the end of the list, where seg is the end of the list.
+struct segment_position {
+    ::iovec const* seg;
+    char const* p;
+    size_t offset; // from the beginning of the message
+
+    static char const* begin_of(::iovec const* s) { return static_cast<char const*>(s->iov_base); }
+    static char const* end_of(::iovec const* s) { return begin_of(s) + s->iov_len; }
+
+    // Skip past the end of the segment, and any empty segments.
+    void settle(::iovec const* end) {
+        while (seg != end && p == end_of(seg)) {
+            ++seg;
+            p = seg != end ? begin_of(seg) : 0;
+        }
+    }
+
+    // Advance n bytes, or to the end of the list.
+    void advance(size_t n, ::iovec const* end) {
+        while (seg != end) {
+            size_t const here = end_of(seg) - p;
+            if (n < here) {
+                p += n;
+                offset += n;
+                return;
+            }
+            n -= here;
+            offset += here;
+            p = end_of(seg);
+            settle(end);
+            if (!n) return;
+        }
+    }
+
+    // Read one byte and advance. False at the end of the list.
+    bool get(char& c, ::iovec const* end) {
+        if (seg == end) return false;
+        c = *p++;
+        ++offset;
+        settle(end);
+        return true;
+    }
+};
+
+} // namespace details
+
+/* @endcond */
+
+/*!
+\brief The iterator type for hffix::segmented_reader. Typedef'd as `hffix::segmented_reader::const_iterator`.
+
+Satisfies the const Input Iterator Concept for an immutable hffix::segmented_reader container of fields.
+*/
+class segmented_reader_const_iterator {
+public:
+
+    /*! \brief No-op construction of an invalid iterator.
+     *
+     * Like a null pointer, the invalid iterator may not be dereferenced.
+     */
+    segmented_reader_const_iterator() {}
+
+    //! \brief For std::iterator_traits
+    typedef ::std::input_iterator_tag iterator_category;
+    //! \brief For std::iterator_traits
+    typedef field value_type;
+    //! \brief For std::iterator_traits
+    typedef std::ptrdiff_t difference_type;
+    //! \brief For std::iterator_traits
+    typedef field* pointer;
+    //! \brief For std::iterator_traits
+    typedef field& reference;
+
+    /*! \brief Returns a reference to a field. */
+    field const& operator*() const {
+        return current_;
+    }
+
+    /*! \brief Returns a pointer to a field. */
+    field const* operator->() const {
+        return &current_;
+    }
+
+    //! \brief Equal
+    friend bool operator==(segmented_reader_const_iterator const& a, segmented_reader_const_iterator const& b) {
+        return a.offset_ == b.offset_;
+    }
+
+    //! \brief Not equal
+    friend bool operator!=(segmented_reader_const_iterator const& a, segmented_reader_const_iterator const& b) {
+        return a.offset_ != b.offset_;
+    }
+
+    //! \brief Prefix increment
+    segmented_reader_const_iterator& operator++() {
+        increment();
+        return *this;
+    }
+
+    //! \brief Postfix increment
+    segmented_reader_const_iterator operator++(int) {
+        segmented_reader_const_iterator i(*this);
+        ++(*this);
+        return i;
+    }
+
+private:
+    friend class segmented_reader;
+
+    segmented_reader const* reader_;
+    details::segment_position next_; // first character of the tag of the field after current_
+    size_t offset_;                  // offset of the first character of the tag of current_
+    field current_;
+
+    void increment();
+    bool read_tag();
+    void read_value();
+    void read_data(size_t length);
+};
+
+/*!
+ * \brief One FIX message for reading, which may be split across a list of buffer segments.
+ *
+ * <h3>Usage</h3>
+ *
+ * Like hffix::message_reader, except that the message is read from a list
+ * of `iovec` segments instead of one contiguous buffer, so a message which
+ * arrived in several receive buffers doesn't have to be copied into one.
+ *
+ * \code
+ * char scratch[256];
+ * hffix::segmented_reader r(iov, iov + iovcnt, scratch, sizeof(scratch));
+ * for (; r.is_complete(); r = r.next_message_reader()) {
+ *     if (r.is_valid()) {
+ *         for (hffix::segmented_reader::const_iterator i = r.begin(); i != r.end(); ++i) {
+ *             // ...
+ *         }
+ *     }
+ * }
+ * \endcode
+ *
+ * Iteration yields the same fields as a hffix::message_reader on the same bytes.
+ * A field value which is inside one segment points into the segment. A field
+ * value which straddles a segment boundary is copied into the scratch buffer, so
+ * every hffix::field_value is contiguous. The scratch buffer is reused by each call
+ * to begin(), and must be as large as the straddling values of one message together.
+ *
+ * The segments and the scratch buffer must outlive the reader and its field values.
+ */
+class segmented_reader {
+public:
+
+    typedef field value_type;
+    typedef field const& const_reference;
+    typedef segmented_reader_const_iterator const_iterator;
+    typedef field const* const_pointer;
+    typedef size_t size_type;
+
+    /*!
+     * \brief Construct on a list of segments.
+     *
+     * \param iov_begin Pointer to the first segment.
+     * \param iov_end Pointer to past-the-end of the last segment.
+     * \param scratch Pointer to a buffer for copies of field values which straddle segments.
+     * \param scratch_size Size of the scratch buffer in bytes.
+     */
+    segmented_reader(::iovec const* iov_begin, ::iovec const* iov_end, char* scratch, size_t scratch_size) :
+        iov_end_(iov_end),
+        scratch_(scratch),
+        scratch_end_(scratch + scratch_size),
+        scratch_next_(scratch) {
+        start_.seg = iov_begin;
+        start_.p = iov_begin != iov_end ? details::segment_position::begin_of(iov_begin) : 0;
+        start_.offset = 0;
+        start_.settle(iov_end);
+        init();
+    }
+
+    /*!
+     * \brief Copy constructor.
+     */
+    segmented_reader(segmented_reader const& that) :
+        iov_end_(that.iov_end_),
+        scratch_(that.scratch_),
+        scratch_end_(that.scratch_end_),
+        scratch_next_(that.scratch_) {
+        start_ = that.start_;
+        init();
+    }
+
+    /*!
+     * \brief Copy assignment operator.
+     */
+    segmented_reader& operator=(segmented_reader const& that) {
+        iov_end_ = that.iov_end_;
+        scratch_ = that.scratch_;
+        scratch_end_ = that.scratch_end_;
+        scratch_next_ = that.scratch_;
+        start_ = that.start_;
+        init();
+        return *this;
+    }
+
+    /*!
+     * \brief True if the segments contain a complete FIX message, from _BeginString_ to _CheckSum_.
+     */
+    bool is_complete() const {
+        return is_complete_;
+    }
+
+    /*!
+     * \brief True if the message framing is valid, see hffix::message_reader::is_valid().
+     */
+    bool is_valid() const {
+        return is_valid_;
+    }
+
+    /*!
+     * \brief The entire size of the FIX message in bytes.
+     * \throw std::logic_error if called on an invalid message.
+     */
+    size_t message_size() const {
+        if (!is_valid_) throw std::logic_error("hffix Cannot determine size of an invalid message.");
+        return checksum_ + 7;
+    }
+
+    /*!
+     * \brief An iterator to the _MsgType_ field in the message.
+     *
+     * Values which straddle segments and were copied into the scratch buffer by an earlier iteration are overwritten.
+     *
+     * \throw std::logic_error if called on an invalid message.
+     * \throw std::out_of_range If the scratch buffer is too small for the values which straddle segments.
+     */
+    const_iterator begin() const {
+        if (!is_valid_) throw std::logic_error("hffix Cannot return iterator for an invalid message.");
+        scratch_next_ = scratch_;
+        const_iterator i;
+        i.reader_ = this;
+        i.next_ = msg_type_;
+        i.increment();
+        return i;
+    }
+
+    /*!
+     * \brief An iterator to the _CheckSum_ field in the message. Not dereferenceable.
+     *
+     * \throw std::logic_error if called on an invalid message.
+     */
+    const_iterator end() const {
+        if (!is_valid_) throw std::logic_error("hffix Cannot return iterator for an invalid message.");
+        const_iterator i;
+        i.reader_ = this;
+        i.offset_ = checksum_;
+        return i;
+    }
+
+    /*!
+     * \brief Returns a new segmented_reader for the next message in the segments, with the same scratch buffer.
+     *
+     * If this message is invalid, searches for the beginning of the next message, like hffix::message_reader::next_message_reader().
+     *
+     * \throw std::logic_error If this message `!`is_complete().
+     */
+    segmented_reader next_message_reader() const {
+        if (!is_complete_) throw std::logic_error("Can't call next_message_reader on an incomplete message.");
+        segmented_reader r(*this, 0);
+        if (is_valid_) {
+            r.start_.advance(checksum_ + 7, iov_end_);
+        } else {
+            r.start_.advance(1, iov_end_);
+            while (r.start_.seg != iov_end_ && !starts_with(r.start_, "8=FIX", 5)) r.start_.advance(1, iov_end_);
+        }
+        r.start_.offset = 0;
+        r.init();
+        return r;
+    }
+
+private:
+    friend class segmented_reader_const_iterator;
+
+    segmented_reader(segmented_reader const& that, int) :
+        iov_end_(that.iov_end_),
+        start_(that.start_),
+        scratch_(that.scratch_),
+        scratch_end_(that.scratch_end_),
+        scratch_next_(that.scratch_) {
+    }
+
+    bool starts_with(details::segment_position q, char const* s, size_t n) const {
+        char c;
+        for (size_t k = 0; k < n; ++k) {
+            if (!q.get(c, iov_end_) || c != s[k]) return false;
+        }
+        return true;
+    }
+
+    // The framing rules are the same as for hffix::message_reader.
+    void init() {
+        is_complete_ = false;
+        is_valid_ = true;
+
+        details::segment_position q = start_;
+        char c;
+
+        // Skip the version prefix string "8=FIX.4.2" or "8=FIXT.1.1", et cetera.
+        q.advance(9, iov_end_);
+        while (true) {
+            if (!q.get(c, iov_end_)) return;
+            if (c == '\x01') break;
+            if (q.offset > 12) return invalid();
+        }
+
+        if (!q.get(c, iov_end_)) return;
+        if (c != '9') return invalid(); // next field must be tag 9 BodyLength
+        q.advance(1, iov_end_);         // skip the '='
+
+        size_t bodylength = 0;
+        details::segment_position soh;
+        while (true) {
+            soh = q;
+            if (!q.get(c, iov_end_)) return;
+            if (c == '\x01') break;
+            if (c < '0' || c > '9') return invalid();
+            bodylength = bodylength * 10 + (c - '0');
+        }
+
+        msg_type_ = q;
+        if (!starts_with(q, "35", 2)) {
+            details::segment_position r = q;
+            r.advance(3, iov_end_);
+            if (r.seg == iov_end_) return; // need 4 bytes before deciding, like message_reader
+            return invalid();
+        }
+
+        checksum_ = q.offset + bodylength;
+        details::segment_position r = soh;
+        r.advance(bodylength, iov_end_);
+        if (!r.get(c, iov_end_)) return;
+        char const before = c; // SOH before the checksum
+        r.advance(6, iov_end_);
+        if (!r.get(c, iov_end_)) return;
+        if (before != '\x01' || c != '\x01') return invalid();
+        is_complete_ = true;
+    }
+
+    void invalid() {
+        is_complete_ = true;
+        is_valid_ = false;
+    }
+
+    char* scratch_copy(char const* b, size_t n) const {
+        if (size_t(scratch_end_ - scratch_next_) < n) throw std::out_of_range("hffix segmented_reader scratch buffer full");
+        char* const s = scratch_next_;
+        std::memcpy(s, b, n);
+        scratch_next_ += n;
+        return s;
+    }
+
+    ::iovec const* iov_end_;
+    details::segment_position start_;
+    details::segment_position msg_type_;
+    size_t checksum_; // offset of the CheckSum field
+    bool is_complete_;
+    bool is_valid_;
+    char* scratch_;
+    char* scratch_end_;
+    mutable char* scratch_next_;
+};
+
+inline void segmented_reader_const_iterator::increment()
+{
+    offset_ = next_.offset;
+    if (offset_ >= reader_->checksum_) { // a corrupt data length may have taken us past the CheckSum
+        offset_ = reader_->checksum_;
+        return;
+    }
+    if (!read_tag()) {
+        // No '=' after the tag. The message is invalid, so say that this field has an empty value, like message_reader.
+        current_.value_.begin_ = current_.value_.end_ = reader_->scratch_next_;
+        return;
+    }
+    read_value();
+    if (details::is_tag_a_data_length(current_.tag_)) {
+        size_t const data_len = details::atou<size_t>(current_.value_.begin_, current_.value_.end_);
+        read_tag();
+        read_data(data_len);
+    }
+}
+
+// Read the tag and the '='. False if the tag isn't followed by '='.
+inline bool segmented_reader_const_iterator::read_tag()
+{
+    ::iovec const* const end = reader_->iov_end_;
+    current_.tag_ = 0;
+    char c;
+    while (next_.get(c, end)) {
+        if (c == '=') return true;
+        if (c == '\x01') return false;
+        current_.tag_ *= 10;
+        current_.tag_ += (c - '0');
+    }
+    return false;
+}
+
+// Find the SOH after the value, in place if the value is inside one segment.
+inline void segmented_reader_const_iterator::read_value()
+{
+    typedef details::segment_position pos;
+    ::iovec const* const end = reader_->iov_end_;
+    if (next_.seg == end) {
+        current_.value_.begin_ = current_.value_.end_ = reader_->scratch_next_;
+        return;
+    }
+    char const* soh = static_cast<char const*>(std::memchr(next_.p, '\x01', pos::end_of(next_.seg) - next_.p));
+    if (soh) {
+        current_.value_.begin_ = next_.p;
+        current_.value_.end_ = soh;
+        next_.advance(soh - next_.p + 1, end);
+        return;
+    }
+    pos after = next_;
+    after.advance(pos::end_of(next_.seg) - next_.p, end);
+    if (after.seg != end && *after.p == '\x01') { // only the SOH is in the next segment
+        current_.value_.begin_ = next_.p;
+        current_.value_.end_ = pos::end_of(next_.seg);
+        after.advance(1, end);
+        next_ = after;
+        return;
+    }
+    char const* const s = reader_->scratch_next_;
+    while (next_.seg != end) {
+        soh = static_cast<char const*>(std::memchr(next_.p, '\x01', pos::end_of(next_.seg) - next_.p));
+        size_t const n = (soh ? soh : pos::end_of(next_.seg)) - next_.p;
+        reader_->scratch_copy(next_.p, n);
+        next_.advance(soh ? n + 1 : n, end);
+        if (soh) break;
+    }
+    current_.value_.begin_ = s;
+    current_.value_.end_ = reader_->scratch_next_;
+}
+
+// Take length bytes as the value, and skip the SOH after them. If the length
+// is corrupt, take the bytes up to the CheckSum field, and stop there.
+inline void segmented_reader_const_iterator::read_data(size_t length)
+{
+    typedef details::segment_position pos;
+    ::iovec const* const end = reader_->iov_end_;
+    size_t const checksum = reader_->checksum_;
+    size_t soh = 1;
+    if (next_.offset >= checksum) {
+        length = soh = 0;
+    } else if (length >= checksum - next_.offset) {
+        length = checksum - next_.offset;
+        soh = 0;
+    }
+    if (next_.seg != end && size_t(pos::end_of(next_.seg) - next_.p) >= length) {
+        current_.value_.begin_ = next_.p;
+        current_.value_.end_ = next_.p + length;
+        next_.advance(length + soh, end);
+        return;
+    }
+    char const* const s = reader_->scratch_next_;
+    while (length && next_.seg != end) {
+        size_t const n = std::min(length, size_t(pos::end_of(next_.seg) - next_.p));
+        reader_->scratch_copy(next_.p, n);
+        next_.advance(n, end);
+        length -= n;
+    }
+    next_.advance(soh, end);
+    current_.value_.begin_ = s;
+    current_.value_.end_ = reader_->scratch_next_;
+}
+
+} // namespace hffix
+
+#endif // HFFIX_SEGMENTED_HPP
@@ -0,0 +1,669 @@
+/*******************************************************************************************
+Copyright 2011, T3 IP, LLC. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are
+permitted provided that the following conditions are met:
+
+   1. Redistributions of source code must retain the above copyright notice, this list of
+      conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright notice, this list
+      of conditions and the following disclaimer in the documentation and/or other materials
+      provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY T3 IP, LLC ``AS IS'' AND ANY EXPRESS OR IMPLIED
+WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL T3 IP, LLC OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those of the
+authors and should not be interpreted as representing official policies, either expressed
+or implied, of T3 IP, LLC.
+*******************************************************************************************/
+
+/*!
+ * \file
+ * \brief FIX session layer state machine and hierarchical timer wheel.
+ *
+ * Requires hffix.hpp.
+ */
+
+#ifndef HFFIX_SESSION_HPP
+#define HFFIX_SESSION_HPP
+
+#include "hffix.hpp"
+#include <cstddef>   // for size_t
+#include <stdint.h>  // for uint64_t
+
+namespace hffix {
+
+/*!
+ * \brief A timer which can be scheduled on a hffix::timer_wheel.
+ *
+ * The timer is an intrusive list node, so scheduling doesn't allocate. When the
+ * timer expires, the wheel calls `fire(timer, now)`. The `owner` pointer is for
+ * the `fire` function to find the object which owns the timer.
+ *
+ * A timer must be cancelled or expired before it is destroyed.
+ */
+struct wheel_timer {
+    wheel_timer* next;      //!< Next timer in the slot list, or 0 if not scheduled.
+    wheel_timer* prev;      //!< Previous timer in the slot list, or 0 if not scheduled.
+    uint64_t expiry;        //!< The tick at which the timer expires.
+    void (*fire)(wheel_timer& timer, uint64_t now); //!< Called when the timer expires.
+    void* owner;            //!< User data for fire.
+
+    /*! \brief Construct an unscheduled timer. */
+    explicit wheel_timer(void (*f)(wheel_timer&, uint64_t) = 0, void* o = 0) :
+        next(0), prev(0), expiry(0), fire(f), owner(o) {}
+
+    /*! \brief True if the timer is scheduled on a wheel. */
+    bool scheduled() const {
+        return next != 0;
+    }
+};
+
+/*!
+ * \brief Hierarchical timer wheel.
+ *
+ * Four levels of 64 slots cover 2<sup>24</sup> ticks ahead; timers further
+ * ahead wait in the top level until they come into range. What a tick means is
+ * up to the caller, for example one millisecond.
+ *
+ * Scheduling and cancelling a timer are O(1). Advancing the wheel by one tick is
+ * O(1) plus the number of timers which expire, no matter how many timers are
+ * scheduled, except that each timer is moved down a level at most three times.
+ *
+ * No memory is allocated.
+ */
+class timer_wheel {
+public:
+
+    /*! \brief Construct a wheel with the current time. */
+    explicit timer_wheel(uint64_t now = 0) : now_(now) {
+        for (int l = 0; l < levels; ++l) {
+            for (int s = 0; s < slots; ++s) {
+                heads_[l][s].next = &heads_[l][s];
+                heads_[l][s].prev = &heads_[l][s];
+            }
+        }
+    }
+
+    /*! \brief The time of the last tick processed by advance(). */
+    uint64_t now() const {
+        return now_;
+    }
+
+    /*!
+     * \brief Schedule a timer, or reschedule it if it is already scheduled.
+     *
+     * \param t The timer.
+     * \param expiry The tick at which the timer expires. If it is not after now(), the timer expires on the next tick.
+     */
+    void schedule(wheel_timer& t, uint64_t expiry) {
+        cancel(t);
+        t.expiry = expiry;
+        insert(t, now_ + 1);
+    }
+
+    /*! \brief Cancel a timer, if it is scheduled. */
+    void cancel(wheel_timer& t) {
+        if (t.next) {
+            t.prev->next = t.next;
+            t.next->prev = t.prev;
+            t.next = 0;
+            t.prev = 0;
+        }
+    }
+
+    /*!
+     * \brief Process the ticks up to and including now, and fire the timers which expire.
+     *
+     * A timer may be scheduled or cancelled from inside its own `fire` function.
+     *
+     * \return The number of timers which fired.
+     */
+    size_t advance(uint64_t now) {
+        size_t fired = 0;
+        while (now_ < now) {
+            ++now_;
+            unsigned int const index = now_ & slot_mask;
+            if (index == 0) {
+                for (int l = 1; l < levels; ++l) {
+                    unsigned int const i = (now_ >> (l * slot_bits)) & slot_mask;
+                    cascade(heads_[l][i]);
+                    if (i != 0) break;
+                }
+            }
+
+            // Detach the slot, so that timers rescheduled from inside fire go to later slots.
+            wheel_timer expired;
+            splice(heads_[0][index], expired);
+            while (expired.next != &expired) {
+                wheel_timer& t = *expired.next;
+                cancel(t);
+                if (t.expiry > now_) {
+                    insert(t, now_ + 1); // Was further ahead than the wheel covers.
+                } else {
+                    ++fired;
+                    t.fire(t, now_);
+                }
+            }
+        }
+        return fired;
+    }
+
+private:
+    timer_wheel(timer_wheel const&);
+    timer_wheel& operator=(timer_wheel const&);
+
+    enum {
+        slot_bits = 6,
+        slots = 1 << slot_bits,
+        slot_mask = slots - 1,
+        levels = 4
+    };
+
+    // Insert a timer, measuring from the first tick which is not yet
+    // processed, so that a timer due then goes into that tick's slot.
+    void insert(wheel_timer& t, uint64_t first_tick) {
+        uint64_t expiry = t.expiry < first_tick ? first_tick : t.expiry;
+        uint64_t delta = expiry - first_tick;
+        if (delta >> (levels * slot_bits)) {
+            delta = (uint64_t(1) << (levels * slot_bits)) - 1;
+            expiry = first_tick + delta;
+        }
+        int l = 0;
+        while (delta >> ((l + 1) * slot_bits)) ++l;
+        wheel_timer& head = heads_[l][(expiry >> (l * slot_bits)) & slot_mask];
+        t.next = &head;
+        t.prev = head.prev;
+        head.prev->next = &t;
+        head.prev = &t;
+    }
+
+    // Move the timers in a slot down to lower levels. The slot of the
+    // current tick is processed after the cascade, so a timer due now goes
+    // into it.
+    void cascade(wheel_timer& head) {
+        wheel_timer moving;
+        splice(head, moving);
+        while (moving.next != &moving) {
+            wheel_timer& t = *moving.next;
+            cancel(t);
+            insert(t, now_);
+        }
+    }
+
+    // Move the list at head to the empty list at to.
+    static void splice(wheel_timer& head, wheel_timer& to) {
+        if (head.next == &head) {
+            to.next = &to;
+            to.prev = &to;
+        } else {
+            to.next = head.next;
+            to.prev = head.prev;
+            to.next->prev = &to;
+            to.prev->next = &to;
+            head.next = &head;
+            head.prev = &head;
+        }
+    }
+
+    wheel_timer heads_[levels][slots];
+    uint64_t now_;
+};
+
+/*!
+ * \brief States of a hffix::session.
+ */
+namespace session_state {
+enum type {
+    disconnected, //!< Not logged on. An acceptor waits for a Logon.
+    logon_sent,   //!< An initiator has sent a Logon and waits for the reply.
+    active,       //!< Logged on.
+    logout_sent   //!< Sent a Logout and waits for the reply.
+};
+}
+
+/*!
+ * \brief Events reported by a hffix::session to its handler.
+ */
+namespace session_event {
+enum type {
+    logon,             //!< The session is logged on.
+    logout,            //!< The session is logged out.
+    gap_detected,      //!< Received a MsgSeqNum higher than expected, and sent a ResendRequest.
+    gap_filled,        //!< Received all of the messages requested by the ResendRequest.
+    sequence_reset,    //!< Received a SequenceReset-Reset.
+    reject,            //!< Received a Reject.
+    test_request_sent, //!< Nothing received for longer than the heartbeat interval, so sent a TestRequest.
+    heartbeat_timeout, //!< Nothing received after a TestRequest, so disconnected.
+    seqnum_too_low     //!< Received a MsgSeqNum lower than expected without PossDupFlag, so sent a Logout and disconnected.
+};
+}
+
+/*!
+ * \brief Configuration of a hffix::session.
+ */
+struct session_config {
+    char const* begin_string;   //!< BeginString, for example "FIX.4.4". Not copied.
+    char const* sender_comp_id; //!< Our SenderCompID. Not copied.
+    char const* target_comp_id; //!< Our TargetCompID. Not copied.
+    int heartbeat_interval;     //!< HeartBtInt in seconds, for the Logon of an initiator.
+    uint64_t ticks_per_second;  //!< Timer wheel ticks per second.
+};
+
+/*!
+ * \brief FIX session layer state machine.
+ *
+ * The session handles Logon, Heartbeat, TestRequest, gap detection with
+ * ResendRequest, SequenceReset and Logout. It does no I/O: bytes received are
+ * passed to receive(), and bytes to send are passed to the handler. Time is the
+ * time of the hffix::timer_wheel, which is shared by any number of sessions,
+ * so that the heartbeat timing of all sessions costs O(1) per tick.
+ *
+ * No memory is allocated.
+ *
+ * The `Handler` must have these methods:
+ *
+ * \code
+ * void on_send(char const* begin, char const* end);      // Bytes to send to the counterparty.
+ * void on_message(hffix::message_reader const& message); // An application message, in sequence.
+ * void on_resend_request(int begin_seq_no, int end_seq_no); // Answer a ResendRequest, for example with hffix::resend_engine.
+ * void on_event(hffix::session_event::type event);
+ * void sending_time(hffix::message_writer& writer);      // Write the SendingTime field.
+ * \endcode
+ *
+ * Sending an application message:
+ *
+ * \code
+ * hffix::message_writer w(buffer);
+ * session.push_back_header(w, "D");
+ * w.push_back_string(hffix::tag::ClOrdID, "A1");
+ * ...
+ * session.send(w);
+ * \endcode
+ *
+ * When nothing has been sent for the heartbeat interval, the session sends a
+ * Heartbeat. When nothing has been received for the heartbeat interval plus
+ * 20%, the session sends a TestRequest, and if nothing has been received for
+ * the same time again, it reports session_event::heartbeat_timeout and
+ * disconnects. The caller should then close the connection.
+ *
+ * Messages received after a gap are dropped until the gap is filled, except
+ * for Logon, TestRequest, ResendRequest, SequenceReset and Logout, which are
+ * processed. A TestRequest is answered with a Heartbeat, so that the
+ * counterparty doesn't time out while the gap is filled.
+ *
+ * \tparam Handler Type of the handler.
+ */
+template <typename Handler> class session {
+public:
+
+    /*!
+     * \brief Construct a disconnected session.
+     *
+     * \param config Configuration. Copied, but the strings are not.
+     * \param wheel Timer wheel.
+     * \param handler Handler. Not copied.
+     */
+    session(session_config const& config, timer_wheel& wheel, Handler& handler) :
+        config_(config),
+        wheel_(wheel),
+        handler_(handler),
+        state_(session_state::disconnected),
+        next_send_(1),
+        next_recv_(1),
+        resend_target_(0),
+        heartbeat_ticks_(0),
+        last_send_(0),
+        last_recv_(0),
+        test_pending_(false),
+        test_req_id_(0),
+        heartbeat_timer_(&session::fire_heartbeat, this),
+        receive_timer_(&session::fire_receive, this)
+    {
+        set_heartbeat(config.heartbeat_interval);
+    }
+
+    /*! \brief Cancels the session timers. */
+    ~session() {
+        disconnect();
+    }
+
+    /*! \name Session Control */
+    //@{
+
+    /*! \brief Send a Logon, as the initiator. */
+    void logon() {
+        message_writer w(buffer_);
+        push_back_header(w, "A");
+        w.push_back_int(tag::EncryptMethod, 0);
+        w.push_back_int(tag::HeartBtInt, config_.heartbeat_interval);
+        send(w);
+        state_ = session_state::logon_sent;
+        start_timers();
+    }
+
+    /*!
+     * \brief Send a Logout.
+     * \param text Text field for the Logout, or 0.
+     */
+    void logout(char const* text = 0) {
+        send_logout(text);
+        state_ = session_state::logout_sent;
+    }
+
+    /*! \brief Go to session_state::disconnected and cancel the session timers, for example when the connection closes. */
+    void disconnect() {
+        state_ = session_state::disconnected;
+        wheel_.cancel(heartbeat_timer_);
+        wheel_.cancel(receive_timer_);
+        resend_target_ = 0;
+        test_pending_ = false;
+    }
+
+    //@}
+
+    /*! \name Messages */
+    //@{
+
+    /*!
+     * \brief Process received bytes.
+     *
+     * \param begin Pointer to the beginning of the received bytes.
+     * \param end Pointer to past-the-end of the received bytes.
+     * \return The number of bytes consumed. Bytes of an incomplete message at the end are not consumed, and should be passed again with more bytes.
+     */
+    size_t receive(char const* begin, char const* end) {
+        if (begin == end) return 0;
+        message_reader r(begin, end);
+        while (r.is_complete()) {
+            if (r.is_valid()) { // Garbled messages are ignored.
+                process(r);
+                if (r.message_end() == end) return end - begin;
+            }
+            r = r.next_message_reader();
+        }
+        return r.message_begin() - begin;
+    }
+
+    /*!
+     * \brief Write the standard header of a message to send, with the next MsgSeqNum.
+     *
+     * Writes BeginString, BodyLength, MsgType, SenderCompID, TargetCompID, MsgSeqNum
+     * and SendingTime.
+     *
+     * \param w A message_writer for the message.
+     * \param msg_type The MsgType.
+     * \throw std::out_of_range When the remaining buffer size is too small.
+     */
+    void push_back_header(message_writer& w, char const* msg_type) {
+        w.push_back_header(config_.begin_string);
+        w.push_back_string(tag::MsgType, msg_type);
+        w.push_back_string(tag::SenderCompID, config_.sender_comp_id);
+        w.push_back_string(tag::TargetCompID, config_.target_comp_id);
+        w.push_back_int(tag::MsgSeqNum, next_send_);
+        handler_.sending_time(w);
+    }
+
+    /*!
+     * \brief Write the trailer of a message started with push_back_header() and pass the message to the handler to send.
+     * \throw std::out_of_range When the remaining buffer size is too small.
+     */
+    void send(message_writer& w) {
+        w.push_back_trailer();
+        ++next_send_;
+        last_send_ = wheel_.now();
+        handler_.on_send(w.message_begin(), w.message_end());
+    }
+
+    //@}
+
+    /*! \name Accessors */
+    //@{
+
+    /*! \brief The session state. */
+    session_state::type state() const {
+        return state_;
+    }
+
+    /*! \brief The next MsgSeqNum to send. */
+    int next_send_seqnum() const {
+        return next_send_;
+    }
+
+    /*! \brief Set the next MsgSeqNum to send, for example from a hffix::message_journal. */
+    void set_next_send_seqnum(int seqnum) {
+        next_send_ = seqnum;
+    }
+
+    /*! \brief The next MsgSeqNum expected to be received. */
+    int next_recv_seqnum() const {
+        return next_recv_;
+    }
+
+    /*! \brief Set the next MsgSeqNum expected to be received, for example from a hffix::message_journal. */
+    void set_next_recv_seqnum(int seqnum) {
+        next_recv_ = seqnum;
+    }
+
+    //@}
+
+private:
+    session(session const&);
+    session& operator=(session const&);
+
+    void set_heartbeat(int seconds) {
+        heartbeat_ticks_ = uint64_t(seconds > 0 ? seconds : 1) * config_.ticks_per_second;
+    }
+
+    // Time allowed without receiving anything before a TestRequest.
+    uint64_t receive_ticks() const {
+        return heartbeat_ticks_ + heartbeat_ticks_ / 5;
+    }
+
+    void start_timers() {
+        last_send_ = last_recv_ = wheel_.now();
+        test_pending_ = false;
+        wheel_.schedule(heartbeat_timer_, last_send_ + heartbeat_ticks_);
+        wheel_.schedule(receive_timer_, last_recv_ + receive_ticks());
+    }
+
+    // The timers are lazy: sending and receiving only record the time, and when
+    // a timer fires it reschedules itself if there was activity since.
+    static void fire_heartbeat(wheel_timer& t, uint64_t now) {
+        session& s = *static_cast<session*>(t.owner);
+        if (now >= s.last_send_ + s.heartbeat_ticks_) s.send_admin("0");
+        s.wheel_.schedule(t, s.last_send_ + s.heartbeat_ticks_);
+    }
+
+    static void fire_receive(wheel_timer& t, uint64_t now) {
+        session& s = *static_cast<session*>(t.owner);
+        uint64_t const due = s.last_recv_ + (s.test_pending_ ? 2 : 1) * s.receive_ticks();
+        if (now < due) {
+            s.wheel_.schedule(t, due);
+        } else if (!s.test_pending_) {
+            message_writer w(s.buffer_);
+            s.push_back_header(w, "1");
+            w.push_back_int(tag::TestReqID, ++s.test_req_id_);
+            s.send(w);
+            s.test_pending_ = true;
+            s.wheel_.schedule(t, s.last_recv_ + 2 * s.receive_ticks());
+            s.handler_.on_event(session_event::test_request_sent);
+        } else {
+            s.disconnect();
+            s.handler_.on_event(session_event::heartbeat_timeout);
+        }
+    }
+
+    void send_admin(char const* msg_type) {
+        message_writer w(buffer_);
+        push_back_header(w, msg_type);
+        send(w);
+    }
+
+    void send_logout(char const* text) {
+        message_writer w(buffer_);
+        push_back_header(w, "5");
+        if (text) w.push_back_string(tag::Text, text);
+        send(w);
+    }
+
+    static bool is_msg_type(field_value const& v, char c) {
+        return v.size() == 1 && *v.begin() == c;
+    }
+
+    void process(message_reader const& r) {
+        message_reader::const_iterator const type_field = r.message_type();
+        field_value const type = type_field->value();
+
+        if (state_ == session_state::disconnected && !is_msg_type(type, 'A')) return;
+
+        last_recv_ = wheel_.now();
+        test_pending_ = false;
+
+        int seqnum = 0;
+        bool poss_dup = false;
+        message_reader::const_iterator i = r.begin();
+        if (r.find_with_hint(tag::MsgSeqNum, i)) seqnum = i->value().as_int<int>();
+        i = r.begin();
+        if (r.find_with_hint(tag::PossDupFlag, i)) poss_dup = i->value() == "Y";
+
+        // SequenceReset-Reset ignores MsgSeqNum.
+        if (is_msg_type(type, '4')) {
+            bool gap_fill = false;
+            i = r.begin();
+            if (r.find_with_hint(tag::GapFillFlag, i)) gap_fill = i->value() == "Y";
+            if (!gap_fill) {
+                i = r.begin();
+                if (r.find_with_hint(tag::NewSeqNo, i)) next_recv_ = i->value().as_int<int>();
+                end_resend();
+                handler_.on_event(session_event::sequence_reset);
+                return;
+            }
+        }
+
+        if (seqnum > next_recv_) {
+            if (is_msg_type(type, 'A') || is_msg_type(type, '1') || is_msg_type(type, '2') || is_msg_type(type, '5'))
+                process_admin(r, type);
+            if (state_ != session_state::disconnected && !resend_target_) {
+                resend_target_ = seqnum;
+                message_writer w(buffer_);
+                push_back_header(w, "2");
+                w.push_back_int(tag::BeginSeqNo, next_recv_);
+                w.push_back_int(tag::EndSeqNo, 0);
+                send(w);
+                handler_.on_event(session_event::gap_detected);
+            }
+            return;
+        }
+
+        if (seqnum < next_recv_) {
+            if (poss_dup) return;
+            send_logout("MsgSeqNum too low");
+            disconnect();
+            handler_.on_event(session_event::seqnum_too_low);
+            return;
+        }
+
+        ++next_recv_;
+        if (type.size() == 1 && process_admin(r, type)) {
+            // An admin message.
+        } else {
+            handler_.on_message(r);
+        }
+        if (resend_target_ && next_recv_ > resend_target_) end_resend();
+    }
+
+    void end_resend() {
+        if (resend_target_) {
+            resend_target_ = 0;
+            handler_.on_event(session_event::gap_filled);
+        }
+    }
+
+    // Process a session-level message. Return false if it is not one.
+    bool process_admin(message_reader const& r, field_value const& type) {
+        message_reader::const_iterator i = r.begin();
+        switch (*type.begin()) {
+        case '0': // Heartbeat
+            return true;
+        case '1': // TestRequest
+            {
+                message_writer w(buffer_);
+                push_back_header(w, "0");
+                if (r.find_with_hint(tag::TestReqID, i))
+                    w.push_back_string(tag::TestReqID, i->value().begin(), i->value().end());
+                send(w);
+            }
+            return true;
+        case '2': // ResendRequest
+            {
+                int begin_seq_no = 0, end_seq_no = 0;
+                if (r.find_with_hint(tag::BeginSeqNo, i)) begin_seq_no = i->value().as_int<int>();
+                i = r.begin();
+                if (r.find_with_hint(tag::EndSeqNo, i)) end_seq_no = i->value().as_int<int>();
+                handler_.on_resend_request(begin_seq_no, end_seq_no);
+            }
+            return true;
+        case '3': // Reject
+            handler_.on_event(session_event::reject);
+            return true;
+        case '4': // SequenceReset-GapFill
+            if (r.find_with_hint(tag::NewSeqNo, i)) {
+                int const new_seqno = i->value().as_int<int>();
+                if (new_seqno > next_recv_) next_recv_ = new_seqno;
+            }
+            return true;
+        case '5': // Logout
+            if (state_ != session_state::logout_sent) send_logout(0);
+            disconnect();
+            handler_.on_event(session_event::logout);
+            return true;
+        case 'A': // Logon
+            if (state_ == session_state::disconnected) {
+                if (r.find_with_hint(tag::HeartBtInt, i)) set_heartbeat(i->value().as_int<int>());
+                message_writer w(buffer_);
+                push_back_header(w, "A");
+                w.push_back_int(tag::EncryptMethod, 0);
+                w.push_back_int(tag::HeartBtInt, int(heartbeat_ticks_ / config_.ticks_per_second));
+                send(w);
+                start_timers();
+            } else if (state_ != session_state::logon_sent) {
+                return true;
+            }
+            state_ = session_state::active;
+            handler_.on_event(session_event::logon);
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    session_config config_;
+    timer_wheel& wheel_;
+    Handler& handler_;
+    session_state::type state_;
+    int next_send_;
+    int next_recv_;
+    int resend_target_;       // MsgSeqNum which started the gap, or 0 if no ResendRequest is outstanding.
+    uint64_t heartbeat_ticks_;
+    uint64_t last_send_;
+    uint64_t last_recv_;
+    bool test_pending_;
+    int test_req_id_;
+    wheel_timer heartbeat_timer_;
+    wheel_timer receive_timer_;
+    char buffer_[512];        // For session-level messages.
+};
+
+} // namespace hffix
+
+#endif // HFFIX_SESSION_HPP
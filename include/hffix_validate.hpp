@@ -0,0 +1,678 @@
+/*******************************************************************************************
+Copyright 2011, T3 IP, LLC. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are
+permitted provided that the following conditions are met:
+
+   1. Redistributions of source code must retain the above copyright notice, this list of
+      conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright notice, this list
+      of conditions and the following disclaimer in the documentation and/or other materials
+      provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY T3 IP, LLC ``AS IS'' AND ANY EXPRESS OR IMPLIED
+WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL T3 IP, LLC OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those of the
+authors and should not be interpreted as representing official policies, either expressed
+or implied, of T3 IP, LLC.
+*******************************************************************************************/
+
+/*!
+ * \file
+ * \brief Single-pass validation of the fields of a FIX message against the FIX Repository message layouts, and of the order of the fields.
+ *
+ * Requires hffix.hpp, hffix_enums.hpp and hffix_layouts.hpp.
+ */
+
+#ifndef HFFIX_VALIDATE_HPP
+#define HFFIX_VALIDATE_HPP
+
+#include "hffix.hpp"
+#include "hffix_enums.hpp"
+#include "hffix_layouts.hpp"
+#include <algorithm> // for stable_sort
+#include <cstddef>   // for size_t
+#include <string>
+#include <vector>
+
+namespace hffix {
+
+/*!
+ * \brief The result of hffix::message_validator::validate().
+ *
+ * The `reason` and `tag` can be written into a *Reject* message as the
+ * *SessionRejectReason* and *RefTagID*.
+ *
+ * \code
+ * hffix::validation_result const v = validator.validate(reader);
+ * if (!v.valid()) {
+ *     writer.push_back_int(hffix::tag::RefSeqNum, seqnum);
+ *     if (v.tag) writer.push_back_int(hffix::tag::RefTagID, v.tag);
+ *     writer.push_back_enum(hffix::tag::SessionRejectReason, v.reason);
+ * }
+ * \endcode
+ */
+struct validation_result {
+    enums::SessionRejectReason::type reason; //!< Reason for rejecting the message, or enums::SessionRejectReason::invalid if the message is valid.
+    int tag;                                 //!< Tag of the field which caused the rejection, or 0.
+
+    //! True if the message is valid.
+    bool valid() const {
+        return reason == enums::SessionRejectReason::invalid;
+    }
+};
+
+/* @cond EXCLUDE */
+namespace details {
+
+inline bool is_digits(char const* begin, char const* end) {
+    if (begin == end) return false;
+    for (; begin < end; ++begin)
+        if (*begin < '0' || *begin > '9') return false;
+    return true;
+}
+
+// True if the field value is well-formed for the FIX data type.
+inline bool check_format(field_type::type type, char const* b, char const* e) {
+    switch (type) {
+    case field_type::Int:
+        if (b < e && *b == '-') ++b;
+        return is_digits(b, e);
+    case field_type::Length:
+    case field_type::NumInGroup:
+    case field_type::SeqNum:
+    case field_type::TagNum:
+        return is_digits(b, e);
+    case field_type::Float:
+    case field_type::Qty:
+    case field_type::Price:
+    case field_type::PriceOffset:
+    case field_type::Amt:
+    case field_type::Percentage: {
+        if (b < e && *b == '-') ++b;
+        char const* dot = std::find(b, e, '.');
+        if (dot == e) return is_digits(b, e);
+        return (dot > b || dot + 1 < e) && (dot == b || is_digits(b, dot)) && (dot + 1 == e || is_digits(dot + 1, e));
+    }
+    case field_type::Char:
+        return e - b == 1;
+    case field_type::Boolean:
+        return e - b == 1 && (*b == 'Y' || *b == 'N');
+    case field_type::Country:
+        return e - b == 2;
+    case field_type::Currency:
+        return e - b == 3;
+    case field_type::MonthYear: // YYYYMM, YYYYMMDD or YYYYMMwN
+        return e - b >= 6 && is_digits(b, b + 6);
+    case field_type::UTCDateOnly:
+    case field_type::LocalMktDate:
+        return is_digits(b, e) && e - b == 8;
+    case field_type::UTCTimeOnly:
+    case field_type::LocalMktTime: // HH:MM[:SS[.sss...]]
+        return e - b >= 5 && is_digits(b, b + 2) && b[2] == ':' && is_digits(b + 3, b + 5);
+    case field_type::UTCTimestamp: // YYYYMMDD-HH:MM[:SS[.sss...]]
+        return e - b >= 14 && is_digits(b, b + 8) && b[8] == '-'
+            && is_digits(b + 9, b + 11) && b[11] == ':' && is_digits(b + 12, b + 14);
+    default:
+        return true;
+    }
+}
+
+// True if the field value is one of the enumerated values. Values of
+// MultipleCharValue and MultipleStringValue fields are space-separated.
+inline bool check_enum(enum_dictionary_entry const* values_begin, enum_dictionary_entry const* values_end, bool multiple, char const* b, char const* e) {
+    while (true) {
+        char const* const ve = multiple ? std::find(b, e, ' ') : e;
+        int const key = enum_key(b, ve);
+        enum_dictionary_entry const* v = values_begin;
+        while (v < values_end && v->key != key) ++v;
+        if (v == values_end) return false;
+        if (ve == e) return true;
+        b = ve + 1;
+    }
+}
+
+} // namespace details
+/* @endcond */
+
+/*!
+ * \brief Validates the fields of FIX messages against the FIX Repository message layouts.
+ *
+ * In one pass over the fields of a message, checks that
+ *
+ * - every field is defined for the MsgType, or is a user-defined field,
+ * - no field appears more than once, except in different repeating group instances,
+ * - every field has a value in the format of its FIX data type,
+ * - every field with enumerated values in hffix_enums.hpp has one of the values,
+ * - every repeating group instance begins with the delimiter field of the group,
+ * - every repeating group has as many instances as its NumInGroup field says,
+ * - every required field is present, in the message and in each repeating group instance.
+ *
+ * The first problem found is returned as a hffix::validation_result with a
+ * *SessionRejectReason* and a tag. Fields of the *StandardHeader* and
+ * *StandardTrailer* are checked along with the body, but not their order,
+ * which hffix::field_order_checker checks.
+ *
+ * The layouts of hffix_layouts.hpp are flattened into a table for each
+ * MsgType and each repeating group by the constructor, which allocates. After
+ * that, validate() does not allocate. Each field costs one lookup in the hash
+ * table of its message or group instance.
+ *
+ * Fields of an optional component are treated as optional, even if they are
+ * required when the component is present.
+ *
+ * A message_validator is not thread-safe, because validate() keeps state in
+ * the validator. Use one validator per thread.
+ */
+class message_validator {
+public:
+    /*!
+     * \brief Flatten the layouts of all the message types.
+     *
+     * \param allow_user_defined If true, tags from 5000 to 39999 which are not in the FIX Repository are
+     * accepted in any message without checks. If false, they are rejected with *InvalidTagNumber*.
+     */
+    explicit message_validator(bool allow_user_defined = true) :
+        allow_user_defined_(allow_user_defined),
+        serial_(0)
+    {
+        scopes_.resize(int(component_layout_count) + int(msg_type_index::unknown));
+        compiled_.resize(component_layout_count, false);
+
+        layout const* header = 0;
+        layout const* trailer = 0;
+        for (int c = 0; c < component_layout_count; ++c) {
+            if (component_layout(c).name == std::string("StandardHeader")) header = &component_layout(c);
+            if (component_layout(c).name == std::string("StandardTrailer")) trailer = &component_layout(c);
+        }
+
+        for (int m = 0; m < msg_type_index::unknown; ++m) {
+            std::vector<entry> flat;
+            flatten(message_layout(msg_type_index::type(m)), true, flat);
+            if (header) flatten(*header, true, flat);
+            if (trailer) flatten(*trailer, true, flat);
+            define(component_layout_count + m, flat);
+        }
+        stamps_.resize(entries_.size(), 0);
+    }
+
+    /*!
+     * \brief Validate the fields of a message.
+     *
+     * \param reader A valid message.
+     * \return The first problem found, or a result with valid() true.
+     * \throw std::logic_error if the message is not valid.
+     */
+    validation_result validate(message_reader const& reader) {
+        HFFIX_INSTRUMENT_SCOPE(validation);
+
+        message_reader::const_iterator i = reader.begin();
+        msg_type_index::type const index = msg_type_to_index(i->value().begin(), i->value().end());
+        if (index == msg_type_index::unknown) return reject(enums::SessionRejectReason::InvalidMsgType, tag::MsgType);
+
+        int depth = 0;
+        frames_[0].scope = int(component_layout_count) + index;
+        frames_[0].serial = next_serial();
+        frames_[0].count_tag = 0;
+        frames_[0].required = 0;
+
+        message_reader::const_iterator const end = reader.end();
+        for (++i; i != end; ++i) {
+            int const t = i->tag();
+            if (t == tag::BeginString || t == tag::BodyLength || t == tag::MsgType || t == tag::CheckSum)
+                return reject(enums::SessionRejectReason::TagAppearsMoreThanOnce, t);
+
+            // User-defined fields may appear anywhere, even inside a
+            // repeating group instance, which they don't end.
+            if (allow_user_defined_ && t >= 5000 && t < 40000 && field_type_of(t) == field_type::Unknown) continue;
+
+            // Find the field in the innermost scope, leaving repeating groups
+            // which don't have it.
+            entry const* e;
+            while (!(e = find(frames_[depth].scope, t)) && depth > 0) {
+                validation_result const v = close(depth--);
+                if (!v.valid()) return v;
+            }
+            if (!e) {
+                if (field_type_of(t) != field_type::Unknown)
+                    return reject(enums::SessionRejectReason::TagNotDefinedForThisMessageType, t);
+                return reject(enums::SessionRejectReason::InvalidTagNumber, t);
+            }
+
+            frame& f = frames_[depth];
+            if (depth > 0) {
+                if (t == scopes_[f.scope].delimiter) { // A new repeating group instance.
+                    if (f.instances > 0) {
+                        validation_result const v = missing(f);
+                        if (!v.valid()) return v;
+                    }
+                    if (++f.instances > f.count)
+                        return reject(enums::SessionRejectReason::IncorrectNumInGroupCountForRepeatingGroup, f.count_tag);
+                    f.serial = next_serial();
+                    f.required = 0;
+                } else if (f.instances == 0) {
+                    return reject(enums::SessionRejectReason::RepeatingGroupFieldsOutOfOrder, t);
+                }
+            }
+
+            unsigned& stamp = stamps_[e - &entries_[0]];
+            if (stamp == f.serial) return reject(enums::SessionRejectReason::TagAppearsMoreThanOnce, t);
+            stamp = f.serial;
+            f.required += e->required;
+
+            char const* const vb = i->value().begin();
+            char const* const ve = i->value().end();
+            if (vb == ve) return reject(enums::SessionRejectReason::TagSpecifiedWithoutAValue, t);
+            if (!details::check_format(e->type, vb, ve))
+                return reject(enums::SessionRejectReason::IncorrectDataFormatForValue, t);
+            if (e->values_begin) {
+                bool const multiple = e->type == field_type::MultipleCharValue || e->type == field_type::MultipleStringValue;
+                if (!details::check_enum(e->values_begin, e->values_end, multiple, vb, ve))
+                    return reject(enums::SessionRejectReason::ValueIsIncorrect, t);
+            }
+
+            if (e->group >= 0) {
+                int const count = i->value().as_int<int>();
+                if (count > 0) {
+                    if (depth + 1 == max_depth) return reject(enums::SessionRejectReason::Other, t);
+                    frame& g = frames_[++depth];
+                    g.scope = e->group;
+                    g.count_tag = t;
+                    g.count = count;
+                    g.instances = 0;
+                    g.serial = 0;
+                    g.required = 0;
+                }
+            }
+        }
+
+        while (depth > 0) {
+            validation_result const v = close(depth--);
+            if (!v.valid()) return v;
+        }
+        return missing(frames_[0]);
+    }
+
+private:
+    struct entry {
+        int tag;
+        int group;     // Scope of the repeating group of a NumInGroup field, or -1.
+        bool required;
+        field_type::type type;
+        enum_dictionary_entry const* values_begin; // Enumerated values, or null.
+        enum_dictionary_entry const* values_end;
+
+        bool operator<(entry const& that) const {
+            return tag < that.tag;
+        }
+    };
+
+    // The fields of a message or of one repeating group instance, sorted by
+    // tag, and an open-addressing hash table of them.
+    struct scope {
+        scope() : begin(0), end(0), slots(0), shift(32), delimiter(0), required(0) {}
+        size_t begin;
+        size_t end;
+        size_t slots;  // First slot of the hash table, which has 1 << (32 - shift) slots.
+        int shift;
+        int delimiter; // First field of a repeating group instance, or 0.
+        int required;  // Number of required fields.
+    };
+
+    // An open message or repeating group during validate().
+    struct frame {
+        int scope;
+        int count_tag;      // NumInGroup tag of a repeating group, or 0.
+        int count;          // NumInGroup value.
+        int instances;      // Number of instances started so far.
+        unsigned serial;    // Stamp of fields seen in the current instance.
+        int required;       // Number of required fields seen in the current instance.
+    };
+
+    enum { max_depth = 16 };
+
+    // Append the fields of a layout to flat, with nested components inlined,
+    // and define the scopes of its repeating groups.
+    void flatten(layout const& l, bool required, std::vector<entry>& flat) {
+        for (layout_entry const* e = layout_begin(l); e != layout_end(l); ++e) {
+            bool const r = required && e->required;
+            if (e->component < 0) {
+                entry const f = {e->tag, -1, r, field_type::Unknown, 0, 0};
+                flat.push_back(f);
+            } else if (e->tag == 0) {
+                flatten(component_layout(e->component), r, flat);
+            } else {
+                entry const f = {e->tag, e->component, r, field_type::Unknown, 0, 0};
+                flat.push_back(f);
+                if (!compiled_[e->component]) {
+                    compiled_[e->component] = true;
+                    std::vector<entry> group;
+                    flatten(component_layout(e->component), true, group);
+                    if (!group.empty()) group.front().required = true;
+                    define(e->component, group);
+                }
+            }
+        }
+    }
+
+    void define(int s, std::vector<entry>& flat) {
+        scopes_[s].delimiter = flat.empty() ? 0 : flat.front().tag;
+        // BeginString, BodyLength, MsgType and CheckSum are checked by message_reader.
+        std::vector<entry> sorted;
+        for (size_t k = 0; k < flat.size(); ++k) {
+            int const t = flat[k].tag;
+            if (t != tag::BeginString && t != tag::BodyLength && t != tag::MsgType && t != tag::CheckSum)
+                sorted.push_back(flat[k]);
+        }
+        std::stable_sort(sorted.begin(), sorted.end());
+        scopes_[s].begin = entries_.size();
+        for (size_t k = 0; k < sorted.size(); ++k) {
+            if (k == 0 || sorted[k].tag != sorted[k - 1].tag) {
+                entry f = sorted[k];
+                f.type = field_type_of(f.tag);
+                f.values_begin = f.values_end = 0;
+                // The FIX Repository has enumerated values for some NumInGroup fields.
+                if (f.type != field_type::NumInGroup) enum_values(f.tag, f.values_begin, f.values_end);
+                entries_.push_back(f);
+                scopes_[s].required += f.required;
+            }
+        }
+        scopes_[s].end = entries_.size();
+
+        // At most half full.
+        int bits = 1;
+        while ((size_t(1) << bits) < 2 * (scopes_[s].end - scopes_[s].begin)) ++bits;
+        scopes_[s].shift = 32 - bits;
+        scopes_[s].slots = slots_.size();
+        slots_.resize(slots_.size() + (size_t(1) << bits), 0);
+        for (size_t k = scopes_[s].begin; k < scopes_[s].end; ++k) {
+            size_t h = slot(entries_[k].tag, scopes_[s].shift);
+            while (slots_[scopes_[s].slots + h]) h = (h + 1) & ((size_t(1) << bits) - 1);
+            slots_[scopes_[s].slots + h] = int(k) + 1;
+        }
+    }
+
+    static size_t slot(int t, int shift) {
+        return (unsigned(t) * 2654435761u) >> shift;
+    }
+
+    entry const* find(int s, int t) const {
+        scope const& sc = scopes_[s];
+        size_t const mask = (size_t(1) << (32 - sc.shift)) - 1;
+        for (size_t h = slot(t, sc.shift); ; h = (h + 1) & mask) {
+            int const k = slots_[sc.slots + h];
+            if (!k) return 0;
+            if (entries_[k - 1].tag == t) return &entries_[k - 1];
+        }
+    }
+
+    // The first required field of the scope not seen in the current instance.
+    validation_result missing(frame const& f) const {
+        scope const& s = scopes_[f.scope];
+        if (f.required == s.required) return reject(enums::SessionRejectReason::invalid, 0);
+        for (size_t k = s.begin; k < s.end; ++k)
+            if (entries_[k].required && stamps_[k] != f.serial)
+                return reject(enums::SessionRejectReason::RequiredTagMissing, entries_[k].tag);
+        return reject(enums::SessionRejectReason::invalid, 0);
+    }
+
+    // Leave a repeating group.
+    validation_result close(int depth) const {
+        frame const& f = frames_[depth];
+        validation_result const v = missing(f);
+        if (!v.valid()) return v;
+        if (f.instances != f.count)
+            return reject(enums::SessionRejectReason::IncorrectNumInGroupCountForRepeatingGroup, f.count_tag);
+        return v;
+    }
+
+    unsigned next_serial() {
+        if (++serial_ == 0) { // Wrapped, so forget all the stamps.
+            std::fill(stamps_.begin(), stamps_.end(), 0u);
+            serial_ = 1;
+        }
+        return serial_;
+    }
+
+    static validation_result reject(enums::SessionRejectReason::type reason, int t) {
+        validation_result const v = {reason, t};
+        return v;
+    }
+
+    message_validator(message_validator const&);
+    message_validator& operator=(message_validator const&);
+
+    bool allow_user_defined_;
+    std::vector<entry> entries_;
+    std::vector<scope> scopes_;     // Repeating groups by component index, then message types.
+    std::vector<bool> compiled_;
+    std::vector<unsigned> stamps_;  // Serial of the instance in which each entry was last seen.
+    std::vector<int> slots_;        // Hash tables of the scopes, of entry index + 1, or 0 for empty.
+    unsigned serial_;
+    frame frames_[max_depth];
+};
+
+/*!
+ * \brief Detects duplicate tags, and tags out of the header, body, trailer order, in one pass over the fields of a message.
+ *
+ * Keeps a fixed-size bitset of the tags seen in the current message, so the
+ * check costs a few bit operations per field and never allocates, no matter
+ * how many times a tag is repeated. The bits which were set are cleared again
+ * from a log of the tags, or for messages of more than 256 fields by walking
+ * the fields again, so a check() costs time in proportion to the size of the
+ * message, not to `MaxTag`.
+ *
+ * The order is
+ *
+ * 1. the fields of the *StandardHeader*,
+ * 2. the fields of the body,
+ * 3. the fields of the *StandardTrailer*.
+ *
+ * A header field after a body field, or a header or body field after a
+ * trailer field, is rejected with *TagSpecifiedOutOfRequiredOrder*.
+ *
+ * Fields may repeat inside repeating groups. Unlike hffix::message_validator,
+ * this class doesn't follow the layouts of the groups, so it takes the field
+ * after each *NumInGroup* field of hffix_layouts.hpp with a non-zero value to
+ * be the delimiter of the group. When the delimiter appears again, the fields of the previous
+ * instance are forgotten. Any other repeated tag is rejected with
+ * *TagAppearsMoreThanOnce*. So is a tag which appears in two different
+ * repeating groups, or both in and after a repeating group, which is legal in
+ * a few FIX message layouts. Use hffix::message_validator for those messages.
+ *
+ * \code
+ * hffix::field_order_checker<> order;
+ * for (; reader.is_complete(); reader = reader.next_message_reader()) {
+ *     if (reader.is_valid() && !order.check(reader).valid()) {
+ *         // Reject the message.
+ *     }
+ * }
+ * \endcode
+ *
+ * The bitsets are members, about 25KB with the default `MaxTag`, so consider
+ * keeping a field_order_checker for the life of a session rather than
+ * constructing one on the stack for each message. It is not thread-safe.
+ *
+ * \tparam MaxTag Tags from 1 to `MaxTag - 1` are checked for duplicates. The default covers the FIX
+ * Repository fields and the user-defined fields. Larger tags are checked only for order, as body fields.
+ */
+template <int MaxTag = 50000>
+class field_order_checker {
+public:
+    //! Mark the tags of the StandardHeader and StandardTrailer layouts, and the NumInGroup tags of all the layouts.
+    field_order_checker() {
+        logged_ = 0;
+        std::fill(seen_, seen_ + bytes, static_cast<unsigned char>(0));
+        std::fill(header_, header_ + bytes, static_cast<unsigned char>(0));
+        std::fill(trailer_, trailer_ + bytes, static_cast<unsigned char>(0));
+        std::fill(counts_, counts_ + bytes, static_cast<unsigned char>(0));
+        for (int c = 0; c < component_layout_count; ++c) {
+            layout const& l = component_layout(c);
+            if (l.name == std::string("StandardHeader")) mark(l, header_);
+            if (l.name == std::string("StandardTrailer")) mark(l, trailer_);
+            mark_counts(l);
+        }
+        for (int m = 0; m < msg_type_index::unknown; ++m) mark_counts(message_layout(msg_type_index::type(m)));
+    }
+
+    /*!
+     * \brief Check the order of the fields of a message.
+     *
+     * \param reader A valid message.
+     * \return The first duplicate or out-of-order field, or a result with valid() true.
+     * \throw std::logic_error if the message is not valid.
+     */
+    validation_result check(message_reader const& reader) {
+        HFFIX_INSTRUMENT_SCOPE(validation);
+
+        message_reader::const_iterator const begin = reader.begin();
+        message_reader::const_iterator const end = reader.end();
+        message_reader::const_iterator i = begin;
+        validation_result v = {enums::SessionRejectReason::invalid, 0};
+        int section = header_section;
+        int depth = 0;
+        bool group_next = false;
+
+        for (; i != end; ++i) {
+            int const t = i->tag();
+            // BeginString, BodyLength and CheckSum are outside the iteration.
+            if (t == tag::BeginString || t == tag::BodyLength || t == tag::CheckSum) {
+                v.reason = enums::SessionRejectReason::TagAppearsMoreThanOnce;
+                v.tag = t;
+                break;
+            }
+
+            int const s = section_of(t);
+            if (s < section) {
+                v.reason = enums::SessionRejectReason::TagSpecifiedOutOfRequiredOrder;
+                v.tag = t;
+                break;
+            }
+            section = s;
+
+            if (test(seen_, t)) {
+                // A new instance of an open repeating group, or a duplicate.
+                int g = depth;
+                while (g > 0 && groups_[g - 1].delimiter != t) --g;
+                if (g == 0) {
+                    v.reason = enums::SessionRejectReason::TagAppearsMoreThanOnce;
+                    v.tag = t;
+                    break;
+                }
+                forget(groups_[g - 1], i);
+                groups_[g - 1].first = i;
+                groups_[g - 1].logged = logged_;
+                depth = g;
+                group_next = false;
+            }
+            set(seen_, t);
+            if (logged_ < log_size) log_[logged_] = t;
+            ++logged_;
+
+            if (group_next) {
+                group_next = false;
+                if (depth == max_depth) { // Forget the oldest group.
+                    std::copy(groups_ + 1, groups_ + max_depth, groups_);
+                    --depth;
+                }
+                groups_[depth].delimiter = t;
+                groups_[depth].first = i;
+                groups_[depth].logged = logged_ - 1;
+                ++depth;
+            }
+
+            if (test(counts_, t)) {
+                field_value const& n = i->value();
+                group_next = n.size() && !(n.size() == 1 && *n.begin() == '0');
+            }
+        }
+
+        group const all = {0, begin, 0};
+        forget(all, i);
+        return v;
+    }
+
+private:
+    enum {
+        bytes = (MaxTag + 7) / 8,
+        max_depth = 16, // Most recently opened repeating groups which are remembered.
+        log_size = 256, // Tags of the fields seen, for clearing their bits.
+        header_section = 0,
+        body_section = 1,
+        trailer_section = 2
+    };
+
+    struct group {
+        int delimiter;
+        message_reader::const_iterator first; // First field of the current instance.
+        size_t logged;                        // Position of the first field in the log.
+    };
+
+    static bool in_range(int t) {
+        return t > 0 && t < MaxTag;
+    }
+
+    static bool test(unsigned char const* bits, int t) {
+        return in_range(t) && (bits[t >> 3] & (1 << (t & 7)));
+    }
+
+    static void set(unsigned char* bits, int t) {
+        if (in_range(t)) bits[t >> 3] |= static_cast<unsigned char>(1 << (t & 7));
+    }
+
+    static void reset(unsigned char* bits, int t) {
+        if (in_range(t)) bits[t >> 3] &= static_cast<unsigned char>(~(1 << (t & 7)));
+    }
+
+    int section_of(int t) const {
+        if (test(header_, t)) return header_section;
+        if (test(trailer_, t)) return trailer_section;
+        return body_section;
+    }
+
+    // Clear the seen bits of the fields from the first field of a group
+    // instance up to last, from the log if it has them all, or else by
+    // walking the fields again.
+    void forget(group const& g, message_reader::const_iterator const& last) {
+        if (logged_ <= log_size) {
+            for (size_t k = g.logged; k < logged_; ++k) reset(seen_, log_[k]);
+            logged_ = g.logged;
+        } else {
+            for (message_reader::const_iterator i = g.first; i != last; ++i) reset(seen_, i->tag());
+            if (g.logged == 0) logged_ = 0;
+        }
+    }
+
+    void mark_counts(layout const& l) {
+        for (layout_entry const* e = layout_begin(l); e != layout_end(l); ++e)
+            if (e->tag && e->component >= 0) set(counts_, e->tag);
+    }
+
+    // Set the bits of the fields of a layout, with nested components and repeating groups.
+    static void mark(layout const& l, unsigned char* bits) {
+        for (layout_entry const* e = layout_begin(l); e != layout_end(l); ++e) {
+            if (e->tag) set(bits, e->tag);
+            if (e->component >= 0) mark(component_layout(e->component), bits);
+        }
+    }
+
+    unsigned char seen_[bytes];   // Tags seen in the current message.
+    unsigned char header_[bytes];
+    unsigned char trailer_[bytes];
+    unsigned char counts_[bytes]; // NumInGroup tags.
+    group groups_[max_depth];
+    int log_[log_size];
+    size_t logged_; // Number of fields seen, which may be more than log_size.
+};
+
+} // namespace hffix
+#endif // HFFIX_VALIDATE_HPP
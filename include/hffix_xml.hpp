@@ -0,0 +1,221 @@
+/*******************************************************************************************
+Copyright 2011, T3 IP, LLC. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are
+permitted provided that the following conditions are met:
+
+   1. Redistributions of source code must retain the above copyright notice, this list of
+      conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright notice, this list
+      of conditions and the following disclaimer in the documentation and/or other materials
+      provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY T3 IP, LLC ``AS IS'' AND ANY EXPRESS OR IMPLIED
+WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL T3 IP, LLC OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those of the
+authors and should not be interpreted as representing official policies, either expressed
+or implied, of T3 IP, LLC.
+*******************************************************************************************/
+
+/*!
+ * \file
+ * \brief Internal XML parser for the FAST templates of hffix_fast.hpp and the SBE schemas of hffix_sbe.hpp.
+ */
+
+#ifndef HFFIX_XML_HPP
+#define HFFIX_XML_HPP
+
+#include <algorithm> // for find
+#include <cctype>    // for isspace, isalnum
+#include <cstddef>   // for size_t
+#include <cstring>   // for memcmp, strchr, strlen
+#include <stdexcept> // for exceptions
+#include <string>
+#include <utility>   // for pair
+#include <vector>
+
+namespace hffix {
+
+/* @cond EXCLUDE */
+
+namespace details {
+
+inline void throw_xml_error(char const* context, std::string const& what) {
+    throw std::invalid_argument(std::string(context) + ": " + what);
+}
+
+// The subset of XML needed for schemas and templates: elements, attributes
+// and text, without CDATA or DTDs.
+struct xml_element {
+    std::string name;
+    std::vector<std::pair<std::string, std::string> > attributes;
+    std::vector<xml_element> children;
+    std::string text; // without leading and trailing whitespace
+
+    char const* attribute(char const* key) const {
+        for (size_t i = 0; i < attributes.size(); ++i)
+            if (attributes[i].first == key) return attributes[i].second.c_str();
+        return 0;
+    }
+};
+
+class xml_parser {
+public:
+    xml_parser(char const* context, char const* begin, char const* end) : context_(context), p_(begin), end_(end) {}
+
+    void document(xml_element& root) {
+        misc();
+        if (p_ == end_ || *p_ != '<') fail("expected an element");
+        element(root);
+        misc();
+        if (p_ != end_) fail("content after the root element");
+    }
+
+private:
+    char const* context_;
+    char const* p_;
+    char const* end_;
+
+    void fail(std::string const& what) const {
+        throw_xml_error(context_, what);
+    }
+
+    bool starts(char const* s) const {
+        size_t const n = std::strlen(s);
+        return size_t(end_ - p_) >= n && !std::memcmp(p_, s, n);
+    }
+
+    void skip_past(char const* s) {
+        size_t const n = std::strlen(s);
+        for (; size_t(end_ - p_) >= n; ++p_) {
+            if (!std::memcmp(p_, s, n)) {
+                p_ += n;
+                return;
+            }
+        }
+        fail("unterminated markup");
+    }
+
+    void space() {
+        while (p_ != end_ && std::isspace(static_cast<unsigned char>(*p_))) ++p_;
+    }
+
+    // Skip whitespace, comments, processing instructions and declarations.
+    void misc() {
+        for (;;) {
+            space();
+            if (starts("<?")) skip_past("?>");
+            else if (starts("<!--")) skip_past("-->");
+            else if (starts("<!")) skip_past(">");
+            else return;
+        }
+    }
+
+    static void trim(std::string& s) {
+        size_t b = 0, e = s.size();
+        while (b < e && std::isspace(static_cast<unsigned char>(s[b]))) ++b;
+        while (e > b && std::isspace(static_cast<unsigned char>(s[e - 1]))) --e;
+        s = s.substr(b, e - b);
+    }
+
+    void expect(char c) {
+        if (p_ == end_ || *p_ != c) fail(std::string("expected ") + c);
+        ++p_;
+    }
+
+    // A name, without its namespace prefix.
+    std::string name() {
+        char const* b = p_;
+        while (p_ != end_ && (std::isalnum(static_cast<unsigned char>(*p_)) || std::strchr("_-.:", *p_))) {
+            if (*p_++ == ':') b = p_;
+        }
+        if (b == p_) fail("expected a name");
+        return std::string(b, p_);
+    }
+
+    std::string unescape(char const* b, char const* e) {
+        std::string s;
+        while (b != e) {
+            if (*b != '&') {
+                s.push_back(*b++);
+                continue;
+            }
+            char const* const semi = std::find(b, e, ';');
+            if (semi == e) fail("unterminated entity");
+            std::string const ref(b + 1, semi);
+            if (ref == "lt") s.push_back('<');
+            else if (ref == "gt") s.push_back('>');
+            else if (ref == "amp") s.push_back('&');
+            else if (ref == "quot") s.push_back('"');
+            else if (ref == "apos") s.push_back('\'');
+            else fail("unsupported entity &" + ref + ";");
+            b = semi + 1;
+        }
+        return s;
+    }
+
+    void element(xml_element& e) {
+        ++p_; // '<'
+        e.name = name();
+        for (;;) {
+            space();
+            if (p_ == end_) fail("unterminated element " + e.name);
+            if (starts("/>")) {
+                p_ += 2;
+                return;
+            }
+            if (*p_ == '>') {
+                ++p_;
+                break;
+            }
+            std::string key = name();
+            space();
+            expect('=');
+            space();
+            if (p_ == end_ || (*p_ != '"' && *p_ != '\'')) fail("expected a quoted attribute value");
+            char const quote = *p_++;
+            char const* const b = p_;
+            p_ = std::find(p_, end_, quote);
+            if (p_ == end_) fail("unterminated attribute value");
+            e.attributes.push_back(std::make_pair(key, unescape(b, p_)));
+            ++p_;
+        }
+        for (;;) {
+            char const* const text = p_;
+            p_ = std::find(p_, end_, '<');
+            if (p_ == end_) fail("unterminated element " + e.name);
+            e.text += unescape(text, p_);
+            if (starts("</")) {
+                p_ += 2;
+                if (name() != e.name) fail("mismatched end tag for " + e.name);
+                space();
+                expect('>');
+                trim(e.text);
+                return;
+            }
+            if (starts("<?") || starts("<!")) {
+                misc();
+                continue;
+            }
+            e.children.push_back(xml_element());
+            element(e.children.back());
+        }
+    }
+};
+
+} // namespace details
+
+/* @endcond */
+
+} // namespace hffix
+
+#endif // HFFIX_XML_HPP
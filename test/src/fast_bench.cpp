@@ -0,0 +1,150 @@
+/*
+ * FAST codec benchmark.
+ *
+ * Encodes the MarketDataIncrementalRefresh (35=X) messages from a recorded FIX
+ * stream into one FAST stream with hffix::fast::encoder, then decodes the FAST
+ * stream back to FIX tag-value messages with hffix::fast::decoder, checks that
+ * the decoded fields are the same as the recorded fields, and prints the
+ * sizes and the time per message of encoding and decoding.
+ *
+ * Usage: fast_bench [recorded.fix [iterations]]
+ */
+
+#include <hffix.hpp>
+#include <hffix_fast.hpp>
+
+#include <iostream>
+#include <iomanip>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include <sys/time.h>   // for gettimeofday()
+
+namespace {
+
+// The template for the market data of the recorded stream.
+char const templates_xml[] =
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<templates xmlns=\"http://www.fixprotocol.org/ns/fast/td/1.1\">\n"
+    "  <template name=\"MDIncRefresh\" id=\"1\">\n"
+    "    <string name=\"MsgType\" id=\"35\"><constant value=\"X\"/></string>\n"
+    "    <string name=\"SendingTime\" id=\"52\"><delta/></string>\n"
+    "    <string name=\"ApplVerID\" id=\"1180\"><copy/></string>\n"
+    "    <uInt32 name=\"ApplSeqNum\" id=\"1181\"><increment/></uInt32>\n"
+    "    <sequence name=\"MDEntries\">\n"
+    "      <length name=\"NoMDEntries\" id=\"268\"/>\n"
+    "      <uInt32 name=\"MDUpdateAction\" id=\"279\"><copy value=\"0\"/></uInt32>\n"
+    "      <string name=\"Symbol\" id=\"55\"><copy/></string>\n"
+    "      <string name=\"MDEntryType\" id=\"269\"><copy/></string>\n"
+    "      <string name=\"Text\" id=\"58\" presence=\"optional\"/>\n"
+    "      <decimal name=\"MDEntryPx\" id=\"270\" presence=\"optional\"><delta/></decimal>\n"
+    "      <decimal name=\"NetChgPrevDay\" id=\"451\" presence=\"optional\"><copy/></decimal>\n"
+    "      <string name=\"MDEntryTime\" id=\"273\" presence=\"optional\"><copy/></string>\n"
+    "      <uInt32 name=\"RptSeq\" id=\"83\"><copy/></uInt32>\n"
+    "    </sequence>\n"
+    "  </template>\n"
+    "</templates>\n";
+
+double now_seconds() {
+    timeval tv;
+    ::gettimeofday(&tv, 0);
+    return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+// The fields of a message after BodyLength and before CheckSum.
+std::string body_fields(hffix::message_reader const& r) {
+    return std::string(r.message_type()->value().begin() - 3, r.check_sum()->value().begin() - 3);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    char const* path = argc > 1 ? argv[1] : "test/data/fix.5.0.set.1";
+    size_t const iterations = argc > 2 ? std::strtoul(argv[2], 0, 10) : 20;
+
+    std::FILE* f = std::fopen(path, "rb");
+    if (!f) {
+        std::perror(path);
+        return 1;
+    }
+    std::vector<char> recorded;
+    char chunk[1 << 16];
+    size_t fred;
+    while ((fred = std::fread(chunk, 1, sizeof(chunk), f))) recorded.insert(recorded.end(), chunk, chunk + fred);
+    std::fclose(f);
+
+    std::vector<hffix::message_reader> messages;
+    size_t fix_size = 0;
+    if (!recorded.empty()) {
+        hffix::message_reader r(&recorded[0], &recorded[0] + recorded.size());
+        for (; r.is_complete(); r = r.next_message_reader()) {
+            if (r.is_valid() && r.message_type()->value() == hffix::msg_type::MarketDataIncrementalRefresh) {
+                messages.push_back(r);
+                fix_size += r.message_size();
+            }
+        }
+    }
+    if (messages.empty()) {
+        std::cerr << path << ": no MarketDataIncrementalRefresh messages\n";
+        return 1;
+    }
+
+    hffix::fast::templates t;
+    t.load(templates_xml);
+    hffix::fast::encoder encoder(t);
+    hffix::fast::decoder decoder(t);
+    std::vector<char> fast(fix_size);
+    std::vector<char> decoded(1 << 12);
+    char* fast_end = 0;
+    double encode_seconds = 1e9, decode_seconds = 1e9;
+
+    for (size_t k = 0; k < iterations; ++k) {
+        double const t0 = now_seconds();
+        encoder.reset();
+        char* p = &fast[0];
+        for (size_t i = 0; i < messages.size(); ++i)
+            p = encoder.encode(1, messages[i], p, &fast[0] + fast.size());
+        fast_end = p;
+
+        double const t1 = now_seconds();
+        decoder.reset();
+        size_t total = 0;
+        for (char const* q = &fast[0]; q < fast_end;) {
+            hffix::message_writer w(&decoded[0], &decoded[0] + decoded.size());
+            w.push_back_header("FIXT.1.1");
+            q = decoder.decode(q, fast_end, w);
+            w.push_back_trailer();
+            total += w.message_size();
+        }
+        double const t2 = now_seconds();
+        encode_seconds = std::min(encode_seconds, t1 - t0);
+        decode_seconds = std::min(decode_seconds, t2 - t1);
+        if (!total) return 1;
+    }
+
+    // Check the round trip.
+    decoder.reset();
+    char const* q = &fast[0];
+    for (size_t i = 0; i < messages.size(); ++i) {
+        hffix::message_writer w(&decoded[0], &decoded[0] + decoded.size());
+        w.push_back_header("FIXT.1.1");
+        q = decoder.decode(q, fast_end, w);
+        w.push_back_trailer();
+        if (body_fields(hffix::message_reader(w.message_begin(), w.message_end())) != body_fields(messages[i])) {
+            std::cerr << "message " << i << " decoded differently\n";
+            return 1;
+        }
+    }
+
+    double const n = double(messages.size());
+    std::cout << "FAST codec, " << messages.size() << " MarketDataIncrementalRefresh messages from " << path << '\n';
+    std::cout << "FIX    " << std::setw(9) << fix_size << " bytes\n";
+    std::cout << "FAST   " << std::setw(9) << fast_end - &fast[0] << " bytes\n";
+    std::cout << std::fixed << std::setprecision(0)
+        << "encode " << std::setw(9) << encode_seconds * 1e9 / n << " ns/message\n"
+        << "decode " << std::setw(9) << decode_seconds * 1e9 / n << " ns/message\n";
+    return 0;
+}
@@ -0,0 +1,213 @@
+/*
+ * Tick-to-trade latency benchmark.
+ *
+ * Replays the MarketDataIncrementalRefresh (35=X) messages from a recorded FIX
+ * stream over a socketpair to a strategy process, which reads them with
+ * hffix::message_reader and answers each one with a NewOrderSingle written by
+ * hffix::message_writer. The exchange process measures the time from before
+ * the write of each market data message until the order has been read and
+ * framed, and prints the latency distribution.
+ *
+ * The latency includes two hops through the socketpair, which is most of it.
+ * Build with -DHFFIX_INSTRUMENT to also print the latency of the hffix stages
+ * in the strategy process.
+ *
+ * Usage: tick_to_trade [recorded.fix [iterations]]
+ */
+
+#include <hffix.hpp>
+#include <hffix_instrument.hpp>
+
+#include <iostream>
+#include <iomanip>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include <unistd.h>     // for read(), write(), fork()
+#include <sys/socket.h> // for socketpair()
+#include <sys/time.h>   // for gettimeofday()
+#include <sys/wait.h>   // for waitpid()
+
+namespace {
+
+size_t const warmup = 1000;
+
+void write_all(int fd, char const* begin, char const* end) {
+    while (begin < end) {
+        ssize_t const n = ::write(fd, begin, end - begin);
+        if (n < 0) {
+            std::perror("write");
+            std::exit(1);
+        }
+        begin += n;
+    }
+}
+
+// Read from fd into buffer after the length bytes already there, until the
+// buffer holds at least one complete message. Return the new length, or 0 at
+// end of file.
+size_t read_message(int fd, char* buffer, size_t size, size_t length) {
+    while (true) {
+        if (length) {
+            hffix::message_reader r(buffer, buffer + length);
+            if (r.is_complete()) return length;
+        }
+        ssize_t const n = ::read(fd, buffer + length, size - length);
+        if (n <= 0) return 0;
+        length += n;
+    }
+}
+
+// Market data in, orders out, until the socket closes.
+void strategy(int fd) {
+    static char in[1 << 16];
+    static char out[1 << 12];
+    size_t length = 0;
+    int seqnum = 1;
+
+    while ((length = read_message(fd, in, sizeof(in), length))) {
+        hffix::message_reader r(in, in + length);
+        char* o = out;
+        for (; r.is_complete(); r = r.next_message_reader()) {
+            if (!r.is_valid()) continue;
+
+            // Take the symbol and price of the last entry with a price.
+            char const* symbol_begin = "";
+            char const* symbol_end = symbol_begin;
+            int mantissa = 0, exponent = 0;
+            for (hffix::message_reader::const_iterator i = r.begin(); i != r.end(); ++i) {
+                if (i->tag() == hffix::tag::Symbol) {
+                    symbol_begin = i->value().begin();
+                    symbol_end = i->value().end();
+                } else if (i->tag() == hffix::tag::MDEntryPx) {
+                    i->value().as_decimal(mantissa, exponent);
+                }
+            }
+
+            hffix::message_writer w(o, out + sizeof(out));
+            w.push_back_header("FIX.4.4");
+            w.push_back_string(hffix::tag::MsgType, "D");
+            w.push_back_string(hffix::tag::SenderCompID, "STRATEGY");
+            w.push_back_string(hffix::tag::TargetCompID, "EXCHANGE");
+            w.push_back_int(hffix::tag::MsgSeqNum, seqnum);
+            w.push_back_int(hffix::tag::ClOrdID, seqnum);
+            w.push_back_string(hffix::tag::Symbol, symbol_begin, symbol_end);
+            w.push_back_char(hffix::tag::Side, '1');
+            w.push_back_int(hffix::tag::OrderQty, 100);
+            w.push_back_char(hffix::tag::OrdType, mantissa ? '2' : '1');
+            if (mantissa) w.push_back_decimal(hffix::tag::Price, mantissa, exponent);
+            w.push_back_trailer();
+            o = w.message_end();
+            ++seqnum;
+        }
+        write_all(fd, out, o);
+
+        length = in + length - r.message_begin();
+        std::memmove(in, r.message_begin(), length);
+    }
+#ifdef HFFIX_INSTRUMENT
+    std::cerr << "\nhffix stages in the strategy, in counter cycles:\n";
+    hffix::instrument::print(std::cerr);
+#endif
+}
+
+double now_seconds() {
+    timeval tv;
+    ::gettimeofday(&tv, 0);
+    return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+// Counter cycles per nanosecond.
+double calibrate() {
+    double const t0 = now_seconds();
+    uint64_t const c0 = hffix::instrument::tsc();
+    while (now_seconds() - t0 < 0.2) {}
+    double const t1 = now_seconds();
+    uint64_t const c1 = hffix::instrument::tsc();
+    return double(c1 - c0) / ((t1 - t0) * 1e9);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    char const* path = argc > 1 ? argv[1] : "test/data/fix.5.0.set.1";
+    size_t const iterations = argc > 2 ? std::strtoul(argv[2], 0, 10) : 100000;
+
+    // Load the recorded stream and frame the market data messages.
+    std::FILE* f = std::fopen(path, "rb");
+    if (!f) {
+        std::perror(path);
+        return 1;
+    }
+    std::vector<char> recorded;
+    char chunk[1 << 16];
+    size_t fred;
+    while ((fred = std::fread(chunk, 1, sizeof(chunk), f))) recorded.insert(recorded.end(), chunk, chunk + fred);
+    std::fclose(f);
+
+    std::vector<std::pair<char const*, char const*> > ticks;
+    if (!recorded.empty()) {
+        hffix::message_reader r(&recorded[0], &recorded[0] + recorded.size());
+        for (; r.is_complete(); r = r.next_message_reader()) {
+            if (r.is_valid() && r.message_type()->value() == hffix::msg_type::MarketDataIncrementalRefresh)
+                ticks.push_back(std::make_pair(r.message_begin(), r.message_end()));
+        }
+    }
+    if (ticks.empty()) {
+        std::cerr << path << ": no MarketDataIncrementalRefresh messages\n";
+        return 1;
+    }
+
+    int fds[2];
+    if (::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) < 0) {
+        std::perror("socketpair");
+        return 1;
+    }
+    pid_t const pid = ::fork();
+    if (pid < 0) {
+        std::perror("fork");
+        return 1;
+    }
+    if (pid == 0) {
+        ::close(fds[0]);
+        strategy(fds[1]);
+        return 0;
+    }
+    ::close(fds[1]);
+
+    double const cycles_per_ns = calibrate();
+    hffix::instrument::latency_histogram h;
+    static char in[1 << 12];
+    size_t length = 0;
+    for (size_t i = 0; i < warmup + iterations; ++i) {
+        std::pair<char const*, char const*> const& tick = ticks[i % ticks.size()];
+        uint64_t const t0 = hffix::instrument::tsc();
+        write_all(fds[0], tick.first, tick.second);
+        length = read_message(fds[0], in, sizeof(in), length);
+        uint64_t const t1 = hffix::instrument::tsc();
+        if (!length) {
+            std::cerr << "strategy closed the socket\n";
+            return 1;
+        }
+        if (i >= warmup) h.record(t1 - t0);
+
+        hffix::message_reader r(in, in + length);
+        length = in + length - r.message_end();
+        std::memmove(in, r.message_end(), length);
+    }
+    ::close(fds[0]);
+    ::waitpid(pid, 0, 0);
+
+    std::cout << "tick-to-trade over socketpair, " << h.count() << " round trips of "
+        << ticks.size() << " recorded ticks from " << path << '\n';
+    std::cout << "counter " << std::fixed << std::setprecision(3) << cycles_per_ns << " cycles/ns\n";
+    std::cout << std::setprecision(0)
+        << "p50    " << std::setw(9) << h.value_at_percentile(50.0) / cycles_per_ns << " ns\n"
+        << "p99    " << std::setw(9) << h.value_at_percentile(99.0) / cycles_per_ns << " ns\n"
+        << "p99.9  " << std::setw(9) << h.value_at_percentile(99.9) / cycles_per_ns << " ns\n"
+        << "max    " << std::setw(9) << h.max() / cycles_per_ns << " ns\n";
+    return 0;
+}
@@ -3,6 +3,20 @@
 
 #include <hffix.hpp>
 #include <hffix_fields.hpp>
+#include <hffix_enums.hpp>
+#include <hffix_arena.hpp>
+#include <hffix_journal.hpp>
+#include <hffix_resend.hpp>
+#include <hffix_session.hpp>
+#include <hffix_instrument.hpp>
+#include <hffix_layouts.hpp>
+#include <hffix_validate.hpp>
+#include <hffix_gather.hpp>
+#include <hffix_segmented.hpp>
+#include <hffix_edit.hpp>
+#include <hffix_fast.hpp>
+#include <hffix_sbe.hpp>
+#include <hffix_reflect.hpp>
 
 #if __cplusplus >= 201703L
 using namespace std::literals::string_view_literals;
@@ -14,6 +28,9 @@ using namespace hffix;
 #include <iomanip>
 #endif
 #include <iterator>
+#include <map>
+#include <string>
+#include <vector>
 
 BOOST_AUTO_TEST_CASE(basic)
 {
@@ -288,6 +305,1816 @@ BOOST_AUTO_TEST_CASE(msg_type_string)
     BOOST_CHECK_EQUAL(msg_type::AccountSummaryReport, std::string("CQ"));
 }
 
+// test that every MsgType maps to a distinct msg_type_index
+BOOST_AUTO_TEST_CASE(msg_type_index_hash)
+{
+    std::map<std::string, std::string> messages;
+    dictionary_init_message(messages);
+    std::vector<bool> seen(msg_type_index::unknown + 1);
+    for (std::map<std::string, std::string>::const_iterator i = messages.begin(); i != messages.end(); ++i) {
+        msg_type_index::type const x = msg_type_to_index(i->first.data(), i->first.data() + i->first.size());
+        BOOST_REQUIRE(x != msg_type_index::unknown);
+        BOOST_CHECK(!seen[x]);
+        seen[x] = true;
+    }
+    BOOST_CHECK_EQUAL(messages.size(), size_t(msg_type_index::unknown));
+
+    char const d[] = "D";
+    BOOST_CHECK_EQUAL(msg_type_to_index(d, d + 1), msg_type_index::NewOrderSingle);
+    char const ae[] = "AE";
+    BOOST_CHECK_EQUAL(msg_type_to_index(ae, ae + 2), msg_type_index::TradeCaptureReport);
+    char const bad[] = "D!Z\x01" "ABC";
+    BOOST_CHECK_EQUAL(msg_type_to_index(bad, bad + 2), msg_type_index::unknown);
+    BOOST_CHECK_EQUAL(msg_type_to_index(bad + 2, bad + 4), msg_type_index::unknown);
+    BOOST_CHECK_EQUAL(msg_type_to_index(bad + 4, bad + 7), msg_type_index::unknown);
+    BOOST_CHECK_EQUAL(msg_type_to_index(bad, bad), msg_type_index::unknown);
+}
+
+namespace {
+int dispatched_new_order = 0;
+int dispatched_other = 0;
+void on_new_order(message_reader const&, int& n) { ++dispatched_new_order; ++n; }
+void on_other(message_reader const&, int& n) { ++dispatched_other; ++n; }
+
+struct dispatch_router {
+    int new_order;
+    int other;
+    dispatch_router() : new_order(0), other(0) {}
+    void operator()(msg_type_constant<msg_type_index::NewOrderSingle>, message_reader const&) { ++new_order; }
+    template <typename T> void operator()(T, message_reader const&) { ++other; }
+};
+}
+
+// test message_dispatcher and dispatch_message routing by MsgType
+BOOST_AUTO_TEST_CASE(msg_type_dispatch)
+{
+    char buffer[256] = {};
+    char* next = buffer;
+    char const* types[] = { msg_type::NewOrderSingle, msg_type::Heartbeat, msg_type::NewOrderSingle, "ZZ" };
+    for (size_t t = 0; t < 4; ++t) {
+        message_writer w(next, buffer + sizeof(buffer));
+        w.push_back_header("FIX.4.4");
+        w.push_back_string(tag::MsgType, types[t]);
+        w.push_back_trailer();
+        next = w.message_end();
+    }
+
+    message_dispatcher<int> dispatcher(on_other);
+    dispatcher.set(msg_type::NewOrderSingle, on_new_order);
+    dispatch_router router;
+    int n = 0;
+    for (message_reader r(buffer, next); r.is_complete(); r = r.next_message_reader()) {
+        BOOST_REQUIRE(r.is_valid());
+        dispatcher(r, n);
+        dispatch_message(r, router);
+    }
+    BOOST_CHECK_EQUAL(n, 4);
+    BOOST_CHECK_EQUAL(dispatched_new_order, 2);
+    BOOST_CHECK_EQUAL(dispatched_other, 2);
+    BOOST_CHECK_EQUAL(router.new_order, 2);
+    BOOST_CHECK_EQUAL(router.other, 2);
+}
+
+// test that enumerated values decode from and encode to field values
+BOOST_AUTO_TEST_CASE(enums_decode)
+{
+    for (size_t i = 0; i < sizeof(enums::OrdStatus::values) / sizeof(enums::OrdStatus::values[0]); ++i) {
+        char const* v = enums::OrdStatus::values[i].value;
+        BOOST_CHECK_EQUAL(enums::OrdStatus::decode(v, v + std::strlen(v)), enums::OrdStatus::values[i].key);
+    }
+
+    char const filled[] = "2";
+    BOOST_CHECK_EQUAL(enums::OrdStatus::decode(filled, filled + 1), enums::OrdStatus::Filled);
+    BOOST_CHECK_EQUAL(enums::OrdStatus::decode(filled, filled), enums::OrdStatus::invalid);
+    char const bogus[] = "Z";
+    BOOST_CHECK_EQUAL(enums::OrdStatus::decode(bogus, bogus + 1), enums::OrdStatus::invalid);
+    char const orders[] = "BZ";
+    BOOST_CHECK_EQUAL(enums::MsgType::decode(orders, orders + 2), enums::MsgType::OrderMassActionReport);
+
+    char buffer[256] = {};
+    message_writer w(buffer);
+    w.push_back_header("FIX.4.4");
+    w.push_back_enum(tag::MsgType, enums::MsgType::ExecutionReport);
+    w.push_back_enum(tag::OrdStatus, enums::OrdStatus::PartiallyFilled);
+    w.push_back_enum(tag::MsgType, enums::MsgType::OrderMassActionReport);
+    w.push_back_trailer();
+
+    message_reader r(w);
+    BOOST_REQUIRE(r.is_valid());
+    BOOST_CHECK_EQUAL(r.message_type()->value(), "8");
+    message_reader::const_iterator i = r.begin();
+    BOOST_REQUIRE(r.find_with_hint(tag::OrdStatus, i));
+    BOOST_CHECK_EQUAL(i->value(), "1");
+    BOOST_CHECK_EQUAL(enums::OrdStatus::decode(i->value().begin(), i->value().end()), enums::OrdStatus::PartiallyFilled);
+    ++i;
+    BOOST_CHECK_EQUAL(i->value(), "BZ");
+
+    char small[24] = {};
+    message_writer ws(small);
+    ws.push_back_header("FIX.4.4");
+    BOOST_CHECK_THROW(ws.push_back_enum(tag::MsgType, enums::MsgType::OrderMassActionReport), std::out_of_range);
+
+    // The invalid enumerator has no field value.
+    message_writer wi(buffer);
+    wi.push_back_header("FIX.4.4");
+    BOOST_CHECK_THROW(wi.push_back_enum(tag::OrdStatus, enums::OrdStatus::invalid), std::logic_error);
+    char const high[] = "\xff\xff\xff\xff";
+    BOOST_CHECK_EQUAL(enums::MsgType::decode(high, high + 4), enums::MsgType::invalid);
+}
+
+// test that arena snapshots outlive the I/O buffer and blocks are recycled
+BOOST_AUTO_TEST_CASE(arena_snapshot)
+{
+    static char storage[4 * 256 + 15];
+    message_arena arena(storage, 256);
+    BOOST_CHECK_EQUAL(arena.block_size(), 256u);
+    BOOST_CHECK_EQUAL(arena.capacity(), 4u);
+
+    char buffer[256] = {};
+    message_writer w(buffer);
+    w.push_back_header("FIX.4.4");
+    w.push_back_string(tag::MsgType, "D");
+    w.push_back_string(tag::ClOrdID, "A1");
+    w.push_back_data(tag::RawDataLength, tag::RawData, "x\x01y", "x\x01y" + 3);
+    w.push_back_int(tag::OrderQty, 100);
+    w.push_back_trailer();
+    std::string const original(w.message_begin(), w.message_end());
+
+    message_reader r(w);
+    message_snapshot* plain = arena.snapshot(r);
+    message_snapshot* indexed = arena.snapshot(r, true);
+    BOOST_REQUIRE(plain && indexed);
+    BOOST_CHECK_EQUAL(arena.available(), 2u);
+    std::memset(buffer, 0, sizeof(buffer)); // The snapshots don't depend on the I/O buffer.
+
+    BOOST_CHECK(!plain->indexed());
+    BOOST_CHECK_EQUAL(std::string(plain->message_begin(), plain->message_end()), original);
+    BOOST_CHECK(plain->reader().is_valid());
+
+    BOOST_CHECK(indexed->indexed());
+    BOOST_CHECK_EQUAL(indexed->field_count(), 4u); // 35, 11, 96, 38. The data length field is not an iterator field.
+    size_t i = 0;
+    BOOST_REQUIRE(indexed->find_with_hint(tag::OrderQty, i));
+    BOOST_CHECK_EQUAL(indexed->value_at(i).as_int<int>(), 100);
+    BOOST_REQUIRE(indexed->find_with_hint(tag::ClOrdID, i));
+    BOOST_CHECK_EQUAL(indexed->value_at(i), "A1");
+    BOOST_REQUIRE(indexed->find_with_hint(tag::RawData, i));
+    BOOST_CHECK_EQUAL(indexed->value_at(i).size(), 3u);
+    BOOST_CHECK(!indexed->find_with_hint(tag::Price, i));
+
+    // Exhaust the arena, then recycle.
+    message_reader r2(original.data(), original.data() + original.size());
+    message_snapshot* a = arena.snapshot(r2);
+    message_snapshot* b = arena.snapshot(r2);
+    BOOST_CHECK(a && b);
+    BOOST_CHECK(!arena.snapshot(r2));
+    arena.release(b);
+    BOOST_CHECK_EQUAL(arena.snapshot(r2), b);
+    arena.release(a);
+    arena.release(b);
+    arena.release(plain);
+    arena.release(indexed);
+    BOOST_CHECK_EQUAL(arena.available(), 4u);
+
+    // A message too big for a block.
+    static char small_storage[128];
+    message_arena small_arena(small_storage, 64);
+    BOOST_CHECK_THROW(small_arena.snapshot(r2), std::out_of_range);
+}
+
+// test that the journal indexes, spans and persists across reopening
+BOOST_AUTO_TEST_CASE(journal_resend_range)
+{
+    char path[] = "/tmp/hffix_unit_journal_XXXXXX";
+    int fd = ::mkstemp(path);
+    BOOST_REQUIRE(fd >= 0);
+    ::close(fd);
+    ::unlink(path);
+    std::string const prefix(path);
+
+    char buffer[256];
+    std::vector<std::string> sent;
+    {
+        message_journal journal(prefix, 4096, 16, message_journal::sync_every, 2);
+        BOOST_CHECK_EQUAL(journal.next_send_seqnum(), 1);
+        BOOST_CHECK_EQUAL(journal.next_recv_seqnum(), 1);
+        for (int seqnum = 1; seqnum <= 5; ++seqnum) {
+            if (seqnum == 3) continue; // A gap in the sequence numbers.
+            message_writer w(buffer);
+            w.push_back_header("FIX.4.4");
+            w.push_back_string(tag::MsgType, "D");
+            w.push_back_int(tag::MsgSeqNum, seqnum);
+            w.push_back_trailer();
+            journal.append(seqnum, w.message_begin(), w.message_end());
+            sent.push_back(std::string(w.message_begin(), w.message_end()));
+        }
+        BOOST_CHECK_THROW(journal.append(4, buffer, buffer + 1), std::logic_error);
+        journal.set_next_recv_seqnum(42);
+    }
+
+    message_journal journal(prefix, 0, 0);
+    BOOST_CHECK_EQUAL(journal.next_send_seqnum(), 6);
+    BOOST_CHECK_EQUAL(journal.next_recv_seqnum(), 42);
+
+    char const* begin;
+    char const* end;
+    BOOST_REQUIRE(journal.find(4, begin, end));
+    BOOST_CHECK_EQUAL(std::string(begin, end), sent[2]);
+    BOOST_CHECK(!journal.find(3, begin, end));
+    BOOST_CHECK(!journal.find(6, begin, end));
+
+    BOOST_REQUIRE(journal.range(2, 0, begin, end));
+    BOOST_CHECK_EQUAL(std::string(begin, end), sent[1] + sent[2] + sent[3]);
+    BOOST_REQUIRE(journal.range(1, 3, begin, end));
+    BOOST_CHECK_EQUAL(std::string(begin, end), sent[0] + sent[1]);
+    BOOST_CHECK(!journal.range(3, 3, begin, end));
+    BOOST_CHECK(!journal.range(7, 0, begin, end));
+
+    int count = 0;
+    journal.range(1, 0, begin, end);
+    for (message_reader r(begin, end); r.is_complete(); r = r.next_message_reader()) ++count;
+    BOOST_CHECK_EQUAL(count, 4);
+
+    // The index has room for 16 sequence numbers.
+    BOOST_CHECK_THROW(journal.append(17, buffer, buffer + 1), std::out_of_range);
+    BOOST_CHECK_THROW(journal.append(-1, buffer, buffer + 1), std::logic_error);
+    BOOST_CHECK_THROW(journal.append(0, buffer, buffer + 1), std::logic_error);
+
+    // An index file which is too short for its entries, or for its 64 byte header.
+    BOOST_REQUIRE_EQUAL(::truncate((prefix + ".index").c_str(), 64 + 2 * 16), 0);
+    BOOST_CHECK_THROW(message_journal(prefix, 0, 0), std::runtime_error);
+    BOOST_REQUIRE_EQUAL(::truncate((prefix + ".index").c_str(), 10), 0);
+    BOOST_CHECK_THROW(message_journal(prefix, 0, 0), std::runtime_error);
+
+    ::unlink((prefix + ".data").c_str());
+    ::unlink((prefix + ".index").c_str());
+}
+
+// test that the resend engine rewrites application messages and gap fills session messages
+struct resend_sink {
+    std::string batches;
+    int calls;
+    void operator()(char const* begin, char const* end) {
+        batches.append(begin, end);
+        ++calls;
+    }
+};
+
+BOOST_AUTO_TEST_CASE(resend_gap_fill)
+{
+    // Sent: 1 Logon, 2 Heartbeat, 3 NewOrderSingle, 4 Heartbeat, (5 missing), 6 NewOrderSingle, 7 Heartbeat.
+    char const* const types[] = { "A", "0", "D", "0", 0, "D", "0" };
+    std::string sent;
+    char buffer[256];
+    for (int seqnum = 1; seqnum <= 7; ++seqnum) {
+        if (!types[seqnum - 1]) continue;
+        message_writer w(buffer);
+        w.push_back_header("FIX.4.4");
+        w.push_back_string(tag::MsgType, types[seqnum - 1]);
+        w.push_back_string(tag::SenderCompID, "S");
+        w.push_back_string(tag::TargetCompID, "T");
+        w.push_back_int(tag::MsgSeqNum, seqnum);
+        w.push_back_string(tag::SendingTime, "20240219-09:30:00");
+        w.push_back_string(tag::ClOrdID, "A1");
+        w.push_back_data(tag::RawDataLength, tag::RawData, "x\x01y", "x\x01y" + 3);
+        w.push_back_trailer();
+        sent.append(w.message_begin(), w.message_end());
+    }
+
+    resend_sink sink;
+    sink.calls = 0;
+    char batch[512];
+    resend_engine<resend_sink> engine("FIX.4.4", "S", "T", batch, sizeof(batch), sink);
+    char const now[] = "20240219-10:00:00";
+    BOOST_CHECK_EQUAL(engine.resend(sent.data(), sent.data() + sent.size(), 1, 0, now, now + 17), 5u);
+    BOOST_CHECK(sink.calls >= 2); // Doesn't fit in one batch.
+
+    // Expect GapFill 1->3, 3, GapFill 4->6, 6, GapFill 7->8.
+    int const seqnums[] = { 1, 3, 4, 6, 7 };
+    int const new_seqnos[] = { 3, 0, 6, 0, 8 };
+    int n = 0;
+    char const* b = sink.batches.data();
+    char const* e = b + sink.batches.size();
+    for (message_reader r(b, e); r.is_complete(); r = r.next_message_reader(), ++n) {
+        BOOST_REQUIRE(r.is_valid());
+        BOOST_REQUIRE(n < 5);
+        BOOST_CHECK_EQUAL(r.calculate_check_sum(), r.check_sum()->value().as_int<int>());
+        message_reader::const_iterator i = r.begin();
+        BOOST_REQUIRE(r.find_with_hint(tag::MsgSeqNum, i));
+        BOOST_CHECK_EQUAL(i->value().as_int<int>(), seqnums[n]);
+        i = r.begin();
+        BOOST_REQUIRE(r.find_with_hint(tag::PossDupFlag, i));
+        BOOST_CHECK_EQUAL(i->value(), "Y");
+        i = r.begin();
+        BOOST_REQUIRE(r.find_with_hint(tag::SendingTime, i));
+        BOOST_CHECK_EQUAL(i->value(), now);
+        i = r.begin();
+        if (new_seqnos[n]) {
+            BOOST_CHECK_EQUAL(r.message_type()->value(), "4");
+            BOOST_REQUIRE(r.find_with_hint(tag::NewSeqNo, i));
+            BOOST_CHECK_EQUAL(i->value().as_int<int>(), new_seqnos[n]);
+        } else {
+            BOOST_CHECK_EQUAL(r.message_type()->value(), "D");
+            BOOST_REQUIRE(r.find_with_hint(tag::OrigSendingTime, i));
+            BOOST_CHECK_EQUAL(i->value(), "20240219-09:30:00");
+            i = r.begin();
+            BOOST_REQUIRE(r.find_with_hint(tag::RawData, i));
+            BOOST_CHECK_EQUAL(i->value().size(), 3u);
+            int sending_times = 0;
+            for (i = r.begin(); i != r.end(); ++i) sending_times += i->tag() == tag::SendingTime;
+            BOOST_CHECK_EQUAL(sending_times, 1);
+        }
+    }
+    BOOST_CHECK_EQUAL(n, 5);
+
+    // A bounded range.
+    sink.batches.clear();
+    BOOST_CHECK_EQUAL(engine.resend(sent.data(), sent.data() + sent.size(), 2, 2, now, now + 17), 1u);
+    message_reader r(sink.batches.data(), sink.batches.data() + sink.batches.size());
+    message_reader::const_iterator i = r.begin();
+    BOOST_REQUIRE(r.find_with_hint(tag::NewSeqNo, i));
+    BOOST_CHECK_EQUAL(i->value().as_int<int>(), 3);
+
+    // Many header fields to rewrite.
+    message_writer w(buffer);
+    w.push_back_header("FIX.4.4");
+    w.push_back_string(tag::MsgType, "D");
+    w.push_back_int(tag::MsgSeqNum, 1);
+    for (int k = 0; k < 10; ++k) w.push_back_char(tag::PossDupFlag, 'N');
+    w.push_back_string(tag::SendingTime, "20240219-09:30:00");
+    w.push_back_string(tag::ClOrdID, "A1");
+    w.push_back_data(tag::RawDataLength, tag::RawData, "x\x01y", "x\x01y" + 3);
+    w.push_back_trailer();
+    sink.batches.clear();
+    BOOST_CHECK_EQUAL(engine.resend(w.message_begin(), w.message_end(), 1, 1, now, now + 17), 1u);
+    message_reader dup(sink.batches.data(), sink.batches.data() + sink.batches.size());
+    BOOST_REQUIRE(dup.is_valid());
+    BOOST_CHECK_EQUAL(dup.calculate_check_sum(), dup.check_sum()->value().as_int<int>());
+    int poss_dups = 0;
+    for (i = dup.begin(); i != dup.end(); ++i) {
+        if (i->tag() == tag::PossDupFlag) {
+            ++poss_dups;
+            BOOST_CHECK_EQUAL(i->value(), "Y");
+        }
+    }
+    BOOST_CHECK_EQUAL(poss_dups, 1);
+    i = dup.begin();
+    BOOST_REQUIRE(dup.find_with_hint(tag::OrigSendingTime, i));
+    BOOST_CHECK_EQUAL(i->value(), "20240219-09:30:00");
+    i = dup.begin();
+    BOOST_REQUIRE(dup.find_with_hint(tag::RawData, i));
+    BOOST_CHECK_EQUAL(i->value().size(), 3u);
+
+    // Long CompIDs, with the GapFills at every offset in a partly full batch.
+    char big_batch[512];
+    for (size_t size = 240; size <= sizeof(big_batch); ++size) {
+        resend_engine<resend_sink> long_ids(
+            "FIX.4.4", "SENDER_COMP_ID_SENDER_COMP_ID_SENDER", "TARGET_COMP_ID_TARGET_COMP_ID_TARGET", big_batch, size, sink);
+        BOOST_CHECK_EQUAL(long_ids.resend(sent.data(), sent.data() + sent.size(), 1, 0, now, now + 17), 5u);
+    }
+}
+
+// test that timers fire exactly at their expiry at every level of the wheel
+static void record_fire(wheel_timer& t, uint64_t now) {
+    *static_cast<uint64_t*>(t.owner) = now;
+}
+
+BOOST_AUTO_TEST_CASE(timer_wheel_expiry)
+{
+    timer_wheel wheel(1000);
+    uint64_t const expiries[] = { 0, 1001, 1063, 1064, 1065, 5000, 263143, 1000 + (1 << 24) + 5 };
+    size_t const n = sizeof(expiries) / sizeof(expiries[0]);
+    uint64_t fired[n];
+    std::vector<wheel_timer> timers(n);
+    for (size_t i = 0; i < n; ++i) {
+        fired[i] = 0;
+        timers[i].fire = &record_fire;
+        timers[i].owner = &fired[i];
+        wheel.schedule(timers[i], expiries[i]);
+    }
+    wheel_timer cancelled(&record_fire, &fired[0]);
+    wheel.schedule(cancelled, 2000);
+    wheel.cancel(cancelled);
+    BOOST_CHECK(!cancelled.scheduled());
+
+    BOOST_CHECK_EQUAL(wheel.advance(1001), 2u);
+    BOOST_CHECK_EQUAL(fired[0], 1001u); // Expiry in the past fires on the next tick.
+    BOOST_CHECK_EQUAL(fired[1], 1001u);
+    wheel.advance(300000);
+    wheel.advance(1000 + (1 << 24) + 10);
+    for (size_t i = 1; i < n; ++i) BOOST_CHECK_EQUAL(fired[i], expiries[i]);
+    for (size_t i = 0; i < n; ++i) BOOST_CHECK(!timers[i].scheduled());
+}
+
+// test that timers fire on their expiry tick when they cascade across level boundaries
+BOOST_AUTO_TEST_CASE(timer_wheel_cascade)
+{
+    uint64_t const expiries[] = {
+        63, 64, 65, 127, 128, 129, 4095, 4096, 4097, 8192, 8256,
+        262143, 262144, 262145, 266240, uint64_t(1) << 24, (uint64_t(1) << 24) + 1
+    };
+    size_t const n = sizeof(expiries) / sizeof(expiries[0]);
+    for (int step = 0; step < 2; ++step) {
+        timer_wheel wheel(0);
+        uint64_t fired[n];
+        std::vector<wheel_timer> timers(n);
+        for (size_t i = 0; i < n; ++i) {
+            fired[i] = 0;
+            timers[i].fire = &record_fire;
+            timers[i].owner = &fired[i];
+            wheel.schedule(timers[i], expiries[i]);
+        }
+        uint64_t const end = expiries[n - 1] + 1;
+        if (step) {
+            for (uint64_t now = 1; now <= end; ++now) wheel.advance(now); // One tick at a time.
+        } else {
+            wheel.advance(end);
+        }
+        for (size_t i = 0; i < n; ++i) BOOST_CHECK_EQUAL(fired[i], expiries[i]);
+    }
+}
+
+// test the session state machine with two sessions connected back to back
+struct session_pipe {
+    std::string sent;
+    std::vector<session_event::type> events;
+    std::vector<std::string> messages;
+    int resend_begin, resend_end;
+    session_pipe() : resend_begin(0), resend_end(0) {}
+    void on_send(char const* begin, char const* end) { sent.append(begin, end); }
+    void on_message(message_reader const& r) { messages.push_back(std::string(r.message_begin(), r.message_end())); }
+    void on_resend_request(int b, int e) { resend_begin = b; resend_end = e; }
+    void on_event(session_event::type e) { events.push_back(e); }
+    void sending_time(message_writer& w) { w.push_back_string(tag::SendingTime, "20240219-09:30:00"); }
+};
+
+static std::string session_msg_types(std::string const& bytes) {
+    std::string types;
+    if (bytes.empty()) return types;
+    for (message_reader r(bytes.data(), bytes.data() + bytes.size()); r.is_complete(); r = r.next_message_reader()) {
+        message_reader::const_iterator t = r.message_type();
+        types.append(t->value().begin(), t->value().end());
+    }
+    return types;
+}
+
+static void session_deliver(session_pipe& from, session<session_pipe>& to) {
+    std::string bytes;
+    bytes.swap(from.sent);
+    BOOST_CHECK_EQUAL(to.receive(bytes.data(), bytes.data() + bytes.size()), bytes.size());
+}
+
+BOOST_AUTO_TEST_CASE(session_state_machine)
+{
+    timer_wheel wheel(0);
+    session_config ci = { "FIX.4.4", "I", "A", 1, 10 }; // 1 second heartbeats, 10 ticks per second.
+    session_config ca = { "FIX.4.4", "A", "I", 30, 10 };
+    session_pipe pi, pa;
+    session<session_pipe> initiator(ci, wheel, pi);
+    session<session_pipe> acceptor(ca, wheel, pa);
+
+    // Logon.
+    initiator.logon();
+    BOOST_CHECK_EQUAL(initiator.state(), session_state::logon_sent);
+    session_deliver(pi, acceptor);
+    BOOST_CHECK_EQUAL(acceptor.state(), session_state::active);
+    session_deliver(pa, initiator);
+    BOOST_CHECK_EQUAL(initiator.state(), session_state::active);
+    BOOST_REQUIRE_EQUAL(pi.events.size(), 1u);
+    BOOST_CHECK_EQUAL(pi.events[0], session_event::logon);
+
+    // Heartbeats after 1 second without sending. Both use the initiator's HeartBtInt.
+    wheel.advance(10);
+    BOOST_CHECK_EQUAL(session_msg_types(pi.sent), "0");
+    BOOST_CHECK_EQUAL(session_msg_types(pa.sent), "0");
+    session_deliver(pi, acceptor);
+    session_deliver(pa, initiator);
+
+    // An application message.
+    char buffer[256];
+    message_writer w(buffer);
+    initiator.push_back_header(w, "D");
+    w.push_back_string(tag::ClOrdID, "A1");
+    initiator.send(w);
+    session_deliver(pi, acceptor);
+    BOOST_REQUIRE_EQUAL(pa.messages.size(), 1u);
+    BOOST_CHECK_EQUAL(acceptor.next_recv_seqnum(), 4);
+
+    // A gap: the acceptor misses seqnum 4.
+    message_writer lost(buffer);
+    initiator.push_back_header(lost, "D");
+    initiator.send(lost);
+    pi.sent.clear();
+    message_writer w2(buffer);
+    initiator.push_back_header(w2, "D");
+    initiator.send(w2);
+    session_deliver(pi, acceptor);
+    BOOST_CHECK_EQUAL(pa.messages.size(), 1u); // Dropped until the gap is filled.
+    BOOST_CHECK_EQUAL(pa.events.back(), session_event::gap_detected);
+    BOOST_CHECK_EQUAL(session_msg_types(pa.sent), "2");
+    session_deliver(pa, initiator);
+    BOOST_CHECK_EQUAL(pi.resend_begin, 4);
+    BOOST_CHECK_EQUAL(pi.resend_end, 0);
+
+    // A TestRequest during the gap is answered.
+    message_writer tr(buffer);
+    initiator.push_back_header(tr, "1");
+    tr.push_back_string(tag::TestReqID, "T1");
+    initiator.send(tr);
+    session_deliver(pi, acceptor);
+    BOOST_CHECK_EQUAL(session_msg_types(pa.sent), "0");
+    BOOST_CHECK(pa.sent.find("\x01" "112=T1\x01") != std::string::npos);
+    BOOST_CHECK_EQUAL(acceptor.next_recv_seqnum(), 4);
+
+    // Fill the gap, including the dropped messages, with a SequenceReset-GapFill.
+    message_writer gf(buffer);
+    gf.push_back_header("FIX.4.4");
+    gf.push_back_string(tag::MsgType, "4");
+    gf.push_back_int(tag::MsgSeqNum, 4);
+    gf.push_back_char(tag::PossDupFlag, 'Y');
+    gf.push_back_char(tag::GapFillFlag, 'Y');
+    gf.push_back_int(tag::NewSeqNo, 7);
+    gf.push_back_trailer();
+    acceptor.receive(gf.message_begin(), gf.message_end());
+    BOOST_CHECK_EQUAL(pa.events.back(), session_event::gap_filled);
+    BOOST_CHECK_EQUAL(acceptor.next_recv_seqnum(), 7);
+
+    // A partial message is not consumed.
+    message_writer w3(buffer);
+    initiator.push_back_header(w3, "D");
+    initiator.send(w3);
+    BOOST_CHECK_EQUAL(acceptor.receive(pi.sent.data(), pi.sent.data() + 10), 0u);
+    session_deliver(pi, acceptor);
+    BOOST_CHECK_EQUAL(pa.messages.size(), 2u);
+
+    // Silence: TestRequest after 1.2 seconds, then timeout.
+    session_deliver(pa, initiator);
+    wheel.advance(wheel.now() + 12);
+    BOOST_CHECK_EQUAL(pi.events.back(), session_event::test_request_sent);
+    wheel.advance(wheel.now() + 12);
+    BOOST_CHECK_EQUAL(pi.events.back(), session_event::heartbeat_timeout);
+    BOOST_CHECK_EQUAL(initiator.state(), session_state::disconnected);
+
+    // Logout. Skip the messages which were not delivered during the silence.
+    initiator.logon();
+    pi.sent.clear();
+    acceptor.logout("bye");
+    BOOST_CHECK_EQUAL(acceptor.state(), session_state::logout_sent);
+    pa.sent = pa.sent.substr(pa.sent.rfind("8=FIX"));
+    initiator.set_next_recv_seqnum(acceptor.next_send_seqnum() - 1);
+    session_deliver(pa, initiator);
+    BOOST_CHECK_EQUAL(session_msg_types(pi.sent), "5");
+    BOOST_CHECK_EQUAL(initiator.state(), session_state::disconnected);
+    acceptor.set_next_recv_seqnum(initiator.next_send_seqnum() - 1);
+    session_deliver(pi, acceptor);
+    BOOST_CHECK_EQUAL(acceptor.state(), session_state::disconnected);
+    BOOST_CHECK_EQUAL(pa.events.back(), session_event::logout);
+}
+
+// test the latency histogram percentiles and relative error
+BOOST_AUTO_TEST_CASE(instrument_histogram)
+{
+    instrument::latency_histogram h;
+    BOOST_CHECK_EQUAL(h.value_at_percentile(50.0), 0u);
+    for (uint64_t v = 1; v <= 10000; ++v) h.record(v);
+    BOOST_CHECK_EQUAL(h.count(), 10000u);
+    BOOST_CHECK_EQUAL(h.min(), 1u);
+    BOOST_CHECK_EQUAL(h.max(), 10000u);
+    BOOST_CHECK_CLOSE(h.mean(), 5000.5, 0.001);
+    BOOST_CHECK_EQUAL(h.value_at_percentile(0.5), 50u); // Exact below 128.
+    BOOST_CHECK_CLOSE(double(h.value_at_percentile(50.0)), 5000.0, 1.6);
+    BOOST_CHECK_CLOSE(double(h.value_at_percentile(99.0)), 9900.0, 1.6);
+    BOOST_CHECK_CLOSE(double(h.value_at_percentile(99.9)), 9990.0, 1.6);
+    BOOST_CHECK_EQUAL(h.value_at_percentile(100.0), 10000u);
+
+    h.record(~uint64_t(0)); // Counted in the top bucket.
+    BOOST_CHECK_EQUAL(h.value_at_percentile(100.0), ~uint64_t(0));
+    h.reset();
+    BOOST_CHECK_EQUAL(h.count(), 0u);
+
+    // The per-MsgType histograms are labelled from the message dictionary by msg_type_index.
+    for (int i = 0; i < msg_type_index::unknown; ++i) {
+        char const* v = details::message_dictionary[i].value;
+        BOOST_CHECK_EQUAL(msg_type_to_index(v, v + std::strlen(v)), msg_type_index::type(i));
+    }
+
+    instrument::scoped_stage* scope = new instrument::scoped_stage(instrument::stage::end_to_end);
+    delete scope;
+    BOOST_CHECK_EQUAL(instrument::histograms().stages[instrument::stage::end_to_end].count(), 1u);
+    instrument::reset();
+    BOOST_CHECK_EQUAL(instrument::histograms().stages[instrument::stage::end_to_end].count(), 0u);
+}
+
+// test the FIX Repository layouts of messages, components and repeating groups
+BOOST_AUTO_TEST_CASE(message_layouts)
+{
+    layout const& nos = message_layout(msg_type_index::NewOrderSingle);
+    BOOST_CHECK_EQUAL(nos.name, std::string("NewOrderSingle"));
+
+    std::map<int, layout_entry const*> fields;
+    layout_entry const* instrument = 0;
+    for (layout_entry const* e = layout_begin(nos); e != layout_end(nos); ++e) {
+        if (e->tag) fields[e->tag] = e;
+        if (e->tag == 0 && component_layout(e->component).name == std::string("Instrument")) instrument = e;
+    }
+    BOOST_REQUIRE(fields.count(tag::ClOrdID));
+    BOOST_CHECK(fields[tag::ClOrdID]->required);
+    BOOST_CHECK_EQUAL(fields[tag::ClOrdID]->component, -1);
+    BOOST_REQUIRE(fields.count(tag::Side));
+    BOOST_CHECK(fields[tag::Side]->required);
+    BOOST_REQUIRE(fields.count(tag::Account));
+    BOOST_CHECK(!fields[tag::Account]->required);
+    BOOST_CHECK(!fields.count(tag::MsgSeqNum)); // No StandardHeader.
+    BOOST_CHECK(!fields.count(tag::CheckSum)); // No StandardTrailer.
+
+    // A repeating group is its NumInGroup tag and the layout of one instance.
+    BOOST_REQUIRE(fields.count(tag::NoPartyIDs));
+    layout const& parties = component_layout(fields[tag::NoPartyIDs]->component);
+    BOOST_REQUIRE(layout_begin(parties) != layout_end(parties));
+    BOOST_CHECK_EQUAL(layout_begin(parties)->tag, int(tag::PartyID));
+
+    BOOST_REQUIRE(instrument);
+    BOOST_CHECK(instrument->required);
+    layout const& il = component_layout(instrument->component);
+    BOOST_CHECK_EQUAL(layout_begin(il)->tag, int(tag::Symbol));
+
+    layout const& unknown = message_layout(msg_type_index::unknown);
+    BOOST_CHECK(layout_begin(unknown) == layout_end(unknown));
+
+    for (int c = 0; c < component_layout_count; ++c) {
+        layout const& l = component_layout(c);
+        BOOST_CHECK(l.begin <= l.end);
+        for (layout_entry const* e = layout_begin(l); e != layout_end(l); ++e)
+            BOOST_CHECK(e->component < component_layout_count);
+    }
+
+    enum_dictionary_entry const* eb = 0;
+    enum_dictionary_entry const* ee = 0;
+    BOOST_REQUIRE(enum_values(tag::Side, eb, ee));
+    BOOST_CHECK(eb == enums::Side::values);
+    BOOST_CHECK_EQUAL(ee - eb, long(sizeof(enums::Side::values) / sizeof(enums::Side::values[0])));
+    BOOST_CHECK(!enum_values(tag::ClOrdID, eb, ee));
+    BOOST_CHECK(!enum_values(0, eb, ee));
+}
+
+// Write a NewOrderSingle with some extra fields before the Price, and validate it.
+template <typename Fields> validation_result validate_order(message_validator& v, Fields extra)
+{
+    char buffer[512] = {};
+    message_writer w(buffer);
+    w.push_back_header("FIX.4.4");
+    w.push_back_string(tag::MsgType, "D");
+    w.push_back_string(tag::SenderCompID, "AAAA");
+    w.push_back_string(tag::TargetCompID, "BBBB");
+    w.push_back_int(tag::MsgSeqNum, 1);
+    w.push_back_timestamp(tag::SendingTime, 2026, 10, 18, 9, 30, 0, 0);
+    w.push_back_string(tag::ClOrdID, "A1");
+    w.push_back_string(tag::Symbol, "OIH");
+    w.push_back_timestamp(tag::TransactTime, 2026, 10, 18, 9, 30, 0, 0);
+    w.push_back_int(tag::OrderQty, 100);
+    w.push_back_char(tag::OrdType, '2');
+    extra(w);
+    w.push_back_decimal(tag::Price, 50015, -2);
+    w.push_back_trailer();
+    message_reader r(w);
+    return v.validate(r);
+}
+
+struct no_side {
+    void operator()(message_writer&) const {}
+};
+struct buy {
+    void operator()(message_writer& w) const { w.push_back_char(tag::Side, '1'); }
+};
+struct buy_twice {
+    void operator()(message_writer& w) const { w.push_back_char(tag::Side, '1'); w.push_back_char(tag::Side, '1'); }
+};
+struct bad_side {
+    void operator()(message_writer& w) const { w.push_back_char(tag::Side, 'Z'); }
+};
+struct bad_stop_price {
+    void operator()(message_writer& w) const { buy()(w); w.push_back_string(tag::StopPx, "1.2.3"); }
+};
+struct parties {
+    int count;
+    bool delimiter_first;
+    void operator()(message_writer& w) const {
+        buy()(w);
+        w.push_back_int(tag::NoPartyIDs, count);
+        if (delimiter_first) w.push_back_string(tag::PartyID, "BRKR");
+        w.push_back_char(tag::PartyIDSource, 'D');
+        if (!delimiter_first) w.push_back_string(tag::PartyID, "BRKR");
+    }
+};
+struct undefined_for_message {
+    void operator()(message_writer& w) const { buy()(w); w.push_back_decimal(tag::MDEntryPx, 1, 0); }
+};
+struct custom_tag {
+    int t;
+    void operator()(message_writer& w) const { buy()(w); w.push_back_int(t, 1); }
+};
+struct custom_tag_in_group {
+    void operator()(message_writer& w) const {
+        buy()(w);
+        w.push_back_int(tag::NoPartyIDs, 2);
+        w.push_back_string(tag::PartyID, "BRKR");
+        w.push_back_int(5001, 1);
+        w.push_back_char(tag::PartyIDSource, 'D');
+        w.push_back_string(tag::PartyID, "DESK");
+        w.push_back_int(5001, 2);
+    }
+};
+
+// test single-pass validation against the FIX Repository layouts
+BOOST_AUTO_TEST_CASE(message_validation)
+{
+    message_validator v;
+
+    BOOST_CHECK(validate_order(v, buy()).valid());
+
+    validation_result r = validate_order(v, no_side());
+    BOOST_CHECK_EQUAL(r.reason, enums::SessionRejectReason::RequiredTagMissing);
+    BOOST_CHECK_EQUAL(r.tag, int(tag::Side));
+
+    r = validate_order(v, buy_twice());
+    BOOST_CHECK_EQUAL(r.reason, enums::SessionRejectReason::TagAppearsMoreThanOnce);
+    BOOST_CHECK_EQUAL(r.tag, int(tag::Side));
+
+    r = validate_order(v, bad_side());
+    BOOST_CHECK_EQUAL(r.reason, enums::SessionRejectReason::ValueIsIncorrect);
+    BOOST_CHECK_EQUAL(r.tag, int(tag::Side));
+
+    r = validate_order(v, bad_stop_price());
+    BOOST_CHECK_EQUAL(r.reason, enums::SessionRejectReason::IncorrectDataFormatForValue);
+    BOOST_CHECK_EQUAL(r.tag, int(tag::StopPx));
+
+    parties p = {1, true};
+    BOOST_CHECK(validate_order(v, p).valid());
+    p.count = 2;
+    r = validate_order(v, p);
+    BOOST_CHECK_EQUAL(r.reason, enums::SessionRejectReason::IncorrectNumInGroupCountForRepeatingGroup);
+    BOOST_CHECK_EQUAL(r.tag, int(tag::NoPartyIDs));
+    p.count = 1;
+    p.delimiter_first = false;
+    r = validate_order(v, p);
+    BOOST_CHECK_EQUAL(r.reason, enums::SessionRejectReason::RepeatingGroupFieldsOutOfOrder);
+    BOOST_CHECK_EQUAL(r.tag, int(tag::PartyIDSource));
+
+    r = validate_order(v, undefined_for_message());
+    BOOST_CHECK_EQUAL(r.reason, enums::SessionRejectReason::TagNotDefinedForThisMessageType);
+    BOOST_CHECK_EQUAL(r.tag, int(tag::MDEntryPx));
+
+    custom_tag c = {5001};
+    BOOST_CHECK(validate_order(v, c).valid());
+    BOOST_CHECK(validate_order(v, custom_tag_in_group()).valid());
+    message_validator strict(false);
+    r = validate_order(strict, c);
+    BOOST_CHECK_EQUAL(r.reason, enums::SessionRejectReason::InvalidTagNumber);
+    BOOST_CHECK_EQUAL(r.tag, 5001);
+
+    char buffer[128] = {};
+    message_writer w(buffer);
+    w.push_back_header("FIX.4.4");
+    w.push_back_string(tag::MsgType, "ZZ");
+    w.push_back_trailer();
+    r = v.validate(message_reader(w));
+    BOOST_CHECK_EQUAL(r.reason, enums::SessionRejectReason::InvalidMsgType);
+    BOOST_CHECK_EQUAL(r.tag, int(tag::MsgType));
+}
+
+// Write a NewOrderSingle with some extra fields before the Price, and check the order of its fields.
+template <typename Fields> validation_result check_order(field_order_checker<>& c, Fields extra)
+{
+    char buffer[512] = {};
+    message_writer w(buffer);
+    w.push_back_header("FIX.4.4");
+    w.push_back_string(tag::MsgType, "D");
+    w.push_back_string(tag::SenderCompID, "AAAA");
+    w.push_back_string(tag::TargetCompID, "BBBB");
+    w.push_back_int(tag::MsgSeqNum, 1);
+    w.push_back_string(tag::ClOrdID, "A1");
+    w.push_back_string(tag::Symbol, "OIH");
+    extra(w);
+    w.push_back_decimal(tag::Price, 50015, -2);
+    w.push_back_trailer();
+    message_reader r(w);
+    return c.check(r);
+}
+
+struct nested_parties {
+    void operator()(message_writer& w) const {
+        buy()(w);
+        w.push_back_int(tag::NoPartyIDs, 2);
+        w.push_back_string(tag::PartyID, "BRKR");
+        w.push_back_char(tag::PartyIDSource, 'D');
+        w.push_back_int(tag::PartyRole, 1);
+        w.push_back_int(tag::NoPartySubIDs, 2);
+        w.push_back_string(tag::PartySubID, "X");
+        w.push_back_int(tag::PartySubIDType, 1);
+        w.push_back_string(tag::PartySubID, "Y");
+        w.push_back_int(tag::PartySubIDType, 2);
+        w.push_back_string(tag::PartyID, "CLRG");
+        w.push_back_char(tag::PartyIDSource, 'D');
+        w.push_back_int(tag::PartyRole, 4);
+    }
+};
+struct party_role_twice {
+    void operator()(message_writer& w) const {
+        buy()(w);
+        w.push_back_int(tag::NoPartyIDs, 1);
+        w.push_back_string(tag::PartyID, "BRKR");
+        w.push_back_int(tag::PartyRole, 1);
+        w.push_back_int(tag::PartyRole, 4);
+    }
+};
+struct late_header {
+    void operator()(message_writer& w) const { buy()(w); w.push_back_string(tag::OnBehalfOfCompID, "CCCC"); }
+};
+struct early_trailer {
+    void operator()(message_writer& w) const {
+        buy()(w);
+        char const signature[] = "SIG";
+        w.push_back_data(tag::SignatureLength, tag::Signature, signature, signature + 3);
+    }
+};
+
+// test duplicate and out-of-order tag detection
+BOOST_AUTO_TEST_CASE(field_order)
+{
+    field_order_checker<> c;
+
+    BOOST_CHECK(check_order(c, buy()).valid());
+    BOOST_CHECK(check_order(c, nested_parties()).valid());
+
+    validation_result r = check_order(c, buy_twice());
+    BOOST_CHECK_EQUAL(r.reason, enums::SessionRejectReason::TagAppearsMoreThanOnce);
+    BOOST_CHECK_EQUAL(r.tag, int(tag::Side));
+
+    r = check_order(c, party_role_twice());
+    BOOST_CHECK_EQUAL(r.reason, enums::SessionRejectReason::TagAppearsMoreThanOnce);
+    BOOST_CHECK_EQUAL(r.tag, int(tag::PartyRole));
+
+    r = check_order(c, late_header());
+    BOOST_CHECK_EQUAL(r.reason, enums::SessionRejectReason::TagSpecifiedOutOfRequiredOrder);
+    BOOST_CHECK_EQUAL(r.tag, int(tag::OnBehalfOfCompID));
+
+    r = check_order(c, early_trailer());
+    BOOST_CHECK_EQUAL(r.reason, enums::SessionRejectReason::TagSpecifiedOutOfRequiredOrder);
+    BOOST_CHECK_EQUAL(r.tag, int(tag::Price));
+
+    // The tags seen in rejected messages are forgotten.
+    BOOST_CHECK(check_order(c, buy()).valid());
+}
+
+// Check that a reader on a padded buffer finds the same fields as a reader on the same bytes.
+void check_same_fields(message_reader const& a, message_reader const& p)
+{
+    BOOST_REQUIRE_EQUAL(a.is_complete(), p.is_complete());
+    if (!a.is_complete()) return;
+    BOOST_REQUIRE_EQUAL(a.is_valid(), p.is_valid());
+    if (!a.is_valid()) return;
+    BOOST_CHECK(a.message_end() == p.message_end());
+    BOOST_CHECK(a.prefix_end() == p.prefix_end());
+    message_reader::const_iterator j = p.begin();
+    for (message_reader::const_iterator i = a.begin(); i != a.end(); ++i, ++j) {
+        BOOST_REQUIRE(j != p.end());
+        BOOST_CHECK_EQUAL(i->tag(), j->tag());
+        BOOST_CHECK(i->value().begin() == j->value().begin());
+        BOOST_CHECK(i->value().end() == j->value().end());
+    }
+    BOOST_CHECK(j == p.end());
+}
+
+// test the message_reader fast path for padded buffers
+BOOST_AUTO_TEST_CASE(padded_buffer_reader)
+{
+    char buffer[1024] = {};
+    message_writer w(buffer, buffer + sizeof(buffer) - padded_buffer_t::padding);
+    w.push_back_header("FIX.4.4");
+    w.push_back_string(tag::MsgType, "D");
+    w.push_back_string(tag::SenderCompID, "AAAA");
+    w.push_back_int(tag::MsgSeqNum, 12345678);
+    w.push_back_string(tag::Text, "A value longer than one eight byte word");
+    w.push_back_data(tag::RawDataLength, tag::RawData, "a=b\x01" "c", "a=b\x01" "c" + 5);
+    w.push_back_int(5001, 1);
+    w.push_back_string(tag::OrigClOrdID, "");
+    w.push_back_trailer();
+    message_writer w2(w.message_end(), buffer + sizeof(buffer) - padded_buffer_t::padding);
+    w2.push_back_header("FIXT.1.1");
+    w2.push_back_string(tag::MsgType, "AE");
+    w2.push_back_trailer();
+    char* const end = w2.message_end();
+    // Padding which looks like more fields.
+    for (char* b = end; b < buffer + sizeof(buffer); ++b) b[0] = "9=1\x01"[(b - end) % 4];
+
+    message_reader a(buffer, end);
+    message_reader p(padded_buffer, buffer, end);
+    BOOST_CHECK(p.is_valid());
+    check_same_fields(a, p);
+    check_same_fields(a.next_message_reader(), p.next_message_reader());
+
+    // Truncated and damaged messages.
+    for (char* e = buffer; e < end; ++e) {
+        check_same_fields(message_reader(buffer, e), message_reader(padded_buffer, buffer, e));
+    }
+    buffer[12] = 'x'; // in the BodyLength
+    check_same_fields(message_reader(buffer, end), message_reader(padded_buffer, buffer, end));
+}
+
+// test the message_writer which records errors in a sticky flag instead of throwing
+void write_order(message_writer& w)
+{
+    w.push_back_header("FIX.4.4");
+    w.push_back_string(tag::MsgType, "D");
+    w.push_back_int(tag::MsgSeqNum, 12345);
+    w.push_back_string(tag::Text, "A long text which will not fit in a small buffer");
+    w.push_back_char(tag::Side, '1');
+    w.push_back_decimal(tag::Price, 123456, -3);
+    w.push_back_timestamp(tag::SendingTime, 2026, 10, 18, 12, 30, 0, 123);
+    w.push_back_data(tag::RawDataLength, tag::RawData, "a=b\x01" "c", "a=b\x01" "c" + 5);
+}
+
+BOOST_AUTO_TEST_CASE(nothrow_writer)
+{
+    char expect[256];
+    message_writer e(expect);
+    write_order(e);
+    e.push_back_trailer();
+
+    char buffer[257];
+    for (size_t size = 0; size <= e.message_size(); ++size) {
+        buffer[size] = '\x55';
+        message_writer w(std::nothrow, buffer, buffer + size);
+        write_order(w);
+        bool const complete = w.push_back_trailer();
+        BOOST_CHECK_EQUAL(complete, !w.overflowed());
+        BOOST_CHECK_EQUAL(complete, size == e.message_size());
+        if (complete) BOOST_CHECK(std::equal(expect, expect + e.message_size(), buffer));
+        // make sure the next byte was not clobbered
+        BOOST_CHECK(buffer[size] == '\x55');
+    }
+
+    // After an overflow, nothing else is written, even if it would fit.
+    {
+        message_writer w(std::nothrow, buffer, buffer + 40);
+        w.push_back_header("FIX.4.4");
+        w.push_back_string(tag::Text, "A long text which will not fit");
+        BOOST_CHECK(w.overflowed());
+        char* const end = w.message_end();
+        w.push_back_char(tag::Side, '1');
+        BOOST_CHECK(w.message_end() == end);
+        BOOST_CHECK(!w.push_back_trailer());
+        BOOST_CHECK(w.message_end() == end);
+    }
+
+    // Out of order calls set the flag too.
+    {
+        message_writer w(std::nothrow, buffer);
+        BOOST_CHECK(!w.push_back_trailer());
+        BOOST_CHECK(w.overflowed());
+    }
+    {
+        message_writer w(std::nothrow, buffer);
+        w.push_back_header("FIX.4.4");
+        BOOST_CHECK(!w.overflowed());
+        w.push_back_header("FIX.4.4");
+        BOOST_CHECK(w.overflowed());
+    }
+
+    // The throwing writer never sets the flag.
+    {
+        message_writer w(buffer, buffer + 20);
+        BOOST_CHECK_THROW(write_order(w), std::out_of_range);
+        BOOST_CHECK(!w.overflowed());
+    }
+}
+
+// test the unchecked_writer after one message_writer::reserve()
+BOOST_AUTO_TEST_CASE(reserved_writer)
+{
+    char expect[512];
+    message_writer e(expect);
+    e.push_back_header("FIX.4.4");
+    e.push_back_string(tag::MsgType, "D");
+    e.push_back_int(tag::MsgSeqNum, -2147483647 - 1);
+    e.push_back_char(tag::Side, '1');
+    e.push_back_enum(tag::OrdType, enums::OrdType::Limit);
+    e.push_back_decimal(tag::Price, -5L, -19L);
+    e.push_back_date(tag::TradeDate, 2026, 10, 18);
+    e.push_back_monthyear(tag::MaturityMonthYear, 2026, 12);
+    e.push_back_timeonly(tag::EventTime, 9, 30, 0);
+    e.push_back_timeonly(tag::MDEntryTime, 16, 0, 0, 5);
+    e.push_back_timeonly_nano(2147483647, 16, 0, 0, 5);
+    e.push_back_timestamp(tag::SendingTime, 2026, 10, 18, 12, 30, 1);
+    e.push_back_timestamp(tag::TransactTime, 2026, 10, 18, 12, 30, 1, 7);
+    e.push_back_timestamp_nano(tag::OrigSendingTime, 2026, 10, 18, 12, 30, 1, 7);
+    e.push_back_trailer();
+
+    size_t const size =
+        field_size::string(1) +
+        field_size::integer<int>::value +
+        field_size::character +
+        field_size::enumerated +
+        field_size::decimal<long>::value +
+        field_size::date +
+        field_size::monthyear +
+        field_size::timeonly +
+        field_size::timeonly_milli +
+        field_size::timeonly_nano +
+        field_size::timestamp +
+        field_size::timestamp_milli +
+        field_size::timestamp_nano;
+
+    char buffer[512];
+    message_writer w(buffer);
+    w.push_back_header("FIX.4.4");
+    BOOST_REQUIRE(w.reserve(size));
+    {
+        unchecked_writer u(w);
+        u.push_back_string(tag::MsgType, "D");
+        u.push_back_int(tag::MsgSeqNum, -2147483647 - 1);
+        u.push_back_char(tag::Side, '1');
+        u.push_back_enum(tag::OrdType, enums::OrdType::Limit);
+        u.push_back_decimal(tag::Price, -5L, -19L);
+        u.push_back_date(tag::TradeDate, 2026, 10, 18);
+        u.push_back_monthyear(tag::MaturityMonthYear, 2026, 12);
+        u.push_back_timeonly(tag::EventTime, 9, 30, 0);
+        u.push_back_timeonly(tag::MDEntryTime, 16, 0, 0, 5);
+        u.push_back_timeonly_nano(2147483647, 16, 0, 0, 5);
+    }
+    // Fields from the message_writer and the unchecked_writer may be mixed.
+    w.push_back_timestamp(tag::SendingTime, 2026, 10, 18, 12, 30, 1);
+    {
+        unchecked_writer u(w);
+        u.push_back_timestamp(tag::TransactTime, 2026, 10, 18, 12, 30, 1, 7);
+        u.push_back_timestamp_nano(tag::OrigSendingTime, 2026, 10, 18, 12, 30, 1, 7);
+    }
+    w.push_back_trailer();
+    BOOST_REQUIRE_EQUAL(w.message_size(), e.message_size());
+    BOOST_CHECK(std::equal(expect, expect + e.message_size(), buffer));
+    // The worst-case sizes are big enough for these fields.
+    BOOST_CHECK(w.message_size() <= 22 + size + field_size::trailer);
+
+    // A failed reservation.
+    {
+        message_writer w(buffer, buffer + 40);
+        w.push_back_header("FIX.4.4");
+        BOOST_CHECK(w.reserve(w.buffer_size_remaining()));
+        BOOST_CHECK_THROW(w.reserve(w.buffer_size_remaining() + 1), std::out_of_range);
+    }
+    {
+        message_writer w(std::nothrow, buffer, buffer + 40);
+        w.push_back_header("FIX.4.4");
+        BOOST_CHECK(!w.reserve(size));
+        BOOST_CHECK(w.overflowed());
+        BOOST_CHECK(!w.reserve(0));
+        BOOST_CHECK(!w.push_back_trailer());
+    }
+}
+
+// test the gather_writer against a message_writer which copies everything
+BOOST_AUTO_TEST_CASE(gather_writer_iovec)
+{
+    std::string xml(3000, 'x');
+    for (size_t i = 0; i < xml.size(); ++i) xml[i] = char(' ' + i % 90);
+    std::string const text(300, 't');
+
+    char expect[8192];
+    message_writer e(expect);
+    e.push_back_header("FIX.4.4");
+    e.push_back_string(tag::MsgType, "AS");
+    e.push_back_int(tag::MsgSeqNum, 7);
+    e.push_back_data(tag::SecurityXMLLen, tag::SecurityXML, xml.data(), xml.data() + xml.size());
+    e.push_back_string(tag::Text, text);
+    e.push_back_data(tag::RawDataLength, tag::RawData, "a\x01" "b", "a\x01" "b" + 3);
+    e.push_back_data(tag::XmlDataLen, tag::XmlData, xml.data(), xml.data() + 1000);
+    e.push_back_trailer();
+
+    // Enough iovec for every large value, and only enough for some of them.
+    for (int capacity = 3; capacity <= 8; ++capacity) {
+        char buffer[4096];
+        iovec iov[8];
+        gather_writer g(buffer, buffer + sizeof(buffer), iov, iov + capacity);
+        g.push_back_header("FIX.4.4");
+        g.writer().push_back_string(tag::MsgType, "AS");
+        g.writer().push_back_int(tag::MsgSeqNum, 7);
+        g.push_back_data(tag::SecurityXMLLen, tag::SecurityXML, xml.data(), xml.data() + xml.size());
+        g.push_back_string(tag::Text, text.data(), text.data() + text.size());
+        g.push_back_data(tag::RawDataLength, tag::RawData, "a\x01" "b", "a\x01" "b" + 3);
+        if (capacity < 5) {
+            // No iovec left for the second value, and no room in the buffer.
+            BOOST_CHECK_THROW(g.push_back_data(tag::XmlDataLen, tag::XmlData, xml.data(), xml.data() + 4000), std::out_of_range);
+            continue;
+        }
+        g.push_back_data(tag::XmlDataLen, tag::XmlData, xml.data(), xml.data() + 1000);
+        g.push_back_trailer();
+
+        BOOST_CHECK_EQUAL(g.iov_end() - g.iov_begin(), capacity >= 7 ? 7 : 5);
+        BOOST_CHECK(g.iov_begin()[1].iov_base == xml.data()); // Referenced, not copied.
+        std::string flat;
+        for (iovec const* i = g.iov_begin(); i < g.iov_end(); ++i) {
+            flat.append(static_cast<char const*>(i->iov_base), i->iov_len);
+        }
+        BOOST_CHECK_EQUAL(g.message_size(), flat.size());
+        BOOST_CHECK(flat == std::string(expect, e.message_end()));
+
+        message_reader r(flat.data(), flat.data() + flat.size());
+        BOOST_CHECK(r.is_valid());
+    }
+}
+
+int count_fields(segmented_reader const& r)
+{
+    int n = 0;
+    for (segmented_reader::const_iterator i = r.begin(); i != r.end(); ++i) ++n;
+    return n;
+}
+
+// test the segmented_reader against a message_reader on the same bytes
+BOOST_AUTO_TEST_CASE(segmented_reader_iovec)
+{
+    char buffer[1024];
+    char* b = buffer;
+    {
+        message_writer w(b, buffer + sizeof(buffer));
+        w.push_back_header("FIX.4.4");
+        w.push_back_string(tag::MsgType, "D");
+        w.push_back_string(tag::SenderCompID, "AAAA");
+        w.push_back_int(tag::MsgSeqNum, 12345678);
+        w.push_back_data(tag::RawDataLength, tag::RawData, "a=b\x01" "c", "a=b\x01" "c" + 5);
+        w.push_back_string(tag::Text, "A value longer than one small segment");
+        w.push_back_string(tag::OrigClOrdID, "");
+        w.push_back_trailer();
+        b = w.message_end();
+    }
+    std::memcpy(b, "8=FIX.4.4\x01" "9=5\x01" "xx", 16); // invalid
+    b += 16;
+    {
+        message_writer w(b, buffer + sizeof(buffer));
+        w.push_back_header("FIXT.1.1");
+        w.push_back_string(tag::MsgType, "AE");
+        w.push_back_trailer();
+        b = w.message_end();
+    }
+    std::memcpy(b, "8=FIX.4.4\x01" "9=", 12); // incomplete
+    b += 12;
+
+    for (size_t size = 1; size <= 64; ++size) {
+        std::vector<iovec> iov;
+        for (char* s = buffer; s < b; s += size) {
+            iovec v = { s, std::min(size, size_t(b - s)) };
+            iov.push_back(v);
+            iovec empty = { s, 0 };
+            if (size == 7) iov.push_back(empty);
+        }
+        char scratch[64];
+        segmented_reader r(&iov[0], &iov[0] + iov.size(), scratch, sizeof(scratch));
+        message_reader m(buffer, b);
+        int messages = 0;
+        for (; m.is_complete(); m = m.next_message_reader(), r = r.next_message_reader(), ++messages) {
+            BOOST_REQUIRE(r.is_complete());
+            BOOST_REQUIRE_EQUAL(m.is_valid(), r.is_valid());
+            if (!m.is_valid()) continue;
+            BOOST_CHECK_EQUAL(m.message_size(), r.message_size());
+            segmented_reader::const_iterator j = r.begin();
+            for (message_reader::const_iterator i = m.begin(); i != m.end(); ++i, ++j) {
+                BOOST_REQUIRE(j != r.end());
+                BOOST_CHECK_EQUAL(i->tag(), j->tag());
+                BOOST_CHECK(i->value() == std::string(j->value().begin(), j->value().end()));
+                // Values inside one segment are not copied.
+                if (i->value().size() && (i->value().begin() - buffer) / size == (i->value().end() - 1 - buffer) / size)
+                    BOOST_CHECK(j->value().begin() == i->value().begin());
+            }
+            BOOST_CHECK(j == r.end());
+        }
+        BOOST_CHECK_EQUAL(messages, 3);
+        BOOST_CHECK(!r.is_complete());
+    }
+
+    // The scratch buffer is too small for a straddling value.
+    iovec iov[2] = { { buffer, 40 }, { buffer + 40, size_t(b - buffer - 40) } };
+    char scratch[4];
+    segmented_reader r(iov, iov + 2, scratch, sizeof(scratch));
+    BOOST_CHECK(r.is_valid());
+    BOOST_CHECK_THROW(count_fields(r), std::out_of_range);
+
+    // A data length longer than the message stops at the CheckSum.
+    message_writer w(buffer);
+    w.push_back_header("FIX.4.4");
+    w.push_back_string(tag::MsgType, "D");
+    w.push_back_int(tag::RawDataLength, 50);
+    w.push_back_string(tag::RawData, "abc");
+    w.push_back_trailer();
+    for (size_t split = 1; split < w.message_size(); ++split) {
+        iovec corrupt[2] = { { buffer, split }, { buffer + split, w.message_size() - split } };
+        char scratch2[64];
+        segmented_reader c(corrupt, corrupt + 2, scratch2, sizeof(scratch2));
+        BOOST_REQUIRE(c.is_valid());
+        std::ostringstream fields;
+        segmented_reader::const_iterator i = c.begin();
+        for (int n = 0; i != c.end() && n < 10; ++i, ++n) fields << i->tag() << '=' << std::string(i->value().begin(), i->value().end()) << '|';
+        BOOST_CHECK(i == c.end());
+        BOOST_CHECK_EQUAL(fields.str(), "35=D|96=abc\x01|");
+    }
+}
+
+// Check that a message is valid, has a correct CheckSum, and has the given fields.
+void check_edited(char const* begin, char const* end, char const* expect)
+{
+    message_reader r(begin, end);
+    BOOST_REQUIRE(r.is_valid());
+    BOOST_CHECK(r.message_end() == end);
+    BOOST_CHECK_EQUAL(int(r.calculate_check_sum()), r.check_sum()->value().as_int<int>());
+    std::ostringstream fields;
+    for (message_reader::const_iterator i = r.begin(); i != r.end(); ++i) fields << *i << '|';
+    BOOST_CHECK_EQUAL(fields.str(), expect);
+}
+
+// test the message_editor
+BOOST_AUTO_TEST_CASE(edit_message)
+{
+    char buffer[1024];
+    message_writer w(buffer);
+    w.push_back_header("FIX.4.4");
+    w.push_back_string(tag::MsgType, "D");
+    w.push_back_string(tag::SenderCompID, "CLIENT");
+    w.push_back_string(tag::TargetCompID, "ROUTER");
+    w.push_back_string(tag::DeliverToCompID, "VENUE");
+    w.push_back_int(tag::MsgSeqNum, 7);
+    w.push_back_string(tag::SendingTime, "20261018-12:30:00.000");
+    w.push_back_data(tag::RawDataLength, tag::RawData, "a\x01" "b", "a\x01" "b" + 3);
+    w.push_back_string(tag::ClOrdID, "A1");
+    w.push_back_trailer();
+    message_reader const r(buffer, w.message_end());
+
+    message_editor<> edit;
+    char out[1024];
+    char* e = edit.apply(r, out, out + sizeof(out));
+    check_edited(out, e, "35=D|49=CLIENT|56=ROUTER|128=VENUE|34=7|52=20261018-12:30:00.000|96=a\x01" "b|11=A1|");
+
+    edit.set(tag::SenderCompID, "ROUTER");
+    edit.set(tag::TargetCompID, "VENUE");
+    edit.set(tag::OnBehalfOfCompID, "CLIENT");
+    edit.erase(tag::DeliverToCompID);
+    edit.set_int(tag::MsgSeqNum, 1234567);
+    edit.set(tag::SendingTime, "20261018-12:30:00.123");
+    std::string const expect = "35=D|115=CLIENT|49=ROUTER|56=VENUE|34=1234567|52=20261018-12:30:00.123|96=a\x01" "b|11=A1|";
+    e = edit.apply(r, out, out + sizeof(out));
+    check_edited(out, e, expect.c_str());
+    char out2[1024];
+    char* e2 = edit.apply(r, out2, out2 + sizeof(out2), true);
+    BOOST_CHECK(std::string(out, e) == std::string(out2, e2));
+
+    // Setting again changes the edit, and the edited copy may be edited again.
+    edit.set_int(tag::MsgSeqNum, 8);
+    e2 = edit.apply(message_reader(out, e), out2, out2 + sizeof(out2));
+    check_edited(out2, e2, "35=D|115=CLIENT|49=ROUTER|56=VENUE|34=8|52=20261018-12:30:00.123|96=a\x01" "b|11=A1|");
+
+    // BodyLength changes width.
+    edit.clear();
+    std::string const long_value(200, 'x');
+    edit.set(tag::Text, long_value.data(), long_value.data() + long_value.size());
+    e2 = edit.apply(message_reader(out, e), out2, out2 + sizeof(out2));
+    check_edited(out2, e2, std::string(expect).insert(5, "58=" + long_value + "|").c_str());
+    edit.clear();
+    edit.erase(tag::Text);
+    e = edit.apply(message_reader(out2, e2), out, out + sizeof(out));
+    check_edited(out, e, expect.c_str());
+
+    BOOST_CHECK_THROW(edit.apply(r, out, out + 20), std::out_of_range);
+}
+
+// Decode one FAST message and return its fields.
+std::string fast_decode(hffix::fast::decoder& d, char const*& p, char const* end)
+{
+    char buffer[1024];
+    message_writer w(buffer);
+    w.push_back_header("FIX.5.0SP2");
+    p = d.decode(p, end, w);
+    w.push_back_trailer();
+    message_reader r(buffer, w.message_end());
+    BOOST_REQUIRE(r.is_valid());
+    std::ostringstream fields;
+    for (message_reader::const_iterator i = r.begin(); i != r.end(); ++i) fields << *i << '|';
+    return fields.str();
+}
+
+// test the FAST decoder and encoder
+BOOST_AUTO_TEST_CASE(fast_codec)
+{
+    hffix::fast::templates t;
+    t.load(
+        "<?xml version=\"1.0\"?>\n"
+        "<!-- quotes -->\n"
+        "<templates xmlns=\"http://www.fixprotocol.org/ns/fast/td/1.1\">\n"
+        "  <template name=\"Quote\" id=\"7\">\n"
+        "    <string name=\"MsgType\" id=\"35\"><constant value=\"S\"/></string>\n"
+        "    <uInt32 name=\"MsgSeqNum\" id=\"34\"><increment/></uInt32>\n"
+        "    <string name=\"Symbol\" id=\"55\"><copy/></string>\n"
+        "    <decimal name=\"BidPx\" id=\"132\" presence=\"optional\"><delta/></decimal>\n"
+        "    <int32 name=\"BidSize\" id=\"134\" presence=\"optional\"><default value=\"100\"/></int32>\n"
+        "  </template>\n"
+        "  <template name=\"Book\" id=\"8\">\n"
+        "    <string name=\"MsgType\" id=\"35\"><constant value=\"X\"/></string>\n"
+        "    <string name=\"SendingTime\" id=\"52\"><delta/></string>\n"
+        "    <sequence name=\"MDEntries\">\n"
+        "      <length name=\"NoMDEntries\" id=\"268\"/>\n"
+        "      <uInt32 name=\"MDUpdateAction\" id=\"279\"><copy value=\"0\"/></uInt32>\n"
+        "      <string name=\"Symbol\" id=\"55\"><copy/></string>\n"
+        "      <int64 name=\"MDEntrySize\" id=\"271\" presence=\"optional\"/>\n"
+        "      <string name=\"QuoteCondition\" id=\"276\" presence=\"optional\"><delta/></string>\n"
+        "    </sequence>\n"
+        "  </template>\n"
+        "</templates>\n");
+    BOOST_CHECK(t.contains(7));
+    BOOST_CHECK(t.contains(8));
+    BOOST_CHECK(!t.contains(9));
+
+    // Decode bytes encoded by hand.
+    unsigned char const quotes[] = {
+        0xF0, 0x87, 0x8A, 0x41, 0x42, 0xC3, 0xFE, 0x00, 0xFD, // pmap, template 7, 10, "ABC", 0 + 125e-2, default 100
+        0x88, 0x81, 0x81, 0x80                                // pmap, 11, "ABC", 1.25 + 1e-2, null
+    };
+    char const* const quotes_begin = reinterpret_cast<char const*>(quotes);
+    char const* const quotes_end = quotes_begin + sizeof(quotes);
+    hffix::fast::decoder d(t);
+    char const* p = quotes_begin;
+    BOOST_CHECK_EQUAL(fast_decode(d, p, quotes_end), "35=S|34=10|55=ABC|132=1.25|134=100|");
+    BOOST_CHECK_EQUAL(d.template_id(), 7u);
+    BOOST_CHECK_EQUAL(fast_decode(d, p, quotes_end), "35=S|34=11|55=ABC|132=1.26|");
+    BOOST_CHECK(p == quotes_end);
+
+    // The encoder writes the same bytes.
+    char buffer[1024];
+    message_writer w(buffer);
+    w.push_back_header("FIX.5.0SP2");
+    w.push_back_string(tag::MsgType, "S");
+    w.push_back_int(tag::MsgSeqNum, 10);
+    w.push_back_string(tag::Symbol, "ABC");
+    w.push_back_decimal(tag::BidPx, 125, -2);
+    w.push_back_int(tag::BidSize, 100);
+    w.push_back_trailer();
+    message_writer w2(w.message_end(), buffer + sizeof(buffer));
+    w2.push_back_header("FIX.5.0SP2");
+    w2.push_back_string(tag::MsgType, "S");
+    w2.push_back_string(tag::Symbol, "ABC");
+    w2.push_back_int(tag::MsgSeqNum, 11);
+    w2.push_back_decimal(tag::BidPx, 126, -2);
+    w2.push_back_trailer();
+    hffix::fast::encoder e(t);
+    char fast[256];
+    char* q = e.encode(7, message_reader(buffer, w.message_end()), fast, fast + sizeof(fast));
+    q = e.encode(7, message_reader(w2.message_begin(), w2.message_end()), q, fast + sizeof(fast));
+    BOOST_CHECK(std::string(fast, q) == std::string(quotes_begin, quotes_end));
+
+    // Round trip sequences, and string deltas which change the back and the front.
+    char buffer2[1024];
+    message_writer w3(buffer2);
+    w3.push_back_header("FIX.5.0SP2");
+    w3.push_back_string(tag::MsgType, "X");
+    w3.push_back_string(tag::SendingTime, "20261018-12:30:00.000");
+    w3.push_back_int(tag::NoMDEntries, 2);
+    w3.push_back_int(tag::MDUpdateAction, 0);
+    w3.push_back_string(tag::Symbol, "XYZ");
+    w3.push_back_int(tag::MDEntrySize, -5);
+    w3.push_back_string(tag::QuoteCondition, "A B");
+    w3.push_back_int(tag::MDUpdateAction, 2);
+    w3.push_back_string(tag::Symbol, "XYZ");
+    w3.push_back_string(tag::QuoteCondition, "C B");
+    w3.push_back_trailer();
+    message_writer w4(w3.message_end(), buffer2 + sizeof(buffer2));
+    w4.push_back_header("FIX.5.0SP2");
+    w4.push_back_string(tag::MsgType, "X");
+    w4.push_back_string(tag::SendingTime, "20261018-12:30:01.500");
+    w4.push_back_int(tag::NoMDEntries, 1);
+    w4.push_back_int(tag::MDUpdateAction, 2);
+    w4.push_back_string(tag::Symbol, "XYZW");
+    w4.push_back_int(tag::MDEntrySize, 0);
+    w4.push_back_trailer();
+    e.reset();
+    q = e.encode(8, message_reader(buffer2, w3.message_end()), fast, fast + sizeof(fast));
+    q = e.encode(7, message_reader(buffer, w.message_end()), q, fast + sizeof(fast));
+    q = e.encode(8, message_reader(w4.message_begin(), w4.message_end()), q, fast + sizeof(fast));
+    d.reset();
+    p = fast;
+    BOOST_CHECK_EQUAL(fast_decode(d, p, q), "35=X|52=20261018-12:30:00.000|268=2|279=0|55=XYZ|271=-5|276=A B|279=2|55=XYZ|276=C B|");
+    BOOST_CHECK_EQUAL(fast_decode(d, p, q), "35=S|34=10|55=ABC|132=1.25|134=100|");
+    BOOST_CHECK_EQUAL(fast_decode(d, p, q), "35=X|52=20261018-12:30:01.500|268=1|279=2|55=XYZW|271=0|");
+    BOOST_CHECK(p == q);
+
+    // Errors.
+    d.reset();
+    p = fast;
+    BOOST_CHECK_THROW(fast_decode(d, p, fast + 3), std::out_of_range);
+    BOOST_CHECK_THROW(e.encode(7, message_reader(buffer2, w3.message_end()), fast, fast + sizeof(fast)), std::runtime_error);
+    BOOST_CHECK_THROW(e.encode(7, message_reader(buffer, w.message_end()), fast, fast + 4), std::out_of_range);
+    BOOST_CHECK_THROW(e.encode(9, message_reader(buffer, w.message_end()), fast, fast + sizeof(fast)), std::runtime_error);
+    hffix::fast::templates bad;
+    BOOST_CHECK_THROW(bad.load("<templates><template id=\"1\"><group name=\"G\"/></template></templates>"), std::invalid_argument);
+    BOOST_CHECK_THROW(bad.load("<template id=\"1\"><uInt32 name=\"A\" id=\"1\"></template>"), std::invalid_argument);
+    BOOST_CHECK_THROW(bad.load("<template id=\"1\"><string name=\"A\" id=\"1\"><increment/></string></template>"), std::invalid_argument);
+}
+
+// test that the FAST decoder rejects malformed decimals
+BOOST_AUTO_TEST_CASE(fast_malformed)
+{
+    hffix::fast::templates t;
+    t.load(
+        "<templates xmlns=\"http://www.fixprotocol.org/ns/fast/td/1.1\">\n"
+        "  <template name=\"Price\" id=\"1\">\n"
+        "    <string name=\"MsgType\" id=\"35\"><constant value=\"S\"/></string>\n"
+        "    <decimal name=\"Price\" id=\"44\"/>\n"
+        "  </template>\n"
+        "</templates>\n");
+    hffix::fast::decoder d(t);
+
+    unsigned char const scaled[] = { 0xC0, 0x81, 0x92, 0x83 }; // 3e18
+    char const* p = reinterpret_cast<char const*>(scaled);
+    BOOST_CHECK_EQUAL(fast_decode(d, p, p + sizeof(scaled)), "35=S|44=3000000000000000000|");
+
+    unsigned char const huge_exponent[] = { 0xC0, 0x81, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x80, 0x81 };
+    p = reinterpret_cast<char const*>(huge_exponent);
+    BOOST_CHECK_THROW(fast_decode(d, p, p + sizeof(huge_exponent)), std::runtime_error);
+
+    unsigned char const exponent_64[] = { 0xC0, 0x81, 0x00, 0xC0, 0x81 };
+    p = reinterpret_cast<char const*>(exponent_64);
+    BOOST_CHECK_THROW(fast_decode(d, p, p + sizeof(exponent_64)), std::runtime_error);
+
+    unsigned char const overflow[] = { 0xC0, 0x81, 0x93, 0x8A }; // 10e19
+    p = reinterpret_cast<char const*>(overflow);
+    BOOST_CHECK_THROW(fast_decode(d, p, p + sizeof(overflow)), std::runtime_error);
+
+    unsigned char const negative_overflow[] = { 0xC0, 0x81, 0xBF, 0xFF }; // -1e63
+    p = reinterpret_cast<char const*>(negative_overflow);
+    BOOST_CHECK_THROW(fast_decode(d, p, p + sizeof(negative_overflow)), std::runtime_error);
+
+    // An entity without a ';'.
+    hffix::fast::templates bad;
+    BOOST_CHECK_THROW(bad.load("<template name=\"x&lt\" id=\"1\"/>"), std::invalid_argument);
+}
+
+// Decode one SBE message and return its fields.
+std::string sbe_decode(hffix::sbe::decoder& d, char const*& p, char const* end)
+{
+    char buffer[1024];
+    message_writer w(buffer);
+    w.push_back_header("FIX.5.0SP2");
+    p = d.decode(p, end, w);
+    w.push_back_trailer();
+    message_reader r(buffer, w.message_end());
+    BOOST_REQUIRE(r.is_valid());
+    std::ostringstream fields;
+    for (message_reader::const_iterator i = r.begin(); i != r.end(); ++i) fields << *i << '|';
+    return fields.str();
+}
+
+// Read a little-endian integer from an SBE message.
+uint64_t sbe_load(char const* p, size_t size)
+{
+    uint64_t x = 0;
+    for (size_t i = 0; i < size; ++i) x |= uint64_t(static_cast<unsigned char>(p[i])) << (8 * i);
+    return x;
+}
+
+// test the SBE encoder and decoder
+BOOST_AUTO_TEST_CASE(sbe_transcoder)
+{
+    hffix::sbe::schema s;
+    s.load(
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<sbe:messageSchema xmlns:sbe=\"http://fixprotocol.io/2016/sbe\" package=\"orders\" id=\"91\" version=\"2\" byteOrder=\"littleEndian\">\n"
+        "  <types>\n"
+        "    <composite name=\"messageHeader\">\n"
+        "      <type name=\"blockLength\" primitiveType=\"uint16\"/>\n"
+        "      <type name=\"templateId\" primitiveType=\"uint16\"/>\n"
+        "      <type name=\"schemaId\" primitiveType=\"uint16\"/>\n"
+        "      <type name=\"version\" primitiveType=\"uint16\"/>\n"
+        "    </composite>\n"
+        "    <composite name=\"groupSizeEncoding\">\n"
+        "      <type name=\"blockLength\" primitiveType=\"uint16\"/>\n"
+        "      <type name=\"numInGroup\" primitiveType=\"uint16\"/>\n"
+        "    </composite>\n"
+        "    <composite name=\"varStringEncoding\">\n"
+        "      <type name=\"length\" primitiveType=\"uint16\"/>\n"
+        "      <type name=\"varData\" primitiveType=\"uint8\" length=\"0\"/>\n"
+        "    </composite>\n"
+        "    <composite name=\"Price\">\n"
+        "      <type name=\"mantissa\" primitiveType=\"int64\"/>\n"
+        "      <type name=\"exponent\" primitiveType=\"int8\" presence=\"constant\">-4</type>\n"
+        "    </composite>\n"
+        "    <composite name=\"UTCTimestamp\">\n"
+        "      <type name=\"time\" primitiveType=\"uint64\"/>\n"
+        "      <type name=\"unit\" primitiveType=\"uint8\" presence=\"constant\">9</type>\n"
+        "    </composite>\n"
+        "    <type name=\"ClOrdID\" primitiveType=\"char\" length=\"20\"/>\n"
+        "    <type name=\"PartyID\" primitiveType=\"char\" length=\"8\"/>\n"
+        "    <enum name=\"Side\" encodingType=\"char\">\n"
+        "      <validValue name=\"Buy\">1</validValue>\n"
+        "      <validValue name=\"Sell\">2</validValue>\n"
+        "    </enum>\n"
+        "  </types>\n"
+        "  <sbe:message name=\"NewOrderSingle\" id=\"1\" semanticType=\"D\">\n"
+        "    <field name=\"ClOrdID\" id=\"11\" type=\"ClOrdID\"/>\n"
+        "    <field name=\"Side\" id=\"54\" type=\"Side\"/>\n"
+        "    <field name=\"OrderQty\" id=\"38\" type=\"uint32\"/>\n"
+        "    <field name=\"Price\" id=\"44\" type=\"Price\" presence=\"optional\"/>\n"
+        "    <field name=\"TransactTime\" id=\"60\" type=\"UTCTimestamp\" presence=\"optional\"/>\n"
+        "    <field name=\"HandlInst\" id=\"21\" type=\"char\" presence=\"constant\">1</field>\n"
+        "    <group name=\"Parties\" id=\"453\">\n"
+        "      <field name=\"PartyID\" id=\"448\" type=\"PartyID\"/>\n"
+        "      <field name=\"PartyRole\" id=\"452\" type=\"uint8\"/>\n"
+        "    </group>\n"
+        "    <data name=\"Text\" id=\"58\" type=\"varStringEncoding\"/>\n"
+        "  </sbe:message>\n"
+        "</sbe:messageSchema>\n");
+    BOOST_CHECK(s.contains(1));
+    BOOST_CHECK(!s.contains(2));
+    BOOST_CHECK_EQUAL(s.header_size(), 8u);
+    BOOST_CHECK_EQUAL(s.field_offset(1, tag::ClOrdID), 8u);
+    BOOST_CHECK_EQUAL(s.field_offset(1, tag::OrderQty), 29u);
+    BOOST_CHECK_EQUAL(s.field_offset(1, tag::Price), 33u);
+    BOOST_CHECK_EQUAL(s.field_offset(1, tag::TransactTime), 41u);
+    BOOST_CHECK_EQUAL(s.field_offset(1, tag::HandlInst), size_t(-1));
+    BOOST_CHECK_EQUAL(s.field_offset(1, tag::PartyID), size_t(-1));
+    BOOST_CHECK_EQUAL(s.field_offset(2, tag::ClOrdID), size_t(-1));
+
+    char buffer[1024];
+    message_writer w(buffer);
+    w.push_back_header("FIX.5.0SP2");
+    w.push_back_string(tag::MsgType, "D");
+    w.push_back_string(tag::ClOrdID, "ORD1");
+    w.push_back_char(tag::Side, '1');
+    w.push_back_int(tag::OrderQty, 100);
+    w.push_back_decimal(tag::Price, 105, -1);
+    w.push_back_string(tag::TransactTime, "20261018-12:30:00.123456789");
+    w.push_back_int(tag::NoPartyIDs, 2);
+    w.push_back_string(tag::PartyID, "AB");
+    w.push_back_int(tag::PartyRole, 1);
+    w.push_back_string(tag::PartyID, "CD");
+    w.push_back_int(tag::PartyRole, 3);
+    w.push_back_string(tag::Text, "hello");
+    w.push_back_trailer();
+
+    hffix::sbe::encoder e(s);
+    char sbe[256];
+    char* q = e.encode(message_reader(buffer, w.message_end()), sbe, sbe + sizeof(sbe));
+    BOOST_CHECK_EQUAL(q - sbe, 8 + 41 + 4 + 2 * 9 + 2 + 5);
+    BOOST_CHECK_EQUAL(sbe_load(sbe, 2), 41u);     // blockLength
+    BOOST_CHECK_EQUAL(sbe_load(sbe + 2, 2), 1u);  // templateId
+    BOOST_CHECK_EQUAL(sbe_load(sbe + 4, 2), 91u); // schemaId
+    BOOST_CHECK_EQUAL(sbe_load(sbe + 6, 2), 2u);  // version
+    BOOST_CHECK_EQUAL(std::string(sbe + 8, 20), std::string("ORD1") + std::string(16, '\0'));
+    BOOST_CHECK_EQUAL(sbe[28], '1');
+    BOOST_CHECK_EQUAL(sbe_load(sbe + s.field_offset(1, tag::OrderQty), 4), 100u);
+    BOOST_CHECK_EQUAL(sbe_load(sbe + s.field_offset(1, tag::Price), 8), 105000u);
+    BOOST_CHECK_EQUAL(sbe_load(sbe + s.field_offset(1, tag::TransactTime), 8), uint64_t(1792326600123456789ULL));
+    BOOST_CHECK_EQUAL(sbe_load(sbe + 49, 2), 9u); // group blockLength
+    BOOST_CHECK_EQUAL(sbe_load(sbe + 51, 2), 2u); // numInGroup
+    BOOST_CHECK_EQUAL(std::string(sbe + 53, 9), std::string("AB\0\0\0\0\0\0\x01", 9));
+    BOOST_CHECK_EQUAL(sbe_load(sbe + 71, 2), 5u);
+    BOOST_CHECK_EQUAL(std::string(sbe + 73, 5), "hello");
+
+    hffix::sbe::decoder d(s);
+    char const* p = sbe;
+    BOOST_CHECK_EQUAL(sbe_decode(d, p, q),
+        "35=D|11=ORD1|54=1|38=100|44=10.5|60=20261018-12:30:00.123456789|21=1|453=2|448=AB|452=1|448=CD|452=3|58=hello|");
+    BOOST_CHECK_EQUAL(d.template_id(), 1u);
+    BOOST_CHECK(p == q);
+
+    // Optional fields, groups and data which are not in the message are null or empty.
+    message_writer w2(buffer);
+    w2.push_back_header("FIX.5.0SP2");
+    w2.push_back_string(tag::MsgType, "D");
+    w2.push_back_string(tag::ClOrdID, "ORD2");
+    w2.push_back_string(tag::Account, "skipped");
+    w2.push_back_char(tag::Side, '2');
+    w2.push_back_int(tag::OrderQty, 5);
+    w2.push_back_trailer();
+    char* q2 = e.encode(1, message_reader(buffer, w2.message_end()), q, sbe + sizeof(sbe));
+    BOOST_CHECK_EQUAL(q2 - q, 8 + 41 + 4 + 2);
+    BOOST_CHECK_EQUAL(sbe_load(q + s.field_offset(1, tag::Price), 8), uint64_t(1) << 63);
+    BOOST_CHECK_EQUAL(sbe_decode(d, p, q2), "35=D|11=ORD2|54=2|38=5|21=1|");
+    BOOST_CHECK(p == q2);
+
+    // Errors.
+    BOOST_CHECK_THROW(e.encode(message_reader(buffer, w2.message_end()), sbe, sbe + 40), std::out_of_range);
+    BOOST_CHECK_THROW(e.encode(2, message_reader(buffer, w2.message_end()), sbe, sbe + sizeof(sbe)), std::runtime_error);
+    p = sbe;
+    BOOST_CHECK_THROW(sbe_decode(d, p, q - 3), std::out_of_range);
+    p = sbe;
+    BOOST_CHECK_THROW(sbe_decode(d, p, sbe + 30), std::out_of_range);
+    message_writer w3(buffer);
+    w3.push_back_header("FIX.5.0SP2");
+    w3.push_back_string(tag::MsgType, "D");
+    w3.push_back_decimal(tag::Price, 123456, -5);
+    w3.push_back_trailer();
+    BOOST_CHECK_THROW(e.encode(message_reader(buffer, w3.message_end()), sbe, sbe + sizeof(sbe)), std::runtime_error);
+    message_writer w4(buffer);
+    w4.push_back_header("FIX.5.0SP2");
+    w4.push_back_string(tag::MsgType, "0");
+    w4.push_back_trailer();
+    BOOST_CHECK_THROW(e.encode(message_reader(buffer, w4.message_end()), sbe, sbe + sizeof(sbe)), std::runtime_error);
+
+    // Big-endian, with the default header and a signed field.
+    hffix::sbe::schema big;
+    big.load(
+        "<messageSchema id=\"3\" byteOrder=\"bigEndian\">"
+        "<message name=\"Heartbeat\" id=\"2\" semanticType=\"0\">"
+        "<field name=\"MsgSeqNum\" id=\"34\" type=\"uint32\"/>"
+        "<field name=\"Offset\" id=\"5000\" type=\"int16\"/>"
+        "</message>"
+        "</messageSchema>");
+    message_writer w5(buffer);
+    w5.push_back_header("FIX.5.0SP2");
+    w5.push_back_string(tag::MsgType, "0");
+    w5.push_back_int(tag::MsgSeqNum, 258);
+    w5.push_back_int(5000, -2);
+    w5.push_back_trailer();
+    hffix::sbe::encoder be(big);
+    q = be.encode(message_reader(buffer, w5.message_end()), sbe, sbe + sizeof(sbe));
+    BOOST_CHECK_EQUAL(std::string(sbe, q), std::string("\0\x06\0\x02\0\x03\0\0\0\0\x01\x02\xFF\xFE", 14));
+    hffix::sbe::decoder bd(big);
+    p = sbe;
+    BOOST_CHECK_EQUAL(sbe_decode(bd, p, q), "35=0|34=258|5000=-2|");
+
+    // Decimals which overflow when they are scaled.
+    message_writer w6(buffer);
+    w6.push_back_header("FIX.5.0SP2");
+    w6.push_back_string(tag::MsgType, "D");
+    w6.push_back_string(tag::Price, "10000000000000000");
+    w6.push_back_trailer();
+    BOOST_CHECK_THROW(e.encode(message_reader(buffer, w6.message_end()), sbe, sbe + sizeof(sbe)), std::runtime_error);
+    hffix::sbe::schema px;
+    px.load(
+        "<messageSchema id=\"4\"><types><composite name=\"Decimal\">"
+        "<type name=\"mantissa\" primitiveType=\"int64\"/><type name=\"exponent\" primitiveType=\"int8\"/>"
+        "</composite></types>"
+        "<message name=\"Quote\" id=\"1\" semanticType=\"S\"><field name=\"BidPx\" id=\"132\" type=\"Decimal\"/></message>"
+        "</messageSchema>");
+    hffix::sbe::decoder pd(px);
+    std::string const scaled("\x09\0\x01\0\x04\0\0\0" "\x03\0\0\0\0\0\0\0" "\x12", 17);
+    p = scaled.data();
+    BOOST_CHECK_EQUAL(sbe_decode(pd, p, scaled.data() + scaled.size()), "35=S|132=3000000000000000000|");
+    std::string const overflow("\x09\0\x01\0\x04\0\0\0" "\x0A\0\0\0\0\0\0\0" "\x13", 17);
+    p = overflow.data();
+    BOOST_CHECK_THROW(sbe_decode(pd, p, overflow.data() + overflow.size()), std::runtime_error);
+    std::string const huge_exponent("\x09\0\x01\0\x04\0\0\0" "\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF" "\x7F", 17);
+    p = huge_exponent.data();
+    BOOST_CHECK_THROW(sbe_decode(pd, p, huge_exponent.data() + huge_exponent.size()), std::runtime_error);
+
+    // Unsupported schemas.
+    BOOST_CHECK_THROW(big.load("<messageSchema><message name=\"A\" id=\"1\">"), std::invalid_argument);
+    BOOST_CHECK_THROW(big.load(
+        "<messageSchema><types><set name=\"Flags\" encodingType=\"uint8\"/></types>"
+        "<message name=\"A\" id=\"1\"><field name=\"F\" id=\"1\" type=\"Flags\"/></message></messageSchema>"),
+        std::invalid_argument);
+    BOOST_CHECK_THROW(big.load(
+        "<messageSchema><message name=\"A\" id=\"1\"><field name=\"F\" id=\"1\" type=\"float\"/></message></messageSchema>"),
+        std::invalid_argument);
+}
+
+#if __cplusplus >= 201103L
+namespace hffix { namespace tag { enum { TestStrategy = 7001 }; } }
+
+HFFIX_MESSAGE(reflected_order,
+    (ClOrdID, std::string),
+    (Side, char),
+    (OrderQty, std::int64_t),
+    (Price, hffix::reflect::decimal),
+    (TransactTime, std::chrono::time_point<std::chrono::system_clock, std::chrono::nanoseconds>),
+    (SendingTime, std::chrono::time_point<std::chrono::system_clock, std::chrono::milliseconds>),
+    (LocateReqd, bool),
+    (MaxFloor, unsigned int),
+    (TestStrategy, int)
+);
+
+// test the HFFIX_MESSAGE reflection macro
+BOOST_AUTO_TEST_CASE(reflect_message)
+{
+    using namespace std::chrono;
+    BOOST_CHECK_EQUAL(reflected_order::field_count, 9u);
+
+    reflected_order o = {
+        "ORD1", '1', 100, { 1005, -2 },
+        time_point<system_clock, nanoseconds>(nanoseconds(1792326600123456789LL)),
+        time_point<system_clock, milliseconds>(milliseconds(1792326600123LL)),
+        true, 7u, -3
+    };
+    char buffer[1024];
+    message_writer w(buffer);
+    w.push_back_header("FIX.4.4");
+    w.push_back_string(tag::MsgType, "D");
+    o.push_back_fields(w);
+    w.push_back_trailer();
+    message_reader r(buffer, w.message_end());
+    BOOST_REQUIRE(r.is_valid());
+    std::ostringstream fields;
+    for (message_reader::const_iterator i = r.begin(); i != r.end(); ++i) fields << *i << '|';
+    BOOST_CHECK_EQUAL(fields.str(),
+        "35=D|11=ORD1|54=1|38=100|44=10.05|60=20261018-12:30:00.123456789|52=20261018-12:30:00.123|114=Y|111=7|7001=-3|");
+
+    reflected_order p = reflected_order();
+    BOOST_CHECK_EQUAL(p.read_fields(r), 9u);
+    BOOST_CHECK_EQUAL(p.ClOrdID, "ORD1");
+    BOOST_CHECK_EQUAL(p.Side, '1');
+    BOOST_CHECK_EQUAL(p.OrderQty, 100);
+    BOOST_CHECK_EQUAL(p.Price.mantissa, 1005);
+    BOOST_CHECK_EQUAL(p.Price.exponent, -2);
+    BOOST_CHECK(p.TransactTime == o.TransactTime);
+    BOOST_CHECK(p.SendingTime == o.SendingTime);
+    BOOST_CHECK(p.LocateReqd);
+    BOOST_CHECK_EQUAL(p.MaxFloor, 7u);
+    BOOST_CHECK_EQUAL(p.TestStrategy, -3);
+
+    // Fields out of member order, other fields, and missing fields.
+    message_writer w2(buffer);
+    w2.push_back_header("FIX.4.4");
+    w2.push_back_string(tag::MsgType, "D");
+    w2.push_back_int(tag::TestStrategy, 12);
+    w2.push_back_string(tag::Account, "ACCT");
+    w2.push_back_char(tag::LocateReqd, 'N');
+    w2.push_back_int(tag::OrderQty, 200);
+    w2.push_back_string(tag::ClOrdID, "ORD2");
+    w2.push_back_char(tag::Side, '2');
+    w2.push_back_trailer();
+    BOOST_CHECK_EQUAL(p.read_fields(message_reader(buffer, w2.message_end())), 5u);
+    BOOST_CHECK_EQUAL(p.ClOrdID, "ORD2");
+    BOOST_CHECK_EQUAL(p.Side, '2');
+    BOOST_CHECK_EQUAL(p.OrderQty, 200);
+    BOOST_CHECK_EQUAL(p.Price.mantissa, 1005);
+    BOOST_CHECK(!p.LocateReqd);
+    BOOST_CHECK_EQUAL(p.TestStrategy, 12);
+}
+#endif
+
+#if __cplusplus >= 201703L
+HFFIX_MESSAGE(reflected_cancel,
+    (OrigClOrdID, std::string_view),
+    (ClOrdID, std::string_view),
+    (Text, std::optional<std::string>)
+);
+
+// test the HFFIX_MESSAGE reflection macro with string_view and optional members
+BOOST_AUTO_TEST_CASE(reflect_message_optional)
+{
+    reflected_cancel c = { "ORD1", "ORD2", std::nullopt };
+    char buffer[1024];
+    message_writer w(buffer);
+    w.push_back_header("FIX.4.4");
+    w.push_back_string(tag::MsgType, "F");
+    c.push_back_fields(w);
+    w.push_back_trailer();
+    message_reader r(buffer, w.message_end());
+    BOOST_REQUIRE(r.is_valid());
+    BOOST_CHECK(std::find_if(r.begin(), r.end(), tag_equal(tag::Text)) == r.end());
+
+    reflected_cancel d = reflected_cancel();
+    BOOST_CHECK_EQUAL(d.read_fields(r), 2u);
+    BOOST_CHECK(d.OrigClOrdID == "ORD1"sv);
+    BOOST_CHECK(d.ClOrdID == "ORD2"sv);
+    BOOST_CHECK(d.ClOrdID.data() > buffer && d.ClOrdID.data() < w.message_end());
+    BOOST_CHECK(!d.Text);
+
+    c.Text = "late";
+    message_writer w2(buffer);
+    w2.push_back_header("FIX.4.4");
+    w2.push_back_string(tag::MsgType, "F");
+    c.push_back_fields(w2);
+    w2.push_back_trailer();
+    BOOST_CHECK_EQUAL(d.read_fields(message_reader(buffer, w2.message_end())), 3u);
+    BOOST_CHECK(d.Text && *d.Text == "late");
+}
+#endif
+
+// test that the static dictionaries agree with the dictionary_init_ functions
+BOOST_AUTO_TEST_CASE(static_dictionary)
+{
+    std::map<int, std::string> fields;
+    dictionary_init_field(fields);
+    for (std::map<int, std::string>::const_iterator i = fields.begin(); i != fields.end(); ++i) {
+        char const* name = dictionary_field_name(i->first);
+        BOOST_REQUIRE(name);
+        BOOST_CHECK_EQUAL(name, i->second);
+        BOOST_CHECK(dictionary_field_type(i->first));
+    }
+    BOOST_CHECK_EQUAL(dictionary_field_type(tag::Price), std::string("Price"));
+    BOOST_CHECK(!dictionary_field_name(0));
+    BOOST_CHECK(!dictionary_field_name(-1));
+    BOOST_CHECK(!dictionary_field_name(fields.rbegin()->first + 1));
+
+    std::map<std::string, std::string> messages;
+    dictionary_init_message(messages);
+    for (std::map<std::string, std::string>::const_iterator i = messages.begin(); i != messages.end(); ++i) {
+        char const* name = dictionary_message_name(i->first.data(), i->first.data() + i->first.size());
+        BOOST_REQUIRE(name);
+        BOOST_CHECK_EQUAL(name, i->second);
+    }
+    char const unknown[] = "ZZZ";
+    BOOST_CHECK(!dictionary_message_name(unknown, unknown + 3));
+    BOOST_CHECK(!dictionary_message_name(unknown, unknown));
+    BOOST_CHECK(!dictionary_message_name(msg_type::NewOrderSingle, msg_type::NewOrderSingle));
+}
+
 #if __cplusplus >= 201103L
 // test that std::chrono values can be written and read correctly
 BOOST_AUTO_TEST_CASE(chrono)
@@ -383,6 +2210,120 @@ BOOST_AUTO_TEST_CASE(chrono_nano)
     // BOOST_CHECK_EQUAL(tstr, i->value().as_string());
 }
 
+
+// Records the last decoded value for the visit test.
+struct visit_recorder {
+    std::string kind;
+    std::int64_t a = 0, b = 0;
+    int t[7] = {};
+    void on_int(field const&, std::int64_t i) { kind = "int"; a = i; }
+    void on_decimal(field const&, std::int64_t m, std::int64_t e) { kind = "decimal"; a = m; b = e; }
+    void on_char(field const&, char c) { kind = "char"; a = c; }
+    void on_bool(field const&, bool v) { kind = "bool"; a = v; }
+    void on_date(field const&, int y, int m, int d) { kind = "date"; t[0] = y; t[1] = m; t[2] = d; }
+    void on_monthyear(field const&, int y, int m) { kind = "monthyear"; t[0] = y; t[1] = m; }
+    void on_timeonly(field const&, int h, int m, int s, int ns) { kind = "timeonly"; t[3] = h; t[4] = m; t[5] = s; t[6] = ns; }
+    void on_timestamp(field const&, int y, int mo, int d, int h, int mi, int s, int ns) {
+        kind = "timestamp"; t[0] = y; t[1] = mo; t[2] = d; t[3] = h; t[4] = mi; t[5] = s; t[6] = ns;
+    }
+    void on_string(field const& f) { kind = "string:" + f.value().as_string(); }
+};
+
+// test that visit() decodes fields according to their FIX data type
+BOOST_AUTO_TEST_CASE(visit_field_type)
+{
+    BOOST_CHECK_EQUAL(field_type_of(tag::Price), field_type::Price);
+    BOOST_CHECK_EQUAL(field_type_of(tag::Side), field_type::Char);
+    BOOST_CHECK_EQUAL(field_type_of(tag::MsgSeqNum), field_type::SeqNum);
+    BOOST_CHECK_EQUAL(field_type_of(0), field_type::Unknown);
+
+    char buffer[512] = {};
+    message_writer w(buffer);
+    w.push_back_header("FIX.4.4");
+    w.push_back_string(tag::MsgType, "D");
+    w.push_back_int(tag::MsgSeqNum, 42);
+    w.push_back_string(tag::SendingTime, "20170809-12:34:56.123");
+    w.push_back_string(tag::ClOrdID, "A1");
+    w.push_back_char(tag::Side, '1');
+    w.push_back_decimal(tag::Price, 12345, -2);
+    w.push_back_string(tag::PossDupFlag, "Y");
+    w.push_back_string(tag::MaturityMonthYear, "201708");
+    w.push_back_string(tag::ExpireDate, "20170810");
+    w.push_back_string(tag::ExpireTime, "bogus");
+    w.push_back_string(tag::MDEntryTime, "12:34:00.789456123");
+    w.push_back_string(9999, "x");
+    w.push_back_string(tag::OrderQty, "1.5.0");
+    w.push_back_string(tag::MsgSeqNum, "abc");
+    w.push_back_trailer();
+
+    message_reader r(w);
+    visit_recorder v;
+    message_reader::const_iterator i = r.begin();
+
+    BOOST_REQUIRE(r.find_with_hint(tag::MsgSeqNum, i));
+    visit(*i, v);
+    BOOST_CHECK_EQUAL(v.kind, "int");
+    BOOST_CHECK_EQUAL(v.a, 42);
+
+    BOOST_REQUIRE(r.find_with_hint(tag::SendingTime, i));
+    visit(*i, v);
+    BOOST_CHECK_EQUAL(v.kind, "timestamp");
+    BOOST_CHECK_EQUAL(v.t[0], 2017);
+    BOOST_CHECK_EQUAL(v.t[5], 56);
+    BOOST_CHECK_EQUAL(v.t[6], 123000000);
+
+    BOOST_REQUIRE(r.find_with_hint(tag::ClOrdID, i));
+    visit(*i, v);
+    BOOST_CHECK_EQUAL(v.kind, "string:A1");
+
+    BOOST_REQUIRE(r.find_with_hint(tag::Side, i));
+    visit(*i, v);
+    BOOST_CHECK_EQUAL(v.kind, "char");
+    BOOST_CHECK_EQUAL(v.a, '1');
+
+    BOOST_REQUIRE(r.find_with_hint(tag::Price, i));
+    visit(*i, v);
+    BOOST_CHECK_EQUAL(v.kind, "decimal");
+    BOOST_CHECK_EQUAL(v.a, 12345);
+    BOOST_CHECK_EQUAL(v.b, -2);
+
+    BOOST_REQUIRE(r.find_with_hint(tag::PossDupFlag, i));
+    visit(*i, v);
+    BOOST_CHECK_EQUAL(v.kind, "bool");
+    BOOST_CHECK_EQUAL(v.a, 1);
+
+    BOOST_REQUIRE(r.find_with_hint(tag::MaturityMonthYear, i));
+    visit(*i, v);
+    BOOST_CHECK_EQUAL(v.kind, "monthyear");
+    BOOST_CHECK_EQUAL(v.t[1], 8);
+
+    BOOST_REQUIRE(r.find_with_hint(tag::ExpireDate, i));
+    visit(*i, v);
+    BOOST_CHECK_EQUAL(v.kind, "date");
+    BOOST_CHECK_EQUAL(v.t[2], 10);
+
+    BOOST_REQUIRE(r.find_with_hint(tag::ExpireTime, i));
+    visit(*i, v);
+    BOOST_CHECK_EQUAL(v.kind, "string:bogus");
+
+    BOOST_REQUIRE(r.find_with_hint(tag::MDEntryTime, i));
+    visit(*i, v);
+    BOOST_CHECK_EQUAL(v.kind, "timeonly");
+    BOOST_CHECK_EQUAL(v.t[6], 789456123);
+
+    BOOST_REQUIRE(r.find_with_hint(9999, i));
+    visit(*i, v);
+    BOOST_CHECK_EQUAL(v.kind, "string:x");
+
+    // Numbers which can't be converted.
+    BOOST_REQUIRE(r.find_with_hint(tag::OrderQty, i));
+    visit(*i, v);
+    BOOST_CHECK_EQUAL(v.kind, "string:1.5.0");
+    BOOST_REQUIRE(r.find_with_hint(tag::MsgSeqNum, i));
+    visit(*i, v);
+    BOOST_CHECK_EQUAL(v.kind, "string:abc");
+}
+
 #endif
 
 #if __cplusplus >= 201703L
@@ -0,0 +1,787 @@
+#include <hffix.hpp>
+
+#include <iostream>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <stdint.h>
+#include <fcntl.h>    // for open()
+#include <pthread.h>  // for pthread_create()
+#include <unistd.h>   // for read(), sysconf()
+#include <sys/mman.h> // for mmap()
+#include <sys/stat.h> // for fstat(), mkdir()
+#include <sys/time.h> // for gettimeofday()
+
+/*
+Converts a FIX log into column files for analytics.
+
+The log is framed in parallel: it is split into one chunk per thread, and each
+thread frames the messages which begin in its chunk, starting from the first
+"8=FIX" in the chunk. A thread which starts inside a message finds only
+invalid messages until it reaches the next real one, so the chunks are merged
+in order, dropping messages which begin before the end of the last message of
+the previous chunk. The framing is the same as reading the log sequentially.
+
+The messages are then converted in log order into one table per MsgType, with
+one column per selected tag. Each column is written to its own file,
+DIR/<MsgType>/<tag>.col, with an encoding chosen from the FIX data type of the
+tag in hffix_fields.hpp:
+
+    int64      Int, SeqNum, Length, NumInGroup, TagNum.
+    decimal    Float, Qty, Price, PriceOffset, Amt, Percentage, as an int64
+               mantissa and an int8 exponent.
+    timestamp  UTCTimestamp, as int64 nanoseconds since 1970-01-01.
+    string     Data and XMLData.
+    dictionary Every other type, and tags not in the dictionary, as a uint32
+               code into DIR/<MsgType>/<tag>.dict.
+
+Messages with a wrong CheckSum are skipped as invalid, because the fields of
+a corrupted message can't be iterated safely. A value which does not parse as
+its type is null. If a tag occurs more than once in a message, as in a
+repeating group, only the first value is kept. Row i of every column of a MsgType is the i-th message of that type in the log.
+DIR/<MsgType>/columns.txt lists the columns and the number of rows.
+
+All integers are little-endian. A .col file has a 24 byte header,
+
+    char     magic[8]  "HFFIXCOL"
+    uint32   version   1
+    uint32   tag
+    uint32   encoding  0 int64, 1 decimal, 2 timestamp, 3 dictionary, 4 string
+    uint32   rows      maximum rows in a row group
+
+followed by row groups. Each row group has a 32 byte header,
+
+    uint32   rows
+    uint32   nulls
+    uint64   size      of the row group after this header
+    int64    base
+    uint32   width     1, 2, 4 or 8
+    uint32   reserved  0
+
+followed by sections, each padded with zeros to a multiple of 8 bytes,
+
+    uint8    present[(rows + 7) / 8]  bit i % 8 of byte i / 8 is set if row i is not null
+    uint     delta[rows]              int64, decimal mantissa, timestamp and dictionary code
+    int8     exponent[rows]           decimal
+    uint32   end[rows]                string, offset of the end of each value in bytes
+    char     bytes[]                  string
+
+Each value is base plus its delta, an unsigned integer of width bytes, which is
+the smallest width for the range of the values in the row group. Null rows have
+delta 0, exponent 0 and an empty string. A row group which is all nulls has
+size 0 and no sections, so sparse columns are small.
+
+A .dict file is "HFFIXDIC", a uint32 count, and then for each code a uint32
+length and the bytes.
+*/
+
+namespace {
+
+// Larger tags are ignored.
+int const max_tag = 999999;
+
+enum encoding { enc_int64, enc_decimal, enc_timestamp, enc_dictionary, enc_string };
+
+char const* const encoding_names[] = { "int64", "decimal", "timestamp", "dictionary", "string" };
+
+encoding encoding_of(int tag) {
+    switch (hffix::field_type_of(tag)) {
+    case hffix::field_type::Int:
+    case hffix::field_type::SeqNum:
+    case hffix::field_type::Length:
+    case hffix::field_type::NumInGroup:
+    case hffix::field_type::TagNum:
+        return enc_int64;
+    case hffix::field_type::Float:
+    case hffix::field_type::Qty:
+    case hffix::field_type::Price:
+    case hffix::field_type::PriceOffset:
+    case hffix::field_type::Amt:
+    case hffix::field_type::Percentage:
+        return enc_decimal;
+    case hffix::field_type::UTCTimestamp:
+        return enc_timestamp;
+    case hffix::field_type::Data:
+    case hffix::field_type::XMLData:
+        return enc_string;
+    default:
+        return enc_dictionary;
+    }
+}
+
+// Days from 1970-01-01 in the proleptic Gregorian calendar,
+// from http://howardhinnant.github.io/date_algorithms.html
+int64_t days_from_civil(int y, int m, int d) {
+    y -= m <= 2;
+    int64_t const era = (y >= 0 ? y : y - 399) / 400;
+    unsigned const yoe = unsigned(y - era * 400);
+    unsigned const doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+    unsigned const doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + int64_t(doe) - 719468;
+}
+
+// True if [b, e) is an optional '-' and 1 to 18 digits, with at most one '.'
+// if decimal is true.
+bool is_number(char const* b, char const* e, bool decimal) {
+    if (b < e && *b == '-') ++b;
+    int digits = 0;
+    bool point = false;
+    for (; b < e; ++b) {
+        if (*b >= '0' && *b <= '9') ++digits;
+        else if (*b == '.' && decimal && !point) point = true;
+        else return false;
+    }
+    return digits > 0 && digits <= 18;
+}
+
+// Little-endian output, appended to a byte vector.
+class byte_writer {
+public:
+    explicit byte_writer(std::vector<char>& v) : v_(v) {}
+
+    template <typename Uint> void put(Uint x, size_t size) {
+        for (size_t i = 0; i < size; ++i) v_.push_back(char(uint64_t(x) >> (8 * i)));
+    }
+    void put32(uint32_t x) { put(x, 4); }
+    void put64(uint64_t x) { put(x, 8); }
+    void put_bytes(char const* b, size_t n) { v_.insert(v_.end(), b, b + n); }
+    void pad() { while (v_.size() % 8) v_.push_back('\0'); }
+
+private:
+    std::vector<char>& v_;
+};
+
+bool write_file(std::string const& path, std::vector<char> const& bytes, bool append) {
+    std::FILE* f = std::fopen(path.c_str(), append ? "ab" : "wb");
+    if (!f) {
+        std::perror(path.c_str());
+        return false;
+    }
+    bool const ok = bytes.empty() || std::fwrite(&bytes[0], 1, bytes.size(), f) == bytes.size();
+    if (std::fclose(f) || !ok) {
+        std::perror(path.c_str());
+        return false;
+    }
+    return true;
+}
+
+/*
+Dictionary of strings to codes, numbered in order of insertion. The strings
+are copied into one buffer, and found by an open addressing hash table of
+codes, so that a lookup does not allocate.
+*/
+class string_dictionary {
+public:
+    string_dictionary() : offsets_(1, 0), slots_(1024, empty) {}
+
+    uint32_t code(char const* b, char const* e) {
+        uint32_t const h = hash(b, e);
+        size_t const mask = slots_.size() - 1;
+        for (size_t i = h & mask; ; i = (i + 1) & mask) {
+            uint32_t const c = slots_[i];
+            if (c == empty) {
+                uint32_t const added = size();
+                bytes_.insert(bytes_.end(), b, e);
+                offsets_.push_back(bytes_.size());
+                hashes_.push_back(h);
+                slots_[i] = added;
+                if (size() * 2 > slots_.size()) grow();
+                return added;
+            }
+            if (hashes_[c] == h && size_t(e - b) == size_t(end(c) - begin(c)) && std::equal(b, e, begin(c)))
+                return c;
+        }
+    }
+
+    uint32_t size() const { return uint32_t(hashes_.size()); }
+    char const* begin(uint32_t c) const { return bytes_.empty() ? 0 : &bytes_[0] + offsets_[c]; }
+    char const* end(uint32_t c) const { return bytes_.empty() ? 0 : &bytes_[0] + offsets_[c + 1]; }
+
+private:
+    enum { empty = 0xffffffffu };
+
+    // FNV-1a.
+    static uint32_t hash(char const* b, char const* e) {
+        uint32_t h = 2166136261u;
+        for (; b < e; ++b) h = (h ^ static_cast<unsigned char>(*b)) * 16777619u;
+        return h;
+    }
+
+    void grow() {
+        slots_.assign(slots_.size() * 2, empty);
+        size_t const mask = slots_.size() - 1;
+        for (uint32_t c = 0; c < size(); ++c) {
+            size_t i = hashes_[c] & mask;
+            while (slots_[i] != empty) i = (i + 1) & mask;
+            slots_[i] = c;
+        }
+    }
+
+    std::vector<char> bytes_;
+    std::vector<size_t> offsets_;   // Of each string in bytes_, and of the end.
+    std::vector<uint32_t> hashes_;  // Of each string.
+    std::vector<uint32_t> slots_;   // Codes, or empty.
+};
+
+/*
+One column of a table. The values which are set are buffered for one row
+group, with their rows, so that a sparse column costs only its values, and
+the row group is expanded with nulls and appended to the column file when it
+is full.
+*/
+class column {
+public:
+    column(int tag, std::string const& path) :
+        tag_(tag), encoding_(encoding_of(tag)), path_(path), total_rows_(0) {}
+
+    int tag() const { return tag_; }
+    encoding kind() const { return encoding_; }
+    size_t rows() const { return total_rows_; }
+
+    bool write_header(uint32_t group_rows) {
+        std::vector<char> v;
+        byte_writer w(v);
+        w.put_bytes("HFFIXCOL", 8);
+        w.put32(1);
+        w.put32(uint32_t(tag_));
+        w.put32(uint32_t(encoding_));
+        w.put32(group_rows);
+        return write_file(path_ + ".col", v, false);
+    }
+
+    // Set the value of this column for the row, if it is not already set.
+    void set(uint32_t row, hffix::field_value const& v) {
+        if (!rows_.empty() && rows_.back() == row) return;
+        char const* const b = v.begin();
+        char const* const e = v.end();
+        bool present = true;
+        switch (encoding_) {
+        case enc_int64:
+            present = is_number(b, e, false);
+            values_.push_back(present ? v.as_int<int64_t>() : 0);
+            break;
+        case enc_decimal: {
+            int64_t mantissa = 0, exponent = 0;
+            present = is_number(b, e, true);
+            if (present) v.as_decimal(mantissa, exponent);
+            values_.push_back(mantissa);
+            exponents_.push_back(char(exponent));
+            break;
+        }
+        case enc_timestamp: {
+            int year, month, day, hour, minute, second, nanosecond;
+            present = v.as_timestamp_nano(year, month, day, hour, minute, second, nanosecond);
+            values_.push_back(present
+                ? ((days_from_civil(year, month, day) * 24 + hour) * 60 + minute) * 60 * 1000000000ll
+                  + second * 1000000000ll + nanosecond
+                : 0);
+            break;
+        }
+        case enc_dictionary:
+            values_.push_back(dictionary_.code(b, e));
+            break;
+        case enc_string:
+            bytes_.insert(bytes_.end(), b, e);
+            values_.push_back(int64_t(bytes_.size()));
+            break;
+        }
+        rows_.push_back(row);
+        present_.push_back(present);
+    }
+
+    // Finish the row group at rows rows, and append it to the column file.
+    bool flush(size_t rows) {
+        if (!rows) return true;
+        std::vector<char> v;
+        byte_writer h(v);
+        size_t nulls = rows;
+        for (size_t k = 0; k < present_.size(); ++k) nulls -= present_[k];
+        int64_t base = 0;
+        size_t width = encoding_ == enc_string ? 4 : 1;
+
+        if (nulls == rows) { // The row group is all nulls, without sections.
+            h.put32(uint32_t(rows));
+            h.put32(uint32_t(rows));
+            h.put64(0);
+            h.put64(0);
+            h.put32(1);
+            h.put32(0);
+        } else {
+            std::vector<char> body;
+            byte_writer w(body);
+            std::vector<unsigned char> bitmap((rows + 7) / 8, 0);
+            for (size_t k = 0; k < rows_.size(); ++k)
+                if (present_[k]) bitmap[rows_[k] / 8] |= 1 << (rows_[k] % 8);
+            w.put_bytes(reinterpret_cast<char const*>(&bitmap[0]), bitmap.size());
+            w.pad();
+
+            if (encoding_ == enc_string) {
+                // The end of a null row is the end of the row before.
+                uint32_t end = 0;
+                for (size_t i = 0, k = 0; i < rows; ++i) {
+                    if (k < rows_.size() && rows_[k] == i) end = uint32_t(values_[k++]);
+                    w.put32(end);
+                }
+                w.pad();
+                if (!bytes_.empty()) w.put_bytes(&bytes_[0], bytes_.size());
+                w.pad();
+            } else {
+                // Frame of reference: the smallest width for the range of the present values.
+                bool first = true;
+                int64_t max = 0;
+                for (size_t k = 0; k < rows_.size(); ++k) {
+                    if (!present_[k]) continue;
+                    if (first || values_[k] < base) base = values_[k];
+                    if (first || values_[k] > max) max = values_[k];
+                    first = false;
+                }
+                uint64_t const range = uint64_t(max) - uint64_t(base);
+                width = range >> 32 ? 8 : range >> 16 ? 4 : range >> 8 ? 2 : 1;
+                size_t const deltas = body.size();
+                body.resize(deltas + rows * width, 0); // The deltas of nulls are 0.
+                for (size_t k = 0; k < rows_.size(); ++k)
+                    if (present_[k]) put_at(&body[deltas + rows_[k] * width], uint64_t(values_[k]) - uint64_t(base), width);
+                w.pad();
+                if (encoding_ == enc_decimal) {
+                    size_t const exponents = body.size();
+                    body.resize(exponents + rows, 0);
+                    for (size_t k = 0; k < rows_.size(); ++k) body[exponents + rows_[k]] = exponents_[k];
+                    w.pad();
+                }
+            }
+            h.put32(uint32_t(rows));
+            h.put32(uint32_t(nulls));
+            h.put64(body.size());
+            h.put64(uint64_t(base));
+            h.put32(uint32_t(width));
+            h.put32(0);
+            v.insert(v.end(), body.begin(), body.end());
+        }
+
+        total_rows_ += rows;
+        rows_.clear();
+        present_.clear();
+        values_.clear();
+        exponents_.clear();
+        bytes_.clear();
+        return write_file(path_ + ".col", v, true);
+    }
+
+    bool write_dictionary() const {
+        if (encoding_ != enc_dictionary) return true;
+        std::vector<char> v;
+        byte_writer w(v);
+        w.put_bytes("HFFIXDIC", 8);
+        w.put32(uint32_t(dictionary_.size()));
+        for (uint32_t i = 0; i < dictionary_.size(); ++i) {
+            w.put32(uint32_t(dictionary_.end(i) - dictionary_.begin(i)));
+            w.put_bytes(dictionary_.begin(i), dictionary_.end(i) - dictionary_.begin(i));
+        }
+        return write_file(path_ + ".dict", v, false);
+    }
+
+private:
+    // Little-endian, like byte_writer::put.
+    static void put_at(char* p, uint64_t x, size_t size) {
+        for (size_t i = 0; i < size; ++i) p[i] = char(x >> (8 * i));
+    }
+
+    int tag_;
+    encoding encoding_;
+    std::string path_;      // Without the .col or .dict extension.
+    size_t total_rows_;     // In all row groups flushed.
+    // For each value set in the row group:
+    std::vector<uint32_t> rows_;
+    std::vector<unsigned char> present_; // 0 if the value could not be parsed, which is a null.
+    std::vector<int64_t> values_;        // Or end in bytes_ for strings.
+    std::vector<char> exponents_;
+    std::vector<char> bytes_;
+    string_dictionary dictionary_;
+};
+
+// The columns of one MsgType.
+class table {
+public:
+    table(std::string const& dir, std::vector<int> const& tags, uint32_t group_rows) :
+        dir_(dir), group_rows_(group_rows), rows_(0) {
+            for (size_t i = 0; i < tags.size(); ++i) {
+            char name[16];
+            std::sprintf(name, "/%d", tags[i]);
+            if (size_t(tags[i]) >= index_.size()) index_.resize(tags[i] + 1, -1);
+            index_[tags[i]] = int(columns_.size());
+            columns_.push_back(column(tags[i], dir + name));
+        }
+    }
+
+    bool write_headers() {
+        for (size_t i = 0; i < columns_.size(); ++i)
+            if (!columns_[i].write_header(group_rows_)) return false;
+        return true;
+    }
+
+    bool add(hffix::message_reader const& reader) {
+        for (hffix::message_reader::const_iterator i = reader.begin(); i != reader.end(); ++i) {
+            int const tag = i->tag();
+            if (tag >= 0 && size_t(tag) < index_.size() && index_[tag] >= 0)
+                columns_[index_[tag]].set(uint32_t(rows_), i->value());
+        }
+        if (++rows_ == group_rows_) return flush();
+        return true;
+    }
+
+    bool finish() {
+        if (!flush()) return false;
+        std::string manifest;
+        char line[128];
+        for (size_t i = 0; i < columns_.size(); ++i) {
+            if (!columns_[i].write_dictionary()) return false;
+            char const* const name = hffix::dictionary_field_name(columns_[i].tag());
+            std::sprintf(line, "%d %s %s\n", columns_[i].tag(), name ? name : "-", encoding_names[columns_[i].kind()]);
+            manifest += line;
+        }
+        std::sprintf(line, "rows %lu\n", (unsigned long)(columns_.empty() ? 0 : columns_[0].rows()));
+        manifest = line + manifest;
+        return write_file(dir_ + "/columns.txt", std::vector<char>(manifest.begin(), manifest.end()), false);
+    }
+
+    size_t column_count() const {
+        return columns_.size();
+    }
+
+private:
+    bool flush() {
+        for (size_t i = 0; i < columns_.size(); ++i)
+            if (!columns_[i].flush(rows_)) return false;
+        rows_ = 0;
+        return true;
+    }
+
+    std::string dir_;
+    uint32_t group_rows_;
+    size_t rows_;               // In the row group.
+    std::vector<int> index_;    // Column index by tag, or -1.
+    std::vector<column> columns_;
+};
+
+struct options {
+    options() : output(0), group_rows(65536), threads(0), stats(false) {}
+
+    char const* output;
+    std::vector<std::string> msgtypes;
+    std::vector<int> tags;
+    uint32_t group_rows;
+    int threads;
+    bool stats;
+
+    bool is_selected(hffix::field_value const& msgtype) const {
+        if (msgtypes.empty()) return true;
+        for (size_t i = 0; i < msgtypes.size(); ++i)
+            if (msgtype == msgtypes[i]) return true;
+        return false;
+    }
+};
+
+// A framed message, as offsets in the log. Invalid messages have no end.
+struct framed {
+    size_t begin;
+    size_t end;
+    bool valid;
+};
+
+// The framing of one chunk of the log by one thread.
+struct chunk {
+    char const* log_begin;
+    char const* log_end;
+    char const* begin;  // Frame the messages which begin in [begin, end).
+    char const* end;
+    options const* o;
+    std::vector<framed> messages;
+    std::map<std::string, std::vector<bool> > tags_seen; // By MsgType, if there is no --fields.
+};
+
+char const* find_message(char const* b, char const* e) {
+    char const* const found = static_cast<char const*>(memmem(b, e - b, "8=FIX", 5));
+    return found ? found : e;
+}
+
+void* frame_chunk(void* arg) {
+    chunk& c = *static_cast<chunk*>(arg);
+    for (char const* p = find_message(c.begin, c.log_end); p < c.end; ) {
+        hffix::message_reader reader(p, c.log_end);
+        framed f = { size_t(p - c.log_begin), 0, reader.is_complete() && reader.is_valid()
+            && reader.calculate_check_sum() == reader.check_sum()->value().as_int<int>() };
+        if (!f.valid) {
+            c.messages.push_back(f);
+            p = find_message(p + 1, c.log_end);
+            continue;
+        }
+        f.end = reader.message_end() - c.log_begin;
+        c.messages.push_back(f);
+        p = find_message(reader.message_end(), c.log_end);
+        if (!c.o->tags.empty() || !c.o->is_selected(reader.message_type()->value())) continue;
+        std::vector<bool>& seen = c.tags_seen[reader.message_type()->value().as_string()];
+        for (hffix::message_reader::const_iterator i = reader.begin(); i != reader.end(); ++i) {
+            int const tag = i->tag();
+            if (tag <= 0 || tag > max_tag) continue;
+            if (size_t(tag) >= seen.size()) seen.resize(tag + 1);
+            seen[tag] = true;
+        }
+    }
+    return 0;
+}
+
+bool is_directory_name(std::string const& s) {
+    if (s.empty()) return false;
+    for (size_t i = 0; i < s.size(); ++i)
+        if (!((s[i] >= '0' && s[i] <= '9') || (s[i] >= 'A' && s[i] <= 'Z') || (s[i] >= 'a' && s[i] <= 'z'))) return false;
+    return true;
+}
+
+bool make_directory(std::string const& path) {
+    if (::mkdir(path.c_str(), 0777) && errno != EEXIST) {
+        std::perror(path.c_str());
+        return false;
+    }
+    return true;
+}
+
+// Parse a comma-separated list.
+std::vector<std::string> split(char const* arg) {
+    std::vector<std::string> items;
+    for (char const* b = arg; *b; ) {
+        char const* e = std::strchr(b, ',');
+        if (!e) e = b + std::strlen(b);
+        if (e > b) items.push_back(std::string(b, e));
+        b = *e ? e + 1 : e;
+    }
+    return items;
+}
+
+double now_seconds() {
+    timeval tv;
+    gettimeofday(&tv, 0);
+    return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    options o;
+    char const* input = 0;
+
+    for (int a = 1; a < argc; ++a) {
+        bool const has_arg = a + 1 < argc;
+        if ((0 == std::strcmp("-h", argv[a])) || (0 == std::strcmp("--help", argv[a]))) {
+            std::cout <<
+                "fixcolumns [Options] -o DIR [FILE]\n\n"
+                "Reads a FIX log from FILE, or from stdin, and writes one column file for each\n"
+                "selected tag of each MsgType to DIR/<MsgType>/<tag>.col. The encoding of each\n"
+                "column is chosen from the FIX data type of its tag: int64, decimal as mantissa\n"
+                "and exponent, timestamp as nanoseconds since the epoch, binary data as strings,\n"
+                "and every other type as dictionary-encoded strings. The file format is\n"
+                "described in util/src/fixcolumns.cpp.\n\n"
+                "Options:\n"
+                "  -o --output DIR          Output directory. Required.\n"
+                "  -m --msgtype V[,V...]    Convert only messages with one of these MsgType values.\n"
+                "  -f --fields TAG[,TAG...] Columns for only these tags. Default is every tag in\n"
+                "                           the messages of each MsgType, except BeginString,\n"
+                "                           BodyLength, MsgType and CheckSum.\n"
+                "  -r --rows N              Rows in a row group. Default 65536.\n"
+                "  -j --threads N           Threads for framing. Default is the number of CPUs.\n"
+                "     --stats               Report throughput to stderr when finished.\n\n";
+            exit(0);
+        }
+        else if (has_arg && (0 == std::strcmp("-o", argv[a]) || 0 == std::strcmp("--output", argv[a])))
+            o.output = argv[++a];
+        else if (has_arg && (0 == std::strcmp("-m", argv[a]) || 0 == std::strcmp("--msgtype", argv[a]))) {
+            std::vector<std::string> const values = split(argv[++a]);
+            if (values.empty()) {
+                std::cerr << "fixcolumns: bad --msgtype " << argv[a] << '\n';
+                exit(2);
+            }
+            o.msgtypes.insert(o.msgtypes.end(), values.begin(), values.end());
+        }
+        else if (has_arg && (0 == std::strcmp("-f", argv[a]) || 0 == std::strcmp("--fields", argv[a]))) {
+            std::vector<std::string> const tags = split(argv[++a]);
+            for (size_t i = 0; i < tags.size(); ++i) {
+                if (tags[i].find_first_not_of("0123456789") != std::string::npos || tags[i].size() > 6) {
+                    std::cerr << "fixcolumns: bad --fields " << argv[a] << '\n';
+                    exit(2);
+                }
+                int const tag = std::atoi(tags[i].c_str());
+                if (std::find(o.tags.begin(), o.tags.end(), tag) == o.tags.end()) o.tags.push_back(tag);
+            }
+            if (o.tags.empty()) {
+                std::cerr << "fixcolumns: bad --fields " << argv[a] << '\n';
+                exit(2);
+            }
+        }
+        else if (has_arg && (0 == std::strcmp("-r", argv[a]) || 0 == std::strcmp("--rows", argv[a])))
+            o.group_rows = uint32_t(std::max(1ul, std::strtoul(argv[++a], 0, 10)));
+        else if (has_arg && (0 == std::strcmp("-j", argv[a]) || 0 == std::strcmp("--threads", argv[a])))
+            o.threads = std::max(1, std::atoi(argv[++a]));
+        else if (0 == std::strcmp("--stats", argv[a]))
+            o.stats = true;
+        else if (argv[a][0] != '-' && !input)
+            input = argv[a];
+        else {
+            std::cerr << "fixcolumns: unknown option " << argv[a] << '\n';
+            exit(2);
+        }
+    }
+    if (!o.output) {
+        std::cerr << "fixcolumns: --output is required\n";
+        exit(2);
+    }
+    if (!o.threads) o.threads = int(std::max(1l, ::sysconf(_SC_NPROCESSORS_ONLN)));
+
+    double const time_start = now_seconds();
+
+    // Map the input file, or read stdin.
+    char const* log = 0;
+    size_t log_size = 0;
+    std::vector<char> stdin_log;
+    if (input) {
+        int const fd = ::open(input, O_RDONLY);
+        struct stat st;
+        if (fd < 0 || ::fstat(fd, &st)) {
+            std::perror(input);
+            return 1;
+        }
+        log_size = st.st_size;
+        if (log_size) {
+            void* const m = ::mmap(0, log_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (m == MAP_FAILED) {
+                std::perror(input);
+                return 1;
+            }
+            log = static_cast<char const*>(m);
+        }
+        ::close(fd);
+    } else {
+        char block[1 << 16];
+        ssize_t fred;
+        while ((fred = ::read(0, block, sizeof(block)))) {
+            if (fred < 0) {
+                if (errno == EINTR) continue;
+                std::perror("fixcolumns read");
+                return 1;
+            }
+            stdin_log.insert(stdin_log.end(), block, block + fred);
+        }
+        log_size = stdin_log.size();
+        if (log_size) log = &stdin_log[0];
+    }
+
+    // Frame the chunks in parallel.
+    size_t const chunk_count = std::max(size_t(1), std::min(size_t(o.threads), log_size / (1 << 16)));
+    std::vector<chunk> chunks(chunk_count);
+    std::vector<pthread_t> threads(chunk_count);
+    for (size_t i = 0; i < chunk_count; ++i) {
+        chunk& c = chunks[i];
+        c.log_begin = log;
+        c.log_end = log + log_size;
+        c.begin = log + log_size / chunk_count * i;
+        c.end = i + 1 == chunk_count ? c.log_end : log + log_size / chunk_count * (i + 1);
+        c.o = &o;
+        if (i && ::pthread_create(&threads[i], 0, frame_chunk, &c)) {
+            std::perror("fixcolumns pthread_create");
+            return 1;
+        }
+    }
+    frame_chunk(&chunks[0]);
+    for (size_t i = 1; i < chunk_count; ++i) ::pthread_join(threads[i], 0);
+    double const time_framed = now_seconds();
+
+    // Choose the columns of each MsgType.
+    std::map<std::string, std::vector<int> > columns;
+    for (size_t i = 0; i < chunk_count; ++i) {
+        for (std::map<std::string, std::vector<bool> >::const_iterator t = chunks[i].tags_seen.begin(); t != chunks[i].tags_seen.end(); ++t) {
+            std::vector<int>& tags = columns[t->first];
+            for (size_t tag = 0; tag < t->second.size(); ++tag) {
+                if (!t->second[tag] || tag == size_t(hffix::tag::BeginString) || tag == size_t(hffix::tag::BodyLength)
+                    || tag == size_t(hffix::tag::MsgType) || tag == size_t(hffix::tag::CheckSum)) continue;
+                tags.push_back(int(tag));
+            }
+        }
+    }
+    for (std::map<std::string, std::vector<int> >::iterator t = columns.begin(); t != columns.end(); ++t) {
+        std::sort(t->second.begin(), t->second.end());
+        t->second.erase(std::unique(t->second.begin(), t->second.end()), t->second.end());
+    }
+
+    // Convert the messages in log order.
+    if (!make_directory(o.output)) return 1;
+    std::map<std::string, table*> tables;
+    table* last_table = 0;
+    std::string last_msgtype;
+    size_t messages = 0, invalid = 0, skipped = 0;
+    size_t next = 0; // Offset of the end of the last message.
+    for (size_t i = 0; i < chunk_count; ++i) {
+        for (size_t m = 0; m < chunks[i].messages.size(); ++m) {
+            framed const& f = chunks[i].messages[m];
+            if (f.begin < next) continue; // Framed by the previous chunk.
+            if (!f.valid) {
+                ++invalid;
+                continue;
+            }
+            next = f.end;
+            hffix::message_reader reader(log + f.begin, log + f.end);
+            hffix::field_value const msgtype = reader.message_type()->value();
+            if (!o.is_selected(msgtype)) continue;
+            if (!last_table || msgtype != last_msgtype) {
+                last_msgtype = msgtype.as_string();
+                std::map<std::string, table*>::iterator t = tables.find(last_msgtype);
+                if (t == tables.end()) {
+                    if (!is_directory_name(last_msgtype)) {
+                        last_table = 0;
+                        ++skipped;
+                        continue;
+                    }
+                    std::string const dir = std::string(o.output) + "/" + last_msgtype;
+                    if (!make_directory(dir)) return 1;
+                    t = tables.insert(std::make_pair(last_msgtype, new table(dir, o.tags.empty() ? columns[last_msgtype] : o.tags, o.group_rows))).first;
+                    if (!t->second->write_headers()) return 1;
+                }
+                last_table = t->second;
+            }
+            if (!last_table->add(reader)) return 1;
+            ++messages;
+        }
+    }
+
+    size_t column_count = 0;
+    for (std::map<std::string, table*>::iterator t = tables.begin(); t != tables.end(); ++t) {
+        if (!t->second->finish()) return 1;
+        column_count += t->second->column_count();
+        delete t->second;
+    }
+
+    if (invalid) std::cerr << "fixcolumns: " << invalid << " invalid messages skipped\n";
+    if (skipped) std::cerr << "fixcolumns: " << skipped << " messages with unusual MsgType values skipped\n";
+
+    if (o.stats) {
+        double const time_end = now_seconds();
+        double const seconds = std::max(time_end - time_start, 1e-9);
+        std::fprintf(stderr,
+            "fixcolumns: %lu messages, %lu MsgTypes, %lu columns, %.1f MB read in %.3f s, framed with %lu threads in %.3f s: %.1f MB/s, %.0f messages/s\n",
+            (unsigned long)messages,
+            (unsigned long)tables.size(),
+            (unsigned long)column_count,
+            log_size / 1e6,
+            seconds,
+            (unsigned long)chunk_count,
+            time_framed - time_start,
+            log_size / 1e6 / seconds,
+            messages / seconds);
+    }
+    return 0;
+}
@@ -0,0 +1,523 @@
+#include <hffix.hpp>
+#include <hffix_enums.hpp>
+#include <hffix_layouts.hpp>
+
+#include <iostream>
+#include <algorithm>
+#include <numeric>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+#include <unistd.h>   // for write()
+#include <sys/time.h> // for gettimeofday()
+
+/*
+Synthetic FIX message generator for benchmarks and stress tests.
+
+Message bodies are generated by walking the hffix::layout of each message type
+from hffix_layouts.hpp, choosing which optional fields, components and
+repeating groups to include, and writing random values of the right FIX data
+type with hffix::message_writer. Fields with enumerated values in
+hffix_enums.hpp get one of the enumerated values.
+
+Generating a body is much slower than writing it out, so a fixed number of
+distinct bodies, the templates, is generated for each message type before any
+output. Each output message gets a fresh header with the next MsgSeqNum and
+SendingTime, a template body copied with push_back_fields(), and a trailer, and
+is then optionally corrupted. The byte sum of each template body is computed
+once, so the CheckSum of each message only needs the sum of its header.
+*/
+
+namespace {
+
+// xorshift64* pseudo-random number generator. Deterministic for a seed, so
+// that a corpus can be regenerated exactly.
+class xorshift {
+public:
+    explicit xorshift(uint64_t seed) : state_(seed ? seed : 0x9e3779b97f4a7c15ull) {}
+
+    uint64_t next() {
+        state_ ^= state_ >> 12;
+        state_ ^= state_ << 25;
+        state_ ^= state_ >> 27;
+        return state_ * 0x2545f4914f6cdd1dull;
+    }
+
+    // Uniform in [0, n). n must be greater than 0.
+    uint32_t below(uint32_t n) {
+        return uint32_t((next() >> 32) * n >> 32);
+    }
+
+    // Uniform in [lo, hi].
+    int between(int lo, int hi) {
+        return lo + int(below(uint32_t(hi - lo + 1)));
+    }
+
+    // True with probability p.
+    bool chance(double p) {
+        return double(next() >> 11) * (1.0 / 9007199254740992.0) < p;
+    }
+
+private:
+    uint64_t state_;
+};
+
+struct options {
+    options() :
+        count(1000000),
+        seed(1),
+        begin_string("FIX.4.4"),
+        sender("SENDER"),
+        target("TARGET"),
+        optional(0.1),
+        max_groups(3),
+        max_depth(2),
+        min_length(1),
+        max_length(16),
+        templates(256),
+        corrupt(0.0),
+        stats(false)
+    {}
+
+    size_t count;
+    uint64_t seed;
+    char const* begin_string;
+    char const* sender;
+    char const* target;
+    double optional;   // Probability of each optional field, component or group.
+    int max_groups;    // Maximum NumInGroup count.
+    int max_depth;     // Maximum repeating group nesting depth.
+    int min_length;    // String and data value length range.
+    int max_length;
+    size_t templates;  // Distinct bodies per message type.
+    double corrupt;    // Probability of corrupting each message.
+    bool stats;
+};
+
+/*
+Writes random message bodies according to the FIX Repository layouts.
+*/
+class body_generator {
+public:
+    body_generator(options const& o, xorshift& r) : o_(o), r_(r) {}
+
+    // Write the body of one message of this type, after the header.
+    // Throws std::out_of_range if the writer buffer is too small.
+    void generate(hffix::message_writer& w, hffix::msg_type_index::type index) {
+        walk(w, hffix::message_layout(index), 0, false);
+    }
+
+private:
+    // Write the entries of a layout. If force_first, the first entry is
+    // written even if it is optional, because it is the delimiter of a
+    // repeating group instance.
+    void walk(hffix::message_writer& w, hffix::layout const& l, int depth, bool force_first) {
+        hffix::layout_entry const* const begin = hffix::layout_begin(l);
+        hffix::layout_entry const* const end = hffix::layout_end(l);
+        for (hffix::layout_entry const* e = begin; e != end; ++e) {
+            bool const forced = e->required || (force_first && e == begin);
+
+            if (e->component < 0) { // Field
+                if (!forced && !r_.chance(o_.optional)) {
+                    // A data field is never written without its Length field.
+                    if (is_data_length(e, end)) ++e;
+                    continue;
+                }
+                if (is_data_length(e, end)) {
+                    push_back_data(w, e->tag, (e + 1)->tag);
+                    ++e;
+                } else {
+                    push_back_value(w, e->tag);
+                }
+            } else if (e->tag == 0) { // Component
+                if (forced || r_.chance(o_.optional))
+                    walk(w, hffix::component_layout(e->component), depth, forced);
+            } else { // Repeating group
+                if (depth >= o_.max_depth && !forced) continue;
+                if (!forced && !r_.chance(o_.optional)) continue;
+                int const n = depth >= o_.max_depth ? 1 : r_.between(1, o_.max_groups);
+                w.push_back_int(e->tag, n);
+                for (int i = 0; i < n; ++i)
+                    walk(w, hffix::component_layout(e->component), depth + 1, true);
+            }
+        }
+    }
+
+    // True if this is a Length field followed by its data field.
+    static bool is_data_length(hffix::layout_entry const* e, hffix::layout_entry const* end) {
+        if (e + 1 == end || (e + 1)->component >= 0) return false;
+        if (hffix::field_type_of(e->tag) != hffix::field_type::Length) return false;
+        hffix::field_type::type const t = hffix::field_type_of((e + 1)->tag);
+        return t == hffix::field_type::Data || t == hffix::field_type::XMLData;
+    }
+
+    void push_back_data(hffix::message_writer& w, int tag_length, int tag_data) {
+        int const n = r_.between(o_.min_length, o_.max_length);
+        for (int i = 0; i < n; ++i) scratch_[i] = char(r_.below(256)); // Including SOH.
+        w.push_back_data(tag_length, tag_data, scratch_, scratch_ + n);
+    }
+
+    void push_back_string(hffix::message_writer& w, int tag, int length) {
+        static char const alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
+        for (int i = 0; i < length; ++i) scratch_[i] = alphabet[r_.below(sizeof(alphabet) - 1)];
+        w.push_back_string(tag, scratch_, scratch_ + length);
+    }
+
+    void push_back_value(hffix::message_writer& w, int tag) {
+        hffix::enum_dictionary_entry const* eb;
+        hffix::enum_dictionary_entry const* ee;
+        if (hffix::enum_values(tag, eb, ee)) {
+            w.push_back_string(tag, eb[r_.below(uint32_t(ee - eb))].value);
+            return;
+        }
+
+        switch (hffix::field_type_of(tag)) {
+        case hffix::field_type::Int:
+        case hffix::field_type::SeqNum:
+        case hffix::field_type::TagNum:
+            w.push_back_int(tag, r_.between(1, 1000000));
+            break;
+        case hffix::field_type::Length:
+        case hffix::field_type::NumInGroup:
+            w.push_back_int(tag, r_.between(0, 9));
+            break;
+        case hffix::field_type::Float:
+        case hffix::field_type::Qty:
+        case hffix::field_type::Price:
+        case hffix::field_type::PriceOffset:
+        case hffix::field_type::Amt:
+        case hffix::field_type::Percentage:
+            w.push_back_decimal(tag, r_.between(1, 10000000), -r_.between(0, 4));
+            break;
+        case hffix::field_type::Char:
+            w.push_back_char(tag, char('A' + r_.below(26)));
+            break;
+        case hffix::field_type::Boolean:
+            w.push_back_char(tag, r_.below(2) ? 'Y' : 'N');
+            break;
+        case hffix::field_type::Country:
+        case hffix::field_type::Language:
+            push_back_string(w, tag, 2);
+            break;
+        case hffix::field_type::Currency:
+            push_back_string(w, tag, 3);
+            break;
+        case hffix::field_type::Exchange:
+            push_back_string(w, tag, 4);
+            break;
+        case hffix::field_type::MonthYear:
+            w.push_back_monthyear(tag, r_.between(2000, 2040), r_.between(1, 12));
+            break;
+        case hffix::field_type::UTCDateOnly:
+        case hffix::field_type::LocalMktDate:
+            w.push_back_date(tag, r_.between(2000, 2040), r_.between(1, 12), r_.between(1, 28));
+            break;
+        case hffix::field_type::UTCTimeOnly:
+        case hffix::field_type::LocalMktTime:
+        case hffix::field_type::TZTimeOnly:
+            w.push_back_timeonly(tag, r_.between(0, 23), r_.between(0, 59), r_.between(0, 59), r_.between(0, 999));
+            break;
+        case hffix::field_type::UTCTimestamp:
+        case hffix::field_type::TZTimestamp:
+            w.push_back_timestamp(tag, r_.between(2000, 2040), r_.between(1, 12), r_.between(1, 28),
+                r_.between(0, 23), r_.between(0, 59), r_.between(0, 59), r_.between(0, 999));
+            break;
+        default:
+            push_back_string(w, tag, r_.between(o_.min_length, o_.max_length));
+            break;
+        }
+    }
+
+    options const& o_;
+    xorshift& r_;
+    char scratch_[1 << 16];
+};
+
+// Output is assembled in this buffer and written to stdout with write(2)
+// whenever less than one message of space remains.
+class output_buffer {
+public:
+    output_buffer(int fd) : fd_(fd), next_(buffer_), bytes_written_(0) {}
+
+    char* begin() { return next_; }
+    char* end() { return buffer_ + sizeof(buffer_); }
+
+    void commit(char* next) {
+        next_ = next;
+    }
+
+    // Call after each message. Flushes if less than reserve bytes remain.
+    void reserve(size_t reserve) {
+        if (size_t(end() - next_) < reserve) flush();
+    }
+
+    void flush() {
+        char const* b = buffer_;
+        while (b < next_) {
+            ssize_t n = ::write(fd_, b, next_ - b);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                std::perror("fixgen write");
+                std::exit(1);
+            }
+            b += n;
+            bytes_written_ += n;
+        }
+        next_ = buffer_;
+    }
+
+    size_t bytes_written() const {
+        return bytes_written_;
+    }
+
+private:
+    int fd_;
+    char buffer_[1 << 22];
+    char* next_;
+    size_t bytes_written_;
+};
+
+output_buffer out(1);
+
+char body_buffer[1 << 16]; // Largest template body.
+
+struct mix_entry {
+    std::string msg_type;
+    hffix::msg_type_index::type index;
+    unsigned int weight;
+    std::vector<std::string> bodies;
+    std::vector<unsigned char> body_sums; // Byte sum of each body, modulo 256.
+};
+
+// Parse "T:W[,T:W...]".
+bool parse_mix(char const* arg, std::vector<mix_entry>& mix) {
+    mix.clear();
+    for (char const* b = arg; *b; ) {
+        char const* e = std::strchr(b, ',');
+        if (!e) e = b + std::strlen(b);
+        char const* colon = static_cast<char const*>(std::memchr(b, ':', e - b));
+        if (!colon || colon == b) return false;
+        mix_entry m;
+        m.msg_type.assign(b, colon);
+        m.index = hffix::msg_type_to_index(b, colon);
+        if (m.index == hffix::msg_type_index::unknown) return false;
+        m.weight = std::strtoul(colon + 1, 0, 10);
+        if (m.weight == 0) return false;
+        mix.push_back(m);
+        b = *e ? e + 1 : e;
+    }
+    return !mix.empty();
+}
+
+// Parse "MIN:MAX".
+bool parse_range(char const* arg, int& lo, int& hi) {
+    char* colon;
+    lo = std::strtol(arg, &colon, 10);
+    if (*colon != ':') return false;
+    hi = std::strtol(colon + 1, 0, 10);
+    return 0 <= lo && lo <= hi && hi <= int(sizeof(body_buffer) / 4);
+}
+
+// Damage a complete message in [begin, end) in one of several ways, and
+// return the new end.
+char* corrupt(char* begin, char* end, xorshift& r) {
+    switch (r.below(5)) {
+    case 0: { // Change one byte after the BodyLength, so the CheckSum is wrong.
+        char* body = static_cast<char*>(std::memchr(begin, '\x01', end - begin)) + 1;
+        body = static_cast<char*>(std::memchr(body, '\x01', end - body)) + 1;
+        char* p = body + r.below(uint32_t(end - 8 - body));
+        *p = (*p == 'X') ? 'Y' : 'X';
+        return end;
+    }
+    case 1: // Change one digit of the CheckSum.
+        end[-2] = end[-2] == '9' ? '0' : end[-2] + 1;
+        return end;
+    case 2: { // Change the first digit of the BodyLength.
+        char* p = static_cast<char*>(std::memchr(begin, '\x01', end - begin)) + 3;
+        *p = *p == '9' ? '1' : *p + 1;
+        return end;
+    }
+    case 3: // Truncate.
+        return begin + r.between(1, int(end - begin) - 1);
+    default: // Replace one SOH with '|'.
+        for (char* p = begin + r.between(0, int(end - begin) - 2); p < end - 1; ++p) {
+            if (*p == '\x01') {
+                *p = '|';
+                break;
+            }
+        }
+        return end;
+    }
+}
+
+double now_seconds() {
+    timeval tv;
+    gettimeofday(&tv, 0);
+    return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    options o;
+    std::vector<mix_entry> mix;
+    parse_mix("D:40,8:40,X:20", mix);
+
+    for (int a = 1; a < argc; ++a) {
+        bool const has_arg = a + 1 < argc;
+        if ((0 == std::strcmp("-h", argv[a])) || (0 == std::strcmp("--help", argv[a]))) {
+            std::cout <<
+                "fixgen [Options]\n\n"
+                "Writes a synthetic stream of FIX messages to stdout, with fields, components and\n"
+                "repeating groups from the FIX Repository layout of each message type.\n\n"
+                "Options:\n"
+                "  -n --count N             Number of messages. Default 1000000.\n"
+                "  -s --seed N              Random seed. The output is the same for the same seed\n"
+                "                           and options. Default 1.\n"
+                "  -m --mix T:W[,T:W...]    MsgType values and their relative weights.\n"
+                "                           Default D:40,8:40,X:20.\n"
+                "  -b --begin-string S      BeginString. Default FIX.4.4.\n"
+                "  -o --optional P          Probability that each optional field, component or\n"
+                "                           repeating group is present. Default 0.1.\n"
+                "  -g --groups N            Maximum NumInGroup count of a repeating group. Default 3.\n"
+                "  -d --depth N             Maximum nesting depth of repeating groups. Default 2.\n"
+                "  -l --length MIN:MAX      Length range of string and data values. Default 1:16.\n"
+                "  -t --templates N         Number of distinct message bodies to generate for each\n"
+                "                           MsgType. Default 256.\n"
+                "  -x --corrupt P           Probability that each message is corrupted, by a wrong\n"
+                "                           CheckSum or BodyLength, truncation, or a missing SOH.\n"
+                "                           Default 0.\n"
+                "     --stats               Report throughput to stderr when finished.\n\n";
+            exit(0);
+        }
+        else if (has_arg && (0 == std::strcmp("-n", argv[a]) || 0 == std::strcmp("--count", argv[a])))
+            o.count = std::strtoul(argv[++a], 0, 10);
+        else if (has_arg && (0 == std::strcmp("-s", argv[a]) || 0 == std::strcmp("--seed", argv[a])))
+            o.seed = std::strtoul(argv[++a], 0, 10);
+        else if (has_arg && (0 == std::strcmp("-m", argv[a]) || 0 == std::strcmp("--mix", argv[a]))) {
+            if (!parse_mix(argv[++a], mix)) {
+                std::cerr << "fixgen: bad --mix " << argv[a] << '\n';
+                exit(2);
+            }
+        }
+        else if (has_arg && (0 == std::strcmp("-b", argv[a]) || 0 == std::strcmp("--begin-string", argv[a])))
+            o.begin_string = argv[++a];
+        else if (has_arg && (0 == std::strcmp("-o", argv[a]) || 0 == std::strcmp("--optional", argv[a])))
+            o.optional = std::strtod(argv[++a], 0);
+        else if (has_arg && (0 == std::strcmp("-g", argv[a]) || 0 == std::strcmp("--groups", argv[a])))
+            o.max_groups = std::max(1, std::atoi(argv[++a]));
+        else if (has_arg && (0 == std::strcmp("-d", argv[a]) || 0 == std::strcmp("--depth", argv[a])))
+            o.max_depth = std::max(0, std::atoi(argv[++a]));
+        else if (has_arg && (0 == std::strcmp("-l", argv[a]) || 0 == std::strcmp("--length", argv[a]))) {
+            if (!parse_range(argv[++a], o.min_length, o.max_length)) {
+                std::cerr << "fixgen: bad --length " << argv[a] << '\n';
+                exit(2);
+            }
+        }
+        else if (has_arg && (0 == std::strcmp("-t", argv[a]) || 0 == std::strcmp("--templates", argv[a])))
+            o.templates = std::max(1ul, std::strtoul(argv[++a], 0, 10));
+        else if (has_arg && (0 == std::strcmp("-x", argv[a]) || 0 == std::strcmp("--corrupt", argv[a])))
+            o.corrupt = std::strtod(argv[++a], 0);
+        else if (0 == std::strcmp("--stats", argv[a]))
+            o.stats = true;
+        else {
+            std::cerr << "fixgen: unknown option " << argv[a] << '\n';
+            exit(2);
+        }
+    }
+
+    xorshift r(o.seed);
+    body_generator generator(o, r);
+
+    // Generate the template bodies. A body which doesn't fit in body_buffer
+    // is generated again, at most a few times with the same options and then
+    // with no optional entries.
+    size_t max_body = 0;
+    unsigned int total_weight = 0;
+    for (size_t m = 0; m < mix.size(); ++m) {
+        total_weight += mix[m].weight;
+        for (size_t t = 0; t < o.templates; ++t) {
+            double const optional = o.optional;
+            for (int attempt = 0; ; ++attempt) {
+                if (attempt == 8) o.optional = 0.0;
+                try {
+                    hffix::message_writer w(body_buffer, body_buffer + sizeof(body_buffer));
+                    generator.generate(w, mix[m].index);
+                    mix[m].bodies.push_back(std::string(body_buffer, w.message_end()));
+                    mix[m].body_sums.push_back(std::accumulate(body_buffer, w.message_end(), (unsigned char)0));
+                    max_body = std::max(max_body, w.message_size());
+                    break;
+                } catch (std::out_of_range&) {
+                    if (attempt == 8) {
+                        std::cerr << "fixgen: MsgType " << mix[m].msg_type << " body is too large\n";
+                        return 1;
+                    }
+                }
+            }
+            o.optional = optional;
+        }
+    }
+
+    double const time_start = now_seconds();
+    size_t corrupted(0);
+    size_t const reserve = max_body + 256;
+    int millisecond = 0;
+
+    for (size_t seqnum = 1; seqnum <= o.count; ++seqnum) {
+        // Choose the message type by weight, and a template body.
+        unsigned int pick = r.below(total_weight);
+        size_t m = 0;
+        while (pick >= mix[m].weight) pick -= mix[m++].weight;
+        size_t const t = r.below(uint32_t(mix[m].bodies.size()));
+        std::string const& body = mix[m].bodies[t];
+
+        out.reserve(reserve);
+        hffix::message_writer w(out.begin(), out.end());
+        w.push_back_header(o.begin_string);
+        w.push_back_string(hffix::tag::MsgType, mix[m].msg_type);
+        w.push_back_string(hffix::tag::SenderCompID, o.sender);
+        w.push_back_string(hffix::tag::TargetCompID, o.target);
+        w.push_back_int(hffix::tag::MsgSeqNum, seqnum);
+        w.push_back_timestamp(hffix::tag::SendingTime, 2026, 1, 1,
+            millisecond / 3600000, millisecond / 60000 % 60, millisecond / 1000 % 60, millisecond % 1000);
+        char* const header_end = w.message_end();
+        w.push_back_fields(body.data(), body.data() + body.size());
+        w.push_back_trailer(false);
+        millisecond = (millisecond + 1) % 86400000;
+
+        // Write the CheckSum, which is the header sum plus the body sum.
+        char* end = w.message_end();
+        unsigned char const checksum = std::accumulate(out.begin(), header_end, mix[m].body_sums[t]);
+        end[-4] = '0' + checksum / 100;
+        end[-3] = '0' + checksum / 10 % 10;
+        end[-2] = '0' + checksum % 10;
+
+        if (o.corrupt > 0.0 && r.chance(o.corrupt)) {
+            end = corrupt(out.begin(), end, r);
+            ++corrupted;
+        }
+        out.commit(end);
+    }
+    out.flush();
+
+    if (o.stats) {
+        double const seconds = std::max(now_seconds() - time_start, 1e-9);
+        std::fprintf(stderr,
+            "fixgen: %lu messages, %lu corrupted, %lu templates, %.1f MB written in %.3f s: %.1f MB/s, %.0f messages/s\n",
+            (unsigned long)o.count,
+            (unsigned long)corrupted,
+            (unsigned long)(o.templates * mix.size()),
+            out.bytes_written() / 1e6,
+            seconds,
+            out.bytes_written() / 1e6 / seconds,
+            o.count / seconds);
+    }
+    return 0;
+}
@@ -2,91 +2,375 @@
 
 #include <iostream>
 #include <cstdio>
+#include <cstdlib>
 #include <algorithm>
 #include <cstring>
-#include <map>
+#include <cerrno>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <unistd.h>   // for read(), write()
+#include <sys/time.h> // for gettimeofday()
+#include <regex.h>    // for regcomp(), regexec()
 
 const char color_field[]   = "\x1b" "[33m"; // Yellow
 const char color_value[]   = "\x1b" "[37m"; // White
 const char color_msgtype[] = "\x1b" "[32m"; // Green
 const char color_default[] = "\x1b" "[39m"; // Default Foreground
 
-enum { chunksize = 4096 }; // Choose a preferred I/O chunk size.
-
 char buffer[1 << 20]; // Must be larger than the largest FIX message size.
 
-int main(int argc, char** argv)
-{
-    if (argc > 1 && ((0 == std::strcmp("-h", argv[1])) || (0 == std::strcmp("--help", argv[1])))) {
-        std::cout <<
-            "fixprint [Options]\n\n"
-            "Reads raw FIX encoded data from stdin and writes annotated human-readable FIX to stdout.\n\n"
-            "Options:\n"
-            "  -c --color     Color output.\n"
-            "     --no-color  No color output.\n\n";
-        exit(0);
+/*
+Formatted output is assembled in this buffer and written to stdout with
+write(2) whenever it fills past the high-water mark, so that we make one
+syscall per megabyte of output instead of going through std::cout for every
+tag, name and value.
+*/
+class output_buffer {
+public:
+    output_buffer(int fd) : fd_(fd), next_(buffer_), bytes_written_(0) {}
+
+    ~output_buffer() {
+        flush();
+    }
+
+    void put(char const* begin, size_t size) {
+        if (size > size_t(buffer_ + sizeof(buffer_) - next_)) {
+            flush();
+            if (size > sizeof(buffer_)) { // Too big to buffer, write it straight through.
+                write_all(begin, size);
+                return;
+            }
+        }
+        std::memcpy(next_, begin, size);
+        next_ += size;
+    }
+
+    template <size_t N> void put(char const (&s)[N]) {
+        put(s, N - 1);
+    }
+
+    void put(char c) {
+        if (next_ == buffer_ + sizeof(buffer_)) flush();
+        *next_++ = c;
+    }
+
+    void put_int(int number) {
+        char digits[16];
+        char* e = digits + sizeof(digits);
+        char* b = e;
+        unsigned int n = number < 0 ? 0u - unsigned(number) : unsigned(number);
+        do {
+            *--b = '0' + (n % 10);
+            n /= 10;
+        } while (n);
+        if (number < 0) *--b = '-';
+        put(b, e - b);
+    }
+
+    // Call after each complete line of output.
+    void end_line() {
+        if (next_ - buffer_ > high_water_mark) flush();
+    }
+
+    void flush() {
+        write_all(buffer_, next_ - buffer_);
+        next_ = buffer_;
+    }
+
+    size_t bytes_written() const {
+        return bytes_written_;
+    }
+
+private:
+    enum { high_water_mark = (1 << 20) - (1 << 16) };
+
+    void write_all(char const* begin, size_t size) {
+        while (size > 0) {
+            ssize_t n = ::write(fd_, begin, size);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                std::perror("fixprint write");
+                std::exit(1);
+            }
+            begin += n;
+            size -= n;
+            bytes_written_ += n;
+        }
+    }
+
+    int fd_;
+    char buffer_[1 << 20];
+    char* next_;
+    size_t bytes_written_;
+};
+
+output_buffer out(1);
+
+/*
+Message selection for --msgtype, --where and --fields.
+
+Selection is done before any formatting. The MsgType is already known from
+framing, and --where conditions are matched on the raw message bytes by
+searching for "tag=" at the start of a field with memmem(), so messages which
+don't match are never iterated field-by-field. A field value inside a binary data field which
+happens to contain "<SOH>tag=" can cause a false match.
+*/
+class message_filter {
+public:
+    message_filter() {}
+
+    ~message_filter() {
+        for (std::list<condition>::iterator i = conditions_.begin(); i != conditions_.end(); ++i)
+            if (i->is_regex) regfree(&i->regex);
+    }
+
+    // Parse a comma-separated list of MsgType values.
+    bool add_msgtypes(char const* arg) {
+        std::vector<std::string> values = split(arg);
+        if (values.empty()) return false;
+        msgtypes_.insert(msgtypes_.end(), values.begin(), values.end());
+        return true;
+    }
+
+    // Parse "tag=value" or "tag~regex".
+    bool add_where(char const* arg) {
+        char const* op = arg;
+        while (*op >= '0' && *op <= '9') ++op;
+        if (op == arg || (*op != '=' && *op != '~')) return false;
+
+        // The regex is compiled in place, because a regex_t can't be copied.
+        conditions_.push_back(condition());
+        condition& c = conditions_.back();
+        c.needle = std::string(arg, op) + '=';
+        c.is_regex = false;
+        c.value = op + 1;
+        if (*op == '~') {
+            if (regcomp(&c.regex, c.value.c_str(), REG_EXTENDED | REG_NOSUB)) {
+                conditions_.pop_back();
+                return false;
+            }
+            c.is_regex = true;
+        }
+        return true;
     }
 
+    // Parse a comma-separated list of tags to print.
+    bool add_fields(char const* arg) {
+        std::vector<std::string> tags = split(arg);
+        if (tags.empty()) return false;
+        for (size_t i = 0; i < tags.size(); ++i) {
+            if (tags[i].find_first_not_of("0123456789") != std::string::npos || tags[i].size() > 6) return false;
+            size_t tag = std::strtoul(tags[i].c_str(), 0, 10);
+            if (tag >= projection_.size()) projection_.resize(tag + 1);
+            projection_[tag] = true;
+        }
+        return true;
+    }
+
+    // True if the message should be printed.
+    bool matches(hffix::message_reader const& reader) {
+        if (!msgtypes_.empty()) {
+            hffix::field_value const msgtype = reader.message_type()->value();
+            bool found = false;
+            for (size_t i = 0; i < msgtypes_.size() && !found; ++i)
+                found = (msgtype == msgtypes_[i]);
+            if (!found) return false;
+        }
+        for (std::list<condition>::const_iterator i = conditions_.begin(); i != conditions_.end(); ++i)
+            if (!matches(*i, reader.message_begin(), reader.message_end()))
+                return false;
+        return true;
+    }
+
+    // True if the field with this tag should be printed.
+    bool is_projected(int tag) const {
+        if (projection_.empty()) return true;
+        return tag >= 0 && size_t(tag) < projection_.size() && projection_[tag];
+    }
+
+private:
+    struct condition {
+        std::string needle; // "tag="
+        std::string value;
+        bool is_regex;
+        regex_t regex;
+    };
+
+    bool matches(condition const& c, char const* begin, char const* end) {
+        for (char const* b = begin; b < end; ) {
+            char const* found = (char const*)memmem(b, end - b, c.needle.data(), c.needle.size());
+            if (!found) return false;
+            if (found > begin && found[-1] != '\x01') { // Not the start of a field.
+                b = found + 1;
+                continue;
+            }
+            char const* value_begin = found + c.needle.size();
+            char const* value_end = (char const*)std::memchr(value_begin, '\x01', end - value_begin);
+            if (!value_end) return false;
+
+            if (c.is_regex) {
+                scratch_.assign(value_begin, value_end);
+                if (0 == regexec(&c.regex, scratch_.c_str(), 0, 0, 0)) return true;
+            } else if (size_t(value_end - value_begin) == c.value.size()
+                       && 0 == std::memcmp(value_begin, c.value.data(), c.value.size())) {
+                return true;
+            }
+            b = value_end; // Repeating groups may contain the tag more than once.
+        }
+        return false;
+    }
+
+    static std::vector<std::string> split(char const* arg) {
+        std::vector<std::string> items;
+        for (char const* b = arg; *b; ) {
+            char const* e = std::strchr(b, ',');
+            if (!e) e = b + std::strlen(b);
+            if (e > b) items.push_back(std::string(b, e));
+            b = *e ? e + 1 : e;
+        }
+        return items;
+    }
+
+    message_filter(message_filter const&);
+    message_filter& operator=(message_filter const&);
+
+    std::vector<std::string> msgtypes_;
+    std::list<condition> conditions_; // Not a vector, which would copy the regex_t.
+    std::vector<bool> projection_;
+    std::string scratch_;
+};
+
+double now_seconds() {
+    timeval tv;
+    gettimeofday(&tv, 0);
+    return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+int main(int argc, char** argv)
+{
     bool color = true;
-    if (argc > 1) {
-        if (0 == std::strcmp("-c", argv[1]))
-            color = true;
-        if (0 == std::strcmp("--color", argv[1]))
+    bool stats = false;
+    message_filter filter;
+
+    for (int a = 1; a < argc; ++a) {
+        if ((0 == std::strcmp("-h", argv[a])) || (0 == std::strcmp("--help", argv[a]))) {
+            std::cout <<
+                "fixprint [Options]\n\n"
+                "Reads raw FIX encoded data from stdin and writes annotated human-readable FIX to stdout.\n\n"
+                "Options:\n"
+                "  -c --color     Color output.\n"
+                "     --no-color  No color output.\n"
+                "     --stats     Report throughput to stderr when finished.\n\n"
+                "Selection:\n"
+                "  -m --msgtype V[,V...]   Print only messages with one of these MsgType values.\n"
+                "  -w --where TAG=VALUE    Print only messages with a TAG field equal to VALUE.\n"
+                "  -w --where TAG~REGEX    Print only messages with a TAG field matching the\n"
+                "                          POSIX extended regular expression REGEX.\n"
+                "  -f --fields TAG[,TAG...] Print only these fields of each message.\n\n"
+                "  --msgtype may be given more than once, and matches if any value matches.\n"
+                "  --where may be given more than once, and matches if all conditions match.\n"
+                "  --where is matched on the raw message bytes.\n\n";
+            exit(0);
+        }
+        else if (a + 1 < argc && (0 == std::strcmp("-m", argv[a]) || 0 == std::strcmp("--msgtype", argv[a]))) {
+            if (!filter.add_msgtypes(argv[++a])) {
+                std::cerr << "fixprint: bad --msgtype " << argv[a] << '\n';
+                exit(2);
+            }
+        }
+        else if (a + 1 < argc && (0 == std::strcmp("-w", argv[a]) || 0 == std::strcmp("--where", argv[a]))) {
+            if (!filter.add_where(argv[++a])) {
+                std::cerr << "fixprint: bad --where " << argv[a] << '\n';
+                exit(2);
+            }
+        }
+        else if (a + 1 < argc && (0 == std::strcmp("-f", argv[a]) || 0 == std::strcmp("--fields", argv[a]))) {
+            if (!filter.add_fields(argv[++a])) {
+                std::cerr << "fixprint: bad --fields " << argv[a] << '\n';
+                exit(2);
+            }
+        }
+        else if (0 == std::strcmp("-c", argv[a]) || 0 == std::strcmp("--color", argv[a]))
             color = true;
-        if (0 == std::strcmp("--no-color", argv[1]))
+        else if (0 == std::strcmp("--no-color", argv[a]))
             color = false;
+        else if (0 == std::strcmp("--stats", argv[a]))
+            stats = true;
+        // Unknown arguments are ignored.
     }
 
-    std::map<int, std::string> field_dictionary;
-    hffix::dictionary_init_field(field_dictionary);
-    std::map<std::string, std::string> message_dictionary;
-    hffix::dictionary_init_message(message_dictionary);
+    double const time_start = now_seconds();
+    size_t bytes_read(0);
+    size_t messages(0);
+    size_t messages_printed(0);
 
     size_t buffer_length(0); // The number of bytes read in buffer[].
 
-    size_t fred; // Number of bytes read from fread().
+    ssize_t fred; // Number of bytes read from read().
 
-    // Read chunks from stdin until 0 is read or the buffer fills up without finding a complete message.
-    while((fred = std::fread(buffer + buffer_length, 1, std::min(sizeof(buffer) - buffer_length, size_t(chunksize)), stdin))) {
+    // Read from stdin until 0 is read or the buffer fills up without finding a complete message.
+    while (buffer_length < sizeof(buffer) && (fred = ::read(0, buffer + buffer_length, sizeof(buffer) - buffer_length))) {
+        if (fred < 0) {
+            if (errno == EINTR) continue;
+            std::perror("fixprint read");
+            return 1;
+        }
 
         buffer_length += fred;
+        bytes_read += fred;
         hffix::message_reader reader(buffer, buffer + buffer_length);
 
         // Try to read as many complete messages as there are in the buffer.
         for (; reader.is_complete(); reader = reader.next_message_reader()) {
             if (reader.is_valid()) {
+                ++messages;
+
+                if (!filter.matches(reader)) continue;
+                ++messages_printed;
 
                 // Here is a complete message. Read fields out of the reader.
-                if (color) std::cout << color_value;
-                std::cout.write(reader.prefix_begin(), reader.prefix_size());
-                std::cout << ' ';
+                if (color) out.put(color_value);
+                out.put(reader.prefix_begin(), reader.prefix_size());
+                out.put(' ');
 
                 try {
                     for(hffix::message_reader::const_iterator i = reader.begin(); i != reader.end(); ++i) {
 
-                        if (color) std::cout << color_field;
+                        if (!filter.is_projected(i->tag())) continue;
 
-                        std::map<int, std::string>::iterator fname = field_dictionary.find(i->tag());
-                        if (fname != field_dictionary.end())
-                            std::cout << fname->second << '_'; // Print the name of the field, if it's known.
-                        std::cout << i->tag();
+                        if (color) out.put(color_field);
 
-                        std::cout << '=';
+                        char const* fname = hffix::dictionary_field_name(i->tag());
+                        if (fname) {
+                            out.put(fname, std::strlen(fname)); // Print the name of the field, if it's known.
+                            out.put('_');
+                        }
+                        out.put_int(i->tag());
 
-                        if (color) std::cout << (i->tag() == hffix::tag::MsgType ? color_msgtype : color_value);
+                        out.put('=');
 
-                        std::cout.write(i->value().begin(), i->value().size());
+                        if (color) {
+                            if (i->tag() == hffix::tag::MsgType) out.put(color_msgtype);
+                            else out.put(color_value);
+                        }
+
+                        out.put(i->value().begin(), i->value().size());
 
                         if (i->tag() == hffix::tag::MsgType) { // If this is a MsgType field.
-                            std::map<std::string, std::string>::iterator mname = message_dictionary.find(std::string(i->value().begin(), i->value().end()));
-                            if (mname != message_dictionary.end())
-                                std::cout << '_' << mname->second; // Print the name of the message, if it's known.
+                            char const* mname = hffix::dictionary_message_name(i->value().begin(), i->value().end());
+                            if (mname) {
+                                out.put('_'); // Print the name of the message, if it's known.
+                                out.put(mname, std::strlen(mname));
+                            }
                         }
 
-                        std::cout << ' ';
+                        out.put(' ');
                     }
 
-                    std::cout << '\n';
+                    out.put('\n');
+                    out.end_line();
                 }
                 catch(std::exception& ex) {
                     std::cerr << "Error reading the fields: " << ex.what() << '\n';
@@ -112,6 +396,20 @@ int main(int argc, char** argv)
             std::memmove(buffer, reader.buffer_begin(), buffer_length); // Move the partial portion of the incomplete message to buffer[0].
     }
 
-    if (color) std::cout << color_default;
+    if (color) out.put(color_default);
+    out.flush();
+
+    if (stats) {
+        double const seconds = std::max(now_seconds() - time_start, 1e-9);
+        std::fprintf(stderr,
+            "fixprint: %lu messages, %lu printed, %.1f MB read, %.1f MB written in %.3f s: %.1f MB/s, %.0f messages/s\n",
+            (unsigned long)messages,
+            (unsigned long)messages_printed,
+            bytes_read / 1e6,
+            out.bytes_written() / 1e6,
+            seconds,
+            bytes_read / 1e6 / seconds,
+            messages / seconds);
+    }
     return 0;
 }